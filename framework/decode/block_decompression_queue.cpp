@@ -0,0 +1,256 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/block_decompression_queue.h"
+
+#include "format/api_call_id.h"
+#include "format/format.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+BlockDecompressionQueue::BlockDecompressionQueue(util::Compressor* compressor,
+                                                 const uint8_t*    file_data,
+                                                 uint64_t          file_size,
+                                                 uint64_t          first_block_offset,
+                                                 uint32_t          num_threads) :
+    compressor_(compressor), file_data_(file_data), file_size_(file_size), scan_offset_(first_block_offset),
+    pending_bytes_(0), free_bytes_(0), workers_(num_threads)
+{
+    assert(compressor_ != nullptr);
+    assert(file_data_ != nullptr);
+
+    Refill();
+}
+
+BlockDecompressionQueue::~BlockDecompressionQueue()
+{
+    // Let in-flight work finish before the worker threads are joined and the pending blocks are released.
+    for (auto& block : pending_blocks_)
+    {
+        block->task.wait();
+    }
+}
+
+const uint8_t* BlockDecompressionQueue::Acquire(uint64_t data_offset, size_t compressed_size, size_t uncompressed_size)
+{
+    if (current_block_ != nullptr)
+    {
+        Recycle(std::move(current_block_));
+    }
+
+    // Discard blocks that the decode thread skipped over.
+    while (!pending_blocks_.empty() && (pending_blocks_.front()->data_offset < data_offset))
+    {
+        auto block = std::move(pending_blocks_.front());
+        pending_blocks_.pop_front();
+        block->task.wait();
+        Recycle(std::move(block));
+    }
+
+    const uint8_t* data = nullptr;
+
+    if (!pending_blocks_.empty())
+    {
+        auto& front = pending_blocks_.front();
+
+        if ((front->data_offset == data_offset) && (front->compressed_size == compressed_size) &&
+            (front->uncompressed_size == uncompressed_size))
+        {
+            current_block_ = std::move(front);
+            pending_blocks_.pop_front();
+
+            // A failed decompression is reported by the caller when it retries the block inline.
+            current_block_->task.wait();
+
+            if (current_block_->success)
+            {
+                data = current_block_->data.data();
+            }
+        }
+    }
+
+    Refill();
+
+    return data;
+}
+
+void BlockDecompressionQueue::Refill()
+{
+    while ((scan_offset_ < file_size_) && (pending_blocks_.size() < kMaxPendingBlocks) &&
+           (pending_bytes_ < kMaxPendingBytes))
+    {
+        if (!ScanBlock(scan_offset_, &scan_offset_))
+        {
+            // Truncated or invalid block, or a block that the decode thread must process first.
+            scan_offset_ = file_size_;
+        }
+    }
+}
+
+bool BlockDecompressionQueue::ScanBlock(uint64_t block_offset, uint64_t* next_block_offset)
+{
+    format::BlockHeader block_header;
+
+    if (!PeekValue(block_offset, &block_header))
+    {
+        return false;
+    }
+
+    uint64_t data_offset = block_offset + sizeof(block_header);
+
+    if ((block_header.size > file_size_) || (data_offset > (file_size_ - block_header.size)))
+    {
+        return false;
+    }
+
+    // Size of the uncompressed fields that precede the compressed payload, including the uncompressed size field.
+    uint64_t header_size       = 0;
+    uint64_t uncompressed_size = 0;
+
+    switch (block_header.type)
+    {
+        case format::BlockType::kCompressedFunctionCallBlock:
+            header_size = sizeof(format::ApiCallId) + sizeof(format::ThreadId) + sizeof(uncompressed_size);
+            break;
+        case format::BlockType::kCompressedMethodCallBlock:
+            header_size = sizeof(format::ApiCallId) + sizeof(format::HandleId) + sizeof(format::ThreadId) +
+                          sizeof(uncompressed_size);
+            break;
+        case format::BlockType::kCompressedMetaDataBlock:
+        {
+            format::MetaDataId meta_data_id = 0;
+
+            if (PeekValue(data_offset, &meta_data_id))
+            {
+                format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
+
+                // For both commands, the uncompressed data size is the last field of the header.
+                if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
+                {
+                    header_size = sizeof(format::FillMemoryCommandHeader) - sizeof(format::BlockHeader);
+                }
+                else if (meta_data_type == format::MetaDataType::kInitBufferCommand)
+                {
+                    header_size = sizeof(format::InitBufferCommandHeader) - sizeof(format::BlockHeader);
+                }
+            }
+            break;
+        }
+        case format::BlockType::kMetaDataBlock:
+        {
+            format::MetaDataId meta_data_id = 0;
+
+            // Blocks that follow a dictionary cannot be decompressed until the decode thread has loaded it.
+            if (PeekValue(data_offset, &meta_data_id) &&
+                (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kSetCompressionDictionaryCommand))
+            {
+                return false;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    if ((header_size > 0) && (header_size < block_header.size) &&
+        PeekValue(data_offset + header_size - sizeof(uncompressed_size), &uncompressed_size) &&
+        (uncompressed_size > 0))
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+        QueueBlock(data_offset + header_size,
+                   static_cast<size_t>(block_header.size - header_size),
+                   static_cast<size_t>(uncompressed_size));
+    }
+
+    *next_block_offset = data_offset + block_header.size;
+
+    return true;
+}
+
+void BlockDecompressionQueue::QueueBlock(uint64_t data_offset, size_t compressed_size, size_t uncompressed_size)
+{
+    std::unique_ptr<PendingBlock> block;
+
+    if (!free_blocks_.empty())
+    {
+        block = std::move(free_blocks_.back());
+        free_blocks_.pop_back();
+
+        assert(free_bytes_ >= block->data.capacity());
+        free_bytes_ -= block->data.capacity();
+    }
+    else
+    {
+        block = std::make_unique<PendingBlock>();
+    }
+
+    block->data_offset       = data_offset;
+    block->compressed_size   = compressed_size;
+    block->uncompressed_size = uncompressed_size;
+
+    if (block->data.size() < uncompressed_size)
+    {
+        block->data.resize(uncompressed_size);
+    }
+
+    PendingBlock*     target          = block.get();
+    util::Compressor* compressor      = compressor_;
+    const uint8_t*    compressed_data = file_data_ + data_offset;
+
+    block->task.add();
+    workers_.post_detached([target, compressor, compressed_data]() {
+        size_t size =
+            compressor->Decompress(target->compressed_size, compressed_data, target->uncompressed_size, &target->data);
+        target->success = (size == target->uncompressed_size);
+        target->task.done();
+    });
+
+    pending_bytes_ += uncompressed_size;
+    pending_blocks_.emplace_back(std::move(block));
+}
+
+void BlockDecompressionQueue::Recycle(std::unique_ptr<PendingBlock> block)
+{
+    assert(pending_bytes_ >= block->uncompressed_size);
+
+    pending_bytes_ -= block->uncompressed_size;
+
+    if (block->data.capacity() > kMaxFreeBlockBytes)
+    {
+        // Release the buffer of an oversized block, but keep the block itself.
+        std::vector<uint8_t>().swap(block->data);
+    }
+
+    if ((free_bytes_ + block->data.capacity()) <= kMaxFreeBytes)
+    {
+        free_bytes_ += block->data.capacity();
+        free_blocks_.emplace_back(std::move(block));
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,122 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_BLOCK_DECOMPRESSION_QUEUE_H
+#define GFXRECON_DECODE_BLOCK_DECOMPRESSION_QUEUE_H
+
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/threadpool.h"
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Scans the block headers of a memory mapped capture file ahead of the decode position and decompresses the compressed
+// function call, method call, fill memory, and init buffer blocks it finds on a pool of worker threads.  Compressed
+// blocks are independent of each other, so the decode thread only has to wait when it catches up with the workers.
+// The number of blocks and bytes held by the queue is bounded.
+class BlockDecompressionQueue
+{
+  public:
+    // The compressor must outlive the queue.  A single instance is shared by all worker threads: compressors keep their
+    // streaming contexts in thread local storage, but the loaded dictionary is per instance state.  The queue must be
+    // destroyed before the compressor's dictionary is changed and recreated afterwards, as SeekToIndexEntry and the
+    // compression dictionary block handling in FileProcessor do.
+    BlockDecompressionQueue(util::Compressor* compressor,
+                            const uint8_t*    file_data,
+                            uint64_t          file_size,
+                            uint64_t          first_block_offset,
+                            uint32_t          num_threads);
+
+    ~BlockDecompressionQueue();
+
+    // Returns the decompressed data for the compressed block payload that starts at data_offset in the file, or nullptr
+    // if the block was not decompressed ahead of time and must be decompressed by the caller.  The returned data
+    // remains valid until the next call to Acquire.
+    const uint8_t* Acquire(uint64_t data_offset, size_t compressed_size, size_t uncompressed_size);
+
+  private:
+    struct PendingBlock
+    {
+        uint64_t             data_offset{ 0 };
+        size_t               compressed_size{ 0 };
+        size_t               uncompressed_size{ 0 };
+        std::vector<uint8_t> data;
+        bool                 success{ false };
+
+        // Set while the block is being decompressed on a worker thread.
+        util::ThreadPool::TaskCounter task;
+    };
+
+    void Refill();
+
+    bool ScanBlock(uint64_t block_offset, uint64_t* next_block_offset);
+
+    void QueueBlock(uint64_t data_offset, size_t compressed_size, size_t uncompressed_size);
+
+    void Recycle(std::unique_ptr<PendingBlock> block);
+
+    template <typename T>
+    bool PeekValue(uint64_t offset, T* value) const
+    {
+        if ((offset + sizeof(T)) > file_size_)
+        {
+            return false;
+        }
+        memcpy(value, file_data_ + offset, sizeof(T));
+        return true;
+    }
+
+  private:
+    static const size_t kMaxPendingBlocks = 256;
+    static const size_t kMaxPendingBytes  = 256 * 1024 * 1024;
+
+    // Bounds the buffer memory that is kept for reuse by later blocks.  Buffers of blocks that are larger than
+    // kMaxFreeBlockBytes are released instead of being kept, so that a few large blocks do not pin their allocations
+    // for the rest of the file.
+    static const size_t kMaxFreeBytes      = 64 * 1024 * 1024;
+    static const size_t kMaxFreeBlockBytes = 8 * 1024 * 1024;
+
+    util::Compressor*                          compressor_;
+    const uint8_t*                             file_data_;
+    uint64_t                                   file_size_;
+    uint64_t                                   scan_offset_;
+    size_t                                     pending_bytes_;
+    size_t                                     free_bytes_;
+    std::deque<std::unique_ptr<PendingBlock>>  pending_blocks_;
+    std::vector<std::unique_ptr<PendingBlock>> free_blocks_;
+    std::unique_ptr<PendingBlock>              current_block_;
+
+    // Declared last so that worker threads are joined before the blocks they write to are released.
+    util::ThreadPool workers_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_BLOCK_DECOMPRESSION_QUEUE_H
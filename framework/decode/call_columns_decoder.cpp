@@ -0,0 +1,255 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/call_columns_decoder.h"
+
+#include "decode/value_decoder.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Reads leading parameters of an API call in order.  Values past the end of the parameter buffer are read as 0.
+class CallParameterReader
+{
+  public:
+    CallParameterReader(const uint8_t* buffer, size_t buffer_size) :
+        buffer_(buffer), buffer_size_(buffer_size), offset_(0)
+    {}
+
+    format::HandleId ReadHandleId()
+    {
+        format::HandleId value = format::kNullHandleId;
+        offset_ += ValueDecoder::DecodeHandleIdValue(buffer_ + offset_, buffer_size_ - offset_, &value);
+        return value;
+    }
+
+    uint64_t ReadUInt32()
+    {
+        uint32_t value = 0;
+        offset_ += ValueDecoder::DecodeUInt32Value(buffer_ + offset_, buffer_size_ - offset_, &value);
+        return value;
+    }
+
+    uint64_t ReadInt32()
+    {
+        int32_t value = 0;
+        offset_ += ValueDecoder::DecodeInt32Value(buffer_ + offset_, buffer_size_ - offset_, &value);
+        return static_cast<uint64_t>(static_cast<int64_t>(value));
+    }
+
+    uint64_t ReadUInt64()
+    {
+        uint64_t value = 0;
+        offset_ += ValueDecoder::DecodeUInt64Value(buffer_ + offset_, buffer_size_ - offset_, &value);
+        return value;
+    }
+
+    uint64_t ReadEnum()
+    {
+        int32_t value = 0;
+        offset_ += ValueDecoder::DecodeEnumValue(buffer_ + offset_, buffer_size_ - offset_, &value);
+        return static_cast<uint64_t>(static_cast<int64_t>(value));
+    }
+
+    uint64_t ReadFlags()
+    {
+        uint32_t value = 0;
+        offset_ += ValueDecoder::DecodeFlagsValue(buffer_ + offset_, buffer_size_ - offset_, &value);
+        return value;
+    }
+
+  private:
+    const uint8_t* buffer_;
+    size_t         buffer_size_;
+    size_t         offset_;
+};
+
+// Returns true for the Vulkan commands that do not have a dispatchable handle as their first parameter.
+static bool IsGlobalVulkanCommand(format::ApiCallId call_id)
+{
+    return (call_id == format::ApiCallId::ApiCall_vkCreateInstance) ||
+           (call_id == format::ApiCallId::ApiCall_vkEnumerateInstanceExtensionProperties) ||
+           (call_id == format::ApiCallId::ApiCall_vkEnumerateInstanceLayerProperties) ||
+           (call_id == format::ApiCallId::ApiCall_vkEnumerateInstanceVersion);
+}
+
+std::vector<ColumnTable::Column> CallColumnsDecoder::GetColumns()
+{
+    std::vector<ColumnTable::Column> columns(kColumnCount);
+
+    // The block index and frame increase with each call, so they are delta encoded to compress well.
+    columns[kColumnIndex]    = { "index", ColumnTable::ColumnType::kUInt64, ColumnTable::ColumnEncoding::kDelta };
+    columns[kColumnFrame]    = { "frame", ColumnTable::ColumnType::kUInt32, ColumnTable::ColumnEncoding::kDelta };
+    columns[kColumnCallId]   = { "call_id", ColumnTable::ColumnType::kUInt32, ColumnTable::ColumnEncoding::kPlain };
+    columns[kColumnThreadId] = { "thread_id", ColumnTable::ColumnType::kUInt64, ColumnTable::ColumnEncoding::kPlain };
+    columns[kColumnObjectId] = { "object_id", ColumnTable::ColumnType::kUInt64, ColumnTable::ColumnEncoding::kPlain };
+    columns[kColumnHandleId] = { "handle_id", ColumnTable::ColumnType::kUInt64, ColumnTable::ColumnEncoding::kPlain };
+
+    for (size_t i = 0; i < kArgCount; ++i)
+    {
+        columns[kColumnArg0 + i] = {
+            "arg" + std::to_string(i), ColumnTable::ColumnType::kInt64, ColumnTable::ColumnEncoding::kPlain
+        };
+    }
+
+    return columns;
+}
+
+void CallColumnsDecoder::DecodeFunctionCall(format::ApiCallId  call_id,
+                                            const ApiCallInfo& call_info,
+                                            const uint8_t*     parameter_buffer,
+                                            size_t             buffer_size)
+{
+    CallParameterReader params(parameter_buffer, buffer_size);
+    format::HandleId    object_id = format::kNullHandleId;
+
+    if ((format::GetApiCallFamily(call_id) == format::ApiFamily_Vulkan) && !IsGlobalVulkanCommand(call_id))
+    {
+        object_id = params.ReadHandleId();
+    }
+
+    // Each parameter is read with a separate statement, as the parameters must be read in order.
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkCmdDraw:
+        case format::ApiCallId::ApiCall_vkCmdDispatch:
+        {
+            const size_t arg_count = (call_id == format::ApiCallId::ApiCall_vkCmdDraw) ? 4 : 3;
+            for (size_t i = 0; i < arg_count; ++i)
+            {
+                writer_->SetValue(kColumnArg0 + i, params.ReadUInt32());
+            }
+            break;
+        }
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexed:
+            writer_->SetValue(kColumnArg0, params.ReadUInt32());
+            writer_->SetValue(kColumnArg0 + 1, params.ReadUInt32());
+            writer_->SetValue(kColumnArg0 + 2, params.ReadUInt32());
+            writer_->SetValue(kColumnArg0 + 3, params.ReadInt32());
+            writer_->SetValue(kColumnArg0 + 4, params.ReadUInt32());
+            break;
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
+            writer_->SetValue(kColumnHandleId, params.ReadHandleId());
+            writer_->SetValue(kColumnArg0, params.ReadUInt64());
+            writer_->SetValue(kColumnArg0 + 1, params.ReadUInt32());
+            writer_->SetValue(kColumnArg0 + 2, params.ReadUInt32());
+            break;
+        case format::ApiCallId::ApiCall_vkCmdDispatchIndirect:
+            writer_->SetValue(kColumnHandleId, params.ReadHandleId());
+            writer_->SetValue(kColumnArg0, params.ReadUInt64());
+            break;
+        case format::ApiCallId::ApiCall_vkCmdBindPipeline:
+            writer_->SetValue(kColumnArg0, params.ReadEnum());
+            writer_->SetValue(kColumnHandleId, params.ReadHandleId());
+            break;
+        case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets:
+            writer_->SetValue(kColumnArg0, params.ReadEnum());
+            writer_->SetValue(kColumnHandleId, params.ReadHandleId());
+            writer_->SetValue(kColumnArg0 + 1, params.ReadUInt32());
+            writer_->SetValue(kColumnArg0 + 2, params.ReadUInt32());
+            break;
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers:
+            writer_->SetValue(kColumnArg0, params.ReadUInt32());
+            writer_->SetValue(kColumnArg0 + 1, params.ReadUInt32());
+            break;
+        case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer:
+            writer_->SetValue(kColumnHandleId, params.ReadHandleId());
+            writer_->SetValue(kColumnArg0, params.ReadUInt64());
+            writer_->SetValue(kColumnArg0 + 1, params.ReadEnum());
+            break;
+        case format::ApiCallId::ApiCall_vkCmdPipelineBarrier:
+            writer_->SetValue(kColumnArg0, params.ReadFlags());
+            writer_->SetValue(kColumnArg0 + 1, params.ReadFlags());
+            writer_->SetValue(kColumnArg0 + 2, params.ReadFlags());
+            writer_->SetValue(kColumnArg0 + 3, params.ReadUInt32());
+            break;
+        case format::ApiCallId::ApiCall_vkQueueSubmit:
+        case format::ApiCallId::ApiCall_vkQueueSubmit2:
+        case format::ApiCallId::ApiCall_vkQueueSubmit2KHR:
+            writer_->SetValue(kColumnArg0, params.ReadUInt32());
+            break;
+        default:
+            break;
+    }
+
+    WriteRow(call_id, call_info, object_id);
+}
+
+void CallColumnsDecoder::DecodeMethodCall(format::ApiCallId  call_id,
+                                          format::HandleId   object_id,
+                                          const ApiCallInfo& call_info,
+                                          const uint8_t*     parameter_buffer,
+                                          size_t             buffer_size)
+{
+    CallParameterReader params(parameter_buffer, buffer_size);
+
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_DrawInstanced:
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_Dispatch:
+        {
+            const size_t arg_count =
+                (call_id == format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_DrawInstanced) ? 4 : 3;
+            for (size_t i = 0; i < arg_count; ++i)
+            {
+                writer_->SetValue(kColumnArg0 + i, params.ReadUInt32());
+            }
+            break;
+        }
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_DrawIndexedInstanced:
+            writer_->SetValue(kColumnArg0, params.ReadUInt32());
+            writer_->SetValue(kColumnArg0 + 1, params.ReadUInt32());
+            writer_->SetValue(kColumnArg0 + 2, params.ReadUInt32());
+            writer_->SetValue(kColumnArg0 + 3, params.ReadInt32());
+            writer_->SetValue(kColumnArg0 + 4, params.ReadUInt32());
+            break;
+        case format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_SetPipelineState:
+            writer_->SetValue(kColumnHandleId, params.ReadHandleId());
+            break;
+        case format::ApiCallId::ApiCall_ID3D12CommandQueue_ExecuteCommandLists:
+            writer_->SetValue(kColumnArg0, params.ReadUInt32());
+            break;
+        case format::ApiCallId::ApiCall_IDXGISwapChain_Present:
+            writer_->SetValue(kColumnArg0, params.ReadUInt32());
+            writer_->SetValue(kColumnArg0 + 1, params.ReadUInt32());
+            break;
+        default:
+            break;
+    }
+
+    WriteRow(call_id, call_info, object_id);
+}
+
+void CallColumnsDecoder::WriteRow(format::ApiCallId call_id, const ApiCallInfo& call_info, format::HandleId object_id)
+{
+    writer_->SetValue(kColumnIndex, call_info.index);
+    writer_->SetValue(kColumnFrame, frame_number_);
+    writer_->SetValue(kColumnCallId, call_id);
+    writer_->SetValue(kColumnThreadId, call_info.thread_id);
+    writer_->SetValue(kColumnObjectId, object_id);
+    writer_->EndRow();
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
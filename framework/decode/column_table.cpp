@@ -0,0 +1,466 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/column_table.h"
+
+#include "format/format_util.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const char ColumnTable::kHeaderMagic[8] = { 'G', 'F', 'X', 'R', 'C', 'O', 'L', 'S' };
+const char ColumnTable::kFooterMagic[8] = { 'G', 'F', 'X', 'R', 'C', 'O', 'L', 'E' };
+
+// Size of the footer that follows the row group offset table: row group count, row count, and magic.
+static const size_t kFooterSize = sizeof(uint64_t) + sizeof(uint64_t) + sizeof(ColumnTable::kFooterMagic);
+
+// Stored columns have a name length limit so that a corrupt descriptor is not used to size an allocation.
+static const uint32_t kMaxColumnNameSize = 1024;
+
+ColumnTableWriter::ColumnTableWriter() :
+    file_(nullptr), row_group_size_(ColumnTable::kDefaultRowGroupSize), offset_(0), row_count_(0),
+    write_failed_(false)
+{}
+
+ColumnTableWriter::~ColumnTableWriter()
+{
+    Close();
+}
+
+bool ColumnTableWriter::Open(const std::string&                      filename,
+                             const std::vector<ColumnTable::Column>& columns,
+                             format::CompressionType                 compression_type,
+                             uint32_t                                row_group_size)
+{
+    GFXRECON_ASSERT(file_ == nullptr);
+    GFXRECON_ASSERT(row_group_size > 0);
+
+    if (compression_type != format::CompressionType::kNone)
+    {
+        compressor_.reset(format::CreateCompressor(compression_type));
+        if (compressor_ == nullptr)
+        {
+            GFXRECON_LOG_WARNING("Failed to initialize %s compression for column table file %s; columns will not be "
+                                 "compressed",
+                                 format::GetCompressionTypeName(compression_type).c_str(),
+                                 filename.c_str());
+            compression_type = format::CompressionType::kNone;
+        }
+    }
+
+    if (util::platform::FileOpen(&file_, filename.c_str(), "wb") != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to open column table file %s", filename.c_str());
+        file_ = nullptr;
+        return false;
+    }
+
+    columns_        = columns;
+    row_group_size_ = row_group_size;
+    offset_         = 0;
+    row_count_      = 0;
+    write_failed_   = false;
+    row_values_.assign(columns_.size(), 0);
+    group_values_.assign(columns_.size(), std::vector<uint64_t>());
+    row_group_offsets_.clear();
+
+    for (auto& values : group_values_)
+    {
+        values.reserve(row_group_size_);
+    }
+
+    const uint32_t header[] = { ColumnTable::kVersion,
+                                static_cast<uint32_t>(compression_type),
+                                row_group_size_,
+                                static_cast<uint32_t>(columns_.size()) };
+
+    WriteData(ColumnTable::kHeaderMagic, sizeof(ColumnTable::kHeaderMagic));
+    WriteData(header, sizeof(header));
+
+    for (const auto& column : columns_)
+    {
+        const uint32_t descriptor[] = { static_cast<uint32_t>(column.type),
+                                        static_cast<uint32_t>(column.encoding),
+                                        static_cast<uint32_t>(column.name.size()) };
+
+        WriteData(descriptor, sizeof(descriptor));
+        WriteData(column.name.data(), column.name.size());
+    }
+
+    return !write_failed_;
+}
+
+void ColumnTableWriter::EndRow()
+{
+    GFXRECON_ASSERT(file_ != nullptr);
+
+    for (size_t i = 0; i < row_values_.size(); ++i)
+    {
+        group_values_[i].push_back(row_values_[i]);
+        row_values_[i] = 0;
+    }
+
+    ++row_count_;
+
+    if ((!group_values_.empty()) && (group_values_[0].size() >= row_group_size_))
+    {
+        WriteRowGroup();
+    }
+}
+
+bool ColumnTableWriter::Close()
+{
+    if (file_ == nullptr)
+    {
+        return false;
+    }
+
+    if ((!group_values_.empty()) && (!group_values_[0].empty()))
+    {
+        WriteRowGroup();
+    }
+
+    const uint64_t footer[] = { static_cast<uint64_t>(row_group_offsets_.size()), row_count_ };
+
+    WriteData(row_group_offsets_.data(), row_group_offsets_.size() * sizeof(uint64_t));
+    WriteData(footer, sizeof(footer));
+    WriteData(ColumnTable::kFooterMagic, sizeof(ColumnTable::kFooterMagic));
+
+    if (util::platform::FileClose(file_) != 0)
+    {
+        write_failed_ = true;
+    }
+    file_ = nullptr;
+
+    if (write_failed_)
+    {
+        GFXRECON_LOG_ERROR("Failed to write column table file");
+    }
+
+    return !write_failed_;
+}
+
+bool ColumnTableWriter::WriteRowGroup()
+{
+    const uint64_t group_row_count = group_values_[0].size();
+
+    row_group_offsets_.push_back(offset_);
+    WriteData(&group_row_count, sizeof(group_row_count));
+
+    for (size_t i = 0; i < columns_.size(); ++i)
+    {
+        const ColumnTable::Column& column     = columns_[i];
+        std::vector<uint64_t>&     values     = group_values_[i];
+        const size_t               value_size = ColumnTable::GetValueSize(column.type);
+
+        if (column.encoding == ColumnTable::ColumnEncoding::kDelta)
+        {
+            // Convert in place from the last value, so that each difference is taken from the original value.
+            for (size_t j = values.size() - 1; j > 0; --j)
+            {
+                values[j] -= values[j - 1];
+            }
+        }
+
+        chunk_data_.resize(values.size() * value_size);
+
+        if (value_size == sizeof(uint64_t))
+        {
+            memcpy(chunk_data_.data(), values.data(), chunk_data_.size());
+        }
+        else
+        {
+            uint32_t* chunk_values = reinterpret_cast<uint32_t*>(chunk_data_.data());
+            for (size_t j = 0; j < values.size(); ++j)
+            {
+                chunk_values[j] = static_cast<uint32_t>(values[j]);
+            }
+        }
+
+        const uint8_t* stored_data = chunk_data_.data();
+        uint64_t       stored_size = chunk_data_.size();
+
+        if (compressor_ != nullptr)
+        {
+            size_t compressed_size =
+                compressor_->Compress(chunk_data_.size(), chunk_data_.data(), &compressed_data_, 0);
+
+            // A chunk that does not shrink is stored uncompressed, which readers identify by equal sizes.
+            if ((compressed_size > 0) && (compressed_size < chunk_data_.size()))
+            {
+                stored_data = compressed_data_.data();
+                stored_size = compressed_size;
+            }
+        }
+
+        const uint64_t chunk_header[] = { static_cast<uint64_t>(chunk_data_.size()), stored_size };
+
+        WriteData(chunk_header, sizeof(chunk_header));
+        WriteData(stored_data, static_cast<size_t>(stored_size));
+
+        values.clear();
+    }
+
+    return !write_failed_;
+}
+
+bool ColumnTableWriter::WriteData(const void* data, size_t size)
+{
+    if ((size > 0) && !write_failed_)
+    {
+        if (util::platform::FileWrite(data, size, file_))
+        {
+            offset_ += size;
+        }
+        else
+        {
+            write_failed_ = true;
+        }
+    }
+
+    return !write_failed_;
+}
+
+ColumnTableReader::ColumnTableReader() : file_(nullptr), row_count_(0) {}
+
+ColumnTableReader::~ColumnTableReader()
+{
+    Close();
+}
+
+bool ColumnTableReader::Open(const std::string& filename)
+{
+    GFXRECON_ASSERT(file_ == nullptr);
+
+    if (util::platform::FileOpen(&file_, filename.c_str(), "rb") != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to open column table file %s", filename.c_str());
+        file_ = nullptr;
+        return false;
+    }
+
+    char     magic[sizeof(ColumnTable::kHeaderMagic)];
+    uint32_t header[4];
+
+    if (!ReadData(magic, sizeof(magic)) || (memcmp(magic, ColumnTable::kHeaderMagic, sizeof(magic)) != 0) ||
+        !ReadData(header, sizeof(header)) || (header[0] != ColumnTable::kVersion))
+    {
+        GFXRECON_LOG_ERROR("File %s is not a supported column table file", filename.c_str());
+        Close();
+        return false;
+    }
+
+    const auto compression_type = static_cast<format::CompressionType>(header[1]);
+    if (compression_type != format::CompressionType::kNone)
+    {
+        compressor_.reset(format::CreateCompressor(compression_type));
+        if (compressor_ == nullptr)
+        {
+            GFXRECON_LOG_ERROR(
+                "Column table file %s uses unsupported compression type %u", filename.c_str(), header[1]);
+            Close();
+            return false;
+        }
+    }
+
+    columns_.resize(header[3]);
+    for (auto& column : columns_)
+    {
+        uint32_t descriptor[3];
+        if (!ReadData(descriptor, sizeof(descriptor)) || (descriptor[2] > kMaxColumnNameSize))
+        {
+            GFXRECON_LOG_ERROR("Failed to read the column descriptors of column table file %s", filename.c_str());
+            Close();
+            return false;
+        }
+
+        column.type     = static_cast<ColumnTable::ColumnType>(descriptor[0]);
+        column.encoding = static_cast<ColumnTable::ColumnEncoding>(descriptor[1]);
+        column.name.resize(descriptor[2]);
+        ReadData(&column.name[0], column.name.size());
+    }
+
+    // The footer locates the row groups, so that they can be read in any order.
+    uint64_t footer[2];
+    if (!util::platform::FileSeek(file_, -static_cast<int64_t>(kFooterSize), util::platform::FileSeekEnd) ||
+        !ReadData(footer, sizeof(footer)) || !ReadData(magic, sizeof(magic)) ||
+        (memcmp(magic, ColumnTable::kFooterMagic, sizeof(magic)) != 0))
+    {
+        GFXRECON_LOG_ERROR("Column table file %s is incomplete", filename.c_str());
+        Close();
+        return false;
+    }
+
+    const int64_t file_size = util::platform::FileTell(file_);
+    if (footer[0] > (static_cast<uint64_t>(file_size) - kFooterSize) / sizeof(uint64_t))
+    {
+        GFXRECON_LOG_ERROR("Column table file %s has an invalid row group count", filename.c_str());
+        Close();
+        return false;
+    }
+
+    row_count_ = footer[1];
+    row_group_offsets_.resize(static_cast<size_t>(footer[0]));
+
+    const int64_t offsets_size = static_cast<int64_t>(row_group_offsets_.size() * sizeof(uint64_t));
+    const int64_t table_offset = -(static_cast<int64_t>(kFooterSize) + offsets_size);
+    if (!util::platform::FileSeek(file_, table_offset, util::platform::FileSeekEnd) ||
+        !ReadData(row_group_offsets_.data(), static_cast<size_t>(offsets_size)))
+    {
+        GFXRECON_LOG_ERROR("Failed to read the row group offsets of column table file %s", filename.c_str());
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void ColumnTableReader::Close()
+{
+    if (file_ != nullptr)
+    {
+        util::platform::FileClose(file_);
+        file_ = nullptr;
+    }
+
+    columns_.clear();
+    row_group_offsets_.clear();
+    compressor_.reset();
+    row_count_ = 0;
+}
+
+int32_t ColumnTableReader::FindColumn(const std::string& name) const
+{
+    for (size_t i = 0; i < columns_.size(); ++i)
+    {
+        if (columns_[i].name == name)
+        {
+            return static_cast<int32_t>(i);
+        }
+    }
+
+    return -1;
+}
+
+bool ColumnTableReader::ReadColumn(size_t row_group, size_t column, std::vector<uint64_t>* values)
+{
+    GFXRECON_ASSERT((file_ != nullptr) && (values != nullptr));
+    GFXRECON_ASSERT((row_group < row_group_offsets_.size()) && (column < columns_.size()));
+
+    uint64_t group_row_count = 0;
+
+    if (!util::platform::FileSeek(
+            file_, static_cast<int64_t>(row_group_offsets_[row_group]), util::platform::FileSeekSet) ||
+        !ReadData(&group_row_count, sizeof(group_row_count)))
+    {
+        return false;
+    }
+
+    // Skip the chunks of the preceding columns.
+    uint64_t chunk_header[2];
+    for (size_t i = 0; i < column; ++i)
+    {
+        if (!ReadData(chunk_header, sizeof(chunk_header)) ||
+            !util::platform::FileSeek(file_, static_cast<int64_t>(chunk_header[1]), util::platform::FileSeekCurrent))
+        {
+            return false;
+        }
+    }
+
+    const ColumnTable::Column& column_info = columns_[column];
+    const size_t               value_size  = ColumnTable::GetValueSize(column_info.type);
+
+    if (!ReadData(chunk_header, sizeof(chunk_header)) || (chunk_header[0] != group_row_count * value_size) ||
+        (chunk_header[1] > chunk_header[0]))
+    {
+        return false;
+    }
+
+    const size_t uncompressed_size = static_cast<size_t>(chunk_header[0]);
+    const size_t stored_size       = static_cast<size_t>(chunk_header[1]);
+
+    chunk_data_.resize(uncompressed_size);
+
+    if (stored_size == uncompressed_size)
+    {
+        if (!ReadData(chunk_data_.data(), stored_size))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        compressed_data_.resize(stored_size);
+        if ((compressor_ == nullptr) || !ReadData(compressed_data_.data(), stored_size) ||
+            (compressor_->Decompress(stored_size, compressed_data_, uncompressed_size, &chunk_data_) !=
+             uncompressed_size))
+        {
+            return false;
+        }
+    }
+
+    values->resize(static_cast<size_t>(group_row_count));
+
+    if (value_size == sizeof(uint64_t))
+    {
+        memcpy(values->data(), chunk_data_.data(), uncompressed_size);
+    }
+    else
+    {
+        const uint32_t* chunk_values = reinterpret_cast<const uint32_t*>(chunk_data_.data());
+        for (size_t i = 0; i < values->size(); ++i)
+        {
+            (*values)[i] = chunk_values[i];
+        }
+    }
+
+    if (column_info.encoding == ColumnTable::ColumnEncoding::kDelta)
+    {
+        for (size_t i = 1; i < values->size(); ++i)
+        {
+            (*values)[i] += (*values)[i - 1];
+        }
+
+        if (value_size != sizeof(uint64_t))
+        {
+            for (auto& value : *values)
+            {
+                value = static_cast<uint32_t>(value);
+            }
+        }
+    }
+
+    return true;
+}
+
+bool ColumnTableReader::ReadData(void* data, size_t size)
+{
+    return (size == 0) || util::platform::FileRead(data, size, file_);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,159 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_COLUMN_TABLE_H
+#define GFXRECON_DECODE_COLUMN_TABLE_H
+
+#include "format/format.h"
+#include "util/compressor.h"
+#include "util/defines.h"
+#include "util/logging.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// A column table file stores rows of fixed width integer columns.  Rows are grouped into row groups, and each column of
+// a row group is stored as a separately compressed chunk, so that a reader only reads and decompresses the columns that
+// it scans.  The layout is described in tools/convert/README.md.
+struct ColumnTable
+{
+    enum class ColumnType : uint32_t
+    {
+        kUInt32 = 0,
+        kUInt64 = 1,
+        kInt64  = 2
+    };
+
+    enum class ColumnEncoding : uint32_t
+    {
+        kPlain = 0,
+        kDelta = 1 // Each value is stored as the difference from the previous value of the row group.
+    };
+
+    struct Column
+    {
+        std::string    name;
+        ColumnType     type{ ColumnType::kUInt64 };
+        ColumnEncoding encoding{ ColumnEncoding::kPlain };
+    };
+
+    static const char     kHeaderMagic[8];
+    static const char     kFooterMagic[8];
+    static const uint32_t kVersion             = 1;
+    static const uint32_t kDefaultRowGroupSize = 65536;
+
+    static size_t GetValueSize(ColumnType type) { return (type == ColumnType::kUInt32) ? 4 : 8; }
+};
+
+class ColumnTableWriter
+{
+  public:
+    ColumnTableWriter();
+
+    ~ColumnTableWriter();
+
+    bool Open(const std::string&                      filename,
+              const std::vector<ColumnTable::Column>& columns,
+              format::CompressionType                 compression_type,
+              uint32_t                                row_group_size = ColumnTable::kDefaultRowGroupSize);
+
+    // Sets a value of the current row.  Values are stored with the width of the column type, and columns that are not
+    // set are written as 0.
+    void SetValue(size_t column, uint64_t value)
+    {
+        GFXRECON_ASSERT(column < row_values_.size());
+        row_values_[column] = value;
+    }
+
+    void EndRow();
+
+    // Writes the remaining rows and the footer.  Returns false if any write failed.
+    bool Close();
+
+    uint64_t GetRowCount() const { return row_count_; }
+
+  private:
+    bool WriteRowGroup();
+
+    bool WriteData(const void* data, size_t size);
+
+  private:
+    FILE*                              file_;
+    std::vector<ColumnTable::Column>   columns_;
+    std::unique_ptr<util::Compressor>  compressor_;
+    uint32_t                           row_group_size_;
+    std::vector<uint64_t>              row_values_;
+    std::vector<std::vector<uint64_t>> group_values_;
+    std::vector<uint8_t>               chunk_data_;
+    std::vector<uint8_t>               compressed_data_;
+    std::vector<uint64_t>              row_group_offsets_;
+    uint64_t                           offset_;
+    uint64_t                           row_count_;
+    bool                               write_failed_;
+};
+
+class ColumnTableReader
+{
+  public:
+    ColumnTableReader();
+
+    ~ColumnTableReader();
+
+    bool Open(const std::string& filename);
+
+    void Close();
+
+    const std::vector<ColumnTable::Column>& GetColumns() const { return columns_; }
+
+    // Returns the index of the named column, or -1 if the table does not contain the column.
+    int32_t FindColumn(const std::string& name) const;
+
+    uint64_t GetRowCount() const { return row_count_; }
+
+    size_t GetRowGroupCount() const { return row_group_offsets_.size(); }
+
+    // Reads and decompresses one column of a row group, with the values widened to 64 bits.
+    bool ReadColumn(size_t row_group, size_t column, std::vector<uint64_t>* values);
+
+  private:
+    bool ReadData(void* data, size_t size);
+
+  private:
+    FILE*                             file_;
+    std::vector<ColumnTable::Column>  columns_;
+    std::unique_ptr<util::Compressor> compressor_;
+    std::vector<uint64_t>             row_group_offsets_;
+    uint64_t                          row_count_;
+    std::vector<uint8_t>              chunk_data_;
+    std::vector<uint8_t>              compressed_data_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_COLUMN_TABLE_H
@@ -30,15 +30,15 @@
 #include "util/platform.h"
 #include "util/defines.h"
 
-#include "nlohmann/json.hpp"
 #include "vulkan/vulkan.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 using util::JsonOptions;
+using util::JsonStreamWriter;
 
-void FieldToJson(nlohmann::ordered_json&                               jdata,
+void FieldToJson(JsonStreamWriter&                                     writer,
                  VkGeometryTypeKHR                                     discriminant,
                  const Decoded_VkAccelerationStructureGeometryDataKHR* data,
                  const JsonOptions&                                    options)
@@ -48,21 +48,31 @@ void FieldToJson(nlohmann::ordered_json&                               jdata,
         switch (discriminant)
         {
             case VkGeometryTypeKHR::VK_GEOMETRY_TYPE_TRIANGLES_KHR:
-                FieldToJson(jdata["triangles"], data->triangles, options);
+                writer.BeginObject();
+                FieldToJson(writer.Key("triangles"), data->triangles, options);
+                writer.EndObject();
                 break;
             case VkGeometryTypeKHR::VK_GEOMETRY_TYPE_AABBS_KHR:
-                FieldToJson(jdata["aabbs"], data->aabbs, options);
+                writer.BeginObject();
+                FieldToJson(writer.Key("aabbs"), data->aabbs, options);
+                writer.EndObject();
                 break;
             case VkGeometryTypeKHR::VK_GEOMETRY_TYPE_INSTANCES_KHR:
-                FieldToJson(jdata["instances"], data->instances, options);
+                writer.BeginObject();
+                FieldToJson(writer.Key("instances"), data->instances, options);
+                writer.EndObject();
                 break;
             default:
-                jdata = "Unknown GeometryType: " + std::to_string(discriminant);
+                writer.String("Unknown GeometryType: " + std::to_string(discriminant));
         }
     }
+    else
+    {
+        writer.Null();
+    }
 }
 
-void FieldToJson(nlohmann::ordered_json&                           jdata,
+void FieldToJson(JsonStreamWriter&                                 writer,
                  const Decoded_VkAccelerationStructureGeometryKHR* data,
                  const JsonOptions&                                options)
 {
@@ -70,38 +80,57 @@ void FieldToJson(nlohmann::ordered_json&                           jdata,
     {
         const auto& decoded_value = *data->decoded_value;
         const auto& meta_struct   = *data;
-        FieldToJson(jdata["sType"], decoded_value.sType, options);
-        FieldToJson(jdata["geometryType"], decoded_value.geometryType, options);
-        FieldToJson(jdata["geometry"], decoded_value.geometryType, meta_struct.geometry, options);
-        FieldToJson(jdata["pNext"], meta_struct.pNext, options);
+        writer.BeginObject();
+        FieldToJson(writer.Key("sType"), decoded_value.sType, options);
+        FieldToJson(writer.Key("geometryType"), decoded_value.geometryType, options);
+        FieldToJson(writer.Key("geometry"), decoded_value.geometryType, meta_struct.geometry, options);
+        FieldToJson(writer.Key("pNext"), meta_struct.pNext, options);
+        writer.EndObject();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkClearValue* data, const JsonOptions& options)
+void FieldToJson(JsonStreamWriter& writer, const Decoded_VkClearValue* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
         const auto& decoded_value = *data->decoded_value;
         const auto& meta_struct   = *data;
-        FieldToJson(jdata["color"], meta_struct.color, options);
-        FieldToJson(jdata["depthStencil"]["depth"], decoded_value.depthStencil.depth, options);
-        FieldToJson(jdata["depthStencil"]["stencil"], decoded_value.depthStencil.stencil, options);
+        writer.BeginObject();
+        FieldToJson(writer.Key("color"), meta_struct.color, options);
+        writer.Key("depthStencil").BeginObject();
+        FieldToJson(writer.Key("depth"), decoded_value.depthStencil.depth, options);
+        FieldToJson(writer.Key("stencil"), decoded_value.depthStencil.stencil, options);
+        writer.EndObject();
+        writer.EndObject();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkClearColorValue* data, const JsonOptions& options)
+void FieldToJson(JsonStreamWriter& writer, const Decoded_VkClearColorValue* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
         const auto& decoded_value = *data->decoded_value;
-        const auto& meta_struct   = *data;
-        FieldToJson(jdata["float32"], decoded_value.float32, 4, options);
-        FieldToJson(jdata["int32"], decoded_value.int32, 4, options);
-        FieldToJson(jdata["uint32"], decoded_value.uint32, 4, options);
+        writer.BeginObject();
+        FieldToJson(writer.Key("float32"), decoded_value.float32, 4, options);
+        FieldToJson(writer.Key("int32"), decoded_value.int32, 4, options);
+        FieldToJson(writer.Key("uint32"), decoded_value.uint32, 4, options);
+        writer.EndObject();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
+void FieldToJson(JsonStreamWriter&                            writer,
                  int                                          discriminant,
                  const Decoded_VkDeviceOrHostAddressConstKHR* data,
                  const JsonOptions&                           options)
@@ -112,23 +141,29 @@ void FieldToJson(nlohmann::ordered_json&                      jdata,
         switch (discriminant)
         {
             case 0:
-                FieldToJsonAsHex(jdata["deviceAddress"], decoded_value.deviceAddress, options);
-                break;
+                writer.BeginObject();
+                FieldToJsonAsHex(writer.Key("deviceAddress"), decoded_value.deviceAddress, options);
+                writer.EndObject();
+                return;
             case 1:
-                FieldToJsonAsHex(jdata["hostAddress"], decoded_value.hostAddress, options);
-                break;
+                writer.BeginObject();
+                FieldToJsonAsHex(writer.Key("hostAddress"), decoded_value.hostAddress, options);
+                writer.EndObject();
+                return;
         }
     }
+
+    writer.Null();
 }
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
+void FieldToJson(JsonStreamWriter&                            writer,
                  const Decoded_VkDeviceOrHostAddressConstKHR* data,
                  const JsonOptions&                           options)
 {
-    FieldToJson(jdata, 0, data, options);
+    FieldToJson(writer, 0, data, options);
 }
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(JsonStreamWriter&                       writer,
                  int                                     discriminant,
                  const Decoded_VkDeviceOrHostAddressKHR* data,
                  const JsonOptions&                      options)
@@ -139,23 +174,27 @@ void FieldToJson(nlohmann::ordered_json&                 jdata,
         switch (discriminant)
         {
             case 0:
-                FieldToJsonAsHex(jdata["deviceAddress"], decoded_value.deviceAddress, options);
-                break;
+                writer.BeginObject();
+                FieldToJsonAsHex(writer.Key("deviceAddress"), decoded_value.deviceAddress, options);
+                writer.EndObject();
+                return;
             case 1:
-                FieldToJsonAsHex(jdata["hostAddress"], decoded_value.hostAddress, options);
-                break;
+                writer.BeginObject();
+                FieldToJsonAsHex(writer.Key("hostAddress"), decoded_value.hostAddress, options);
+                writer.EndObject();
+                return;
         }
     }
+
+    writer.Null();
 }
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
-                 const Decoded_VkDeviceOrHostAddressKHR* data,
-                 const JsonOptions&                      options)
+void FieldToJson(JsonStreamWriter& writer, const Decoded_VkDeviceOrHostAddressKHR* data, const JsonOptions& options)
 {
-    FieldToJson(jdata, 0, data, options);
+    FieldToJson(writer, 0, data, options);
 }
 
-void FieldToJson(nlohmann::ordered_json&                              jdata,
+void FieldToJson(JsonStreamWriter&                                    writer,
                  VkPipelineExecutableStatisticFormatKHR               discriminant,
                  const Decoded_VkPipelineExecutableStatisticValueKHR* data,
                  const JsonOptions&                                   options)
@@ -166,24 +205,34 @@ void FieldToJson(nlohmann::ordered_json&                              jdata,
         switch (discriminant)
         {
             case VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_BOOL32_KHR:
-                jdata["b32"] = static_cast<bool>(decoded_value.b32);
-                break;
+                writer.BeginObject();
+                writer.Key("b32").Bool(static_cast<bool>(decoded_value.b32));
+                writer.EndObject();
+                return;
             case VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_INT64_KHR:
-                jdata["i64"] = decoded_value.i64;
-                break;
+                writer.BeginObject();
+                writer.Key("i64").Number(decoded_value.i64);
+                writer.EndObject();
+                return;
             case VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_UINT64_KHR:
-                jdata["u64"] = decoded_value.u64;
-                break;
+                writer.BeginObject();
+                writer.Key("u64").Number(decoded_value.u64);
+                writer.EndObject();
+                return;
             case VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_FLOAT64_KHR:
-                jdata["f64"] = decoded_value.f64;
-                break;
+                writer.BeginObject();
+                writer.Key("f64").Number(decoded_value.f64);
+                writer.EndObject();
+                return;
             case VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_MAX_ENUM_KHR:
                 GFXRECON_LOG_WARNING("Invalid format: VK_PIPELINE_EXECUTABLE_STATISTIC_FORMAT_MAX_ENUM_KHR");
         }
     }
+
+    writer.Null();
 }
 
-void FieldToJson(nlohmann::ordered_json&                         jdata,
+void FieldToJson(JsonStreamWriter&                               writer,
                  const Decoded_VkPipelineExecutableStatisticKHR* data,
                  const JsonOptions&                              options)
 {
@@ -191,39 +240,52 @@ void FieldToJson(nlohmann::ordered_json&                         jdata,
     {
         const auto& decoded_value = *data->decoded_value;
         const auto& meta_struct   = *data;
-        FieldToJson(jdata["sType"], decoded_value.sType, options);
-        FieldToJson(jdata["name"], &meta_struct.name, options);
-        FieldToJson(jdata["description"], &meta_struct.description, options);
-        FieldToJson(jdata["format"], decoded_value.format, options);
-        FieldToJson(jdata["value"], decoded_value.format, meta_struct.value, options);
-        FieldToJson(jdata["pNext"], meta_struct.pNext, options);
+        writer.BeginObject();
+        FieldToJson(writer.Key("sType"), decoded_value.sType, options);
+        FieldToJson(writer.Key("name"), &meta_struct.name, options);
+        FieldToJson(writer.Key("description"), &meta_struct.description, options);
+        FieldToJson(writer.Key("format"), decoded_value.format, options);
+        FieldToJson(writer.Key("value"), decoded_value.format, meta_struct.value, options);
+        FieldToJson(writer.Key("pNext"), meta_struct.pNext, options);
+        writer.EndObject();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkDescriptorImageInfo* data, const JsonOptions& options)
+void FieldToJson(JsonStreamWriter& writer, const Decoded_VkDescriptorImageInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
         const auto& decoded_value = *data->decoded_value;
         const auto& meta_struct   = *data;
-        HandleToJson(jdata["sampler"], meta_struct.sampler, options);
-        HandleToJson(jdata["imageView"], meta_struct.imageView, options);
-        HandleToJson(jdata["imageLayout"], decoded_value.imageLayout, options);
+        writer.BeginObject();
+        HandleToJson(writer.Key("sampler"), meta_struct.sampler, options);
+        HandleToJson(writer.Key("imageView"), meta_struct.imageView, options);
+        HandleToJson(writer.Key("imageLayout"), decoded_value.imageLayout, options);
+        writer.EndObject();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteDescriptorSet* data, const JsonOptions& options)
+void FieldToJson(JsonStreamWriter& writer, const Decoded_VkWriteDescriptorSet* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
         const auto& decoded_value = *data->decoded_value;
         const auto& meta_struct   = *data;
-        FieldToJson(jdata["sType"], decoded_value.sType, options);
-        HandleToJson(jdata["dstSet"], meta_struct.dstSet, options);
-        FieldToJson(jdata["dstBinding"], decoded_value.dstBinding, options);
-        FieldToJson(jdata["dstArrayElement"], decoded_value.dstArrayElement, options);
-        FieldToJson(jdata["descriptorCount"], decoded_value.descriptorCount, options);
-        FieldToJson(jdata["descriptorType"], decoded_value.descriptorType, options);
+        writer.BeginObject();
+        FieldToJson(writer.Key("sType"), decoded_value.sType, options);
+        HandleToJson(writer.Key("dstSet"), meta_struct.dstSet, options);
+        FieldToJson(writer.Key("dstBinding"), decoded_value.dstBinding, options);
+        FieldToJson(writer.Key("dstArrayElement"), decoded_value.dstArrayElement, options);
+        FieldToJson(writer.Key("descriptorCount"), decoded_value.descriptorCount, options);
+        FieldToJson(writer.Key("descriptorType"), decoded_value.descriptorType, options);
         switch (decoded_value.descriptorType)
         {
             case VK_DESCRIPTOR_TYPE_SAMPLER:
@@ -233,17 +295,17 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteDescriptorS
             case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
             case VK_DESCRIPTOR_TYPE_SAMPLE_WEIGHT_IMAGE_QCOM:
             case VK_DESCRIPTOR_TYPE_BLOCK_MATCH_IMAGE_QCOM:
-                FieldToJson(jdata["pImageInfo"], meta_struct.pImageInfo, options);
+                FieldToJson(writer.Key("pImageInfo"), meta_struct.pImageInfo, options);
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
             case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
             case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-                FieldToJson(jdata["pBufferInfo"], meta_struct.pBufferInfo, options);
+                FieldToJson(writer.Key("pBufferInfo"), meta_struct.pBufferInfo, options);
                 break;
             case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
             case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-                HandleToJson(jdata["pTexelBufferView"], &meta_struct.pTexelBufferView, options);
+                HandleToJson(writer.Key("pTexelBufferView"), &meta_struct.pTexelBufferView, options);
                 break;
             case VK_DESCRIPTOR_TYPE_ACCELERATION_STRUCTURE_KHR:
             case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK:
@@ -257,11 +319,16 @@ void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkWriteDescriptorS
             case VK_DESCRIPTOR_TYPE_MAX_ENUM:
                 GFXRECON_LOG_WARNING("Invalid descriptor type: VK_DESCRIPTOR_TYPE_MAX_ENUM");
         }
-        FieldToJson(jdata["pNext"], meta_struct.pNext, options);
+        FieldToJson(writer.Key("pNext"), meta_struct.pNext, options);
+        writer.EndObject();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                    jdata,
+void FieldToJson(JsonStreamWriter&                          writer,
                  const VkPerformanceValueTypeINTEL          discriminant,
                  const Decoded_VkPerformanceValueDataINTEL* data,
                  const JsonOptions&                         options)
@@ -273,122 +340,155 @@ void FieldToJson(nlohmann::ordered_json&                    jdata,
         switch (discriminant)
         {
             case VK_PERFORMANCE_VALUE_TYPE_UINT32_INTEL:
-                FieldToJson(jdata["value32"], decoded_value.value32, options);
-                break;
+                writer.BeginObject();
+                FieldToJson(writer.Key("value32"), decoded_value.value32, options);
+                writer.EndObject();
+                return;
             case VK_PERFORMANCE_VALUE_TYPE_UINT64_INTEL:
-                FieldToJson(jdata["value64"], decoded_value.value64, options);
-                break;
+                writer.BeginObject();
+                FieldToJson(writer.Key("value64"), decoded_value.value64, options);
+                writer.EndObject();
+                return;
             case VK_PERFORMANCE_VALUE_TYPE_FLOAT_INTEL:
-                FieldToJson(jdata["valueFloat"], decoded_value.valueFloat, options);
-                break;
+                writer.BeginObject();
+                FieldToJson(writer.Key("valueFloat"), decoded_value.valueFloat, options);
+                writer.EndObject();
+                return;
             case VK_PERFORMANCE_VALUE_TYPE_BOOL_INTEL:
-                FieldToJson(jdata["valueBool"], decoded_value.valueBool, options);
-                break;
+                writer.BeginObject();
+                FieldToJson(writer.Key("valueBool"), decoded_value.valueBool, options);
+                writer.EndObject();
+                return;
             case VK_PERFORMANCE_VALUE_TYPE_STRING_INTEL:
-                FieldToJson(jdata["valueString"], meta_struct.valueString, options);
-                break;
+                writer.BeginObject();
+                FieldToJson(writer.Key("valueString"), meta_struct.valueString, options);
+                writer.EndObject();
+                return;
             case VK_PERFORMANCE_VALUE_TYPE_MAX_ENUM_INTEL:
                 GFXRECON_LOG_WARNING("Invalid performance value type: VK_PERFORMANCE_VALUE_TYPE_MAX_ENUM_INTEL");
         }
     }
+
+    writer.Null();
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_VkPerformanceValueINTEL* data, const JsonOptions& options)
+void FieldToJson(JsonStreamWriter& writer, const Decoded_VkPerformanceValueINTEL* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
         const auto& decoded_value = *data->decoded_value;
         const auto& meta_struct   = *data;
-        FieldToJson(jdata["type"], decoded_value.type, options);
-        FieldToJson(jdata["data"], decoded_value.type, meta_struct.data, options);
+        writer.BeginObject();
+        FieldToJson(writer.Key("type"), decoded_value.type, options);
+        FieldToJson(writer.Key("data"), decoded_value.type, meta_struct.data, options);
+        writer.EndObject();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
-                 const Decoded_VkShaderModuleCreateInfo* data,
-                 const JsonOptions&                      options)
+void FieldToJson(JsonStreamWriter& writer, const Decoded_VkShaderModuleCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
         const auto& decoded_value = *data->decoded_value;
         const auto& meta_struct   = *data;
-        FieldToJson(jdata["sType"], decoded_value.sType, options);
-        FieldToJson(VkShaderModuleCreateFlags_t(), jdata["flags"], decoded_value.flags, options);
-        FieldToJson(jdata["codeSize"], decoded_value.codeSize, options);
-        // Use "[Binary data]" as placeholder. It will be replaced with a file path if the JSON
-        // consumer decides to dump binaries in separate files.
-        FieldToJson(jdata["pCode"], "[Binary data]", options);
-        FieldToJson(jdata["pNext"], meta_struct.pNext, options);
+        writer.BeginObject();
+        FieldToJson(writer.Key("sType"), decoded_value.sType, options);
+        FieldToJson(VkShaderModuleCreateFlags_t(), writer.Key("flags"), decoded_value.flags, options);
+        FieldToJson(writer.Key("codeSize"), decoded_value.codeSize, options);
+        // Use "[Binary data]" as placeholder. The JSON consumer writes vkCreateShaderModule's create info itself,
+        // with a file path in its place if it decides to dump binaries in separate files.
+        FieldToJson(writer.Key("pCode"), "[Binary data]", options);
+        FieldToJson(writer.Key("pNext"), meta_struct.pNext, options);
+        writer.EndObject();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_SECURITY_ATTRIBUTES* data, const JsonOptions& options)
+void FieldToJson(JsonStreamWriter& writer, const Decoded_SECURITY_ATTRIBUTES* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
         const auto& decoded_value = *data->decoded_value;
         const auto& meta_struct   = *data;
-        jdata["bInheritHandle"]   = static_cast<bool>(decoded_value.bInheritHandle);
-        FieldToJson(jdata["nLength"], decoded_value.nLength, options);
-        FieldToJson(jdata["lpSecurityDescriptor"], meta_struct.lpSecurityDescriptor->GetAddress(), options);
+        writer.BeginObject();
+        writer.Key("bInheritHandle").Bool(static_cast<bool>(decoded_value.bInheritHandle));
+        FieldToJson(writer.Key("nLength"), decoded_value.nLength, options);
+        FieldToJson(writer.Key("lpSecurityDescriptor"), meta_struct.lpSecurityDescriptor->GetAddress(), options);
+        writer.EndObject();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                  jdata,
-                 const Decoded_VkPipelineCacheCreateInfo* data,
-                 const JsonOptions&                       options)
+void FieldToJson(JsonStreamWriter& writer, const Decoded_VkPipelineCacheCreateInfo* data, const JsonOptions& options)
 {
     if (data && data->decoded_value)
     {
         const auto& decoded_value = *data->decoded_value;
         const auto& meta_struct   = *data;
-        FieldToJson(jdata["sType"], decoded_value.sType, options);
-        FieldToJson(VkPipelineCacheCreateFlags_t(), jdata["flags"], decoded_value.flags, options);
-        FieldToJson(jdata["initialDataSize"], decoded_value.initialDataSize, options);
-        // Use "[Binary data]" as placeholder. It will be replaced with a file path if the JSON
-        // consumer decides to dump binaries in separate files.
-        FieldToJson(jdata["pInitialData"], "[Binary data]", options);
-        FieldToJson(jdata["pNext"], meta_struct.pNext, options);
+        writer.BeginObject();
+        FieldToJson(writer.Key("sType"), decoded_value.sType, options);
+        FieldToJson(VkPipelineCacheCreateFlags_t(), writer.Key("flags"), decoded_value.flags, options);
+        FieldToJson(writer.Key("initialDataSize"), decoded_value.initialDataSize, options);
+        // Use "[Binary data]" as placeholder. The JSON consumer writes vkCreatePipelineCache's create info itself,
+        // with a file path in its place if it decides to dump binaries in separate files.
+        FieldToJson(writer.Key("pInitialData"), "[Binary data]", options);
+        FieldToJson(writer.Key("pNext"), meta_struct.pNext, options);
+        writer.EndObject();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
+void FieldToJson(JsonStreamWriter&                            writer,
                  const DescriptorUpdateTemplateDecoder* const pData,
                  const JsonOptions&                           options)
 {
     if (pData)
     {
-        const size_t                        image_info_count = pData->GetImageInfoCount();
-        std::vector<nlohmann::ordered_json> image_infos(image_info_count);
+        writer.BeginObject();
 
+        // The image and buffer infos are written as arrays even when they are empty.
+        const size_t image_info_count = pData->GetImageInfoCount();
+        writer.Key("imageInfos").BeginArray();
         for (size_t image_info_index = 0; image_info_index < image_info_count; ++image_info_index)
         {
-            FieldToJson(
-                image_infos[image_info_index], pData->GetImageInfoMetaStructPointer() + image_info_index, options);
+            FieldToJson(writer, pData->GetImageInfoMetaStructPointer() + image_info_index, options);
         }
-        jdata["imageInfos"] = image_infos;
-
-        const size_t                        buffer_info_count = pData->GetBufferInfoCount();
-        std::vector<nlohmann::ordered_json> buffer_infos(buffer_info_count);
+        writer.EndArray();
 
+        const size_t buffer_info_count = pData->GetBufferInfoCount();
+        writer.Key("bufferInfos").BeginArray();
         for (size_t buffer_info_index = 0; buffer_info_index < buffer_info_count; ++buffer_info_index)
         {
-            FieldToJson(
-                buffer_infos[buffer_info_index], pData->GetBufferInfoMetaStructPointer() + buffer_info_index, options);
+            FieldToJson(writer, pData->GetBufferInfoMetaStructPointer() + buffer_info_index, options);
         }
-        jdata["bufferInfos"] = buffer_infos;
+        writer.EndArray();
 
         const size_t texel_buffer_view_count = pData->GetTexelBufferViewCount();
         if (texel_buffer_view_count > 0)
         {
-            HandleToJson(
-                jdata["bufferViews"], pData->GetTexelBufferViewHandleIdsPointer(), texel_buffer_view_count, options);
+            HandleToJson(writer.Key("bufferViews"),
+                         pData->GetTexelBufferViewHandleIdsPointer(),
+                         texel_buffer_view_count,
+                         options);
         }
 
         const size_t acceleration_structure_count = pData->GetAccelerationStructureKHRCount();
         if (acceleration_structure_count > 0)
         {
-            HandleToJson(jdata["accelStructViews"],
+            HandleToJson(writer.Key("accelStructViews"),
                          pData->GetAccelerationStructureKHRHandleIdsPointer(),
                          acceleration_structure_count,
                          options);
@@ -397,25 +497,33 @@ void FieldToJson(nlohmann::ordered_json&                      jdata,
         const size_t inline_uniform_block_num_bytes = pData->GetInlineUniformBlockCount();
         if (inline_uniform_block_num_bytes > 0)
         {
-            jdata["inlineUniformBlock"] =
-                std::vector<uint8_t>(pData->GetInlineUniformBlockPointer(),
-                                     pData->GetInlineUniformBlockPointer() + inline_uniform_block_num_bytes);
+            const uint8_t* inline_uniform_block = pData->GetInlineUniformBlockPointer();
+            writer.Key("inlineUniformBlock").BeginArray();
+            for (size_t i = 0; i < inline_uniform_block_num_bytes; ++i)
+            {
+                writer.Number(inline_uniform_block[i]);
+            }
+            writer.EndArray();
         }
+
+        writer.EndObject();
     }
     else
     {
-        jdata = nullptr;
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json&                                     jdata,
+void FieldToJson(JsonStreamWriter&                                           writer,
                  const Decoded_VkPushDescriptorSetWithTemplateInfoKHR* const pData,
                  const util::JsonOptions&                                    options)
 {
-    HandleToJson(jdata["descriptorUpdateTemplate"], pData->descriptorUpdateTemplate, options);
-    HandleToJson(jdata["layout"], pData->layout, options);
-    FieldToJson(jdata["set"], pData->decoded_value->set, options);
-    FieldToJson(jdata["pData"], &pData->pData, options);
+    writer.BeginObject();
+    HandleToJson(writer.Key("descriptorUpdateTemplate"), pData->descriptorUpdateTemplate, options);
+    HandleToJson(writer.Key("layout"), pData->layout, options);
+    FieldToJson(writer.Key("set"), pData->decoded_value->set, options);
+    FieldToJson(writer.Key("pData"), &pData->pData, options);
+    writer.EndObject();
 }
 
 GFXRECON_END_NAMESPACE(decode)
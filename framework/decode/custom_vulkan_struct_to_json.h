@@ -32,7 +32,6 @@
 #include "util/json_util.h"
 #include "util/to_string.h"
 
-#include "nlohmann/json.hpp"
 #include "vulkan/vulkan.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -40,78 +39,78 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 class DescriptorUpdateTemplateDecoder;
 
-void FieldToJson(nlohmann::ordered_json&     jdata,
+void FieldToJson(util::JsonStreamWriter&     writer,
                  const Decoded_VkClearValue* data,
                  const util::JsonOptions&    options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&          jdata,
+void FieldToJson(util::JsonStreamWriter&          writer,
                  const Decoded_VkClearColorValue* data,
                  const util::JsonOptions&         options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
+void FieldToJson(util::JsonStreamWriter&                      writer,
                  int                                          discriminant,
                  const Decoded_VkDeviceOrHostAddressConstKHR* data,
                  const util::JsonOptions&                     options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
+void FieldToJson(util::JsonStreamWriter&                      writer,
                  const Decoded_VkDeviceOrHostAddressConstKHR* data,
                  const util::JsonOptions&                     options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonStreamWriter&                 writer,
                  int                                     discriminant,
                  const Decoded_VkDeviceOrHostAddressKHR* data,
                  const util::JsonOptions&                options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonStreamWriter&                 writer,
                  const Decoded_VkDeviceOrHostAddressKHR* data,
                  const util::JsonOptions&                options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                              jdata,
+void FieldToJson(util::JsonStreamWriter&                              writer,
                  VkPipelineExecutableStatisticFormatKHR               discriminant,
                  const Decoded_VkPipelineExecutableStatisticValueKHR* data,
                  const util::JsonOptions&                             options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                         jdata,
+void FieldToJson(util::JsonStreamWriter&                         writer,
                  const Decoded_VkPipelineExecutableStatisticKHR* data,
                  const util::JsonOptions&                        options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&            jdata,
+void FieldToJson(util::JsonStreamWriter&            writer,
                  const Decoded_SECURITY_ATTRIBUTES* data,
                  const util::JsonOptions&           options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                               jdata,
+void FieldToJson(util::JsonStreamWriter&                               writer,
                  const Decoded_VkAccelerationStructureGeometryDataKHR* data,
                  const util::JsonOptions&                              options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                           jdata,
+void FieldToJson(util::JsonStreamWriter&                           writer,
                  const Decoded_VkAccelerationStructureGeometryKHR* data,
                  const util::JsonOptions&                          options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&              jdata,
+void FieldToJson(util::JsonStreamWriter&              writer,
                  const Decoded_VkDescriptorImageInfo* data,
                  const util::JsonOptions&             options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&             jdata,
+void FieldToJson(util::JsonStreamWriter&             writer,
                  const Decoded_VkWriteDescriptorSet* data,
                  const util::JsonOptions&            options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                jdata,
+void FieldToJson(util::JsonStreamWriter&                writer,
                  const Decoded_VkPerformanceValueINTEL* data,
                  const util::JsonOptions&               options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonStreamWriter&                 writer,
                  const Decoded_VkShaderModuleCreateInfo* data,
                  const util::JsonOptions&                options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                  jdata,
+void FieldToJson(util::JsonStreamWriter&                  writer,
                  const Decoded_VkPipelineCacheCreateInfo* data,
                  const util::JsonOptions&                 options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                      jdata,
+void FieldToJson(util::JsonStreamWriter&                      writer,
                  const DescriptorUpdateTemplateDecoder* const pData,
                  const util::JsonOptions&                     options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&                                     jdata,
+void FieldToJson(util::JsonStreamWriter&                                     writer,
                  const Decoded_VkPushDescriptorSetWithTemplateInfoKHR* const pData,
                  const util::JsonOptions&                                    options = util::JsonOptions());
 
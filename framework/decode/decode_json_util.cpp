@@ -22,73 +22,105 @@
 
 #include "decode/decode_json_util.h"
 #include "util/defines.h"
-#include "nlohmann/json.hpp"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 using util::JsonOptions;
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StringDecoder& data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& writer, const StringDecoder& data, const JsonOptions& options)
 {
     const char* const decoded_data = data.GetPointer();
     if (decoded_data)
     {
-        FieldToJson(jdata, decoded_data, options);
+        FieldToJson(writer, decoded_data, options);
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StringDecoder* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& writer, const StringDecoder* data, const JsonOptions& options)
 {
     if (data)
     {
-        FieldToJson(jdata, *data, options);
+        FieldToJson(writer, *data, options);
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StringArrayDecoder* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& writer, const StringArrayDecoder& data, const JsonOptions& options)
 {
-    if (data && data->GetPointer())
+    FieldToJson(writer, &data, options);
+}
+
+void FieldToJson(util::JsonStreamWriter& writer, const StringArrayDecoder* data, const JsonOptions& options)
+{
+    if (data && data->GetPointer() && (data->GetLength() > 0))
     {
         const auto decoded_data = data->GetPointer();
+        writer.BeginArray();
         for (size_t i = 0; i < data->GetLength(); ++i)
         {
-            jdata[i] = std::string(decoded_data[i]);
+            writer.String(decoded_data[i]);
         }
+        writer.EndArray();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const WStringDecoder& data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& writer, const WStringDecoder& data, const JsonOptions& options)
 {
     const wchar_t* const decoded_data = data.GetPointer();
     if (decoded_data)
     {
-        FieldToJson(jdata, decoded_data, options);
+        FieldToJson(writer, decoded_data, options);
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const WStringDecoder* data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& writer, const WStringDecoder* data, const JsonOptions& options)
 {
     if (data)
     {
-        FieldToJson(jdata, *data, options);
+        FieldToJson(writer, *data, options);
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const WStringArrayDecoder& data, const JsonOptions& options)
+void FieldToJson(util::JsonStreamWriter& writer, const WStringArrayDecoder& data, const JsonOptions& options)
 {
     const auto decoded_data = data.GetPointer();
-    if (decoded_data)
+    if (decoded_data && (data.GetLength() > 0))
     {
+        writer.BeginArray();
         for (size_t i = 0; i < data.GetLength(); ++i)
         {
-            FieldToJson(jdata[i], decoded_data[i], options);
+            FieldToJson(writer, decoded_data[i], options);
         }
+        writer.EndArray();
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                   jdata,
+void FieldToJson(util::JsonStreamWriter&                   writer,
                  const PointerDecoder<uint32_t, uint32_t>& data,
                  const JsonOptions&                        options)
 {
@@ -98,20 +130,26 @@ void FieldToJson(nlohmann::ordered_json&                   jdata,
         const auto length        = data.GetLength();
         if (length > 1)
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                jdata[i] = decoded_value[i];
+                writer.Number(decoded_value[i]);
             }
+            writer.EndArray();
         }
         else
         {
-            jdata = *decoded_value;
+            writer.Number(*decoded_value);
         }
     }
+    else
+    {
+        writer.Null();
+    }
 }
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonStreamWriter&                 writer,
                  const PointerDecoder<int32_t, int32_t>& data,
                  const JsonOptions&                      options)
 {
@@ -121,20 +159,26 @@ void FieldToJson(nlohmann::ordered_json&                 jdata,
         const auto length        = data.GetLength();
         if (length > 1)
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                jdata[i] = decoded_value[i];
+                writer.Number(decoded_value[i]);
             }
+            writer.EndArray();
         }
         else
         {
-            jdata = *decoded_value;
+            writer.Number(*decoded_value);
         }
     }
+    else
+    {
+        writer.Null();
+    }
 }
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                   jdata,
+void FieldToJson(util::JsonStreamWriter&                   writer,
                  const PointerDecoder<uint64_t, uint64_t>& data,
                  const JsonOptions&                        options)
 {
@@ -144,20 +188,26 @@ void FieldToJson(nlohmann::ordered_json&                   jdata,
         const auto length        = data.GetLength();
         if (length > 1)
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                jdata[i] = decoded_value[i];
+                writer.Number(decoded_value[i]);
             }
+            writer.EndArray();
         }
         else
         {
-            jdata = *decoded_value;
+            writer.Number(*decoded_value);
         }
     }
+    else
+    {
+        writer.Null();
+    }
 }
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonStreamWriter&                 writer,
                  const PointerDecoder<int64_t, int64_t>& data,
                  const JsonOptions&                      options)
 {
@@ -167,19 +217,25 @@ void FieldToJson(nlohmann::ordered_json&                 jdata,
         const auto length        = data.GetLength();
         if (length > 1)
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                jdata[i] = decoded_value[i];
+                writer.Number(decoded_value[i]);
             }
+            writer.EndArray();
         }
         else
         {
-            jdata = *decoded_value;
+            writer.Number(*decoded_value);
         }
     }
+    else
+    {
+        writer.Null();
+    }
 }
 
-void Bool32ToJson(nlohmann::ordered_json&                   jdata,
+void Bool32ToJson(util::JsonStreamWriter&                   writer,
                   const PointerDecoder<uint32_t, uint32_t>* data,
                   const util::JsonOptions&                  options)
 {
@@ -188,39 +244,51 @@ void Bool32ToJson(nlohmann::ordered_json&                   jdata,
         const auto decoded_value = data->GetPointer();
         const auto length        = data->GetLength();
 
-        if (data->IsArray())
+        if (data->IsArray() && (length > 0))
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                util::Bool32ToJson(jdata[i], decoded_value[i], options);
+                util::Bool32ToJson(writer, decoded_value[i], options);
             }
+            writer.EndArray();
+            return;
         }
-        else if (length == 1)
+        else if (!data->IsArray() && (length == 1))
         {
-            util::Bool32ToJson(jdata, *decoded_value, options);
+            util::Bool32ToJson(writer, *decoded_value, options);
+            return;
         }
     }
+
+    writer.Null();
 }
 
-void Bool32ToJson(nlohmann::ordered_json& jdata, const PointerDecoder<int, int>* data, const util::JsonOptions& options)
+void Bool32ToJson(util::JsonStreamWriter& writer, const PointerDecoder<int, int>* data, const util::JsonOptions& options)
 {
     if (data && data->GetPointer())
     {
         const auto decoded_value = data->GetPointer();
         const auto length        = data->GetLength();
 
-        if (data->IsArray())
+        if (data->IsArray() && (length > 0))
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                util::Bool32ToJson(jdata[i], decoded_value[i], options);
+                util::Bool32ToJson(writer, decoded_value[i], options);
             }
+            writer.EndArray();
+            return;
         }
-        else if (length == 1)
+        else if (!data->IsArray() && (length == 1))
         {
-            util::Bool32ToJson(jdata, *decoded_value, options);
+            util::Bool32ToJson(writer, *decoded_value, options);
+            return;
         }
     }
+
+    writer.Null();
 }
 
 GFXRECON_END_NAMESPACE(decode)
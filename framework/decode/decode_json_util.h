@@ -34,41 +34,41 @@
 #include "util/json_util.h"
 #include "util/defines.h"
 
-#include "nlohmann/json.hpp"
-
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-void FieldToJson(nlohmann::ordered_json&  jdata,
+// Each of these writes exactly one JSON value for the caller's Key(), writing null where there is no data to convert.
+
+void FieldToJson(util::JsonStreamWriter&  writer,
                  const StringDecoder&     data,
                  const util::JsonOptions& options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&  jdata,
+void FieldToJson(util::JsonStreamWriter&  writer,
                  const StringDecoder*     data,
                  const util::JsonOptions& options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&   jdata,
+void FieldToJson(util::JsonStreamWriter&   writer,
                  const StringArrayDecoder& data,
                  const util::JsonOptions&  options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&   jdata,
+void FieldToJson(util::JsonStreamWriter&   writer,
                  const StringArrayDecoder* data,
                  const util::JsonOptions&  options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&  jdata,
+void FieldToJson(util::JsonStreamWriter&  writer,
                  const WStringDecoder&    data,
                  const util::JsonOptions& options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&  jdata,
+void FieldToJson(util::JsonStreamWriter&  writer,
                  const WStringDecoder*    data,
                  const util::JsonOptions& options = util::JsonOptions());
 
-void FieldToJson(nlohmann::ordered_json&    jdata,
+void FieldToJson(util::JsonStreamWriter&    writer,
                  const WStringArrayDecoder& data,
                  const util::JsonOptions&   options = util::JsonOptions());
 
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJson(nlohmann::ordered_json&                               jdata,
+void FieldToJson(util::JsonStreamWriter&                               writer,
                  const PointerDecoder<DecodedType, OutputDecodedType>* data,
                  const util::JsonOptions&                              options = util::JsonOptions())
 {
@@ -77,51 +77,57 @@ void FieldToJson(nlohmann::ordered_json&                               jdata,
         const auto decoded_value = data->GetPointer();
         const auto length        = data->GetLength();
 
-        if (data->IsArray())
+        if (data->IsArray() && (length > 0))
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                FieldToJson(jdata[i], decoded_value[i], options);
+                FieldToJson(writer, decoded_value[i], options);
             }
+            writer.EndArray();
+            return;
         }
-        else if (length == 1)
+        else if (!data->IsArray() && (length == 1))
         {
-            FieldToJson(jdata, *decoded_value, options);
+            FieldToJson(writer, *decoded_value, options);
+            return;
         }
     }
+
+    writer.Null();
 }
 
 // Reference to pointer version wraps pointer to pointer version above.
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJson(nlohmann::ordered_json&                               jdata,
+void FieldToJson(util::JsonStreamWriter&                               writer,
                  const PointerDecoder<DecodedType, OutputDecodedType>& data,
                  const util::JsonOptions&                              options = util::JsonOptions())
 {
-    FieldToJson(jdata, &data, options);
+    FieldToJson(writer, &data, options);
 }
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                   jdata,
+void FieldToJson(util::JsonStreamWriter&                   writer,
                  const PointerDecoder<uint32_t, uint32_t>& data,
                  const util::JsonOptions&                  options);
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonStreamWriter&                 writer,
                  const PointerDecoder<int32_t, int32_t>& data,
                  const util::JsonOptions&                options);
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                   jdata,
+void FieldToJson(util::JsonStreamWriter&                   writer,
                  const PointerDecoder<uint64_t, uint64_t>& data,
                  const util::JsonOptions&                  options);
 
 template <>
-void FieldToJson(nlohmann::ordered_json&                 jdata,
+void FieldToJson(util::JsonStreamWriter&                 writer,
                  const PointerDecoder<int64_t, int64_t>& data,
                  const util::JsonOptions&                options);
 
 template <typename DecodedType>
-void FieldToJson(nlohmann::ordered_json&                  jdata,
+void FieldToJson(util::JsonStreamWriter&                  writer,
                  const StructPointerDecoder<DecodedType>* data,
                  const util::JsonOptions&                 options = util::JsonOptions())
 {
@@ -129,23 +135,29 @@ void FieldToJson(nlohmann::ordered_json&                  jdata,
     {
         const auto meta_struct = data->GetMetaStructPointer();
         const auto length      = data->GetLength();
-        if (data->IsArray())
+        if (data->IsArray() && (length > 0))
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                FieldToJson(jdata[i], &meta_struct[i], options);
+                FieldToJson(writer, &meta_struct[i], options);
             }
+            writer.EndArray();
+            return;
         }
-        else if (length == 1)
+        else if (!data->IsArray() && (length == 1))
         {
-            FieldToJson(jdata, meta_struct, options);
+            FieldToJson(writer, meta_struct, options);
+            return;
         }
     }
+
+    writer.Null();
 }
 
 // Similar to above but DecodedType is pointed-to
 template <typename DecodedType>
-void FieldToJson(nlohmann::ordered_json&                   jdata,
+void FieldToJson(util::JsonStreamWriter&                   writer,
                  const StructPointerDecoder<DecodedType*>* data,
                  const util::JsonOptions&                  options = util::JsonOptions())
 {
@@ -153,34 +165,45 @@ void FieldToJson(nlohmann::ordered_json&                   jdata,
     {
         const auto meta_struct = data->GetMetaStructPointer();
         const auto length      = data->GetLength();
-        if (data->IsArray())
+        if (data->IsArray() && (length > 0))
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                FieldToJson(jdata[i], meta_struct[i], options);
+                FieldToJson(writer, meta_struct[i], options);
             }
+            writer.EndArray();
+            return;
         }
-        else if (data->IsArray2D())
+        else if (!data->IsArray() && data->IsArray2D() && (length > 0))
         {
+            // The inner arrays are written even when they are empty.
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                size_t inner_length = data->GetInnerLength(i);
-                auto&  jdata_arr    = jdata.emplace_back(nlohmann::ordered_json::array_t(inner_length));
+                const size_t inner_length = data->GetInnerLength(i);
+                writer.BeginArray();
                 for (size_t j = 0; j < inner_length; ++j)
                 {
-                    FieldToJson(jdata_arr[j], &meta_struct[i][j], options);
+                    FieldToJson(writer, &meta_struct[i][j], options);
                 }
+                writer.EndArray();
             }
+            writer.EndArray();
+            return;
         }
-        else if (length == 1)
+        else if (!data->IsArray() && !data->IsArray2D() && (length == 1))
         {
-            FieldToJson(jdata, *meta_struct, options);
+            FieldToJson(writer, *meta_struct, options);
+            return;
         }
     }
+
+    writer.Null();
 }
 
 template <typename THandle>
-void HandleToJson(nlohmann::ordered_json&              jdata,
+void HandleToJson(util::JsonStreamWriter&              writer,
                   const HandlePointerDecoder<THandle>* data,
                   const util::JsonOptions&             options = util::JsonOptions())
 {
@@ -189,34 +212,40 @@ void HandleToJson(nlohmann::ordered_json&              jdata,
         const auto decoded_value = data->GetPointer();
         const auto length        = data->GetLength();
 
-        if (data->IsArray())
+        if (data->IsArray() && (length > 0))
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                HandleToJson(jdata[i], decoded_value[i], options);
+                HandleToJson(writer, decoded_value[i], options);
             }
+            writer.EndArray();
+            return;
         }
-        else if (length == 1)
+        else if (!data->IsArray() && (length == 1))
         {
-            HandleToJson(jdata, *decoded_value, options);
+            HandleToJson(writer, *decoded_value, options);
+            return;
         }
     }
+
+    writer.Null();
 }
 
 /// @brief Thunk to HandleToJson to allow the standard FieldToJson name to be
 /// used for pointers and arrays where the type of the HandlePointerDecoder
 /// allows the correct version to be resolved.
 template <typename THandle>
-void FieldToJson(nlohmann::ordered_json&              jdata,
+void FieldToJson(util::JsonStreamWriter&              writer,
                  const HandlePointerDecoder<THandle>* data,
                  const util::JsonOptions&             options = util::JsonOptions())
 {
-    HandleToJson(jdata, data, options);
+    HandleToJson(writer, data, options);
 }
 
 // Same as array FieldToJson above but converts elements pointed-to to hexadecimal
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJsonAsHex(nlohmann::ordered_json&                               jdata,
+void FieldToJsonAsHex(util::JsonStreamWriter&                               writer,
                       const PointerDecoder<DecodedType, OutputDecodedType>* data,
                       const util::JsonOptions&                              options = util::JsonOptions())
 {
@@ -225,32 +254,38 @@ void FieldToJsonAsHex(nlohmann::ordered_json&                               jdat
         const auto decoded_value = data->GetPointer();
         const auto length        = data->GetLength();
 
-        if (data->IsArray())
+        if (data->IsArray() && (length > 0))
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                FieldToJsonAsHex(jdata[i], decoded_value[i], options);
+                FieldToJsonAsHex(writer, decoded_value[i], options);
             }
+            writer.EndArray();
+            return;
         }
-        else if (length == 1)
+        else if (!data->IsArray() && (length == 1))
         {
-            FieldToJsonAsHex(jdata, *decoded_value, options);
+            FieldToJsonAsHex(writer, *decoded_value, options);
+            return;
         }
     }
+
+    writer.Null();
 }
 
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJsonAsHex(nlohmann::ordered_json&                               jdata,
+void FieldToJsonAsHex(util::JsonStreamWriter&                               writer,
                       const PointerDecoder<DecodedType, OutputDecodedType>& data,
                       const util::JsonOptions&                              options = util::JsonOptions())
 {
-    FieldToJsonAsHex(jdata, &data, options);
+    FieldToJsonAsHex(writer, &data, options);
 }
 
 /// Same as array FieldToJson above but converts elements pointed-to to binary
 /// as a JSON string rather than as a JSON number type. Useful for bitmasks.
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&                               jdata,
+void FieldToJsonAsFixedWidthBinary(util::JsonStreamWriter&                               writer,
                                    const PointerDecoder<DecodedType, OutputDecodedType>& data,
                                    const util::JsonOptions&                              options = util::JsonOptions())
 {
@@ -259,66 +294,80 @@ void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&
         const auto decoded_value = data.GetPointer();
         const auto length        = data.GetLength();
 
-        if (data.IsArray())
+        if (data.IsArray() && (length > 0))
         {
+            writer.BeginArray();
             for (size_t i = 0; i < length; ++i)
             {
-                FieldToJsonAsFixedWidthBinary(jdata[i], decoded_value[i], options);
+                FieldToJsonAsFixedWidthBinary(writer, decoded_value[i], options);
             }
+            writer.EndArray();
+            return;
         }
-        else if (length == 1)
+        else if (!data.IsArray() && (length == 1))
         {
-            FieldToJsonAsFixedWidthBinary(jdata, *decoded_value, options);
+            FieldToJsonAsFixedWidthBinary(writer, *decoded_value, options);
+            return;
         }
     }
+
+    writer.Null();
 }
 
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&                               jdata,
+void FieldToJsonAsFixedWidthBinary(util::JsonStreamWriter&                               writer,
                                    const PointerDecoder<DecodedType, OutputDecodedType>* data,
                                    const util::JsonOptions&                              options = util::JsonOptions())
 {
     if (data)
     {
-        FieldToJsonAsFixedWidthBinary(jdata, *data, options);
+        FieldToJsonAsFixedWidthBinary(writer, *data, options);
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
 /// @brief Thunk to FieldToJsonAsFixedWidthBinary because consumers deliver pointers to non-const PointerDecoders
 /// and they fail to resolve to the const version above.
 template <typename DecodedType, typename OutputDecodedType = DecodedType>
-void FieldToJsonAsFixedWidthBinary(nlohmann::ordered_json&                         jdata,
+void FieldToJsonAsFixedWidthBinary(util::JsonStreamWriter&                         writer,
                                    PointerDecoder<DecodedType, OutputDecodedType>* data,
                                    const util::JsonOptions&                        options = util::JsonOptions())
 {
     if (data)
     {
-        FieldToJsonAsFixedWidthBinary(jdata, *data, options);
+        FieldToJsonAsFixedWidthBinary(writer, *data, options);
+    }
+    else
+    {
+        writer.Null();
     }
 }
 
 // Used by (e.g.) VkMapMemory's ppData
 inline void
-FieldToJsonAsHex(nlohmann::ordered_json& jdata, PointerDecoder<uint64_t, void*>* data, const util::JsonOptions& options)
+FieldToJsonAsHex(util::JsonStreamWriter& writer, PointerDecoder<uint64_t, void*>* data, const util::JsonOptions& options)
 {
-    FieldToJsonAsHex<uint64_t, void*>(jdata, data, options);
+    FieldToJsonAsHex<uint64_t, void*>(writer, data, options);
 }
 
 inline void
-FieldToJsonAsHex(nlohmann::ordered_json& jdata, PointerDecoder<int64_t, void*>* data, const util::JsonOptions& options)
+FieldToJsonAsHex(util::JsonStreamWriter& writer, PointerDecoder<int64_t, void*>* data, const util::JsonOptions& options)
 {
-    FieldToJsonAsHex<int64_t, void*>(jdata, data, options);
+    FieldToJsonAsHex<int64_t, void*>(writer, data, options);
 }
 
 /// Convert arrays of and pointers to bools. Since VkBool32 is just a typedef of
 /// uint32_t we can't use the standard function name and dispatch on the type.
-void Bool32ToJson(nlohmann::ordered_json&                   jdata,
+void Bool32ToJson(util::JsonStreamWriter&                   writer,
                   const PointerDecoder<uint32_t, uint32_t>* data,
                   const util::JsonOptions&                  options = util::JsonOptions());
 
 /// Convert arrays of and pointers to bools. Since the Windows BOOL is just a
 /// typedef of int we can't use the standard function name and dispatch on the type.
-void Bool32ToJson(nlohmann::ordered_json&         jdata,
+void Bool32ToJson(util::JsonStreamWriter&         writer,
                   const PointerDecoder<int, int>* data,
                   const util::JsonOptions&        options = util::JsonOptions());
 
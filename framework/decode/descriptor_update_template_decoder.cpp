@@ -47,6 +47,11 @@ DescriptorUpdateTemplateDecoder::~DescriptorUpdateTemplateDecoder() {}
 
 size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buffer_size)
 {
+    // The template data is always written with ParameterEncoding::kFixedSize, because the sizes of its entries are
+    // computed before they are decoded.
+    format::ParameterEncoding parameter_encoding = ValueDecoder::GetParameterEncoding();
+    ValueDecoder::SetParameterEncoding(format::ParameterEncoding::kFixedSize);
+
     size_t bytes_read = DecodeAttributes(buffer, buffer_size);
 
     // The update template should identify as a struct pointer.
@@ -265,6 +270,8 @@ size_t DescriptorUpdateTemplateDecoder::Decode(const uint8_t* buffer, size_t buf
         }
     }
     assert(bytes_read <= buffer_size);
+    ValueDecoder::SetParameterEncoding(parameter_encoding);
+
     return bytes_read;
 }
 
@@ -59,9 +59,10 @@ bool Dx12JsonConsumerBase::IsValid() const
 void Dx12JsonConsumerBase::ProcessCreateHeapAllocationCommand(uint64_t allocation_id, uint64_t allocation_size)
 {
     const util::JsonOptions& json_options = writer_->GetOptions();
-    auto&                    jdata        = writer_->WriteMetaCommandStart("CreateHeapAllocationCommand");
-    FieldToJson(jdata["allocation_id"], allocation_id, json_options);
-    FieldToJson(jdata["allocation_size"], allocation_size, json_options);
+    auto&                    writer       = writer_->WriteMetaCommandStart("CreateHeapAllocationCommand");
+    writer.BeginObject();
+    FieldToJson(writer.Key("allocation_id"), allocation_id, json_options);
+    FieldToJson(writer.Key("allocation_size"), allocation_size, json_options);
     writer_->WriteBlockEnd();
 }
 
@@ -69,18 +70,19 @@ void Dx12JsonConsumerBase::ProcessInitSubresourceCommand(const format::InitSubre
                                                          const uint8_t*                              data)
 {
     const util::JsonOptions& json_options = writer_->GetOptions();
-    auto&                    jdata        = writer_->WriteMetaCommandStart("InitSubresourceCommand");
+    auto&                    writer       = writer_->WriteMetaCommandStart("InitSubresourceCommand");
+    writer.BeginObject();
 
-    FieldToJson(jdata["thread_id"], command_header.thread_id, json_options);
-    FieldToJson(jdata["device_id"], command_header.device_id, json_options);
-    FieldToJson(jdata["resource_id"], command_header.resource_id, json_options);
-    FieldToJson(jdata["subresource"], command_header.subresource, json_options);
-    FieldToJson(jdata["initial_state"], command_header.initial_state, json_options);
-    FieldToJson(jdata["resource_state"], command_header.resource_state, json_options);
-    FieldToJson(jdata["barrier_flags"], command_header.barrier_flags, json_options);
-    FieldToJson(jdata["data_size"], command_header.data_size, json_options);
+    FieldToJson(writer.Key("thread_id"), command_header.thread_id, json_options);
+    FieldToJson(writer.Key("device_id"), command_header.device_id, json_options);
+    FieldToJson(writer.Key("resource_id"), command_header.resource_id, json_options);
+    FieldToJson(writer.Key("subresource"), command_header.subresource, json_options);
+    FieldToJson(writer.Key("initial_state"), command_header.initial_state, json_options);
+    FieldToJson(writer.Key("resource_state"), command_header.resource_state, json_options);
+    FieldToJson(writer.Key("barrier_flags"), command_header.barrier_flags, json_options);
+    FieldToJson(writer.Key("data_size"), command_header.data_size, json_options);
     RepresentBinaryFile(
-        *(this->writer_), jdata[format::kNameData], "initsubresourcecommand.bin", command_header.data_size, data);
+        *(this->writer_), writer.Key(format::kNameData), "initsubresourcecommand.bin", command_header.data_size, data);
 
     writer_->WriteBlockEnd();
 }
@@ -94,34 +96,36 @@ void Dx12JsonConsumerBase::ProcessInitDx12AccelerationStructureCommand(
     const uint8_t*                                                  build_inputs_data)
 {
     const util::JsonOptions& json_options = writer_->GetOptions();
-    auto&                    jdata        = writer_->WriteMetaCommandStart("InitDx12AccelerationStructureCommand");
-    FieldToJson(jdata["thread_id"], command_header.thread_id, json_options);
+    auto&                    writer       = writer_->WriteMetaCommandStart("InitDx12AccelerationStructureCommand");
+    writer.BeginObject();
+    FieldToJson(writer.Key("thread_id"), command_header.thread_id, json_options);
     // The GPU address D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_DESC.DestAccelerationStructureData
     // is mapped from this during replay but we'll just dump the raw capture file value:
-    FieldToJsonAsHex(
-        jdata["dest_acceleration_structure_data"], command_header.dest_acceleration_structure_data, json_options);
+    FieldToJsonAsHex(writer.Key("dest_acceleration_structure_data"),
+                     command_header.dest_acceleration_structure_data,
+                     json_options);
     // A GPU virtual address to copy from after pumping througnh a graphics::Dx12GpuVaMap during replay, but we'll just
     // dump the raw capture file value:
-    FieldToJsonAsHex(jdata["copy_source_gpu_va"], command_header.copy_source_gpu_va, json_options);
-    FieldToJson(jdata["copy_mode"],
+    FieldToJsonAsHex(writer.Key("copy_source_gpu_va"), command_header.copy_source_gpu_va, json_options);
+    FieldToJson(writer.Key("copy_mode"),
                 static_cast<D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE>(command_header.copy_mode),
                 json_options);
-    FieldToJson(jdata["inputs_type"],
+    FieldToJson(writer.Key("inputs_type"),
                 static_cast<D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE>(command_header.inputs_type),
                 json_options);
     FieldToJson_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS(
-        jdata["inputs_flags"],
+        writer.Key("inputs_flags"),
         static_cast<D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS>(command_header.inputs_flags),
         json_options);
-    FieldToJson(jdata["inputs_num_instance_descs"], command_header.inputs_num_instance_descs, json_options);
-    FieldToJson(jdata["inputs_num_geometry_descs"], command_header.inputs_num_geometry_descs, json_options);
-    FieldToJson(jdata["inputs_data_size"], command_header.inputs_data_size, json_options);
+    FieldToJson(writer.Key("inputs_num_instance_descs"), command_header.inputs_num_instance_descs, json_options);
+    FieldToJson(writer.Key("inputs_num_geometry_descs"), command_header.inputs_num_geometry_descs, json_options);
+    FieldToJson(writer.Key("inputs_data_size"), command_header.inputs_data_size, json_options);
     RepresentBinaryFile(*(this->writer_),
-                        jdata[format::kNameData],
+                        writer.Key(format::kNameData),
                         "initdx12accelerationstructurecommand.bin",
                         command_header.inputs_data_size,
                         build_inputs_data);
-    FieldToJson(jdata["geometry_descs"], geometry_descs.data(), geometry_descs.size(), json_options);
+    FieldToJson(writer.Key("geometry_descs"), geometry_descs.data(), geometry_descs.size(), json_options);
     writer_->WriteBlockEnd();
 }
 
@@ -129,15 +133,16 @@ void Dx12JsonConsumerBase::ProcessFillMemoryResourceValueCommand(
     const format::FillMemoryResourceValueCommandHeader& command_header, const uint8_t* data)
 {
     const util::JsonOptions& json_options = writer_->GetOptions();
-    auto&                    jdata        = writer_->WriteMetaCommandStart("FillMemoryResourceValueCommand");
-    FieldToJson(jdata["thread_id"], command_header.thread_id, json_options);
-    FieldToJson(jdata["resource_value_count"], command_header.resource_value_count, json_options);
+    auto&                    writer       = writer_->WriteMetaCommandStart("FillMemoryResourceValueCommand");
+    writer.BeginObject();
+    FieldToJson(writer.Key("thread_id"), command_header.thread_id, json_options);
+    FieldToJson(writer.Key("resource_value_count"), command_header.resource_value_count, json_options);
     // There are two blocks of values in data so we need to add together their sizes to know how big the blob to dump
     // is:
     const auto types_bytes   = command_header.resource_value_count * sizeof(format::ResourceValueType);
     const auto offsets_bytes = command_header.resource_value_count * sizeof(uint64_t);
     RepresentBinaryFile(*(this->writer_),
-                        jdata[format::kNameData],
+                        writer.Key(format::kNameData),
                         "fillmemoryresourcevaluecommand.bin",
                         types_bytes + offsets_bytes,
                         data);
@@ -148,9 +153,10 @@ void Dx12JsonConsumerBase::ProcessFillMemoryResourceValueCommand(
 void Dx12JsonConsumerBase::ProcessDxgiAdapterInfo(const format::DxgiAdapterInfoCommandHeader& adapter_info_header)
 {
     const util::JsonOptions& json_options = writer_->GetOptions();
-    auto&                    jdata        = writer_->WriteMetaCommandStart("DxgiAdapterInfo");
-    FieldToJson(jdata["thread_id"], adapter_info_header.thread_id, json_options);
-    FieldToJson(jdata["adapter_desc"], adapter_info_header.adapter_desc, json_options);
+    auto&                    writer       = writer_->WriteMetaCommandStart("DxgiAdapterInfo");
+    writer.BeginObject();
+    FieldToJson(writer.Key("thread_id"), adapter_info_header.thread_id, json_options);
+    FieldToJson(writer.Key("adapter_desc"), adapter_info_header.adapter_desc, json_options);
     writer_->WriteBlockEnd();
 }
 
@@ -158,11 +164,12 @@ void Dx12JsonConsumerBase::ProcessDxgiAdapterInfo(const format::DxgiAdapterInfoC
 void Dx12JsonConsumerBase::Process_DriverInfo(const char* info_record)
 {
     const util::JsonOptions& json_options = writer_->GetOptions();
-    auto&                    jdata        = writer_->WriteMetaCommandStart("DriverInfo");
+    auto&                    writer       = writer_->WriteMetaCommandStart("DriverInfo");
     char                     driver_record[gfxrecon::util::filepath::kMaxDriverInfoSize + 1];
 
-    FieldToJson(jdata[format::kNameDebug], "thread_id field not exposed.", json_options);
-    FieldToJson(jdata["driver_record"],
+    writer.BeginObject();
+    FieldToJson(writer.Key(format::kNameDebug), "thread_id field not exposed.", json_options);
+    FieldToJson(writer.Key("driver_record"),
                 util::strings::ViewOfCharArray(info_record, util::filepath::kMaxDriverInfoSize),
                 json_options);
     writer_->WriteBlockEnd();
@@ -171,10 +178,11 @@ void Dx12JsonConsumerBase::Process_DriverInfo(const char* info_record)
 void Dx12JsonConsumerBase::ProcessDx12RuntimeInfo(const format::Dx12RuntimeInfoCommandHeader& runtime_info_header)
 {
     const util::JsonOptions& json_options = writer_->GetOptions();
-    auto&                    jdata        = writer_->WriteMetaCommandStart("Dx12RuntimeInfoCommandHeader");
+    auto&                    writer       = writer_->WriteMetaCommandStart("Dx12RuntimeInfoCommandHeader");
+    writer.BeginObject();
 
-    FieldToJson(jdata["thread_id"], runtime_info_header.thread_id, json_options);
-    FieldToJson(jdata["runtime_info"], runtime_info_header.runtime_info, json_options);
+    FieldToJson(writer.Key("thread_id"), runtime_info_header.thread_id, json_options);
+    FieldToJson(writer.Key("runtime_info"), runtime_info_header.runtime_info, json_options);
 
     writer_->WriteBlockEnd();
 }
@@ -191,20 +199,21 @@ void Dx12JsonConsumerBase::Process_ID3D12Device_CheckFeatureSupport(format::Hand
     call_info.index     = GetCurrentBlockIndex();
     call_info.thread_id = format::kNameUnknownThreadId;
 
-    nlohmann::ordered_json& method =
-        writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CheckFeatureSupport");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CheckFeatureSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], original_result, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), original_result, options);
+    writer.Key(format::kNameArgs);
+    writer.BeginObject();
     {
-        FieldToJson(args["Feature"], feature, options);
-        FieldToJson(args["pFeatureSupportData"], nullptr, options);
-        FieldToJson(args["FeatureSupportDataSize"], feature_data_size, options);
+        FieldToJson(writer.Key("Feature"), feature, options);
+        FieldToJson(writer.Key("pFeatureSupportData"), nullptr, options);
+        FieldToJson(writer.Key("FeatureSupportDataSize"), feature_data_size, options);
         /// @todo Complete conversion of the void * contents of Process_ID3D12Device_CheckFeatureSupport. See
         /// <https://learn.microsoft.com/en-us/windows/win32/api/d3d12/nf-d3d12-id3d12device-checkfeaturesupport>
         FieldToJson(
-            args[format::kNameWarning], "Incomplete conversion: pFeatureSupportData not supported yet.", options);
+            writer.Key(format::kNameWarning), "Incomplete conversion: pFeatureSupportData not supported yet.", options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -220,20 +229,21 @@ void Dx12JsonConsumerBase::Process_IDXGIFactory5_CheckFeatureSupport(format::Han
     call_info.index     = GetCurrentBlockIndex();
     call_info.thread_id = format::kNameUnknownThreadId;
 
-    nlohmann::ordered_json& method =
-        writer_->WriteApiCallStart(call_info, "IDXGIFactory5", object_id, "CheckFeatureSupport");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory5", object_id, "CheckFeatureSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], original_result, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), original_result, options);
+    writer.Key(format::kNameArgs);
+    writer.BeginObject();
     {
-        FieldToJson(args["Feature"], feature, options);
-        FieldToJson(args["pFeatureSupportData"], nullptr, options);
-        FieldToJson(args["FeatureSupportDataSize"], feature_data_size, options);
+        FieldToJson(writer.Key("Feature"), feature, options);
+        FieldToJson(writer.Key("pFeatureSupportData"), nullptr, options);
+        FieldToJson(writer.Key("FeatureSupportDataSize"), feature_data_size, options);
         /// @todo Complete conversion of the void * contents of Process_IDXGIFactory5_CheckFeatureSupport. See
         /// <https://learn.microsoft.com/en-us/windows/win32/api/dxgi1_5/nf-dxgi1_5-idxgifactory5-checkfeaturesupport>
         FieldToJson(
-            args[format::kNameWarning], "Incomplete conversion: pFeatureSupportData not supported yet.", options);
+            writer.Key(format::kNameWarning), "Incomplete conversion: pFeatureSupportData not supported yet.", options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -250,20 +260,21 @@ void Dx12JsonConsumerBase::Process_ID3D12Resource_WriteToSubresource(format::Han
     call_info.index     = GetCurrentBlockIndex();
     call_info.thread_id = format::kNameUnknownThreadId;
 
-    nlohmann::ordered_json& method =
-        writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "WriteToSubresource");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "WriteToSubresource");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs);
+    writer.BeginObject();
     {
-        FieldToJson(args["DstSubresource"], DstSubresource, options);
-        FieldToJson(args["pDstBox"], pDstBox, options);
+        FieldToJson(writer.Key("DstSubresource"), DstSubresource, options);
+        FieldToJson(writer.Key("pDstBox"), pDstBox, options);
         /// @todo Complete conversion of the void * member pSrcData of Process_ID3D12Resource_WriteToSubresource.
-        FieldToJson(args[format::kNameWarning], "Incomplete conversion: pSrcData not supported yet.", options);
-        FieldToJson(args["pSrcData"], nullptr, options);
-        FieldToJson(args["SrcRowPitch"], SrcRowPitch, options);
-        FieldToJson(args["SrcDepthPitch"], SrcDepthPitch, options);
+        FieldToJson(writer.Key(format::kNameWarning), "Incomplete conversion: pSrcData not supported yet.", options);
+        FieldToJson(writer.Key("pSrcData"), nullptr, options);
+        FieldToJson(writer.Key("SrcRowPitch"), SrcRowPitch, options);
+        FieldToJson(writer.Key("SrcDepthPitch"), SrcDepthPitch, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 GFXRECON_END_NAMESPACE(decode)
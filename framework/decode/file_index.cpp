@@ -0,0 +1,387 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/file_index.h"
+
+#include "decode/file_processor.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/hash.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const uint32_t kIndexFileFourCC = GFXRECON_MAKE_FOURCC('G', 'F', 'X', 'I');
+
+template <typename T>
+static bool PeekValue(const util::MemoryMappedFile& file, uint64_t offset, T* value)
+{
+    if ((offset > file.GetSize()) || (sizeof(T) > (file.GetSize() - offset)))
+    {
+        return false;
+    }
+
+    memcpy(value, file.GetData() + offset, sizeof(T));
+    return true;
+}
+
+std::string FileIndex::GetIndexFilename(const std::string& capture_filename)
+{
+    return capture_filename + ".index";
+}
+
+uint64_t FileIndex::ComputeCaptureSignature(const util::MemoryMappedFile& file)
+{
+    // The start of the file holds the file header and options; the end changes with any appended or truncated data.
+    uint64_t region_size = std::min(file.GetSize(), kSignatureRegionSize);
+    uint64_t signature   = util::hash::GenerateHash64(file.GetData(), static_cast<size_t>(region_size));
+
+    return util::hash::GenerateHash64(
+        file.GetData() + (file.GetSize() - region_size), static_cast<size_t>(region_size), signature);
+}
+
+bool FileIndex::Build(const std::string& capture_filename)
+{
+    Clear();
+
+    util::MemoryMappedFile file;
+
+    if (!file.Open(capture_filename))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s to build a frame index", capture_filename.c_str());
+        return false;
+    }
+
+    format::FileHeader file_header;
+
+    if (!PeekValue(file, 0, &file_header) || (file_header.fourcc != GFXRECON_FOURCC))
+    {
+        GFXRECON_LOG_ERROR("Failed to build a frame index for %s: invalid file header", capture_filename.c_str());
+        return false;
+    }
+
+    // The frame counting mirrors FileProcessor::ProcessBlocks, so that an entry restores the processor state that it
+    // would have after processing every block that precedes the entry.
+    uint64_t offset       = sizeof(file_header) + file_header.num_options * sizeof(format::FileOptionPair);
+    uint64_t block_index  = 0;
+    uint64_t frame_number = 0;
+    uint32_t flags        = 0;
+    bool     truncated    = false;
+    uint64_t file_size    = file.GetSize();
+
+    auto add_frame_start = [&]() {
+        frames_.push_back({ EntryType::kFrameStart, flags, frame_number, 0, block_index, offset });
+    };
+
+    add_frame_start();
+
+    while (offset < file_size)
+    {
+        format::BlockHeader block_header;
+
+        if (!PeekValue(file, offset, &block_header))
+        {
+            truncated = true;
+            break;
+        }
+
+        uint64_t data_offset = offset + sizeof(block_header);
+
+        if ((block_header.size > file_size) || (data_offset > (file_size - block_header.size)))
+        {
+            truncated = true;
+            break;
+        }
+
+        uint64_t          next_offset = data_offset + block_header.size;
+        format::BlockType block_type  = format::RemoveCompressedBlockBit(block_header.type);
+        bool              frame_end   = false;
+
+        if ((block_type == format::BlockType::kFunctionCallBlock) ||
+            (block_type == format::BlockType::kMethodCallBlock))
+        {
+            format::ApiCallId call_id = format::ApiCallId::ApiCall_Unknown;
+
+            if (((flags & kUsesFrameMarkers) == 0) && PeekValue(file, data_offset, &call_id))
+            {
+                frame_end = FileProcessor::IsFrameDelimiterApiCall(call_id);
+            }
+        }
+        else if (block_type == format::BlockType::kMetaDataBlock)
+        {
+            format::MetaDataId meta_data_id = 0;
+
+            if (PeekValue(file, data_offset, &meta_data_id) &&
+                (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kSetCompressionDictionaryCommand))
+            {
+                markers_.push_back({ EntryType::kCompressionDictionary, flags, frame_number, 0, block_index, offset });
+            }
+        }
+        else if (block_header.type == format::BlockType::kFrameMarkerBlock)
+        {
+            format::MarkerType marker_type = format::MarkerType::kUnknownMarker;
+
+            if (PeekValue(file, data_offset, &marker_type) && (marker_type == format::MarkerType::kEndMarker))
+            {
+                if ((flags & kUsesFrameMarkers) == 0)
+                {
+                    flags |= kUsesFrameMarkers;
+                    frame_number = 0;
+                }
+
+                frame_end = true;
+            }
+        }
+        else if (block_header.type == format::BlockType::kStateMarkerBlock)
+        {
+            format::MarkerType marker_type         = format::MarkerType::kUnknownMarker;
+            uint64_t           marker_frame_number = 0;
+
+            if (PeekValue(file, data_offset, &marker_type) &&
+                PeekValue(file, data_offset + sizeof(marker_type), &marker_frame_number))
+            {
+                if (marker_type == format::MarkerType::kBeginMarker)
+                {
+                    markers_.push_back(
+                        { EntryType::kStateBegin, flags, frame_number, marker_frame_number, block_index, offset });
+                }
+                else if (marker_type == format::MarkerType::kEndMarker)
+                {
+                    markers_.push_back({ EntryType::kStateEnd,
+                                         flags,
+                                         frame_number,
+                                         marker_frame_number,
+                                         block_index + 1,
+                                         next_offset });
+                }
+            }
+        }
+
+        ++block_index;
+        offset = next_offset;
+
+        if (frame_end)
+        {
+            ++frame_number;
+            add_frame_start();
+        }
+    }
+
+    if (truncated)
+    {
+        GFXRECON_LOG_WARNING("Frame index for %s stops at an incomplete block at offset %" PRIu64,
+                             capture_filename.c_str(),
+                             offset);
+    }
+
+    capture_file_size_ = file_size;
+    capture_signature_ = ComputeCaptureSignature(file);
+
+    UpdateFrameOrder();
+
+    return true;
+}
+
+bool FileIndex::Load(const std::string& index_filename, const std::string& capture_filename)
+{
+    Clear();
+
+    util::MemoryMappedFile capture_file;
+
+    if (!capture_file.Open(capture_filename))
+    {
+        return false;
+    }
+
+    const uint64_t capture_file_size = capture_file.GetSize();
+    const uint64_t capture_signature = ComputeCaptureSignature(capture_file);
+
+    capture_file.Close();
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, index_filename.c_str(), "rb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        return false;
+    }
+
+    IndexFileHeader header{};
+    bool            success = util::platform::FileRead(&header, sizeof(header), file);
+
+    // Each entry references a different block, which bounds the entry count of an index that matches the capture.
+    success = success && (header.fourcc == kIndexFileFourCC) && (header.version == kIndexFileVersion) &&
+              (header.capture_file_size == capture_file_size) && (header.capture_signature == capture_signature) &&
+              (header.entry_count <= ((capture_file_size / sizeof(format::BlockHeader)) + 1));
+
+    if (success)
+    {
+        std::vector<Entry> entries(static_cast<size_t>(header.entry_count));
+
+        success = entries.empty() || util::platform::FileRead(entries.data(), entries.size() * sizeof(Entry), file);
+
+        if (success)
+        {
+            for (const auto& entry : entries)
+            {
+                if (entry.type == EntryType::kFrameStart)
+                {
+                    frames_.push_back(entry);
+                }
+                else
+                {
+                    markers_.push_back(entry);
+                }
+            }
+
+            capture_file_size_ = capture_file_size;
+            capture_signature_ = capture_signature;
+            success            = !frames_.empty();
+
+            UpdateFrameOrder();
+        }
+    }
+
+    util::platform::FileClose(file);
+
+    if (!success)
+    {
+        Clear();
+    }
+
+    return success;
+}
+
+bool FileIndex::Save(const std::string& index_filename) const
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, index_filename.c_str(), "wb");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open frame index file %s for writing", index_filename.c_str());
+        return false;
+    }
+
+    IndexFileHeader header{};
+    header.fourcc            = kIndexFileFourCC;
+    header.version           = kIndexFileVersion;
+    header.capture_file_size = capture_file_size_;
+    header.capture_signature = capture_signature_;
+    header.entry_count       = frames_.size() + markers_.size();
+
+    bool success = util::platform::FileWrite(&header, sizeof(header), file);
+
+    for (const auto* entries : { &frames_, &markers_ })
+    {
+        success = success && (entries->empty() ||
+                              util::platform::FileWrite(entries->data(), entries->size() * sizeof(Entry), file));
+    }
+
+    success = (util::platform::FileClose(file) == 0) && success;
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to write frame index file %s", index_filename.c_str());
+    }
+
+    return success;
+}
+
+void FileIndex::Clear()
+{
+    capture_file_size_ = 0;
+    capture_signature_ = 0;
+    frames_.clear();
+    markers_.clear();
+    frames_sorted_ = true;
+}
+
+void FileIndex::UpdateFrameOrder()
+{
+    frames_sorted_ = std::is_sorted(frames_.begin(), frames_.end(), [](const Entry& lhs, const Entry& rhs) {
+        return lhs.frame_number < rhs.frame_number;
+    });
+}
+
+const FileIndex::Entry* FileIndex::FindFrame(uint64_t frame_number) const
+{
+    if (!frames_sorted_)
+    {
+        // The frame numbers restarted after the frames that were delimited by present calls.
+        auto entry = std::find_if(frames_.rbegin(), frames_.rend(), [frame_number](const Entry& entry) {
+            return entry.frame_number == frame_number;
+        });
+
+        return (entry != frames_.rend()) ? &(*entry) : nullptr;
+    }
+
+    // When the counter restarts at the frame number it had reached, the two start entries of the frame are adjacent
+    // and the last one is found.
+    auto entry = std::upper_bound(frames_.begin(), frames_.end(), frame_number, [](uint64_t value, const Entry& entry) {
+        return value < entry.frame_number;
+    });
+
+    if ((entry == frames_.begin()) || (std::prev(entry)->frame_number != frame_number))
+    {
+        return nullptr;
+    }
+
+    return &(*std::prev(entry));
+}
+
+const FileIndex::Entry* FileIndex::FindStateEnd() const
+{
+    auto entry = std::find_if(
+        markers_.begin(), markers_.end(), [](const Entry& entry) { return entry.type == EntryType::kStateEnd; });
+
+    return (entry != markers_.end()) ? &(*entry) : nullptr;
+}
+
+const FileIndex::Entry* FileIndex::FindLastMarker(EntryType type, uint64_t offset) const
+{
+    const Entry* result = nullptr;
+
+    for (const auto& entry : markers_)
+    {
+        if (entry.offset > offset)
+        {
+            break;
+        }
+
+        if (entry.type == type)
+        {
+            result = &entry;
+        }
+    }
+
+    return result;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
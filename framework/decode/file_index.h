@@ -0,0 +1,137 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_FILE_INDEX_H
+#define GFXRECON_DECODE_FILE_INDEX_H
+
+#include "util/defines.h"
+#include "util/memory_mapped_file.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Maps the frame boundaries, state snapshot markers, and compression dictionaries of a capture file to their block
+// indices and file offsets, so that a FileProcessor can start processing at a frame without decoding the blocks that
+// precede it.  The index is built by scanning the block headers of the capture file and can be stored in a sidecar
+// file next to the capture.
+class FileIndex
+{
+  public:
+    enum class EntryType : uint32_t
+    {
+        kFrameStart            = 0, // Position of the first block of a frame.
+        kStateBegin            = 1, // Position of a state begin marker block.
+        kStateEnd              = 2, // Position of the block that follows a state end marker block.
+        kCompressionDictionary = 3  // Position of a compression dictionary meta-data block.
+    };
+
+    enum EntryFlags : uint32_t
+    {
+        kUsesFrameMarkers = 0x1 // Frame end marker blocks, rather than present calls, delimit frames at this position.
+    };
+
+    struct Entry
+    {
+        EntryType type{ EntryType::kFrameStart };
+        uint32_t  flags{ 0 };
+        uint64_t  frame_number{ 0 };        // FileProcessor::GetCurrentFrameNumber() at the entry position.
+        uint64_t  marker_frame_number{ 0 }; // Captured frame number stored in a state marker block.
+        uint64_t  block_index{ 0 };         // Index of the block at the entry position.
+        uint64_t  offset{ 0 };              // File offset of the block at the entry position.
+    };
+
+  public:
+    // Returns the name of the sidecar index file for a capture file.
+    static std::string GetIndexFilename(const std::string& capture_filename);
+
+    // Scans the block headers of the capture file.  Block data is only read to identify frame delimiters and markers.
+    bool Build(const std::string& capture_filename);
+
+    // Loads an index that was saved for the capture file.  Returns false if the index file does not exist or does not
+    // match the size and the signature of the capture file.
+    bool Load(const std::string& index_filename, const std::string& capture_filename);
+
+    bool Save(const std::string& index_filename) const;
+
+    void Clear();
+
+    bool IsEmpty() const { return frames_.empty(); }
+
+    uint64_t GetCaptureFileSize() const { return capture_file_size_; }
+
+    // Frame start entries, in file order.  The last entry marks the end of the final frame.
+    const std::vector<Entry>& GetFrames() const { return frames_; }
+
+    // State marker and compression dictionary entries, in file order.
+    const std::vector<Entry>& GetMarkers() const { return markers_; }
+
+    // Returns nullptr if the capture does not contain the frame.  Frame numbers restart when a capture switches from
+    // present calls to frame end markers as frame delimiters, so a frame number can have two start entries; the later
+    // one matches the FileProcessor frame number.
+    const Entry* FindFrame(uint64_t frame_number) const;
+
+    // Returns the first state end marker entry, or nullptr if the capture does not contain a state snapshot.
+    const Entry* FindStateEnd() const;
+
+    // Returns the last marker entry of the specified type at or before the file offset, or nullptr if there is none.
+    const Entry* FindLastMarker(EntryType type, uint64_t offset) const;
+
+  private:
+    struct IndexFileHeader
+    {
+        uint32_t fourcc;
+        uint32_t version;
+        uint64_t capture_file_size;
+        uint64_t capture_signature;
+        uint64_t entry_count;
+    };
+
+    static const uint32_t kIndexFileVersion = 2;
+
+    // Size of the regions at the start and the end of the capture file that are hashed for the capture signature.
+    static constexpr uint64_t kSignatureRegionSize = 64 * 1024;
+
+  private:
+    // Records whether the frame numbers of the frame start entries do not decrease, which allows FindFrame to use a
+    // binary search.
+    void UpdateFrameOrder();
+
+    // Identifies a capture file that was rewritten with the same size, such as a capture that was trimmed or
+    // recaptured with the same settings, without reading the whole file.
+    static uint64_t ComputeCaptureSignature(const util::MemoryMappedFile& file);
+
+  private:
+    uint64_t           capture_file_size_{ 0 };
+    uint64_t           capture_signature_{ 0 };
+    std::vector<Entry> frames_;
+    std::vector<Entry> markers_;
+    bool               frames_sorted_{ true };
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_FILE_INDEX_H
@@ -25,6 +25,7 @@
 #include "decode/file_processor.h"
 
 #include "decode/decode_allocator.h"
+#include "decode/value_decoder.h"
 #include "format/format_util.h"
 #include "util/compressor.h"
 #include "util/logging.h"
@@ -42,7 +43,9 @@ const uint32_t kFirstFrame = 0;
 FileProcessor::FileProcessor() :
     file_header_{}, file_descriptor_(nullptr), current_frame_number_(kFirstFrame), bytes_read_(0),
     error_state_(kErrorInvalidFileDescriptor), annotation_handler_(nullptr), compressor_(nullptr), block_index_(0),
-    api_call_index_(0), block_limit_(0), capture_uses_frame_markers_(false), first_frame_(kFirstFrame + 1)
+    block_offset_(0), api_call_index_(0), block_limit_(0), capture_uses_frame_markers_(false),
+    first_frame_(kFirstFrame + 1), parameter_data_(nullptr), file_mapping_offset_(0), file_mapping_eof_(false),
+    use_memory_mapped_file_(true), decompression_thread_count_(0)
 {}
 
 FileProcessor::FileProcessor(uint64_t block_limit) : FileProcessor()
@@ -52,6 +55,9 @@ FileProcessor::FileProcessor(uint64_t block_limit) : FileProcessor()
 
 FileProcessor::~FileProcessor()
 {
+    // Worker threads reference the compressor and the file mapping.
+    decompression_queue_.reset();
+
     if (nullptr != compressor_)
     {
         delete compressor_;
@@ -78,6 +84,31 @@ bool FileProcessor::Initialize(const std::string& filename)
 {
     bool success = false;
 
+    file_mapping_offset_ = 0;
+    file_mapping_eof_    = false;
+
+    if (use_memory_mapped_file_ && OpenMemoryMappedFile(filename))
+    {
+        success = ProcessFileHeader();
+
+        if (success)
+        {
+            // Captures are processed front to back unless a seek is requested.
+            file_mapping_.SetSequentialAccess(true);
+
+            filename_    = filename;
+            error_state_ = kErrorNone;
+
+            StartDecompressionQueue();
+        }
+        else
+        {
+            file_mapping_.Close();
+        }
+
+        return success;
+    }
+
     int32_t result = util::platform::FileOpen(&file_descriptor_, filename.c_str(), "rb");
 
     if ((result == 0) && (file_descriptor_ != nullptr))
@@ -104,22 +135,221 @@ bool FileProcessor::Initialize(const std::string& filename)
     return success;
 }
 
+void FileProcessor::SetDecompressionThreadCount(uint32_t num_threads)
+{
+    decompression_thread_count_ = num_threads;
+
+    if (file_mapping_.IsOpen())
+    {
+        StartDecompressionQueue();
+    }
+}
+
+void FileProcessor::StartDecompressionQueue()
+{
+    decompression_queue_.reset();
+
+    if ((decompression_thread_count_ > 0) && (compressor_ != nullptr) && file_mapping_.IsOpen())
+    {
+        decompression_queue_ = std::make_unique<BlockDecompressionQueue>(compressor_,
+                                                                         file_mapping_.GetData(),
+                                                                         file_mapping_.GetSize(),
+                                                                         file_mapping_offset_,
+                                                                         decompression_thread_count_);
+    }
+}
+
+bool FileProcessor::LoadFileIndex(bool write_index_file)
+{
+    if (filename_.empty())
+    {
+        GFXRECON_LOG_ERROR("A frame index can only be loaded for a file that has been initialized");
+        return false;
+    }
+
+    auto        file_index     = std::make_shared<FileIndex>();
+    std::string index_filename = FileIndex::GetIndexFilename(filename_);
+
+    if (!file_index->Load(index_filename, filename_))
+    {
+        if (!file_index->Build(filename_))
+        {
+            return false;
+        }
+
+        if (write_index_file)
+        {
+            // The index is still usable when it cannot be saved.
+            file_index->Save(index_filename);
+        }
+    }
+
+    file_index_ = std::move(file_index);
+
+    return true;
+}
+
+bool FileProcessor::SeekToFrame(uint64_t frame_number)
+{
+    if (file_index_ == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Seeking to a frame requires a frame index");
+        return false;
+    }
+
+    const FileIndex::Entry* entry = file_index_->FindFrame(frame_number);
+
+    if (entry == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to frame %" PRIu64 ", which is not in the capture file", frame_number);
+        return false;
+    }
+
+    return SeekToIndexEntry(*entry);
+}
+
+bool FileProcessor::SeekToStateEnd()
+{
+    if (file_index_ == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Seeking to the end of the state snapshot requires a frame index");
+        return false;
+    }
+
+    const FileIndex::Entry* entry = file_index_->FindStateEnd();
+
+    if (entry == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to the end of the state snapshot; the capture file does not contain one");
+        return false;
+    }
+
+    return SeekToIndexEntry(*entry);
+}
+
+uint64_t FileProcessor::GetFileSize()
+{
+    if (file_mapping_.IsOpen())
+    {
+        return file_mapping_.GetSize();
+    }
+
+    uint64_t file_size = 0;
+
+    if (file_descriptor_ != nullptr)
+    {
+        int64_t position = util::platform::FileTell(file_descriptor_);
+
+        if (util::platform::FileSeek(file_descriptor_, 0, util::platform::FileSeekEnd))
+        {
+            file_size = static_cast<uint64_t>(util::platform::FileTell(file_descriptor_));
+        }
+
+        util::platform::FileSeek(file_descriptor_, position, util::platform::FileSeekSet);
+    }
+
+    return file_size;
+}
+
+bool FileProcessor::SeekToOffset(uint64_t offset)
+{
+    if (file_mapping_.IsOpen())
+    {
+        if (offset > file_mapping_.GetSize())
+        {
+            return false;
+        }
+
+        // Pages before the seek target may be read again, so they must not be released after they are read.
+        file_mapping_.SetSequentialAccess(false);
+
+        file_mapping_offset_ = offset;
+        file_mapping_eof_    = false;
+    }
+    else
+    {
+        if ((file_descriptor_ == nullptr) ||
+            !util::platform::FileSeek(file_descriptor_, static_cast<int64_t>(offset), util::platform::FileSeekSet))
+        {
+            return false;
+        }
+
+        clearerr(file_descriptor_);
+    }
+
+    bytes_read_ = offset;
+
+    return true;
+}
+
+bool FileProcessor::SeekToIndexEntry(const FileIndex::Entry& entry)
+{
+    // Blocks that follow a compression dictionary can only be decompressed after the dictionary has been loaded.
+    const FileIndex::Entry* dictionary =
+        file_index_->FindLastMarker(FileIndex::EntryType::kCompressionDictionary, entry.offset);
+
+    if ((dictionary != nullptr) && (compressor_ != nullptr))
+    {
+        format::BlockHeader block_header;
+        format::MetaDataId  meta_data_id = 0;
+
+        bool success = SeekToOffset(dictionary->offset) && ReadBlockHeader(&block_header) &&
+                       ReadBytes(&meta_data_id, sizeof(meta_data_id)) && ProcessMetaData(block_header, meta_data_id);
+
+        if (!success)
+        {
+            GFXRECON_LOG_ERROR("Failed to load the compression dictionary at offset %" PRIu64, dictionary->offset);
+            return false;
+        }
+    }
+    else if (compressor_ != nullptr)
+    {
+        // Blocks that precede the first dictionary were compressed without one, so a dictionary that was loaded
+        // before seeking back must be released.  The queue is restarted once the processor has been repositioned.
+        decompression_queue_.reset();
+        compressor_->SetDictionary(nullptr, 0);
+    }
+
+    if (!SeekToOffset(entry.offset))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to offset %" PRIu64, entry.offset);
+        error_state_ = kErrorReadingFile;
+        return false;
+    }
+
+    const FileIndex::Entry* state_end = file_index_->FindLastMarker(FileIndex::EntryType::kStateEnd, entry.offset);
+
+    error_state_                = kErrorNone;
+    block_index_                = entry.block_index;
+    current_frame_number_       = entry.frame_number;
+    capture_uses_frame_markers_ = ((entry.flags & FileIndex::kUsesFrameMarkers) != 0);
+    first_frame_                = (state_end != nullptr) ? state_end->marker_frame_number : (kFirstFrame + 1);
+
+    StartDecompressionQueue();
+
+    return true;
+}
+
 bool FileProcessor::ProcessNextFrame()
 {
     bool success = IsFileValid();
 
     if (success)
     {
+        // Parameter decoding happens on the thread that processes blocks, which may not be the thread that read the
+        // file header.
+        ValueDecoder::SetParameterEncoding(enabled_options_.parameter_encoding);
+
         success = ProcessBlocks();
     }
     else
     {
         // If not EOF, determine reason for invalid state.
-        if (file_descriptor_ == nullptr)
+        if ((file_descriptor_ == nullptr) && !file_mapping_.IsOpen())
         {
             error_state_ = kErrorInvalidFileDescriptor;
         }
-        else if (ferror(file_descriptor_))
+        else if (HasFileError())
         {
             error_state_ = kErrorReadingFile;
         }
@@ -203,6 +433,9 @@ bool FileProcessor::ProcessFileHeader()
                         case format::FileOption::kCompressionType:
                             enabled_options_.compression_type = static_cast<format::CompressionType>(option.value);
                             break;
+                        case format::FileOption::kParameterEncoding:
+                            enabled_options_.parameter_encoding = static_cast<format::ParameterEncoding>(option.value);
+                            break;
                         default:
                             GFXRECON_LOG_WARNING("Ignoring unrecognized file header option %u", option.key);
                             break;
@@ -219,6 +452,15 @@ bool FileProcessor::ProcessFileHeader()
                     success      = false;
                     error_state_ = kErrorUnsupportedCompressionType;
                 }
+                else if ((enabled_options_.parameter_encoding != format::ParameterEncoding::kFixedSize) &&
+                         (enabled_options_.parameter_encoding != format::ParameterEncoding::kCompact))
+                {
+                    GFXRECON_LOG_ERROR("Unsupported parameter encoding (type = %u); replay of the capture file will "
+                                       "not be possible",
+                                       enabled_options_.parameter_encoding);
+                    success      = false;
+                    error_state_ = kErrorUnsupportedParameterEncoding;
+                }
             }
         }
         else
@@ -248,7 +490,8 @@ bool FileProcessor::ProcessBlocks()
 
         if (success)
         {
-            success = ReadBlockHeader(&block_header);
+            block_offset_ = bytes_read_;
+            success       = ReadBlockHeader(&block_header);
 
             for (auto decoder : decoders_)
             {
@@ -391,7 +634,7 @@ bool FileProcessor::ProcessBlocks()
             }
             else
             {
-                if (!feof(file_descriptor_))
+                if (!IsEndOfFile())
                 {
                     // No data has been read for the current block, so we don't use 'HandleBlockReadError' here, as it
                     // assumes that the block header has been successfully read and will print an incomplete block at
@@ -427,12 +670,7 @@ bool FileProcessor::ReadBlockHeader(format::BlockHeader* block_header)
 
 bool FileProcessor::ReadParameterBuffer(size_t buffer_size)
 {
-    if (buffer_size > parameter_buffer_.size())
-    {
-        parameter_buffer_.resize(buffer_size);
-    }
-
-    return ReadBytes(parameter_buffer_.data(), buffer_size);
+    return ReadBytesInPlace(buffer_size, parameter_buffer_, &parameter_data_);
 }
 
 bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
@@ -442,12 +680,24 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
     // This should only be null if initialization failed.
     assert(compressor_ != nullptr);
 
-    if (compressed_buffer_size > compressed_parameter_buffer_.size())
+    if (decompression_queue_ != nullptr)
     {
-        compressed_parameter_buffer_.resize(compressed_buffer_size);
+        // The queue only has data for payloads that start at the current file position, so blocks read from other
+        // sources, such as a preload buffer, never match.
+        const uint8_t* decompressed_data = decompression_queue_->Acquire(
+            file_mapping_offset_, compressed_buffer_size, expected_uncompressed_size);
+
+        if ((decompressed_data != nullptr) && SkipBytes(compressed_buffer_size))
+        {
+            parameter_data_           = decompressed_data;
+            *uncompressed_buffer_size = expected_uncompressed_size;
+            return true;
+        }
     }
 
-    if (ReadBytes(compressed_parameter_buffer_.data(), compressed_buffer_size))
+    const uint8_t* compressed_data = nullptr;
+
+    if (ReadBytesInPlace(compressed_buffer_size, compressed_parameter_buffer_, &compressed_data))
     {
         if (parameter_buffer_.size() < expected_uncompressed_size)
         {
@@ -455,9 +705,10 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
         }
 
         size_t uncompressed_size = compressor_->Decompress(
-            compressed_buffer_size, compressed_parameter_buffer_, expected_uncompressed_size, &parameter_buffer_);
+            compressed_buffer_size, compressed_data, expected_uncompressed_size, &parameter_buffer_);
         if ((0 < uncompressed_size) && (uncompressed_size == expected_uncompressed_size))
         {
+            parameter_data_           = parameter_buffer_.data();
             *uncompressed_buffer_size = uncompressed_size;
             return true;
         }
@@ -467,6 +718,23 @@ bool FileProcessor::ReadCompressedParameterBuffer(size_t  compressed_buffer_size
 
 bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
 {
+    if (file_mapping_.IsOpen())
+    {
+        if (buffer_size <= (file_mapping_.GetSize() - file_mapping_offset_))
+        {
+            util::platform::MemoryCopy(
+                buffer, buffer_size, file_mapping_.GetData() + file_mapping_offset_, buffer_size);
+            file_mapping_offset_ += buffer_size;
+            bytes_read_ += buffer_size;
+            return true;
+        }
+
+        // Match the stream behavior, where EOF is only reported after an attempt to read past the end of the file.
+        file_mapping_offset_ = file_mapping_.GetSize();
+        file_mapping_eof_    = true;
+        return false;
+    }
+
     if (util::platform::FileRead(buffer, buffer_size, file_descriptor_))
     {
         bytes_read_ += buffer_size;
@@ -475,9 +743,57 @@ bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
     return false;
 }
 
+bool FileProcessor::ReadBytesInPlace(size_t buffer_size, std::vector<uint8_t>& storage, const uint8_t** data)
+{
+    assert(data != nullptr);
+
+    if (file_mapping_.IsOpen())
+    {
+        if (buffer_size <= (file_mapping_.GetSize() - file_mapping_offset_))
+        {
+            // MemoryMappedFile provides a copy-on-write view, so decoders that modify their input in place will not
+            // write to the file.
+            *data = file_mapping_.GetData() + file_mapping_offset_;
+            file_mapping_offset_ += buffer_size;
+            bytes_read_ += buffer_size;
+            return true;
+        }
+
+        file_mapping_offset_ = file_mapping_.GetSize();
+        file_mapping_eof_    = true;
+        return false;
+    }
+
+    if (buffer_size > storage.size())
+    {
+        storage.resize(buffer_size);
+    }
+
+    if (ReadBytes(storage.data(), buffer_size))
+    {
+        *data = storage.data();
+        return true;
+    }
+    return false;
+}
+
 bool FileProcessor::SkipBytes(size_t skip_size)
 {
-    bool success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+    bool success = false;
+
+    if (file_mapping_.IsOpen())
+    {
+        success = (skip_size <= (file_mapping_.GetSize() - file_mapping_offset_));
+
+        if (success)
+        {
+            file_mapping_offset_ += skip_size;
+        }
+    }
+    else
+    {
+        success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+    }
 
     if (success)
     {
@@ -488,10 +804,30 @@ bool FileProcessor::SkipBytes(size_t skip_size)
     return success;
 }
 
+bool FileProcessor::IsEndOfFile() const
+{
+    if (file_mapping_.IsOpen())
+    {
+        return file_mapping_eof_;
+    }
+
+    return (file_descriptor_ != nullptr) && (feof(file_descriptor_) != 0);
+}
+
+bool FileProcessor::HasFileError() const
+{
+    if (file_mapping_.IsOpen())
+    {
+        return false;
+    }
+
+    return (file_descriptor_ != nullptr) && (ferror(file_descriptor_) != 0);
+}
+
 void FileProcessor::HandleBlockReadError(Error error_code, const char* error_message)
 {
     // Report incomplete block at end of file as a warning, other I/O errors as an error.
-    if (feof(file_descriptor_) && !ferror(file_descriptor_))
+    if (IsEndOfFile() && !HasFileError())
     {
         GFXRECON_LOG_WARNING("Incomplete block at end of file");
     }
@@ -563,7 +899,7 @@ bool FileProcessor::ProcessFunctionCall(const format::BlockHeader& block_header,
                 {
                     DecodeAllocator::Begin();
                     decoder->SetCurrentApiCallId(call_id);
-                    decoder->DecodeFunctionCall(call_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
+                    decoder->DecodeFunctionCall(call_id, call_info, parameter_data_, parameter_buffer_size);
                     DecodeAllocator::End();
                 }
             }
@@ -649,8 +985,7 @@ bool FileProcessor::ProcessMethodCall(const format::BlockHeader& block_header,
                 {
                     DecodeAllocator::Begin();
                     decoder->SetCurrentApiCallId(call_id);
-                    decoder->DecodeMethodCall(
-                        call_id, object_id, call_info, parameter_buffer_.data(), parameter_buffer_size);
+                    decoder->DecodeMethodCall(call_id, object_id, call_info, parameter_data_, parameter_buffer_size);
                     DecodeAllocator::End();
                 }
             }
@@ -718,7 +1053,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                            header.memory_id,
                                                            header.memory_offset,
                                                            header.memory_size,
-                                                           parameter_buffer_.data());
+                                                           parameter_data_);
                     }
                 }
             }
@@ -771,7 +1106,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                 {
                     if (decoder->SupportsMetaDataId(meta_data_id))
                     {
-                        decoder->DispatchFillMemoryResourceValueCommand(header, parameter_buffer_.data());
+                        decoder->DispatchFillMemoryResourceValueCommand(header, parameter_data_);
                     }
                 }
             }
@@ -909,8 +1244,8 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
 
             if (success)
             {
-                auto        message_start = parameter_buffer_.begin();
-                std::string message(message_start, std::next(message_start, static_cast<size_t>(message_size)));
+                std::string message(reinterpret_cast<const char*>(parameter_data_),
+                                    static_cast<size_t>(message_size));
 
                 for (auto decoder : decoders_)
                 {
@@ -1285,7 +1620,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
         success = success && ReadBytes(&header.pipeline_id, sizeof(header.pipeline_id));
         success = success && ReadBytes(&header.data_size, sizeof(header.data_size));
 
-        // Read variable size shader group handle data into parameter_buffer_.
+        // Read variable size shader group handle data into parameter_data_.
         success = success && ReadParameterBuffer(static_cast<size_t>(header.data_size));
 
         if (success)
@@ -1298,7 +1633,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                                             header.device_id,
                                                                             header.pipeline_id,
                                                                             static_cast<size_t>(header.data_size),
-                                                                            parameter_buffer_.data());
+                                                                            parameter_data_);
                 }
             }
         }
@@ -1454,7 +1789,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                            header.device_id,
                                                            header.buffer_id,
                                                            header.data_size,
-                                                           parameter_buffer_.data());
+                                                           parameter_data_);
                     }
                 }
             }
@@ -1529,7 +1864,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                                                       header.aspect,
                                                       header.layout,
                                                       level_sizes,
-                                                      parameter_buffer_.data());
+                                                      parameter_data_);
                 }
             }
         }
@@ -1583,7 +1918,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                 {
                     if (decoder->SupportsMetaDataId(meta_data_id))
                     {
-                        decoder->DispatchInitSubresourceCommand(header, parameter_buffer_.data());
+                        decoder->DispatchInitSubresourceCommand(header, parameter_data_);
                     }
                 }
             }
@@ -1678,8 +2013,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
                 {
                     if (decoder->SupportsMetaDataId(meta_data_id))
                     {
-                        decoder->DispatchInitDx12AccelerationStructureCommand(
-                            header, geom_descs, parameter_buffer_.data());
+                        decoder->DispatchInitDx12AccelerationStructureCommand(header, geom_descs, parameter_data_);
                     }
                 }
             }
@@ -1836,12 +2170,50 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             return success;
         }
 
-        const char* env_string = (const char*)parameter_buffer_.data();
+        const char* env_string = (const char*)parameter_data_;
         for (auto decoder : decoders_)
         {
             decoder->DispatchSetEnvironmentVariablesCommand(header, env_string);
         }
     }
+    else if (meta_data_type == format::MetaDataType::kSetCompressionDictionaryCommand)
+    {
+        format::SetCompressionDictionaryCommandHeader header;
+        success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
+        success = success && ReadBytes(&header.dictionary_size, sizeof(header.dictionary_size));
+        if (!success)
+        {
+            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read compression dictionary block header");
+            return success;
+        }
+
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.dictionary_size);
+        success = ReadParameterBuffer(static_cast<size_t>(header.dictionary_size));
+        if (!success)
+        {
+            HandleBlockReadError(kErrorReadingBlockData, "Failed to read compression dictionary block data");
+            return success;
+        }
+
+        if (compressor_ != nullptr)
+        {
+            // Worker threads must not be decompressing while the dictionary is replaced.  Blocks that follow the
+            // dictionary were not queued for decompression, so the queue is restarted from the current position.
+            decompression_queue_.reset();
+
+            if (!compressor_->SetDictionary(parameter_data_, static_cast<size_t>(header.dictionary_size)))
+            {
+                GFXRECON_LOG_ERROR("Failed to load the compression dictionary; compressed blocks that follow it cannot "
+                                   "be decompressed");
+            }
+
+            StartDecompressionQueue();
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Skipping compression dictionary in a capture file without compression");
+        }
+    }
     else
     {
         if ((meta_data_type == format::MetaDataType::kReserved23) ||
@@ -1980,15 +2352,14 @@ bool FileProcessor::ProcessAnnotation(const format::BlockHeader& block_header, f
             {
                 if (label_length > 0)
                 {
-                    auto label_start = parameter_buffer_.begin();
-                    label.assign(label_start, std::next(label_start, label_length));
+                    label.assign(reinterpret_cast<const char*>(parameter_data_), label_length);
                 }
 
                 if (data_length > 0)
                 {
-                    auto data_start = std::next(parameter_buffer_.begin(), label_length);
                     GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, data_length);
-                    data.assign(data_start, std::next(data_start, static_cast<size_t>(data_length)));
+                    data.assign(reinterpret_cast<const char*>(parameter_data_) + label_length,
+                                static_cast<size_t>(data_length));
                 }
 
                 assert(annotation_handler_ != nullptr);
@@ -2021,15 +2392,20 @@ bool FileProcessor::IsFrameDelimiter(format::ApiCallId call_id) const
     }
     else
     {
-        // This code is deprecated and no new API calls should be added. Instead, end of frame markers are used to track
-        // the file processor's frame count.
-        return ((call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR) ||
-                (call_id == format::ApiCallId::ApiCall_vkFrameBoundaryANDROID) ||
-                (call_id == format::ApiCallId::ApiCall_IDXGISwapChain_Present) ||
-                (call_id == format::ApiCallId::ApiCall_IDXGISwapChain1_Present1));
+        return IsFrameDelimiterApiCall(call_id);
     }
 }
 
+bool FileProcessor::IsFrameDelimiterApiCall(format::ApiCallId call_id)
+{
+    // This code is deprecated and no new API calls should be added. Instead, end of frame markers are used to track
+    // the file processor's frame count.
+    return ((call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR) ||
+            (call_id == format::ApiCallId::ApiCall_vkFrameBoundaryANDROID) ||
+            (call_id == format::ApiCallId::ApiCall_IDXGISwapChain_Present) ||
+            (call_id == format::ApiCallId::ApiCall_IDXGISwapChain1_Present1));
+}
+
 void FileProcessor::PrintBlockInfo() const
 {
     if (enable_print_block_info_ && ((block_index_from_ < 0 || block_index_to_ < 0) ||
@@ -28,11 +28,15 @@
 #include "format/format.h"
 #include "decode/annotation_handler.h"
 #include "decode/api_decoder.h"
+#include "decode/block_decompression_queue.h"
+#include "decode/file_index.h"
 #include "util/compressor.h"
 #include "util/defines.h"
+#include "util/memory_mapped_file.h"
 
 #include <algorithm>
 #include <cstdio>
+#include <memory>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -55,7 +59,8 @@ class FileProcessor
         kErrorReadingBlockData             = -7,
         kErrorReadingCompressedBlockData   = -8,
         kErrorInvalidFourCC                = -9,
-        kErrorUnsupportedCompressionType   = -10
+        kErrorUnsupportedCompressionType   = -10,
+        kErrorUnsupportedParameterEncoding = -11
     };
 
     enum BlockProcessReturn : int32_t
@@ -83,8 +88,45 @@ class FileProcessor
         decoders_.erase(std::remove(decoders_.begin(), decoders_.end(), decoder), decoders_.end());
     }
 
+    // Selects between memory mapped and buffered stream input for the next call to Initialize().  Memory mapped input
+    // is used by default and falls back to stream reads when the file cannot be mapped.
+    void SetUseMemoryMappedFile(bool enable) { use_memory_mapped_file_ = enable; }
+
     bool Initialize(const std::string& filename);
 
+    // Decompress blocks ahead of the decode position on num_threads worker threads.  Only applies to compressed files
+    // that are read through a memory mapping.  A value of zero decompresses each block on the calling thread when it
+    // is processed.
+    void SetDecompressionThreadCount(uint32_t num_threads);
+
+    // Loads the frame index from the sidecar index file of the capture file, or builds it by scanning the block
+    // headers of the capture file when the sidecar file is missing or out of date.  A rebuilt index is saved to the
+    // sidecar file when write_index_file is true.  Must be called after Initialize().
+    bool LoadFileIndex(bool write_index_file);
+
+    const FileIndex* GetFileIndex() const { return file_index_.get(); }
+
+    // Uses the frame index of another processor of the same capture file, so that processors that convert different
+    // parts of a capture in parallel only load or build the index once.  Must be called after Initialize().
+    void ShareFileIndex(const FileProcessor& other) { file_index_ = other.file_index_; }
+
+    // Moves the processing position to the first block of a frame, where frame_number has the numbering of
+    // GetCurrentFrameNumber().  Requires a file index.  The blocks that are skipped are not decoded, so decoders do not
+    // see the objects and state that they contain.  Continue with ProcessNextFrame(), as ProcessAllFrames() restarts
+    // the block count.
+    bool SeekToFrame(uint64_t frame_number);
+
+    // Moves the processing position to the first block after the state snapshot of a trimmed capture.  Requires a file
+    // index.
+    bool SeekToStateEnd();
+
+    // Moves the processing position to an entry of the file index, such as a frame start entry from GetFrames(), which
+    // also selects between frames that share a frame number.  Requires a file index.
+    bool SeekToIndexEntry(const FileIndex::Entry& entry);
+
+    // Returns true if the API call ends a frame in a capture file that does not contain frame end markers.
+    static bool IsFrameDelimiterApiCall(format::ApiCallId call_id);
+
     // Returns true if there are more frames to process, false if all frames have been processed or an error has
     // occurred.  Use GetErrorState() to determine error condition.
     bool ProcessNextFrame();
@@ -100,9 +142,15 @@ class FileProcessor
 
     uint64_t GetNumBytesRead() const { return bytes_read_; }
 
+    // File offset of the header of the block that is currently being processed.  Only meaningful for blocks that are
+    // read directly from the file.
+    uint64_t GetCurrentBlockOffset() const { return block_offset_; }
+
     Error GetErrorState() const { return error_state_; }
 
-    bool EntireFileWasProcessed() const { return (feof(file_descriptor_) != 0); }
+    bool EntireFileWasProcessed() const { return IsEndOfFile(); }
+
+    bool UsesMemoryMappedFile() const { return file_mapping_.IsOpen(); }
 
     bool UsesFrameMarkers() const { return capture_uses_frame_markers_; }
 
@@ -120,8 +168,20 @@ class FileProcessor
 
     virtual bool ReadBytes(void* buffer, size_t buffer_size);
 
+    // Provides a pointer to the next buffer_size bytes of file data.  When the file is memory mapped, the pointer
+    // references the mapping directly and no copy is made; otherwise the data is read into storage.
+    virtual bool ReadBytesInPlace(size_t buffer_size, std::vector<uint8_t>& storage, const uint8_t** data);
+
     bool SkipBytes(size_t skip_size);
 
+    // Maps the capture file for Initialize().  Initialize() reads the file with buffered stream reads when this
+    // returns false.
+    virtual bool OpenMemoryMappedFile(const std::string& filename) { return file_mapping_.Open(filename); }
+
+    bool IsEndOfFile() const;
+
+    bool HasFileError() const;
+
     bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id, bool& should_break);
 
     bool ProcessMethodCall(const format::BlockHeader& block_header, format::ApiCallId call_id, bool& should_break);
@@ -143,6 +203,15 @@ class FileProcessor
 
     void PrintBlockInfo() const;
 
+    bool ReadParameterBuffer(size_t buffer_size);
+
+    bool ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
+                                       size_t  expected_uncompressed_size,
+                                       size_t* uncompressed_buffer_size);
+
+    // Parameter data of the last call to ReadParameterBuffer() or ReadCompressedParameterBuffer().
+    const uint8_t* GetParameterData() const { return parameter_data_; }
+
   protected:
     FILE*                    file_descriptor_;
     uint64_t                 current_frame_number_;
@@ -154,36 +223,50 @@ class FileProcessor
     /// @brief Incremented at the end of every block successfully processed.
     uint64_t block_index_;
 
+    /// @brief File offset of the header of the block currently being processed.
+    uint64_t block_offset_;
+
   private:
     bool ProcessFileHeader();
 
     virtual bool ProcessBlocks();
 
-    bool ReadParameterBuffer(size_t buffer_size);
+    void StartDecompressionQueue();
 
-    bool ReadCompressedParameterBuffer(size_t  compressed_buffer_size,
-                                       size_t  expected_uncompressed_size,
-                                       size_t* uncompressed_buffer_size);
+    uint64_t GetFileSize();
+
+    bool SeekToOffset(uint64_t offset);
 
     bool IsFileHeaderValid() const { return (file_header_.fourcc == GFXRECON_FOURCC); }
 
-    bool IsFileValid() const { return (file_descriptor_ && !feof(file_descriptor_) && !ferror(file_descriptor_)); }
+    bool IsFileValid() const
+    {
+        return ((file_descriptor_ != nullptr) || file_mapping_.IsOpen()) && !IsEndOfFile() && !HasFileError();
+    }
 
   private:
-    std::string                         filename_;
-    format::FileHeader                  file_header_;
-    std::vector<format::FileOptionPair> file_options_;
-    format::EnabledOptions              enabled_options_;
-    std::vector<uint8_t>                parameter_buffer_;
-    std::vector<uint8_t>                compressed_parameter_buffer_;
-    util::Compressor*                   compressor_;
-    uint64_t                            api_call_index_;
-    uint64_t                            block_limit_;
-    bool                                capture_uses_frame_markers_;
-    uint64_t                            first_frame_;
-    bool                                enable_print_block_info_{ false };
-    int64_t                             block_index_from_{ 0 };
-    int64_t                             block_index_to_{ 0 };
+    std::string                              filename_;
+    format::FileHeader                       file_header_;
+    std::vector<format::FileOptionPair>      file_options_;
+    format::EnabledOptions                   enabled_options_;
+    std::vector<uint8_t>                     parameter_buffer_;
+    std::vector<uint8_t>                     compressed_parameter_buffer_;
+    const uint8_t*                           parameter_data_;
+    util::MemoryMappedFile                   file_mapping_;
+    uint64_t                                 file_mapping_offset_;
+    bool                                     file_mapping_eof_;
+    bool                                     use_memory_mapped_file_;
+    uint32_t                                 decompression_thread_count_;
+    std::unique_ptr<BlockDecompressionQueue> decompression_queue_;
+    std::shared_ptr<const FileIndex>         file_index_;
+    util::Compressor*                        compressor_;
+    uint64_t                                 api_call_index_;
+    uint64_t                                 block_limit_;
+    bool                                     capture_uses_frame_markers_;
+    uint64_t                                 first_frame_;
+    bool                                     enable_print_block_info_{ false };
+    int64_t                                  block_index_from_{ 0 };
+    int64_t                                  block_index_to_{ 0 };
 };
 
 GFXRECON_END_NAMESPACE(decode)
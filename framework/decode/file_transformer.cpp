@@ -26,11 +26,17 @@
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cinttypes>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Large copies are split into chunks of this size, so that the parameter buffer does not grow to the size of the
+// range being copied.
+const size_t kCopyChunkSize = 16 * 1024 * 1024;
+
 FileTransformer::FileTransformer() :
     file_header_{}, input_file_(nullptr), output_file_(nullptr), bytes_read_(0), bytes_written_(0),
     error_state_(kErrorInvalidFileDescriptor), loading_state_(false)
@@ -109,6 +115,12 @@ bool FileTransformer::Process()
         block_index_++;
     }
 
+    if ((error_state_ == kErrorNone) && !FlushPendingBlocks() && (error_state_ == kErrorNone))
+    {
+        // Writing the blocks that were still pending failed without reporting an error code.
+        error_state_ = kErrorWritingFile;
+    }
+
     if (!success && (error_state_ == kErrorNone))
     {
         // If a failure occured, but no error code was set, check for a file error.
@@ -154,6 +166,11 @@ bool FileTransformer::ProcessFileHeader()
                         case format::FileOption::kCompressionType:
                             enabled_options_.compression_type = static_cast<format::CompressionType>(option.value);
                             break;
+                        case format::FileOption::kParameterEncoding:
+                            // Parameter data is copied without being decoded, so the option is only forwarded to the
+                            // output file.
+                            enabled_options_.parameter_encoding = static_cast<format::ParameterEncoding>(option.value);
+                            break;
                         default:
                             GFXRECON_LOG_WARNING("Ignoring unrecognized file header option %u", option.key);
                             break;
@@ -258,7 +275,7 @@ bool FileTransformer::ProcessNextBlock()
         else
         {
             // Copy the block to the output file.
-            success = WriteBlockHeader(block_header);
+            success = FlushPendingBlocks() && WriteBlockHeader(block_header);
 
             if (success)
             {
@@ -385,16 +402,53 @@ bool FileTransformer::SkipBytes(uint64_t skip_size)
 
 bool FileTransformer::CopyBytes(uint64_t copy_size)
 {
-    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, copy_size);
-    if (ReadParameterBuffer(static_cast<size_t>(copy_size)))
+    while (copy_size > 0)
     {
-        if (WriteBytes(parameter_buffer_.data(), static_cast<size_t>(copy_size)))
+        size_t chunk_size = static_cast<size_t>(std::min<uint64_t>(copy_size, kCopyChunkSize));
+
+        if (!ReadParameterBuffer(chunk_size) || !WriteBytes(parameter_buffer_.data(), chunk_size))
         {
-            return true;
+            return false;
         }
+
+        copy_size -= chunk_size;
     }
 
-    return false;
+    return true;
+}
+
+bool FileTransformer::CopyRemainingBytes(uint64_t end_offset)
+{
+    int64_t current_offset = util::platform::FileTell(input_file_);
+
+    if ((current_offset < 0) || !util::platform::FileSeek(input_file_, 0, util::platform::FileSeekEnd))
+    {
+        return false;
+    }
+
+    int64_t file_size = util::platform::FileTell(input_file_);
+
+    if ((file_size < 0) || (static_cast<uint64_t>(file_size) < end_offset) ||
+        (static_cast<uint64_t>(current_offset) > end_offset) ||
+        !util::platform::FileSeek(input_file_, current_offset, util::platform::FileSeekSet))
+    {
+        return false;
+    }
+
+    if (!CopyBytes(end_offset - static_cast<uint64_t>(current_offset)))
+    {
+        return false;
+    }
+
+    if (static_cast<uint64_t>(file_size) > end_offset)
+    {
+        GFXRECON_LOG_ERROR("Incomplete block at end of file: the last %" PRIu64 " bytes of the file were not copied",
+                           static_cast<uint64_t>(file_size) - end_offset);
+        error_state_ = kErrorReadingBlockData;
+        return false;
+    }
+
+    return true;
 }
 
 void FileTransformer::HandleBlockReadError(Error error_code, const char* error_message)
@@ -515,6 +569,12 @@ bool FileTransformer::ProcessMethodCall(const format::BlockHeader& block_header,
 
 bool FileTransformer::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id)
 {
+    if (format::GetMetaDataType(meta_data_id) == format::MetaDataType::kSetCompressionDictionaryCommand)
+    {
+        // Compressed blocks are copied as is, so the new file needs the dictionary that they were compressed with.
+        return ProcessCompressionDictionary(block_header, meta_data_id, true);
+    }
+
     // Copy block data from old file to new file.
     if (!WriteBlockHeader(block_header))
     {
@@ -536,6 +596,49 @@ bool FileTransformer::ProcessMetaData(const format::BlockHeader& block_header, f
     return true;
 }
 
+bool FileTransformer::ProcessCompressionDictionary(const format::BlockHeader& block_header,
+                                                   format::MetaDataId         meta_data_id,
+                                                   bool                       write_block)
+{
+    format::SetCompressionDictionaryCommandHeader header;
+
+    if (!ReadBytes(&header.thread_id, sizeof(header.thread_id)) ||
+        !ReadBytes(&header.dictionary_size, sizeof(header.dictionary_size)))
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read compression dictionary block header");
+        return false;
+    }
+
+    GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, header.dictionary_size);
+    size_t dictionary_size = static_cast<size_t>(header.dictionary_size);
+
+    if (!ReadParameterBuffer(dictionary_size))
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read compression dictionary block data");
+        return false;
+    }
+
+    if ((compressor_ != nullptr) && !compressor_->SetDictionary(parameter_buffer_.data(), dictionary_size))
+    {
+        GFXRECON_LOG_ERROR("Failed to load the compression dictionary; compressed blocks that follow it cannot be "
+                           "decompressed");
+    }
+
+    if (write_block)
+    {
+        header.meta_header.block_header = block_header;
+        header.meta_header.meta_data_id = meta_data_id;
+
+        if (!WriteBytes(&header, sizeof(header)) || !WriteBytes(parameter_buffer_.data(), dictionary_size))
+        {
+            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write compression dictionary block");
+            return false;
+        }
+    }
+
+    return true;
+}
+
 bool FileTransformer::ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type)
 {
     // Copy marker data from old file to new file.
@@ -117,6 +117,10 @@ class FileTransformer
 
     bool CopyBytes(uint64_t copy_size);
 
+    // Copies everything from the current read position to end_offset, which must be the end of the input file.  A
+    // file that continues past end_offset ends with a truncated block, which is reported as an error and not copied.
+    bool CopyRemainingBytes(uint64_t end_offset);
+
     void HandleBlockReadError(Error error_code, const char* error_message);
 
     void HandleBlockWriteError(Error error_code, const char* error_message);
@@ -134,8 +138,18 @@ class FileTransformer
 
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
 
+    // Loads a compression dictionary into the compressor used to read the input file.  When write_block is true, the
+    // dictionary block is also written to the output file.
+    bool ProcessCompressionDictionary(const format::BlockHeader& block_header,
+                                      format::MetaDataId         meta_data_id,
+                                      bool                       write_block);
+
     virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type);
 
+    // Writes any blocks that a derived class has deferred.  Called before a block that is not handled by one of the
+    // Process methods is copied to the output file, and after the last block has been processed.
+    virtual bool FlushPendingBlocks() { return true; }
+
     uint64_t GetCurrentBlockIndex() { return block_index_; }
 
   private:
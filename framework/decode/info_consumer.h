@@ -35,6 +35,12 @@ class InfoConsumer
   public:
     InfoConsumer() {}
     InfoConsumer(bool short_version) { short_version_ = short_version; }
+
+    // The short version completes as soon as the requested reports have been gathered.
+    InfoConsumer(bool short_version, bool need_exe_info, bool need_env_vars) :
+        short_version_(short_version), need_exe_info_(need_exe_info), need_env_vars_(need_env_vars)
+    {}
+
     const std::string GetAppExeName() const { return exe_info.AppName; }
     const uint32_t*   GetAppVersion() const { return exe_info.AppVersion; }
     const char*       GetCompanyName() const { return exe_info.CompanyName; }
@@ -67,7 +73,12 @@ class InfoConsumer
     {
         if (short_version_ == true)
         {
-            return (current_block_index >= MaxBlockIdx) || (found_exe_info_ && found_driver_info_);
+            // The capture layer writes the executable and driver info in the first blocks of the file, so the search
+            // for them is bounded.  The environment variables are searched for until they are found.
+            bool exe_info_complete =
+                !need_exe_info_ || (current_block_index >= MaxBlockIdx) || (found_exe_info_ && found_driver_info_);
+            bool env_vars_complete = !need_env_vars_ || found_env_vars_;
+            return exe_info_complete && env_vars_complete;
         }
         else
         {
@@ -78,16 +89,21 @@ class InfoConsumer
     void Process_SetEnvironmentVariablesCommand(format::SetEnvironmentVariablesCommand& header, const char* env_string)
     {
         env_vars = util::strings::SplitString(std::string_view(env_string), format::kEnvironmentStringDelimeter);
+
+        found_env_vars_ = true;
     }
 
   private:
     static int const                   MaxBlockIdx                                               = 50;
     char                               driver_info[gfxrecon::util::filepath::kMaxDriverInfoSize] = {};
     bool                               short_version_{ false };
+    bool                               need_exe_info_{ true };
+    bool                               need_env_vars_{ false };
     bool                               found_driver_info_{ false };
     gfxrecon::util::filepath::FileInfo exe_info = {};
     bool                               found_exe_info_{ false };
     std::vector<std::string>           env_vars;
+    bool                               found_env_vars_{ false };
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -45,6 +45,7 @@ JsonWriter::~JsonWriter()
 {
     if (os_)
     {
+        stream_writer_.Flush();
         os_->Flush();
     }
 }
@@ -52,34 +53,64 @@ JsonWriter::~JsonWriter()
 void JsonWriter::StartStream(util::OutputStream* os)
 {
     GFXRECON_ASSERT(os);
-    first_ = true;
-    os_    = os;
+    first_    = true;
+    fragment_ = false;
+    os_       = os;
+
+    stream_writer_.SetStream(os_);
+    stream_writer_.SetIndentWidth(json_options_.format == util::JsonFormat::JSONL ? -1 : util::kJsonIndentWidth);
 
     if (json_options_.format == util::JsonFormat::JSON)
     {
-        Write(*os_, "[\n");
+        stream_writer_.Raw("[\n");
     }
 
     // Emit the header object as the first line of the file:
-    WriteBlockStart();
-    json_data_["header"] = header_;
-    WriteBlockEnd();
+    BeginBlock();
+    stream_writer_.BeginObject();
+    stream_writer_.Key("header");
+    stream_writer_.Value(header_);
+    stream_writer_.EndObject();
 
     ++num_streams_;
 }
 
+void JsonWriter::StartFragment(util::OutputStream* os)
+{
+    GFXRECON_ASSERT(os);
+    // The header object always precedes a fragment, so every block of the fragment starts with a separator.
+    first_    = false;
+    fragment_ = true;
+    os_       = os;
+
+    stream_writer_.SetStream(os_);
+    stream_writer_.SetIndentWidth(json_options_.format == util::JsonFormat::JSONL ? -1 : util::kJsonIndentWidth);
+}
+
+void JsonWriter::WriteFragment(const void* data, size_t size)
+{
+    GFXRECON_ASSERT(os_ != nullptr);
+    stream_writer_.Flush();
+    os_->Write(data, size);
+}
+
 void JsonWriter::EndStream()
 {
     if (os_ != nullptr)
     {
-        if (json_options_.format == util::JsonFormat::JSON)
-        {
-            Write(*os_, "\n]\n");
-        }
-        else
+        // A fragment is closed by the writer of the stream that it is appended to.
+        if (!fragment_)
         {
-            Write(*os_, "\n");
+            if (json_options_.format == util::JsonFormat::JSON)
+            {
+                stream_writer_.Raw("\n]\n");
+            }
+            else
+            {
+                stream_writer_.Raw("\n");
+            }
         }
+        stream_writer_.SetStream(nullptr);
         os_->Flush();
         os_ = nullptr;
     }
@@ -95,60 +126,93 @@ bool JsonWriter::IsValid() const
     return os_ != nullptr && os_->IsValid();
 }
 
-nlohmann::ordered_json& JsonWriter::WriteBlockStart()
+void JsonWriter::BeginBlock()
 {
-    // Dominates profiling (1/2):
-    json_data_.clear();
-    return json_data_;
+    GFXRECON_ASSERT(stream_writer_.IsComplete());
+
+    if (!first_)
+    {
+        stream_writer_.Raw(json_options_.format == util::JsonFormat::JSONL ? "\n" : ",\n");
+    }
+    first_ = false;
 }
 
 void JsonWriter::WriteBlockEnd()
 {
-    if (!first_)
+    // Close the objects opened by the Write*Start() call and any the caller left open.
+    while (!stream_writer_.IsComplete())
     {
-        Write(*os_, json_options_.format == util::JsonFormat::JSONL ? "\n" : ",\n");
+        stream_writer_.EndObject();
     }
-    first_ = false;
-    /// @todo Hand the tree over to a backend thread which dumps it to a string and streams it
-    /// while the main thread gets on with building the tree for the next block.
-    // Dominates profiling (2/2):
-    const std::string block =
-        json_data_.dump(json_options_.format == util::JsonFormat::JSONL ? -1 : util::kJsonIndentWidth);
-    Write(*os_, block);
-    os_->Flush();
 }
 
-nlohmann::ordered_json& JsonWriter::WriteApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name)
+void JsonWriter::WriteApiCallPreamble(const ApiCallInfo& call_info, const std::string_view command_name)
 {
-    auto& json_data = WriteBlockStart();
+    stream_writer_.BeginObject();
+    stream_writer_.Key(format::kNameIndex);
+    stream_writer_.Number(call_info.index);
+
+    stream_writer_.Key(format::kNameFunction);
+    stream_writer_.BeginObject();
+    stream_writer_.Key(format::kNameName);
+    stream_writer_.String(command_name);
+    stream_writer_.Key(format::kNameThread);
+    stream_writer_.Number(call_info.thread_id);
+}
 
-    json_data[format::kNameIndex] = call_info.index;
+void JsonWriter::WriteApiCallPreamble(const ApiCallInfo&     call_info,
+                                      const std::string_view object_type,
+                                      const format::HandleId object_id,
+                                      const std::string_view command_name)
+{
+    stream_writer_.BeginObject();
+    stream_writer_.Key(format::kNameIndex);
+    stream_writer_.Number(call_info.index);
+
+    stream_writer_.Key(format::kNameMethod);
+    stream_writer_.BeginObject();
+    stream_writer_.Key(format::kNameName);
+    stream_writer_.String(command_name);
+    stream_writer_.Key(format::kNameThread);
+    stream_writer_.Number(call_info.thread_id);
+
+    stream_writer_.Key(format::kNameObject);
+    stream_writer_.BeginObject();
+    stream_writer_.Key(format::kNameObjectType);
+    stream_writer_.String(object_type);
+    stream_writer_.Key(format::kNameObjectHandle);
+    FieldToJson(stream_writer_, object_id, GetOptions());
+    stream_writer_.EndObject();
+}
 
-    nlohmann::ordered_json& function = json_data[format::kNameFunction];
-    function[format::kNameName]      = command_name;
-    function[format::kNameThread]    = call_info.thread_id;
+void JsonWriter::WriteMetaCommandPreamble(const std::string_view command_name)
+{
+    stream_writer_.BeginObject();
+    stream_writer_.Key(format::kNameIndex);
+    stream_writer_.Number(block_index_);
+
+    stream_writer_.Key(format::kNameMeta);
+    stream_writer_.BeginObject();
+    stream_writer_.Key(format::kNameName);
+    stream_writer_.String(command_name);
+    stream_writer_.Key(format::kNameArgs);
+}
 
-    return function;
+util::JsonStreamWriter& JsonWriter::WriteApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name)
+{
+    BeginBlock();
+    WriteApiCallPreamble(call_info, command_name);
+    return stream_writer_;
 }
 
-nlohmann::ordered_json& JsonWriter::WriteApiCallStart(const ApiCallInfo&     call_info,
+util::JsonStreamWriter& JsonWriter::WriteApiCallStart(const ApiCallInfo&     call_info,
                                                       const std::string_view object_type,
                                                       const format::HandleId object_id,
                                                       const std::string_view command_name)
 {
-    auto& json_data = WriteBlockStart();
-
-    json_data[format::kNameIndex] = call_info.index;
-
-    nlohmann::ordered_json& method = json_data[format::kNameMethod];
-    method[format::kNameName]      = command_name;
-    method[format::kNameThread]    = call_info.thread_id;
-
-    nlohmann::ordered_json& object  = method[format::kNameObject];
-    object[format::kNameObjectType] = object_type;
-    FieldToJson(object[format::kNameObjectHandle], object_id, GetOptions());
-
-    return method;
+    BeginBlock();
+    WriteApiCallPreamble(call_info, object_type, object_id, command_name);
+    return stream_writer_;
 }
 
 void JsonWriter::WriteMarker(const char* const name, const std::string_view marker_type, uint64_t frame_number)
@@ -157,13 +221,17 @@ void JsonWriter::WriteMarker(const char* const name, const std::string_view mark
     // output in case the build has multiple JSON consumers for different APIs enabled.
     if (frame_number != last_frame_number_ || name != last_marker_name_ || marker_type != last_marker_type_)
     {
-        auto& json_data = WriteBlockStart();
-
-        nlohmann::ordered_json& state = json_data[name];
-        state["marker_type"]          = marker_type;
-        state["frame_number"]         = frame_number;
-
-        WriteBlockEnd();
+        BeginBlock();
+
+        stream_writer_.BeginObject();
+        stream_writer_.Key(name);
+        stream_writer_.BeginObject();
+        stream_writer_.Key("marker_type");
+        stream_writer_.String(marker_type);
+        stream_writer_.Key("frame_number");
+        stream_writer_.Number(frame_number);
+        stream_writer_.EndObject();
+        stream_writer_.EndObject();
 
         last_marker_name_  = name;
         last_marker_type_  = marker_type;
@@ -171,14 +239,11 @@ void JsonWriter::WriteMarker(const char* const name, const std::string_view mark
     }
 }
 
-nlohmann::ordered_json& JsonWriter::WriteMetaCommandStart(const std::string_view command_name)
+util::JsonStreamWriter& JsonWriter::WriteMetaCommandStart(const std::string_view command_name)
 {
-    auto& json_data = WriteBlockStart();
-
-    json_data[format::kNameIndex] = block_index_;
-    nlohmann::ordered_json& meta = json_data[format::kNameMeta];
-    meta[format::kNameName]      = command_name;
-    return meta[format::kNameArgs];
+    BeginBlock();
+    WriteMetaCommandPreamble(command_name);
+    return stream_writer_;
 }
 
 void JsonWriter::ProcessAnnotation(uint64_t               block_index,
@@ -186,19 +251,27 @@ void JsonWriter::ProcessAnnotation(uint64_t               block_index,
                                    const std::string&     label,
                                    const std::string&     data)
 {
-    auto& json_data     = WriteBlockStart();
-    json_data["index"]  = block_index;
-    auto& annotation    = json_data["annotation"];
-    annotation["type"]  = util::AnnotationTypeToString(type);
-    annotation["label"] = label;
-    annotation["data"]  = data;
-    WriteBlockEnd();
+    BeginBlock();
+
+    stream_writer_.BeginObject();
+    stream_writer_.Key("index");
+    stream_writer_.Number(block_index);
+    stream_writer_.Key("annotation");
+    stream_writer_.BeginObject();
+    stream_writer_.Key("type");
+    stream_writer_.String(util::AnnotationTypeToString(type));
+    stream_writer_.Key("label");
+    stream_writer_.String(label);
+    stream_writer_.Key("data");
+    stream_writer_.String(data);
+    stream_writer_.EndObject();
+    stream_writer_.EndObject();
 }
 
 std::string JsonWriter::GenerateFilename(const std::string_view filename)
 {
     num_files_++;
-    return std::to_string(num_files_).append("_").append(filename);
+    return std::string(filename_prefix_).append(std::to_string(num_files_)).append("_").append(filename);
 }
 
 bool JsonWriter::WriteBinaryFile(const std::string& filename, uint64_t data_size, const uint8_t* data)
@@ -214,7 +287,7 @@ bool JsonWriter::WriteBinaryFile(const std::string& filename, uint64_t data_size
 }
 
 void RepresentBinaryFile(JsonWriter&             writer,
-                         nlohmann::ordered_json& jdata,
+                         util::JsonStreamWriter& stream_writer,
                          std::string_view        filename_base,
                          const uint64_t          data_size,
                          const uint8_t* const    data)
@@ -227,16 +300,16 @@ void RepresentBinaryFile(JsonWriter&             writer,
         std::string filepath = gfxrecon::util::filepath::Join(json_options.root_dir, basename);
         if (writer.WriteBinaryFile(filepath, data_size, data))
         {
-            FieldToJson(jdata, basename, json_options);
+            FieldToJson(stream_writer, basename, json_options);
         }
         else
         {
-            FieldToJson(jdata, format::kValWriteFailed, json_options);
+            FieldToJson(stream_writer, format::kValWriteFailed, json_options);
         }
     }
     else
     {
-        FieldToJson(jdata, format::kValBinary, json_options);
+        FieldToJson(stream_writer, format::kValBinary, json_options);
     }
 }
 
@@ -28,6 +28,7 @@
 #define GFXRECON_DECODE_JSON_WRITER_H
 
 #include "annotation_handler.h"
+#include "util/json_stream_writer.h"
 #include "util/json_util.h"
 #include "util/platform.h"
 #include "util/defines.h"
@@ -44,6 +45,10 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 struct ApiCallInfo;
 
 /// Manages writing
+///
+/// Every block is streamed through a util::JsonStreamWriter as it is converted, with the
+/// util::JsonStreamWriter overloads of FieldToJson() writing the fields of API calls and
+/// metadata blocks straight to the output without building a tree for the block.
 class JsonWriter : public AnnotationHandler
 {
   public:
@@ -56,45 +61,46 @@ class JsonWriter : public AnnotationHandler
     void StartStream(util::OutputStream* os);
     /// Output data at end of stream such as closing the JSON array.
     void EndStream();
+    /// Output blocks that continue a stream started by StartStream() on another writer,
+    /// without the opening of the JSON array or the header object, so that parts of a
+    /// capture can be converted in parallel and concatenated with WriteFragment().
+    /// EndStream() ends a fragment without closing the JSON array.
+    void StartFragment(util::OutputStream* os);
+    /// Append the output of a writer that was started with StartFragment() to the stream.
+    void WriteFragment(const void* data, size_t size);
     void Destroy();
     bool IsValid() const;
 
-    /// Get a clean fresh JSON tree to build a block's representation in.
-    /// Users can build the JSON representation of their blocks in this tree before
-    /// calling WriteBlockEnd() to serialize it out to the stream.
-    nlohmann::ordered_json& WriteBlockStart();
-
-    /// Finalise the current block and stream it out.
+    /// Finalise the current block, closing any objects that are still open.
     void WriteBlockEnd();
 
-    /// Start the JSON tree for a function call, building the top-level object
-    /// with index and function fields, adding name and thread to the function.
-    /// @return The "function" object field for the caller to populate further
-    /// with return value if any and arguments.
-    nlohmann::ordered_json& WriteApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name);
-
-    /// Start the JSON tree for a method call, building the top-level object
-    /// with index and function fields, adding name and thread to the function.
-    /// @return The "method" object field for the caller to populate further
-    /// with return value if any and arguments.
-    nlohmann::ordered_json& WriteApiCallStart(const ApiCallInfo&     call_info,
+    /// Stream the start of a function call block, with the index and function fields,
+    /// adding name and thread to the function.
+    /// @return The writer, inside the open function object, for the caller to stream the
+    /// return value if any and the arguments with.  WriteBlockEnd() closes the block.
+    util::JsonStreamWriter& WriteApiCallStart(const ApiCallInfo& call_info, const std::string_view command_name);
+
+    /// Stream the start of a method call block, with the index and method fields,
+    /// adding name, thread, and object to the method.
+    /// @return The writer, inside the open method object, for the caller to stream the
+    /// return value if any and the arguments with.  WriteBlockEnd() closes the block.
+    util::JsonStreamWriter& WriteApiCallStart(const ApiCallInfo&     call_info,
                                               const std::string_view object_type,
                                               const format::HandleId object_id,
                                               const std::string_view command_name);
 
     void WriteMarker(const char* name, const std::string_view marker_type, uint64_t frame_number);
 
-    /// @brief Output the boilerplate for representing a metadata block in JSON,
-    /// returning the root of the empty "args" JSON sub-tree for the caller to populate.
-    nlohmann::ordered_json& WriteMetaCommandStart(const std::string_view command_name);
+    /// @brief Stream the boilerplate for representing a metadata block in JSON, up to the
+    /// "args" key.
+    /// @return The writer for the caller to stream the value of "args" with, usually an
+    /// object holding the arguments.  WriteBlockEnd() closes the block.
+    util::JsonStreamWriter& WriteMetaCommandStart(const std::string_view command_name);
 
     /// Get the JSON object used to output the per-stream header
     /// Consumers can add their own fields to it.
     nlohmann::ordered_json& GetHeaderJson() { return header_; }
 
-    /// Get the root of the JSON tree for the current block.
-    nlohmann::ordered_json& GetBlockJson() { return json_data_; }
-
     const util::JsonOptions& GetOptions() const { return json_options_; }
 
     uint32_t GetNumStreams() const { return num_streams_; }
@@ -105,20 +111,38 @@ class JsonWriter : public AnnotationHandler
                                    const std::string&     label,
                                    const std::string&     data) override;
 
+    /// Set a prefix for the names of the side-files generated for binary blobs, to keep
+    /// the names from writers that convert different parts of a capture unique.
+    void SetFilenamePrefix(const std::string_view prefix) { filename_prefix_ = prefix; }
+
     std::string GenerateFilename(const std::string_view filename);
     bool        WriteBinaryFile(const std::string& filename, uint64_t data_size, const uint8_t* data);
 
     inline void SetCurrentBlockIndex(uint64_t block_index) { block_index_ = block_index; }
 
   private:
-    util::OutputStream*    os_;
+    /// Write the separator from the previous block.
+    void BeginBlock();
+
+    void WriteApiCallPreamble(const ApiCallInfo& call_info, const std::string_view command_name);
+
+    void WriteApiCallPreamble(const ApiCallInfo&     call_info,
+                              const std::string_view object_type,
+                              const format::HandleId object_id,
+                              const std::string_view command_name);
+
+    void WriteMetaCommandPreamble(const std::string_view command_name);
+
+  private:
+    util::OutputStream*    os_{ nullptr };
+    util::JsonStreamWriter stream_writer_;
     nlohmann::ordered_json header_;
     util::JsonOptions      json_options_;
-    nlohmann::ordered_json json_data_;
     uint64_t               block_index_;
     uint32_t               num_streams_{ 0 };
     /// Number of side-files generated for dumping binary blobs etc.
-    uint32_t num_files_{ 0 };
+    uint32_t    num_files_{ 0 };
+    std::string filename_prefix_;
 
     // Account for markers being broadcast to all decoders, all consumers, unlike functions and metadata blocks which
     // are tagged with an API family. A marker is only converted if it differs in one of these three attributes.
@@ -127,12 +151,13 @@ class JsonWriter : public AnnotationHandler
     uint64_t    last_frame_number_{ 0 };
 
     bool first_{ true };
+    bool fragment_{ false };
 };
 
-/// Either write the binary data to a file, and put the filename in the tree or
-/// put the tag format::kValBinary in the tree to indicate it
+/// Either write the binary data to a file, and stream the filename as the next value or
+/// stream the tag format::kValBinary to indicate it
 void RepresentBinaryFile(JsonWriter&             writer,
-                         nlohmann::ordered_json& jdata,
+                         util::JsonStreamWriter& stream_writer,
                          const std::string_view  filename_base,
                          const uint64_t          data_size,
                          const uint8_t* const    data);
@@ -28,6 +28,8 @@
 #include "util/file_path.h"
 #include "format/format_json.h"
 
+#include <utility>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
@@ -50,10 +52,10 @@ class MetadataJsonConsumer : public Base
 
     inline const util::JsonOptions& GetOptions() const { return this->writer_->GetOptions(); }
     inline const util::JsonOptions& GetJsonOptions() const { return this->writer_->GetOptions(); } // temp
-    inline nlohmann::ordered_json&  WriteMetaCommandStart(const std::string& command_name) const
+    inline util::JsonStreamWriter&  WriteMetaCommandStart(const std::string& command_name) const
     {
         this->writer_->SetCurrentBlockIndex(this->block_index_);
-        return this->writer_->WriteMetaCommandStart(command_name);
+        return this->writer_->WriteMetaCommandStart(command_name).BeginObject();
     }
     inline void WriteBlockEnd() { this->writer_->WriteBlockEnd(); }
 
@@ -62,8 +64,8 @@ class MetadataJsonConsumer : public Base
     /// @{
     virtual void ProcessDisplayMessageCommand(const std::string& message) override
     {
-        auto& jdata = WriteMetaCommandStart("DisplayMessageCommand");
-        FieldToJson(jdata["message"], message, GetOptions());
+        auto& writer = WriteMetaCommandStart("DisplayMessageCommand");
+        FieldToJson(writer.Key("message"), message, GetOptions());
         WriteBlockEnd();
     }
 
@@ -71,27 +73,27 @@ class MetadataJsonConsumer : public Base
     ProcessFillMemoryCommand(uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override
     {
         const util::JsonOptions& json_options = GetOptions();
-        auto&                    jdata        = WriteMetaCommandStart("FillMemoryCommand");
-        HandleToJson(jdata["memory_id"], memory_id, json_options);
-        FieldToJson(jdata["offset"], offset, json_options);
-        FieldToJson(jdata["size"], size, json_options);
-        RepresentBinaryFile(*(this->writer_), jdata[format::kNameData], "fill_memory.bin", size, data);
+        auto&                    writer       = WriteMetaCommandStart("FillMemoryCommand");
+        HandleToJson(writer.Key("memory_id"), memory_id, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        FieldToJson(writer.Key("size"), size, json_options);
+        RepresentBinaryFile(*(this->writer_), writer.Key(format::kNameData), "fill_memory.bin", size, data);
         WriteBlockEnd();
     }
 
     virtual void Process_ExeFileInfo(gfxrecon::util::filepath::FileInfo& info) override
     {
         const util::JsonOptions& json_options = GetOptions();
-        auto&                    jdata        = WriteMetaCommandStart("ExeFileInfo");
-        FieldToJson(jdata["product_version"], info.ProductVersion, json_options);
-        FieldToJson(jdata["file_version"], info.FileVersion, json_options);
-        FieldToJson(jdata["app_version"], info.AppVersion, json_options);
-        FieldToJson(jdata["app_name"], info.AppName, json_options);
-        FieldToJson(jdata["company_name"], info.CompanyName, json_options);
-        FieldToJson(jdata["file_description"], info.FileDescription, json_options);
-        FieldToJson(jdata["internal_name"], info.InternalName, json_options);
-        FieldToJson(jdata["original_filename"], info.OriginalFilename, json_options);
-        FieldToJson(jdata["product_name"], info.ProductName, json_options);
+        auto&                    writer       = WriteMetaCommandStart("ExeFileInfo");
+        FieldToJson(writer.Key("product_version"), info.ProductVersion, json_options);
+        FieldToJson(writer.Key("file_version"), info.FileVersion, json_options);
+        FieldToJson(writer.Key("app_version"), info.AppVersion, json_options);
+        FieldToJson(writer.Key("app_name"), info.AppName, json_options);
+        FieldToJson(writer.Key("company_name"), info.CompanyName, json_options);
+        FieldToJson(writer.Key("file_description"), info.FileDescription, json_options);
+        FieldToJson(writer.Key("internal_name"), info.InternalName, json_options);
+        FieldToJson(writer.Key("original_filename"), info.OriginalFilename, json_options);
+        FieldToJson(writer.Key("product_name"), info.ProductName, json_options);
         WriteBlockEnd();
     }
 
@@ -99,10 +101,10 @@ class MetadataJsonConsumer : public Base
     {
         using namespace util;
         const JsonOptions& json_options = GetOptions();
-        auto&              jdata        = WriteMetaCommandStart("ResizeWindowCommand");
-        HandleToJson(jdata["surface_id"], surface_id, json_options);
-        FieldToJson(jdata["width"], width, json_options);
-        FieldToJson(jdata["height"], height, json_options);
+        auto&              writer       = WriteMetaCommandStart("ResizeWindowCommand");
+        HandleToJson(writer.Key("surface_id"), surface_id, json_options);
+        FieldToJson(writer.Key("width"), width, json_options);
+        FieldToJson(writer.Key("height"), height, json_options);
         WriteBlockEnd();
     }
 
@@ -111,12 +113,12 @@ class MetadataJsonConsumer : public Base
                                              uint32_t         height,
                                              uint32_t         pre_transform) override
     {
-        auto&                    jdata        = WriteMetaCommandStart("ResizeWindowCommand2");
+        auto&                    writer       = WriteMetaCommandStart("ResizeWindowCommand2");
         const util::JsonOptions& json_options = GetOptions();
-        HandleToJson(jdata["surface_id"], surface_id, json_options);
-        FieldToJson(jdata["width"], width, json_options);
-        FieldToJson(jdata["height"], height, json_options);
-        FieldToJson(jdata["pre_transform"], pre_transform, json_options);
+        HandleToJson(writer.Key("surface_id"), surface_id, json_options);
+        FieldToJson(writer.Key("width"), width, json_options);
+        FieldToJson(writer.Key("height"), height, json_options);
+        FieldToJson(writer.Key("pre_transform"), pre_transform, json_options);
         WriteBlockEnd();
     }
 
@@ -132,22 +134,22 @@ class MetadataJsonConsumer : public Base
                                        const std::vector<format::HardwareBufferPlaneInfo>& plane_info) override
     {
         const util::JsonOptions& json_options = GetOptions();
-        auto&                    jdata        = WriteMetaCommandStart("CreateHardwareBufferCommand");
-        HandleToJson(jdata["memory_id"], memory_id, json_options);
-        HandleToJson(jdata["buffer_id"], buffer_id, json_options);
-        FieldToJson(jdata["format"], format, json_options);
-        FieldToJson(jdata["width"], width, json_options);
-        FieldToJson(jdata["height"], height, json_options);
-        FieldToJson(jdata["stride"], stride, json_options);
-        FieldToJson(jdata["usage"], usage, json_options);
-        FieldToJson(jdata["layers"], layers, json_options);
+        auto&                    writer       = WriteMetaCommandStart("CreateHardwareBufferCommand");
+        HandleToJson(writer.Key("memory_id"), memory_id, json_options);
+        HandleToJson(writer.Key("buffer_id"), buffer_id, json_options);
+        FieldToJson(writer.Key("format"), format, json_options);
+        FieldToJson(writer.Key("width"), width, json_options);
+        FieldToJson(writer.Key("height"), height, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+        FieldToJson(writer.Key("usage"), usage, json_options);
+        FieldToJson(writer.Key("layers"), layers, json_options);
         WriteBlockEnd();
     }
 
     virtual void ProcessDestroyHardwareBufferCommand(const uint64_t buffer_id) override
     {
-        auto& jdata = WriteMetaCommandStart("DestroyHardwareBufferCommand");
-        HandleToJson(jdata["buffer_id"], buffer_id, GetOptions());
+        auto& writer = WriteMetaCommandStart("DestroyHardwareBufferCommand");
+        HandleToJson(writer.Key("buffer_id"), buffer_id, GetOptions());
         WriteBlockEnd();
     }
 
@@ -161,16 +163,17 @@ class MetadataJsonConsumer : public Base
                                                    const std::string& device_name) override
     {
         const util::JsonOptions& json_options = GetOptions();
-        auto&                    jdata        = WriteMetaCommandStart("SetDevicePropertiesCommand");
-        HandleToJson(jdata["physical_device_id"], physical_device_id, json_options);
-        FieldToJson(jdata["api_version"], api_version, json_options);
-        FieldToJson(jdata["driver_version"], driver_version, json_options);
-        FieldToJson(jdata["vendor_id"], vendor_id, json_options);
-        FieldToJson(jdata["device_id"], device_id, json_options);
-        FieldToJson(jdata["device_type"], device_type, json_options);
-        FieldToJson(
-            jdata["pipeline_cache_uuid"], util::uuid_to_string(format::kUuidSize, pipeline_cache_uuid), json_options);
-        FieldToJson(jdata["device_name"], device_name, json_options);
+        auto&                    writer       = WriteMetaCommandStart("SetDevicePropertiesCommand");
+        HandleToJson(writer.Key("physical_device_id"), physical_device_id, json_options);
+        FieldToJson(writer.Key("api_version"), api_version, json_options);
+        FieldToJson(writer.Key("driver_version"), driver_version, json_options);
+        FieldToJson(writer.Key("vendor_id"), vendor_id, json_options);
+        FieldToJson(writer.Key("device_id"), device_id, json_options);
+        FieldToJson(writer.Key("device_type"), device_type, json_options);
+        FieldToJson(writer.Key("pipeline_cache_uuid"),
+                    util::uuid_to_string(format::kUuidSize, pipeline_cache_uuid),
+                    json_options);
+        FieldToJson(writer.Key("device_name"), device_name, json_options);
         WriteBlockEnd();
     }
 
@@ -180,8 +183,8 @@ class MetadataJsonConsumer : public Base
                                             const std::vector<format::DeviceMemoryHeap>& memory_heaps) override
     {
         const util::JsonOptions& json_options = GetJsonOptions();
-        auto&                    jdata        = WriteMetaCommandStart("SetDeviceMemoryPropertiesCommand");
-        HandleToJson(jdata["physical_device_id"], physical_device_id, json_options);
+        auto&                    writer       = WriteMetaCommandStart("SetDeviceMemoryPropertiesCommand");
+        HandleToJson(writer.Key("physical_device_id"), physical_device_id, json_options);
         WriteBlockEnd();
     }
 
@@ -189,10 +192,10 @@ class MetadataJsonConsumer : public Base
     ProcessSetOpaqueAddressCommand(format::HandleId device_id, format::HandleId object_id, uint64_t address) override
     {
         const JsonOptions& json_options = GetJsonOptions();
-        auto&              jdata        = WriteMetaCommandStart("SetOpaqueAddressCommand");
-        HandleToJson(jdata["device_id"], device_id, json_options);
-        HandleToJson(jdata["object_id"], object_id, json_options);
-        FieldToJson(jdata["address"], util::to_hex_variable_width(address), json_options);
+        auto&              writer       = WriteMetaCommandStart("SetOpaqueAddressCommand");
+        HandleToJson(writer.Key("device_id"), device_id, json_options);
+        HandleToJson(writer.Key("object_id"), object_id, json_options);
+        FieldToJson(writer.Key("address"), util::to_hex_variable_width(address), json_options);
         WriteBlockEnd();
     }
 
@@ -202,12 +205,15 @@ class MetadataJsonConsumer : public Base
                                                                const uint8_t*   data) override
     {
         const JsonOptions& json_options = GetJsonOptions();
-        auto&              jdata        = WriteMetaCommandStart("SetRayTracingShaderGroupHandlesCommand");
-        HandleToJson(jdata["device_id"], device_id, json_options);
-        HandleToJson(jdata["pipeline_id"], pipeline_id, json_options);
-        FieldToJson(jdata["data_size"], data_size, json_options);
-        RepresentBinaryFile(
-            *(this->writer_), jdata[format::kNameData], "set_raytracing_shader_group_handles.bin", data_size, data);
+        auto&              writer       = WriteMetaCommandStart("SetRayTracingShaderGroupHandlesCommand");
+        HandleToJson(writer.Key("device_id"), device_id, json_options);
+        HandleToJson(writer.Key("pipeline_id"), pipeline_id, json_options);
+        FieldToJson(writer.Key("data_size"), data_size, json_options);
+        RepresentBinaryFile(*(this->writer_),
+                            writer.Key(format::kNameData),
+                            "set_raytracing_shader_group_handles.bin",
+                            data_size,
+                            data);
         WriteBlockEnd();
     }
 
@@ -218,11 +224,11 @@ class MetadataJsonConsumer : public Base
                                          const std::vector<format::SwapchainImageStateInfo>& image_state) override
     {
         const JsonOptions& json_options = GetJsonOptions();
-        auto&              jdata        = WriteMetaCommandStart("SetSwapchainImageStateCommand");
-        HandleToJson(jdata["device_id"], device_id, json_options);
-        HandleToJson(jdata["swapchain_id"], swapchain_id, json_options);
-        FieldToJson(jdata["last_presented_image"], last_presented_image, json_options);
-        FieldToJson(jdata["image_state"], "not available", json_options);
+        auto&              writer       = WriteMetaCommandStart("SetSwapchainImageStateCommand");
+        HandleToJson(writer.Key("device_id"), device_id, json_options);
+        HandleToJson(writer.Key("swapchain_id"), swapchain_id, json_options);
+        FieldToJson(writer.Key("last_presented_image"), last_presented_image, json_options);
+        FieldToJson(writer.Key("image_state"), "not available", json_options);
         WriteBlockEnd();
     }
 
@@ -231,17 +237,17 @@ class MetadataJsonConsumer : public Base
                                                  uint64_t         max_copy_size) override
     {
         const JsonOptions& json_options = GetJsonOptions();
-        auto&              jdata        = WriteMetaCommandStart("BeginResourceInitCommand");
-        HandleToJson(jdata["device_id"], device_id, json_options);
-        FieldToJson(jdata["max_resource_size"], max_resource_size, json_options);
-        FieldToJson(jdata["max_copy_size"], max_copy_size, json_options);
+        auto&              writer       = WriteMetaCommandStart("BeginResourceInitCommand");
+        HandleToJson(writer.Key("device_id"), device_id, json_options);
+        FieldToJson(writer.Key("max_resource_size"), max_resource_size, json_options);
+        FieldToJson(writer.Key("max_copy_size"), max_copy_size, json_options);
         WriteBlockEnd();
     }
 
     virtual void ProcessEndResourceInitCommand(format::HandleId device_id) override
     {
-        auto& jdata = WriteMetaCommandStart("EndResourceInitCommand");
-        HandleToJson(jdata["device_id"], device_id, GetJsonOptions());
+        auto& writer = WriteMetaCommandStart("EndResourceInitCommand");
+        HandleToJson(writer.Key("device_id"), device_id, GetJsonOptions());
         WriteBlockEnd();
     }
 
@@ -251,11 +257,11 @@ class MetadataJsonConsumer : public Base
                                           const uint8_t*   data) override
     {
         const JsonOptions& json_options = GetJsonOptions();
-        auto&              jdata        = WriteMetaCommandStart("InitBufferCommand");
-        HandleToJson(jdata["device_id"], device_id, json_options);
-        HandleToJson(jdata["buffer_id"], buffer_id, json_options);
-        FieldToJson(jdata["data_size"], data_size, json_options);
-        RepresentBinaryFile(*(this->writer_), jdata[format::kNameData], "init_buffer.bin", data_size, data);
+        auto&              writer       = WriteMetaCommandStart("InitBufferCommand");
+        HandleToJson(writer.Key("device_id"), device_id, json_options);
+        HandleToJson(writer.Key("buffer_id"), buffer_id, json_options);
+        FieldToJson(writer.Key("data_size"), data_size, json_options);
+        RepresentBinaryFile(*(this->writer_), writer.Key(format::kNameData), "init_buffer.bin", data_size, data);
         WriteBlockEnd();
     }
 
@@ -268,14 +274,14 @@ class MetadataJsonConsumer : public Base
                                          const uint8_t*               data) override
     {
         const JsonOptions& json_options = GetJsonOptions();
-        auto&              jdata        = WriteMetaCommandStart("InitImageCommand");
-        HandleToJson(jdata["device_id"], device_id, json_options);
-        HandleToJson(jdata["image_id"], image_id, json_options);
-        FieldToJson(jdata["data_size"], data_size, json_options);
-        FieldToJson(jdata["aspect"], aspect, json_options);
-        FieldToJson(jdata["layout"], layout, json_options);
-        FieldToJson(jdata["level_sizes"], "not available", json_options);
-        RepresentBinaryFile(*(this->writer_), jdata[format::kNameData], "init_image.bin", data_size, data);
+        auto&              writer       = WriteMetaCommandStart("InitImageCommand");
+        HandleToJson(writer.Key("device_id"), device_id, json_options);
+        HandleToJson(writer.Key("image_id"), image_id, json_options);
+        FieldToJson(writer.Key("data_size"), data_size, json_options);
+        FieldToJson(writer.Key("aspect"), aspect, json_options);
+        FieldToJson(writer.Key("layout"), layout, json_options);
+        FieldToJson(writer.Key("level_sizes"), "not available", json_options);
+        RepresentBinaryFile(*(this->writer_), writer.Key(format::kNameData), "init_image.bin", data_size, data);
         WriteBlockEnd();
     }
 
@@ -283,18 +289,46 @@ class MetadataJsonConsumer : public Base
                                                        const char*                             env_string) override
     {
         const JsonOptions& json_options = GetJsonOptions();
-        auto&              json_data    = WriteMetaCommandStart("SetEnvironmentVariablesCommand");
 
-        std::vector<std::string> env_vars =
+        // Gather the variables before streaming them so that an empty list is written as null and a repeated
+        // variable keeps the position of its first occurrence with the last value.
+        std::vector<std::pair<std::string, std::string>> vars;
+        std::vector<std::string>                         env_vars =
             util::strings::SplitString(std::string_view(env_string), format::kEnvironmentStringDelimeter);
         for (std::string& e : env_vars)
         {
             std::vector<std::string> var_plus_val = util::strings::SplitString(e, '=');
             if (var_plus_val.size() == 2)
             {
-                const char* var = var_plus_val[0].c_str();
-                const char* val = var_plus_val[1].c_str();
-                json_data[var]  = val;
+                auto existing = vars.begin();
+                while ((existing != vars.end()) && (existing->first != var_plus_val[0]))
+                {
+                    ++existing;
+                }
+
+                if (existing != vars.end())
+                {
+                    existing->second = std::move(var_plus_val[1]);
+                }
+                else
+                {
+                    vars.emplace_back(std::move(var_plus_val[0]), std::move(var_plus_val[1]));
+                }
+            }
+        }
+
+        this->writer_->SetCurrentBlockIndex(this->block_index_);
+        auto& writer = this->writer_->WriteMetaCommandStart("SetEnvironmentVariablesCommand");
+        if (vars.empty())
+        {
+            writer.Null();
+        }
+        else
+        {
+            writer.BeginObject();
+            for (const auto& var : vars)
+            {
+                FieldToJson(writer.Key(var.first), var.second, json_options);
             }
         }
 
@@ -122,24 +122,24 @@ class PointerDecoder : public PointerDecoderBase
     size_t DecodeFloat(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<float>(buffer, buffer_size); }
 
     // Decode pointer to a void pointer, encoded with ParameterEncoder::EncodeVoidPtrPtr.
-    size_t DecodeVoidPtr(const uint8_t* buffer, size_t buffer_size)      { return DecodeFrom<format::AddressEncodeType>(buffer, buffer_size); }
+    size_t DecodeVoidPtr(const uint8_t* buffer, size_t buffer_size)      { return DecodeFrom<format::AddressEncodeType, ValueDecoder::CompactType::kVarint>(buffer, buffer_size); }
 
     // Decode for array of bytes.
     size_t DecodeUInt8(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<uint8_t>(buffer, buffer_size); }
     size_t DecodeVoid(const uint8_t* buffer, size_t buffer_size)         { return DecodeFrom<uint8_t>(buffer, buffer_size); }
 
     // Decode for special types that may require conversion.
-    size_t DecodeEnum(const uint8_t* buffer, size_t buffer_size)            { return DecodeFrom<format::EnumEncodeType>(buffer, buffer_size); }
-    size_t DecodeFlags(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<format::FlagsEncodeType>(buffer, buffer_size); }
+    size_t DecodeEnum(const uint8_t* buffer, size_t buffer_size)            { return DecodeFrom<format::EnumEncodeType, ValueDecoder::CompactType::kVarint>(buffer, buffer_size); }
+    size_t DecodeFlags(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<format::FlagsEncodeType, ValueDecoder::CompactType::kVarint>(buffer, buffer_size); }
     size_t DecodeVkSampleMask(const uint8_t* buffer, size_t buffer_size)    { return DecodeFrom<format::SampleMaskEncodeType>(buffer, buffer_size); }
-    size_t DecodeHandleId(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<format::HandleEncodeType>(buffer, buffer_size); }
+    size_t DecodeHandleId(const uint8_t* buffer, size_t buffer_size)        { return DecodeFrom<format::HandleEncodeType, ValueDecoder::CompactType::kHandleIdDelta>(buffer, buffer_size); }
     size_t DecodeVkDeviceSize(const uint8_t* buffer, size_t buffer_size)    { return DecodeFrom<format::DeviceSizeEncodeType>(buffer, buffer_size); }
     size_t DecodeVkDeviceAddress(const uint8_t* buffer, size_t buffer_size) { return DecodeFrom<format::DeviceAddressEncodeType>(buffer, buffer_size); }
-    size_t DecodeSizeT(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<format::SizeTEncodeType>(buffer, buffer_size); }
+    size_t DecodeSizeT(const uint8_t* buffer, size_t buffer_size)           { return DecodeFrom<format::SizeTEncodeType, ValueDecoder::CompactType::kVarint>(buffer, buffer_size); }
     // clang-format on
 
   private:
-    template <typename SrcT>
+    template <typename SrcT, ValueDecoder::CompactType Compact = ValueDecoder::CompactType::kNone>
     size_t DecodeFrom(const uint8_t* buffer, size_t buffer_size)
     {
         size_t bytes_read = DecodeAttributes(buffer, buffer_size);
@@ -155,18 +155,18 @@ class PointerDecoder : public PointerDecoderBase
         {
             if (!is_memory_external_)
             {
-                bytes_read += DecodeInternal<SrcT>((buffer + bytes_read), (buffer_size - bytes_read));
+                bytes_read += DecodeInternal<SrcT, Compact>((buffer + bytes_read), (buffer_size - bytes_read));
             }
             else
             {
-                bytes_read += DecodeExternal<SrcT>((buffer + bytes_read), (buffer_size - bytes_read));
+                bytes_read += DecodeExternal<SrcT, Compact>((buffer + bytes_read), (buffer_size - bytes_read));
             }
         }
 
         return bytes_read;
     }
 
-    template <typename SrcT>
+    template <typename SrcT, ValueDecoder::CompactType Compact>
     size_t DecodeInternal(const uint8_t* buffer, size_t buffer_size)
     {
         assert(data_ == nullptr);
@@ -177,7 +177,7 @@ class PointerDecoder : public PointerDecoderBase
         if (HasData())
         {
             data_      = DecodeAllocator::Allocate<T>(len, false);
-            bytes_read = ValueDecoder::DecodeArrayFrom<SrcT>(buffer, buffer_size, data_, len);
+            bytes_read = ValueDecoder::DecodeArrayAs<SrcT, Compact>(buffer, buffer_size, data_, len);
         }
         else
         {
@@ -188,7 +188,7 @@ class PointerDecoder : public PointerDecoderBase
         return bytes_read;
     }
 
-    template <typename SrcT>
+    template <typename SrcT, ValueDecoder::CompactType Compact>
     size_t DecodeExternal(const uint8_t* buffer, size_t buffer_size)
     {
         assert(data_ != nullptr);
@@ -201,12 +201,12 @@ class PointerDecoder : public PointerDecoderBase
 
             if (len <= capacity_)
             {
-                ValueDecoder::DecodeArrayFrom<SrcT>(buffer, buffer_size, data_, len);
+                ValueDecoder::DecodeArrayAs<SrcT, Compact>(buffer, buffer_size, data_, len);
             }
             else
             {
                 // The external memory cacpacity is not large enough to contain the full decoded array.
-                ValueDecoder::DecodeArrayFrom<SrcT>(buffer, buffer_size, data_, capacity_);
+                ValueDecoder::DecodeArrayAs<SrcT, Compact>(buffer, buffer_size, data_, capacity_);
 
                 GFXRECON_LOG_WARNING("Pointer decoder's external memory capacity (%" PRIuPTR
                                      ") is smaller than the decoded array size (%" PRIuPTR "); data will be truncated",
@@ -216,7 +216,7 @@ class PointerDecoder : public PointerDecoderBase
 
             // We always need to advance the position within the buffer by the amount of data that was expected to
             // be decoded, not the actual amount of data decoded if capacity is too small to hold all of the data.
-            bytes_read = sizeof(SrcT) * len;
+            bytes_read = ValueDecoder::GetEncodedArraySize<SrcT, Compact>(buffer, buffer_size, len);
         }
 
         return bytes_read;
@@ -24,10 +24,14 @@
 #include "decode/preload_file_processor.h"
 #include "util/logging.h"
 
+#include <algorithm>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-PreloadFileProcessor::PreloadFileProcessor() : status_(PreloadStatus::kInactive) {}
+PreloadFileProcessor::PreloadFileProcessor(bool preload_decompressed) :
+    status_(PreloadStatus::kInactive), preload_decompressed_(preload_decompressed)
+{}
 
 void PreloadFileProcessor::PreloadNextFrames(size_t count)
 {
@@ -39,27 +43,198 @@ void PreloadFileProcessor::PreloadNextFrames(size_t count)
     status_ = PreloadStatus::kReplay;
 }
 
-PreloadFileProcessor::PreloadBuffer::PreloadBuffer() : replay_offset_(0) {}
+PreloadFileProcessor::PreloadBuffer::PreloadBuffer() :
+    total_size_(0), replay_chunk_(0), replay_offset_(0), replay_position_(0)
+{}
 
-void PreloadFileProcessor::PreloadBuffer::Reserve(size_t size)
+char* PreloadFileProcessor::PreloadBuffer::Allocate(size_t size)
 {
-    container_.reserve(container_.size() + size);
+    if (chunks_.empty() || ((chunks_.back().capacity - chunks_.back().size) < size))
+    {
+        // Memory is not initialized, as the caller overwrites all of it.
+        size_t capacity = std::max(size, kChunkSize);
+        chunks_.push_back({ std::unique_ptr<char[]>(new char[capacity]), capacity, 0 });
+    }
+
+    Chunk& chunk = chunks_.back();
+    char*  data  = chunk.data.get() + chunk.size;
+    chunk.size += size;
+    total_size_ += size;
+    return data;
+}
+
+bool PreloadFileProcessor::PreloadBuffer::NextReplayChunk()
+{
+    while ((replay_chunk_ < chunks_.size()) && (replay_offset_ == chunks_[replay_chunk_].size))
+    {
+        ++replay_chunk_;
+        replay_offset_ = 0;
+    }
+    return replay_chunk_ < chunks_.size();
 }
 
 size_t PreloadFileProcessor::PreloadBuffer::Read(void* destination, size_t destination_size)
 {
-    auto remaining_buffer_data = container_.size() - replay_offset_;
-    auto read_size             = destination_size > remaining_buffer_data ? remaining_buffer_data : destination_size;
-    memcpy(destination, &container_[replay_offset_], read_size);
-    replay_offset_ += read_size;
+    char*  output    = reinterpret_cast<char*>(destination);
+    size_t read_size = 0;
+
+    while ((read_size < destination_size) && NextReplayChunk())
+    {
+        const Chunk& chunk     = chunks_[replay_chunk_];
+        size_t       copy_size = std::min(destination_size - read_size, chunk.size - replay_offset_);
+        memcpy(output + read_size, chunk.data.get() + replay_offset_, copy_size);
+        replay_offset_ += copy_size;
+        read_size += copy_size;
+    }
+
+    replay_position_ += read_size;
     return read_size;
 }
 
+const void* PreloadFileProcessor::PreloadBuffer::Acquire(size_t size)
+{
+    // Blocks never span chunks, so the data of a block is always contiguous.
+    if ((size > 0) && (!NextReplayChunk() || ((chunks_[replay_chunk_].size - replay_offset_) < size)))
+    {
+        replay_chunk_    = chunks_.size();
+        replay_offset_   = 0;
+        replay_position_ = total_size_;
+        return nullptr;
+    }
+
+    if (replay_chunk_ >= chunks_.size())
+    {
+        return nullptr;
+    }
+
+    const void* data = chunks_[replay_chunk_].data.get() + replay_offset_;
+    replay_offset_ += size;
+    replay_position_ += size;
+    return data;
+}
+
 void PreloadFileProcessor::PreloadBuffer::Reset()
 {
-    container_.clear();
-    container_.shrink_to_fit();
-    replay_offset_ = 0;
+    chunks_.clear();
+    total_size_      = 0;
+    replay_chunk_    = 0;
+    replay_offset_   = 0;
+    replay_position_ = 0;
+}
+
+bool PreloadFileProcessor::PreloadApiCall(format::BlockHeader& block_header,
+                                          format::ApiCallId    api_call_id,
+                                          bool                 method_call)
+{
+    if (!preload_decompressed_ || !format::IsBlockCompressed(block_header.type))
+    {
+        return ReadParameterBytes(block_header, api_call_id, preload_buffer_);
+    }
+
+    // The uncompressed block keeps the call ID, object ID and thread ID, and drops the uncompressed size.
+    uint8_t  fixed_data[sizeof(api_call_id) + sizeof(format::HandleId) + sizeof(format::ThreadId)];
+    size_t   fixed_size        = sizeof(api_call_id) + sizeof(format::ThreadId);
+    uint64_t uncompressed_size = 0;
+
+    if (method_call)
+    {
+        fixed_size += sizeof(format::HandleId);
+    }
+
+    memcpy(fixed_data, &api_call_id, sizeof(api_call_id));
+
+    bool success = ReadBytes(fixed_data + sizeof(api_call_id), fixed_size - sizeof(api_call_id));
+    success      = success && ReadBytes(&uncompressed_size, sizeof(uncompressed_size));
+
+    if (success)
+    {
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+        size_t compressed_size = static_cast<size_t>(block_header.size) - fixed_size - sizeof(uncompressed_size);
+        success                = PreloadDecompressedBlock(
+            block_header, fixed_data, fixed_size, compressed_size, static_cast<size_t>(uncompressed_size));
+    }
+
+    return success;
+}
+
+bool PreloadFileProcessor::PreloadMetaData(format::BlockHeader& block_header, format::MetaDataId meta_data_id)
+{
+    format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
+
+    if (!preload_decompressed_ || !format::IsBlockCompressed(block_header.type) ||
+        ((meta_data_type != format::MetaDataType::kFillMemoryCommand) &&
+         (meta_data_type != format::MetaDataType::kFillMemoryResourceValueCommand)))
+    {
+        return ReadParameterBytes(block_header, meta_data_id, preload_buffer_);
+    }
+
+    // Fill memory: thread ID, memory ID, memory offset and memory size, which is the uncompressed size.
+    // Fill memory resource value: thread ID and resource value count, which determines the uncompressed size.
+    uint8_t  fixed_data[sizeof(meta_data_id) + sizeof(format::ThreadId) + sizeof(format::HandleId) + sizeof(uint64_t) +
+                       sizeof(uint64_t)];
+    size_t   fixed_size        = sizeof(meta_data_id) + sizeof(format::ThreadId) + sizeof(uint64_t);
+    uint64_t uncompressed_size = 0;
+
+    if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
+    {
+        fixed_size += sizeof(format::HandleId) + sizeof(uint64_t);
+    }
+
+    memcpy(fixed_data, &meta_data_id, sizeof(meta_data_id));
+
+    bool success = ReadBytes(fixed_data + sizeof(meta_data_id), fixed_size - sizeof(meta_data_id));
+
+    if (success)
+    {
+        uint64_t last_field = 0;
+        memcpy(&last_field, fixed_data + fixed_size - sizeof(last_field), sizeof(last_field));
+
+        if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
+        {
+            uncompressed_size = last_field;
+        }
+        else
+        {
+            uncompressed_size = last_field * (sizeof(format::ResourceValueType) + sizeof(uint64_t));
+        }
+
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
+
+        size_t compressed_size = static_cast<size_t>(block_header.size) - fixed_size;
+        success                = PreloadDecompressedBlock(
+            block_header, fixed_data, fixed_size, compressed_size, static_cast<size_t>(uncompressed_size));
+    }
+
+    return success;
+}
+
+bool PreloadFileProcessor::PreloadDecompressedBlock(const format::BlockHeader& block_header,
+                                                    const uint8_t*             fixed_data,
+                                                    size_t                     fixed_size,
+                                                    size_t                     compressed_size,
+                                                    size_t                     uncompressed_size)
+{
+    // Uses the data of the decompression worker threads when they have already decompressed the block.
+    size_t actual_size = 0;
+    bool   success     = ReadCompressedParameterBuffer(compressed_size, uncompressed_size, &actual_size);
+    success            = success && (actual_size == uncompressed_size);
+
+    if (success)
+    {
+        format::BlockHeader decompressed_header;
+        decompressed_header.type = format::RemoveCompressedBlockBit(block_header.type);
+        decompressed_header.size = fixed_size + actual_size;
+
+        char* block = preload_buffer_.Allocate(sizeof(decompressed_header) + decompressed_header.size);
+        memcpy(block, &decompressed_header, sizeof(decompressed_header));
+        block += sizeof(decompressed_header);
+        memcpy(block, fixed_data, fixed_size);
+        block += fixed_size;
+        memcpy(block, GetParameterData(), actual_size);
+    }
+
+    return success;
 }
 
 bool PreloadFileProcessor::ProcessBlocks()
@@ -98,7 +273,7 @@ bool PreloadFileProcessor::ProcessBlocks()
                         const auto is_frame_delimiter = IsFrameDelimiter(api_call_id);
                         if (status_ == PreloadStatus::kRecord)
                         {
-                            success = ReadParameterBytes(block_header, api_call_id, preload_buffer_);
+                            success = PreloadApiCall(block_header, api_call_id, false);
                             if (!success)
                             {
                                 HandleBlockReadError(kErrorReadingBlockData, "Failed to read function call block data");
@@ -135,7 +310,7 @@ bool PreloadFileProcessor::ProcessBlocks()
                         const auto is_frame_delimiter = IsFrameDelimiter(api_call_id);
                         if (status_ == PreloadStatus::kRecord)
                         {
-                            success = ReadParameterBytes(block_header, api_call_id, preload_buffer_);
+                            success = PreloadApiCall(block_header, api_call_id, true);
                             if (!success)
                             {
                                 HandleBlockReadError(kErrorReadingBlockData,
@@ -163,9 +338,20 @@ bool PreloadFileProcessor::ProcessBlocks()
                 }
                 else if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kMetaDataBlock)
                 {
-                    if (status_ == PreloadStatus::kRecord)
+                    format::MetaDataId meta_data_id = format::MakeMetaDataId(
+                        format::ApiFamilyId::ApiFamily_None, format::MetaDataType::kUnknownMetaDataType);
+
+                    success = ReadBytes(&meta_data_id, sizeof(meta_data_id));
+
+                    if (!success)
                     {
-                        success = ReadParameterBytes(block_header, preload_buffer_);
+                        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read meta-data block header");
+                    }
+                    else if ((status_ == PreloadStatus::kRecord) &&
+                             (format::GetMetaDataType(meta_data_id) !=
+                              format::MetaDataType::kSetCompressionDictionaryCommand))
+                    {
+                        success = PreloadMetaData(block_header, meta_data_id);
                         if (!success)
                         {
                             HandleBlockReadError(kErrorReadingBlockData, "Failed to preload meta-data block");
@@ -173,19 +359,9 @@ bool PreloadFileProcessor::ProcessBlocks()
                     }
                     else
                     {
-                        format::MetaDataId meta_data_id = format::MakeMetaDataId(
-                            format::ApiFamilyId::ApiFamily_None, format::MetaDataType::kUnknownMetaDataType);
-
-                        success = ReadBytes(&meta_data_id, sizeof(meta_data_id));
-
-                        if (success)
-                        {
-                            success = ProcessMetaData(block_header, meta_data_id);
-                        }
-                        else
-                        {
-                            HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read meta-data block header");
-                        }
+                        // Compression dictionaries are loaded while preloading, as the call blocks that follow them
+                        // are decompressed while preloading.
+                        success = ProcessMetaData(block_header, meta_data_id);
                     }
                 }
                 else if (block_header.type == format::BlockType::kFrameMarkerBlock)
@@ -300,7 +476,7 @@ bool PreloadFileProcessor::ProcessBlocks()
             }
             else
             {
-                if (feof(file_descriptor_) == 0)
+                if (!IsEndOfFile())
                 {
                     // No data has been read for the current block, so we don't use 'HandleBlockReadError' here, as
                     // it assumes that the block header has been successfully read and will print an incomplete
@@ -323,22 +499,36 @@ bool PreloadFileProcessor::ProcessBlocks()
 
 bool PreloadFileProcessor::ReadBytes(void* buffer, size_t buffer_size)
 {
-    size_t bytes_read = 0;
     if (status_ == PreloadStatus::kReplay)
     {
-        bytes_read = preload_buffer_.Read(buffer, buffer_size);
+        size_t bytes_read = preload_buffer_.Read(buffer, buffer_size);
         bytes_read_ += bytes_read;
         if (preload_buffer_.ReplayFinished())
         {
             status_ = PreloadStatus::kInactive;
         }
+        return bytes_read == buffer_size;
     }
-    else
+    return FileProcessor::ReadBytes(buffer, buffer_size);
+}
+
+bool PreloadFileProcessor::ReadBytesInPlace(size_t buffer_size, std::vector<uint8_t>& storage, const uint8_t** data)
+{
+    if (status_ == PreloadStatus::kReplay)
     {
-        bytes_read = util::platform::FileRead(buffer, buffer_size, file_descriptor_);
-        bytes_read_ += bytes_read;
+        // Preloaded blocks are contiguous in memory, so they can be decoded without another copy.
+        *data = reinterpret_cast<const uint8_t*>(preload_buffer_.Acquire(buffer_size));
+        if (*data != nullptr)
+        {
+            bytes_read_ += buffer_size;
+        }
+        if (preload_buffer_.ReplayFinished())
+        {
+            status_ = PreloadStatus::kInactive;
+        }
+        return (*data != nullptr);
     }
-    return bytes_read == buffer_size;
+    return FileProcessor::ReadBytesInPlace(buffer_size, storage, data);
 }
 
 GFXRECON_END_NAMESPACE(decode)
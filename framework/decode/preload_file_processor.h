@@ -27,52 +27,69 @@
 #include "decode/file_processor.h"
 #include "format/format_util.h"
 
+#include <cstring>
+#include <memory>
+#include <vector>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 class PreloadFileProcessor : public FileProcessor
 {
   public:
-    PreloadFileProcessor();
+    // When preload_decompressed is true, compressed blocks are decompressed while preloading.  Otherwise they are
+    // preloaded as they are stored in the capture file, and are decompressed when replayed.
+    PreloadFileProcessor(bool preload_decompressed = false);
 
     // Preloads *count* frames to continuous, expandable memory buffer
     void PreloadNextFrames(size_t count);
 
   private:
+    // Stores the preloaded blocks in a list of fixed size chunks, so that adding a block never moves or copies the
+    // blocks that were added before it. Each block is stored contiguously within one chunk.
     class PreloadBuffer
     {
       public:
         PreloadBuffer();
 
-        // Ensures the buffer can store additional *size* bytes
-        void Reserve(size_t size);
+        // Allocates *size* contiguous bytes at the end of the buffer
+        // Returns the pointer to uninitialized memory
+        char* Allocate(size_t size);
 
         // Copies the preloaded data from the internal container into the provided destination buffer
         // Accounts for current replay position
         size_t Read(void* destination, size_t destination_size);
 
-        // Copies provided object of type T into the preload buffer
-        // Returns a pointer to inserted object in the container
-        template <typename T>
-        inline void* Add(T* data)
-        {
-            return &*container_.insert(
-                container_.end(), reinterpret_cast<char*>(data), reinterpret_cast<char*>(data) + sizeof(T));
-        }
-
-        // Allocates *size* bytes in the preload buffer
-        // Returns the pointer to initialized memory
-        inline void* Add(size_t size) { return &*container_.insert(container_.end(), size, 0); }
+        // Returns a pointer to the next *size* bytes of preloaded data and advances the replay position
+        // Returns nullptr if fewer than *size* bytes remain
+        const void* Acquire(size_t size);
 
         // Indicates whether the preloaded calls have been replayed in full
-        inline bool ReplayFinished() { return !container_.empty() && replay_offset_ >= container_.size(); }
+        inline bool ReplayFinished() const { return (total_size_ != 0) && (replay_position_ >= total_size_); }
 
         // Clears the preload buffer, resets internal state
         void Reset();
 
       private:
-        std::vector<char> container_;
-        size_t            replay_offset_;
+        struct Chunk
+        {
+            std::unique_ptr<char[]> data;
+            size_t                  capacity;
+            size_t                  size;
+        };
+
+        // Moves the replay position to the next chunk when all data of the current chunk has been replayed
+        // Returns false if all data has been replayed
+        bool NextReplayChunk();
+
+        // Blocks that are larger than the chunk size are stored in a chunk of their own
+        static constexpr size_t kChunkSize = 16 * 1024 * 1024;
+
+        std::vector<Chunk> chunks_;
+        size_t             total_size_;
+        size_t             replay_chunk_;
+        size_t             replay_offset_;
+        size_t             replay_position_;
 
     } preload_buffer_;
 
@@ -83,29 +100,48 @@ class PreloadFileProcessor : public FileProcessor
         kReplay
     } status_;
 
+    bool preload_decompressed_;
+
     template <typename T>
     bool ReadParameterBytes(format::BlockHeader& block_header, T& data, PreloadBuffer& preload_buffer)
     {
-        preload_buffer.Reserve(sizeof(block_header) + block_header.size);
-        preload_buffer.Add(&block_header);
-        preload_buffer.Add(&data);
-        size_t parameters_size  = block_header.size - sizeof(T);
-        void*  parameter_buffer = preload_buffer.Add(parameters_size);
-        return ReadBytes(parameter_buffer, parameters_size);
+        size_t parameters_size = block_header.size - sizeof(T);
+        char*  block           = preload_buffer.Allocate(sizeof(block_header) + block_header.size);
+        memcpy(block, &block_header, sizeof(block_header));
+        memcpy(block + sizeof(block_header), &data, sizeof(T));
+        return ReadBytes(block + sizeof(block_header) + sizeof(T), parameters_size);
     }
 
     bool ReadParameterBytes(format::BlockHeader& block_header, PreloadBuffer& preload_buffer)
     {
-        preload_buffer.Reserve(sizeof(block_header) + block_header.size);
-        preload_buffer.Add(&block_header);
-        size_t parameters_size  = block_header.size;
-        void*  parameter_buffer = preload_buffer.Add(parameters_size);
-        return ReadBytes(parameter_buffer, parameters_size);
+        char* block = preload_buffer.Allocate(sizeof(block_header) + block_header.size);
+        memcpy(block, &block_header, sizeof(block_header));
+        return ReadBytes(block + sizeof(block_header), block_header.size);
     }
 
+    // Preloads a function or method call block. When preload_decompressed_ is set, compressed blocks are decompressed
+    // while preloading and are stored as uncompressed blocks, so that the preloaded range is replayed without
+    // decompression.
+    bool PreloadApiCall(format::BlockHeader& block_header, format::ApiCallId api_call_id, bool method_call);
+
+    // Preloads a meta-data block. When preload_decompressed_ is set, compressed fill memory and fill memory resource
+    // value blocks are decompressed while preloading, like call blocks. The other compressed meta-data blocks, which
+    // initialize resources and belong to the trimmed state rather than to a frame range, are preloaded compressed.
+    bool PreloadMetaData(format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
+    // Decompresses the payload that follows the block's fixed size data and stores the block uncompressed.
+    // fixed_data holds the fixed size data that follows the block header in the uncompressed block.
+    bool PreloadDecompressedBlock(const format::BlockHeader& block_header,
+                                  const uint8_t*             fixed_data,
+                                  size_t                     fixed_size,
+                                  size_t                     compressed_size,
+                                  size_t                     uncompressed_size);
+
     bool ProcessBlocks() override;
 
     bool ReadBytes(void* buffer, size_t buffer_size) override;
+
+    bool ReadBytesInPlace(size_t buffer_size, std::vector<uint8_t>& storage, const uint8_t** data) override;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -26,7 +26,9 @@
 #include "util/platform.h"
 #include "decode/decoder_util.h"
 
+#include <algorithm>
 #include <limits>
+#include <thread>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
@@ -66,6 +68,21 @@ inline void WriteImageFile(const std::string&     filename,
     }
 }
 
+ScreenshotHandler::~ScreenshotHandler()
+{
+    // The image files that are still being encoded must be written before the encoding threads are joined.
+    for (auto& entry : device_resources_)
+    {
+        for (auto& copy_resource : entry.second.copy_resources)
+        {
+            if (copy_resource.encode_task != nullptr)
+            {
+                copy_resource.encode_task->wait();
+            }
+        }
+    }
+}
+
 void ScreenshotHandler::WriteImage(const std::string&                      filename_prefix,
                                    const DeviceInfo*                       device_info,
                                    const encode::VulkanDeviceTable*        device_table,
@@ -99,34 +116,31 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
     auto     device = device_info->handle;
     // TODO: Improved queue selection; ensure queue supports transfer operations.
 
-    // Get a command pool for the device.
-    auto copy_resource_entry = copy_resources_.find(device);
-    if (copy_resource_entry == copy_resources_.end())
+    // Get the screenshot resources for the device.
+    auto device_entry = device_resources_.find(device);
+    if (device_entry == device_resources_.end())
     {
-        VkCommandPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
-        create_info.pNext                   = nullptr;
-        create_info.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
-        create_info.queueFamilyIndex        = kDefaultQueueFamilyIndex;
-
-        VkCommandPool command_pool = VK_NULL_HANDLE;
-        result                     = device_table->CreateCommandPool(device, &create_info, nullptr, &command_pool);
+        DeviceResources device_resources;
+        result = CreateDeviceResources(device, device_table, allocator, &device_resources);
 
         if (result == VK_SUCCESS)
         {
-            CopyResource copy_resource = {};
-            copy_resource.command_pool = command_pool;
-            copy_resource.allocator    = allocator;
-
-            auto pair           = copy_resources_.emplace(device, std::move(copy_resource));
-            copy_resource_entry = pair.first;
+            device_entry = device_resources_.emplace(device, std::move(device_resources)).first;
         }
     }
 
     if (result == VK_SUCCESS)
     {
-        auto&   copy_resource = copy_resource_entry->second;
-        auto    copy_format   = GetConversionFormat(format);
-        VkQueue queue         = VK_NULL_HANDLE;
+        auto&   device_resources = device_entry->second;
+        auto    copy_format      = GetConversionFormat(format);
+        VkQueue queue            = VK_NULL_HANDLE;
+
+        // Get the next copy resource, whose staging buffer may still be in use by the encoding of an earlier
+        // screenshot.
+        auto& copy_resource = device_resources.copy_resources[device_resources.next_copy_resource];
+        device_resources.next_copy_resource = (device_resources.next_copy_resource + 1) % kCopyResourceCount;
+
+        WaitCopyResource(&copy_resource);
 
         // Get a queue.
         queue = GetDeviceQueue(device_table, device_info, kDefaultQueueFamilyIndex, kDefaultQueueIndex);
@@ -168,25 +182,16 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
         if (result == VK_SUCCESS)
         {
-            // Get a command buffer.
-            VkCommandBuffer command_buffer = VK_NULL_HANDLE;
+            // The command pool was created with the reset command buffer flag, so beginning the command buffer resets
+            // the commands recorded for the previous use of the copy resource.
+            VkCommandBuffer command_buffer = copy_resource.command_buffer;
 
-            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
-            allocate_info.pNext                       = nullptr;
-            allocate_info.commandPool                 = copy_resource.command_pool;
-            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-            allocate_info.commandBufferCount          = 1;
+            VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+            begin_info.pNext                    = nullptr;
+            begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            begin_info.pInheritanceInfo         = nullptr;
 
-            result = device_table->AllocateCommandBuffers(device, &allocate_info, &command_buffer);
-            if (result == VK_SUCCESS)
-            {
-                VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-                begin_info.pNext                    = nullptr;
-                begin_info.flags                    = 0;
-                begin_info.pInheritanceInfo         = nullptr;
-
-                result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
-            }
+            result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
 
             if (result == VK_SUCCESS)
             {
@@ -344,6 +349,11 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                 // submissions.
                 result = device_table->DeviceWaitIdle(device);
 
+                if (result == VK_SUCCESS)
+                {
+                    result = device_table->ResetFences(device, 1, &copy_resource.fence);
+                }
+
                 if (result == VK_SUCCESS)
                 {
                     VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
@@ -355,51 +365,27 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                     submit_info.signalSemaphoreCount = 0;
                     submit_info.pSignalSemaphores    = nullptr;
 
-                    result = device_table->QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
+                    result = device_table->QueueSubmit(queue, 1, &submit_info, copy_resource.fence);
                 }
 
                 if (result == VK_SUCCESS)
                 {
-                    result = device_table->QueueWaitIdle(queue);
+                    // The copy must complete before returning.  The image is presented or used again by the work
+                    // that follows, and that work does not wait on the copy: a present only waits on the
+                    // application's semaphores, and submission order does not order a present after the copy.
+                    result = device_table->WaitForFences(
+                        device, 1, &copy_resource.fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
                 }
 
                 if (result == VK_SUCCESS)
                 {
-                    void* data = nullptr;
-                    result     = allocator->MapResourceMemoryDirect(
-                        copy_resource.buffer_size, 0, &data, copy_resource.buffer_data);
-
-                    if (result == VK_SUCCESS)
-                    {
-                        if ((copy_resource.memory_property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) !=
-                            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
-                        {
-                            VkMappedMemoryRange invalidate_range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
-                            invalidate_range.pNext               = nullptr;
-                            invalidate_range.memory              = copy_resource.buffer_memory;
-                            invalidate_range.offset              = 0;
-                            invalidate_range.size                = copy_resource.buffer_size;
-
-                            allocator->InvalidateMappedMemoryRangesDirect(
-                                1, &invalidate_range, &copy_resource.buffer_memory_data);
-                        }
-
-                        WriteImageFile(filename_prefix,
-                                       screenshot_format_,
-                                       copy_width,
-                                       copy_height,
-                                       copy_resource.buffer_size,
-                                       data);
-
-                        allocator->UnmapResourceMemoryDirect(copy_resource.buffer_data);
-                    }
+                    // Only the image file encoding continues while replay proceeds.
+                    CompleteCopy(filename_prefix, &copy_resource);
                 }
                 else
                 {
                     GFXRECON_LOG_ERROR("Screenshot could not be created: failed to execute image transfer");
                 }
-
-                device_table->FreeCommandBuffers(device, copy_resource.command_pool, 1, &command_buffer);
             }
         }
         else
@@ -411,19 +397,141 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
 void ScreenshotHandler::DestroyDeviceResources(VkDevice device, const encode::VulkanDeviceTable* device_table)
 {
-    auto entry = copy_resources_.find(device);
-    if (entry != copy_resources_.end())
+    auto entry = device_resources_.find(device);
+    if (entry != device_resources_.end())
     {
-        auto& copy_resource = entry->second;
+        auto& device_resources = entry->second;
+
+        for (auto& copy_resource : device_resources.copy_resources)
+        {
+            WaitCopyResource(&copy_resource);
+
+            if (device_table != nullptr)
+            {
+                device_table->DestroyFence(device, copy_resource.fence, nullptr);
+            }
+
+            DestroyCopyResource(device, &copy_resource);
+        }
 
         if (device_table != nullptr)
         {
-            device_table->DestroyCommandPool(entry->first, copy_resource.command_pool, nullptr);
+            // Destroying the command pool frees the command buffers of the copy resources.
+            device_table->DestroyCommandPool(device, device_resources.command_pool, nullptr);
         }
 
-        DestroyCopyResource(device, &copy_resource);
+        device_resources_.erase(entry);
+    }
+}
+
+size_t ScreenshotHandler::GetEncodeThreadCount()
+{
+    // Leave a hardware thread for replay.  Each encoding reads from the staging buffer of a copy resource, so there is
+    // no use for more threads than copy resources.
+    size_t thread_count = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    return std::min(thread_count, kCopyResourceCount);
+}
 
-        copy_resources_.erase(entry);
+VkResult ScreenshotHandler::CreateDeviceResources(VkDevice                         device,
+                                                  const encode::VulkanDeviceTable* device_table,
+                                                  VulkanResourceAllocator*         allocator,
+                                                  DeviceResources*                 device_resources) const
+{
+    assert((device_table != nullptr) && (device_resources != nullptr));
+
+    VkCommandPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    create_info.pNext                   = nullptr;
+    create_info.flags =
+        VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    create_info.queueFamilyIndex = kDefaultQueueFamilyIndex;
+
+    VkResult result = device_table->CreateCommandPool(device, &create_info, nullptr, &device_resources->command_pool);
+
+    if (result == VK_SUCCESS)
+    {
+        device_resources->copy_resources.resize(kCopyResourceCount);
+
+        for (auto& copy_resource : device_resources->copy_resources)
+        {
+            copy_resource.allocator   = allocator;
+            copy_resource.encode_task = std::make_unique<util::ThreadPool::TaskCounter>();
+
+            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+            allocate_info.pNext                       = nullptr;
+            allocate_info.commandPool                 = device_resources->command_pool;
+            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocate_info.commandBufferCount          = 1;
+
+            result = device_table->AllocateCommandBuffers(device, &allocate_info, &copy_resource.command_buffer);
+
+            if (result == VK_SUCCESS)
+            {
+                VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+                fence_create_info.pNext             = nullptr;
+                fence_create_info.flags             = 0;
+
+                result = device_table->CreateFence(device, &fence_create_info, nullptr, &copy_resource.fence);
+            }
+
+            if (result != VK_SUCCESS)
+            {
+                break;
+            }
+        }
+
+        if (result != VK_SUCCESS)
+        {
+            for (auto& copy_resource : device_resources->copy_resources)
+            {
+                if (copy_resource.fence != VK_NULL_HANDLE)
+                {
+                    device_table->DestroyFence(device, copy_resource.fence, nullptr);
+                }
+            }
+
+            device_table->DestroyCommandPool(device, device_resources->command_pool, nullptr);
+        }
+    }
+
+    return result;
+}
+
+void ScreenshotHandler::CompleteCopy(const std::string& filename_prefix, CopyResource* copy_resource)
+{
+    if ((copy_resource->memory_property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) !=
+        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+    {
+        VkMappedMemoryRange invalidate_range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+        invalidate_range.pNext               = nullptr;
+        invalidate_range.memory              = copy_resource->buffer_memory;
+        invalidate_range.offset              = 0;
+        invalidate_range.size                = copy_resource->buffer_size;
+
+        copy_resource->allocator->InvalidateMappedMemoryRangesDirect(
+            1, &invalidate_range, &copy_resource->buffer_memory_data);
+    }
+
+    // The image file is encoded from the mapped staging buffer, which is not written again until the copy resource is
+    // reused after the encoding completes.
+    util::ThreadPool::TaskCounter* encode_task = copy_resource->encode_task.get();
+    encode_task->add();
+    encode_workers_.post_detached([filename    = filename_prefix,
+                                   file_format = screenshot_format_,
+                                   width       = copy_resource->width,
+                                   height      = copy_resource->height,
+                                   size        = copy_resource->buffer_size,
+                                   data        = copy_resource->mapped_data,
+                                   encode_task]() {
+        WriteImageFile(filename, file_format, width, height, size, data);
+        encode_task->done();
+    });
+}
+
+void ScreenshotHandler::WaitCopyResource(CopyResource* copy_resource)
+{
+    if (copy_resource->encode_task != nullptr)
+    {
+        copy_resource->encode_task->wait();
     }
 }
 
@@ -664,6 +772,13 @@ VkResult ScreenshotHandler::CreateCopyResource(VkDevice
         }
     }
 
+    if (result == VK_SUCCESS)
+    {
+        // The staging buffer stays mapped for the lifetime of the copy resource.
+        result =
+            allocator->MapResourceMemoryDirect(buffer_size, 0, &copy_resource->mapped_data, copy_resource->buffer_data);
+    }
+
     if (result == VK_SUCCESS)
     {
         // Resource creation succeeded.
@@ -684,6 +799,12 @@ void ScreenshotHandler::DestroyCopyResource(VkDevice device, CopyResource* copy_
 {
     if (copy_resource != nullptr)
     {
+        if (copy_resource->mapped_data != nullptr)
+        {
+            copy_resource->allocator->UnmapResourceMemoryDirect(copy_resource->buffer_data);
+            copy_resource->mapped_data = nullptr;
+        }
+
         if (copy_resource->buffer != VK_NULL_HANDLE)
         {
             copy_resource->allocator->DestroyBufferDirect(copy_resource->buffer, nullptr, copy_resource->buffer_data);
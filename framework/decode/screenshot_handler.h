@@ -29,10 +29,12 @@
 #include "decode/vulkan_resource_allocator.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "util/defines.h"
+#include "util/threadpool.h"
 
 #include "vulkan/vulkan.h"
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -45,13 +47,18 @@ class ScreenshotHandler : public ScreenshotHandlerBase
 {
   public:
     ScreenshotHandler(util::ScreenshotFormat screenshot_format, const std::vector<ScreenshotRange>& screenshot_ranges) :
-        ScreenshotHandlerBase(screenshot_format, screenshot_ranges)
+        ScreenshotHandlerBase(screenshot_format, screenshot_ranges), encode_workers_(GetEncodeThreadCount())
     {}
 
     ScreenshotHandler(util::ScreenshotFormat screenshot_format, std::vector<ScreenshotRange>&& screenshot_ranges) :
-        ScreenshotHandlerBase(screenshot_format, screenshot_ranges)
+        ScreenshotHandlerBase(screenshot_format, screenshot_ranges), encode_workers_(GetEncodeThreadCount())
     {}
 
+    ~ScreenshotHandler();
+
+    // Copies the image to a staging buffer and waits for the copy to complete, then encodes and writes the image file
+    // on a worker thread.
+
     void WriteImage(const std::string&                      filename_prefix,
                     const DeviceInfo*                       device_info,
                     const encode::VulkanDeviceTable*        device_table,
@@ -65,13 +72,19 @@ class ScreenshotHandler : public ScreenshotHandlerBase
                     uint32_t                                copy_height,
                     VkImageLayout                           image_layout);
 
+    // Completes the pending screenshots of the device and destroys its screenshot resources.
     void DestroyDeviceResources(VkDevice device, const encode::VulkanDeviceTable* device_table);
 
   private:
+    // Number of copy resources for each device.  Copy resources are used in turn, and replay only waits for an image
+    // file encoding when it reuses a copy resource whose encoding has not completed.
+    static constexpr size_t kCopyResourceCount = 3;
+
     struct CopyResource
     {
-        VkCommandPool                         command_pool{ VK_NULL_HANDLE };
         VulkanResourceAllocator*              allocator{ nullptr };
+        VkCommandBuffer                       command_buffer{ VK_NULL_HANDLE };
+        VkFence                               fence{ VK_NULL_HANDLE };
         VkDeviceSize                          buffer_size{ 0 };
         VkDeviceMemory                        buffer_memory{ VK_NULL_HANDLE };
         VkBuffer                              buffer{ VK_NULL_HANDLE };
@@ -85,11 +98,35 @@ class ScreenshotHandler : public ScreenshotHandlerBase
         uint32_t                              width{ 0 };
         uint32_t                              height{ 0 };
         VkMemoryPropertyFlags                 memory_property_flags{ 0 };
+        void*                                 mapped_data{ nullptr };
+
+        // Counts the pending image file encoding, which reads from mapped_data.
+        std::unique_ptr<util::ThreadPool::TaskCounter> encode_task;
+    };
+
+    struct DeviceResources
+    {
+        VkCommandPool             command_pool{ VK_NULL_HANDLE };
+        std::vector<CopyResource> copy_resources;
+        size_t                    next_copy_resource{ 0 };
     };
 
-    typedef std::unordered_map<VkDevice, CopyResource> CommandPools;
+    typedef std::unordered_map<VkDevice, DeviceResources> DeviceResourceMap;
 
   private:
+    static size_t GetEncodeThreadCount();
+
+    VkResult CreateDeviceResources(VkDevice                         device,
+                                   const encode::VulkanDeviceTable* device_table,
+                                   VulkanResourceAllocator*         allocator,
+                                   DeviceResources*                 device_resources) const;
+
+    // Makes the copied image visible to the host and posts its image file encoding to a worker thread.
+    void CompleteCopy(const std::string& filename_prefix, CopyResource* copy_resource);
+
+    // Waits for the image file encoding of the copy resource to complete, so that the copy resource can be reused.
+    void WaitCopyResource(CopyResource* copy_resource);
+
     bool IsSrgbFormat(VkFormat image_format) const;
 
     VkFormat GetConversionFormat(VkFormat image_format) const;
@@ -119,7 +156,8 @@ class ScreenshotHandler : public ScreenshotHandlerBase
     void DestroyCopyResource(VkDevice device, CopyResource* copy_resource) const;
 
   private:
-    CommandPools copy_resources_;
+    DeviceResourceMap device_resources_;
+    util::ThreadPool  encode_workers_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -0,0 +1,200 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/call_columns_decoder.h"
+#include "decode/column_table.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+static const std::vector<ColumnTable::Column> kColumns = {
+    { "index", ColumnTable::ColumnType::kUInt64, ColumnTable::ColumnEncoding::kDelta },
+    { "frame", ColumnTable::ColumnType::kUInt32, ColumnTable::ColumnEncoding::kDelta },
+    { "call_id", ColumnTable::ColumnType::kUInt32, ColumnTable::ColumnEncoding::kPlain },
+    { "arg", ColumnTable::ColumnType::kInt64, ColumnTable::ColumnEncoding::kPlain },
+    { "unset", ColumnTable::ColumnType::kUInt64, ColumnTable::ColumnEncoding::kPlain }
+};
+
+static void CheckRoundTrip(format::CompressionType compression_type)
+{
+    const std::string filename   = "column_table_test.gfxrcols";
+    const uint32_t    row_count  = 2500;
+    const uint32_t    group_size = 1000;
+
+    ColumnTableWriter writer;
+    REQUIRE(writer.Open(filename, kColumns, compression_type, group_size));
+
+    for (uint32_t i = 0; i < row_count; ++i)
+    {
+        writer.SetValue(0, 1000000000000ull + i * 3);
+        writer.SetValue(1, i / 100);
+        writer.SetValue(2, 0x1000 + (i % 7));
+        writer.SetValue(3, static_cast<uint64_t>(-static_cast<int64_t>(i)));
+        writer.EndRow();
+    }
+
+    REQUIRE(writer.GetRowCount() == row_count);
+    REQUIRE(writer.Close());
+
+    ColumnTableReader reader;
+    REQUIRE(reader.Open(filename));
+    REQUIRE(reader.GetRowCount() == row_count);
+    REQUIRE(reader.GetRowGroupCount() == 3);
+    REQUIRE(reader.GetColumns().size() == kColumns.size());
+    REQUIRE(reader.GetColumns()[1].name == "frame");
+    REQUIRE(reader.FindColumn("call_id") == 2);
+    REQUIRE(reader.FindColumn("missing") == -1);
+
+    std::vector<uint64_t> values;
+    uint32_t              row = 0;
+
+    for (size_t group = 0; group < reader.GetRowGroupCount(); ++group)
+    {
+        // Read the columns out of order, to check that each chunk is located independently.
+        REQUIRE(reader.ReadColumn(group, 3, &values));
+        const size_t group_rows = values.size();
+        for (size_t i = 0; i < group_rows; ++i)
+        {
+            REQUIRE(static_cast<int64_t>(values[i]) == -static_cast<int64_t>(row + i));
+        }
+
+        REQUIRE(reader.ReadColumn(group, 0, &values));
+        REQUIRE(values.size() == group_rows);
+        REQUIRE(values.front() == 1000000000000ull + row * 3);
+        REQUIRE(values.back() == 1000000000000ull + (row + group_rows - 1) * 3);
+
+        REQUIRE(reader.ReadColumn(group, 1, &values));
+        REQUIRE(values.back() == (row + group_rows - 1) / 100);
+
+        REQUIRE(reader.ReadColumn(group, 2, &values));
+        REQUIRE(values[1] == 0x1000 + ((row + 1) % 7));
+
+        REQUIRE(reader.ReadColumn(group, 4, &values));
+        REQUIRE(values == std::vector<uint64_t>(group_rows, 0));
+
+        row += static_cast<uint32_t>(group_rows);
+    }
+
+    REQUIRE(row == row_count);
+
+    reader.Close();
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("ColumnTableWriter output is read back by ColumnTableReader", "[column_table]")
+{
+    SECTION("Uncompressed")
+    {
+        CheckRoundTrip(format::CompressionType::kNone);
+    }
+
+    // Compression types that are not enabled in the build fall back to uncompressed chunks.
+    SECTION("LZ4")
+    {
+        CheckRoundTrip(format::CompressionType::kLz4);
+    }
+
+    SECTION("Zstandard")
+    {
+        CheckRoundTrip(format::CompressionType::kZstd);
+    }
+
+    SECTION("zlib")
+    {
+        CheckRoundTrip(format::CompressionType::kZlib);
+    }
+}
+
+TEST_CASE("CallColumnsDecoder writes the call fields and key parameters", "[column_table]")
+{
+    const std::string filename = "call_columns_test.gfxrcols";
+
+    ColumnTableWriter writer;
+    REQUIRE(writer.Open(filename, CallColumnsDecoder::GetColumns(), format::CompressionType::kNone));
+
+    CallColumnsDecoder decoder(&writer);
+    ApiCallInfo        call_info;
+
+    // vkCmdDrawIndexed(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance)
+    struct
+    {
+        format::HandleId command_buffer;
+        uint32_t         index_count;
+        uint32_t         instance_count;
+        uint32_t         first_index;
+        int32_t          vertex_offset;
+        uint32_t         first_instance;
+    } draw_parameters = { 0x1234, 36, 2, 6, -3, 1 };
+
+    uint8_t draw_buffer[sizeof(format::HandleId) + 5 * sizeof(uint32_t)];
+    memcpy(draw_buffer, &draw_parameters.command_buffer, sizeof(format::HandleId));
+    memcpy(draw_buffer + sizeof(format::HandleId), &draw_parameters.index_count, 5 * sizeof(uint32_t));
+
+    call_info.index     = 7;
+    call_info.thread_id = 3;
+    decoder.SetFrameNumber(2);
+    decoder.DecodeFunctionCall(
+        format::ApiCallId::ApiCall_vkCmdDrawIndexed, call_info, draw_buffer, sizeof(draw_buffer));
+
+    // A truncated parameter buffer leaves the missing parameters as 0.
+    call_info.index = 8;
+    decoder.DecodeMethodCall(
+        format::ApiCallId::ApiCall_ID3D12GraphicsCommandList_DrawInstanced, 0x99, call_info, draw_buffer, 8);
+
+    REQUIRE(writer.Close());
+
+    ColumnTableReader reader;
+    REQUIRE(reader.Open(filename));
+    REQUIRE(reader.GetRowCount() == 2);
+
+    std::vector<uint64_t> values;
+    REQUIRE(reader.ReadColumn(0, CallColumnsDecoder::kColumnIndex, &values));
+    REQUIRE(values == std::vector<uint64_t>{ 7, 8 });
+    REQUIRE(reader.ReadColumn(0, CallColumnsDecoder::kColumnFrame, &values));
+    REQUIRE(values == std::vector<uint64_t>{ 2, 2 });
+    REQUIRE(reader.ReadColumn(0, CallColumnsDecoder::kColumnCallId, &values));
+    REQUIRE(values[0] == format::ApiCallId::ApiCall_vkCmdDrawIndexed);
+    REQUIRE(reader.ReadColumn(0, CallColumnsDecoder::kColumnObjectId, &values));
+    REQUIRE(values == std::vector<uint64_t>{ 0x1234, 0x99 });
+    REQUIRE(reader.ReadColumn(0, CallColumnsDecoder::kColumnArg0, &values));
+    REQUIRE(values == std::vector<uint64_t>{ 36, 0x1234 });
+    REQUIRE(reader.ReadColumn(0, CallColumnsDecoder::kColumnArg0 + 3, &values));
+    REQUIRE(static_cast<int64_t>(values[0]) == -3);
+    REQUIRE(values[1] == 0);
+
+    reader.Close();
+    std::remove(filename.c_str());
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
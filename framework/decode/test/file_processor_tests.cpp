@@ -0,0 +1,520 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "decode/call_columns_decoder.h"
+#include "decode/file_processor.h"
+#include "decode/preload_file_processor.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/compressor.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+class CaptureFileBuilder
+{
+  public:
+    void WriteFileHeader(format::CompressionType compression_type)
+    {
+        format::FileHeader     file_header{ GFXRECON_FOURCC, 0, 1, 1 };
+        format::FileOptionPair option{ format::FileOption::kCompressionType, static_cast<uint32_t>(compression_type) };
+        Write(&file_header, sizeof(file_header));
+        Write(&option, sizeof(option));
+    }
+
+    void WriteCall(const std::vector<uint8_t>& parameters,
+                   format::ApiCallId           call_id = format::ApiCallId::ApiCall_vkCmdDraw)
+    {
+        format::FunctionCallHeader header{};
+        header.block_header.type = format::BlockType::kFunctionCallBlock;
+        header.block_header.size = (sizeof(header) - sizeof(header.block_header)) + parameters.size();
+        header.api_call_id       = call_id;
+        Write(&header, sizeof(header));
+        Write(parameters.data(), parameters.size());
+    }
+
+    void WriteCompressedCall(util::Compressor* compressor, const std::vector<uint8_t>& parameters)
+    {
+        std::vector<uint8_t> compressed;
+        size_t compressed_size = compressor->Compress(parameters.size(), parameters.data(), &compressed, 0);
+        REQUIRE(compressed_size > 0);
+
+        format::CompressedFunctionCallHeader header{};
+        header.block_header.type = format::BlockType::kCompressedFunctionCallBlock;
+        header.block_header.size = (sizeof(header) - sizeof(header.block_header)) + compressed_size;
+        header.api_call_id       = format::ApiCallId::ApiCall_vkCmdDraw;
+        header.uncompressed_size = parameters.size();
+        Write(&header, sizeof(header));
+        Write(compressed.data(), compressed_size);
+    }
+
+    void WriteCompressedFillMemory(util::Compressor* compressor, uint64_t memory_id, const std::vector<uint8_t>& data)
+    {
+        std::vector<uint8_t> compressed;
+        size_t               compressed_size = compressor->Compress(data.size(), data.data(), &compressed, 0);
+        REQUIRE(compressed_size > 0);
+        REQUIRE(compressed_size < data.size());
+
+        format::FillMemoryCommandHeader header{};
+        header.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) + compressed_size;
+        header.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kFillMemoryCommand);
+        header.memory_id   = memory_id;
+        header.memory_size = data.size();
+        Write(&header, sizeof(header));
+        Write(compressed.data(), compressed_size);
+    }
+
+    void WriteDictionary(const std::vector<uint8_t>& dictionary)
+    {
+        format::SetCompressionDictionaryCommandHeader header{};
+        header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) + dictionary.size();
+        header.meta_header.meta_data_id      = format::MakeMetaDataId(
+            format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kSetCompressionDictionaryCommand);
+        header.dictionary_size = dictionary.size();
+        Write(&header, sizeof(header));
+        Write(dictionary.data(), dictionary.size());
+    }
+
+    void WriteFrameEnd(uint64_t frame_number)
+    {
+        format::Marker marker{};
+        marker.header.type  = format::BlockType::kFrameMarkerBlock;
+        marker.header.size  = sizeof(marker) - sizeof(marker.header);
+        marker.marker_type  = format::MarkerType::kEndMarker;
+        marker.frame_number = frame_number;
+        Write(&marker, sizeof(marker));
+    }
+
+    size_t GetSize() const { return data_.size(); }
+
+    // Drops the end of the file, to produce a capture file that ends in the middle of a block.
+    void Truncate(size_t size) { data_.resize(size); }
+
+    bool Save(const std::string& filename) const
+    {
+        FILE* file = fopen(filename.c_str(), "wb");
+        bool  success =
+            (file != nullptr) && (fwrite(data_.data(), 1, data_.size(), file) == data_.size()) && (fclose(file) == 0);
+        return success;
+    }
+
+  private:
+    void Write(const void* data, size_t size)
+    {
+        data_.insert(data_.end(), static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+    }
+
+    std::vector<uint8_t> data_;
+};
+
+TEST_CASE("FileIndex is not loaded for a capture file that changed", "[file_processor]")
+{
+    const std::string filename       = "file_index_test.gfxr";
+    const std::string index_filename = FileIndex::GetIndexFilename(filename);
+
+    CaptureFileBuilder builder;
+    builder.WriteFileHeader(format::CompressionType::kNone);
+    builder.WriteFrameEnd(1);
+    builder.WriteFrameEnd(2);
+    REQUIRE(builder.Save(filename));
+
+    FileIndex file_index;
+    REQUIRE(file_index.Build(filename));
+    REQUIRE(file_index.Save(index_filename));
+    REQUIRE(file_index.Load(index_filename, filename));
+    REQUIRE(file_index.GetFrames().size() == 3);
+
+    // A capture file of the same size with different content must be indexed again.
+    CaptureFileBuilder changed_builder;
+    changed_builder.WriteFileHeader(format::CompressionType::kNone);
+    changed_builder.WriteFrameEnd(1);
+    changed_builder.WriteFrameEnd(3);
+    REQUIRE(changed_builder.Save(filename));
+
+    REQUIRE(!file_index.Load(index_filename, filename));
+    REQUIRE(file_index.IsEmpty());
+
+    std::remove(index_filename.c_str());
+    std::remove(filename.c_str());
+}
+
+// Keeps the parameter data of each function call.
+class ParameterRecorder : public CallColumnsDecoder
+{
+  public:
+    ParameterRecorder() : CallColumnsDecoder(nullptr) {}
+
+    virtual void DecodeFunctionCall(format::ApiCallId  id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     buffer,
+                                    size_t             buffer_size) override
+    {
+        calls.emplace_back(buffer, buffer + buffer_size);
+    }
+
+    std::vector<std::vector<uint8_t>> calls;
+};
+
+static std::vector<uint8_t> MakeParameters(uint8_t seed, size_t size)
+{
+    std::vector<uint8_t> parameters(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        parameters[i] = static_cast<uint8_t>((i * seed) ^ (i >> 3));
+    }
+
+    return parameters;
+}
+
+// Reads the capture file with buffered stream reads, as if the file could not be memory mapped.
+class UnmappedFileProcessor : public FileProcessor
+{
+  protected:
+    virtual bool OpenMemoryMappedFile(const std::string& filename) override { return false; }
+};
+
+// Processes a capture file and returns the parameter data of the function calls that were decoded.
+static std::vector<std::vector<uint8_t>> ProcessCaptureFile(FileProcessor&       file_processor,
+                                                            const std::string&   filename,
+                                                            bool                 expect_mapped,
+                                                            FileProcessor::Error expected_error)
+{
+    ParameterRecorder recorder;
+    REQUIRE(file_processor.Initialize(filename));
+    REQUIRE(file_processor.UsesMemoryMappedFile() == expect_mapped);
+    file_processor.AddDecoder(&recorder);
+
+    bool success = file_processor.ProcessAllFrames();
+    REQUIRE(success == (expected_error == FileProcessor::kErrorNone));
+    REQUIRE(file_processor.GetErrorState() == expected_error);
+    REQUIRE(file_processor.EntireFileWasProcessed());
+
+    return recorder.calls;
+}
+
+TEST_CASE("FileProcessor reads a block that ends at the end of the memory mapping", "[file_processor]")
+{
+    const std::string filename = "file_processor_mapping_end_test.gfxr";
+
+    std::vector<uint8_t> first_call  = MakeParameters(3, 512);
+    std::vector<uint8_t> second_call = MakeParameters(5, 4096);
+
+    CaptureFileBuilder builder;
+    builder.WriteFileHeader(format::CompressionType::kNone);
+    builder.WriteCall(first_call);
+    builder.WriteFrameEnd(1);
+    builder.WriteCall(second_call);
+    REQUIRE(builder.Save(filename));
+
+    FileProcessor mapped_processor;
+    auto          mapped_calls = ProcessCaptureFile(mapped_processor, filename, true, FileProcessor::kErrorNone);
+    REQUIRE(mapped_calls.size() == 2);
+    REQUIRE(mapped_calls[0] == first_call);
+    REQUIRE(mapped_calls[1] == second_call);
+
+    FileProcessor buffered_processor;
+    buffered_processor.SetUseMemoryMappedFile(false);
+    REQUIRE(ProcessCaptureFile(buffered_processor, filename, false, FileProcessor::kErrorNone) == mapped_calls);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("FileProcessor stops at a block that straddles the end of the memory mapping", "[file_processor]")
+{
+    const std::string filename = "file_processor_mapping_straddle_test.gfxr";
+
+    std::vector<uint8_t> first_call  = MakeParameters(3, 512);
+    std::vector<uint8_t> second_call = MakeParameters(5, 4096);
+
+    CaptureFileBuilder builder;
+    builder.WriteFileHeader(format::CompressionType::kNone);
+    builder.WriteCall(first_call);
+    builder.WriteFrameEnd(1);
+    builder.WriteCall(second_call);
+
+    // The header of the last block is complete, but its parameter data extends past the end of the file.  As with
+    // stream reads, an incomplete block at the end of the file is skipped without an error.
+    builder.Truncate(builder.GetSize() - 1);
+    REQUIRE(builder.Save(filename));
+
+    FileProcessor mapped_processor;
+    auto          mapped_calls = ProcessCaptureFile(mapped_processor, filename, true, FileProcessor::kErrorNone);
+    REQUIRE(mapped_calls.size() == 1);
+    REQUIRE(mapped_calls[0] == first_call);
+
+    FileProcessor buffered_processor;
+    buffered_processor.SetUseMemoryMappedFile(false);
+    REQUIRE(ProcessCaptureFile(buffered_processor, filename, false, FileProcessor::kErrorNone) == mapped_calls);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("FileProcessor stops at a truncated block header in a memory mapped file", "[file_processor]")
+{
+    const std::string filename = "file_processor_mapping_truncated_test.gfxr";
+
+    std::vector<uint8_t> first_call = MakeParameters(3, 512);
+
+    CaptureFileBuilder builder;
+    builder.WriteFileHeader(format::CompressionType::kNone);
+    builder.WriteCall(first_call);
+    size_t call_end = builder.GetSize();
+    builder.WriteCall(MakeParameters(5, 64));
+
+    // Leave only part of the block header and call ID of the second call.
+    builder.Truncate(call_end + sizeof(format::BlockHeader) + 2);
+    REQUIRE(builder.Save(filename));
+
+    FileProcessor mapped_processor;
+    auto          mapped_calls = ProcessCaptureFile(mapped_processor, filename, true, FileProcessor::kErrorNone);
+    REQUIRE(mapped_calls.size() == 1);
+    REQUIRE(mapped_calls[0] == first_call);
+
+    FileProcessor buffered_processor;
+    buffered_processor.SetUseMemoryMappedFile(false);
+    REQUIRE(ProcessCaptureFile(buffered_processor, filename, false, FileProcessor::kErrorNone) == mapped_calls);
+
+    // A file that ends inside the file header is rejected by both readers.
+    builder.Truncate(sizeof(format::FileHeader) / 2);
+    REQUIRE(builder.Save(filename));
+
+    FileProcessor truncated_mapped_processor;
+    REQUIRE(!truncated_mapped_processor.Initialize(filename));
+    REQUIRE(truncated_mapped_processor.GetErrorState() == FileProcessor::kErrorReadingFileHeader);
+    REQUIRE(!truncated_mapped_processor.UsesMemoryMappedFile());
+
+    FileProcessor truncated_buffered_processor;
+    truncated_buffered_processor.SetUseMemoryMappedFile(false);
+    REQUIRE(!truncated_buffered_processor.Initialize(filename));
+    REQUIRE(truncated_buffered_processor.GetErrorState() == FileProcessor::kErrorReadingFileHeader);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("FileProcessor falls back to buffered reads when the file cannot be memory mapped", "[file_processor]")
+{
+    const std::string filename = "file_processor_mapping_fallback_test.gfxr";
+
+    std::vector<uint8_t> first_call  = MakeParameters(3, 512);
+    std::vector<uint8_t> second_call = MakeParameters(5, 4096);
+
+    CaptureFileBuilder builder;
+    builder.WriteFileHeader(format::CompressionType::kNone);
+    builder.WriteCall(first_call);
+    builder.WriteFrameEnd(1);
+    builder.WriteCall(second_call);
+    builder.WriteFrameEnd(2);
+    REQUIRE(builder.Save(filename));
+
+    UnmappedFileProcessor unmapped_processor;
+    auto unmapped_calls = ProcessCaptureFile(unmapped_processor, filename, false, FileProcessor::kErrorNone);
+    REQUIRE(unmapped_calls.size() == 2);
+    REQUIRE(unmapped_calls[0] == first_call);
+    REQUIRE(unmapped_calls[1] == second_call);
+
+    // Seeking with the frame index also uses the stream.
+    UnmappedFileProcessor seek_processor;
+    ParameterRecorder     recorder;
+    REQUIRE(seek_processor.Initialize(filename));
+    REQUIRE(seek_processor.LoadFileIndex(false));
+    seek_processor.AddDecoder(&recorder);
+    REQUIRE(seek_processor.SeekToFrame(seek_processor.GetFileIndex()->GetFrames()[1].frame_number));
+    REQUIRE(seek_processor.ProcessNextFrame());
+    REQUIRE(recorder.calls.size() == 1);
+    REQUIRE(recorder.calls[0] == second_call);
+
+    std::remove(filename.c_str());
+}
+
+TEST_CASE("FileIndex finds frames after frame numbers restart at the first frame end marker", "[file_processor]")
+{
+    const std::string filename = "file_index_restart_test.gfxr";
+
+    // Three frames delimited by present calls, followed by two frames delimited by frame end markers.  The frame
+    // counter restarts at the first marker, so the frame start entries are numbered 0, 1, 2, 3, 1, 2.
+    CaptureFileBuilder builder;
+    builder.WriteFileHeader(format::CompressionType::kNone);
+    builder.WriteCall({}, format::ApiCallId::ApiCall_vkQueuePresentKHR);
+    builder.WriteCall({}, format::ApiCallId::ApiCall_vkQueuePresentKHR);
+    builder.WriteCall({}, format::ApiCallId::ApiCall_vkQueuePresentKHR);
+    builder.WriteFrameEnd(1);
+    builder.WriteFrameEnd(2);
+    REQUIRE(builder.Save(filename));
+
+    FileIndex file_index;
+    REQUIRE(file_index.Build(filename));
+
+    const auto& frames = file_index.GetFrames();
+    REQUIRE(frames.size() == 6);
+    REQUIRE(frames[3].frame_number == 3);
+    REQUIRE(frames[4].frame_number == 1);
+
+    REQUIRE(file_index.FindFrame(0) == &frames[0]);
+    REQUIRE(file_index.FindFrame(1) == &frames[4]);
+    REQUIRE(file_index.FindFrame(2) == &frames[5]);
+    REQUIRE(file_index.FindFrame(3) == &frames[3]);
+    REQUIRE(file_index.FindFrame(4) == nullptr);
+
+    // A loaded index must be searched the same way.
+    const std::string index_filename = FileIndex::GetIndexFilename(filename);
+    REQUIRE(file_index.Save(index_filename));
+
+    FileIndex loaded_index;
+    REQUIRE(loaded_index.Load(index_filename, filename));
+    REQUIRE(loaded_index.FindFrame(1) == &loaded_index.GetFrames()[4]);
+    REQUIRE(loaded_index.FindFrame(3) == &loaded_index.GetFrames()[3]);
+
+    std::remove(index_filename.c_str());
+    std::remove(filename.c_str());
+}
+
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+
+TEST_CASE("FileProcessor seeks across a compression dictionary", "[file_processor]")
+{
+    const std::string filename = "file_processor_dictionary_test.gfxr";
+
+    // A raw content dictionary, which the second call is compressed against.
+    std::vector<uint8_t>              dictionary  = MakeParameters(7, 2048);
+    std::vector<uint8_t>              first_call  = MakeParameters(3, 512);
+    std::vector<uint8_t>              second_call = MakeParameters(7, 1024);
+    std::unique_ptr<util::Compressor> compressor(format::CreateCompressor(format::CompressionType::kZstd));
+    std::unique_ptr<util::Compressor> dictionary_compressor(format::CreateCompressor(format::CompressionType::kZstd));
+    REQUIRE(dictionary_compressor->SetDictionary(dictionary.data(), dictionary.size()));
+
+    CaptureFileBuilder builder;
+    builder.WriteFileHeader(format::CompressionType::kZstd);
+    builder.WriteCompressedCall(compressor.get(), first_call);
+    builder.WriteFrameEnd(1);
+    builder.WriteDictionary(dictionary);
+    builder.WriteCompressedCall(dictionary_compressor.get(), second_call);
+    builder.WriteFrameEnd(2);
+    REQUIRE(builder.Save(filename));
+
+    {
+        ParameterRecorder recorder;
+        FileProcessor     file_processor;
+        REQUIRE(file_processor.Initialize(filename));
+        REQUIRE(file_processor.LoadFileIndex(false));
+        file_processor.AddDecoder(&recorder);
+
+        const auto& frames = file_processor.GetFileIndex()->GetFrames();
+        REQUIRE(frames.size() == 3);
+
+        // Seeking past the dictionary loads it; seeking back before it must release it again.
+        REQUIRE(file_processor.SeekToFrame(frames[1].frame_number));
+        REQUIRE(file_processor.ProcessNextFrame());
+        REQUIRE(file_processor.SeekToFrame(frames[0].frame_number));
+        REQUIRE(file_processor.ProcessNextFrame());
+        REQUIRE(file_processor.SeekToFrame(frames[1].frame_number));
+        REQUIRE(file_processor.ProcessNextFrame());
+
+        REQUIRE(recorder.calls.size() == 3);
+        REQUIRE(recorder.calls[0] == second_call);
+        REQUIRE(recorder.calls[1] == first_call);
+        REQUIRE(recorder.calls[2] == second_call);
+    }
+
+    std::remove(filename.c_str());
+}
+
+#endif // GFXRECON_ENABLE_ZSTD_COMPRESSION
+
+#if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION)
+
+// Also keeps the data of each fill memory command.
+class FillMemoryRecorder : public ParameterRecorder
+{
+  public:
+    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override
+    {
+        return format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryCommand;
+    }
+
+    virtual void DispatchFillMemoryCommand(
+        format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override
+    {
+        fills.emplace_back(data, data + size);
+    }
+
+    std::vector<std::vector<uint8_t>> fills;
+};
+
+TEST_CASE("PreloadFileProcessor replays compressed calls and fill memory commands", "[file_processor]")
+{
+    const std::string filename = "preload_file_processor_test.gfxr";
+
+    std::vector<uint8_t>              call        = MakeParameters(4, 2048);
+    std::vector<uint8_t>              fill_memory = MakeParameters(5, 4096);
+    std::unique_ptr<util::Compressor> compressor(format::CreateCompressor(format::CompressionType::kZlib));
+
+    CaptureFileBuilder builder;
+    builder.WriteFileHeader(format::CompressionType::kZlib);
+    builder.WriteCompressedFillMemory(compressor.get(), 1, fill_memory);
+    builder.WriteCompressedCall(compressor.get(), call);
+    builder.WriteFrameEnd(1);
+    builder.WriteFrameEnd(2);
+    REQUIRE(builder.Save(filename));
+
+    // Blocks that are decompressed while preloading must replay like blocks that are preloaded compressed.
+    for (bool preload_decompressed : { false, true })
+    {
+        FillMemoryRecorder   recorder;
+        PreloadFileProcessor file_processor(preload_decompressed);
+        REQUIRE(file_processor.Initialize(filename));
+        file_processor.AddDecoder(&recorder);
+
+        file_processor.PreloadNextFrames(2);
+        REQUIRE(recorder.calls.empty());
+        REQUIRE(recorder.fills.empty());
+
+        REQUIRE(file_processor.ProcessNextFrame());
+        REQUIRE(file_processor.GetErrorState() == FileProcessor::kErrorNone);
+
+        REQUIRE(recorder.calls.size() == 1);
+        REQUIRE(recorder.calls[0] == call);
+        REQUIRE(recorder.fills.size() == 1);
+        REQUIRE(recorder.fills[0] == fill_memory);
+    }
+
+    std::remove(filename.c_str());
+}
+
+#endif // GFXRECON_ENABLE_ZLIB_COMPRESSION
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
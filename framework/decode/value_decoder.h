@@ -26,6 +26,7 @@
 #define GFXRECON_DECODE_VALUE_DECODER_H
 
 #include "format/format.h"
+#include "format/varint.h"
 #include "util/defines.h"
 
 #include "vulkan/vulkan.h"
@@ -40,6 +41,20 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 class ValueDecoder
 {
   public:
+    // How values are stored when the capture file uses ParameterEncoding::kCompact.
+    enum class CompactType
+    {
+        kNone,         // Stored with the size of the encode type.
+        kVarint,       // Stored as a varint.
+        kHandleIdDelta // Stored as a varint, with array elements stored as zigzag deltas from the previous element.
+    };
+
+    // The parameter encoding of the capture file that is being decoded.  FileProcessor sets the encoding from the
+    // capture file options before decoding blocks on the current thread.
+    static format::ParameterEncoding GetParameterEncoding() { return parameter_encoding_; }
+
+    static void SetParameterEncoding(format::ParameterEncoding encoding) { parameter_encoding_ = encoding; }
+
     // clang-format off
 
     // Values
@@ -63,31 +78,31 @@ class ValueDecoder
     static size_t DecodeFloatValue(const uint8_t* buffer, size_t buffer_size, float* value)                         { return DecodeValue(buffer, buffer_size, value); }
     static size_t DecodeDoubleValue(const uint8_t* buffer, size_t buffer_size, double* value)                       { return DecodeValue(buffer, buffer_size, value); }
 
-    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, size_t* value)                        { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, size_t* value)                        { return DecodeCompactValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
 #if (defined(VK_USE_PLATFORM_XLIB_KHR) || defined(VK_USE_PLATFORM_XLIB_XRANDR_EXT)) && !defined(GFXRECON_ARCH64)
     // Oveload for the 32-bit XID type.  Pointers from the 32-bit XID typedef of unsigned long are not compatible with size_t pointers.
-    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, unsigned long* value)                 { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, unsigned long* value)                 { return DecodeCompactValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
 #elif defined(WIN32)
 #if !defined(GFXRECON_ARCH64)
     // Oveload for 32-bit WIN32 SIZE_T type.  Pointers from the unsigned long typedef of are not compatible with size_t pointers.
-    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, SIZE_T* value)                        { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, SIZE_T* value)                        { return DecodeCompactValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
 #endif
     // Oveload for WIN32 LONG_PTR type.  Pointers from the LONG_PTR typedef of __int64 / long are not compatible with size_t pointers.
-    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, LONG_PTR* value)                      { return DecodeValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeSizeTValue(const uint8_t* buffer, size_t buffer_size, LONG_PTR* value)                      { return DecodeCompactValueFrom<format::SizeTEncodeType>(buffer, buffer_size, value); }
 #endif
 
     // Treat pointers to non-Vulkan objects as 64-bit object IDs.
-    static size_t DecodeAddress(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                         { return DecodeValueFrom<format::AddressEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeAddress(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                         { return DecodeCompactValueFrom<format::AddressEncodeType>(buffer, buffer_size, value); }
     static size_t DecodeVoidPtr(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                         { return DecodeAddress(buffer, buffer_size, value); }
     static size_t DecodeFunctionPtr(const uint8_t* buffer, size_t buffer_size, uint64_t* value)                     { return DecodeAddress(buffer, buffer_size, value); }
 
-    static size_t DecodeHandleIdValue(const uint8_t* buffer, size_t buffer_size, format::HandleId* value)           { return DecodeValueFrom<format::HandleEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeHandleIdValue(const uint8_t* buffer, size_t buffer_size, format::HandleId* value)           { return DecodeCompactValueFrom<format::HandleEncodeType>(buffer, buffer_size, value); }
     template<typename T>
-    static size_t DecodeEnumValue(const uint8_t* buffer, size_t buffer_size, T* value)                              { return DecodeValueFrom<format::EnumEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeEnumValue(const uint8_t* buffer, size_t buffer_size, T* value)                              { return DecodeCompactValueFrom<format::EnumEncodeType>(buffer, buffer_size, value); }
     template<typename T>
-    static size_t DecodeFlagsValue(const uint8_t* buffer, size_t buffer_size, T* value)                             { return DecodeValueFrom<format::FlagsEncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeFlagsValue(const uint8_t* buffer, size_t buffer_size, T* value)                             { return DecodeCompactValueFrom<format::FlagsEncodeType>(buffer, buffer_size, value); }
     template<typename T>
-    static size_t DecodeFlags64Value(const uint8_t* buffer, size_t buffer_size, T* value)                           { return DecodeValueFrom<format::Flags64EncodeType>(buffer, buffer_size, value); }
+    static size_t DecodeFlags64Value(const uint8_t* buffer, size_t buffer_size, T* value)                           { return DecodeCompactValueFrom<format::Flags64EncodeType>(buffer, buffer_size, value); }
 
     // Arrays
     static size_t DecodeCharArray(const uint8_t* buffer, size_t buffer_size, char* arr, size_t len)                 { return DecodeArray(buffer, buffer_size, arr, len); }
@@ -96,18 +111,18 @@ class ValueDecoder
     static size_t DecodeInt64Array(const uint8_t* buffer, size_t buffer_size, int64_t* arr, size_t len)             { return DecodeArray(buffer, buffer_size, arr, len); }
     static size_t DecodeUInt64Array(const uint8_t* buffer, size_t buffer_size, uint64_t* arr, size_t len)           { return DecodeArray(buffer, buffer_size, arr, len); }
     static size_t DecodeFloatArray(const uint8_t* buffer, size_t buffer_size, float* arr, size_t len)               { return DecodeArray(buffer, buffer_size, arr, len); }
-    static size_t DecodeSizeTArray(const uint8_t* buffer, size_t buffer_size, size_t* arr, size_t len)              { return DecodeArrayFrom<format::SizeTEncodeType>(buffer, buffer_size, arr, len); }
+    static size_t DecodeSizeTArray(const uint8_t* buffer, size_t buffer_size, size_t* arr, size_t len)              { return DecodeArrayAs<format::SizeTEncodeType, CompactType::kVarint>(buffer, buffer_size, arr, len); }
 
     static size_t DecodeUInt8Array(const uint8_t* buffer, size_t buffer_size, void* arr, size_t len)                { return DecodeArray(buffer, buffer_size, reinterpret_cast<uint8_t*>(arr), len); }
     static size_t DecodeVoidArray(const uint8_t* buffer, size_t buffer_size, void* arr, size_t len)                 { return DecodeArray(buffer, buffer_size, reinterpret_cast<uint8_t*>(arr), len); }
 
-    static size_t DecodeHandleIdArray(const uint8_t* buffer, size_t buffer_size, format::HandleId* arr, size_t len) { return DecodeArrayFrom<format::HandleEncodeType>(buffer, buffer_size, arr, len); }
+    static size_t DecodeHandleIdArray(const uint8_t* buffer, size_t buffer_size, format::HandleId* arr, size_t len) { return DecodeArrayAs<format::HandleEncodeType, CompactType::kHandleIdDelta>(buffer, buffer_size, arr, len); }
     template<typename T>
-    static size_t DecodeEnumArray(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                    { return DecodeArrayFrom<format::EnumEncodeType>(buffer, buffer_size, arr, len); }
+    static size_t DecodeEnumArray(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                    { return DecodeArrayAs<format::EnumEncodeType, CompactType::kVarint>(buffer, buffer_size, arr, len); }
     template<typename T>
-    static size_t DecodeFlagsArray(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                   { return DecodeArrayFrom<format::FlagsEncodeType>(buffer, buffer_size, arr, len); }
+    static size_t DecodeFlagsArray(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                   { return DecodeArrayAs<format::FlagsEncodeType, CompactType::kVarint>(buffer, buffer_size, arr, len); }
     template<typename T>
-    static size_t DecodeFlags64Array(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                 { return DecodeArrayFrom<format::Flags64EncodeType>(buffer, buffer_size, arr, len); }
+    static size_t DecodeFlags64Array(const uint8_t* buffer, size_t buffer_size, T* arr, size_t len)                 { return DecodeArrayAs<format::Flags64EncodeType, CompactType::kVarint>(buffer, buffer_size, arr, len); }
 
     // clang-format on
 
@@ -144,6 +159,65 @@ class ValueDecoder
         return DecodeArray(buffer, buffer_size, arr, len);
     }
 
+    // Decode an array of values that were encoded as SrcT with ParameterEncoding::kFixedSize, or as Compact with
+    // ParameterEncoding::kCompact.
+    template <typename SrcT, CompactType Compact, typename DstT>
+    static size_t DecodeArrayAs(const uint8_t* buffer, size_t buffer_size, DstT* arr, size_t len)
+    {
+        if ((Compact == CompactType::kNone) || (parameter_encoding_ != format::ParameterEncoding::kCompact))
+        {
+            return DecodeArrayFrom<SrcT>(buffer, buffer_size, arr, len);
+        }
+
+        assert(arr != nullptr);
+
+        size_t   bytes_read = 0;
+        uint64_t previous   = 0;
+
+        for (size_t i = 0; i < len; ++i)
+        {
+            uint64_t value       = 0;
+            size_t   value_bytes = format::LoadVarint((buffer + bytes_read), (buffer_size - bytes_read), &value);
+
+            if (value_bytes == 0)
+            {
+                return 0;
+            }
+
+            if (Compact == CompactType::kHandleIdDelta)
+            {
+                value    = previous + static_cast<uint64_t>(format::ZigZagDecode(value));
+                previous = value;
+            }
+
+            bytes_read += value_bytes;
+            arr[i] = TypeCast<DstT>(static_cast<SrcT>(value));
+        }
+
+        return bytes_read;
+    }
+
+    // Get the size of an encoded array of len values that were encoded as described for DecodeArrayAs(), without
+    // decoding the values.
+    template <typename SrcT, CompactType Compact>
+    static size_t GetEncodedArraySize(const uint8_t* buffer, size_t buffer_size, size_t len)
+    {
+        if ((Compact == CompactType::kNone) || (parameter_encoding_ != format::ParameterEncoding::kCompact))
+        {
+            return len * sizeof(SrcT);
+        }
+
+        size_t bytes_read = 0;
+
+        for (size_t i = 0; (i < len) && (bytes_read < buffer_size); ++i)
+        {
+            uint64_t value = 0;
+            bytes_read += format::LoadVarint((buffer + bytes_read), (buffer_size - bytes_read), &value);
+        }
+
+        return bytes_read;
+    }
+
   private:
     template <typename DstT, typename SrcT>
     static typename std::enable_if<!std::is_pointer<SrcT>::value && !std::is_pointer<DstT>::value, DstT>::type
@@ -176,6 +250,27 @@ class ValueDecoder
         return bytes_read;
     }
 
+    template <typename SrcT, typename DstT>
+    static size_t DecodeCompactValueFrom(const uint8_t* buffer, size_t buffer_size, DstT* value)
+    {
+        if (parameter_encoding_ != format::ParameterEncoding::kCompact)
+        {
+            return DecodeValueFrom<SrcT>(buffer, buffer_size, value);
+        }
+
+        assert(value != nullptr);
+
+        uint64_t from_value = 0;
+        size_t   bytes_read = format::LoadVarint(buffer, buffer_size, &from_value);
+
+        if (bytes_read != 0)
+        {
+            (*value) = TypeCast<DstT>(static_cast<SrcT>(from_value));
+        }
+
+        return bytes_read;
+    }
+
     template <typename SrcT, typename DstT>
     static size_t DecodeValueFrom(const uint8_t* buffer, size_t buffer_size, DstT* value)
     {
@@ -211,6 +306,8 @@ class ValueDecoder
 
         return bytes_read;
     }
+
+    static inline thread_local format::ParameterEncoding parameter_encoding_{ format::ParameterEncoding::kFixedSize };
 };
 
 GFXRECON_END_NAMESPACE(decode)
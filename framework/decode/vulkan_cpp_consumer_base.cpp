@@ -2937,7 +2937,7 @@ const std::string GfxToCppPlatformToString(GfxToCppPlatform platform)
 std::string VulkanCppConsumerBase::AddStruct(const std::stringstream& content, const std::string& var_namePrefix)
 {
     const std::string content_string = content.str();
-    const uint64_t    hash_value     = util::hash::GenerateCheckSum<uint64_t>(
+    const uint64_t    hash_value     = util::hash::GenerateHash64(
         reinterpret_cast<const uint8_t*>(content_string.c_str()), content_string.size());
 
     std::string var_name    = var_namePrefix + "_" + std::to_string(GetNextId());
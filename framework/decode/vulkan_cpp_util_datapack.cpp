@@ -41,7 +41,7 @@ void DataFilePacker::Initialize(const std::string& outDir,
 
 const SavedFileInfo DataFilePacker::AddFileContents(const uint8_t* data, const size_t dataSize)
 {
-    const uint64_t hash_value = util::hash::GenerateCheckSum<uint64_t>(data, dataSize);
+    const uint64_t hash_value = util::hash::GenerateHash64(data, dataSize);
     SavedFileInfo& data_entry = data_file_map_[hash_value];
 
     if (data_entry.file_path.empty())
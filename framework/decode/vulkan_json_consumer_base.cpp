@@ -33,6 +33,7 @@ GFXRECON_BEGIN_NAMESPACE(decode)
 
 using namespace util::platform;
 using util::JsonOptions;
+using util::JsonStreamWriter;
 using util::uuid_to_string;
 
 VulkanExportJsonConsumerBase::VulkanExportJsonConsumerBase() {}
@@ -78,23 +79,33 @@ void VulkanExportJsonConsumerBase::Process_vkCmdBuildAccelerationStructuresIndir
     PointerDecoder<uint32_t*>*                                                 ppMaxPrimitiveCounts)
 {
     const JsonOptions& json_options = GetJsonOptions();
-    WriteApiCallToFile(call_info, "vkCmdBuildAccelerationStructuresIndirectKHR", [&](nlohmann::ordered_json& function) {
-        auto& args = function[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["infoCount"], infoCount, json_options);
-        FieldToJson(args["pInfos"], pInfos, json_options);
-        FieldToJson(args["pIndirectDeviceAddresses"], pIndirectDeviceAddresses, json_options);
-        FieldToJson(args["pIndirectStrides"], pIndirectStrides, json_options);
-
-        auto infos                     = pInfos ? pInfos->GetPointer() : nullptr;
-        auto max_primitive_counts      = ppMaxPrimitiveCounts ? ppMaxPrimitiveCounts->GetPointer() : nullptr;
-        auto max_primitive_counts_json = args["ppMaxPrimitiveCounts"];
-
-        for (uint32_t i = 0; i < infoCount; ++i)
+    WriteApiCallToFile(call_info, "vkCmdBuildAccelerationStructuresIndirectKHR", [&](JsonStreamWriter& writer) {
+        writer.Key(NameArgs());
+        writer.BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("infoCount"), infoCount, json_options);
+        FieldToJson(writer.Key("pInfos"), pInfos, json_options);
+        FieldToJson(writer.Key("pIndirectDeviceAddresses"), pIndirectDeviceAddresses, json_options);
+        FieldToJson(writer.Key("pIndirectStrides"), pIndirectStrides, json_options);
+
+        // Each info has an array of maximum primitive counts with one element per geometry.
+        auto infos                = pInfos ? pInfos->GetPointer() : nullptr;
+        auto max_primitive_counts = ppMaxPrimitiveCounts ? ppMaxPrimitiveCounts->GetPointer() : nullptr;
+        writer.Key("ppMaxPrimitiveCounts");
+        if ((infos != nullptr) && (max_primitive_counts != nullptr) && (infoCount > 0))
+        {
+            writer.BeginArray();
+            for (uint32_t i = 0; i < infoCount; ++i)
+            {
+                FieldToJson(writer, max_primitive_counts[i], infos[i].geometryCount, json_options);
+            }
+            writer.EndArray();
+        }
+        else
         {
-            auto element = max_primitive_counts_json[i];
-            FieldToJson(max_primitive_counts_json[i], max_primitive_counts[i], infos[i].geometryCount, json_options);
+            writer.Null();
         }
+        writer.EndObject();
     });
 }
 
@@ -107,21 +118,37 @@ void VulkanExportJsonConsumerBase::Process_vkCreateShaderModule(
     gfxrecon::decode::HandlePointerDecoder<VkShaderModule>*                                     pShaderModule)
 {
     const JsonOptions& json_options = GetJsonOptions();
-    WriteApiCallToFile(call_info, "vkCreateShaderModule", [&](nlohmann::ordered_json& function) {
-        FieldToJson(function[NameReturn()], returnValue, json_options);
-        auto& args = function[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pShaderModule"], pShaderModule, json_options);
-
-        const uint64_t handle_id     = *pShaderModule->GetPointer();
-        auto           decoded_value = pCreateInfo->GetPointer();
-        RepresentBinaryFile(*(this->writer_),
-                            args["pCreateInfo"]["pCode"],
-                            "shader_module_" + util::to_hex_fixed_width(handle_id) + ".bin",
-                            decoded_value->codeSize,
-                            (uint8_t*)decoded_value->pCode);
+    WriteApiCallToFile(call_info, "vkCreateShaderModule", [&](JsonStreamWriter& writer) {
+        FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+        writer.Key(NameArgs());
+        writer.BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        writer.Key("pCreateInfo");
+        const Decoded_VkShaderModuleCreateInfo* create_info = pCreateInfo->GetMetaStructPointer();
+        if ((create_info != nullptr) && (create_info->decoded_value != nullptr))
+        {
+            // Write the create info in place of its FieldToJson() so that pCode can hold the shader's file name.
+            const VkShaderModuleCreateInfo& decoded_value = *create_info->decoded_value;
+            const uint64_t                  handle_id     = *pShaderModule->GetPointer();
+            writer.BeginObject();
+            FieldToJson(writer.Key("sType"), decoded_value.sType, json_options);
+            FieldToJson(VkShaderModuleCreateFlags_t(), writer.Key("flags"), decoded_value.flags, json_options);
+            FieldToJson(writer.Key("codeSize"), decoded_value.codeSize, json_options);
+            RepresentBinaryFile(*(this->writer_),
+                                writer.Key("pCode"),
+                                "shader_module_" + util::to_hex_fixed_width(handle_id) + ".bin",
+                                decoded_value.codeSize,
+                                (uint8_t*)decoded_value.pCode);
+            FieldToJson(writer.Key("pNext"), create_info->pNext, json_options);
+            writer.EndObject();
+        }
+        else
+        {
+            writer.Null();
+        }
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pShaderModule"), pShaderModule, json_options);
+        writer.EndObject();
     });
 }
 
@@ -133,21 +160,26 @@ void VulkanExportJsonConsumerBase::Process_vkGetPipelineCacheData(const ApiCallI
                                                                   PointerDecoder<uint8_t>* pData)
 {
     const JsonOptions& json_options = GetJsonOptions();
-    WriteApiCallToFile(call_info, "vkGetPipelineCacheData", [&](nlohmann::ordered_json& function) {
-        FieldToJson(function[NameReturn()], returnValue, json_options);
-        auto& args = function[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipelineCache"], pipelineCache, json_options);
-        FieldToJson(args["pDataSize"], pDataSize, json_options);
+    WriteApiCallToFile(call_info, "vkGetPipelineCacheData", [&](JsonStreamWriter& writer) {
+        FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+        writer.Key(NameArgs());
+        writer.BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipelineCache"), pipelineCache, json_options);
+        FieldToJson(writer.Key("pDataSize"), pDataSize, json_options);
         if (pData->IsNull())
         {
-            args["pData"] = nullptr;
+            FieldToJson(writer.Key("pData"), nullptr, json_options);
         }
         else
         {
-            RepresentBinaryFile(
-                *(this->writer_), args["pData"], "pipeline_cache_data.bin", pData->GetLength(), pData->GetPointer());
+            RepresentBinaryFile(*(this->writer_),
+                                writer.Key("pData"),
+                                "pipeline_cache_data.bin",
+                                pData->GetLength(),
+                                pData->GetPointer());
         }
+        writer.EndObject();
     });
 }
 
@@ -160,18 +192,36 @@ void VulkanExportJsonConsumerBase::Process_vkCreatePipelineCache(
     HandlePointerDecoder<VkPipelineCache>*                   pPipelineCache)
 {
     const JsonOptions& json_options = GetJsonOptions();
-    WriteApiCallToFile(call_info, "vkCreatePipelineCache", [&](nlohmann::ordered_json& function) {
-        FieldToJson(function[NameReturn()], returnValue, json_options);
-        auto& args = function[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelineCache"], pPipelineCache, json_options);
-        RepresentBinaryFile(*(this->writer_),
-                            args["pCreateInfo"]["pInitialData"],
-                            "pipeline_cache_data.bin",
-                            pCreateInfo->GetPointer()->initialDataSize,
-                            reinterpret_cast<const uint8_t*>(pCreateInfo->GetPointer()->pInitialData));
+    WriteApiCallToFile(call_info, "vkCreatePipelineCache", [&](JsonStreamWriter& writer) {
+        FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+        writer.Key(NameArgs());
+        writer.BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        writer.Key("pCreateInfo");
+        const Decoded_VkPipelineCacheCreateInfo* create_info = pCreateInfo->GetMetaStructPointer();
+        if ((create_info != nullptr) && (create_info->decoded_value != nullptr))
+        {
+            // Write the create info in place of its FieldToJson() so that pInitialData can hold the data's file name.
+            const VkPipelineCacheCreateInfo& decoded_value = *create_info->decoded_value;
+            writer.BeginObject();
+            FieldToJson(writer.Key("sType"), decoded_value.sType, json_options);
+            FieldToJson(VkPipelineCacheCreateFlags_t(), writer.Key("flags"), decoded_value.flags, json_options);
+            FieldToJson(writer.Key("initialDataSize"), decoded_value.initialDataSize, json_options);
+            RepresentBinaryFile(*(this->writer_),
+                                writer.Key("pInitialData"),
+                                "pipeline_cache_data.bin",
+                                decoded_value.initialDataSize,
+                                reinterpret_cast<const uint8_t*>(decoded_value.pInitialData));
+            FieldToJson(writer.Key("pNext"), create_info->pNext, json_options);
+            writer.EndObject();
+        }
+        else
+        {
+            writer.Null();
+        }
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pPipelineCache"), pPipelineCache, json_options);
+        writer.EndObject();
     });
 }
 
@@ -184,23 +234,27 @@ void VulkanExportJsonConsumerBase::Process_vkCmdPushConstants(const ApiCallInfo&
                                                               PointerDecoder<uint8_t>* pValues)
 {
     const JsonOptions& json_options = GetJsonOptions();
-    WriteApiCallToFile(call_info, "vkCmdPushConstants", [&](nlohmann::ordered_json& function) {
-        auto& args = function[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["layout"], layout, json_options);
-        FieldToJson(VkShaderStageFlags_t(), args["stageFlags"], stageFlags, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["size"], size, json_options);
-        FieldToJson(args["pValues"], pValues, json_options);
+    WriteApiCallToFile(call_info, "vkCmdPushConstants", [&](JsonStreamWriter& writer) {
+        writer.Key(NameArgs());
+        writer.BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("layout"), layout, json_options);
+        FieldToJson(VkShaderStageFlags_t(), writer.Key("stageFlags"), stageFlags, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        FieldToJson(writer.Key("size"), size, json_options);
         if (pValues->IsNull())
         {
-            args["pValues"] = nullptr;
+            FieldToJson(writer.Key("pValues"), nullptr, json_options);
         }
         else
         {
-            RepresentBinaryFile(
-                *(this->writer_), args["pValues"], "pushconstants.bin", pValues->GetLength(), pValues->GetPointer());
+            RepresentBinaryFile(*(this->writer_),
+                                writer.Key("pValues"),
+                                "pushconstants.bin",
+                                pValues->GetLength(),
+                                pValues->GetPointer());
         }
+        writer.EndObject();
     });
 }
 
@@ -216,14 +270,16 @@ void VulkanExportJsonConsumerBase::Process_vkUpdateDescriptorSetWithTemplate(con
 
     const char* function_name =
         use_KHR_suffix ? "vkUpdateDescriptorSetWithTemplateKHR" : "vkUpdateDescriptorSetWithTemplate";
-    auto& function = WriteApiCallStart(call_info, function_name);
-    auto& args     = function[NameArgs()];
+    auto& writer = writer_->WriteApiCallStart(call_info, function_name);
+    writer.Key(NameArgs());
+    writer.BeginObject();
 
-    HandleToJson(args["device"], device, json_options);
-    HandleToJson(args["descriptorSet"], descriptorSet, json_options);
-    HandleToJson(args["descriptorUpdateTemplate"], descriptorUpdateTemplate, json_options);
-    FieldToJson(args["pData"], pData, json_options);
+    HandleToJson(writer.Key("device"), device, json_options);
+    HandleToJson(writer.Key("descriptorSet"), descriptorSet, json_options);
+    HandleToJson(writer.Key("descriptorUpdateTemplate"), descriptorUpdateTemplate, json_options);
+    FieldToJson(writer.Key("pData"), pData, json_options);
 
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -237,15 +293,17 @@ void VulkanExportJsonConsumerBase::Process_vkCmdPushDescriptorSetWithTemplateKHR
 {
     const JsonOptions& json_options = GetJsonOptions();
 
-    auto& function = WriteApiCallStart(call_info, "vkCmdPushDescriptorSetWithTemplateKHR");
-    auto& args     = function[NameArgs()];
+    auto& writer = writer_->WriteApiCallStart(call_info, "vkCmdPushDescriptorSetWithTemplateKHR");
+    writer.Key(NameArgs());
+    writer.BeginObject();
 
-    HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-    HandleToJson(args["descriptorUpdateTemplate"], descriptorUpdateTemplate, json_options);
-    HandleToJson(args["layout"], layout, json_options);
-    FieldToJson(args["set"], set, json_options);
-    FieldToJson(args["pData"], pData, json_options);
+    HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+    HandleToJson(writer.Key("descriptorUpdateTemplate"), descriptorUpdateTemplate, json_options);
+    HandleToJson(writer.Key("layout"), layout, json_options);
+    FieldToJson(writer.Key("set"), set, json_options);
+    FieldToJson(writer.Key("pData"), pData, json_options);
 
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -256,14 +314,16 @@ void VulkanExportJsonConsumerBase::Process_vkCmdPushDescriptorSetWithTemplate2KH
 {
     const JsonOptions& json_options = GetJsonOptions();
 
-    auto& function = WriteApiCallStart(call_info, "vkCmdPushDescriptorSetWithTemplate2KHR");
-    auto& args     = function[NameArgs()];
+    auto& writer = writer_->WriteApiCallStart(call_info, "vkCmdPushDescriptorSetWithTemplate2KHR");
+    writer.Key(NameArgs());
+    writer.BeginObject();
     const StructPointerDecoder<Decoded_VkPushDescriptorSetWithTemplateInfoKHR>* info =
         pPushDescriptorSetWithTemplateInfo;
 
-    HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-    FieldToJson(args["pPushDescriptorSetWithTemplateInfo"], info, json_options);
+    HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+    FieldToJson(writer.Key("pPushDescriptorSetWithTemplateInfo"), info, json_options);
 
+    writer.EndObject();
     WriteBlockEnd();
 }
 
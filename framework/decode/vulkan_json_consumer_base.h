@@ -52,6 +52,10 @@ class VulkanExportJsonConsumerBase : public VulkanConsumer
 
     bool IsValid() const { return writer_ && writer_->IsValid(); }
 
+    /// Set the number of queue submissions that precede the first block to be converted,
+    /// when converting a part of a capture that does not start at its beginning.
+    void SetSubmitIndex(uint32_t submit_index) { submit_index_ = submit_index; }
+
     void Process_vkCmdBuildAccelerationStructuresIndirectKHR(
         const ApiCallInfo&                                                         call_info,
         format::HandleId                                                           commandBuffer,
@@ -134,9 +138,7 @@ class VulkanExportJsonConsumerBase : public VulkanConsumer
 
     const util::JsonOptions& GetJsonOptions() const { return writer_->GetOptions(); }
 
-    nlohmann::ordered_json& WriteBlockStart() { return writer_->WriteBlockStart(); }
-
-    /// Output the current in-memory json tree to the destination file.
+    /// Finish streaming the current block to the destination file.
     void WriteBlockEnd() { writer_->WriteBlockEnd(); }
 
     // Wrappers for json field names allowing change without code gen and
@@ -163,20 +165,20 @@ class VulkanExportJsonConsumerBase : public VulkanConsumer
     /// @todo Make this field optional.
     constexpr const char* NameSubmitIndex() const { return "sub_index"; }
 
-    nlohmann::ordered_json& WriteApiCallStart(const ApiCallInfo& call_info, const std::string& command_name)
+    util::JsonStreamWriter& WriteApiCallStart(const ApiCallInfo& call_info, const std::string& command_name)
     {
         return writer_->WriteApiCallStart(call_info, command_name);
     }
 
-    /// A utility wrapper so that manual output functions can provide a lambda which only needs to output
+    /// A utility wrapper so that manual output functions can provide a lambda which only needs to stream
     /// the fields unique to their call and this tops and tails with the standard boilerplate, defining it
     /// once here. Generated functions avoid the indirection through this.
     template <typename ToJsonFunctionType>
     inline void
     WriteApiCallToFile(const ApiCallInfo& call_info, const std::string& command_name, ToJsonFunctionType toJsonFunction)
     {
-        nlohmann::ordered_json& function = WriteApiCallStart(call_info, command_name);
-        toJsonFunction(function);
+        util::JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, command_name);
+        toJsonFunction(writer);
         WriteBlockEnd();
     }
 
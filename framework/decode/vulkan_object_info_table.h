@@ -34,25 +34,20 @@ class VulkanObjectInfoTable : public VulkanObjectInfoTableBase2
   public:
     void ReplaceSemaphore(VkSemaphore target, VkSemaphore replacement)
     {
-        for (auto& entry : semaphore_map_)
+        auto semaphore_info =
+            semaphore_map_.FindIf([target](const SemaphoreInfo& info) { return info.handle == target; });
+        if (semaphore_info != nullptr)
         {
-            if (entry.second.handle == target)
-            {
-                entry.second.handle = replacement;
-                break;
-            }
+            semaphore_info->handle = replacement;
         }
     }
 
     void ReplaceFence(VkFence target, VkFence replacement)
     {
-        for (auto& entry : fence_map_)
+        auto fence_info = fence_map_.FindIf([target](const FenceInfo& info) { return info.handle == target; });
+        if (fence_info != nullptr)
         {
-            if (entry.second.handle == target)
-            {
-                entry.second.handle = replacement;
-                break;
-            }
+            fence_info->handle = replacement;
         }
     }
 };
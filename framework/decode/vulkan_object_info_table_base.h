@@ -27,6 +27,7 @@
 #include "decode/vulkan_object_info.h"
 #include "format/format.h"
 #include "util/defines.h"
+#include "util/paged_id_map.h"
 
 #include "vulkan/vulkan.h"
 
@@ -53,7 +54,7 @@ class VulkanObjectInfoTableBase
 {
   protected:
     template <typename T>
-    void AddObjectInfo(T&& info, std::unordered_map<format::HandleId, T>* map)
+    void AddObjectInfo(T&& info, util::PagedIdMap<T>* map)
     {
         assert(map != nullptr);
 
@@ -66,7 +67,7 @@ class VulkanObjectInfoTableBase
 
         if ((info.capture_id != 0) && valid_handle)
         {
-            auto result = map->emplace(info.capture_id, std::forward<T>(info));
+            auto result = map->Emplace(info.capture_id, std::forward<T>(info));
 
             if (!result.second)
             {
@@ -78,10 +79,10 @@ class VulkanObjectInfoTableBase
                 // temporary objects created during the trimmed file state setup. IDs may be reused when creating these
                 // temporary objects, creating a case where we have a new handle that is not a duplicate of the existing
                 // map entry. In this case, the map entry needs to be updated with the new object's info.
-                auto iter = result.first;
-                if (iter->second.handle != info.handle)
+                auto existing_info = result.first;
+                if (existing_info->handle != info.handle)
                 {
-                    iter->second = std::forward<T>(info);
+                    (*existing_info) = std::forward<T>(info);
                 }
             }
         }
@@ -102,13 +103,13 @@ class VulkanObjectInfoTableBase
     // Note: the "dummy" template parameter is here for the sole purpose of working around a gcc issue which does
     // not allow full specialization in non-namespace scope (https://gcc.gnu.org/bugzilla/show_bug.cgi?id=85282)
     template <typename dummy>
-    void AddObjectInfo(SurfaceKHRInfo&& info, std::unordered_map<format::HandleId, SurfaceKHRInfo>* map)
+    void AddObjectInfo(SurfaceKHRInfo&& info, util::PagedIdMap<SurfaceKHRInfo>* map)
     {
         assert(map != nullptr);
 
         if (info.capture_id != 0)
         {
-            auto result = map->emplace(info.capture_id, std::forward<SurfaceKHRInfo>(info));
+            auto result = map->Emplace(info.capture_id, std::forward<SurfaceKHRInfo>(info));
 
             if (!result.second)
             {
@@ -120,53 +121,29 @@ class VulkanObjectInfoTableBase
                 // temporary objects created during the trimmed file state setup. IDs may be reused when creating these
                 // temporary objects, creating a case where we have a new handle that is not a duplicate of the existing
                 // map entry. In this case, the map entry needs to be updated with the new object's info.
-                auto iter = result.first;
-                if (iter->second.handle != info.handle)
+                auto existing_info = result.first;
+                if (existing_info->handle != info.handle)
                 {
-                    iter->second = std::forward<SurfaceKHRInfo>(info);
+                    (*existing_info) = std::forward<SurfaceKHRInfo>(info);
                 }
             }
         }
     }
 
     template <typename T>
-    const T* GetObjectInfo(format::HandleId id, const std::unordered_map<format::HandleId, T>* map) const
+    const T* GetObjectInfo(format::HandleId id, const util::PagedIdMap<T>* map) const
     {
         assert(map != nullptr);
 
-        const T* object_info = nullptr;
-
-        if (id != 0)
-        {
-            const auto entry = map->find(id);
-
-            if (entry != map->end())
-            {
-                object_info = &entry->second;
-            }
-        }
-
-        return object_info;
+        return (id != 0) ? map->Find(id) : nullptr;
     }
 
     template <typename T>
-    T* GetObjectInfo(format::HandleId id, std::unordered_map<format::HandleId, T>* map)
+    T* GetObjectInfo(format::HandleId id, util::PagedIdMap<T>* map)
     {
         assert(map != nullptr);
 
-        T* object_info = nullptr;
-
-        if (id != 0)
-        {
-            auto entry = map->find(id);
-
-            if (entry != map->end())
-            {
-                object_info = &entry->second;
-            }
-        }
-
-        return object_info;
+        return (id != 0) ? map->Find(id) : nullptr;
     }
 };
 
@@ -5776,8 +5776,8 @@ VkResult VulkanReplayConsumerBase::OverrideGetPipelineCacheData(PFN_vkGetPipelin
 
             bool     new_cache_data  = true;
             auto     cache_data_size = *pDataSize->GetPointer();
-            uint32_t capture_pipeline_cache_data_hash =
-                gfxrecon::util::hash::GenerateCheckSum<uint32_t>(pData->GetPointer(), cache_data_size);
+            uint64_t capture_pipeline_cache_data_hash =
+                gfxrecon::util::hash::GenerateHash64(pData->GetPointer(), cache_data_size);
 
             auto iterator = pipeline_cache_info->pipeline_cache_data.find(capture_pipeline_cache_data_hash);
             if (iterator != pipeline_cache_info->pipeline_cache_data.end())
@@ -5870,7 +5870,7 @@ VkResult VulkanReplayConsumerBase::OverrideCreatePipelineCache(
             // but it might not be valid for replay time if considering platform/driver version change. So in the
             // following process, we'll try to find corresponding replay time pipeline cache data.
             matched_replay_cache_data_exist_  = false;
-            capture_pipeline_cache_data_hash_ = gfxrecon::util::hash::GenerateCheckSum<uint32_t>(
+            capture_pipeline_cache_data_hash_ = gfxrecon::util::hash::GenerateHash64(
                 reinterpret_cast<const uint8_t*>(create_info.pInitialData), create_info.initialDataSize);
             capture_pipeline_cache_data_      = const_cast<void*>(create_info.pInitialData);
             capture_pipeline_cache_data_size_ = create_info.initialDataSize;
@@ -9584,7 +9584,8 @@ std::function<decode::handle_create_result_t<VkPipeline>()> VulkanReplayConsumer
             graphics::vulkan_check_buffer_references(create_infos, createInfoCount);
         }
         // schedule dependency-clear on main-thread
-        MainThreadQueue().post([this, handle_deps = std::move(handle_deps)] { ClearAsyncHandles(handle_deps); });
+        MainThreadQueue().post_detached(
+            [this, handle_deps = std::move(handle_deps)] { ClearAsyncHandles(handle_deps); });
         return { replay_result, std::move(out_pipelines) };
     };
     return task;
@@ -9651,7 +9652,8 @@ std::function<handle_create_result_t<VkPipeline>()> VulkanReplayConsumerBase::As
             graphics::vulkan_check_buffer_references(create_infos, createInfoCount);
         }
         // schedule dependency-clear on main-thread
-        MainThreadQueue().post([this, handle_deps = std::move(handle_deps)] { ClearAsyncHandles(handle_deps); });
+        MainThreadQueue().post_detached(
+            [this, handle_deps = std::move(handle_deps)] { ClearAsyncHandles(handle_deps); });
         return { replay_result, std::move(out_pipelines) };
     };
     return task;
@@ -9715,7 +9717,8 @@ VulkanReplayConsumerBase::AsyncCreateShadersEXT(const ApiCallInfo&
         }
 
         // schedule dependency-clear on main-thread
-        MainThreadQueue().post([this, handle_deps = std::move(handle_deps)] { ClearAsyncHandles(handle_deps); });
+        MainThreadQueue().post_detached(
+            [this, handle_deps = std::move(handle_deps)] { ClearAsyncHandles(handle_deps); });
         return { replay_result, std::move(out_shaders) };
     };
     return task;
@@ -1513,7 +1513,7 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     // Temporary data used by pipeline cache data handling
     // The following capture time data used for calling VisitPipelineCacheInfo as input parameters
     // , replay time data used as output result.
-    uint32_t             capture_pipeline_cache_data_hash_ = 0;
+    uint64_t             capture_pipeline_cache_data_hash_ = 0;
     uint32_t             capture_pipeline_cache_data_size_ = 0;
     void*                capture_pipeline_cache_data_;
     bool                 matched_replay_cache_data_exist_ = false;
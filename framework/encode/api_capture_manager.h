@@ -196,6 +196,7 @@ class ApiCaptureManager
 
     CommonCaptureManager::ThreadData* GetThreadData() { return common_manager_->GetThreadData(); }
     util::Compressor*                 GetCompressor() { return common_manager_->GetCompressor(); }
+    format::ParameterEncoding         GetParameterEncoding() const { return common_manager_->GetParameterEncoding(); }
     std::mutex&                       GetMappedMemoryLock() { return common_manager_->GetMappedMemoryLock(); }
     util::Keyboard&                   GetKeyboard() { return common_manager_->GetKeyboard(); }
     const std::string&                GetScreenshotPrefix() const { return common_manager_->GetScreenshotPrefix(); }
@@ -0,0 +1,324 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/async_capture_writer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Upper bound on the time the writer thread sleeps before checking the queues again.
+const auto kWriterIdleTimeout = std::chrono::milliseconds(10);
+
+std::atomic<uint64_t> AsyncCaptureWriter::id_counter_{ 0 };
+
+AsyncCaptureWriter::ThreadQueue::ThreadQueue(uint64_t writer_id, size_t capacity) :
+    writer_id_(writer_id), slots_(capacity), mask_(capacity - 1), head_(0), tail_(0), closed_(false)
+{
+    assert((capacity > 0) && ((capacity & (capacity - 1)) == 0));
+}
+
+AsyncCaptureWriter::Block* AsyncCaptureWriter::ThreadQueue::Reserve()
+{
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+
+    if ((tail - head_.load(std::memory_order_acquire)) == slots_.size())
+    {
+        return nullptr;
+    }
+
+    return &slots_[tail & mask_];
+}
+
+void AsyncCaptureWriter::ThreadQueue::Publish()
+{
+    tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+AsyncCaptureWriter::Block* AsyncCaptureWriter::ThreadQueue::Front()
+{
+    uint64_t head = head_.load(std::memory_order_relaxed);
+
+    if (head == tail_.load(std::memory_order_acquire))
+    {
+        return nullptr;
+    }
+
+    return &slots_[head & mask_];
+}
+
+void AsyncCaptureWriter::ThreadQueue::Pop()
+{
+    head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+AsyncCaptureWriter::AsyncCaptureWriter(WriteFunction write_function, size_t queue_capacity) :
+    id_(++id_counter_), write_function_(std::move(write_function)), queue_capacity_(queue_capacity),
+    queues_changed_(false), next_sequence_(0), next_write_sequence_(0), written_sequence_(0), writer_idle_(false),
+    stop_(false), paused_(false), pause_thread_(std::thread::id()), submitting_threads_(0)
+{
+    assert(write_function_);
+
+    writer_thread_ = std::thread(&AsyncCaptureWriter::WriterThread, this);
+}
+
+AsyncCaptureWriter::~AsyncCaptureWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+
+    work_condition_.notify_one();
+    writer_thread_.join();
+}
+
+std::shared_ptr<AsyncCaptureWriter::ThreadQueue> AsyncCaptureWriter::CreateThreadQueue()
+{
+    auto queue = std::make_shared<ThreadQueue>(id_, queue_capacity_);
+
+    std::lock_guard<std::mutex> lock(queues_mutex_);
+    queues_.push_back(queue);
+    queues_changed_.store(true);
+
+    return queue;
+}
+
+AsyncCaptureWriter::Block* AsyncCaptureWriter::BeginBlock(ThreadQueue* queue)
+{
+    assert((queue != nullptr) && (queue->GetWriterId() == id_));
+    assert(!IsPausedByCurrentThread());
+
+    // Pause() waits for the threads that are between BeginBlock and EndBlock, and new submissions wait for Resume().
+    submitting_threads_.fetch_add(1);
+
+    while (paused_.load())
+    {
+        EndSubmit();
+
+        {
+            std::unique_lock<std::mutex> lock(pause_mutex_);
+            pause_condition_.wait(lock, [this]() { return !paused_.load(); });
+        }
+
+        submitting_threads_.fetch_add(1);
+    }
+
+    Block* block = queue->Reserve();
+
+    if (block == nullptr)
+    {
+        // The queue is full; wake the writer thread and wait for it to free a slot.
+        std::unique_lock<std::mutex> lock(mutex_);
+        work_condition_.notify_one();
+        space_condition_.wait(lock, [queue, &block]() {
+            block = queue->Reserve();
+            return (block != nullptr);
+        });
+    }
+
+    return block;
+}
+
+void AsyncCaptureWriter::EndBlock(ThreadQueue* queue, Block* block)
+{
+    assert((queue != nullptr) && (block != nullptr));
+
+    block->sequence = next_sequence_.fetch_add(1);
+    queue->Publish();
+
+    if (writer_idle_.load())
+    {
+        WakeWriter();
+    }
+
+    EndSubmit();
+}
+
+void AsyncCaptureWriter::EndSubmit()
+{
+    if ((submitting_threads_.fetch_sub(1) == 1) && paused_.load())
+    {
+        // Taking the lock ensures that Pause() is either waiting on the condition or has yet to check the count.
+        std::lock_guard<std::mutex> lock(pause_mutex_);
+        pause_condition_.notify_all();
+    }
+}
+
+void AsyncCaptureWriter::Flush()
+{
+    assert(std::this_thread::get_id() != writer_thread_.get_id());
+
+    uint64_t target = next_sequence_.load();
+
+    WakeWriter();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    written_condition_.wait(lock, [this, target]() { return written_sequence_ >= target; });
+}
+
+void AsyncCaptureWriter::Pause()
+{
+    assert(std::this_thread::get_id() != writer_thread_.get_id());
+
+    {
+        std::unique_lock<std::mutex> lock(pause_mutex_);
+
+        // Only one thread writes to the output directly at a time.
+        pause_condition_.wait(lock, [this]() { return !paused_.load(); });
+
+        pause_thread_.store(std::this_thread::get_id());
+        paused_.store(true);
+
+        // Let the threads that are already submitting a block finish.
+        pause_condition_.wait(lock, [this]() { return (submitting_threads_.load() == 0); });
+    }
+
+    Flush();
+}
+
+void AsyncCaptureWriter::Resume()
+{
+    assert(IsPausedByCurrentThread());
+
+    {
+        std::lock_guard<std::mutex> lock(pause_mutex_);
+        paused_.store(false);
+        pause_thread_.store(std::thread::id());
+    }
+
+    pause_condition_.notify_all();
+}
+
+void AsyncCaptureWriter::WakeWriter()
+{
+    // Taking the lock ensures that the writer is either waiting on the condition or has yet to check for new work.
+    std::lock_guard<std::mutex> lock(mutex_);
+    work_condition_.notify_one();
+}
+
+void AsyncCaptureWriter::WriterThread()
+{
+    bool timed_out = false;
+
+    for (;;)
+    {
+        // Queues of exited threads are released after the writer has been idle.
+        if (timed_out || queues_changed_.load())
+        {
+            UpdateQueues();
+        }
+
+        timed_out         = false;
+        bool wrote_blocks = WritePendingBlocks();
+
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        if (written_sequence_ != next_write_sequence_)
+        {
+            written_sequence_ = next_write_sequence_;
+            written_condition_.notify_all();
+            space_condition_.notify_all();
+        }
+
+        if (!wrote_blocks)
+        {
+            if (next_write_sequence_ < next_sequence_.load())
+            {
+                // The next block has been assigned a sequence number, but has not yet been published.
+                lock.unlock();
+                std::this_thread::yield();
+            }
+            else if (stop_)
+            {
+                break;
+            }
+            else
+            {
+                writer_idle_.store(true);
+                timed_out = !work_condition_.wait_for(lock, kWriterIdleTimeout, [this]() {
+                    return stop_ || queues_changed_.load() || (next_write_sequence_ < next_sequence_.load());
+                });
+                writer_idle_.store(false);
+            }
+        }
+    }
+}
+
+bool AsyncCaptureWriter::WritePendingBlocks()
+{
+    bool wrote_blocks = false;
+    bool progress     = true;
+
+    // Each queue is ordered by sequence, so the next block to write is always at the front of one of the queues.
+    while (progress)
+    {
+        progress = false;
+
+        for (const auto& queue : writer_queues_)
+        {
+            Block* block = queue->Front();
+
+            while ((block != nullptr) && (block->sequence == next_write_sequence_))
+            {
+                write_function_(*block);
+
+                if (block->data.capacity() > kMaxRetainedBlockSize)
+                {
+                    std::vector<uint8_t>().swap(block->data);
+                }
+
+                queue->Pop();
+                ++next_write_sequence_;
+                progress     = true;
+                wrote_blocks = true;
+
+                block = queue->Front();
+            }
+        }
+    }
+
+    return wrote_blocks;
+}
+
+void AsyncCaptureWriter::UpdateQueues()
+{
+    std::lock_guard<std::mutex> lock(queues_mutex_);
+
+    queues_changed_.store(false);
+
+    // Release the queues of threads that have exited once everything they submitted has been written.
+    queues_.erase(std::remove_if(queues_.begin(),
+                                 queues_.end(),
+                                 [](const std::shared_ptr<ThreadQueue>& queue) {
+                                     return queue->IsClosed() && (queue->Front() == nullptr);
+                                 }),
+                  queues_.end());
+
+    writer_queues_ = queues_;
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
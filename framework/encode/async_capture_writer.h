@@ -0,0 +1,177 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_ASYNC_CAPTURE_WRITER_H
+#define GFXRECON_ENCODE_ASYNC_CAPTURE_WRITER_H
+
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Moves capture file serialization off of the application threads.  Each application thread copies its finished
+// blocks into its own single producer, single consumer queue, and a dedicated writer thread passes the blocks to the
+// write function in the order that they were submitted across all threads.
+class AsyncCaptureWriter
+{
+  public:
+    enum class BlockType : uint32_t
+    {
+        kRaw          = 0, // Data is a complete block that is written as is.
+        kFunctionCall = 1, // Data is a FunctionCallHeader followed by the parameter data.
+        kMethodCall   = 2, // Data is a MethodCallHeader followed by the parameter data.
+        kFlush        = 3, // No data; the output stream is flushed.
+        kDictionary   = 4  // Data is a complete compression dictionary block, which applies to the blocks after it.
+    };
+
+    struct Block
+    {
+        uint64_t             sequence{ 0 };
+        BlockType            type{ BlockType::kRaw };
+        format::ApiCallId    call_id{ format::ApiCallId::ApiCall_Unknown };
+        format::HandleId     object_id{ format::kNullHandleId };
+        format::ThreadId     thread_id{ 0 };
+        std::vector<uint8_t> data;
+    };
+
+    // Fixed capacity ring of blocks written by one application thread and read by the writer thread.
+    class ThreadQueue
+    {
+      public:
+        ThreadQueue(uint64_t writer_id, size_t capacity);
+
+        uint64_t GetWriterId() const { return writer_id_; }
+
+        // Called from the owning thread when it exits.  The writer thread releases the queue once it is empty.
+        void Close() { closed_.store(true, std::memory_order_release); }
+
+      private:
+        friend class AsyncCaptureWriter;
+
+        Block* Reserve();
+        void   Publish();
+        Block* Front();
+        void   Pop();
+        bool   IsClosed() const { return closed_.load(std::memory_order_acquire); }
+
+      private:
+        const uint64_t        writer_id_;
+        std::vector<Block>    slots_;
+        const uint64_t        mask_;
+        std::atomic<uint64_t> head_;
+        std::atomic<uint64_t> tail_;
+        std::atomic<bool>     closed_;
+    };
+
+    typedef std::function<void(Block&)> WriteFunction;
+
+  public:
+    AsyncCaptureWriter(WriteFunction write_function, size_t queue_capacity = kDefaultQueueCapacity);
+
+    // Writes all pending blocks before returning.
+    ~AsyncCaptureWriter();
+
+    uint64_t GetId() const { return id_; }
+
+    std::shared_ptr<ThreadQueue> CreateThreadQueue();
+
+    // Returns the next free block of the queue, waiting for the writer thread when the queue is full.  The block must
+    // be submitted with EndBlock before BeginBlock is called again for the same queue.
+    Block* BeginBlock(ThreadQueue* queue);
+
+    // Assigns the block its position in the output and hands it to the writer thread.
+    void EndBlock(ThreadQueue* queue, Block* block);
+
+    // Blocks until every block submitted before the call has been passed to the write function.  Must not be called
+    // from the write function.
+    void Flush();
+
+    // Writes every submitted block and keeps other threads from submitting blocks until Resume is called, so that the
+    // calling thread can write to the output directly.  The calling thread must not submit blocks while the writer is
+    // paused.  Must not be called from the write function.
+    void Pause();
+
+    void Resume();
+
+    bool IsPausedByCurrentThread() const
+    {
+        return paused_.load() && (pause_thread_.load() == std::this_thread::get_id());
+    }
+
+  private:
+    void WriterThread();
+
+    bool WritePendingBlocks();
+
+    void UpdateQueues();
+
+    void WakeWriter();
+
+    void EndSubmit();
+
+  private:
+    static const size_t kDefaultQueueCapacity = 256;
+
+    // Blocks larger than this release their storage after being written instead of keeping it for reuse.
+    static const size_t kMaxRetainedBlockSize = 1024 * 1024;
+
+    static std::atomic<uint64_t> id_counter_;
+
+    const uint64_t                            id_;
+    WriteFunction                             write_function_;
+    const size_t                              queue_capacity_;
+    std::mutex                                queues_mutex_;
+    std::vector<std::shared_ptr<ThreadQueue>> queues_;
+    std::atomic<bool>                         queues_changed_;
+    std::vector<std::shared_ptr<ThreadQueue>> writer_queues_;
+    std::atomic<uint64_t>                     next_sequence_;
+    uint64_t                                  next_write_sequence_;
+    std::mutex                                mutex_;
+    std::condition_variable                   work_condition_;
+    std::condition_variable                   written_condition_;
+    std::condition_variable                   space_condition_;
+    uint64_t                                  written_sequence_;
+    std::atomic<bool>                         writer_idle_;
+    bool                                      stop_;
+    std::mutex                                pause_mutex_;
+    std::condition_variable                   pause_condition_;
+    std::atomic<bool>                         paused_;
+    std::atomic<std::thread::id>              pause_thread_;
+    std::atomic<uint32_t>                     submitting_threads_;
+    std::thread                               writer_thread_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_ASYNC_CAPTURE_WRITER_H
@@ -38,8 +38,10 @@
 #include "util/page_guard_manager.h"
 #include "util/platform.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <future>
 #include <unordered_map>
 
 #if defined(__unix__)
@@ -53,6 +55,17 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 const uint32_t kFirstFrame           = 1;
 const size_t   kFileStreamBufferSize = 256 * 1024;
 
+// Fill memory data larger than this is compressed in ranges of this size by the compression thread pool, when enabled.
+const size_t kParallelCompressionChunkSize       = 1024 * 1024;
+const size_t kParallelCompressionRangesPerThread = 2; // Ranges compressed ahead of the write, per pool thread.
+
+// The compression dictionary is trained from the parameter data of the first API call blocks of each capture file.
+// Larger blocks compress well without a dictionary and are not sampled.
+const size_t kDictionarySampleCount    = 4096;
+const size_t kMaxDictionarySampleSize  = 4096;
+const size_t kMaxDictionarySampleBytes = 2 * 1024 * 1024; // About 100 times the dictionary size.
+const size_t kMaxCompressionDictionary = 16 * 1024;
+
 std::mutex                                     CommonCaptureManager::ThreadData::count_lock_;
 format::ThreadId                               CommonCaptureManager::ThreadData::thread_count_ = 0;
 std::unordered_map<uint64_t, format::ThreadId> CommonCaptureManager::ThreadData::id_map_;
@@ -72,6 +85,14 @@ CommonCaptureManager::ThreadData::ThreadData() :
     parameter_encoder_ = std::make_unique<ParameterEncoder>(parameter_buffer_.get());
 }
 
+CommonCaptureManager::ThreadData::~ThreadData()
+{
+    if (write_queue_ != nullptr)
+    {
+        write_queue_->Close();
+    }
+}
+
 format::ThreadId CommonCaptureManager::ThreadData::GetThreadId()
 {
     format::ThreadId id  = 0;
@@ -103,11 +124,16 @@ CommonCaptureManager::CommonCaptureManager() :
     previous_runtime_trigger_state_(CaptureSettings::RuntimeTriggerState::kNotUsed), debug_layer_(false),
     debug_device_lost_(false), screenshot_prefix_(""), screenshots_enabled_(false), disable_dxr_(false),
     accel_struct_padding_(0), iunknown_wrapping_(false), force_command_serialization_(false), queue_zero_only_(false),
-    allow_pipeline_compile_required_(false), quit_after_frame_ranges_(false), block_index_(0)
+    allow_pipeline_compile_required_(false), quit_after_frame_ranges_(false), block_index_(0),
+    dictionary_sampling_(false), dictionary_trained_(false), dictionary_ready_(false), dictionary_generation_(0),
+    dictionary_api_family_(format::ApiFamilyId::ApiFamily_None)
 {}
 
 CommonCaptureManager::~CommonCaptureManager()
 {
+    // Write any pending blocks before the capture file is closed.
+    async_writer_ = nullptr;
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard ||
         memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
@@ -338,6 +364,7 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         page_guard_copy_on_map_                         = trace_settings.page_guard_copy_on_map;
         page_guard_signal_handler_watcher_max_restores_ = trace_settings.page_guard_signal_handler_watcher_max_restores;
         page_guard_separate_read_                       = trace_settings.page_guard_separate_read;
+        page_guard_diff_                                = trace_settings.page_guard_diff;
 
         bool use_external_memory = trace_settings.page_guard_external_memory;
 
@@ -456,6 +483,37 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
         }
     }
 
+    if (success && (compressor_ != nullptr) && (trace_settings.compression_threads > 0))
+    {
+        compression_pool_.set_num_threads(trace_settings.compression_threads);
+    }
+
+    if (success && (compressor_ != nullptr) && trace_settings.compression_dictionary)
+    {
+        if (compressor_->SupportsDictionary())
+        {
+            // API call blocks switch to the dictionary compressor once the dictionary has been written to the file.
+            dictionary_compressor_ =
+                std::unique_ptr<util::Compressor>(format::CreateCompressor(file_options_.compression_type));
+
+            // Training takes too long to run on the application thread that completes the samples.
+            dictionary_trainer_.set_num_threads(1);
+
+            ResetCompressionDictionary(dictionary_api_family_);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Compression dictionaries are not supported by the selected compression type; the "
+                                 "capture_compression_dictionary setting will be ignored");
+        }
+    }
+
+    if (success && trace_settings.async_write)
+    {
+        async_writer_ = std::make_unique<AsyncCaptureWriter>(
+            [this](AsyncCaptureWriter::Block& block) { WriteQueuedBlock(block); });
+    }
+
     if (success)
     {
         if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard ||
@@ -472,7 +530,8 @@ bool CommonCaptureManager::Initialize(format::ApiFamilyId                   api_
                                            trace_settings.page_guard_unblock_sigsegv,
                                            trace_settings.page_guard_signal_handler_watcher,
                                            trace_settings.page_guard_signal_handler_watcher_max_restores,
-                                           mem_prot_mode);
+                                           mem_prot_mode,
+                                           trace_settings.page_guard_diff);
         }
     }
     else
@@ -508,6 +567,7 @@ ParameterEncoder* CommonCaptureManager::InitApiCallCapture(format::ApiCallId cal
 
     // Reset the parameter buffer and reserve space for an uncompressed FunctionCallHeader.
     thread_data->parameter_buffer_->ClearWithHeader(sizeof(format::FunctionCallHeader));
+    thread_data->parameter_encoder_->SetParameterEncoding(file_options_.parameter_encoding);
 
     return thread_data->parameter_encoder_.get();
 }
@@ -520,6 +580,7 @@ ParameterEncoder* CommonCaptureManager::InitMethodCallCapture(format::ApiCallId
 
     // Reset the parameter buffer and reserve space for an uncompressed MethodCallHeader.
     thread_data->parameter_buffer_->ClearWithHeader(sizeof(format::MethodCallHeader));
+    thread_data->parameter_encoder_->SetParameterEncoding(file_options_.parameter_encoding);
 
     return thread_data->parameter_encoder_.get();
 }
@@ -533,49 +594,30 @@ void CommonCaptureManager::EndApiCallCapture()
 
         auto parameter_buffer = thread_data->parameter_buffer_.get();
         assert((parameter_buffer != nullptr) && (thread_data->parameter_encoder_ != nullptr));
+        assert((parameter_buffer->GetHeaderData() != nullptr) &&
+               (parameter_buffer->GetHeaderDataSize() == sizeof(format::FunctionCallHeader)));
 
-        bool   not_compressed    = true;
-        size_t uncompressed_size = parameter_buffer->GetDataSize();
-
-        if (compressor_ != nullptr)
+        if (UseAsyncWriter())
         {
-            size_t header_size     = sizeof(format::CompressedFunctionCallHeader);
-            size_t compressed_size = compressor_->Compress(
-                uncompressed_size, parameter_buffer->GetData(), &thread_data->compressed_buffer_, header_size);
-
-            if ((compressed_size > 0) && (compressed_size < uncompressed_size))
+            if (dictionary_trained_.load(std::memory_order_acquire))
             {
-                auto compressed_header =
-                    reinterpret_cast<format::CompressedFunctionCallHeader*>(thread_data->compressed_buffer_.data());
-                compressed_header->block_header.type = format::BlockType::kCompressedFunctionCallBlock;
-                compressed_header->api_call_id       = thread_data->call_id_;
-                compressed_header->thread_id         = thread_data->thread_id_;
-                compressed_header->uncompressed_size = uncompressed_size;
-                compressed_header->block_header.size = sizeof(compressed_header->api_call_id) +
-                                                       sizeof(compressed_header->thread_id) +
-                                                       sizeof(compressed_header->uncompressed_size) + compressed_size;
-
-                WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
-
-                not_compressed = false;
+                UseTrainedCompressionDictionary(thread_data->thread_id_);
             }
-        }
 
-        if (not_compressed)
+            // The header and compression are handled by the writer thread.
+            WriteBlock(AsyncCaptureWriter::BlockType::kFunctionCall,
+                       parameter_buffer->GetHeaderData(),
+                       parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+        }
+        else
         {
-            uint8_t* header_data = parameter_buffer->GetHeaderData();
-            assert((header_data != nullptr) &&
-                   (parameter_buffer->GetHeaderDataSize() == sizeof(format::FunctionCallHeader)));
+            auto block = BuildFunctionCallBlock(thread_data->call_id_,
+                                                thread_data->thread_id_,
+                                                parameter_buffer->GetHeaderData(),
+                                                parameter_buffer->GetDataSize(),
+                                                &thread_data->compressed_buffer_);
 
-            auto uncompressed_header               = reinterpret_cast<format::FunctionCallHeader*>(header_data);
-            uncompressed_header->block_header.type = format::BlockType::kFunctionCallBlock;
-            uncompressed_header->api_call_id       = thread_data->call_id_;
-            uncompressed_header->thread_id         = thread_data->thread_id_;
-            uncompressed_header->block_header.size =
-                sizeof(uncompressed_header->api_call_id) + sizeof(uncompressed_header->thread_id) + uncompressed_size;
-
-            WriteToFile(parameter_buffer->GetHeaderData(),
-                        parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+            WriteBlock(AsyncCaptureWriter::BlockType::kRaw, block.first, block.second);
         }
     }
 }
@@ -589,55 +631,120 @@ void CommonCaptureManager::EndMethodCallCapture()
 
         auto parameter_buffer = thread_data->parameter_buffer_.get();
         assert((parameter_buffer != nullptr) && (thread_data->parameter_encoder_ != nullptr));
+        assert((parameter_buffer->GetHeaderData() != nullptr) &&
+               (parameter_buffer->GetHeaderDataSize() == sizeof(format::MethodCallHeader)));
 
-        bool   not_compressed    = true;
-        size_t uncompressed_size = parameter_buffer->GetDataSize();
+        if (UseAsyncWriter())
+        {
+            if (dictionary_trained_.load(std::memory_order_acquire))
+            {
+                UseTrainedCompressionDictionary(thread_data->thread_id_);
+            }
 
-        if (compressor_ != nullptr)
+            // The header and compression are handled by the writer thread.
+            WriteBlock(AsyncCaptureWriter::BlockType::kMethodCall,
+                       parameter_buffer->GetHeaderData(),
+                       parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+        }
+        else
         {
-            size_t header_size     = sizeof(format::CompressedMethodCallHeader);
-            size_t compressed_size = compressor_->Compress(
-                uncompressed_size, parameter_buffer->GetData(), &thread_data->compressed_buffer_, header_size);
+            auto block = BuildMethodCallBlock(thread_data->call_id_,
+                                              thread_data->object_id_,
+                                              thread_data->thread_id_,
+                                              parameter_buffer->GetHeaderData(),
+                                              parameter_buffer->GetDataSize(),
+                                              &thread_data->compressed_buffer_);
+
+            WriteBlock(AsyncCaptureWriter::BlockType::kRaw, block.first, block.second);
+        }
+    }
+}
 
-            if ((compressed_size > 0) && (compressed_size < uncompressed_size))
-            {
-                auto compressed_header =
-                    reinterpret_cast<format::CompressedMethodCallHeader*>(thread_data->compressed_buffer_.data());
-                compressed_header->block_header.type = format::BlockType::kCompressedMethodCallBlock;
-                compressed_header->api_call_id       = thread_data->call_id_;
-                compressed_header->object_id         = thread_data->object_id_;
-                compressed_header->thread_id         = thread_data->thread_id_;
-                compressed_header->uncompressed_size = uncompressed_size;
-                compressed_header->block_header.size = sizeof(compressed_header->api_call_id) +
-                                                       sizeof(compressed_header->object_id) +
-                                                       sizeof(compressed_header->uncompressed_size) +
-                                                       sizeof(compressed_header->thread_id) + compressed_size;
+std::pair<const void*, size_t> CommonCaptureManager::BuildFunctionCallBlock(format::ApiCallId     call_id,
+                                                                            format::ThreadId      thread_id,
+                                                                            uint8_t*              block_data,
+                                                                            size_t                data_size,
+                                                                            std::vector<uint8_t>* compressed_buffer)
+{
+    assert((block_data != nullptr) && (compressed_buffer != nullptr));
 
-                WriteToFile(thread_data->compressed_buffer_.data(), header_size + compressed_size);
+    const uint8_t*    parameter_data = block_data + sizeof(format::FunctionCallHeader);
+    util::Compressor* compressor     = GetCallCompressor(thread_id, parameter_data, data_size);
 
-                not_compressed = false;
-            }
-        }
+    if (compressor != nullptr)
+    {
+        size_t header_size     = sizeof(format::CompressedFunctionCallHeader);
+        size_t compressed_size = compressor->Compress(data_size, parameter_data, compressed_buffer, header_size);
 
-        if (not_compressed)
+        if ((compressed_size > 0) && (compressed_size < data_size))
         {
-            uint8_t* header_data = parameter_buffer->GetHeaderData();
-            assert((header_data != nullptr) &&
-                   (parameter_buffer->GetHeaderDataSize() == sizeof(format::MethodCallHeader)));
+            auto compressed_header = reinterpret_cast<format::CompressedFunctionCallHeader*>(compressed_buffer->data());
+            compressed_header->block_header.type = format::BlockType::kCompressedFunctionCallBlock;
+            compressed_header->api_call_id       = call_id;
+            compressed_header->thread_id         = thread_id;
+            compressed_header->uncompressed_size = data_size;
+            compressed_header->block_header.size = sizeof(compressed_header->api_call_id) +
+                                                   sizeof(compressed_header->thread_id) +
+                                                   sizeof(compressed_header->uncompressed_size) + compressed_size;
+
+            return { compressed_buffer->data(), header_size + compressed_size };
+        }
+    }
 
-            auto uncompressed_header               = reinterpret_cast<format::MethodCallHeader*>(header_data);
-            uncompressed_header->block_header.type = format::BlockType::kMethodCallBlock;
-            uncompressed_header->api_call_id       = thread_data->call_id_;
-            uncompressed_header->object_id         = thread_data->object_id_;
-            uncompressed_header->thread_id         = thread_data->thread_id_;
-            uncompressed_header->block_header.size = sizeof(uncompressed_header->api_call_id) +
-                                                     sizeof(uncompressed_header->object_id) +
-                                                     sizeof(uncompressed_header->thread_id) + uncompressed_size;
+    auto uncompressed_header               = reinterpret_cast<format::FunctionCallHeader*>(block_data);
+    uncompressed_header->block_header.type = format::BlockType::kFunctionCallBlock;
+    uncompressed_header->api_call_id       = call_id;
+    uncompressed_header->thread_id         = thread_id;
+    uncompressed_header->block_header.size =
+        sizeof(uncompressed_header->api_call_id) + sizeof(uncompressed_header->thread_id) + data_size;
 
-            WriteToFile(parameter_buffer->GetHeaderData(),
-                        parameter_buffer->GetHeaderDataSize() + parameter_buffer->GetDataSize());
+    return { block_data, sizeof(format::FunctionCallHeader) + data_size };
+}
+
+std::pair<const void*, size_t> CommonCaptureManager::BuildMethodCallBlock(format::ApiCallId     call_id,
+                                                                          format::HandleId      object_id,
+                                                                          format::ThreadId      thread_id,
+                                                                          uint8_t*              block_data,
+                                                                          size_t                data_size,
+                                                                          std::vector<uint8_t>* compressed_buffer)
+{
+    assert((block_data != nullptr) && (compressed_buffer != nullptr));
+
+    const uint8_t*    parameter_data = block_data + sizeof(format::MethodCallHeader);
+    util::Compressor* compressor     = GetCallCompressor(thread_id, parameter_data, data_size);
+
+    if (compressor != nullptr)
+    {
+        size_t header_size     = sizeof(format::CompressedMethodCallHeader);
+        size_t compressed_size = compressor->Compress(data_size, parameter_data, compressed_buffer, header_size);
+
+        if ((compressed_size > 0) && (compressed_size < data_size))
+        {
+            auto compressed_header = reinterpret_cast<format::CompressedMethodCallHeader*>(compressed_buffer->data());
+            compressed_header->block_header.type = format::BlockType::kCompressedMethodCallBlock;
+            compressed_header->api_call_id       = call_id;
+            compressed_header->object_id         = object_id;
+            compressed_header->thread_id         = thread_id;
+            compressed_header->uncompressed_size = data_size;
+            compressed_header->block_header.size = sizeof(compressed_header->api_call_id) +
+                                                   sizeof(compressed_header->object_id) +
+                                                   sizeof(compressed_header->uncompressed_size) +
+                                                   sizeof(compressed_header->thread_id) + compressed_size;
+
+            return { compressed_buffer->data(), header_size + compressed_size };
         }
     }
+
+    auto uncompressed_header               = reinterpret_cast<format::MethodCallHeader*>(block_data);
+    uncompressed_header->block_header.type = format::BlockType::kMethodCallBlock;
+    uncompressed_header->api_call_id       = call_id;
+    uncompressed_header->object_id         = object_id;
+    uncompressed_header->thread_id         = thread_id;
+    uncompressed_header->block_header.size = sizeof(uncompressed_header->api_call_id) +
+                                             sizeof(uncompressed_header->object_id) +
+                                             sizeof(uncompressed_header->thread_id) + data_size;
+
+    return { block_data, sizeof(format::MethodCallHeader) + data_size };
 }
 
 bool CommonCaptureManager::IsTrimHotkeyPressed()
@@ -846,7 +953,15 @@ void CommonCaptureManager::EndFrame(format::ApiFamilyId api_family)
     // Flush after presents to help avoid capture files with incomplete final blocks.
     if (file_stream_.get() != nullptr)
     {
-        file_stream_->Flush();
+        if (UseAsyncWriter())
+        {
+            // Have the writer thread flush after the blocks that precede the present, without waiting for it.
+            WriteBlock(AsyncCaptureWriter::BlockType::kFlush, nullptr, 0);
+        }
+        else
+        {
+            file_stream_->Flush();
+        }
     }
 
     // Terminate process if this was the last trim range and the user has asked to do so
@@ -923,6 +1038,10 @@ bool CommonCaptureManager::CreateCaptureFile(format::ApiFamilyId api_family, con
     bool        success          = true;
     std::string capture_filename = base_filename;
 
+    // The file header blocks are written directly to the new file stream, which the writer thread must not use until
+    // they have been written.
+    PauseAsyncWrites();
+
     if (timestamp_filename_)
     {
         capture_filename = util::filepath::GenerateTimestampedFilename(capture_filename);
@@ -962,6 +1081,9 @@ bool CommonCaptureManager::CreateCaptureFile(format::ApiFamilyId api_family, con
 
         WriteCaptureOptions(operation_annotation);
 
+        // Each capture file trains and stores its own compression dictionary.
+        ResetCompressionDictionary(api_family);
+
         operation_annotation += "\n}";
         ForcedWriteAnnotation(
             format::AnnotationType::kJson, format::kAnnotationLabelOperation, operation_annotation.c_str());
@@ -1046,6 +1168,8 @@ bool CommonCaptureManager::CreateCaptureFile(format::ApiFamilyId api_family, con
         success      = false;
     }
 
+    ResumeAsyncWrites();
+
     return success;
 }
 
@@ -1056,10 +1180,15 @@ void CommonCaptureManager::ActivateTrimming()
     auto thread_data = GetThreadData();
     assert(thread_data != nullptr);
 
+    // The state snapshot is written directly to the file stream, after the file header blocks.
+    PauseAsyncWrites();
+
     for (auto& manager : api_capture_managers_)
     {
         manager.first->WriteTrackedState(file_stream_.get(), thread_data->thread_id_);
     }
+
+    ResumeAsyncWrites();
 }
 
 void CommonCaptureManager::DeactivateTrimming()
@@ -1067,8 +1196,10 @@ void CommonCaptureManager::DeactivateTrimming()
     capture_mode_ &= ~kModeWrite;
 
     assert(file_stream_);
+    PauseAsyncWrites();
     file_stream_->Flush();
     file_stream_ = nullptr;
+    ResumeAsyncWrites();
 }
 
 void CommonCaptureManager::WriteFileHeader()
@@ -1100,6 +1231,12 @@ void CommonCaptureManager::BuildOptionList(const format::EnabledOptions&
     assert(option_list != nullptr);
 
     option_list->push_back({ format::FileOption::kCompressionType, enabled_options.compression_type });
+
+    // The option is only written for the non-default encoding, leaving the headers of other capture files unchanged.
+    if (enabled_options.parameter_encoding != format::ParameterEncoding::kFixedSize)
+    {
+        option_list->push_back({ format::FileOption::kParameterEncoding, enabled_options.parameter_encoding });
+    }
 }
 
 void CommonCaptureManager::WriteDisplayMessageCmd(format::ApiFamilyId api_family, const char* message)
@@ -1211,6 +1348,13 @@ void CommonCaptureManager::WriteFillMemoryCmd(
         fill_cmd.memory_offset = offset;
         fill_cmd.memory_size   = size;
 
+        if ((compressor_ != nullptr) && (compression_pool_.numthreads() > 0) &&
+            (uncompressed_size > kParallelCompressionChunkSize))
+        {
+            WriteParallelCompressedFillMemoryCmd(fill_cmd, uncompressed_data, uncompressed_size);
+            return;
+        }
+
         bool not_compressed = true;
 
         if (compressor_ != nullptr)
@@ -1246,6 +1390,87 @@ void CommonCaptureManager::WriteFillMemoryCmd(
     }
 }
 
+void CommonCaptureManager::WriteParallelCompressedFillMemoryCmd(format::FillMemoryCommandHeader fill_cmd,
+                                                                const uint8_t*                  data,
+                                                                size_t                          size)
+{
+    assert((compressor_ != nullptr) && (data != nullptr));
+
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    const size_t      header_size   = sizeof(format::FillMemoryCommandHeader);
+    const size_t      chunk_count   = (size + kParallelCompressionChunkSize - 1) / kParallelCompressionChunkSize;
+    const uint64_t    memory_offset = fill_cmd.memory_offset;
+    util::Compressor* compressor    = compressor_.get();
+
+    // Ranges are written in order, so only enough ranges to keep the pool busy are compressed ahead of the range that
+    // is being written.  Their output buffers are reused in turn, bounding the memory held for each thread.
+    const size_t ring_size =
+        std::min(chunk_count, kParallelCompressionRangesPerThread * compression_pool_.numthreads());
+
+    auto& chunk_buffers = thread_data->compressed_chunk_buffers_;
+    if (chunk_buffers.size() < ring_size)
+    {
+        chunk_buffers.resize(ring_size);
+    }
+
+    std::vector<std::future<size_t>> compressed_sizes(ring_size);
+
+    auto compress_chunk = [&](size_t index) {
+        const size_t          chunk_offset = index * kParallelCompressionChunkSize;
+        const size_t          chunk_size   = std::min(kParallelCompressionChunkSize, size - chunk_offset);
+        const uint8_t*        chunk_data   = data + chunk_offset;
+        std::vector<uint8_t>* chunk_buffer = &chunk_buffers[index % ring_size];
+
+        compressed_sizes[index % ring_size] =
+            compression_pool_.post([compressor, chunk_size, chunk_data, chunk_buffer, header_size]() {
+                return compressor->Compress(chunk_size, chunk_data, chunk_buffer, header_size);
+            });
+    };
+
+    for (size_t i = 0; i < ring_size; ++i)
+    {
+        compress_chunk(i);
+    }
+
+    // Each range is written as soon as it has been compressed, while the following ranges are still in progress.
+    for (size_t i = 0; i < chunk_count; ++i)
+    {
+        const size_t          chunk_offset    = i * kParallelCompressionChunkSize;
+        const size_t          chunk_size      = std::min(kParallelCompressionChunkSize, size - chunk_offset);
+        const uint8_t*        chunk_data      = data + chunk_offset;
+        std::vector<uint8_t>& chunk_buffer    = chunk_buffers[i % ring_size];
+        size_t                compressed_size = compressed_sizes[i % ring_size].get();
+
+        fill_cmd.memory_offset = memory_offset + chunk_offset;
+        fill_cmd.memory_size   = chunk_size;
+
+        if ((compressed_size > 0) && (compressed_size < chunk_size))
+        {
+            fill_cmd.meta_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+            fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + compressed_size;
+
+            util::platform::MemoryCopy(chunk_buffer.data(), header_size, &fill_cmd, header_size);
+
+            WriteToFile(chunk_buffer.data(), header_size + compressed_size);
+        }
+        else
+        {
+            fill_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+            fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + chunk_size;
+
+            CombineAndWriteToFile({ { &fill_cmd, header_size }, { chunk_data, chunk_size } });
+        }
+
+        // The buffer of the range that was written is reused for the next range that is not yet being compressed.
+        if ((i + ring_size) < chunk_count)
+        {
+            compress_chunk(i + ring_size);
+        }
+    }
+}
+
 void CommonCaptureManager::WriteCreateHeapAllocationCmd(format::ApiFamilyId api_family,
                                                         uint64_t            allocation_id,
                                                         uint64_t            allocation_size)
@@ -1271,6 +1496,14 @@ void CommonCaptureManager::WriteCreateHeapAllocationCmd(format::ApiFamilyId api_
 
 void CommonCaptureManager::WriteToFile(const void* data, size_t size)
 {
+    WriteBlock(AsyncCaptureWriter::BlockType::kRaw, data, size);
+}
+
+void CommonCaptureManager::WriteBlock(AsyncCaptureWriter::BlockType type, const void* data, size_t size)
+{
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
     if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
     {
         util::PageGuardManager* manager = util::PageGuardManager::Get();
@@ -1279,16 +1512,35 @@ void CommonCaptureManager::WriteToFile(const void* data, size_t size)
             // fwrite hides a lock inside to synchronize writes to files. If a thread is in the middle
             // of a write to the capture file and the uffd mechanism interupts it, it will cause
             // a deadlock as uffd will also try to write to the capture file as well. For this
-            // reason RT signal needs to be disabled while writing.
-            // This can be removed once writing to the capture file(s) is delegated to a separate thread.
+            // reason RT signal needs to be disabled while writing. With asynchronous writes, the
+            // thread's write queue must not be re-entered for the same reason.
             manager->UffdBlockRtSignal();
         }
     }
 
-    file_stream_->Write(data, size);
-    if (force_file_flush_)
+    if (UseAsyncWriter())
+    {
+        if ((thread_data->write_queue_ == nullptr) ||
+            (thread_data->write_queue_->GetWriterId() != async_writer_->GetId()))
+        {
+            thread_data->write_queue_ = async_writer_->CreateThreadQueue();
+        }
+
+        auto queue = thread_data->write_queue_.get();
+        auto block = async_writer_->BeginBlock(queue);
+
+        block->type      = type;
+        block->call_id   = thread_data->call_id_;
+        block->object_id = thread_data->object_id_;
+        block->thread_id = thread_data->thread_id_;
+        block->data.assign(reinterpret_cast<const uint8_t*>(data), reinterpret_cast<const uint8_t*>(data) + size);
+
+        async_writer_->EndBlock(queue, block);
+    }
+    else
     {
-        file_stream_->Flush();
+        assert(type == AsyncCaptureWriter::BlockType::kRaw);
+        WriteToFileStream(data, size);
     }
 
     if (GetMemoryTrackingMode() == CaptureSettings::MemoryTrackingMode::kUserfaultfd)
@@ -1301,12 +1553,276 @@ void CommonCaptureManager::WriteToFile(const void* data, size_t size)
         }
     }
 
-    // Increment block index
-    auto thread_data = GetThreadData();
-    assert(thread_data != nullptr);
+    if (type != AsyncCaptureWriter::BlockType::kFlush)
+    {
+        // Increment block index
+        ++block_index_;
+        thread_data->block_index_ = block_index_.load();
+    }
+}
 
-    ++block_index_;
-    thread_data->block_index_ = block_index_.load();
+util::Compressor*
+CommonCaptureManager::GetCallCompressor(format::ThreadId thread_id, const uint8_t* parameter_data, size_t data_size)
+{
+    if (compressor_ == nullptr)
+    {
+        return nullptr;
+    }
+
+    if (dictionary_sampling_.load(std::memory_order_relaxed) && (data_size <= kMaxDictionarySampleSize))
+    {
+        SampleCompressionDictionary(parameter_data, data_size);
+    }
+
+    // With asynchronous writes, the application thread queues the dictionary in EndApiCallCapture and
+    // EndMethodCallCapture, so that the dictionary block is numbered in the order that blocks are submitted.
+    if (!UseAsyncWriter() && dictionary_trained_.load(std::memory_order_acquire))
+    {
+        UseTrainedCompressionDictionary(thread_id);
+    }
+
+    if (dictionary_ready_.load(std::memory_order_acquire))
+    {
+        return dictionary_compressor_.get();
+    }
+
+    return compressor_.get();
+}
+
+void CommonCaptureManager::SampleCompressionDictionary(const uint8_t* parameter_data, size_t data_size)
+{
+    // The samples of the capture file that was current when sampling started, which remain valid if a new capture file
+    // is started while the sample is copied.
+    std::shared_ptr<DictionarySamples> dictionary_samples = std::atomic_load(&dictionary_samples_);
+
+    if (dictionary_samples == nullptr)
+    {
+        return;
+    }
+
+    const size_t sample_index = dictionary_samples->count.fetch_add(1, std::memory_order_relaxed);
+
+    if (sample_index >= kDictionarySampleCount)
+    {
+        return;
+    }
+
+    // Samples that do not fit in the sample buffer are skipped, leaving an empty sample.
+    const size_t sample_offset = dictionary_samples->bytes.fetch_add(data_size, std::memory_order_relaxed);
+    const bool   sample_fits   = (sample_offset + data_size) <= dictionary_samples->data.size();
+
+    if (sample_fits)
+    {
+        util::platform::MemoryCopy(
+            dictionary_samples->data.data() + sample_offset, data_size, parameter_data, data_size);
+    }
+
+    dictionary_samples->offsets[sample_index] = sample_offset;
+    dictionary_samples->sizes[sample_index]   = sample_fits ? data_size : 0;
+
+    if ((dictionary_samples->done.fetch_add(1, std::memory_order_acq_rel) + 1) == kDictionarySampleCount)
+    {
+        const uint64_t generation = dictionary_samples->generation;
+
+        {
+            std::lock_guard<std::mutex> lock(dictionary_mutex_);
+
+            // Samples of a capture file that has since been replaced are discarded.
+            if (generation != dictionary_generation_)
+            {
+                return;
+            }
+
+            dictionary_sampling_.store(false, std::memory_order_relaxed);
+            std::atomic_store(&dictionary_samples_, std::shared_ptr<DictionarySamples>());
+        }
+
+        // Samples were copied in the order that their ranges were reserved, so gather them in sample order.
+        std::vector<uint8_t> samples;
+        std::vector<size_t>  sample_sizes;
+        samples.reserve(std::min(dictionary_samples->bytes.load(), dictionary_samples->data.size()));
+
+        for (size_t i = 0; i < kDictionarySampleCount; ++i)
+        {
+            if (dictionary_samples->sizes[i] > 0)
+            {
+                const uint8_t* sample = dictionary_samples->data.data() + dictionary_samples->offsets[i];
+                samples.insert(samples.end(), sample, sample + dictionary_samples->sizes[i]);
+                sample_sizes.push_back(dictionary_samples->sizes[i]);
+            }
+        }
+
+        dictionary_trainer_.post_detached(
+            [this, generation, samples = std::move(samples), sample_sizes = std::move(sample_sizes)]() mutable {
+                TrainCompressionDictionary(generation, std::move(samples), std::move(sample_sizes));
+            });
+    }
+}
+
+void CommonCaptureManager::TrainCompressionDictionary(uint64_t             generation,
+                                                      std::vector<uint8_t> samples,
+                                                      std::vector<size_t>  sample_sizes)
+{
+    std::vector<uint8_t> dictionary =
+        dictionary_compressor_->TrainDictionary(samples, sample_sizes, kMaxCompressionDictionary);
+
+    std::lock_guard<std::mutex> lock(dictionary_mutex_);
+
+    // The samples are discarded if a new capture file was started while the dictionary was trained.
+    if (!dictionary.empty() && (generation == dictionary_generation_))
+    {
+        trained_dictionary_ = std::move(dictionary);
+        dictionary_trained_.store(true, std::memory_order_release);
+    }
+}
+
+void CommonCaptureManager::UseTrainedCompressionDictionary(format::ThreadId thread_id)
+{
+    std::lock_guard<std::mutex> lock(dictionary_mutex_);
+
+    if (dictionary_trained_.load(std::memory_order_relaxed))
+    {
+        dictionary_trained_.store(false, std::memory_order_relaxed);
+
+        // The dictionary compressor is not used by other threads until the dictionary is ready.
+        if (dictionary_compressor_->SetDictionary(trained_dictionary_.data(), trained_dictionary_.size()))
+        {
+            // The dictionary must precede the first block that is compressed with it.  A queued dictionary is used
+            // by the writer thread once it has been written.
+            WriteCompressionDictionary(thread_id, trained_dictionary_);
+
+            if (!UseAsyncWriter())
+            {
+                dictionary_ready_.store(true, std::memory_order_release);
+            }
+        }
+
+        std::vector<uint8_t>().swap(trained_dictionary_);
+    }
+}
+
+void CommonCaptureManager::WriteCompressionDictionary(format::ThreadId             thread_id,
+                                                      const std::vector<uint8_t>& dictionary)
+{
+    format::SetCompressionDictionaryCommandHeader dictionary_cmd;
+    dictionary_cmd.meta_header.block_header.size =
+        format::GetMetaDataBlockBaseSize(dictionary_cmd) + dictionary.size();
+    dictionary_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    dictionary_cmd.meta_header.meta_data_id =
+        format::MakeMetaDataId(dictionary_api_family_, format::MetaDataType::kSetCompressionDictionaryCommand);
+    dictionary_cmd.thread_id       = thread_id;
+    dictionary_cmd.dictionary_size = dictionary.size();
+
+    if (UseAsyncWriter())
+    {
+        std::vector<uint8_t>& scratch_buffer = GetThreadData()->GetScratchBuffer();
+        scratch_buffer.clear();
+        scratch_buffer.insert(scratch_buffer.end(),
+                              reinterpret_cast<const uint8_t*>(&dictionary_cmd),
+                              reinterpret_cast<const uint8_t*>(&dictionary_cmd) + sizeof(dictionary_cmd));
+        scratch_buffer.insert(scratch_buffer.end(), dictionary.begin(), dictionary.end());
+
+        WriteBlock(AsyncCaptureWriter::BlockType::kDictionary, scratch_buffer.data(), scratch_buffer.size());
+    }
+    else
+    {
+        CombineAndWriteToFile(
+            { { &dictionary_cmd, sizeof(dictionary_cmd) }, { dictionary.data(), dictionary.size() } });
+    }
+}
+
+void CommonCaptureManager::ResetCompressionDictionary(format::ApiFamilyId api_family)
+{
+    std::lock_guard<std::mutex> lock(dictionary_mutex_);
+
+    ++dictionary_generation_;
+    dictionary_api_family_ = api_family;
+    dictionary_ready_.store(false);
+    dictionary_trained_.store(false);
+    std::vector<uint8_t>().swap(trained_dictionary_);
+    dictionary_sampling_.store(dictionary_compressor_ != nullptr);
+
+    if (dictionary_compressor_ != nullptr)
+    {
+        std::atomic_store(&dictionary_samples_,
+                          std::make_shared<DictionarySamples>(
+                              dictionary_generation_, kDictionarySampleCount, kMaxDictionarySampleBytes));
+    }
+}
+
+void CommonCaptureManager::WriteQueuedBlock(AsyncCaptureWriter::Block& block)
+{
+    switch (block.type)
+    {
+        case AsyncCaptureWriter::BlockType::kRaw:
+            WriteToFileStream(block.data.data(), block.data.size());
+            break;
+        case AsyncCaptureWriter::BlockType::kFunctionCall:
+        {
+            assert(block.data.size() >= sizeof(format::FunctionCallHeader));
+            auto output = BuildFunctionCallBlock(block.call_id,
+                                                 block.thread_id,
+                                                 block.data.data(),
+                                                 block.data.size() - sizeof(format::FunctionCallHeader),
+                                                 &async_compressed_buffer_);
+            WriteToFileStream(output.first, output.second);
+            break;
+        }
+        case AsyncCaptureWriter::BlockType::kMethodCall:
+        {
+            assert(block.data.size() >= sizeof(format::MethodCallHeader));
+            auto output = BuildMethodCallBlock(block.call_id,
+                                               block.object_id,
+                                               block.thread_id,
+                                               block.data.data(),
+                                               block.data.size() - sizeof(format::MethodCallHeader),
+                                               &async_compressed_buffer_);
+            WriteToFileStream(output.first, output.second);
+            break;
+        }
+        case AsyncCaptureWriter::BlockType::kFlush:
+            if (file_stream_ != nullptr)
+            {
+                file_stream_->Flush();
+            }
+            break;
+        case AsyncCaptureWriter::BlockType::kDictionary:
+            WriteToFileStream(block.data.data(), block.data.size());
+            dictionary_ready_.store(true, std::memory_order_release);
+            break;
+        default:
+            GFXRECON_ASSERT(false);
+            break;
+    }
+}
+
+void CommonCaptureManager::WriteToFileStream(const void* data, size_t size)
+{
+    // Blocks that were queued for the asynchronous writer after the capture file was closed are dropped.
+    if (file_stream_ != nullptr)
+    {
+        file_stream_->Write(data, size);
+        if (force_file_flush_)
+        {
+            file_stream_->Flush();
+        }
+    }
+}
+
+void CommonCaptureManager::PauseAsyncWrites()
+{
+    if (async_writer_ != nullptr)
+    {
+        async_writer_->Pause();
+    }
+}
+
+void CommonCaptureManager::ResumeAsyncWrites()
+{
+    if (async_writer_ != nullptr)
+    {
+        async_writer_->Resume();
+    }
 }
 
 void CommonCaptureManager::AtExit()
@@ -1333,6 +1849,28 @@ void CommonCaptureManager::WriteCaptureOptions(std::string& operation_annotation
         buffer += force_file_flush_ ? "true," : "false,";
     }
 
+    const uint32_t compression_threads = capture_settings_.GetTraceSettings().compression_threads;
+    if (compression_threads != default_settings.compression_threads)
+    {
+        buffer += "\n    \"compression-threads\": ";
+        buffer += std::to_string(compression_threads);
+        buffer += ",";
+    }
+
+    const bool compression_dictionary = capture_settings_.GetTraceSettings().compression_dictionary;
+    if (compression_dictionary != default_settings.compression_dictionary)
+    {
+        buffer += "\n    \"compression-dictionary\": ";
+        buffer += compression_dictionary ? "true," : "false,";
+    }
+
+    const bool async_write = capture_settings_.GetTraceSettings().async_write;
+    if (async_write != default_settings.async_write)
+    {
+        buffer += "\n    \"file-async-write\": ";
+        buffer += async_write ? "true," : "false,";
+    }
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
     {
         buffer += "\n    \"memory-tracking-mode\": \"unassisted\",";
@@ -1354,6 +1892,11 @@ void CommonCaptureManager::WriteCaptureOptions(std::string& operation_annotation
             page_guard_options_buffer += "\n    \"page-guard-separate-read\": ";
             page_guard_options_buffer += page_guard_separate_read_ ? "true," : "false,";
         }
+        if (page_guard_diff_ != default_settings.page_guard_diff)
+        {
+            page_guard_options_buffer += "\n    \"page-guard-diff\": ";
+            page_guard_options_buffer += page_guard_diff_ ? "true," : "false,";
+        }
         if (page_guard_external_memory_ != default_settings.page_guard_external_memory)
         {
             page_guard_options_buffer += "\n    \"page-guard-external-memory\": ";
@@ -25,6 +25,7 @@
 #ifndef GFXRECON_ENCODE_CAPTURE_MANAGER_H
 #define GFXRECON_ENCODE_CAPTURE_MANAGER_H
 
+#include "encode/async_capture_writer.h"
 #include "encode/capture_settings.h"
 #include "encode/handle_unwrap_memory.h"
 #include "encode/parameter_buffer.h"
@@ -36,9 +37,11 @@
 #include "util/defines.h"
 #include "util/file_output_stream.h"
 #include "util/keyboard.h"
+#include "util/threadpool.h"
 
 #include <atomic>
 #include <cassert>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
 #include <string>
@@ -200,7 +203,7 @@ class CommonCaptureManager
       public:
         ThreadData();
 
-        ~ThreadData() {}
+        ~ThreadData();
 
         std::vector<uint8_t>& GetScratchBuffer() { return scratch_buffer_; }
 
@@ -214,6 +217,13 @@ class CommonCaptureManager
         HandleUnwrapMemory                       handle_unwrap_memory_;
         uint64_t                                 block_index_;
 
+        // Queue for blocks that are written by the asynchronous capture writer.
+        std::shared_ptr<AsyncCaptureWriter::ThreadQueue> write_queue_;
+
+        // Output buffers for the fill memory ranges that are compressed by the compression thread pool, which are
+        // reused in turn, so there are at most two for each thread of the pool.
+        std::vector<std::vector<uint8_t>> compressed_chunk_buffers_;
+
       private:
         static format::ThreadId GetThreadId();
 
@@ -258,11 +268,12 @@ class CommonCaptureManager
     auto                                GetAccelStructPaddingSetting() const { return accel_struct_padding_; }
     bool                                GetForceFifoPresentModeSetting() const { return force_fifo_present_mode_; }
 
-    util::Compressor*      GetCompressor() { return compressor_.get(); }
-    std::mutex&            GetMappedMemoryLock() { return mapped_memory_lock_; }
-    util::Keyboard&        GetKeyboard() { return keyboard_; }
-    const std::string&     GetScreenshotPrefix() const { return screenshot_prefix_; }
-    util::ScreenshotFormat GetScreenShotFormat() const { return screenshot_format_; }
+    util::Compressor*         GetCompressor() { return compressor_.get(); }
+    format::ParameterEncoding GetParameterEncoding() const { return file_options_.parameter_encoding; }
+    std::mutex&               GetMappedMemoryLock() { return mapped_memory_lock_; }
+    util::Keyboard&           GetKeyboard() { return keyboard_; }
+    const std::string&        GetScreenshotPrefix() const { return screenshot_prefix_; }
+    util::ScreenshotFormat    GetScreenShotFormat() const { return screenshot_format_; }
 
     std::string CreateTrimFilename(const std::string& base_filename, const util::UintRange& trim_range);
     bool        CreateCaptureFile(format::ApiFamilyId api_family, const std::string& base_filename);
@@ -288,6 +299,13 @@ class CommonCaptureManager
 
     void WriteToFile(const void* data, size_t size);
 
+    // Writes all data that has been submitted for writing to the capture file stream, and holds writes from other
+    // threads until ResumeAsyncWrites() is called, so that the calling thread can write to the capture file stream
+    // directly.  Blocks that the calling thread writes in the meantime are written directly.
+    void PauseAsyncWrites();
+
+    void ResumeAsyncWrites();
+
     template <size_t N>
     void CombineAndWriteToFile(const std::pair<const void*, size_t> (&buffers)[N])
     {
@@ -314,6 +332,7 @@ class CommonCaptureManager
 
   protected:
     std::unique_ptr<util::Compressor> compressor_;
+    util::ThreadPool                  compression_pool_;
     std::mutex                        mapped_memory_lock_;
     util::Keyboard                    keyboard_;
     std::string                       screenshot_prefix_;
@@ -323,6 +342,66 @@ class CommonCaptureManager
   private:
     static void AtExit();
 
+    // Fills in the header reserved at the start of block_data and returns the block data to write.  The parameter data
+    // is compressed into compressed_buffer when compression makes the block smaller.
+    std::pair<const void*, size_t> BuildFunctionCallBlock(format::ApiCallId     call_id,
+                                                          format::ThreadId      thread_id,
+                                                          uint8_t*              block_data,
+                                                          size_t                data_size,
+                                                          std::vector<uint8_t>* compressed_buffer);
+
+    std::pair<const void*, size_t> BuildMethodCallBlock(format::ApiCallId     call_id,
+                                                        format::HandleId      object_id,
+                                                        format::ThreadId      thread_id,
+                                                        uint8_t*              block_data,
+                                                        size_t                data_size,
+                                                        std::vector<uint8_t>* compressed_buffer);
+
+    // Returns true when blocks are handed to the asynchronous capture writer, which is the case when asynchronous
+    // writes are enabled and the calling thread has not paused them.
+    bool UseAsyncWriter() const { return (async_writer_ != nullptr) && !async_writer_->IsPausedByCurrentThread(); }
+
+    // Writes the block directly, or hands it to the asynchronous capture writer when asynchronous writes are enabled.
+    void WriteBlock(AsyncCaptureWriter::BlockType type, const void* data, size_t size);
+
+    // Returns the compressor for API call parameter data, which uses the trained dictionary once it has been written
+    // to the capture file.  Collects the parameter data as a dictionary training sample until then.  The thread_id is
+    // the thread of the block that is being built, which also writes the dictionary when it is ready.
+    util::Compressor* GetCallCompressor(format::ThreadId thread_id, const uint8_t* parameter_data, size_t data_size);
+
+    // Copies the parameter data to a reserved range of the sample buffer of the current capture file, without locking.
+    // The thread that completes the last sample posts the dictionary training to the dictionary trainer thread, unless
+    // a new capture file has been started since.
+    void SampleCompressionDictionary(const uint8_t* parameter_data, size_t data_size);
+
+    // Called from the dictionary trainer thread.
+    void TrainCompressionDictionary(uint64_t             generation,
+                                    std::vector<uint8_t> samples,
+                                    std::vector<size_t>  sample_sizes);
+
+    // Applies the trained dictionary and writes it to the capture file, or submits it to the asynchronous capture
+    // writer, ahead of the block of thread_id.
+    void UseTrainedCompressionDictionary(format::ThreadId thread_id);
+
+    void WriteCompressionDictionary(format::ThreadId thread_id, const std::vector<uint8_t>& dictionary);
+
+    // Discards the current dictionary and starts collecting samples for a new capture file.
+    void ResetCompressionDictionary(format::ApiFamilyId api_family);
+
+    // Called from the asynchronous capture writer thread.
+    void WriteQueuedBlock(AsyncCaptureWriter::Block& block);
+
+    void WriteToFileStream(const void* data, size_t size);
+
+    // Splits a large fill memory command into consecutive ranges that are compressed concurrently by the compression
+    // thread pool and written as separate fill memory blocks, in order.  The calling thread waits for the last range:
+    // data points to mapped application memory, which the application may modify once the call that the fill precedes
+    // returns, so compression cannot continue past it without first copying the entire range.  Other large blocks,
+    // such as the init buffer and init image blocks of a trim state snapshot, are compressed on the writing thread.
+    void WriteParallelCompressedFillMemoryCmd(format::FillMemoryCommandHeader fill_cmd,
+                                              const uint8_t*                  data,
+                                              size_t                          size);
+
   private:
     static std::mutex                               instance_lock_;
     static CommonCaptureManager*                    singleton_;
@@ -330,6 +409,24 @@ class CommonCaptureManager
     static std::atomic<format::HandleId>            unique_id_counter_;
     static ApiCallMutexT                            api_call_mutex_;
 
+    // Dictionary training samples of one capture file.  Each capture file gets new sample storage, so that threads that
+    // are still copying a sample for the previous file do not write to the samples of the next one.
+    struct DictionarySamples
+    {
+        DictionarySamples(uint64_t samples_generation, size_t max_sample_count, size_t max_sample_bytes) :
+            generation(samples_generation), data(max_sample_bytes), offsets(max_sample_count),
+            sizes(max_sample_count), count(0), bytes(0), done(0)
+        {}
+
+        const uint64_t       generation;
+        std::vector<uint8_t> data;
+        std::vector<size_t>  offsets;
+        std::vector<size_t>  sizes;
+        std::atomic<size_t>  count;
+        std::atomic<size_t>  bytes;
+        std::atomic<size_t>  done;
+    };
+
     uint32_t instance_count_ = 0;
     struct ApiInstanceRecord
     {
@@ -344,6 +441,18 @@ class CommonCaptureManager
         capture_settings_; // Settings from the settings file and environment at capture manager creation time.
 
     std::unique_ptr<util::FileOutputStream> file_stream_;
+    std::unique_ptr<AsyncCaptureWriter>     async_writer_;
+    std::vector<uint8_t>                    async_compressed_buffer_;
+    std::unique_ptr<util::Compressor>       dictionary_compressor_;
+    std::atomic<bool>                       dictionary_sampling_;
+    std::atomic<bool>                       dictionary_trained_;
+    std::atomic<bool>                       dictionary_ready_;
+    std::mutex                              dictionary_mutex_;
+    uint64_t                                dictionary_generation_;
+    std::shared_ptr<DictionarySamples>      dictionary_samples_;
+    std::vector<uint8_t>                    trained_dictionary_;
+    format::ApiFamilyId                     dictionary_api_family_;
+    util::ThreadPool                        dictionary_trainer_;
     format::EnabledOptions                  file_options_;
     std::string                             base_filename_;
     bool                                    timestamp_filename_;
@@ -356,6 +465,7 @@ class CommonCaptureManager
     uint32_t                                page_guard_signal_handler_watcher_max_restores_;
     PageGuardMemoryMode                     page_guard_memory_mode_;
     bool                                    page_guard_separate_read_;
+    bool                                    page_guard_diff_;
     bool                                    page_guard_copy_on_map_;
     bool                                    page_guard_external_memory_;
     bool                                    trim_enabled_;
@@ -44,12 +44,20 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 // clang-format off
 #define CAPTURE_COMPRESSION_TYPE_LOWER                       "capture_compression_type"
 #define CAPTURE_COMPRESSION_TYPE_UPPER                       "CAPTURE_COMPRESSION_TYPE"
+#define CAPTURE_COMPRESSION_THREADS_LOWER                    "capture_compression_threads"
+#define CAPTURE_COMPRESSION_THREADS_UPPER                    "CAPTURE_COMPRESSION_THREADS"
+#define CAPTURE_COMPRESSION_DICTIONARY_LOWER                 "capture_compression_dictionary"
+#define CAPTURE_COMPRESSION_DICTIONARY_UPPER                 "CAPTURE_COMPRESSION_DICTIONARY"
+#define CAPTURE_COMPACT_PARAMETERS_LOWER                     "capture_compact_parameters"
+#define CAPTURE_COMPACT_PARAMETERS_UPPER                     "CAPTURE_COMPACT_PARAMETERS"
 #define CAPTURE_FILE_NAME_LOWER                              "capture_file"
 #define CAPTURE_FILE_NAME_UPPER                              "CAPTURE_FILE"
 #define CAPTURE_FILE_USE_TIMESTAMP_LOWER                     "capture_file_timestamp"
 #define CAPTURE_FILE_USE_TIMESTAMP_UPPER                     "CAPTURE_FILE_TIMESTAMP"
 #define CAPTURE_FILE_FLUSH_LOWER                             "capture_file_flush"
 #define CAPTURE_FILE_FLUSH_UPPER                             "CAPTURE_FILE_FLUSH"
+#define CAPTURE_FILE_ASYNC_WRITE_LOWER                       "capture_file_async_write"
+#define CAPTURE_FILE_ASYNC_WRITE_UPPER                       "CAPTURE_FILE_ASYNC_WRITE"
 #define LOG_ALLOW_INDENTS_LOWER                              "log_allow_indents"
 #define LOG_ALLOW_INDENTS_UPPER                              "LOG_ALLOW_INDENTS"
 #define LOG_BREAK_ON_ERROR_LOWER                             "log_break_on_error"
@@ -98,6 +106,8 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define PAGE_GUARD_COPY_ON_MAP_UPPER                         "PAGE_GUARD_COPY_ON_MAP"
 #define PAGE_GUARD_SEPARATE_READ_LOWER                       "page_guard_separate_read"
 #define PAGE_GUARD_SEPARATE_READ_UPPER                       "PAGE_GUARD_SEPARATE_READ"
+#define PAGE_GUARD_DIFF_LOWER                                "page_guard_diff"
+#define PAGE_GUARD_DIFF_UPPER                                "PAGE_GUARD_DIFF"
 #define PAGE_GUARD_PERSISTENT_MEMORY_LOWER                   "page_guard_persistent_memory"
 #define PAGE_GUARD_PERSISTENT_MEMORY_UPPER                   "PAGE_GUARD_PERSISTENT_MEMORY"
 #define PAGE_GUARD_ALIGN_BUFFER_SIZES_LOWER                  "page_guard_align_buffer_sizes"
@@ -144,7 +154,11 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 const char CaptureSettings::kDefaultCaptureFileName[] = "/sdcard/gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
 const char kCaptureCompressionTypeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_LOWER;
+const char kCaptureCompressionThreadsEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_LOWER;
+const char kCaptureCompressionDictionaryEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_DICTIONARY_LOWER;
+const char kCaptureCompactParametersEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPACT_PARAMETERS_LOWER;
 const char kCaptureFileFlushEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_LOWER;
+const char kCaptureFileAsyncWriteEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_ASYNC_WRITE_LOWER;
 const char kCaptureFileNameEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_LOWER;
 const char kCaptureFileUseTimestampEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_LOWER;
 const char kLogAllowIndentsEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_LOWER;
@@ -170,6 +184,7 @@ const char kCaptureIUnknownWrappingEnvVar[]                  = GFXRECON_ENV_VAR_
 const char kCaptureQueueSubmitsEnvVar[]                      = GFXRECON_ENV_VAR_PREFIX CAPTURE_QUEUE_SUBMITS_LOWER;
 const char kPageGuardCopyOnMapEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_COPY_ON_MAP_LOWER;
 const char kPageGuardSeparateReadEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SEPARATE_READ_LOWER;
+const char kPageGuardDiffEnvVar[]                            = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_DIFF_LOWER;
 const char kPageGuardPersistentMemoryEnvVar[]                = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PERSISTENT_MEMORY_LOWER;
 const char kPageGuardAlignBufferSizesEnvVar[]                = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_ALIGN_BUFFER_SIZES_LOWER;
 const char kPageGuardTrackAhbMemoryEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_TRACK_AHB_MEMORY_LOWER;
@@ -198,7 +213,11 @@ const char kForceFifoPresentModeEnvVar[]                     = GFXRECON_ENV_VAR_
 const char CaptureSettings::kDefaultCaptureFileName[] = "gfxrecon_capture" GFXRECON_FILE_EXTENSION;
 
 const char kCaptureCompressionTypeEnvVar[]                   = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_UPPER;
+const char kCaptureCompressionThreadsEnvVar[]                = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_THREADS_UPPER;
+const char kCaptureCompressionDictionaryEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_DICTIONARY_UPPER;
+const char kCaptureCompactParametersEnvVar[]                 = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPACT_PARAMETERS_UPPER;
 const char kCaptureFileFlushEnvVar[]                         = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_UPPER;
+const char kCaptureFileAsyncWriteEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_ASYNC_WRITE_UPPER;
 const char kCaptureFileNameEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_UPPER;
 const char kCaptureFileUseTimestampEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_UPPER;
 const char kLogAllowIndentsEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_UPPER;
@@ -220,6 +239,7 @@ const char kCaptureFramesEnvVar[]                            = GFXRECON_ENV_VAR_
 const char kQuitAfterFramesEnvVar[]                          = GFXRECON_ENV_VAR_PREFIX QUIT_AFTER_CAPTURE_FRAMES_UPPER;
 const char kPageGuardCopyOnMapEnvVar[]                       = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_COPY_ON_MAP_UPPER;
 const char kPageGuardSeparateReadEnvVar[]                    = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SEPARATE_READ_UPPER;
+const char kPageGuardDiffEnvVar[]                            = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_DIFF_UPPER;
 const char kPageGuardPersistentMemoryEnvVar[]                = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PERSISTENT_MEMORY_UPPER;
 const char kPageGuardAlignBufferSizesEnvVar[]                = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_ALIGN_BUFFER_SIZES_UPPER;
 const char kPageGuardTrackAhbMemoryEnvVar[]                  = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_TRACK_AHB_MEMORY_UPPER;
@@ -250,8 +270,12 @@ const char kForceFifoPresentModeEnvVar[]                     = GFXRECON_ENV_VAR_
 const char kSettingsFilter[] = "lunarg_gfxreconstruct.";
 
 const std::string kOptionKeyCaptureCompressionType                   = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_TYPE_LOWER);
+const std::string kOptionKeyCaptureCompressionThreads                = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_THREADS_LOWER);
+const std::string kOptionKeyCaptureCompressionDictionary             = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_DICTIONARY_LOWER);
+const std::string kOptionKeyCaptureCompactParameters                 = std::string(kSettingsFilter) + std::string(CAPTURE_COMPACT_PARAMETERS_LOWER);
 const std::string kOptionKeyCaptureFile                              = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_NAME_LOWER);
 const std::string kOptionKeyCaptureFileForceFlush                    = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_FLUSH_LOWER);
+const std::string kOptionKeyCaptureFileAsyncWrite                    = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_ASYNC_WRITE_LOWER);
 const std::string kOptionKeyCaptureFileUseTimestamp                  = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_USE_TIMESTAMP_LOWER);
 const std::string kOptionKeyLogAllowIndents                          = std::string(kSettingsFilter) + std::string(LOG_ALLOW_INDENTS_LOWER);
 const std::string kOptionKeyLogBreakOnError                          = std::string(kSettingsFilter) + std::string(LOG_BREAK_ON_ERROR_LOWER);
@@ -276,6 +300,7 @@ const std::string kOptionKeyCaptureIUnknownWrapping                  = std::stri
 const std::string kOptionKeyCaptureQueueSubmits                      = std::string(kSettingsFilter) + std::string(CAPTURE_QUEUE_SUBMITS_LOWER);
 const std::string kOptionKeyPageGuardCopyOnMap                       = std::string(kSettingsFilter) + std::string(PAGE_GUARD_COPY_ON_MAP_LOWER);
 const std::string kOptionKeyPageGuardSeparateRead                    = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SEPARATE_READ_LOWER);
+const std::string kOptionKeyPageGuardDiff                            = std::string(kSettingsFilter) + std::string(PAGE_GUARD_DIFF_LOWER);
 const std::string kOptionKeyPageGuardPersistentMemory                = std::string(kSettingsFilter) + std::string(PAGE_GUARD_PERSISTENT_MEMORY_LOWER);
 const std::string kOptionKeyPageGuardAlignBufferSizes                = std::string(kSettingsFilter) + std::string(PAGE_GUARD_ALIGN_BUFFER_SIZES_LOWER);
 const std::string kOptionKeyPageGuardTrackAhbMemory                  = std::string(kSettingsFilter) + std::string(PAGE_GUARD_TRACK_AHB_MEMORY_LOWER);
@@ -388,7 +413,11 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kCaptureFileNameEnvVar, kOptionKeyCaptureFile);
     LoadSingleOptionEnvVar(options, kCaptureFileUseTimestampEnvVar, kOptionKeyCaptureFileUseTimestamp);
     LoadSingleOptionEnvVar(options, kCaptureCompressionTypeEnvVar, kOptionKeyCaptureCompressionType);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionThreadsEnvVar, kOptionKeyCaptureCompressionThreads);
+    LoadSingleOptionEnvVar(options, kCaptureCompressionDictionaryEnvVar, kOptionKeyCaptureCompressionDictionary);
+    LoadSingleOptionEnvVar(options, kCaptureCompactParametersEnvVar, kOptionKeyCaptureCompactParameters);
     LoadSingleOptionEnvVar(options, kCaptureFileFlushEnvVar, kOptionKeyCaptureFileForceFlush);
+    LoadSingleOptionEnvVar(options, kCaptureFileAsyncWriteEnvVar, kOptionKeyCaptureFileAsyncWrite);
 
     // Logging environment variables
     LoadSingleOptionEnvVar(options, kLogAllowIndentsEnvVar, kOptionKeyLogAllowIndents);
@@ -416,6 +445,7 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     // Page guard environment variables
     LoadSingleOptionEnvVar(options, kPageGuardCopyOnMapEnvVar, kOptionKeyPageGuardCopyOnMap);
     LoadSingleOptionEnvVar(options, kPageGuardSeparateReadEnvVar, kOptionKeyPageGuardSeparateRead);
+    LoadSingleOptionEnvVar(options, kPageGuardDiffEnvVar, kOptionKeyPageGuardDiff);
     LoadSingleOptionEnvVar(options, kPageGuardPersistentMemoryEnvVar, kOptionKeyPageGuardPersistentMemory);
     LoadSingleOptionEnvVar(options, kPageGuardAlignBufferSizesEnvVar, kOptionKeyPageGuardAlignBufferSizes);
     LoadSingleOptionEnvVar(options, kPageGuardTrackAhbMemoryEnvVar, kOptionKeyPageGuardTrackAhbMemory);
@@ -483,12 +513,25 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
     // Capture file options
     settings->trace_settings_.capture_file_options.compression_type =
         ParseCompressionTypeString(FindOption(options, kOptionKeyCaptureCompressionType), kDefaultCompressionType);
+    settings->trace_settings_.compression_threads = gfxrecon::util::ParseUintString(
+        FindOption(options, kOptionKeyCaptureCompressionThreads), settings->trace_settings_.compression_threads);
+    settings->trace_settings_.compression_dictionary =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureCompressionDictionary),
+                        settings->trace_settings_.compression_dictionary);
+    settings->trace_settings_.capture_file_options.parameter_encoding =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureCompactParameters),
+                        settings->trace_settings_.capture_file_options.parameter_encoding ==
+                            format::ParameterEncoding::kCompact)
+            ? format::ParameterEncoding::kCompact
+            : format::ParameterEncoding::kFixedSize;
     settings->trace_settings_.capture_file =
         FindOption(options, kOptionKeyCaptureFile, settings->trace_settings_.capture_file);
     settings->trace_settings_.time_stamp_file = ParseBoolString(FindOption(options, kOptionKeyCaptureFileUseTimestamp),
                                                                 settings->trace_settings_.time_stamp_file);
     settings->trace_settings_.force_flush =
         ParseBoolString(FindOption(options, kOptionKeyCaptureFileForceFlush), settings->trace_settings_.force_flush);
+    settings->trace_settings_.async_write =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureFileAsyncWrite), settings->trace_settings_.async_write);
 
     // Memory tracking options
     settings->trace_settings_.memory_tracking_mode = ParseMemoryTrackingModeString(
@@ -555,6 +598,8 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
         FindOption(options, kOptionKeyPageGuardCopyOnMap), settings->trace_settings_.page_guard_copy_on_map);
     settings->trace_settings_.page_guard_separate_read = ParseBoolString(
         FindOption(options, kOptionKeyPageGuardSeparateRead), settings->trace_settings_.page_guard_separate_read);
+    settings->trace_settings_.page_guard_diff =
+        ParseBoolString(FindOption(options, kOptionKeyPageGuardDiff), settings->trace_settings_.page_guard_diff);
     settings->trace_settings_.page_guard_persistent_memory =
         ParseBoolString(FindOption(options, kOptionKeyPageGuardPersistentMemory),
                         settings->trace_settings_.page_guard_persistent_memory);
@@ -91,8 +91,11 @@ class CaptureSettings
     {
         std::string                  capture_file{ kDefaultCaptureFileName };
         format::EnabledOptions       capture_file_options;
+        uint32_t                     compression_threads{ 0 };
+        bool                         compression_dictionary{ false };
         bool                         time_stamp_file{ true };
         bool                         force_flush{ false };
+        bool                         async_write{ false };
         MemoryTrackingMode           memory_tracking_mode{ kPageGuard };
         std::string                  screenshot_dir;
         std::vector<util::UintRange> screenshot_ranges;
@@ -105,6 +108,7 @@ class CaptureSettings
         int                          page_guard_signal_handler_watcher_max_restores{ 1 };
         bool                         page_guard_copy_on_map{ util::PageGuardManager::kDefaultEnableCopyOnMap };
         bool                         page_guard_separate_read{ util::PageGuardManager::kDefaultEnableSeparateRead };
+        bool                         page_guard_diff{ util::PageGuardManager::kDefaultEnableDiff };
         bool                         page_guard_persistent_memory{ false };
         bool                         page_guard_align_buffer_sizes{ true };
         bool                         page_guard_track_ahb_memory{ false };
@@ -123,6 +123,11 @@ static void EncodeDescriptorUpdateTemplateInfo(VulkanCaptureManager*     manager
 {
     assert((manager != nullptr) && (encoder != nullptr));
 
+    // The template data is always written with ParameterEncoding::kFixedSize, because the decoder computes the sizes of
+    // the template entries before decoding them.
+    format::ParameterEncoding parameter_encoding = encoder->GetParameterEncoding();
+    encoder->SetParameterEncoding(format::ParameterEncoding::kFixedSize);
+
     if (info != nullptr)
     {
         // Write pointer attributes as if we were processing a struct pointer.
@@ -207,6 +212,8 @@ static void EncodeDescriptorUpdateTemplateInfo(VulkanCaptureManager*     manager
     {
         encoder->EncodeStructArrayPreamble(data, 0);
     }
+
+    encoder->SetParameterEncoding(parameter_encoding);
 }
 
 VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSetWithTemplate(VkDevice                   device,
@@ -171,7 +171,7 @@ void D3D12CaptureManager::EndCommandListMethodCallCapture(ID3D12CommandList_Wrap
 
 void D3D12CaptureManager::WriteTrackedState(util::FileOutputStream* file_stream, format::ThreadId thread_id)
 {
-    Dx12StateWriter state_writer(file_stream, GetCompressor(), thread_id);
+    Dx12StateWriter state_writer(file_stream, GetCompressor(), thread_id, GetParameterEncoding());
     state_tracker_->WriteState(&state_writer, GetCurrentFrame());
 }
 
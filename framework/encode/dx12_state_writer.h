@@ -50,7 +50,10 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class Dx12StateWriter
 {
   public:
-    Dx12StateWriter(util::FileOutputStream* output_stream, util::Compressor* compressor, format::ThreadId thread_id);
+    Dx12StateWriter(util::FileOutputStream*   output_stream,
+                    util::Compressor*         compressor,
+                    format::ThreadId          thread_id,
+                    format::ParameterEncoding parameter_encoding);
 
     ~Dx12StateWriter();
     
@@ -41,7 +41,7 @@ class ParameterBuffer : public util::MemoryOutputStream
     {
         MemoryOutputStream::Clear();
         header_size_ = header_size;
-        GetBuffer()->resize(header_size_);
+        Resize(header_size_);
     }
 
     virtual void Clear() override
@@ -51,7 +51,7 @@ class ParameterBuffer : public util::MemoryOutputStream
     }
 
     // Returns a pointer to the header data or nullptr if no header data was reserved.
-    uint8_t* GetHeaderData() { return (header_size_ > 0) ? GetBuffer()->data() : nullptr; };
+    uint8_t* GetHeaderData() { return (header_size_ > 0) ? GetBufferData() : nullptr; };
 
     // Returns the number of bytes reserved for the header at the start of the buffer.
     size_t GetHeaderDataSize() const { return header_size_; }
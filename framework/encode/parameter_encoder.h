@@ -31,8 +31,9 @@
 #endif
 
 #include "format/format.h"
+#include "format/varint.h"
 #include "util/defines.h"
-#include "util/output_stream.h"
+#include "util/memory_output_stream.h"
 #include "util/platform.h"
 
 #include "vulkan/vulkan.h"
@@ -48,10 +49,18 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class ParameterEncoder
 {
   public:
-    ParameterEncoder(util::OutputStream* stream) : output_stream_(stream) {}
+    ParameterEncoder(util::MemoryOutputStream* stream,
+                     format::ParameterEncoding encoding = format::ParameterEncoding::kFixedSize) :
+        output_stream_(stream),
+        encoding_(encoding)
+    {}
 
     ~ParameterEncoder() {}
 
+    format::ParameterEncoding GetParameterEncoding() const { return encoding_; }
+
+    void SetParameterEncoding(format::ParameterEncoding encoding) { encoding_ = encoding; }
+
     // clang-format off
 
     // Values
@@ -65,23 +74,23 @@ class ParameterEncoder
     void EncodeUInt64Value(uint64_t value)                                                                            { EncodeValue(value); }
     void EncodeFloatValue(float value)                                                                                { EncodeValue(value); }
     void EncodeDoubleValue(double value)                                                                              { EncodeValue(value); }
-    void EncodeSizeTValue(size_t value)                                                                               { EncodeValue(static_cast<format::SizeTEncodeType>(value)); }
-    void EncodeHandleIdValue(format::HandleId value)                                                                  { EncodeValue(static_cast<format::HandleEncodeType>(value)); }
+    void EncodeSizeTValue(size_t value)                                                                               { EncodeCompactValue<format::SizeTEncodeType>(value); }
+    void EncodeHandleIdValue(format::HandleId value)                                                                  { EncodeCompactValue<format::HandleEncodeType>(value); }
 
     // Encode the address values for pointers to non-Vulkan objects to be used as object IDs.
-    void EncodeAddress(const void* value)                                                                             { EncodeValue(reinterpret_cast<format::AddressEncodeType>(value)); }
+    void EncodeAddress(const void* value)                                                                             { EncodeCompactValue<format::AddressEncodeType>(value); }
     void EncodeVoidPtr(const void* value)                                                                             { EncodeAddress(value); }
     template<typename T>
-    void EncodeFunctionPtr(T value)                                                                                   { EncodeValue(reinterpret_cast<format::AddressEncodeType>(value)); }
+    void EncodeFunctionPtr(T value)                                                                                   { EncodeCompactValue<format::AddressEncodeType>(value); }
 
     template<typename Wrapper>
     void EncodeVulkanHandleValue(typename Wrapper::HandleType value)                                                  { EncodeHandleIdValue(vulkan_wrappers::GetWrappedId<Wrapper>(value)); }
     template<typename T>
-    void EncodeEnumValue(T value)                                                                                     { EncodeValue(static_cast<format::EnumEncodeType>(value)); }
+    void EncodeEnumValue(T value)                                                                                     { EncodeCompactValue<format::EnumEncodeType>(value); }
     template<typename T>
-    void EncodeFlagsValue(T value)                                                                                    { EncodeValue(static_cast<format::FlagsEncodeType>(value)); }
+    void EncodeFlagsValue(T value)                                                                                    { EncodeCompactValue<format::FlagsEncodeType>(value); }
     template<typename T>
-    void EncodeFlags64Value(T value)                                                                                  { EncodeValue(static_cast<format::Flags64EncodeType>(value)); }
+    void EncodeFlags64Value(T value)                                                                                  { EncodeCompactValue<format::Flags64EncodeType>(value); }
 
     // Pointers
     void EncodeUInt8Ptr(const uint8_t* ptr, bool omit_data = false, bool omit_addr = false)                           { EncodePointer(ptr, omit_data, omit_addr); }
@@ -99,21 +108,21 @@ class ParameterEncoder
     void EncodeInt64Ptr(const int64_t* ptr, bool omit_data = false, bool omit_addr = false)                           { EncodePointer(ptr, omit_data, omit_addr); }
     void EncodeUInt64Ptr(const uint64_t* ptr, bool omit_data = false, bool omit_addr = false)                         { EncodePointer(ptr, omit_data, omit_addr); }
     void EncodeFloatPtr(const float* ptr, bool omit_data = false, bool omit_addr = false)                             { EncodePointer(ptr, omit_data, omit_addr); }
-    void EncodeSizeTPtr(const size_t* ptr, bool omit_data = false, bool omit_addr = false)                            { EncodePointerConverted<format::SizeTEncodeType>(ptr, omit_data, omit_addr); }
-    void EncodeHandleIdPtr(const format::HandleId* ptr, bool omit_data = false, bool omit_addr = false)               { EncodePointerConverted<format::HandleEncodeType>(ptr, omit_data, omit_addr); }
+    void EncodeSizeTPtr(const size_t* ptr, bool omit_data = false, bool omit_addr = false)                            { EncodeCompactPointer<format::SizeTEncodeType>(ptr, omit_data, omit_addr); }
+    void EncodeHandleIdPtr(const format::HandleId* ptr, bool omit_data = false, bool omit_addr = false)               { EncodeHandleIdPointer(ptr, omit_data, omit_addr); }
 
     // Treat pointers to non-Vulkan objects as 64-bit object IDs.
     template<typename T>
-    void EncodeVoidPtrPtr(const T* const* ptr, bool omit_data = false, bool omit_addr = false)                        { EncodePointerConverted<format::AddressEncodeType>(ptr, omit_data, omit_addr); }
+    void EncodeVoidPtrPtr(const T* const* ptr, bool omit_data = false, bool omit_addr = false)                        { EncodeCompactPointer<format::AddressEncodeType>(ptr, omit_data, omit_addr); }
 
     template<typename Wrapper>
     void EncodeVulkanHandlePtr(const typename Wrapper::HandleType* ptr, bool omit_data = false, bool omit_addr = false) { EncodeWrappedVulkanHandlePointer<Wrapper>(ptr, omit_data, omit_addr); }
     template<typename T>
-    void EncodeEnumPtr(const T* ptr, bool omit_data = false, bool omit_addr = false)                                  { EncodePointerConverted<format::EnumEncodeType>(ptr, omit_data, omit_addr); }
+    void EncodeEnumPtr(const T* ptr, bool omit_data = false, bool omit_addr = false)                                  { EncodeCompactPointer<format::EnumEncodeType>(ptr, omit_data, omit_addr); }
     template<typename T>
-    void EncodeFlagsPtr(const T* ptr, bool omit_data = false, bool omit_addr = false)                                 { EncodePointerConverted<format::FlagsEncodeType>(ptr, omit_data, omit_addr); }
+    void EncodeFlagsPtr(const T* ptr, bool omit_data = false, bool omit_addr = false)                                 { EncodeCompactPointer<format::FlagsEncodeType>(ptr, omit_data, omit_addr); }
     template<typename T>
-    void EncodeFlags64Ptr(const T* ptr, bool omit_data = false, bool omit_addr = false)                               { EncodePointerConverted<format::Flags64EncodeType>(ptr, omit_data, omit_addr); }
+    void EncodeFlags64Ptr(const T* ptr, bool omit_data = false, bool omit_addr = false)                               { EncodeCompactPointer<format::Flags64EncodeType>(ptr, omit_data, omit_addr); }
 
     // Arrays
     void EncodeInt8Array(const int8_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)               { EncodeArray(arr, len, omit_data, omit_addr); }
@@ -124,8 +133,8 @@ class ParameterEncoder
     void EncodeInt64Array(const int64_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)             { EncodeArray(arr, len, omit_data, omit_addr); }
     void EncodeUInt64Array(const uint64_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)           { EncodeArray(arr, len, omit_data, omit_addr); }
     void EncodeFloatArray(const float* arr, size_t len, bool omit_data = false, bool omit_addr = false)               { EncodeArray(arr, len, omit_data, omit_addr); }
-    void EncodeSizeTArray(const size_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)              { EncodeArrayConverted<format::SizeTEncodeType>(arr, len, omit_data, omit_addr); }
-    void EncodeHandleIdArray(const format::HandleId* arr, size_t len, bool omit_data = false, bool omit_addr = false) { EncodeArrayConverted<format::HandleEncodeType>(arr, len, omit_data, omit_addr); }
+    void EncodeSizeTArray(const size_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)              { EncodeCompactArray<format::SizeTEncodeType>(arr, len, omit_data, omit_addr); }
+    void EncodeHandleIdArray(const format::HandleId* arr, size_t len, bool omit_data = false, bool omit_addr = false) { EncodeHandleIdArrayDeltas(arr, len, omit_data, omit_addr); }
 
     // Array of bytes.
     void EncodeUInt8Array(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)                { EncodeArray(reinterpret_cast<const uint8_t*>(arr), len, omit_data, omit_addr); }
@@ -134,11 +143,11 @@ class ParameterEncoder
     template<typename Wrapper>
     void EncodeVulkanHandleArray(const typename Wrapper::HandleType* arr, size_t len, bool omit_data = false, bool omit_addr = false) { EncodeWrappedVulkanHandleArray<Wrapper>(arr, len, omit_data, omit_addr); }
     template<typename T>
-    void EncodeEnumArray(const T* arr, size_t len, bool omit_data = false, bool omit_addr = false)                    { EncodeArrayConverted<format::EnumEncodeType>(arr, len, omit_data, omit_addr); }
+    void EncodeEnumArray(const T* arr, size_t len, bool omit_data = false, bool omit_addr = false)                    { EncodeCompactArray<format::EnumEncodeType>(arr, len, omit_data, omit_addr); }
     template<typename T>
-    void EncodeFlagsArray(const T* arr, size_t len, bool omit_data = false, bool omit_addr = false)                   { EncodeArrayConverted<format::FlagsEncodeType>(arr, len, omit_data, omit_addr); }
+    void EncodeFlagsArray(const T* arr, size_t len, bool omit_data = false, bool omit_addr = false)                   { EncodeCompactArray<format::FlagsEncodeType>(arr, len, omit_data, omit_addr); }
     template<typename T>
-    void EncodeFlags64Array(const T* arr, size_t len, bool omit_data = false, bool omit_addr = false)                 { EncodeArrayConverted<format::Flags64EncodeType>(arr, len, omit_data, omit_addr); }
+    void EncodeFlags64Array(const T* arr, size_t len, bool omit_data = false, bool omit_addr = false)                 { EncodeCompactArray<format::Flags64EncodeType>(arr, len, omit_data, omit_addr); }
 
     void EncodeString(const char* str, bool omit_data = false, bool omit_addr = false)                                { EncodeBasicString<char, format::CharEncodeType, format::PointerAttributes::kIsString>(str, omit_data, omit_addr); }
     void EncodeWString(const wchar_t* str, bool omit_data = false, bool omit_addr = false)                            { EncodeBasicString<wchar_t, format::WCharEncodeType, format::PointerAttributes::kIsWString>(str, omit_data, omit_addr); }
@@ -171,12 +180,7 @@ class ParameterEncoder
         uint32_t pointer_attrib = format::PointerAttributes::kIsStruct | format::PointerAttributes::kIsSingle |
                                   GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
-
-        if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
-        {
-            EncodeAddress(ptr);
-        }
+        EncodePointerPreamble(pointer_attrib, ptr, false, 0, 0);
     }
 
     void EncodeStructArrayPreamble(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)
@@ -184,18 +188,7 @@ class ParameterEncoder
         uint32_t pointer_attrib = format::PointerAttributes::kIsStruct | format::PointerAttributes::kIsArray |
                                   GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
-
-        if (arr != nullptr)
-        {
-            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
-            {
-                EncodeAddress(arr);
-            }
-
-            // Always write the array size when the pointer is not null.
-            EncodeSizeTValue(len);
-        }
+        EncodePointerPreamble(pointer_attrib, arr, true, len, 0);
     }
 
     void EncodeStructArray2DPreamble(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)
@@ -203,18 +196,7 @@ class ParameterEncoder
         uint32_t pointer_attrib = format::PointerAttributes::kIsStruct | format::PointerAttributes::kIsArray2D |
                                   GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
-
-        if (arr != nullptr)
-        {
-            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
-            {
-                EncodeAddress(arr);
-            }
-
-            // Always write the array size when the pointer is not null.
-            EncodeSizeTValue(len);
-        }
+        EncodePointerPreamble(pointer_attrib, arr, true, len, 0);
     }
 
 #if defined(WIN32)
@@ -241,7 +223,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (ptr != nullptr)
         {
@@ -252,7 +234,18 @@ class ParameterEncoder
 
             if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
             {
-                EncodeObjectValue<T>(*ptr);
+                if (encoding_ == format::ParameterEncoding::kCompact)
+                {
+                    // Handle IDs referenced by pointers are decoded as deltas from a null handle ID.
+                    format::HandleId previous = format::kNullHandleId;
+                    uint8_t*         begin    = output_stream_->Reserve(format::kMaxVarintSize);
+                    uint8_t*         end      = StoreHandleIdDelta(begin, GetDx12WrappedId<T>(*ptr), &previous);
+                    output_stream_->Commit(end - begin);
+                }
+                else
+                {
+                    EncodeObjectValue<T>(*ptr);
+                }
             }
         }
     }
@@ -269,7 +262,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (arr != nullptr)
         {
@@ -283,9 +276,20 @@ class ParameterEncoder
 
             if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
             {
+                format::HandleId previous = format::kNullHandleId;
+
                 for (size_t i = 0; i < len; ++i)
                 {
-                    EncodeObjectValue<T>(arr[i]);
+                    if (encoding_ == format::ParameterEncoding::kCompact)
+                    {
+                        uint8_t* begin = output_stream_->Reserve(format::kMaxVarintSize);
+                        uint8_t* end   = StoreHandleIdDelta(begin, GetDx12WrappedId<T>(arr[i]), &previous);
+                        output_stream_->Commit(end - begin);
+                    }
+                    else
+                    {
+                        EncodeObjectValue<T>(arr[i]);
+                    }
                 }
             }
         }
@@ -294,7 +298,7 @@ class ParameterEncoder
 
     void EncodeRawBytes(const void* bytes, size_t num_bytes)
     {
-        output_stream_->Write(bytes, num_bytes);
+        output_stream_->Append(bytes, num_bytes);
     }
 
   private:
@@ -322,24 +326,223 @@ class ParameterEncoder
         return pointer_attrib;
     }
 
+    // Writes a value to a location previously returned by MemoryOutputStream::Allocate() and returns the location
+    // that follows it.
+    template <typename T>
+    static uint8_t* StoreValue(uint8_t* dst, T value)
+    {
+        memcpy(dst, &value, sizeof(T));
+        return dst + sizeof(T);
+    }
+
+    // Writes the attributes, address, and array length that precede pointer data, and reserves data_size bytes for
+    // the pointer data, with a single capacity check for the whole pointer.  Returns the location of the reserved data,
+    // or nullptr if the pointer attributes do not include data.
+    uint8_t*
+    EncodePointerPreamble(uint32_t pointer_attrib, const void* ptr, bool is_array, size_t len, size_t data_size)
+    {
+        const bool has_address =
+            (pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress;
+        const bool has_data =
+            (pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData;
+
+        // Array sizes are always written when the pointer is not null.
+        const bool has_length = is_array && (ptr != nullptr);
+
+        if (encoding_ == format::ParameterEncoding::kCompact)
+        {
+            size_t   size  = has_data ? data_size : 0;
+            uint8_t* begin = output_stream_->Reserve(kMaxCompactPreambleSize + size);
+            uint8_t* dst   = StoreCompactPointerPreamble(begin, pointer_attrib, ptr, has_address, has_length, len);
+            output_stream_->Commit((dst - begin) + size);
+            return has_data ? dst : nullptr;
+        }
+
+        size_t size = sizeof(pointer_attrib);
+        size += has_address ? sizeof(format::AddressEncodeType) : 0;
+        size += has_length ? sizeof(format::SizeTEncodeType) : 0;
+        size += has_data ? data_size : 0;
+
+        uint8_t* dst = StoreValue(output_stream_->Allocate(size), pointer_attrib);
+
+        if (has_address)
+        {
+            dst = StoreValue(dst, reinterpret_cast<format::AddressEncodeType>(ptr));
+        }
+
+        if (has_length)
+        {
+            dst = StoreValue(dst, static_cast<format::SizeTEncodeType>(len));
+        }
+
+        return has_data ? dst : nullptr;
+    }
+
+    // Writes the attributes, address, and array length that precede pointer data for ParameterEncoding::kCompact,
+    // where the address and length are varints.  The caller must provide kMaxCompactPreambleSize bytes.
+    static uint8_t* StoreCompactPointerPreamble(
+        uint8_t* dst, uint32_t pointer_attrib, const void* ptr, bool has_address, bool has_length, size_t len)
+    {
+        dst = StoreValue(dst, pointer_attrib);
+
+        if (has_address)
+        {
+            dst = format::StoreVarint(dst, reinterpret_cast<format::AddressEncodeType>(ptr));
+        }
+
+        if (has_length)
+        {
+            dst = format::StoreVarint(dst, static_cast<format::SizeTEncodeType>(len));
+        }
+
+        return dst;
+    }
+
     template <typename DstT, typename SrcT>
-    typename std::enable_if<!std::is_pointer<SrcT>::value && !std::is_pointer<DstT>::value, DstT>::type
+    static typename std::enable_if<!std::is_pointer<SrcT>::value && !std::is_pointer<DstT>::value, DstT>::type
     TypeCast(SrcT value)
     {
         return static_cast<DstT>(value);
     }
 
     template <typename DstT, typename SrcT>
-    typename std::enable_if<std::is_pointer<SrcT>::value || std::is_pointer<DstT>::value, DstT>::type
+    static typename std::enable_if<std::is_pointer<SrcT>::value || std::is_pointer<DstT>::value, DstT>::type
     TypeCast(SrcT value)
     {
         return reinterpret_cast<DstT>(value);
     }
 
+    void EncodeVarint(uint64_t value)
+    {
+        uint8_t* begin = output_stream_->Reserve(format::kMaxVarintSize);
+        output_stream_->Commit(format::StoreVarint(begin, value) - begin);
+    }
+
+    // Writes a handle ID as the zigzag encoded difference from the previous handle ID of the same array, and updates
+    // previous with the handle ID.  Returns the location that follows the written value.
+    static uint8_t* StoreHandleIdDelta(uint8_t* dst, format::HandleId value, format::HandleId* previous)
+    {
+        dst         = format::StoreVarint(dst, format::ZigZagEncode(static_cast<int64_t>(value - (*previous))));
+        (*previous) = value;
+        return dst;
+    }
+
+    // Values for the handle ID, size_t, address, enum, and flags encode types are written as varints when the
+    // compact parameter encoding is enabled, and with the size of DstT otherwise.
+    template <typename DstT, typename SrcT>
+    void EncodeCompactValue(SrcT value)
+    {
+        if (encoding_ == format::ParameterEncoding::kCompact)
+        {
+            EncodeVarint(static_cast<uint64_t>(TypeCast<DstT>(value)));
+        }
+        else
+        {
+            EncodeValue(TypeCast<DstT>(value));
+        }
+    }
+
+    // Writes a pointer to len values as varints.  When is_delta is true, values are handle IDs that are written with
+    // StoreHandleIdDelta(), which is used for all handle IDs referenced by pointers, including single values.  to_value
+    // converts elements of ptr to the value to encode.
+    template <typename SrcT, typename ToValue>
+    void EncodeVarintPointer(
+        uint32_t pointer_attrib, const SrcT* ptr, bool is_array, size_t len, bool is_delta, ToValue to_value)
+    {
+        const bool has_data =
+            (pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData;
+        const bool has_address =
+            (pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress;
+
+        uint8_t* begin =
+            output_stream_->Reserve(kMaxCompactPreambleSize + (has_data ? (len * format::kMaxVarintSize) : 0));
+        uint8_t* dst =
+            StoreCompactPointerPreamble(begin, pointer_attrib, ptr, has_address, is_array && (ptr != nullptr), len);
+
+        if (has_data)
+        {
+            format::HandleId previous = format::kNullHandleId;
+
+            for (size_t i = 0; i < len; ++i)
+            {
+                uint64_t value = to_value(ptr[i]);
+                dst            = is_delta ? StoreHandleIdDelta(dst, value, &previous) : format::StoreVarint(dst, value);
+            }
+        }
+
+        output_stream_->Commit(dst - begin);
+    }
+
+    template <typename DstT, typename SrcT>
+    void EncodeCompactPointer(const SrcT* ptr, bool omit_data, bool omit_addr)
+    {
+        if (encoding_ == format::ParameterEncoding::kCompact)
+        {
+            uint32_t pointer_attrib =
+                format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
+
+            EncodeVarintPointer(pointer_attrib, ptr, false, 1, false, [](const SrcT& value) {
+                return static_cast<uint64_t>(TypeCast<DstT>(value));
+            });
+        }
+        else
+        {
+            EncodePointerConverted<DstT>(ptr, omit_data, omit_addr);
+        }
+    }
+
+    template <typename DstT, typename SrcT>
+    void EncodeCompactArray(const SrcT* arr, size_t len, bool omit_data, bool omit_addr)
+    {
+        if (encoding_ == format::ParameterEncoding::kCompact)
+        {
+            uint32_t pointer_attrib =
+                format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
+
+            EncodeVarintPointer(pointer_attrib, arr, true, len, false, [](const SrcT& value) {
+                return static_cast<uint64_t>(TypeCast<DstT>(value));
+            });
+        }
+        else
+        {
+            EncodeArrayConverted<DstT>(arr, len, omit_data, omit_addr);
+        }
+    }
+
+    void EncodeHandleIdPointer(const format::HandleId* ptr, bool omit_data, bool omit_addr)
+    {
+        if (encoding_ == format::ParameterEncoding::kCompact)
+        {
+            uint32_t pointer_attrib =
+                format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
+
+            EncodeVarintPointer(pointer_attrib, ptr, false, 1, true, [](format::HandleId value) { return value; });
+        }
+        else
+        {
+            EncodePointerConverted<format::HandleEncodeType>(ptr, omit_data, omit_addr);
+        }
+    }
+
+    void EncodeHandleIdArrayDeltas(const format::HandleId* arr, size_t len, bool omit_data, bool omit_addr)
+    {
+        if (encoding_ == format::ParameterEncoding::kCompact)
+        {
+            uint32_t pointer_attrib =
+                format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
+
+            EncodeVarintPointer(pointer_attrib, arr, true, len, true, [](format::HandleId value) { return value; });
+        }
+        else
+        {
+            EncodeArrayConverted<format::HandleEncodeType>(arr, len, omit_data, omit_addr);
+        }
+    }
+
     template <typename T>
     void EncodeValue(T value)
     {
-        output_stream_->Write(&value, sizeof(T));
+        output_stream_->Append(&value, sizeof(T));
     }
 
     template <typename T>
@@ -348,19 +551,11 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        uint8_t* data = EncodePointerPreamble(pointer_attrib, ptr, false, 0, sizeof(T));
 
-        if (ptr != nullptr)
+        if (data != nullptr)
         {
-            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
-            {
-                EncodeAddress(ptr);
-            }
-
-            if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
-            {
-                output_stream_->Write(ptr, sizeof(T));
-            }
+            memcpy(data, ptr, sizeof(T));
         }
     }
 
@@ -370,20 +565,11 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        uint8_t* data = EncodePointerPreamble(pointer_attrib, ptr, false, 0, sizeof(DstT));
 
-        if (ptr != nullptr)
+        if (data != nullptr)
         {
-            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
-            {
-                EncodeAddress(ptr);
-            }
-
-            if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
-            {
-                DstT converted = TypeCast<DstT>(*ptr);
-                output_stream_->Write(&converted, sizeof(DstT));
-            }
+            StoreValue(data, TypeCast<DstT>(*ptr));
         }
     }
 
@@ -395,19 +581,19 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsSingle | GetPointerAttributeMask(ptr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
-
-        if (ptr != nullptr)
+        if (encoding_ == format::ParameterEncoding::kCompact)
         {
-            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
-            {
-                EncodeAddress(ptr);
-            }
+            EncodeVarintPointer(pointer_attrib, ptr, false, 1, true, [](typename Wrapper::HandleType handle) {
+                return vulkan_wrappers::GetWrappedId<Wrapper>(handle);
+            });
+            return;
+        }
 
-            if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
-            {
-                EncodeVulkanHandleValue<Wrapper>(*ptr);
-            }
+        uint8_t* data = EncodePointerPreamble(pointer_attrib, ptr, false, 0, sizeof(format::HandleEncodeType));
+
+        if (data != nullptr)
+        {
+            StoreValue(data, static_cast<format::HandleEncodeType>(vulkan_wrappers::GetWrappedId<Wrapper>(*ptr)));
         }
     }
 
@@ -417,22 +603,11 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        uint8_t* data = EncodePointerPreamble(pointer_attrib, arr, true, len, len * sizeof(T));
 
-        if (arr != nullptr)
+        if (data != nullptr)
         {
-            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
-            {
-                EncodeAddress(arr);
-            }
-
-            // Always write the array size when the pointer is not null.
-            EncodeSizeTValue(len);
-
-            if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
-            {
-                output_stream_->Write(arr, len * sizeof(T));
-            }
+            memcpy(data, arr, len * sizeof(T));
         }
     }
 
@@ -445,25 +620,13 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        uint8_t* data = EncodePointerPreamble(pointer_attrib, arr, true, len, len * sizeof(DstT));
 
-        if (arr != nullptr)
+        if (data != nullptr)
         {
-            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
-            {
-                EncodeAddress(arr);
-            }
-
-            // Always write the array size when the pointer is not null.
-            EncodeSizeTValue(len);
-
-            if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
+            for (size_t i = 0; i < len; ++i)
             {
-                for (size_t i = 0; i < len; ++i)
-                {
-                    DstT converted = TypeCast<DstT>(arr[i]);
-                    output_stream_->Write(&converted, sizeof(DstT));
-                }
+                data = StoreValue(data, TypeCast<DstT>(arr[i]));
             }
         }
     }
@@ -486,24 +649,22 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
-
-        if (arr != nullptr)
+        if (encoding_ == format::ParameterEncoding::kCompact)
         {
-            if ((pointer_attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
-            {
-                EncodeAddress(arr);
-            }
+            EncodeVarintPointer(pointer_attrib, arr, true, len, true, [](typename Wrapper::HandleType handle) {
+                return vulkan_wrappers::GetWrappedId<Wrapper>(handle);
+            });
+            return;
+        }
 
-            // Always write the array size when the pointer is not null.
-            EncodeSizeTValue(len);
+        uint8_t* data = EncodePointerPreamble(pointer_attrib, arr, true, len, len * sizeof(format::HandleEncodeType));
 
-            if ((pointer_attrib & format::PointerAttributes::kHasData) == format::PointerAttributes::kHasData)
+        if (data != nullptr)
+        {
+            for (size_t i = 0; i < len; ++i)
             {
-                for (size_t i = 0; i < len; ++i)
-                {
-                    EncodeVulkanHandleValue<Wrapper>(arr[i]);
-                }
+                data = StoreValue(
+                    data, static_cast<format::HandleEncodeType>(vulkan_wrappers::GetWrappedId<Wrapper>(arr[i])));
             }
         }
     }
@@ -515,7 +676,7 @@ class ParameterEncoder
         // Outer pointer attributes
         uint32_t pointer_attrib =
             format::PointerAttributes::kIsArray2D | GetPointerAttributeMask(arr, omit_data, omit_addr);
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (arr != nullptr)
         {
@@ -536,7 +697,7 @@ class ParameterEncoder
                     // Inner pointer attributes
                     uint32_t inner_pointer_attrib =
                         format::PointerAttributes::kIsArray | GetPointerAttributeMask(arr[i], omit_data, omit_addr);
-                    output_stream_->Write(&inner_pointer_attrib, sizeof(inner_pointer_attrib));
+                    output_stream_->Append(&inner_pointer_attrib, sizeof(inner_pointer_attrib));
 
                     // Inner array address
                     if ((inner_pointer_attrib & format::PointerAttributes::kHasAddress) ==
@@ -552,7 +713,7 @@ class ParameterEncoder
                     if ((inner_pointer_attrib & format::PointerAttributes::kHasData) ==
                         format::PointerAttributes::kHasData)
                     {
-                        output_stream_->Write(arr[i], size_2d[i] * sizeof(T));
+                        output_stream_->Append(arr[i], size_2d[i] * sizeof(T));
                     }
                 }
             }
@@ -580,7 +741,7 @@ class ParameterEncoder
     typename std::enable_if<sizeof(CharT) == sizeof(EncodeT), void>::type EncodeBasicStringConverted(const CharT* str,
                                                                                                      size_t       len)
     {
-        output_stream_->Write(str, len * sizeof(CharT));
+        output_stream_->Append(str, len * sizeof(CharT));
     }
 
     template <typename CharT, typename EncodeT>
@@ -590,7 +751,7 @@ class ParameterEncoder
         for (size_t i = 0; i < len; ++i)
         {
             EncodeT converted = TypeCast<EncodeT>(str[i]);
-            output_stream_->Write(&converted, sizeof(EncodeT));
+            output_stream_->Append(&converted, sizeof(EncodeT));
         }
     }
 
@@ -600,7 +761,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             EncodeAttrib | format::PointerAttributes::kIsSingle | GetPointerAttributeMask(str, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (str != nullptr)
         {
@@ -627,7 +788,7 @@ class ParameterEncoder
         uint32_t pointer_attrib =
             EncodeAttrib | format::PointerAttributes::kIsArray | GetPointerAttributeMask(str, omit_data, omit_addr);
 
-        output_stream_->Write(&pointer_attrib, sizeof(pointer_attrib));
+        output_stream_->Append(&pointer_attrib, sizeof(pointer_attrib));
 
         if (str != nullptr)
         {
@@ -650,7 +811,11 @@ class ParameterEncoder
     }
 
   private:
-    util::OutputStream* output_stream_;
+    // Size of the pointer attributes, address, and array length with ParameterEncoding::kCompact.
+    static const size_t kMaxCompactPreambleSize = sizeof(uint32_t) + (2 * format::kMaxVarintSize);
+
+    util::MemoryOutputStream* output_stream_;
+    format::ParameterEncoding encoding_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -0,0 +1,244 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/parameter_buffer.h"
+#include "encode/parameter_encoder.h"
+#include "encode/vulkan_handle_wrapper_util.h"
+#include "encode/vulkan_handle_wrappers.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/logging.h"
+
+#include "vulkan/vulkan.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+const format::HandleId kDescriptorSetBaseId = 100;
+
+format::HandleId GetDescriptorSetId()
+{
+    static format::HandleId next_id = kDescriptorSetBaseId;
+    return next_id++;
+}
+
+// Reads the next value of type T from encoded parameter data.
+template <typename T>
+T ReadValue(const uint8_t** data)
+{
+    T value;
+    memcpy(&value, *data, sizeof(T));
+    (*data) += sizeof(T);
+    return value;
+}
+
+TEST_CASE("ParameterEncoder encodes arrays as attributes, address, length, and data", "[parameter_encoder]")
+{
+    util::MemoryOutputStream stream;
+    ParameterEncoder         encoder(&stream);
+    const uint32_t           values[] = { 1, 2, 3 };
+
+    encoder.EncodeUInt32Array(values, 3);
+
+    const uint8_t* data = stream.GetData();
+    REQUIRE(stream.GetDataSize() ==
+            sizeof(uint32_t) + sizeof(format::AddressEncodeType) + sizeof(format::SizeTEncodeType) + sizeof(values));
+    REQUIRE(ReadValue<uint32_t>(&data) ==
+            (format::PointerAttributes::kIsArray | format::PointerAttributes::kHasAddress |
+             format::PointerAttributes::kHasData));
+    REQUIRE(ReadValue<format::AddressEncodeType>(&data) == reinterpret_cast<format::AddressEncodeType>(values));
+    REQUIRE(ReadValue<format::SizeTEncodeType>(&data) == 3);
+    REQUIRE(memcmp(data, values, sizeof(values)) == 0);
+}
+
+TEST_CASE("ParameterEncoder omits the address, length, and data for null pointers", "[parameter_encoder]")
+{
+    util::MemoryOutputStream stream;
+    ParameterEncoder         encoder(&stream);
+
+    encoder.EncodeUInt32Array(nullptr, 3);
+    encoder.EncodeUInt64Ptr(nullptr);
+
+    const uint8_t* data = stream.GetData();
+    REQUIRE(stream.GetDataSize() == 2 * sizeof(uint32_t));
+    REQUIRE(ReadValue<uint32_t>(&data) == (format::PointerAttributes::kIsArray | format::PointerAttributes::kIsNull));
+    REQUIRE(ReadValue<uint32_t>(&data) == (format::PointerAttributes::kIsSingle | format::PointerAttributes::kIsNull));
+}
+
+TEST_CASE("ParameterEncoder honors omit_data and omit_addr", "[parameter_encoder]")
+{
+    util::MemoryOutputStream stream;
+    ParameterEncoder         encoder(&stream);
+    const uint64_t           value = 0x0123456789abcdef;
+
+    encoder.EncodeUInt64Ptr(&value, true, false);
+    encoder.EncodeUInt64Ptr(&value, false, true);
+
+    const uint8_t* data = stream.GetData();
+    REQUIRE(stream.GetDataSize() == 2 * sizeof(uint32_t) + sizeof(format::AddressEncodeType) + sizeof(value));
+    REQUIRE(ReadValue<uint32_t>(&data) ==
+            (format::PointerAttributes::kIsSingle | format::PointerAttributes::kHasAddress));
+    REQUIRE(ReadValue<format::AddressEncodeType>(&data) == reinterpret_cast<format::AddressEncodeType>(&value));
+    REQUIRE(ReadValue<uint32_t>(&data) == (format::PointerAttributes::kIsSingle | format::PointerAttributes::kHasData));
+    REQUIRE(ReadValue<uint64_t>(&data) == value);
+}
+
+TEST_CASE("ParameterEncoder converts array elements to the encoded type", "[parameter_encoder]")
+{
+    util::MemoryOutputStream stream;
+    ParameterEncoder         encoder(&stream);
+    const size_t             sizes[] = { 7, 8 };
+
+    encoder.EncodeSizeTArray(sizes, 2, false, true);
+
+    const uint8_t* data = stream.GetData();
+    REQUIRE(ReadValue<uint32_t>(&data) == (format::PointerAttributes::kIsArray | format::PointerAttributes::kHasData));
+    REQUIRE(ReadValue<format::SizeTEncodeType>(&data) == 2);
+    REQUIRE(ReadValue<format::SizeTEncodeType>(&data) == 7);
+    REQUIRE(ReadValue<format::SizeTEncodeType>(&data) == 8);
+    REQUIRE(data == (stream.GetData() + stream.GetDataSize()));
+}
+
+TEST_CASE("ParameterEncoder writes varints in the compact encoding", "[parameter_encoder]")
+{
+    util::MemoryOutputStream stream;
+    ParameterEncoder         encoder(&stream, format::ParameterEncoding::kCompact);
+    const size_t             sizes[] = { 7, 300 };
+
+    encoder.EncodeSizeTArray(sizes, 2, false, true);
+    encoder.EncodeHandleIdValue(5);
+    encoder.EncodeUInt64Value(1);
+
+    // Attributes stay fixed size, the length and elements are LEB128 varints.
+    const uint8_t* data = stream.GetData();
+    REQUIRE(stream.GetDataSize() == sizeof(uint32_t) + 1 + 1 + 2 + 1 + sizeof(uint64_t));
+    REQUIRE(ReadValue<uint32_t>(&data) == (format::PointerAttributes::kIsArray | format::PointerAttributes::kHasData));
+    REQUIRE(data[0] == 2);
+    REQUIRE(data[1] == 7);
+    REQUIRE(data[2] == 0xac);
+    REQUIRE(data[3] == 0x02);
+    REQUIRE(data[4] == 5);
+    data += 5;
+    REQUIRE(ReadValue<uint64_t>(&data) == 1);
+}
+
+TEST_CASE("ParameterEncoder delta codes handle ID arrays in the compact encoding", "[parameter_encoder]")
+{
+    util::MemoryOutputStream stream;
+    ParameterEncoder         encoder(&stream, format::ParameterEncoding::kCompact);
+    const format::HandleId   ids[] = { 1000, 1001, 999 };
+
+    encoder.EncodeHandleIdArray(ids, 3, false, true);
+
+    const uint8_t* data = stream.GetData();
+    REQUIRE(ReadValue<uint32_t>(&data) == (format::PointerAttributes::kIsArray | format::PointerAttributes::kHasData));
+
+    uint64_t       value = 0;
+    const uint8_t* end   = stream.GetData() + stream.GetDataSize();
+    data += format::LoadVarint(data, end - data, &value);
+    REQUIRE(value == 3);
+
+    format::HandleId previous = 0;
+    for (auto id : ids)
+    {
+        data += format::LoadVarint(data, end - data, &value);
+        previous += format::ZigZagDecode(value);
+        REQUIRE(previous == id);
+    }
+    REQUIRE(data == end);
+
+    // 1000 needs two bytes, each delta after it needs one.
+    REQUIRE(stream.GetDataSize() == sizeof(uint32_t) + 1 + 2 + 1 + 1);
+}
+
+TEST_CASE("ParameterBuffer keeps the header and parameter data when it grows", "[parameter_encoder]")
+{
+    ParameterBuffer  buffer;
+    ParameterEncoder encoder(&buffer);
+
+    buffer.ClearWithHeader(sizeof(format::FunctionCallHeader));
+
+    const size_t kValueCount = 1000;
+    for (uint32_t i = 0; i < kValueCount; ++i)
+    {
+        encoder.EncodeUInt32Value(i);
+    }
+
+    REQUIRE(buffer.GetHeaderDataSize() == sizeof(format::FunctionCallHeader));
+    REQUIRE(buffer.GetHeaderData() != nullptr);
+    REQUIRE(buffer.GetData() == buffer.GetHeaderData() + sizeof(format::FunctionCallHeader));
+    REQUIRE(buffer.GetDataSize() == kValueCount * sizeof(uint32_t));
+
+    const uint8_t* data = buffer.GetData();
+    for (uint32_t i = 0; i < kValueCount; ++i)
+    {
+        REQUIRE(ReadValue<uint32_t>(&data) == i);
+    }
+
+    buffer.ClearWithHeader(sizeof(format::FunctionCallHeader));
+    REQUIRE(buffer.GetDataSize() == 0);
+}
+
+TEST_CASE("ParameterEncoder encodes handle arrays as wrapped handle IDs", "[parameter_encoder]")
+{
+    util::Log::Init(util::Log::kErrorSeverity);
+
+    VkDescriptorSet descriptor_sets[] = { format::FromHandleId<VkDescriptorSet>(0x10),
+                                          format::FromHandleId<VkDescriptorSet>(0x20) };
+
+    for (auto& descriptor_set : descriptor_sets)
+    {
+        vulkan_wrappers::CreateWrappedHandle<vulkan_wrappers::DeviceWrapper,
+                                             vulkan_wrappers::NoParentWrapper,
+                                             vulkan_wrappers::DescriptorSetWrapper>(
+            VK_NULL_HANDLE, vulkan_wrappers::NoParentWrapper::kHandleValue, &descriptor_set, GetDescriptorSetId);
+    }
+
+    util::MemoryOutputStream stream;
+    ParameterEncoder         encoder(&stream);
+
+    encoder.EncodeVulkanHandleArray<vulkan_wrappers::DescriptorSetWrapper>(descriptor_sets, 2, false, true);
+
+    const uint8_t* data = stream.GetData();
+    REQUIRE(ReadValue<uint32_t>(&data) == (format::PointerAttributes::kIsArray | format::PointerAttributes::kHasData));
+    REQUIRE(ReadValue<format::SizeTEncodeType>(&data) == 2);
+    REQUIRE(ReadValue<format::HandleEncodeType>(&data) ==
+            vulkan_wrappers::GetWrappedId<vulkan_wrappers::DescriptorSetWrapper>(descriptor_sets[0]));
+    REQUIRE(ReadValue<format::HandleEncodeType>(&data) ==
+            vulkan_wrappers::GetWrappedId<vulkan_wrappers::DescriptorSetWrapper>(descriptor_sets[1]));
+
+    for (auto descriptor_set : descriptor_sets)
+    {
+        vulkan_wrappers::DestroyWrappedHandle<vulkan_wrappers::DescriptorSetWrapper>(descriptor_set);
+    }
+
+    util::Log::Release();
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
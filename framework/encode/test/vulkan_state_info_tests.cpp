@@ -0,0 +1,57 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "encode/vulkan_state_info.h"
+
+#include <catch2/catch.hpp>
+
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+TEST_CASE("CommandHandleSet holds each recorded handle once after compaction", "[vulkan_state_info]")
+{
+    vulkan_state_info::CommandHandleSet handles;
+
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        handles.insert(10 + (i % 7));
+        handles.insert(10 + (i % 7));
+    }
+
+    // Repeated inserts must not grow the set without bound before recording ends.
+    REQUIRE(handles.size() < 1000);
+
+    handles.Compact();
+    REQUIRE(std::vector<format::HandleId>(handles.begin(), handles.end()) ==
+            std::vector<format::HandleId>{ 10, 11, 12, 13, 14, 15, 16 });
+
+    handles.clear();
+    REQUIRE(handles.empty());
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
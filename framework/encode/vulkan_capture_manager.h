@@ -898,12 +898,15 @@ class VulkanCaptureManager : public ApiCaptureManager
         }
     }
 
-    void PostProcess_vkResetCommandPool(VkResult result, VkDevice, VkCommandPool commandPool, VkCommandPoolResetFlags)
+    void PostProcess_vkResetCommandPool(VkResult result,
+                                        VkDevice,
+                                        VkCommandPool           commandPool,
+                                        VkCommandPoolResetFlags flags)
     {
         if (IsCaptureModeTrack() && (result == VK_SUCCESS))
         {
             assert(state_tracker_ != nullptr);
-            state_tracker_->TrackResetCommandPool(commandPool);
+            state_tracker_->TrackResetCommandPool(commandPool, flags);
         }
     }
 
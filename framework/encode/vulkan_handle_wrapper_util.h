@@ -36,6 +36,7 @@
 #include <algorithm>
 #include <iterator>
 #include <cassert>
+#include <memory>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -54,6 +55,12 @@ static const VkCommandPool    kTempCommandPool =
     UINT64_TO_VK_HANDLE(VkCommandPool, std::numeric_limits<uint64_t>::max() - 2);
 static const format::HandleId kTempCommandPoolId   = std::numeric_limits<format::HandleId>::max() - 2;
 static const format::HandleId kTempCommandBufferId = std::numeric_limits<format::HandleId>::max() - 3;
+
+// Limits for the command data streams kept by a command pool for reuse by newly allocated command buffers.  Streams
+// with a larger allocation than kMaxRecycledCommandDataSize are released instead of being kept.
+static const size_t kMaxRecycledCommandDataSize      = 1024 * 1024;
+static const size_t kMaxRecycledCommandDataTotalSize = 16 * 1024 * 1024;
+
 typedef format::HandleId (*PFN_GetHandleId)();
 
 extern VulkanStateHandleTable state_handle_table_;
@@ -347,6 +354,14 @@ inline void CreateWrappedHandle<DeviceWrapper, CommandPoolWrapper, CommandBuffer
     wrapper->layer_table_ref = &parent_wrapper->layer_table;
     wrapper->parent_pool     = co_parent_wrapper;
     co_parent_wrapper->child_buffers.insert(std::make_pair(wrapper->handle_id, wrapper));
+
+    if (!co_parent_wrapper->recycled_command_data.empty())
+    {
+        auto recycled = co_parent_wrapper->recycled_command_data.back().get();
+        co_parent_wrapper->recycled_command_data_size -= recycled->GetCapacity();
+        wrapper->command_data.Swap(recycled);
+        co_parent_wrapper->recycled_command_data.pop_back();
+    }
 }
 
 template <>
@@ -562,8 +577,21 @@ inline void DestroyWrappedHandle<CommandBufferWrapper>(VkCommandBuffer handle)
     if (handle != VK_NULL_HANDLE)
     {
         // Remove from parent list.
-        auto wrapper = GetWrapper<CommandBufferWrapper>(handle);
-        wrapper->parent_pool->child_buffers.erase(wrapper->handle_id);
+        auto wrapper     = GetWrapper<CommandBufferWrapper>(handle);
+        auto parent_pool = wrapper->parent_pool;
+        parent_pool->child_buffers.erase(wrapper->handle_id);
+
+        // Keep the command data allocation for the next command buffer allocated from the pool.  Command buffers
+        // that were never recorded have nothing worth keeping.
+        size_t capacity = wrapper->command_data.GetCapacity();
+        if ((wrapper->command_data.GetDataSize() > 0) && (capacity <= kMaxRecycledCommandDataSize) &&
+            ((parent_pool->recycled_command_data_size + capacity) <= kMaxRecycledCommandDataTotalSize))
+        {
+            wrapper->command_data.Clear();
+            parent_pool->recycled_command_data.emplace_back(std::make_unique<util::MemoryOutputStream>(0));
+            parent_pool->recycled_command_data.back()->Swap(&wrapper->command_data);
+            parent_pool->recycled_command_data_size += capacity;
+        }
 
         RemoveWrapper<CommandBufferWrapper>(wrapper);
         delete wrapper;
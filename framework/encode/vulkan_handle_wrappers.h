@@ -40,6 +40,7 @@
 #include <memory>
 #include <set>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -283,14 +284,16 @@ struct CommandBufferWrapper : public HandleWrapper<VkCommandBuffer>
     CommandPoolWrapper* parent_pool{ nullptr };
 
     // Members for trimming state tracking.
-    VkCommandBufferLevel       level{ VK_COMMAND_BUFFER_LEVEL_PRIMARY };
-    util::MemoryOutputStream   command_data;
-    std::set<format::HandleId> command_handles[vulkan_state_info::CommandHandleType::NumHandleTypes];
+    VkCommandBufferLevel                level{ VK_COMMAND_BUFFER_LEVEL_PRIMARY };
+    util::MemoryOutputStream            command_data;
+    vulkan_state_info::CommandHandleSet command_handles[vulkan_state_info::CommandHandleType::NumHandleTypes];
 
     // Image layout info tracked for image barriers recorded to the command buffer. To be updated on calls to
     // vkCmdPipelineBarrier and vkCmdEndRenderPass and applied to the image wrapper on calls to vkQueueSubmit. To be
     // transferred from secondary command buffers to primary command buffers on calls to vkCmdExecuteCommands.
-    std::unordered_map<ImageWrapper*, VkImageLayout> pending_layouts;
+    // Layouts are appended in recording order and applied in the same order, so the last layout recorded for an image
+    // is the one that is applied.
+    std::vector<std::pair<ImageWrapper*, VkImageLayout>> pending_layouts;
 
     // Active query info for queries that have been recorded to this command buffer, which will be transfered to the
     // QueryPoolWrapper as pending queries when the command buffer is submitted to a queue.
@@ -407,6 +410,12 @@ struct CommandPoolWrapper : public HandleWrapper<VkCommandPool>
 
     DeviceWrapper* device{ nullptr };
     bool           trim_command_pool{ false };
+
+    // Command data streams of freed command buffers, which are given to command buffers allocated from the pool so
+    // that a new command buffer does not need to grow its stream again.  The streams are released when the pool is
+    // trimmed or reset with VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT.
+    std::vector<std::unique_ptr<util::MemoryOutputStream>> recycled_command_data;
+    size_t                                                 recycled_command_data_size{ 0 };
 };
 
 // For vkGetPhysicalDeviceSurfaceCapabilitiesKHR
@@ -30,6 +30,7 @@
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -134,6 +135,60 @@ enum CommandHandleType : uint32_t
     NumHandleTypes // THIS MUST BE THE LAST ENUM VALUE !
 };
 
+// Set of handle IDs recorded to a command buffer.  IDs are appended to a flat vector, which is sorted and de-duplicated
+// when recording ends or when it doubles in size, rather than allocating a tree node per insert.  Clearing the set
+// for a new recording keeps its allocation.  Uses the std::set member names so that it can replace the set it was
+// introduced for without changes to the generated command buffer tracking code.
+class CommandHandleSet
+{
+  public:
+    typedef std::vector<format::HandleId>::const_iterator const_iterator;
+
+  public:
+    void insert(format::HandleId handle_id)
+    {
+        // Commands often reference the same handle as the previous command, such as draws with the same pipeline.
+        if (handle_ids_.empty() || (handle_ids_.back() != handle_id))
+        {
+            handle_ids_.push_back(handle_id);
+
+            if (handle_ids_.size() >= compact_size_)
+            {
+                Compact();
+            }
+        }
+    }
+
+    void clear()
+    {
+        handle_ids_.clear();
+        compact_size_ = kMinCompactSize;
+    }
+
+    // Removes duplicate IDs, leaving the IDs in sorted order.
+    void Compact()
+    {
+        std::sort(handle_ids_.begin(), handle_ids_.end());
+        handle_ids_.erase(std::unique(handle_ids_.begin(), handle_ids_.end()), handle_ids_.end());
+        compact_size_ = std::max(kMinCompactSize, handle_ids_.size() * 2);
+    }
+
+    bool empty() const { return handle_ids_.empty(); }
+
+    size_t size() const { return handle_ids_.size(); }
+
+    const_iterator begin() const { return handle_ids_.begin(); }
+
+    const_iterator end() const { return handle_ids_.end(); }
+
+  private:
+    static constexpr size_t kMinCompactSize = 64;
+
+  private:
+    std::vector<format::HandleId> handle_ids_;
+    size_t                        compact_size_{ kMinCompactSize };
+};
+
 GFXRECON_END_NAMESPACE(vulkan_state_info)
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -26,13 +26,13 @@
 #include "encode/vulkan_handle_wrappers.h"
 #include "format/format.h"
 #include "util/defines.h"
+#include "util/sharded_hash_map.h"
 
 #include "vulkan/vulkan.h"
 
 #include <cassert>
 #include <functional>
 #include <map>
-#include <shared_mutex>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
@@ -74,43 +74,33 @@ class VulkanStateTableBase
     }
 
     template <typename Wrapper>
-    bool InsertEntry(typename Wrapper::HandleType                                handle,
-                     Wrapper*                                                    wrapper,
-                     std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
+    bool InsertEntry(typename Wrapper::HandleType                                  handle,
+                     Wrapper*                                                      wrapper,
+                     util::ShardedHashMap<typename Wrapper::HandleType, Wrapper*>& map)
     {
-        const std::unique_lock<std::shared_mutex> lock(mutex_);
-        const auto&                               inserted = map.insert(std::make_pair(handle, wrapper));
-        return inserted.second;
+        return map.Insert(handle, wrapper);
     }
 
     template <typename Wrapper>
-    bool RemoveEntry(const typename Wrapper::HandleType                          handle,
-                     std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
+    bool RemoveEntry(const typename Wrapper::HandleType                            handle,
+                     util::ShardedHashMap<typename Wrapper::HandleType, Wrapper*>& map)
     {
-        const std::unique_lock<std::shared_mutex> lock(mutex_);
-        return (map.erase(handle) != 0);
+        return map.Erase(handle);
     }
 
     template <typename Wrapper>
-    Wrapper* GetWrapper(typename Wrapper::HandleType                                      handle,
-                        const std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map)
+    Wrapper* GetWrapper(typename Wrapper::HandleType                                        handle,
+                        const util::ShardedHashMap<typename Wrapper::HandleType, Wrapper*>& map)
     {
-        const std::shared_lock<std::shared_mutex> lock(mutex_);
-        auto                                      entry = map.find(handle);
-        return (entry != map.end()) ? entry->second : nullptr;
+        return map.Find(handle, nullptr);
     }
 
     template <typename Wrapper>
-    const Wrapper* GetWrapper(typename Wrapper::HandleType                                      handle,
-                              const std::unordered_map<typename Wrapper::HandleType, Wrapper*>& map) const
+    const Wrapper* GetWrapper(typename Wrapper::HandleType                                        handle,
+                              const util::ShardedHashMap<typename Wrapper::HandleType, Wrapper*>& map) const
     {
-        const std::shared_lock<std::shared_mutex> lock(mutex_);
-        auto                                      entry = map.find(handle);
-        return (entry != map.end()) ? entry->second : nullptr;
+        return map.Find(handle, nullptr);
     }
-
-  private:
-    mutable std::shared_mutex mutex_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -66,6 +66,15 @@ void VulkanStateTracker::TrackCommandExecution(vulkan_wrappers::CommandBufferWra
         wrapper->command_data.Write(&call_id, sizeof(call_id));
         wrapper->command_data.Write(parameter_buffer->GetData(), size);
     }
+
+    if (call_id == format::ApiCallId::ApiCall_vkEndCommandBuffer)
+    {
+        // Remove the duplicate handles that were recorded, which won't change until the next reset.
+        for (size_t i = 0; i < vulkan_state_info::CommandHandleType::NumHandleTypes; ++i)
+        {
+            wrapper->command_handles[i].Compact();
+        }
+    }
 }
 
 void VulkanStateTracker::TrackTrimCommandPool(VkDevice device, VkCommandPool command_pool)
@@ -77,16 +86,35 @@ void VulkanStateTracker::TrackTrimCommandPool(VkDevice device, VkCommandPool com
 
     auto device_wrapper = vulkan_wrappers::GetWrapper<vulkan_wrappers::DeviceWrapper>(device);
     wrapper->device     = device_wrapper;
+
+    // Trimming returns unused pool memory, which includes the command data kept for reuse.
+    wrapper->recycled_command_data.clear();
+    wrapper->recycled_command_data_size = 0;
 }
 
-void VulkanStateTracker::TrackResetCommandPool(VkCommandPool command_pool)
+void VulkanStateTracker::TrackResetCommandPool(VkCommandPool command_pool, VkCommandPoolResetFlags flags)
 {
     assert(command_pool != VK_NULL_HANDLE);
 
     auto wrapper = vulkan_wrappers::GetWrapper<vulkan_wrappers::CommandPoolWrapper>(command_pool);
 
+    // Command data allocations are kept for the next recording, unless the application asked for the pool's resources
+    // to be released.
+    bool release_resources = ((flags & VK_COMMAND_POOL_RESET_RELEASE_RESOURCES_BIT) != 0);
+    if (release_resources)
+    {
+        wrapper->recycled_command_data.clear();
+        wrapper->recycled_command_data_size = 0;
+    }
+
     for (const auto& entry : wrapper->child_buffers)
     {
+        if (release_resources)
+        {
+            util::MemoryOutputStream released(0);
+            entry.second->command_data.Swap(&released);
+        }
+
         entry.second->command_data.Clear();
         entry.second->pending_layouts.clear();
         entry.second->recorded_queries.clear();
@@ -457,8 +485,8 @@ void VulkanStateTracker::TrackEndRenderPass(VkCommandBuffer command_buffer)
 
     for (uint32_t i = 0; i < attachment_count; ++i)
     {
-        wrapper->pending_layouts[framebuffer_wrapper->attachments[i]] =
-            render_pass_wrapper->attachment_final_layouts[i];
+        wrapper->pending_layouts.emplace_back(framebuffer_wrapper->attachments[i],
+                                              render_pass_wrapper->attachment_final_layouts[i]);
     }
 
     // Clear the active render pass state now that the pass has ended.
@@ -479,10 +507,9 @@ void VulkanStateTracker::TrackExecuteCommands(VkCommandBuffer        command_buf
         auto secondary_wrapper = vulkan_wrappers::GetWrapper<vulkan_wrappers::CommandBufferWrapper>(command_buffers[i]);
         assert(secondary_wrapper != nullptr);
 
-        for (const auto& layout_entry : secondary_wrapper->pending_layouts)
-        {
-            primary_wrapper->pending_layouts[layout_entry.first] = layout_entry.second;
-        }
+        primary_wrapper->pending_layouts.insert(primary_wrapper->pending_layouts.end(),
+                                                secondary_wrapper->pending_layouts.begin(),
+                                                secondary_wrapper->pending_layouts.end());
 
         for (const auto& secondary_query_pool_entry : secondary_wrapper->recorded_queries)
         {
@@ -517,7 +544,7 @@ void VulkanStateTracker::TrackImageBarriers(VkCommandBuffer             command_
         for (uint32_t i = 0; i < image_barrier_count; ++i)
         {
             auto image_wrapper = vulkan_wrappers::GetWrapper<vulkan_wrappers::ImageWrapper>(image_barriers[i].image);
-            wrapper->pending_layouts[image_wrapper] = image_barriers[i].newLayout;
+            wrapper->pending_layouts.emplace_back(image_wrapper, image_barriers[i].newLayout);
         }
     }
 }
@@ -535,7 +562,7 @@ void VulkanStateTracker::TrackImageBarriers2KHR(VkCommandBuffer
         for (uint32_t i = 0; i < image_barrier_count; ++i)
         {
             auto image_wrapper = vulkan_wrappers::GetWrapper<vulkan_wrappers::ImageWrapper>(image_barriers[i].image);
-            wrapper->pending_layouts[image_wrapper] = image_barriers[i].newLayout;
+            wrapper->pending_layouts.emplace_back(image_wrapper, image_barriers[i].newLayout);
         }
     }
 }
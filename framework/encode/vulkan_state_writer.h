@@ -47,7 +47,10 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class VulkanStateWriter
 {
   public:
-    VulkanStateWriter(util::FileOutputStream* output_stream, util::Compressor* compressor, format::ThreadId thread_id);
+    VulkanStateWriter(util::FileOutputStream*   output_stream,
+                      util::Compressor*         compressor,
+                      format::ThreadId          thread_id,
+                      format::ParameterEncoding parameter_encoding);
 
     ~VulkanStateWriter();
 
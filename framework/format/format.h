@@ -154,6 +154,7 @@ enum class MetaDataType : uint16_t
     kReserved30                             = 30,
     kReserved31                             = 31,
     kSetEnvironmentVariablesCommand         = 32,
+    kSetCompressionDictionaryCommand        = 33,
 };
 
 // MetaDataId is stored in the capture file and its type must be uint32_t to avoid breaking capture file compatibility.
@@ -188,6 +189,15 @@ enum FileOption : uint32_t
     kUnknownFileOption = 0,
     kCompressionType   = 1, // One of the CompressionType values defining the compression algorithm used with parameter
                             // encoding. Default = CompressionType::kNone.
+    kParameterEncoding = 2, // One of the ParameterEncoding values defining how handle IDs, enums, flags, sizes, and
+                            // addresses are written to parameter buffers. Default = ParameterEncoding::kFixedSize.
+};
+
+enum ParameterEncoding : uint32_t
+{
+    kFixedSize = 0, // Values are written with the fixed size of their encode type (e.g. HandleEncodeType).
+    kCompact   = 1, // Values are written as LEB128 varints.  Handle IDs referenced by pointers are written as zigzag
+                    // deltas from the previous array element, or from 0 for the first element.
 };
 
 enum PointerAttributes : uint32_t
@@ -220,7 +230,8 @@ enum ResizeWindowPreTransform : uint32_t
 
 struct EnabledOptions
 {
-    CompressionType compression_type{ CompressionType::kNone };
+    CompressionType   compression_type{ CompressionType::kNone };
+    ParameterEncoding parameter_encoding{ ParameterEncoding::kFixedSize };
 };
 
 // Resource values are values contained in resource data that may require special handling (e.g., mapping for replay).
@@ -661,6 +672,16 @@ struct SetEnvironmentVariablesCommand
     // containing a list of environment variables and their values
 };
 
+// Dictionary used to compress the API call blocks that follow it.  The block itself is never compressed.
+struct SetCompressionDictionaryCommandHeader
+{
+    MetaDataHeader meta_header;
+    ThreadId       thread_id;
+    uint64_t       dictionary_size;
+
+    // In the capture file, dictionary_size bytes of dictionary data immediately follow this header.
+};
+
 // Restore size_t to normal behavior.
 #undef size_t
 
@@ -0,0 +1,88 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/// @file Helpers for the ParameterEncoding::kCompact parameter encoding.
+#ifndef GFXRECON_FORMAT_VARINT_H
+#define GFXRECON_FORMAT_VARINT_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(format)
+
+// Maximum number of bytes needed to store a 64-bit value as an LEB128 varint.
+const size_t kMaxVarintSize = 10;
+
+// Maps signed values to unsigned values so that values with small magnitudes have small varint encodings.
+inline uint64_t ZigZagEncode(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t ZigZagDecode(uint64_t value)
+{
+    return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+// Writes value to dst as an LEB128 varint and returns the location that follows it.  The caller must provide at least
+// kMaxVarintSize bytes.
+inline uint8_t* StoreVarint(uint8_t* dst, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        *dst++ = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+
+    *dst++ = static_cast<uint8_t>(value);
+    return dst;
+}
+
+// Reads an LEB128 varint from buffer.  Returns the number of bytes read, or 0 if buffer does not hold a complete
+// varint.
+inline size_t LoadVarint(const uint8_t* buffer, size_t buffer_size, uint64_t* value)
+{
+    uint64_t result = 0;
+    size_t   limit  = (buffer_size < kMaxVarintSize) ? buffer_size : kMaxVarintSize;
+
+    for (size_t i = 0; i < limit; ++i)
+    {
+        uint8_t byte = buffer[i];
+        result |= static_cast<uint64_t>(byte & 0x7f) << (7 * i);
+
+        if ((byte & 0x80) == 0)
+        {
+            (*value) = result;
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
+
+GFXRECON_END_NAMESPACE(format)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_FORMAT_VARINT_H
@@ -73,13 +73,13 @@ class Dx12EnumToJsonHeaderGenerator(Dx12BaseGenerator):
 
         for k, v in enum_dict.items():
             # Generate enum handler for all enums
-            enum_prototypes += format_cpp_code('''inline void FieldToJson(nlohmann::ordered_json& jdata, const {0} value, const JsonOptions& options = JsonOptions())
+            enum_prototypes += format_cpp_code('''inline void FieldToJson(JsonStreamWriter& writer, const {0} value, const JsonOptions& options = JsonOptions())
             {{
-                FieldToJson(jdata, ToString(value), options);
+                FieldToJson(writer, ToString(value), options);
             }}
-            inline void FieldToJson(nlohmann::ordered_json& jdata, const {0}* pEnum, const JsonOptions& options = JsonOptions())
+            inline void FieldToJson(JsonStreamWriter& writer, const {0}* pEnum, const JsonOptions& options = JsonOptions())
             {{
-                FieldToJson(jdata, *pEnum, options);
+                FieldToJson(writer, *pEnum, options);
             }}
             '''.format(k))
             enum_prototypes += '\n\n'
@@ -87,7 +87,7 @@ class Dx12EnumToJsonHeaderGenerator(Dx12BaseGenerator):
             # Generate flags handler for enums identified as bitmasks
             for bits in self.BITS_LIST:
                 if k.find(bits) >= 0:
-                    flag_prototypes += format_cpp_code('''inline void FieldToJson_{0}(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+                    flag_prototypes += format_cpp_code('''inline void FieldToJson_{0}(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
                     {{
                         std::string representation;
                         if (!options.expand_flags)
@@ -98,7 +98,7 @@ class Dx12EnumToJsonHeaderGenerator(Dx12BaseGenerator):
                         {{
                             representation = ToString_{0}(flags);
                         }}
-                        FieldToJson(jdata, representation, options);
+                        FieldToJson(writer, representation, options);
                     }}
                     \n'''.format(k))
                     flag_prototypes += '\n'
@@ -108,9 +108,9 @@ class Dx12EnumToJsonHeaderGenerator(Dx12BaseGenerator):
 
         write(format_cpp_code('''
         // IID struct-as-enum special case:
-        inline void FieldToJson(nlohmann::ordered_json& jdata, const IID& value, const JsonOptions& options = JsonOptions())
+        inline void FieldToJson(JsonStreamWriter& writer, const IID& value, const JsonOptions& options = JsonOptions())
         {
-            FieldToJson(jdata, ToString(value), options);
+            FieldToJson(writer, ToString(value), options);
         }
         '''), file=self.outFile)
 
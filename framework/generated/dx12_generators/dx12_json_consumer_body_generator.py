@@ -103,40 +103,44 @@ class Dx12JsonConsumerBodyGenerator(Dx12JsonConsumerHeaderGenerator, Dx12JsonCom
         return code
 
     ## Generate a FieldToJson appropriate to the return type.
-    ## @param func_type Either "function" or "method" for expected use.
-    def make_return(self, func_type, return_value):
+    def make_return(self, return_value):
         if(None == return_value):
             return ""
         function_name = self.choose_field_to_json_name(return_value)
-        ret_line = "{0}({1}[format::kNameReturn], return_value, options);\n"
+        ret_line = "{0}(writer.Key(format::kNameReturn), return_value, options);\n"
         ## if return_type.startswith("HANDLE "):
         ## This is a Windows handle, probably to a waitable object so we output it as a JSON number:
         ## <https://learn.microsoft.com/en-us/windows/win32/sysinfo/handles-and-objects>
         ## <https://learn.microsoft.com/en-us/windows/win32/sync/wait-functions>
-        ret_line = ret_line.format(function_name, func_type)
+        ret_line = ret_line.format(function_name)
         return ret_line
 
     def make_consumer_func_body(self, method_info, return_type, return_value):
         # Deal with the function's returned value:
         if return_type != 'HRESULT WINAPI':
             print ("Warning - Unexpected return type:", return_type)
-        ret_line = self.make_return("function", return_value)
+        ret_line = self.make_return(return_value)
 
         code = '''
-            nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "{}");
+            JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "{}");
             const JsonOptions& options = writer_->GetOptions();
         '''
         code += ret_line
-        code += '''nlohmann::ordered_json& args = function[format::kNameArgs];
-            {{
-        '''
-        # Generate a correct FieldToJson for each argument:
-        for parameter in method_info['parameters']:
-            value = self.get_value_info(parameter)
-            code += "    " + self.make_field_to_json("args", value, "options") + "\n"
+        if len(method_info['parameters']) > 0:
+            code += '''writer.Key(format::kNameArgs).BeginObject();
+                {{
+            '''
+            # Generate a correct FieldToJson for each argument:
+            for parameter in method_info['parameters']:
+                value = self.get_value_info(parameter)
+                code += "    " + self.make_field_to_json("args", value, "options") + "\n"
+            code += "}}\n"
+            code += "writer.EndObject();\n"
+        else:
+            # Functions always report an args entry, null when there are no parameters.
+            code += "writer.Key(format::kNameArgs).Null();\n"
 
         code += remove_leading_empty_lines('''
-                }}
             writer_->WriteBlockEnd();
         ''')
         code = code.format(method_info['name'])
@@ -144,17 +148,17 @@ class Dx12JsonConsumerBodyGenerator(Dx12JsonConsumerHeaderGenerator, Dx12JsonCom
 
     def make_consumer_method_body(self, class_name, method_info, return_type, return_value):
         code = '''
-            nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "{0}", object_id, "{1}");
+            JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "{0}", object_id, "{1}");
             const JsonOptions& options = writer_->GetOptions();
         '''
 
         # Deal with the function's returned value:
-        ret_line = self.make_return("method", return_value)
+        ret_line = self.make_return(return_value)
         code += ret_line
 
         # Deal with function argumentS:
         if len(method_info['parameters']) > 0:
-            code += '''nlohmann::ordered_json& args = method[format::kNameArgs];
+            code += '''writer.Key(format::kNameArgs).BeginObject();
                 {{
             '''
             # Generate a correct FieldToJson for each argument:
@@ -162,6 +166,7 @@ class Dx12JsonConsumerBodyGenerator(Dx12JsonConsumerHeaderGenerator, Dx12JsonCom
                 value = self.get_value_info(parameter)
                 code += "    " + self.make_field_to_json("args", value, "options") + "\n"
             code += "}}\n"
+            code += "writer.EndObject();\n"
 
         code += "writer_->WriteBlockEnd();"
         code = code.format(class_name, method_info['name'])
@@ -175,7 +180,7 @@ class Dx12JsonConsumerBodyGenerator(Dx12JsonConsumerHeaderGenerator, Dx12JsonCom
         ## (easier than having pointer decoder versions of each flagset type's FieldToString)
         if value_info.is_pointer and function_name.startswith("FieldToJson_"):
             src = "*" + src + "->GetPointer()"
-        field_to_json = '{0}({1}["{2}"], {3}, {4});'.format(function_name, parent_name, value_info.name, src, options_name)
+        field_to_json = '{0}(writer.Key("{1}"), {2}, {3});'.format(function_name, value_info.name, src, options_name)
         if "anon-union" in value_info.base_type:
             field_to_json += "// [anon-union] "
             print("ALERT: anon union " + value_info.name + " in " + parent_name)
@@ -100,36 +100,43 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
             GFXRECON_BEGIN_NAMESPACE(decode)
 
             using util::JsonOptions;
+            using util::JsonStreamWriter;
 
             // TODO Move all these manual functions out of the generator and into a .cpp file.
 
             /// @defgroup ManualD3D12StructFieldToJsons Manual functions to convert raw structs.
             /** @{ */
-            static void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
+            static void FieldToJson(JsonStreamWriter& writer, const D3D12_RENDER_PASS_BEGINNING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
             {
                 using namespace util;
-                FieldToJson(jdata["AdditionalWidth"],  data.AdditionalWidth,  options);
-                FieldToJson(jdata["AdditionalHeight"], data.AdditionalHeight, options);
+                writer.BeginObject();
+                FieldToJson(writer.Key("AdditionalWidth"),  data.AdditionalWidth,  options);
+                FieldToJson(writer.Key("AdditionalHeight"), data.AdditionalHeight, options);
+                writer.EndObject();
             }
 
-            static void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
+            static void FieldToJson(JsonStreamWriter& writer, const D3D12_RENDER_PASS_ENDING_ACCESS_PRESERVE_LOCAL_PARAMETERS& data, const JsonOptions& options)
             {
                 using namespace util;
-                FieldToJson(jdata["AdditionalWidth"], data.AdditionalWidth, options);
-                FieldToJson(jdata["AdditionalHeight"], data.AdditionalHeight, options);
+                writer.BeginObject();
+                FieldToJson(writer.Key("AdditionalWidth"), data.AdditionalWidth, options);
+                FieldToJson(writer.Key("AdditionalHeight"), data.AdditionalHeight, options);
+                writer.EndObject();
             }
 
             /// Manual raw struct functon to be used for Decoded_D3D12_CLEAR_VALUE conversion.
-            void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEPTH_STENCIL_VALUE& obj, const JsonOptions& options)
+            void FieldToJson(JsonStreamWriter& writer, const D3D12_DEPTH_STENCIL_VALUE& obj, const JsonOptions& options)
             {
-                FieldToJson(jdata["Depth"], obj.Depth, options);
-                FieldToJson(jdata["Stencil"], obj.Stencil, options);
+                writer.BeginObject();
+                FieldToJson(writer.Key("Depth"), obj.Depth, options);
+                FieldToJson(writer.Key("Stencil"), obj.Stencil, options);
+                writer.EndObject();
             }
             /** @} */
 
-            inline bool RepresentBinaryFile(const util::JsonOptions& json_options, nlohmann::ordered_json& jdata, std::string_view filename_base, const uint64_t instance_counter, const PointerDecoder<uint8_t>& data)
+            inline bool RepresentBinaryFile(const util::JsonOptions& json_options, JsonStreamWriter& writer, std::string_view filename_base, const uint64_t instance_counter, const PointerDecoder<uint8_t>& data)
             {
-                return RepresentBinaryFile(json_options, jdata, filename_base, instance_counter, data.GetLength(), data.GetPointer());
+                return RepresentBinaryFile(json_options, writer, filename_base, instance_counter, data.GetLength(), data.GetPointer());
             }
         ''')
         write(code, file=self.outFile)
@@ -140,17 +147,23 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
         for k, v in struct_dict.items():
             if not self.is_struct_black_listed(k):
                 body = format_cpp_code('''
-                    void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_{0}* data, const JsonOptions& options)
+                    void FieldToJson(JsonStreamWriter& writer, const Decoded_{0}* data, const JsonOptions& options)
                     {{
                         using namespace util;
                         if (data && data->decoded_value)
                         {{
                             const {0}& decoded_value = *data->decoded_value;
                             const Decoded_{0}& meta_struct = *data;
+                            writer.BeginObject();
                     '''.format(k))
                 body += '\n'
                 body += self.makeStructBody(k, v)
                 body += format_cpp_code('''
+                    writer.EndObject();
+                    }
+                    else
+                    {
+                        writer.Null();
                     }
                 }
                 ''', 2)
@@ -175,17 +188,17 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                     union_index += 1
                 elif (name, value_info.name) in self.binary_blobs:
                     field_to_json  = '        static thread_local uint64_t {0}_{1}_counter{{ 0 }};\n'
-                    field_to_json += '        const bool written = RepresentBinaryFile(options, jdata["{1}"], "{0}.{1}", {0}_{1}_counter, meta_struct.{1});\n'
+                    field_to_json += '        const bool written = RepresentBinaryFile(options, writer.Key("{1}"), "{0}.{1}", {0}_{1}_counter, meta_struct.{1});\n'
                     field_to_json += '        {0}_{1}_counter += written;\n'
                     field_to_json = field_to_json.format(name, value_info.name)
                 else:
                     function_name = self.choose_field_to_json_name(value_info)
                     if not (value_info.is_pointer or value_info.is_array or self.is_handle(value_info.base_type) or self.is_struct(value_info.base_type)):
                         # Basic data plumbs to raw struct:
-                        field_to_json = '        {0}(jdata["{1}"], decoded_value.{1}, options);'
+                        field_to_json = '        {0}(writer.Key("{1}"), decoded_value.{1}, options);'
                     else:
                         # Complex types, pointers and handles plumb to the decoded struct:
-                        field_to_json = '        {0}(jdata["{1}"], meta_struct.{1}, options);'
+                        field_to_json = '        {0}(writer.Key("{1}"), meta_struct.{1}, options);'
                     field_to_json = field_to_json.format(function_name, value_info.name, value_info.array_length)
                 body += field_to_json
                 body += '\n'
@@ -207,19 +220,19 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 {
                     case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
                     {
-                        FieldToJson(jdata["DescriptorTable"], meta_struct.DescriptorTable, options);
+                        FieldToJson(writer.Key("DescriptorTable"), meta_struct.DescriptorTable, options);
                         break;
                     }
                     case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
                     {
-                        FieldToJson(jdata["Constants"], meta_struct.Constants, options);
+                        FieldToJson(writer.Key("Constants"), meta_struct.Constants, options);
                         break;
                     }
                     case D3D12_ROOT_PARAMETER_TYPE_CBV:
                     case D3D12_ROOT_PARAMETER_TYPE_SRV:
                     case D3D12_ROOT_PARAMETER_TYPE_UAV:
                     {
-                        FieldToJson(jdata["Descriptor"], meta_struct.Descriptor, options);
+                        FieldToJson(writer.Key("Descriptor"), meta_struct.Descriptor, options);
                         break;
                     }
                 }
@@ -230,57 +243,57 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 {
                     case D3D12_SRV_DIMENSION_BUFFER:
                     {
-                        FieldToJson(jdata["Buffer"], meta_struct.Buffer, options);
+                        FieldToJson(writer.Key("Buffer"), meta_struct.Buffer, options);
                         break;
                     }
                     case D3D12_SRV_DIMENSION_TEXTURE1D:
                     {
-                        FieldToJson(jdata["Texture1D"], meta_struct.Texture1D, options);
+                        FieldToJson(writer.Key("Texture1D"), meta_struct.Texture1D, options);
                         break;
                     }
                     case D3D12_SRV_DIMENSION_TEXTURE1DARRAY:
                     {
-                        FieldToJson(jdata["Texture1DArray"], meta_struct.Texture1DArray, options);
+                        FieldToJson(writer.Key("Texture1DArray"), meta_struct.Texture1DArray, options);
                         break;
                     }
                     case D3D12_SRV_DIMENSION_TEXTURE2D:
                     {
-                        FieldToJson(jdata["Texture2D"], meta_struct.Texture2D, options);
+                        FieldToJson(writer.Key("Texture2D"), meta_struct.Texture2D, options);
                         break;
                     }
                     case D3D12_SRV_DIMENSION_TEXTURE2DARRAY:
                     {
-                        FieldToJson(jdata["Texture2DArray"], meta_struct.Texture2DArray, options);
+                        FieldToJson(writer.Key("Texture2DArray"), meta_struct.Texture2DArray, options);
                         break;
                     }
                     case D3D12_SRV_DIMENSION_TEXTURE2DMS:
                     {
-                        FieldToJson(jdata["Texture2DMS"], meta_struct.Texture2DMS, options);
+                        FieldToJson(writer.Key("Texture2DMS"), meta_struct.Texture2DMS, options);
                         break;
                     }
                     case D3D12_SRV_DIMENSION_TEXTURE2DMSARRAY:
                     {
-                        FieldToJson(jdata["Texture2DMSArray"], meta_struct.Texture2DMSArray, options);
+                        FieldToJson(writer.Key("Texture2DMSArray"), meta_struct.Texture2DMSArray, options);
                         break;
                     }
                     case D3D12_SRV_DIMENSION_TEXTURE3D:
                     {
-                        FieldToJson(jdata["Texture3D"], meta_struct.Texture3D, options);
+                        FieldToJson(writer.Key("Texture3D"), meta_struct.Texture3D, options);
                         break;
                     }
                     case D3D12_SRV_DIMENSION_TEXTURECUBE:
                     {
-                        FieldToJson(jdata["TextureCube"], meta_struct.TextureCube, options);
+                        FieldToJson(writer.Key("TextureCube"), meta_struct.TextureCube, options);
                         break;
                     }
                     case D3D12_SRV_DIMENSION_TEXTURECUBEARRAY:
                     {
-                        FieldToJson(jdata["TextureCubeArray"], meta_struct.TextureCubeArray, options);
+                        FieldToJson(writer.Key("TextureCubeArray"), meta_struct.TextureCubeArray, options);
                         break;
                     }
                     case D3D12_SRV_DIMENSION_RAYTRACING_ACCELERATION_STRUCTURE:
                     {
-                        FieldToJson(jdata["RaytracingAccelerationStructure"], meta_struct.RaytracingAccelerationStructure, options);
+                        FieldToJson(writer.Key("RaytracingAccelerationStructure"), meta_struct.RaytracingAccelerationStructure, options);
                         break;
                     }
                 }
@@ -289,11 +302,11 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 field_to_json = '''
                     if(decoded_value.Flags & D3D12_SAMPLER_FLAG_UINT_BORDER_COLOR)
                     {
-                        FieldToJson(jdata["UintBorderColor"], decoded_value.UintBorderColor, options);
+                        FieldToJson(writer.Key("UintBorderColor"), decoded_value.UintBorderColor, options);
                     }
                     else
                     {
-                        FieldToJson(jdata["FloatBorderColor"], decoded_value.FloatBorderColor, options);
+                        FieldToJson(writer.Key("FloatBorderColor"), decoded_value.FloatBorderColor, options);
                     }
                 '''
             case "D3D12_UNORDERED_ACCESS_VIEW_DESC":
@@ -302,53 +315,53 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                     {
                         case D3D12_UAV_DIMENSION_UNKNOWN:
                         {
-                            FieldToJson(jdata[format::kNameWarning], "Zero-valued ViewDimension is meaningless. Is struct corrupted?", options);
+                            FieldToJson(writer.Key(format::kNameWarning), "Zero-valued ViewDimension is meaningless. Is struct corrupted?", options);
                             break;
                         }
                         case D3D12_UAV_DIMENSION_BUFFER:
                         {
-                            FieldToJson(jdata["Buffer"], meta_struct.Buffer, options);
+                            FieldToJson(writer.Key("Buffer"), meta_struct.Buffer, options);
                             break;
                         }
                         case D3D12_UAV_DIMENSION_TEXTURE1D:
                         {
-                            FieldToJson(jdata["Texture1D"], meta_struct.Texture1D, options);
+                            FieldToJson(writer.Key("Texture1D"), meta_struct.Texture1D, options);
                             break;
                         }
                         case D3D12_UAV_DIMENSION_TEXTURE1DARRAY:
                         {
-                            FieldToJson(jdata["Texture1DArray"], meta_struct.Texture1DArray, options);
+                            FieldToJson(writer.Key("Texture1DArray"), meta_struct.Texture1DArray, options);
                             break;
                         }
                         case D3D12_UAV_DIMENSION_TEXTURE2D:
                         {
-                            FieldToJson(jdata["Texture2D"], meta_struct.Texture2D, options);
+                            FieldToJson(writer.Key("Texture2D"), meta_struct.Texture2D, options);
                             break;
                         }
                         case D3D12_UAV_DIMENSION_TEXTURE2DARRAY:
                         {
-                            FieldToJson(jdata["Texture2DArray"], meta_struct.Texture2DArray, options);
+                            FieldToJson(writer.Key("Texture2DArray"), meta_struct.Texture2DArray, options);
                             break;
                         }
                         case D3D12_UAV_DIMENSION_TEXTURE2DMS:
                         {
-                            FieldToJson(jdata["Texture2DMS"], meta_struct.Texture2DMS, options);
+                            FieldToJson(writer.Key("Texture2DMS"), meta_struct.Texture2DMS, options);
                             break;
                         }
                         case D3D12_UAV_DIMENSION_TEXTURE2DMSARRAY:
                         {
-                            FieldToJson(jdata["Texture2DMSArray"], meta_struct.Texture2DMSArray, options);
+                            FieldToJson(writer.Key("Texture2DMSArray"), meta_struct.Texture2DMSArray, options);
                             break;
                         }
                         case D3D12_UAV_DIMENSION_TEXTURE3D:
                         {
-                            FieldToJson(jdata["Texture3D"], meta_struct.Texture3D, options);
+                            FieldToJson(writer.Key("Texture3D"), meta_struct.Texture3D, options);
                             break;
                         }
                         default:
                         {
-                            FieldToJson(jdata[format::kNameWarning], "ViewDimension with unknown value. Is struct corrupted?", options);
-                            FieldToJson(jdata["Unknown value"], uint32_t(decoded_value.ViewDimension), options);
+                            FieldToJson(writer.Key(format::kNameWarning), "ViewDimension with unknown value. Is struct corrupted?", options);
+                            FieldToJson(writer.Key("Unknown value"), uint32_t(decoded_value.ViewDimension), options);
                             break;
                         }
                     }
@@ -359,53 +372,53 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                     {
                         case D3D12_RTV_DIMENSION_UNKNOWN:
                         {
-                            FieldToJson(jdata[format::kNameWarning], "Zero D3D12_RTV_DIMENSION in D3D12_RENDER_TARGET_VIEW_DESC.", options);
+                            FieldToJson(writer.Key(format::kNameWarning), "Zero D3D12_RTV_DIMENSION in D3D12_RENDER_TARGET_VIEW_DESC.", options);
                             break;
                         }
                         case D3D12_RTV_DIMENSION_BUFFER:
                         {
-                            FieldToJson(jdata["Buffer"], meta_struct.Buffer, options);
+                            FieldToJson(writer.Key("Buffer"), meta_struct.Buffer, options);
                             break;
                         }
                         case D3D12_RTV_DIMENSION_TEXTURE1D:
                         {
-                            FieldToJson(jdata["Texture1D"], meta_struct.Texture1D, options);
+                            FieldToJson(writer.Key("Texture1D"), meta_struct.Texture1D, options);
                             break;
                         }
                         case D3D12_RTV_DIMENSION_TEXTURE1DARRAY:
                         {
-                            FieldToJson(jdata["Texture1DArray"], meta_struct.Texture1DArray, options);
+                            FieldToJson(writer.Key("Texture1DArray"), meta_struct.Texture1DArray, options);
                             break;
                         }
                         case D3D12_RTV_DIMENSION_TEXTURE2D:
                         {
-                            FieldToJson(jdata["Texture2D"], meta_struct.Texture2D, options);
+                            FieldToJson(writer.Key("Texture2D"), meta_struct.Texture2D, options);
                             break;
                         }
                         case D3D12_RTV_DIMENSION_TEXTURE2DARRAY:
                         {
-                            FieldToJson(jdata["Texture2DArray"], meta_struct.Texture2DArray, options);
+                            FieldToJson(writer.Key("Texture2DArray"), meta_struct.Texture2DArray, options);
                             break;
                         }
                         case D3D12_RTV_DIMENSION_TEXTURE2DMS:
                         {
-                            FieldToJson(jdata["Texture2DMS"], meta_struct.Texture2DMS, options);
+                            FieldToJson(writer.Key("Texture2DMS"), meta_struct.Texture2DMS, options);
                             break;
                         }
                         case D3D12_RTV_DIMENSION_TEXTURE2DMSARRAY:
                         {
-                            FieldToJson(jdata["Texture2DMSArray"], meta_struct.Texture2DMSArray, options);
+                            FieldToJson(writer.Key("Texture2DMSArray"), meta_struct.Texture2DMSArray, options);
                             break;
                         }
                         case D3D12_RTV_DIMENSION_TEXTURE3D:
                         {
-                            FieldToJson(jdata["Texture3D"], meta_struct.Texture3D, options);
+                            FieldToJson(writer.Key("Texture3D"), meta_struct.Texture3D, options);
                             break;
                         }
                         default:
                         {
-                            FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RTV_DIMENSION in D3D12_RENDER_TARGET_VIEW_DESC. Corrupt struct?", options);
-                            FieldToJson(jdata["Unknown value"], uint32_t(decoded_value.ViewDimension), options);
+                            FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_RTV_DIMENSION in D3D12_RENDER_TARGET_VIEW_DESC. Corrupt struct?", options);
+                            FieldToJson(writer.Key("Unknown value"), uint32_t(decoded_value.ViewDimension), options);
                             break;
                         }
                     }
@@ -416,43 +429,43 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                     {
                         case D3D12_DSV_DIMENSION_UNKNOWN:
                         {
-                            FieldToJson(jdata[format::kNameWarning], "Zero D3D12_DSV_DIMENSION in D3D12_DEPTH_STENCIL_VIEW_DESC.", options);
+                            FieldToJson(writer.Key(format::kNameWarning), "Zero D3D12_DSV_DIMENSION in D3D12_DEPTH_STENCIL_VIEW_DESC.", options);
                             break;
                         }
                         case D3D12_DSV_DIMENSION_TEXTURE1D:
                         {
-                            FieldToJson(jdata["Texture1D"], meta_struct.Texture1D, options);
+                            FieldToJson(writer.Key("Texture1D"), meta_struct.Texture1D, options);
                             break;
                         }
                         case D3D12_DSV_DIMENSION_TEXTURE1DARRAY:
                         {
-                            FieldToJson(jdata["Texture1DArray"], meta_struct.Texture1DArray, options);
+                            FieldToJson(writer.Key("Texture1DArray"), meta_struct.Texture1DArray, options);
                             break;
                         }
                         case D3D12_DSV_DIMENSION_TEXTURE2D:
                         {
-                            FieldToJson(jdata["Texture2D"], meta_struct.Texture2D, options);
+                            FieldToJson(writer.Key("Texture2D"), meta_struct.Texture2D, options);
                             break;
                         }
                         case D3D12_DSV_DIMENSION_TEXTURE2DARRAY:
                         {
-                            FieldToJson(jdata["Texture2DArray"], meta_struct.Texture2DArray, options);
+                            FieldToJson(writer.Key("Texture2DArray"), meta_struct.Texture2DArray, options);
                             break;
                         }
                         case D3D12_DSV_DIMENSION_TEXTURE2DMS:
                         {
-                            FieldToJson(jdata["Texture2DMS"], meta_struct.Texture2DMS, options);
+                            FieldToJson(writer.Key("Texture2DMS"), meta_struct.Texture2DMS, options);
                             break;
                         }
                         case D3D12_DSV_DIMENSION_TEXTURE2DMSARRAY:
                         {
-                            FieldToJson(jdata["Texture2DMSArray"], meta_struct.Texture2DMSArray, options);
+                            FieldToJson(writer.Key("Texture2DMSArray"), meta_struct.Texture2DMSArray, options);
                             break;
                         }
                         default:
                         {
-                            FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_DSV_DIMENSION in D3D12_DEPTH_STENCIL_VIEW_DESC. Corrupt struct?", options);
-                            FieldToJson(jdata["Unknown value"], uint32_t(decoded_value.ViewDimension), options);
+                            FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_DSV_DIMENSION in D3D12_DEPTH_STENCIL_VIEW_DESC. Corrupt struct?", options);
+                            FieldToJson(writer.Key("Unknown value"), uint32_t(decoded_value.ViewDimension), options);
                             break;
                         }
                     }
@@ -463,25 +476,25 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 {
                     case D3D12_ROOT_PARAMETER_TYPE_DESCRIPTOR_TABLE:
                     {
-                        FieldToJson(jdata["DescriptorTable"], meta_struct.DescriptorTable, options);
+                        FieldToJson(writer.Key("DescriptorTable"), meta_struct.DescriptorTable, options);
                         break;
                     }
                     case D3D12_ROOT_PARAMETER_TYPE_32BIT_CONSTANTS:
                     {
-                        FieldToJson(jdata["Constants"], meta_struct.Constants, options);
+                        FieldToJson(writer.Key("Constants"), meta_struct.Constants, options);
                         break;
                     }
                     case D3D12_ROOT_PARAMETER_TYPE_CBV:
                     case D3D12_ROOT_PARAMETER_TYPE_SRV:
                     case D3D12_ROOT_PARAMETER_TYPE_UAV:
                     {
-                        FieldToJson(jdata["Descriptor"], meta_struct.Descriptor, options);
+                        FieldToJson(writer.Key("Descriptor"), meta_struct.Descriptor, options);
                         break;
                     }
                     default:
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_ROOT_PARAMETER_TYPE in D3D12_ROOT_PARAMETER1.", options);
-                        FieldToJson(jdata["Unknown value"], uint32_t(decoded_value.ParameterType), options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_ROOT_PARAMETER_TYPE in D3D12_ROOT_PARAMETER1.", options);
+                        FieldToJson(writer.Key("Unknown value"), uint32_t(decoded_value.ParameterType), options);
                         break;
                     }
                 }
@@ -492,23 +505,23 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 {
                     case D3D_ROOT_SIGNATURE_VERSION_1_0:
                     {
-                        FieldToJson(jdata["Desc_1_0"], meta_struct.Desc_1_0, options);
+                        FieldToJson(writer.Key("Desc_1_0"), meta_struct.Desc_1_0, options);
                         break;
                     }
                     case D3D_ROOT_SIGNATURE_VERSION_1_1:
                     {
-                        FieldToJson(jdata["Desc_1_1"], meta_struct.Desc_1_1, options);
+                        FieldToJson(writer.Key("Desc_1_1"), meta_struct.Desc_1_1, options);
                         break;
                     }
                     case D3D_ROOT_SIGNATURE_VERSION_1_2:
                     {
-                        FieldToJson(jdata["Desc_1_2"], meta_struct.Desc_1_2, options);
+                        FieldToJson(writer.Key("Desc_1_2"), meta_struct.Desc_1_2, options);
                         GFXRECON_LOG_ERROR("Unknown D3D_ROOT_SIGNATURE_VERSION_1_2 in D3D12_VERSIONED_ROOT_SIGNATURE_DESC.");
                         break;
                     }
                     default:
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Unknown D3D_ROOT_SIGNATURE_VERSION in D3D12_VERSIONED_ROOT_SIGNATURE_DESC.", options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D_ROOT_SIGNATURE_VERSION in D3D12_VERSIONED_ROOT_SIGNATURE_DESC.", options);
                         break;
                     }
                 }
@@ -526,40 +539,45 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                     }
                     case D3D12_INDIRECT_ARGUMENT_TYPE_VERTEX_BUFFER_VIEW:
                     {
-                        auto& vb = jdata["VertexBuffer"];
-                        FieldToJson(vb["Slot"], decoded_value.VertexBuffer.Slot, options);
+                        writer.Key("VertexBuffer").BeginObject();
+                        FieldToJson(writer.Key("Slot"), decoded_value.VertexBuffer.Slot, options);
+                        writer.EndObject();
                         break;
                     }
                     case D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW:
                     {
                         // No parameters to output.
-                        FieldToJson(jdata["comment"], "There must be a D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED in the same sequence.", options);
+                        FieldToJson(writer.Key("comment"), "There must be a D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED in the same sequence.", options);
                         break;
                     }
                     case D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT:
                     {
-                        auto& c = jdata["Constant"];
-                        FieldToJson(c["RootParameterIndex"], decoded_value.Constant.RootParameterIndex, options);
-                        FieldToJson(c["DestOffsetIn32BitValues"], decoded_value.Constant.DestOffsetIn32BitValues, options);
-                        FieldToJson(c["Num32BitValuesToSet"], decoded_value.Constant.Num32BitValuesToSet, options);
+                        writer.Key("Constant").BeginObject();
+                        FieldToJson(writer.Key("RootParameterIndex"), decoded_value.Constant.RootParameterIndex, options);
+                        FieldToJson(writer.Key("DestOffsetIn32BitValues"), decoded_value.Constant.DestOffsetIn32BitValues, options);
+                        FieldToJson(writer.Key("Num32BitValuesToSet"), decoded_value.Constant.Num32BitValuesToSet, options);
+                        writer.EndObject();
                         break;
                     }
                     case D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT_BUFFER_VIEW:
                     {
-                        auto& cbv = jdata["ConstantBufferView"];
-                        FieldToJson(cbv["RootParameterIndex"], decoded_value.ConstantBufferView.RootParameterIndex, options);
+                        writer.Key("ConstantBufferView").BeginObject();
+                        FieldToJson(writer.Key("RootParameterIndex"), decoded_value.ConstantBufferView.RootParameterIndex, options);
+                        writer.EndObject();
                         break;
                     }
                     case D3D12_INDIRECT_ARGUMENT_TYPE_SHADER_RESOURCE_VIEW:
                     {
-                        auto& srv = jdata["ShaderResourceView"];
-                        FieldToJson(srv["RootParameterIndex"], decoded_value.ShaderResourceView.RootParameterIndex, options);
+                        writer.Key("ShaderResourceView").BeginObject();
+                        FieldToJson(writer.Key("RootParameterIndex"), decoded_value.ShaderResourceView.RootParameterIndex, options);
+                        writer.EndObject();
                         break;
                     }
                     case D3D12_INDIRECT_ARGUMENT_TYPE_UNORDERED_ACCESS_VIEW:
                     {
-                        auto& uav = jdata["UnorderedAccessView"];
-                        FieldToJson(uav["RootParameterIndex"], decoded_value.UnorderedAccessView.RootParameterIndex, options);
+                        writer.Key("UnorderedAccessView").BeginObject();
+                        FieldToJson(writer.Key("RootParameterIndex"), decoded_value.UnorderedAccessView.RootParameterIndex, options);
+                        writer.EndObject();
                         break;
                     }
                     case D3D12_INDIRECT_ARGUMENT_TYPE_DISPATCH_RAYS:
@@ -570,7 +588,7 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                     }
                     default:
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_INDIRECT_ARGUMENT_TYPE in D3D12_INDIRECT_ARGUMENT_DESC.", options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_INDIRECT_ARGUMENT_TYPE in D3D12_INDIRECT_ARGUMENT_DESC.", options);
                         break;
                     }
                 }
@@ -581,17 +599,17 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 {
                     case D3D12_RAYTRACING_GEOMETRY_TYPE_TRIANGLES:
                     {
-                        FieldToJson(jdata["Triangles"], meta_struct.Triangles, options);
+                        FieldToJson(writer.Key("Triangles"), meta_struct.Triangles, options);
                         break;
                     }
                     case D3D12_RAYTRACING_GEOMETRY_TYPE_PROCEDURAL_PRIMITIVE_AABBS:
                     {
-                        FieldToJson(jdata["AABBs"], meta_struct.AABBs, options);
+                        FieldToJson(writer.Key("AABBs"), meta_struct.AABBs, options);
                         break;
                     }
                     default:
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RAYTRACING_GEOMETRY_TYPE in D3D12_RAYTRACING_GEOMETRY_DESC.", options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_RAYTRACING_GEOMETRY_TYPE in D3D12_RAYTRACING_GEOMETRY_DESC.", options);
                         break;
                     }
                 }
@@ -602,7 +620,7 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 {
                     case D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_TOP_LEVEL:
                     {
-                        FieldToJsonAsHex(jdata["InstanceDescs"], decoded_value.InstanceDescs, options);
+                        FieldToJsonAsHex(writer.Key("InstanceDescs"), decoded_value.InstanceDescs, options);
                         break;
                     }
                     case D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE_BOTTOM_LEVEL:
@@ -611,12 +629,12 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                         {
                             case D3D12_ELEMENTS_LAYOUT_ARRAY:
                             {
-                                FieldToJson(jdata["pGeometryDescs"], meta_struct.pGeometryDescs, options);
+                                FieldToJson(writer.Key("pGeometryDescs"), meta_struct.pGeometryDescs, options);
                                 break;
                             }
                             case D3D12_ELEMENTS_LAYOUT_ARRAY_OF_POINTERS:
                             {
-                                FieldToJson(jdata["ppGeometryDescs"], meta_struct.ppGeometryDescs, options);
+                                FieldToJson(writer.Key("ppGeometryDescs"), meta_struct.ppGeometryDescs, options);
                                 break;
                             }
                         }
@@ -624,7 +642,7 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                     }
                     default:
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE in D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS.", options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE in D3D12_BUILD_RAYTRACING_ACCELERATION_STRUCTURE_INPUTS.", options);
                         break;
                     }
                 }
@@ -635,28 +653,28 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 {
                     case D3D12_DRED_VERSION_1_0:
                     {
-                        FieldToJson(jdata["Dred_1_0"], meta_struct.Dred_1_0, options);
+                        FieldToJson(writer.Key("Dred_1_0"), meta_struct.Dred_1_0, options);
                         break;
                     }
                     case D3D12_DRED_VERSION_1_1:
                     {
-                        FieldToJson(jdata["Dred_1_1"], meta_struct.Dred_1_1, options);
+                        FieldToJson(writer.Key("Dred_1_1"), meta_struct.Dred_1_1, options);
                         break;
                     }
                     case D3D12_DRED_VERSION_1_2:
                     {
-                        FieldToJson(jdata["Dred_1_2"], meta_struct.Dred_1_2, options);
+                        FieldToJson(writer.Key("Dred_1_2"), meta_struct.Dred_1_2, options);
                         break;
                     }
                     case D3D12_DRED_VERSION_1_3:
                     {
-                        FieldToJson(jdata["Dred_1_3"], meta_struct.Dred_1_3, options);
-                        FieldToJson(jdata[format::kNameWarning], "Dred_1_3 is not supported by GFXR at this time. Please file an issue quoting this text if this is a blocker for you.", options);
+                        FieldToJson(writer.Key("Dred_1_3"), meta_struct.Dred_1_3, options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Dred_1_3 is not supported by GFXR at this time. Please file an issue quoting this text if this is a blocker for you.", options);
                         break;
                     }
                     default:
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_DRED_VERSION in D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA.", options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_DRED_VERSION in D3D12_VERSIONED_DEVICE_REMOVED_EXTENDED_DATA.", options);
                         break;
                     }
                 }
@@ -667,18 +685,18 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 {
                     case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_CLEAR:
                     {
-                        FieldToJson(jdata["Clear"], meta_struct.Clear, options);
+                        FieldToJson(writer.Key("Clear"), meta_struct.Clear, options);
                         break;
                     }
                     case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE_LOCAL_RENDER:
                     if(decoded_value.PreserveLocal.AdditionalWidth != 0U || decoded_value.PreserveLocal.AdditionalHeight != 0U)
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Additional width and height should be zero (see DirectX Specs).", options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Additional width and height should be zero (see DirectX Specs).", options);
                     }
                     case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE_LOCAL_SRV:
                     case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_PRESERVE_LOCAL_UAV:
                     {
-                        FieldToJson(jdata["PreserveLocal"], decoded_value.PreserveLocal, options);
+                        FieldToJson(writer.Key("PreserveLocal"), decoded_value.PreserveLocal, options);
                         break;
                     }
                     case D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE_DISCARD:
@@ -689,7 +707,7 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
 
                     default:
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE in D3D12_RENDER_PASS_BEGINNING_ACCESS.", options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE in D3D12_RENDER_PASS_BEGINNING_ACCESS.", options);
                         break;
                     }
                 }
@@ -706,20 +724,20 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
 
                     case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_RESOLVE:
                     {
-                        FieldToJson(jdata["Resolve"], meta_struct.Resolve, options);
+                        FieldToJson(writer.Key("Resolve"), meta_struct.Resolve, options);
                         break;
                     }
                     case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE_LOCAL_RENDER:
                     case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE_LOCAL_SRV:
                     case D3D12_RENDER_PASS_ENDING_ACCESS_TYPE_PRESERVE_LOCAL_UAV:
                     {
-                        FieldToJson(jdata["PreserveLocal"], decoded_value.PreserveLocal, options);
+                        FieldToJson(writer.Key("PreserveLocal"), decoded_value.PreserveLocal, options);
                         break;
                     }
 
                     default:
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RENDER_PASS_ENDING_ACCESS_TYPE in D3D12_RENDER_PASS_ENDING_ACCESS.", options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_RENDER_PASS_ENDING_ACCESS_TYPE in D3D12_RENDER_PASS_ENDING_ACCESS.", options);
                         break;
                     }
                 }
@@ -730,22 +748,22 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 {
                     case D3D12_BARRIER_TYPE_GLOBAL:
                     {
-                        FieldToJson(jdata["pGlobalBarriers"], meta_struct.global_barriers, options);
+                        FieldToJson(writer.Key("pGlobalBarriers"), meta_struct.global_barriers, options);
                         break;
                     }
                     case D3D12_BARRIER_TYPE_TEXTURE:
                     {
-                        FieldToJson(jdata["pTextureBarriers"], meta_struct.texture_barriers, options);
+                        FieldToJson(writer.Key("pTextureBarriers"), meta_struct.texture_barriers, options);
                         break;
                     }
                     case D3D12_BARRIER_TYPE_BUFFER:
                     {
-                        FieldToJson(jdata["pBufferBarriers"], meta_struct.buffer_barriers, options);
+                        FieldToJson(writer.Key("pBufferBarriers"), meta_struct.buffer_barriers, options);
                         break;
                     }
                     default:
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_BARRIER_TYPE in D3D12_BARRIER_GROUP.", options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_BARRIER_TYPE in D3D12_BARRIER_GROUP.", options);
                         break;
                     }
                 }
@@ -754,11 +772,11 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 field_to_json = '''
                 if(graphics::dx12::IsDepthStencilFormat(decoded_value.Format))
                 {
-                    FieldToJson(jdata["DepthStencil"], decoded_value.DepthStencil, options);
+                    FieldToJson(writer.Key("DepthStencil"), decoded_value.DepthStencil, options);
                 }
                 else
                 {
-                    FieldToJson(jdata["Color"], decoded_value.Color, options);
+                    FieldToJson(writer.Key("Color"), decoded_value.Color, options);
                 }
                 '''
             case "D3D12_RESOURCE_BARRIER":
@@ -767,22 +785,22 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 {
                     case D3D12_RESOURCE_BARRIER_TYPE_TRANSITION:
                     {
-                        FieldToJson(jdata["Transition"], meta_struct.Transition, options);
+                        FieldToJson(writer.Key("Transition"), meta_struct.Transition, options);
                         break;
                     }
                     case D3D12_RESOURCE_BARRIER_TYPE_ALIASING:
                     {
-                        FieldToJson(jdata["Aliasing"], meta_struct.Aliasing, options);
+                        FieldToJson(writer.Key("Aliasing"), meta_struct.Aliasing, options);
                         break;
                     }
                     case D3D12_RESOURCE_BARRIER_TYPE_UAV:
                     {
-                        FieldToJson(jdata["UAV"], meta_struct.UAV, options);
+                        FieldToJson(writer.Key("UAV"), meta_struct.UAV, options);
                         break;
                     }
                     default:
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_RESOURCE_BARRIER_TYPE in D3D12_RESOURCE_BARRIER.", options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_RESOURCE_BARRIER_TYPE in D3D12_RESOURCE_BARRIER.", options);
                         break;
                     }
                 }
@@ -793,17 +811,17 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
                 {
                     case D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX:
                     {
-                        FieldToJson(jdata["SubresourceIndex"], decoded_value.SubresourceIndex, options);
+                        FieldToJson(writer.Key("SubresourceIndex"), decoded_value.SubresourceIndex, options);
                         break;
                     }
                     case D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT:
                     {
-                        FieldToJson(jdata["PlacedFootprint"], meta_struct.PlacedFootprint, options);
+                        FieldToJson(writer.Key("PlacedFootprint"), meta_struct.PlacedFootprint, options);
                         break;
                     }
                     default:
                     {
-                        FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_TEXTURE_COPY_TYPE in D3D12_TEXTURE_COPY_LOCATION.", options);
+                        FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_TEXTURE_COPY_TYPE in D3D12_TEXTURE_COPY_LOCATION.", options);
                         break;
                     }
                 }
@@ -824,24 +842,32 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
             /** @{*/
 
             // Decoded_LARGE_INTEGER won't be generated as it is a <winnt.h> struct rather than D3D12.
-            void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LARGE_INTEGER* data, const JsonOptions& options)
+            void FieldToJson(JsonStreamWriter& writer, const Decoded_LARGE_INTEGER* data, const JsonOptions& options)
             {
                 using namespace util;
                 if (data && data->decoded_value)
                 {
                     const LARGE_INTEGER& decoded_value = *data->decoded_value;
-                    FieldToJson(jdata, decoded_value.QuadPart, options);
+                    FieldToJson(writer, decoded_value.QuadPart, options);
+                }
+                else
+                {
+                    writer.Null();
                 }
             }
 
             // Generated version tries to read the struct members rather than doing the "fake enum" thing.
-            void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_GUID* data, const JsonOptions& options)
+            void FieldToJson(JsonStreamWriter& writer, const Decoded_GUID* data, const JsonOptions& options)
             {
                 using namespace util;
                 if (data && data->decoded_value)
                 {
                     const GUID& decoded_value = *data->decoded_value;
-                    FieldToJson(jdata, decoded_value, options);
+                    FieldToJson(writer, decoded_value, options);
+                }
+                else
+                {
+                    writer.Null();
                 }
             }
 
@@ -850,104 +876,122 @@ class Dx12StructDecodersToJsonBodyGenerator(Dx12JsonCommonGenerator):
             /// and a byte count with the structure defined in documentation. See:
             /// <https://learn.microsoft.com/en-us/windows/win32/api/d3d12/ns-d3d12-d3d12_pipeline_state_stream_desc>
             /// See also: framework\decode\custom_dx12_struct_decoders.cpp
-            void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* data, const JsonOptions& options)
+            void FieldToJson(JsonStreamWriter& writer, const Decoded_D3D12_PIPELINE_STATE_STREAM_DESC* data, const JsonOptions& options)
             {
                 using namespace util;
                 if (data && data->decoded_value)
                 {
                     const D3D12_PIPELINE_STATE_STREAM_DESC& decoded_value = *data->decoded_value;
                     const Decoded_D3D12_PIPELINE_STATE_STREAM_DESC& meta_struct = *data;
-                    FieldToJson(jdata["SizeInBytes"], decoded_value.SizeInBytes, options); // Basic data plumbs to raw struct.
-                    //FieldToJson(jdata["root_signature_ptr"], meta_struct.root_signature_ptr, options);
-                    FieldToJson(jdata[format::kNameWarning], "D3D12_PIPELINE_STATE_STREAM_DESC.root_signature_ptr is not supported.", options);
-                    FieldToJson(jdata["root_signature_ptr"], "@todo Get this field to convert cleanly.", options);
-                    FieldToJson(jdata["vs_bytecode"], meta_struct.vs_bytecode, options);
-                    FieldToJson(jdata["ps_bytecode"], meta_struct.ps_bytecode, options);
-                    FieldToJson(jdata["ds_bytecode"], meta_struct.ds_bytecode, options);
-                    FieldToJson(jdata["hs_bytecode"], meta_struct.hs_bytecode, options);
-                    FieldToJson(jdata["gs_bytecode"], meta_struct.gs_bytecode, options);
-                    FieldToJson(jdata["cs_bytecode"], meta_struct.cs_bytecode, options);
-                    FieldToJson(jdata["as_bytecode"], meta_struct.as_bytecode, options);
-                    FieldToJson(jdata["ms_bytecode"], meta_struct.ms_bytecode, options);
-                    FieldToJson(jdata["stream_output"], meta_struct.stream_output, options);
-                    FieldToJson(jdata["blend"], meta_struct.blend, options);
-                    FieldToJson(jdata["rasterizer"], meta_struct.rasterizer, options);
-                    FieldToJson(jdata["depth_stencil"], meta_struct.depth_stencil, options);
-                    FieldToJson(jdata["input_layout"], meta_struct.input_layout, options);
-                    FieldToJson(jdata["render_target_formats"], meta_struct.render_target_formats, options);
-                    FieldToJson(jdata["sample_desc"], meta_struct.sample_desc, options);
-                    FieldToJson(jdata["cached_pso"], meta_struct.cached_pso, options);
-                    FieldToJson(jdata["depth_stencil1"], meta_struct.depth_stencil1, options);
-                    FieldToJson(jdata["view_instancing"], meta_struct.view_instancing, options);
+                    writer.BeginObject();
+                    FieldToJson(writer.Key("SizeInBytes"), decoded_value.SizeInBytes, options); // Basic data plumbs to raw struct.
+                    //FieldToJson(writer.Key("root_signature_ptr"), meta_struct.root_signature_ptr, options);
+                    FieldToJson(writer.Key(format::kNameWarning), "D3D12_PIPELINE_STATE_STREAM_DESC.root_signature_ptr is not supported.", options);
+                    FieldToJson(writer.Key("root_signature_ptr"), "@todo Get this field to convert cleanly.", options);
+                    FieldToJson(writer.Key("vs_bytecode"), meta_struct.vs_bytecode, options);
+                    FieldToJson(writer.Key("ps_bytecode"), meta_struct.ps_bytecode, options);
+                    FieldToJson(writer.Key("ds_bytecode"), meta_struct.ds_bytecode, options);
+                    FieldToJson(writer.Key("hs_bytecode"), meta_struct.hs_bytecode, options);
+                    FieldToJson(writer.Key("gs_bytecode"), meta_struct.gs_bytecode, options);
+                    FieldToJson(writer.Key("cs_bytecode"), meta_struct.cs_bytecode, options);
+                    FieldToJson(writer.Key("as_bytecode"), meta_struct.as_bytecode, options);
+                    FieldToJson(writer.Key("ms_bytecode"), meta_struct.ms_bytecode, options);
+                    FieldToJson(writer.Key("stream_output"), meta_struct.stream_output, options);
+                    FieldToJson(writer.Key("blend"), meta_struct.blend, options);
+                    FieldToJson(writer.Key("rasterizer"), meta_struct.rasterizer, options);
+                    FieldToJson(writer.Key("depth_stencil"), meta_struct.depth_stencil, options);
+                    FieldToJson(writer.Key("input_layout"), meta_struct.input_layout, options);
+                    FieldToJson(writer.Key("render_target_formats"), meta_struct.render_target_formats, options);
+                    FieldToJson(writer.Key("sample_desc"), meta_struct.sample_desc, options);
+                    FieldToJson(writer.Key("cached_pso"), meta_struct.cached_pso, options);
+                    FieldToJson(writer.Key("depth_stencil1"), meta_struct.depth_stencil1, options);
+                    FieldToJson(writer.Key("view_instancing"), meta_struct.view_instancing, options);
+                    writer.EndObject();
+                }
+                else
+                {
+                    writer.Null();
                 }
             }
 
             // The decoded struct has a custom implementation.
-            void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_STATE_SUBOBJECT* data, const JsonOptions& options)
+            void FieldToJson(JsonStreamWriter& writer, const Decoded_D3D12_STATE_SUBOBJECT* data, const JsonOptions& options)
             {
                 using namespace util;
                 if (data && data->decoded_value)
                 {
                     const D3D12_STATE_SUBOBJECT& decoded_value = *data->decoded_value;
                     const Decoded_D3D12_STATE_SUBOBJECT& meta_struct = *data;
-                    FieldToJson(jdata["Type"], decoded_value.Type, options);
+                    writer.BeginObject();
+                    FieldToJson(writer.Key("Type"), decoded_value.Type, options);
                     switch(decoded_value.Type)
                     {
                         case D3D12_STATE_SUBOBJECT_TYPE_STATE_OBJECT_CONFIG:
-                        FieldToJson(jdata["state_object_config"], meta_struct.state_object_config, options);
+                        FieldToJson(writer.Key("state_object_config"), meta_struct.state_object_config, options);
                         break;
                         case D3D12_STATE_SUBOBJECT_TYPE_GLOBAL_ROOT_SIGNATURE:
-                        FieldToJson(jdata["global_root_signature"], meta_struct.global_root_signature, options);
+                        FieldToJson(writer.Key("global_root_signature"), meta_struct.global_root_signature, options);
                         break;
                         case D3D12_STATE_SUBOBJECT_TYPE_LOCAL_ROOT_SIGNATURE:
-                        FieldToJson(jdata["local_root_signature"], meta_struct.local_root_signature, options);
+                        FieldToJson(writer.Key("local_root_signature"), meta_struct.local_root_signature, options);
                         break;
                         case D3D12_STATE_SUBOBJECT_TYPE_NODE_MASK:
-                        FieldToJson(jdata["node_mask"], meta_struct.node_mask, options);
+                        FieldToJson(writer.Key("node_mask"), meta_struct.node_mask, options);
                         break;
                         case D3D12_STATE_SUBOBJECT_TYPE_DXIL_LIBRARY:
-                        FieldToJson(jdata["dxil_library_desc"], meta_struct.dxil_library_desc, options);
+                        FieldToJson(writer.Key("dxil_library_desc"), meta_struct.dxil_library_desc, options);
                         break;
                         case D3D12_STATE_SUBOBJECT_TYPE_EXISTING_COLLECTION:
-                        FieldToJson(jdata["existing_collection_desc"], meta_struct.existing_collection_desc, options);
+                        FieldToJson(writer.Key("existing_collection_desc"), meta_struct.existing_collection_desc, options);
                         break;
                         case D3D12_STATE_SUBOBJECT_TYPE_SUBOBJECT_TO_EXPORTS_ASSOCIATION:
-                        FieldToJson(jdata["subobject_to_exports_association"], meta_struct.subobject_to_exports_association, options);
+                        FieldToJson(writer.Key("subobject_to_exports_association"), meta_struct.subobject_to_exports_association, options);
                         break;
                         case D3D12_STATE_SUBOBJECT_TYPE_DXIL_SUBOBJECT_TO_EXPORTS_ASSOCIATION:
-                        FieldToJson(jdata["dxil_subobject_to_exports_association"], meta_struct.dxil_subobject_to_exports_association, options);
+                        FieldToJson(writer.Key("dxil_subobject_to_exports_association"), meta_struct.dxil_subobject_to_exports_association, options);
                         break;
                         case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_SHADER_CONFIG:
-                        FieldToJson(jdata["raytracing_shader_config"], meta_struct.raytracing_shader_config, options);
+                        FieldToJson(writer.Key("raytracing_shader_config"), meta_struct.raytracing_shader_config, options);
                         break;
                         case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_PIPELINE_CONFIG:
-                        FieldToJson(jdata["raytracing_pipeline_config"], meta_struct.raytracing_pipeline_config, options);
+                        FieldToJson(writer.Key("raytracing_pipeline_config"), meta_struct.raytracing_pipeline_config, options);
                         break;
                         case D3D12_STATE_SUBOBJECT_TYPE_HIT_GROUP:
-                        FieldToJson(jdata["hit_group_desc"], meta_struct.hit_group_desc, options);
+                        FieldToJson(writer.Key("hit_group_desc"), meta_struct.hit_group_desc, options);
                         break;
                         case D3D12_STATE_SUBOBJECT_TYPE_RAYTRACING_PIPELINE_CONFIG1:
-                        FieldToJson(jdata["raytracing_pipeline_config1"], meta_struct.raytracing_pipeline_config1, options);
+                        FieldToJson(writer.Key("raytracing_pipeline_config1"), meta_struct.raytracing_pipeline_config1, options);
                         break;
                         default:
                         {
-                            FieldToJson(jdata[format::kNameWarning], "Unknown D3D12_STATE_SUBOBJECT_TYPE in D3D12_STATE_SUBOBJECT.", options);
+                            FieldToJson(writer.Key(format::kNameWarning), "Unknown D3D12_STATE_SUBOBJECT_TYPE in D3D12_STATE_SUBOBJECT.", options);
                             break;
                         }
                     }
+                    writer.EndObject();
+                }
+                else
+                {
+                    writer.Null();
                 }
             }
 
-            void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
+            void FieldToJson(JsonStreamWriter& writer, const Decoded_D3D12_CPU_DESCRIPTOR_HANDLE* data, const JsonOptions& options)
             {
                 using namespace util;
                 if (data && data->decoded_value)
                 {
                     const D3D12_CPU_DESCRIPTOR_HANDLE& decoded_value = *data->decoded_value;
                     const Decoded_D3D12_CPU_DESCRIPTOR_HANDLE& meta_struct = *data;
-                    // FieldToJson(jdata[format::kNameInfo], "heap_id and index were copied out of ptr by a custom encoder at capture time, and ptr was never stored in the capture file.", options);
-                    FieldToJson(jdata["heap_id"], meta_struct.heap_id, options);
-                    FieldToJson(jdata["index"], meta_struct.index, options);
+                    writer.BeginObject();
+                    // FieldToJson(writer.Key(format::kNameInfo), "heap_id and index were copied out of ptr by a custom encoder at capture time, and ptr was never stored in the capture file.", options);
+                    FieldToJson(writer.Key("heap_id"), meta_struct.heap_id, options);
+                    FieldToJson(writer.Key("index"), meta_struct.index, options);
+                    writer.EndObject();
+                }
+                else
+                {
+                    writer.Null();
                 }
             }
 
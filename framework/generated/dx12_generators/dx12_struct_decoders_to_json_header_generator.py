@@ -56,7 +56,7 @@ class Dx12StructDecodersToJsonHeaderGenerator(Dx12BaseGenerator):
             #include "decode/custom_dx12_struct_decoders_forward.h"
             #include "generated_dx12_enum_to_json.h"
             #include "util/defines.h"
-            #include "nlohmann/json.hpp"
+            #include "util/json_util.h"
 
             GFXRECON_BEGIN_NAMESPACE(gfxrecon)
             GFXRECON_BEGIN_NAMESPACE(util)
@@ -74,8 +74,8 @@ class Dx12StructDecodersToJsonHeaderGenerator(Dx12BaseGenerator):
         '''))
         for k, v in struct_dict.items():
             if not self.is_struct_black_listed(k):
-                body = 'void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_{0}* pObj, const util::JsonOptions& options);'.format(k)
-                ref_wrappers += 'inline void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_{0}& obj, const util::JsonOptions& options){{ FieldToJson(jdata, &obj, options); }}\n'.format(k)
+                body = 'void FieldToJson(util::JsonStreamWriter& writer, const Decoded_{0}* pObj, const util::JsonOptions& options);'.format(k)
+                ref_wrappers += 'inline void FieldToJson(util::JsonStreamWriter& writer, const Decoded_{0}& obj, const util::JsonOptions& options){{ FieldToJson(writer, &obj, options); }}\n'.format(k)
                 write(body, file=self.outFile)
         write(ref_wrappers, file=self.outFile)
 
@@ -86,8 +86,8 @@ class Dx12StructDecodersToJsonHeaderGenerator(Dx12BaseGenerator):
         // Custom, manually written implementations whose prototypes haven't been generated above:
 
         /// <winnt.h> Named union type with two structs and a uint64_t inside.
-        void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LARGE_INTEGER* pObj, const util::JsonOptions& options);
-        inline void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_LARGE_INTEGER& obj, const util::JsonOptions& options){ FieldToJson(jdata, &obj, options); }
+        void FieldToJson(util::JsonStreamWriter& writer, const Decoded_LARGE_INTEGER* pObj, const util::JsonOptions& options);
+        inline void FieldToJson(util::JsonStreamWriter& writer, const Decoded_LARGE_INTEGER& obj, const util::JsonOptions& options){ FieldToJson(writer, &obj, options); }
         '''
         custom_to_fields = format_cpp_code(custom_to_fields)
         write(custom_to_fields, file=self.outFile)
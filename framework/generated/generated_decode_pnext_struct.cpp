@@ -61,19 +61,21 @@ size_t DecodePNextStruct(const uint8_t* parameter_buffer, size_t buffer_size,  P
 
             if ((attrib & format::PointerAttributes::kHasAddress) == format::PointerAttributes::kHasAddress)
             {
-                stype_offset += sizeof(format::AddressEncodeType);
+                uint64_t address = 0;
+                stype_offset += ValueDecoder::DecodeAddress((parameter_buffer + stype_offset), (buffer_size - stype_offset), &address);
             }
         }
 
-        if ((stype_offset != 0) && ((buffer_size - stype_offset) >= sizeof(VkStructureType)))
-        {
-            const VkStructureType* sType = reinterpret_cast<const VkStructureType*>(parameter_buffer + stype_offset);
+        // The sType and address sizes depend on the parameter encoding of the capture file.
+        VkStructureType sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;
 
-            switch (*sType)
+        if ((stype_offset != 0) && (ValueDecoder::DecodeEnumValue((parameter_buffer + stype_offset), (buffer_size - stype_offset), &sType) != 0))
+        {
+            switch (sType)
             {
             default:
                 // TODO: This may need to be a fatal error
-                GFXRECON_LOG_ERROR("Failed to decode pNext value with unrecognized VkStructureType = %s", (util::ToString(*sType).c_str()));
+                GFXRECON_LOG_ERROR("Failed to decode pNext value with unrecognized VkStructureType = %s", (util::ToString(sType).c_str()));
                 break;
             case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO:
                 (*pNext) = DecodeAllocator::Allocate<PNextTypedNode<Decoded_VkShaderModuleCreateInfo>>();
@@ -41,1925 +41,1925 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_RESIDENCY value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_RESIDENCY value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_RESIDENCY* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_RESIDENCY* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_SWAP_EFFECT value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_SWAP_EFFECT value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_SWAP_EFFECT* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_SWAP_EFFECT* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_SWAP_CHAIN_FLAG value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_SWAP_CHAIN_FLAG value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_SWAP_CHAIN_FLAG* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_SWAP_CHAIN_FLAG* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_ADAPTER_FLAG value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_ADAPTER_FLAG value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_ADAPTER_FLAG* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_ADAPTER_FLAG* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OUTDUPL_POINTER_SHAPE_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OUTDUPL_POINTER_SHAPE_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OUTDUPL_POINTER_SHAPE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OUTDUPL_POINTER_SHAPE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_ALPHA_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_ALPHA_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_ALPHA_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_ALPHA_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OFFER_RESOURCE_PRIORITY value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OFFER_RESOURCE_PRIORITY value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OFFER_RESOURCE_PRIORITY* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OFFER_RESOURCE_PRIORITY* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_SCALING value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_SCALING value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_SCALING* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_SCALING* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_GRAPHICS_PREEMPTION_GRANULARITY value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_GRAPHICS_PREEMPTION_GRANULARITY value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_GRAPHICS_PREEMPTION_GRANULARITY* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_GRAPHICS_PREEMPTION_GRANULARITY* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_COMPUTE_PREEMPTION_GRANULARITY value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_COMPUTE_PREEMPTION_GRANULARITY value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_COMPUTE_PREEMPTION_GRANULARITY* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_COMPUTE_PREEMPTION_GRANULARITY* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_FRAME_PRESENTATION_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_FRAME_PRESENTATION_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_FRAME_PRESENTATION_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_FRAME_PRESENTATION_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OVERLAY_SUPPORT_FLAG value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OVERLAY_SUPPORT_FLAG value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OVERLAY_SUPPORT_FLAG* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OVERLAY_SUPPORT_FLAG* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_SWAP_CHAIN_COLOR_SPACE_SUPPORT_FLAG value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_SWAP_CHAIN_COLOR_SPACE_SUPPORT_FLAG value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_SWAP_CHAIN_COLOR_SPACE_SUPPORT_FLAG* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_SWAP_CHAIN_COLOR_SPACE_SUPPORT_FLAG* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OVERLAY_COLOR_SPACE_SUPPORT_FLAG value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OVERLAY_COLOR_SPACE_SUPPORT_FLAG value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OVERLAY_COLOR_SPACE_SUPPORT_FLAG* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OVERLAY_COLOR_SPACE_SUPPORT_FLAG* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_MEMORY_SEGMENT_GROUP value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_MEMORY_SEGMENT_GROUP value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_MEMORY_SEGMENT_GROUP* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_MEMORY_SEGMENT_GROUP* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OUTDUPL_FLAG value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OUTDUPL_FLAG value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OUTDUPL_FLAG* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OUTDUPL_FLAG* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_HDR_METADATA_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_HDR_METADATA_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_HDR_METADATA_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_HDR_METADATA_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OFFER_RESOURCE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OFFER_RESOURCE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_OFFER_RESOURCE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_OFFER_RESOURCE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_RECLAIM_RESOURCE_RESULTS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_RECLAIM_RESOURCE_RESULTS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_RECLAIM_RESOURCE_RESULTS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_RECLAIM_RESOURCE_RESULTS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_FEATURE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_FEATURE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_FEATURE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_FEATURE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_ADAPTER_FLAG3 value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_ADAPTER_FLAG3 value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_ADAPTER_FLAG3* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_ADAPTER_FLAG3* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_HARDWARE_COMPOSITION_SUPPORT_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_HARDWARE_COMPOSITION_SUPPORT_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_HARDWARE_COMPOSITION_SUPPORT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_HARDWARE_COMPOSITION_SUPPORT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_GPU_PREFERENCE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_GPU_PREFERENCE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_GPU_PREFERENCE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_GPU_PREFERENCE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_COLOR_SPACE_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_COLOR_SPACE_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_COLOR_SPACE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_COLOR_SPACE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_FORMAT value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_FORMAT value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_FORMAT* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_FORMAT* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_MODE_SCANLINE_ORDER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_MODE_SCANLINE_ORDER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_MODE_SCANLINE_ORDER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_MODE_SCANLINE_ORDER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_MODE_SCALING value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_MODE_SCALING value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_MODE_SCALING* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_MODE_SCALING* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_MODE_ROTATION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_MODE_ROTATION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const DXGI_MODE_ROTATION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const DXGI_MODE_ROTATION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_LIST_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_LIST_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_LIST_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_LIST_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_QUEUE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_QUEUE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_QUEUE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_QUEUE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_QUEUE_PRIORITY value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_QUEUE_PRIORITY value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_QUEUE_PRIORITY* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_QUEUE_PRIORITY* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PRIMITIVE_TOPOLOGY_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PRIMITIVE_TOPOLOGY_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PRIMITIVE_TOPOLOGY_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PRIMITIVE_TOPOLOGY_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_INPUT_CLASSIFICATION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_INPUT_CLASSIFICATION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_INPUT_CLASSIFICATION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_INPUT_CLASSIFICATION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FILL_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FILL_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FILL_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FILL_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CULL_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CULL_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CULL_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CULL_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMPARISON_FUNC value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMPARISON_FUNC value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMPARISON_FUNC* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMPARISON_FUNC* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEPTH_WRITE_MASK value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEPTH_WRITE_MASK value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEPTH_WRITE_MASK* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEPTH_WRITE_MASK* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_STENCIL_OP value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_STENCIL_OP value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_STENCIL_OP* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_STENCIL_OP* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BLEND value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BLEND value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BLEND* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BLEND* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BLEND_OP value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BLEND_OP value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BLEND_OP* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BLEND_OP* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COLOR_WRITE_ENABLE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COLOR_WRITE_ENABLE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COLOR_WRITE_ENABLE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COLOR_WRITE_ENABLE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_LOGIC_OP value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_LOGIC_OP value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_LOGIC_OP* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_LOGIC_OP* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CONSERVATIVE_RASTERIZATION_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CONSERVATIVE_RASTERIZATION_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CONSERVATIVE_RASTERIZATION_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CONSERVATIVE_RASTERIZATION_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_LINE_RASTERIZATION_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_LINE_RASTERIZATION_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_LINE_RASTERIZATION_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_LINE_RASTERIZATION_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_INDEX_BUFFER_STRIP_CUT_VALUE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_INDEX_BUFFER_STRIP_CUT_VALUE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_INDEX_BUFFER_STRIP_CUT_VALUE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_INDEX_BUFFER_STRIP_CUT_VALUE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PIPELINE_STATE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PIPELINE_STATE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PIPELINE_STATE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PIPELINE_STATE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PIPELINE_STATE_SUBOBJECT_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PIPELINE_STATE_SUBOBJECT_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PIPELINE_STATE_SUBOBJECT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PIPELINE_STATE_SUBOBJECT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FEATURE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FEATURE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FEATURE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FEATURE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_MIN_PRECISION_SUPPORT value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_MIN_PRECISION_SUPPORT value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_MIN_PRECISION_SUPPORT* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_MIN_PRECISION_SUPPORT* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TILED_RESOURCES_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TILED_RESOURCES_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TILED_RESOURCES_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TILED_RESOURCES_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_BINDING_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_BINDING_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_BINDING_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_BINDING_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CONSERVATIVE_RASTERIZATION_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CONSERVATIVE_RASTERIZATION_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CONSERVATIVE_RASTERIZATION_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CONSERVATIVE_RASTERIZATION_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FORMAT_SUPPORT1 value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FORMAT_SUPPORT1 value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FORMAT_SUPPORT1* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FORMAT_SUPPORT1* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FORMAT_SUPPORT2 value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FORMAT_SUPPORT2 value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FORMAT_SUPPORT2* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FORMAT_SUPPORT2* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MULTISAMPLE_QUALITY_LEVEL_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MULTISAMPLE_QUALITY_LEVEL_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MULTISAMPLE_QUALITY_LEVEL_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MULTISAMPLE_QUALITY_LEVEL_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CROSS_NODE_SHARING_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CROSS_NODE_SHARING_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CROSS_NODE_SHARING_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CROSS_NODE_SHARING_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_HEAP_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_HEAP_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_HEAP_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_HEAP_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PROGRAMMABLE_SAMPLE_POSITIONS_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PROGRAMMABLE_SAMPLE_POSITIONS_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PROGRAMMABLE_SAMPLE_POSITIONS_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PROGRAMMABLE_SAMPLE_POSITIONS_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_VIEW_INSTANCING_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_VIEW_INSTANCING_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_VIEW_INSTANCING_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_VIEW_INSTANCING_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_ROOT_SIGNATURE_VERSION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_ROOT_SIGNATURE_VERSION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_ROOT_SIGNATURE_VERSION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_ROOT_SIGNATURE_VERSION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_MODEL value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_MODEL value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_MODEL* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_MODEL* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_CACHE_SUPPORT_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_CACHE_SUPPORT_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_CACHE_SUPPORT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_CACHE_SUPPORT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_LIST_SUPPORT_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_LIST_SUPPORT_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_LIST_SUPPORT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_LIST_SUPPORT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHARED_RESOURCE_COMPATIBILITY_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHARED_RESOURCE_COMPATIBILITY_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHARED_RESOURCE_COMPATIBILITY_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHARED_RESOURCE_COMPATIBILITY_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_HEAP_SERIALIZATION_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_HEAP_SERIALIZATION_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_HEAP_SERIALIZATION_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_HEAP_SERIALIZATION_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RENDER_PASS_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RENDER_PASS_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_VARIABLE_SHADING_RATE_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_VARIABLE_SHADING_RATE_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_VARIABLE_SHADING_RATE_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_VARIABLE_SHADING_RATE_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MESH_SHADER_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MESH_SHADER_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MESH_SHADER_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MESH_SHADER_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SAMPLER_FEEDBACK_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SAMPLER_FEEDBACK_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SAMPLER_FEEDBACK_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SAMPLER_FEEDBACK_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_WAVE_MMA_TIER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_WAVE_MMA_TIER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_WAVE_MMA_TIER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_WAVE_MMA_TIER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TRI_STATE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TRI_STATE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TRI_STATE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TRI_STATE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_HEAP_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_HEAP_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_HEAP_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_HEAP_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CPU_PAGE_PROPERTY value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CPU_PAGE_PROPERTY value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CPU_PAGE_PROPERTY* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CPU_PAGE_PROPERTY* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MEMORY_POOL value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MEMORY_POOL value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MEMORY_POOL* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MEMORY_POOL* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_HEAP_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_HEAP_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_HEAP_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_HEAP_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_DIMENSION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_DIMENSION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TEXTURE_LAYOUT value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TEXTURE_LAYOUT value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TEXTURE_LAYOUT* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TEXTURE_LAYOUT* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TILE_RANGE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TILE_RANGE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TILE_RANGE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TILE_RANGE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TILE_MAPPING_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TILE_MAPPING_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TILE_MAPPING_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TILE_MAPPING_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TILE_COPY_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TILE_COPY_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TILE_COPY_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TILE_COPY_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_STATES value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_STATES value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_STATES* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_STATES* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_BARRIER_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_BARRIER_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_BARRIER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_BARRIER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_BARRIER_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_BARRIER_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOURCE_BARRIER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOURCE_BARRIER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TEXTURE_COPY_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TEXTURE_COPY_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TEXTURE_COPY_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TEXTURE_COPY_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOLVE_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOLVE_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESOLVE_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESOLVE_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_VIEW_INSTANCING_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_VIEW_INSTANCING_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_VIEW_INSTANCING_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_VIEW_INSTANCING_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_COMPONENT_MAPPING value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_COMPONENT_MAPPING value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_COMPONENT_MAPPING* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_COMPONENT_MAPPING* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BUFFER_SRV_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BUFFER_SRV_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BUFFER_SRV_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BUFFER_SRV_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SRV_DIMENSION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SRV_DIMENSION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SRV_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SRV_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FILTER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FILTER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FILTER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FILTER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FILTER_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FILTER_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FILTER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FILTER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FILTER_REDUCTION_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FILTER_REDUCTION_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FILTER_REDUCTION_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FILTER_REDUCTION_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TEXTURE_ADDRESS_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TEXTURE_ADDRESS_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TEXTURE_ADDRESS_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TEXTURE_ADDRESS_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SAMPLER_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SAMPLER_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SAMPLER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SAMPLER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BUFFER_UAV_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BUFFER_UAV_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BUFFER_UAV_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BUFFER_UAV_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_UAV_DIMENSION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_UAV_DIMENSION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_UAV_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_UAV_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RTV_DIMENSION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RTV_DIMENSION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RTV_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RTV_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DSV_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DSV_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DSV_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DSV_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DSV_DIMENSION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DSV_DIMENSION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DSV_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DSV_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CLEAR_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CLEAR_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_CLEAR_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_CLEAR_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FENCE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FENCE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_FENCE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_FENCE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DESCRIPTOR_HEAP_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DESCRIPTOR_HEAP_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DESCRIPTOR_HEAP_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DESCRIPTOR_HEAP_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DESCRIPTOR_HEAP_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DESCRIPTOR_HEAP_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DESCRIPTOR_HEAP_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DESCRIPTOR_HEAP_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DESCRIPTOR_RANGE_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DESCRIPTOR_RANGE_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DESCRIPTOR_RANGE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DESCRIPTOR_RANGE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_VISIBILITY value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_VISIBILITY value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_VISIBILITY* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_VISIBILITY* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_ROOT_PARAMETER_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_ROOT_PARAMETER_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_ROOT_PARAMETER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_ROOT_PARAMETER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_ROOT_SIGNATURE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_ROOT_SIGNATURE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_ROOT_SIGNATURE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_ROOT_SIGNATURE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_STATIC_BORDER_COLOR value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_STATIC_BORDER_COLOR value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_STATIC_BORDER_COLOR* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_STATIC_BORDER_COLOR* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DESCRIPTOR_RANGE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DESCRIPTOR_RANGE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DESCRIPTOR_RANGE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DESCRIPTOR_RANGE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_ROOT_DESCRIPTOR_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_ROOT_DESCRIPTOR_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_ROOT_DESCRIPTOR_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_ROOT_DESCRIPTOR_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_QUERY_HEAP_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_QUERY_HEAP_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_QUERY_HEAP_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_QUERY_HEAP_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_QUERY_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_QUERY_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_QUERY_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_QUERY_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PREDICATION_OP value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PREDICATION_OP value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PREDICATION_OP* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PREDICATION_OP* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_INDIRECT_ARGUMENT_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_INDIRECT_ARGUMENT_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_INDIRECT_ARGUMENT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_INDIRECT_ARGUMENT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_WRITEBUFFERIMMEDIATE_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_WRITEBUFFERIMMEDIATE_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_WRITEBUFFERIMMEDIATE_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_WRITEBUFFERIMMEDIATE_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MULTIPLE_FENCE_WAIT_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MULTIPLE_FENCE_WAIT_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MULTIPLE_FENCE_WAIT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MULTIPLE_FENCE_WAIT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESIDENCY_PRIORITY value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESIDENCY_PRIORITY value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESIDENCY_PRIORITY* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESIDENCY_PRIORITY* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESIDENCY_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESIDENCY_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RESIDENCY_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RESIDENCY_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_LIST_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_LIST_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_LIST_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_LIST_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_POOL_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_POOL_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_POOL_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_POOL_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_RECORDER_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_RECORDER_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_COMMAND_RECORDER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_COMMAND_RECORDER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PROTECTED_SESSION_STATUS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PROTECTED_SESSION_STATUS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PROTECTED_SESSION_STATUS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PROTECTED_SESSION_STATUS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PROTECTED_RESOURCE_SESSION_SUPPORT_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PROTECTED_RESOURCE_SESSION_SUPPORT_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PROTECTED_RESOURCE_SESSION_SUPPORT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PROTECTED_RESOURCE_SESSION_SUPPORT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PROTECTED_RESOURCE_SESSION_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PROTECTED_RESOURCE_SESSION_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_PROTECTED_RESOURCE_SESSION_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_PROTECTED_RESOURCE_SESSION_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_LIFETIME_STATE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_LIFETIME_STATE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_LIFETIME_STATE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_LIFETIME_STATE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_META_COMMAND_PARAMETER_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_META_COMMAND_PARAMETER_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_META_COMMAND_PARAMETER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_META_COMMAND_PARAMETER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_META_COMMAND_PARAMETER_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_META_COMMAND_PARAMETER_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_META_COMMAND_PARAMETER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_META_COMMAND_PARAMETER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_META_COMMAND_PARAMETER_STAGE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_META_COMMAND_PARAMETER_STAGE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_META_COMMAND_PARAMETER_STAGE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_META_COMMAND_PARAMETER_STAGE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_GRAPHICS_STATES value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_GRAPHICS_STATES value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_GRAPHICS_STATES* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_GRAPHICS_STATES* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_STATE_SUBOBJECT_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_STATE_SUBOBJECT_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_STATE_SUBOBJECT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_STATE_SUBOBJECT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_STATE_OBJECT_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_STATE_OBJECT_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_STATE_OBJECT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_STATE_OBJECT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_EXPORT_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_EXPORT_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_EXPORT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_EXPORT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_HIT_GROUP_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_HIT_GROUP_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_HIT_GROUP_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_HIT_GROUP_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_PIPELINE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_PIPELINE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_PIPELINE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_PIPELINE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_STATE_OBJECT_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_STATE_OBJECT_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_STATE_OBJECT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_STATE_OBJECT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_GEOMETRY_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_GEOMETRY_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_GEOMETRY_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_GEOMETRY_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_GEOMETRY_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_GEOMETRY_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_GEOMETRY_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_GEOMETRY_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_INSTANCE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_INSTANCE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_INSTANCE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_INSTANCE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_COPY_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_ELEMENTS_LAYOUT value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_ELEMENTS_LAYOUT value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_ELEMENTS_LAYOUT* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_ELEMENTS_LAYOUT* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAYTRACING_ACCELERATION_STRUCTURE_POSTBUILD_INFO_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SERIALIZED_DATA_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SERIALIZED_DATA_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SERIALIZED_DATA_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SERIALIZED_DATA_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAY_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAY_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RAY_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RAY_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_HIT_KIND value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_HIT_KIND value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_HIT_KIND* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_HIT_KIND* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_AUTO_BREADCRUMB_OP value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_AUTO_BREADCRUMB_OP value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_AUTO_BREADCRUMB_OP* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_AUTO_BREADCRUMB_OP* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_VERSION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_VERSION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_VERSION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_VERSION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_ENABLEMENT value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_ENABLEMENT value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_ENABLEMENT* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_ENABLEMENT* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_ALLOCATION_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_ALLOCATION_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_ALLOCATION_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_ALLOCATION_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_PAGE_FAULT_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_PAGE_FAULT_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_PAGE_FAULT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_PAGE_FAULT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_DEVICE_STATE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_DEVICE_STATE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DRED_DEVICE_STATE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DRED_DEVICE_STATE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BACKGROUND_PROCESSING_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BACKGROUND_PROCESSING_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BACKGROUND_PROCESSING_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BACKGROUND_PROCESSING_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MEASUREMENTS_ACTION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MEASUREMENTS_ACTION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MEASUREMENTS_ACTION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MEASUREMENTS_ACTION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RENDER_PASS_BEGINNING_ACCESS_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_ENDING_ACCESS_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RENDER_PASS_ENDING_ACCESS_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_ENDING_ACCESS_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RENDER_PASS_ENDING_ACCESS_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RENDER_PASS_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RENDER_PASS_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RENDER_PASS_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_CACHE_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_CACHE_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_CACHE_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_CACHE_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_CACHE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_CACHE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_CACHE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_CACHE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BARRIER_LAYOUT value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BARRIER_LAYOUT value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BARRIER_LAYOUT* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BARRIER_LAYOUT* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BARRIER_SYNC value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BARRIER_SYNC value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BARRIER_SYNC* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BARRIER_SYNC* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BARRIER_ACCESS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BARRIER_ACCESS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BARRIER_ACCESS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BARRIER_ACCESS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BARRIER_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BARRIER_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_BARRIER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_BARRIER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TEXTURE_BARRIER_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TEXTURE_BARRIER_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_TEXTURE_BARRIER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_TEXTURE_BARRIER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_CACHE_KIND_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_CACHE_KIND_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_CACHE_KIND_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_CACHE_KIND_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_CACHE_CONTROL_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_CACHE_CONTROL_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADER_CACHE_CONTROL_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADER_CACHE_CONTROL_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEVICE_FACTORY_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEVICE_FACTORY_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEVICE_FACTORY_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEVICE_FACTORY_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEVICE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEVICE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEVICE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEVICE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_AXIS_SHADING_RATE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_AXIS_SHADING_RATE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_AXIS_SHADING_RATE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_AXIS_SHADING_RATE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADING_RATE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADING_RATE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADING_RATE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADING_RATE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADING_RATE_COMBINER value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADING_RATE_COMBINER value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_SHADING_RATE_COMBINER* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_SHADING_RATE_COMBINER* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_DRIVER_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_DRIVER_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_DRIVER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_DRIVER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_FEATURE_LEVEL value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_FEATURE_LEVEL value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_FEATURE_LEVEL* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_FEATURE_LEVEL* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_PRIMITIVE_TOPOLOGY value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_PRIMITIVE_TOPOLOGY value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_PRIMITIVE_TOPOLOGY* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_PRIMITIVE_TOPOLOGY* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_PRIMITIVE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_PRIMITIVE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_PRIMITIVE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_PRIMITIVE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SRV_DIMENSION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SRV_DIMENSION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SRV_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SRV_DIMENSION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_INCLUDE_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_INCLUDE_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_INCLUDE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_INCLUDE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_VARIABLE_CLASS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_VARIABLE_CLASS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_VARIABLE_CLASS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_VARIABLE_CLASS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_VARIABLE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_VARIABLE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_VARIABLE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_VARIABLE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_VARIABLE_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_VARIABLE_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_VARIABLE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_VARIABLE_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_INPUT_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_INPUT_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_INPUT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_INPUT_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_INPUT_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_INPUT_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_INPUT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_INPUT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_CBUFFER_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_CBUFFER_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_SHADER_CBUFFER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_SHADER_CBUFFER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_CBUFFER_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_CBUFFER_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_CBUFFER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_CBUFFER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_NAME value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_NAME value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_NAME* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_NAME* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_RESOURCE_RETURN_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_RESOURCE_RETURN_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_RESOURCE_RETURN_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_RESOURCE_RETURN_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_REGISTER_COMPONENT_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_REGISTER_COMPONENT_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_REGISTER_COMPONENT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_REGISTER_COMPONENT_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_TESSELLATOR_DOMAIN value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_TESSELLATOR_DOMAIN value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_TESSELLATOR_DOMAIN* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_TESSELLATOR_DOMAIN* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_TESSELLATOR_PARTITIONING value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_TESSELLATOR_PARTITIONING value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_TESSELLATOR_PARTITIONING* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_TESSELLATOR_PARTITIONING* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_TESSELLATOR_OUTPUT_PRIMITIVE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_TESSELLATOR_OUTPUT_PRIMITIVE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_TESSELLATOR_OUTPUT_PRIMITIVE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_TESSELLATOR_OUTPUT_PRIMITIVE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_MIN_PRECISION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_MIN_PRECISION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_MIN_PRECISION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_MIN_PRECISION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_INTERPOLATION_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_INTERPOLATION_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_INTERPOLATION_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_INTERPOLATION_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_PARAMETER_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_PARAMETER_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_PARAMETER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_PARAMETER_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_FORMAT_LAYOUT value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_FORMAT_LAYOUT value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_FORMAT_LAYOUT* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_FORMAT_LAYOUT* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_FORMAT_TYPE_LEVEL value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_FORMAT_TYPE_LEVEL value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_FORMAT_TYPE_LEVEL* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_FORMAT_TYPE_LEVEL* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_FORMAT_COMPONENT_NAME value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_FORMAT_COMPONENT_NAME value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_FORMAT_COMPONENT_NAME* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_FORMAT_COMPONENT_NAME* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_FORMAT_COMPONENT_INTERPRETATION value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_FORMAT_COMPONENT_INTERPRETATION value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D_FORMAT_COMPONENT_INTERPRETATION* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D_FORMAT_COMPONENT_INTERPRETATION* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_GPU_BASED_VALIDATION_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_GPU_BASED_VALIDATION_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_GPU_BASED_VALIDATION_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_GPU_BASED_VALIDATION_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RLDO_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RLDO_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_RLDO_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_RLDO_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEBUG_DEVICE_PARAMETER_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEBUG_DEVICE_PARAMETER_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEBUG_DEVICE_PARAMETER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEBUG_DEVICE_PARAMETER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEBUG_FEATURE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEBUG_FEATURE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEBUG_FEATURE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEBUG_FEATURE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_GPU_BASED_VALIDATION_SHADER_PATCH_MODE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_GPU_BASED_VALIDATION_SHADER_PATCH_MODE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_GPU_BASED_VALIDATION_SHADER_PATCH_MODE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_GPU_BASED_VALIDATION_SHADER_PATCH_MODE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_GPU_BASED_VALIDATION_PIPELINE_STATE_CREATE_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_GPU_BASED_VALIDATION_PIPELINE_STATE_CREATE_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_GPU_BASED_VALIDATION_PIPELINE_STATE_CREATE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_GPU_BASED_VALIDATION_PIPELINE_STATE_CREATE_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEBUG_COMMAND_LIST_PARAMETER_TYPE value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEBUG_COMMAND_LIST_PARAMETER_TYPE value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_DEBUG_COMMAND_LIST_PARAMETER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_DEBUG_COMMAND_LIST_PARAMETER_TYPE* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MESSAGE_CATEGORY value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MESSAGE_CATEGORY value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MESSAGE_CATEGORY* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MESSAGE_CATEGORY* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MESSAGE_SEVERITY value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MESSAGE_SEVERITY value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MESSAGE_SEVERITY* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MESSAGE_SEVERITY* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MESSAGE_ID value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MESSAGE_ID value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MESSAGE_ID* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MESSAGE_ID* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MESSAGE_CALLBACK_FLAGS value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MESSAGE_CALLBACK_FLAGS value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
-inline void FieldToJson(nlohmann::ordered_json& jdata, const D3D12_MESSAGE_CALLBACK_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const D3D12_MESSAGE_CALLBACK_FLAGS* pEnum, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, *pEnum, options);
+    FieldToJson(writer, *pEnum, options);
 }
 
 
-inline void FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -1970,9 +1970,9 @@ inline void FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(nlohmann::ordered_js
     {
         representation = ToString_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_DXGI_OFFER_RESOURCE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_DXGI_OFFER_RESOURCE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -1983,9 +1983,9 @@ inline void FieldToJson_DXGI_OFFER_RESOURCE_FLAGS(nlohmann::ordered_json& jdata,
     {
         representation = ToString_DXGI_OFFER_RESOURCE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_DXGI_HARDWARE_COMPOSITION_SUPPORT_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_DXGI_HARDWARE_COMPOSITION_SUPPORT_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -1996,9 +1996,9 @@ inline void FieldToJson_DXGI_HARDWARE_COMPOSITION_SUPPORT_FLAGS(nlohmann::ordere
     {
         representation = ToString_DXGI_HARDWARE_COMPOSITION_SUPPORT_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_COMMAND_QUEUE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_COMMAND_QUEUE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2009,9 +2009,9 @@ inline void FieldToJson_D3D12_COMMAND_QUEUE_FLAGS(nlohmann::ordered_json& jdata,
     {
         representation = ToString_D3D12_COMMAND_QUEUE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_PIPELINE_STATE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_PIPELINE_STATE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2022,9 +2022,9 @@ inline void FieldToJson_D3D12_PIPELINE_STATE_FLAGS(nlohmann::ordered_json& jdata
     {
         representation = ToString_D3D12_PIPELINE_STATE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_SHADER_MIN_PRECISION_SUPPORT(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_SHADER_MIN_PRECISION_SUPPORT(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2035,9 +2035,9 @@ inline void FieldToJson_D3D12_SHADER_MIN_PRECISION_SUPPORT(nlohmann::ordered_jso
     {
         representation = ToString_D3D12_SHADER_MIN_PRECISION_SUPPORT(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_FORMAT_SUPPORT1(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_FORMAT_SUPPORT1(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2048,9 +2048,9 @@ inline void FieldToJson_D3D12_FORMAT_SUPPORT1(nlohmann::ordered_json& jdata, con
     {
         representation = ToString_D3D12_FORMAT_SUPPORT1(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_FORMAT_SUPPORT2(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_FORMAT_SUPPORT2(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2061,9 +2061,9 @@ inline void FieldToJson_D3D12_FORMAT_SUPPORT2(nlohmann::ordered_json& jdata, con
     {
         representation = ToString_D3D12_FORMAT_SUPPORT2(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_MULTISAMPLE_QUALITY_LEVEL_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_MULTISAMPLE_QUALITY_LEVEL_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2074,9 +2074,9 @@ inline void FieldToJson_D3D12_MULTISAMPLE_QUALITY_LEVEL_FLAGS(nlohmann::ordered_
     {
         representation = ToString_D3D12_MULTISAMPLE_QUALITY_LEVEL_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_SHADER_CACHE_SUPPORT_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_SHADER_CACHE_SUPPORT_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2087,9 +2087,9 @@ inline void FieldToJson_D3D12_SHADER_CACHE_SUPPORT_FLAGS(nlohmann::ordered_json&
     {
         representation = ToString_D3D12_SHADER_CACHE_SUPPORT_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_COMMAND_LIST_SUPPORT_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_COMMAND_LIST_SUPPORT_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2100,9 +2100,9 @@ inline void FieldToJson_D3D12_COMMAND_LIST_SUPPORT_FLAGS(nlohmann::ordered_json&
     {
         representation = ToString_D3D12_COMMAND_LIST_SUPPORT_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_HEAP_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_HEAP_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2113,9 +2113,9 @@ inline void FieldToJson_D3D12_HEAP_FLAGS(nlohmann::ordered_json& jdata, const ui
     {
         representation = ToString_D3D12_HEAP_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_RESOURCE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_RESOURCE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2126,9 +2126,9 @@ inline void FieldToJson_D3D12_RESOURCE_FLAGS(nlohmann::ordered_json& jdata, cons
     {
         representation = ToString_D3D12_RESOURCE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_TILE_RANGE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_TILE_RANGE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2139,9 +2139,9 @@ inline void FieldToJson_D3D12_TILE_RANGE_FLAGS(nlohmann::ordered_json& jdata, co
     {
         representation = ToString_D3D12_TILE_RANGE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_TILE_MAPPING_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_TILE_MAPPING_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2152,9 +2152,9 @@ inline void FieldToJson_D3D12_TILE_MAPPING_FLAGS(nlohmann::ordered_json& jdata,
     {
         representation = ToString_D3D12_TILE_MAPPING_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_TILE_COPY_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_TILE_COPY_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2165,9 +2165,9 @@ inline void FieldToJson_D3D12_TILE_COPY_FLAGS(nlohmann::ordered_json& jdata, con
     {
         representation = ToString_D3D12_TILE_COPY_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_RESOURCE_STATES(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_RESOURCE_STATES(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2178,9 +2178,9 @@ inline void FieldToJson_D3D12_RESOURCE_STATES(nlohmann::ordered_json& jdata, con
     {
         representation = ToString_D3D12_RESOURCE_STATES(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_RESOURCE_BARRIER_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_RESOURCE_BARRIER_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2191,9 +2191,9 @@ inline void FieldToJson_D3D12_RESOURCE_BARRIER_FLAGS(nlohmann::ordered_json& jda
     {
         representation = ToString_D3D12_RESOURCE_BARRIER_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_VIEW_INSTANCING_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_VIEW_INSTANCING_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2204,9 +2204,9 @@ inline void FieldToJson_D3D12_VIEW_INSTANCING_FLAGS(nlohmann::ordered_json& jdat
     {
         representation = ToString_D3D12_VIEW_INSTANCING_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_BUFFER_SRV_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_BUFFER_SRV_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2217,9 +2217,9 @@ inline void FieldToJson_D3D12_BUFFER_SRV_FLAGS(nlohmann::ordered_json& jdata, co
     {
         representation = ToString_D3D12_BUFFER_SRV_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_SAMPLER_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_SAMPLER_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2230,9 +2230,9 @@ inline void FieldToJson_D3D12_SAMPLER_FLAGS(nlohmann::ordered_json& jdata, const
     {
         representation = ToString_D3D12_SAMPLER_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_BUFFER_UAV_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_BUFFER_UAV_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2243,9 +2243,9 @@ inline void FieldToJson_D3D12_BUFFER_UAV_FLAGS(nlohmann::ordered_json& jdata, co
     {
         representation = ToString_D3D12_BUFFER_UAV_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_DSV_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_DSV_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2256,9 +2256,9 @@ inline void FieldToJson_D3D12_DSV_FLAGS(nlohmann::ordered_json& jdata, const uin
     {
         representation = ToString_D3D12_DSV_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_CLEAR_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_CLEAR_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2269,9 +2269,9 @@ inline void FieldToJson_D3D12_CLEAR_FLAGS(nlohmann::ordered_json& jdata, const u
     {
         representation = ToString_D3D12_CLEAR_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_FENCE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_FENCE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2282,9 +2282,9 @@ inline void FieldToJson_D3D12_FENCE_FLAGS(nlohmann::ordered_json& jdata, const u
     {
         representation = ToString_D3D12_FENCE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_DESCRIPTOR_HEAP_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_DESCRIPTOR_HEAP_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2295,9 +2295,9 @@ inline void FieldToJson_D3D12_DESCRIPTOR_HEAP_FLAGS(nlohmann::ordered_json& jdat
     {
         representation = ToString_D3D12_DESCRIPTOR_HEAP_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_ROOT_SIGNATURE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_ROOT_SIGNATURE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2308,9 +2308,9 @@ inline void FieldToJson_D3D12_ROOT_SIGNATURE_FLAGS(nlohmann::ordered_json& jdata
     {
         representation = ToString_D3D12_ROOT_SIGNATURE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_DESCRIPTOR_RANGE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_DESCRIPTOR_RANGE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2321,9 +2321,9 @@ inline void FieldToJson_D3D12_DESCRIPTOR_RANGE_FLAGS(nlohmann::ordered_json& jda
     {
         representation = ToString_D3D12_DESCRIPTOR_RANGE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_ROOT_DESCRIPTOR_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_ROOT_DESCRIPTOR_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2334,9 +2334,9 @@ inline void FieldToJson_D3D12_ROOT_DESCRIPTOR_FLAGS(nlohmann::ordered_json& jdat
     {
         representation = ToString_D3D12_ROOT_DESCRIPTOR_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_MULTIPLE_FENCE_WAIT_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_MULTIPLE_FENCE_WAIT_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2347,9 +2347,9 @@ inline void FieldToJson_D3D12_MULTIPLE_FENCE_WAIT_FLAGS(nlohmann::ordered_json&
     {
         representation = ToString_D3D12_MULTIPLE_FENCE_WAIT_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_RESIDENCY_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_RESIDENCY_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2360,9 +2360,9 @@ inline void FieldToJson_D3D12_RESIDENCY_FLAGS(nlohmann::ordered_json& jdata, con
     {
         representation = ToString_D3D12_RESIDENCY_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_COMMAND_LIST_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_COMMAND_LIST_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2373,9 +2373,9 @@ inline void FieldToJson_D3D12_COMMAND_LIST_FLAGS(nlohmann::ordered_json& jdata,
     {
         representation = ToString_D3D12_COMMAND_LIST_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_COMMAND_POOL_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_COMMAND_POOL_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2386,9 +2386,9 @@ inline void FieldToJson_D3D12_COMMAND_POOL_FLAGS(nlohmann::ordered_json& jdata,
     {
         representation = ToString_D3D12_COMMAND_POOL_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_COMMAND_RECORDER_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_COMMAND_RECORDER_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2399,9 +2399,9 @@ inline void FieldToJson_D3D12_COMMAND_RECORDER_FLAGS(nlohmann::ordered_json& jda
     {
         representation = ToString_D3D12_COMMAND_RECORDER_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_PROTECTED_SESSION_STATUS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_PROTECTED_SESSION_STATUS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2412,9 +2412,9 @@ inline void FieldToJson_D3D12_PROTECTED_SESSION_STATUS(nlohmann::ordered_json& j
     {
         representation = ToString_D3D12_PROTECTED_SESSION_STATUS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_PROTECTED_RESOURCE_SESSION_SUPPORT_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_PROTECTED_RESOURCE_SESSION_SUPPORT_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2425,9 +2425,9 @@ inline void FieldToJson_D3D12_PROTECTED_RESOURCE_SESSION_SUPPORT_FLAGS(nlohmann:
     {
         representation = ToString_D3D12_PROTECTED_RESOURCE_SESSION_SUPPORT_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_PROTECTED_RESOURCE_SESSION_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_PROTECTED_RESOURCE_SESSION_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2438,9 +2438,9 @@ inline void FieldToJson_D3D12_PROTECTED_RESOURCE_SESSION_FLAGS(nlohmann::ordered
     {
         representation = ToString_D3D12_PROTECTED_RESOURCE_SESSION_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_META_COMMAND_PARAMETER_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_META_COMMAND_PARAMETER_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2451,9 +2451,9 @@ inline void FieldToJson_D3D12_META_COMMAND_PARAMETER_FLAGS(nlohmann::ordered_jso
     {
         representation = ToString_D3D12_META_COMMAND_PARAMETER_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_GRAPHICS_STATES(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_GRAPHICS_STATES(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2464,9 +2464,9 @@ inline void FieldToJson_D3D12_GRAPHICS_STATES(nlohmann::ordered_json& jdata, con
     {
         representation = ToString_D3D12_GRAPHICS_STATES(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_STATE_OBJECT_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_STATE_OBJECT_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2477,9 +2477,9 @@ inline void FieldToJson_D3D12_STATE_OBJECT_FLAGS(nlohmann::ordered_json& jdata,
     {
         representation = ToString_D3D12_STATE_OBJECT_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_EXPORT_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_EXPORT_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2490,9 +2490,9 @@ inline void FieldToJson_D3D12_EXPORT_FLAGS(nlohmann::ordered_json& jdata, const
     {
         representation = ToString_D3D12_EXPORT_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_RAYTRACING_PIPELINE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_RAYTRACING_PIPELINE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2503,9 +2503,9 @@ inline void FieldToJson_D3D12_RAYTRACING_PIPELINE_FLAGS(nlohmann::ordered_json&
     {
         representation = ToString_D3D12_RAYTRACING_PIPELINE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_RAYTRACING_GEOMETRY_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_RAYTRACING_GEOMETRY_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2516,9 +2516,9 @@ inline void FieldToJson_D3D12_RAYTRACING_GEOMETRY_FLAGS(nlohmann::ordered_json&
     {
         representation = ToString_D3D12_RAYTRACING_GEOMETRY_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_RAYTRACING_INSTANCE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_RAYTRACING_INSTANCE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2529,9 +2529,9 @@ inline void FieldToJson_D3D12_RAYTRACING_INSTANCE_FLAGS(nlohmann::ordered_json&
     {
         representation = ToString_D3D12_RAYTRACING_INSTANCE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2542,9 +2542,9 @@ inline void FieldToJson_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS(nloh
     {
         representation = ToString_D3D12_RAYTRACING_ACCELERATION_STRUCTURE_BUILD_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2555,9 +2555,9 @@ inline void FieldToJson_D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS(nlohmann::ordere
     {
         representation = ToString_D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_RAY_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_RAY_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2568,9 +2568,9 @@ inline void FieldToJson_D3D12_RAY_FLAGS(nlohmann::ordered_json& jdata, const uin
     {
         representation = ToString_D3D12_RAY_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_DRED_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_DRED_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2581,9 +2581,9 @@ inline void FieldToJson_D3D12_DRED_FLAGS(nlohmann::ordered_json& jdata, const ui
     {
         representation = ToString_D3D12_DRED_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_DRED_PAGE_FAULT_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_DRED_PAGE_FAULT_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2594,9 +2594,9 @@ inline void FieldToJson_D3D12_DRED_PAGE_FAULT_FLAGS(nlohmann::ordered_json& jdat
     {
         representation = ToString_D3D12_DRED_PAGE_FAULT_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_RENDER_PASS_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_RENDER_PASS_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2607,9 +2607,9 @@ inline void FieldToJson_D3D12_RENDER_PASS_FLAGS(nlohmann::ordered_json& jdata, c
     {
         representation = ToString_D3D12_RENDER_PASS_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_SHADER_CACHE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_SHADER_CACHE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2620,9 +2620,9 @@ inline void FieldToJson_D3D12_SHADER_CACHE_FLAGS(nlohmann::ordered_json& jdata,
     {
         representation = ToString_D3D12_SHADER_CACHE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_TEXTURE_BARRIER_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_TEXTURE_BARRIER_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2633,9 +2633,9 @@ inline void FieldToJson_D3D12_TEXTURE_BARRIER_FLAGS(nlohmann::ordered_json& jdat
     {
         representation = ToString_D3D12_TEXTURE_BARRIER_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_SHADER_CACHE_KIND_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_SHADER_CACHE_KIND_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2646,9 +2646,9 @@ inline void FieldToJson_D3D12_SHADER_CACHE_KIND_FLAGS(nlohmann::ordered_json& jd
     {
         representation = ToString_D3D12_SHADER_CACHE_KIND_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_SHADER_CACHE_CONTROL_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_SHADER_CACHE_CONTROL_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2659,9 +2659,9 @@ inline void FieldToJson_D3D12_SHADER_CACHE_CONTROL_FLAGS(nlohmann::ordered_json&
     {
         representation = ToString_D3D12_SHADER_CACHE_CONTROL_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2672,9 +2672,9 @@ inline void FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(nlohmann::ordered_json& jdata
     {
         representation = ToString_D3D12_DEVICE_FACTORY_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_DEVICE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_DEVICE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2685,9 +2685,9 @@ inline void FieldToJson_D3D12_DEVICE_FLAGS(nlohmann::ordered_json& jdata, const
     {
         representation = ToString_D3D12_DEVICE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D_SHADER_VARIABLE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D_SHADER_VARIABLE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2698,9 +2698,9 @@ inline void FieldToJson_D3D_SHADER_VARIABLE_FLAGS(nlohmann::ordered_json& jdata,
     {
         representation = ToString_D3D_SHADER_VARIABLE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D_SHADER_INPUT_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D_SHADER_INPUT_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2711,9 +2711,9 @@ inline void FieldToJson_D3D_SHADER_INPUT_FLAGS(nlohmann::ordered_json& jdata, co
     {
         representation = ToString_D3D_SHADER_INPUT_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D_SHADER_CBUFFER_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D_SHADER_CBUFFER_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2724,9 +2724,9 @@ inline void FieldToJson_D3D_SHADER_CBUFFER_FLAGS(nlohmann::ordered_json& jdata,
     {
         representation = ToString_D3D_SHADER_CBUFFER_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D_PARAMETER_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D_PARAMETER_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2737,9 +2737,9 @@ inline void FieldToJson_D3D_PARAMETER_FLAGS(nlohmann::ordered_json& jdata, const
     {
         representation = ToString_D3D_PARAMETER_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2750,9 +2750,9 @@ inline void FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(nlohmann::ordered_json&
     {
         representation = ToString_D3D12_GPU_BASED_VALIDATION_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_RLDO_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_RLDO_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2763,9 +2763,9 @@ inline void FieldToJson_D3D12_RLDO_FLAGS(nlohmann::ordered_json& jdata, const ui
     {
         representation = ToString_D3D12_RLDO_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_GPU_BASED_VALIDATION_PIPELINE_STATE_CREATE_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_GPU_BASED_VALIDATION_PIPELINE_STATE_CREATE_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2776,9 +2776,9 @@ inline void FieldToJson_D3D12_GPU_BASED_VALIDATION_PIPELINE_STATE_CREATE_FLAGS(n
     {
         representation = ToString_D3D12_GPU_BASED_VALIDATION_PIPELINE_STATE_CREATE_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
-inline void FieldToJson_D3D12_MESSAGE_CALLBACK_FLAGS(nlohmann::ordered_json& jdata, const uint32_t flags, const JsonOptions& options = JsonOptions())
+inline void FieldToJson_D3D12_MESSAGE_CALLBACK_FLAGS(JsonStreamWriter& writer, const uint32_t flags, const JsonOptions& options = JsonOptions())
 {
     std::string representation;
     if (!options.expand_flags)
@@ -2789,13 +2789,13 @@ inline void FieldToJson_D3D12_MESSAGE_CALLBACK_FLAGS(nlohmann::ordered_json& jda
     {
         representation = ToString_D3D12_MESSAGE_CALLBACK_FLAGS(flags);
     }
-    FieldToJson(jdata, representation, options);
+    FieldToJson(writer, representation, options);
 }
 
 // IID struct-as-enum special case:
-inline void FieldToJson(nlohmann::ordered_json& jdata, const IID& value, const JsonOptions& options = JsonOptions())
+inline void FieldToJson(JsonStreamWriter& writer, const IID& value, const JsonOptions& options = JsonOptions())
 {
-    FieldToJson(jdata, ToString(value), options);
+    FieldToJson(writer, ToString(value), options);
 }
 
 GFXRECON_END_NAMESPACE(util)
@@ -49,14 +49,15 @@ void Dx12JsonConsumer::Process_CreateDXGIFactory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppFactory"], ppFactory, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppFactory"), ppFactory, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -69,14 +70,15 @@ void Dx12JsonConsumer::Process_CreateDXGIFactory1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppFactory"], ppFactory, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppFactory"), ppFactory, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -91,15 +93,16 @@ void Dx12JsonConsumer::Process_IDXGIObject_SetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateData");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Name"], Name, options);
-        FieldToJson(args["DataSize"], DataSize, options);
-        FieldToJson(args["pData"], pData, options);
+        FieldToJson(writer.Key("Name"), Name, options);
+        FieldToJson(writer.Key("DataSize"), DataSize, options);
+        FieldToJson(writer.Key("pData"), pData, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -112,14 +115,15 @@ void Dx12JsonConsumer::Process_IDXGIObject_SetPrivateDataInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateDataInterface");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "SetPrivateDataInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Name"], Name, options);
-        FieldToJson(args["pUnknown"], pUnknown, options);
+        FieldToJson(writer.Key("Name"), Name, options);
+        FieldToJson(writer.Key("pUnknown"), pUnknown, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -133,15 +137,16 @@ void Dx12JsonConsumer::Process_IDXGIObject_GetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "GetPrivateData");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "GetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Name"], Name, options);
-        FieldToJson(args["pDataSize"], pDataSize, options);
-        FieldToJson(args["pData"], pData, options);
+        FieldToJson(writer.Key("Name"), Name, options);
+        FieldToJson(writer.Key("pDataSize"), pDataSize, options);
+        FieldToJson(writer.Key("pData"), pData, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -154,14 +159,15 @@ void Dx12JsonConsumer::Process_IDXGIObject_GetParent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "GetParent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIObject", object_id, "GetParent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppParent"], ppParent, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppParent"), ppParent, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -174,14 +180,15 @@ void Dx12JsonConsumer::Process_IDXGIDeviceSubObject_GetDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDeviceSubObject", object_id, "GetDevice");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDeviceSubObject", object_id, "GetDevice");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppDevice"], ppDevice, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppDevice"), ppDevice, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -193,13 +200,14 @@ void Dx12JsonConsumer::Process_IDXGIResource_GetSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetSharedHandle");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pSharedHandle"], pSharedHandle, options);
+        FieldToJson(writer.Key("pSharedHandle"), pSharedHandle, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -211,13 +219,14 @@ void Dx12JsonConsumer::Process_IDXGIResource_GetUsage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetUsage");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetUsage");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pUsage"], pUsage, options);
+        FieldToJson(writer.Key("pUsage"), pUsage, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -229,13 +238,14 @@ void Dx12JsonConsumer::Process_IDXGIResource_SetEvictionPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "SetEvictionPriority");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "SetEvictionPriority");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["EvictionPriority"], EvictionPriority, options);
+        FieldToJson(writer.Key("EvictionPriority"), EvictionPriority, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -247,13 +257,14 @@ void Dx12JsonConsumer::Process_IDXGIResource_GetEvictionPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetEvictionPriority");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIResource", object_id, "GetEvictionPriority");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pEvictionPriority"], pEvictionPriority, options);
+        FieldToJson(writer.Key("pEvictionPriority"), pEvictionPriority, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -266,14 +277,15 @@ void Dx12JsonConsumer::Process_IDXGIKeyedMutex_AcquireSync(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "AcquireSync");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "AcquireSync");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Key"], Key, options);
-        FieldToJson(args["dwMilliseconds"], dwMilliseconds, options);
+        FieldToJson(writer.Key("Key"), Key, options);
+        FieldToJson(writer.Key("dwMilliseconds"), dwMilliseconds, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -285,13 +297,14 @@ void Dx12JsonConsumer::Process_IDXGIKeyedMutex_ReleaseSync(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "ReleaseSync");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIKeyedMutex", object_id, "ReleaseSync");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Key"], Key, options);
+        FieldToJson(writer.Key("Key"), Key, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -303,13 +316,14 @@ void Dx12JsonConsumer::Process_IDXGISurface_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -322,14 +336,15 @@ void Dx12JsonConsumer::Process_IDXGISurface_Map(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "Map");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "Map");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pLockedRect"], pLockedRect, options);
-        FieldToJson(args["MapFlags"], MapFlags, options);
+        FieldToJson(writer.Key("pLockedRect"), pLockedRect, options);
+        FieldToJson(writer.Key("MapFlags"), MapFlags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -340,9 +355,9 @@ void Dx12JsonConsumer::Process_IDXGISurface_Unmap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "Unmap");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISurface", object_id, "Unmap");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -355,14 +370,15 @@ void Dx12JsonConsumer::Process_IDXGISurface1_GetDC(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface1", object_id, "GetDC");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISurface1", object_id, "GetDC");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["Discard"], Discard, options);
-        FieldToJson(args["phdc"], phdc, options);
+        Bool32ToJson(writer.Key("Discard"), Discard, options);
+        FieldToJson(writer.Key("phdc"), phdc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -374,13 +390,14 @@ void Dx12JsonConsumer::Process_IDXGISurface1_ReleaseDC(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface1", object_id, "ReleaseDC");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISurface1", object_id, "ReleaseDC");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDirtyRect"], pDirtyRect, options);
+        FieldToJson(writer.Key("pDirtyRect"), pDirtyRect, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -393,14 +410,15 @@ void Dx12JsonConsumer::Process_IDXGIAdapter_EnumOutputs(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "EnumOutputs");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "EnumOutputs");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Output"], Output, options);
-        FieldToJson(args["ppOutput"], ppOutput, options);
+        FieldToJson(writer.Key("Output"), Output, options);
+        FieldToJson(writer.Key("ppOutput"), ppOutput, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -412,13 +430,14 @@ void Dx12JsonConsumer::Process_IDXGIAdapter_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -431,14 +450,15 @@ void Dx12JsonConsumer::Process_IDXGIAdapter_CheckInterfaceSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "CheckInterfaceSupport");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter", object_id, "CheckInterfaceSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["InterfaceName"], InterfaceName, options);
-        FieldToJson(args["pUMDVersion"], pUMDVersion, options);
+        FieldToJson(writer.Key("InterfaceName"), InterfaceName, options);
+        FieldToJson(writer.Key("pUMDVersion"), pUMDVersion, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -450,13 +470,14 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -471,16 +492,17 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetDisplayModeList(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplayModeList");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplayModeList");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["EnumFormat"], EnumFormat, options);
-        FieldToJson(args["Flags"], Flags, options);
-        FieldToJson(args["pNumModes"], pNumModes, options);
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("EnumFormat"), EnumFormat, options);
+        FieldToJson(writer.Key("Flags"), Flags, options);
+        FieldToJson(writer.Key("pNumModes"), pNumModes, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -494,15 +516,16 @@ void Dx12JsonConsumer::Process_IDXGIOutput_FindClosestMatchingMode(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "FindClosestMatchingMode");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "FindClosestMatchingMode");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pModeToMatch"], pModeToMatch, options);
-        FieldToJson(args["pClosestMatch"], pClosestMatch, options);
-        FieldToJson(args["pConcernedDevice"], pConcernedDevice, options);
+        FieldToJson(writer.Key("pModeToMatch"), pModeToMatch, options);
+        FieldToJson(writer.Key("pClosestMatch"), pClosestMatch, options);
+        FieldToJson(writer.Key("pConcernedDevice"), pConcernedDevice, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -513,9 +536,9 @@ void Dx12JsonConsumer::Process_IDXGIOutput_WaitForVBlank(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "WaitForVBlank");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "WaitForVBlank");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -528,14 +551,15 @@ void Dx12JsonConsumer::Process_IDXGIOutput_TakeOwnership(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "TakeOwnership");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "TakeOwnership");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        Bool32ToJson(args["Exclusive"], Exclusive, options);
+        FieldToJson(writer.Key("pDevice"), pDevice, options);
+        Bool32ToJson(writer.Key("Exclusive"), Exclusive, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -545,7 +569,7 @@ void Dx12JsonConsumer::Process_IDXGIOutput_ReleaseOwnership(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "ReleaseOwnership");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "ReleaseOwnership");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -558,13 +582,14 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetGammaControlCapabilities(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControlCapabilities");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControlCapabilities");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pGammaCaps"], pGammaCaps, options);
+        FieldToJson(writer.Key("pGammaCaps"), pGammaCaps, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -576,13 +601,14 @@ void Dx12JsonConsumer::Process_IDXGIOutput_SetGammaControl(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "SetGammaControl");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "SetGammaControl");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pArray"], pArray, options);
+        FieldToJson(writer.Key("pArray"), pArray, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -594,13 +620,14 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetGammaControl(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControl");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetGammaControl");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pArray"], pArray, options);
+        FieldToJson(writer.Key("pArray"), pArray, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -612,13 +639,14 @@ void Dx12JsonConsumer::Process_IDXGIOutput_SetDisplaySurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "SetDisplaySurface");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "SetDisplaySurface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pScanoutSurface"], pScanoutSurface, options);
+        FieldToJson(writer.Key("pScanoutSurface"), pScanoutSurface, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -630,13 +658,14 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetDisplaySurfaceData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplaySurfaceData");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetDisplaySurfaceData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDestination"], pDestination, options);
+        FieldToJson(writer.Key("pDestination"), pDestination, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -648,13 +677,14 @@ void Dx12JsonConsumer::Process_IDXGIOutput_GetFrameStatistics(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetFrameStatistics");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput", object_id, "GetFrameStatistics");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pStats"], pStats, options);
+        FieldToJson(writer.Key("pStats"), pStats, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -667,14 +697,15 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_Present(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "Present");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "Present");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["SyncInterval"], SyncInterval, options);
-        FieldToJson(args["Flags"], Flags, options);
+        FieldToJson(writer.Key("SyncInterval"), SyncInterval, options);
+        FieldToJson(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -688,15 +719,16 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetBuffer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetBuffer");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetBuffer");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Buffer"], Buffer, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppSurface"], ppSurface, options);
+        FieldToJson(writer.Key("Buffer"), Buffer, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppSurface"), ppSurface, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -709,14 +741,15 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_SetFullscreenState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "SetFullscreenState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "SetFullscreenState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["Fullscreen"], Fullscreen, options);
-        FieldToJson(args["pTarget"], pTarget, options);
+        Bool32ToJson(writer.Key("Fullscreen"), Fullscreen, options);
+        FieldToJson(writer.Key("pTarget"), pTarget, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -729,14 +762,15 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetFullscreenState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFullscreenState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFullscreenState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["pFullscreen"], pFullscreen, options);
-        FieldToJson(args["ppTarget"], ppTarget, options);
+        Bool32ToJson(writer.Key("pFullscreen"), pFullscreen, options);
+        FieldToJson(writer.Key("ppTarget"), ppTarget, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -748,13 +782,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -770,17 +805,18 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_ResizeBuffers(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeBuffers");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeBuffers");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["BufferCount"], BufferCount, options);
-        FieldToJson(args["Width"], Width, options);
-        FieldToJson(args["Height"], Height, options);
-        FieldToJson(args["NewFormat"], NewFormat, options);
-        FieldToJson(args["SwapChainFlags"], SwapChainFlags, options);
+        FieldToJson(writer.Key("BufferCount"), BufferCount, options);
+        FieldToJson(writer.Key("Width"), Width, options);
+        FieldToJson(writer.Key("Height"), Height, options);
+        FieldToJson(writer.Key("NewFormat"), NewFormat, options);
+        FieldToJson(writer.Key("SwapChainFlags"), SwapChainFlags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -792,13 +828,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_ResizeTarget(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeTarget");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "ResizeTarget");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pNewTargetParameters"], pNewTargetParameters, options);
+        FieldToJson(writer.Key("pNewTargetParameters"), pNewTargetParameters, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -810,13 +847,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetContainingOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetContainingOutput");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetContainingOutput");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ppOutput"], ppOutput, options);
+        FieldToJson(writer.Key("ppOutput"), ppOutput, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -828,13 +866,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetFrameStatistics(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFrameStatistics");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetFrameStatistics");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pStats"], pStats, options);
+        FieldToJson(writer.Key("pStats"), pStats, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -846,13 +885,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain_GetLastPresentCount(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetLastPresentCount");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain", object_id, "GetLastPresentCount");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pLastPresentCount"], pLastPresentCount, options);
+        FieldToJson(writer.Key("pLastPresentCount"), pLastPresentCount, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -865,14 +905,15 @@ void Dx12JsonConsumer::Process_IDXGIFactory_EnumAdapters(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "EnumAdapters");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "EnumAdapters");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Adapter"], Adapter, options);
-        FieldToJson(args["ppAdapter"], ppAdapter, options);
+        FieldToJson(writer.Key("Adapter"), Adapter, options);
+        FieldToJson(writer.Key("ppAdapter"), ppAdapter, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -885,14 +926,15 @@ void Dx12JsonConsumer::Process_IDXGIFactory_MakeWindowAssociation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "MakeWindowAssociation");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "MakeWindowAssociation");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["WindowHandle"], WindowHandle, options);
-        FieldToJson(args["Flags"], Flags, options);
+        FieldToJson(writer.Key("WindowHandle"), WindowHandle, options);
+        FieldToJson(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -904,13 +946,14 @@ void Dx12JsonConsumer::Process_IDXGIFactory_GetWindowAssociation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "GetWindowAssociation");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "GetWindowAssociation");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pWindowHandle"], pWindowHandle, options);
+        FieldToJson(writer.Key("pWindowHandle"), pWindowHandle, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -924,15 +967,16 @@ void Dx12JsonConsumer::Process_IDXGIFactory_CreateSwapChain(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSwapChain");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSwapChain");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        FieldToJson(writer.Key("pDevice"), pDevice, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("ppSwapChain"), ppSwapChain, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -945,14 +989,15 @@ void Dx12JsonConsumer::Process_IDXGIFactory_CreateSoftwareAdapter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSoftwareAdapter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory", object_id, "CreateSoftwareAdapter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Module"], Module, options);
-        FieldToJson(args["ppAdapter"], ppAdapter, options);
+        FieldToJson(writer.Key("Module"), Module, options);
+        FieldToJson(writer.Key("ppAdapter"), ppAdapter, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -964,13 +1009,14 @@ void Dx12JsonConsumer::Process_IDXGIDevice_GetAdapter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "GetAdapter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "GetAdapter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pAdapter"], pAdapter, options);
+        FieldToJson(writer.Key("pAdapter"), pAdapter, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -986,17 +1032,18 @@ void Dx12JsonConsumer::Process_IDXGIDevice_CreateSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "CreateSurface");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "CreateSurface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["NumSurfaces"], NumSurfaces, options);
-        FieldToJson(args["Usage"], Usage, options);
-        FieldToJson(args["pSharedResource"], pSharedResource, options);
-        FieldToJson(args["ppSurface"], ppSurface, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("NumSurfaces"), NumSurfaces, options);
+        FieldToJson(writer.Key("Usage"), Usage, options);
+        FieldToJson(writer.Key("pSharedResource"), pSharedResource, options);
+        FieldToJson(writer.Key("ppSurface"), ppSurface, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1010,15 +1057,16 @@ void Dx12JsonConsumer::Process_IDXGIDevice_QueryResourceResidency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "QueryResourceResidency");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "QueryResourceResidency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ppResources"], ppResources, options);
-        FieldToJson(args["pResidencyStatus"], pResidencyStatus, options);
-        FieldToJson(args["NumResources"], NumResources, options);
+        FieldToJson(writer.Key("ppResources"), ppResources, options);
+        FieldToJson(writer.Key("pResidencyStatus"), pResidencyStatus, options);
+        FieldToJson(writer.Key("NumResources"), NumResources, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1030,13 +1078,14 @@ void Dx12JsonConsumer::Process_IDXGIDevice_SetGPUThreadPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "SetGPUThreadPriority");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "SetGPUThreadPriority");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Priority"], Priority, options);
+        FieldToJson(writer.Key("Priority"), Priority, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1048,13 +1097,14 @@ void Dx12JsonConsumer::Process_IDXGIDevice_GetGPUThreadPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "GetGPUThreadPriority");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice", object_id, "GetGPUThreadPriority");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pPriority"], pPriority, options);
+        FieldToJson(writer.Key("pPriority"), pPriority, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1067,14 +1117,15 @@ void Dx12JsonConsumer::Process_IDXGIFactory1_EnumAdapters1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory1", object_id, "EnumAdapters1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory1", object_id, "EnumAdapters1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Adapter"], Adapter, options);
-        FieldToJson(args["ppAdapter"], ppAdapter, options);
+        FieldToJson(writer.Key("Adapter"), Adapter, options);
+        FieldToJson(writer.Key("ppAdapter"), ppAdapter, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1085,9 +1136,9 @@ void Dx12JsonConsumer::Process_IDXGIFactory1_IsCurrent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory1", object_id, "IsCurrent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory1", object_id, "IsCurrent");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -1099,13 +1150,14 @@ void Dx12JsonConsumer::Process_IDXGIAdapter1_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter1", object_id, "GetDesc1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter1", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1117,13 +1169,14 @@ void Dx12JsonConsumer::Process_IDXGIDevice1_SetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice1", object_id, "SetMaximumFrameLatency");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice1", object_id, "SetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["MaxLatency"], MaxLatency, options);
+        FieldToJson(writer.Key("MaxLatency"), MaxLatency, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1135,13 +1188,14 @@ void Dx12JsonConsumer::Process_IDXGIDevice1_GetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice1", object_id, "GetMaximumFrameLatency");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice1", object_id, "GetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pMaxLatency"], pMaxLatency, options);
+        FieldToJson(writer.Key("pMaxLatency"), pMaxLatency, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1156,9 +1210,9 @@ void Dx12JsonConsumer::Process_IDXGIDisplayControl_IsStereoEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDisplayControl", object_id, "IsStereoEnabled");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDisplayControl", object_id, "IsStereoEnabled");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -1169,12 +1223,13 @@ void Dx12JsonConsumer::Process_IDXGIDisplayControl_SetStereoEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDisplayControl", object_id, "SetStereoEnabled");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDisplayControl", object_id, "SetStereoEnabled");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["enabled"], enabled, options);
+        Bool32ToJson(writer.Key("enabled"), enabled, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1185,12 +1240,13 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1204,15 +1260,16 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_AcquireNextFrame(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "AcquireNextFrame");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "AcquireNextFrame");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["TimeoutInMilliseconds"], TimeoutInMilliseconds, options);
-        FieldToJson(args["pFrameInfo"], pFrameInfo, options);
-        FieldToJson(args["ppDesktopResource"], ppDesktopResource, options);
+        FieldToJson(writer.Key("TimeoutInMilliseconds"), TimeoutInMilliseconds, options);
+        FieldToJson(writer.Key("pFrameInfo"), pFrameInfo, options);
+        FieldToJson(writer.Key("ppDesktopResource"), ppDesktopResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1226,15 +1283,16 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFrameDirtyRects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameDirtyRects");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameDirtyRects");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["DirtyRectsBufferSize"], DirtyRectsBufferSize, options);
-        FieldToJson(args["pDirtyRectsBuffer"], pDirtyRectsBuffer, options);
-        FieldToJson(args["pDirtyRectsBufferSizeRequired"], pDirtyRectsBufferSizeRequired, options);
+        FieldToJson(writer.Key("DirtyRectsBufferSize"), DirtyRectsBufferSize, options);
+        FieldToJson(writer.Key("pDirtyRectsBuffer"), pDirtyRectsBuffer, options);
+        FieldToJson(writer.Key("pDirtyRectsBufferSizeRequired"), pDirtyRectsBufferSizeRequired, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1248,15 +1306,16 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFrameMoveRects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameMoveRects");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFrameMoveRects");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["MoveRectsBufferSize"], MoveRectsBufferSize, options);
-        FieldToJson(args["pMoveRectBuffer"], pMoveRectBuffer, options);
-        FieldToJson(args["pMoveRectsBufferSizeRequired"], pMoveRectsBufferSizeRequired, options);
+        FieldToJson(writer.Key("MoveRectsBufferSize"), MoveRectsBufferSize, options);
+        FieldToJson(writer.Key("pMoveRectBuffer"), pMoveRectBuffer, options);
+        FieldToJson(writer.Key("pMoveRectsBufferSizeRequired"), pMoveRectsBufferSizeRequired, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1271,16 +1330,17 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_GetFramePointerShape(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFramePointerShape");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "GetFramePointerShape");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["PointerShapeBufferSize"], PointerShapeBufferSize, options);
-        FieldToJson(args["pPointerShapeBuffer"], pPointerShapeBuffer, options);
-        FieldToJson(args["pPointerShapeBufferSizeRequired"], pPointerShapeBufferSizeRequired, options);
-        FieldToJson(args["pPointerShapeInfo"], pPointerShapeInfo, options);
+        FieldToJson(writer.Key("PointerShapeBufferSize"), PointerShapeBufferSize, options);
+        FieldToJson(writer.Key("pPointerShapeBuffer"), pPointerShapeBuffer, options);
+        FieldToJson(writer.Key("pPointerShapeBufferSizeRequired"), pPointerShapeBufferSizeRequired, options);
+        FieldToJson(writer.Key("pPointerShapeInfo"), pPointerShapeInfo, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1292,13 +1352,14 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_MapDesktopSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "MapDesktopSurface");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "MapDesktopSurface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pLockedRect"], pLockedRect, options);
+        FieldToJson(writer.Key("pLockedRect"), pLockedRect, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1309,9 +1370,9 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_UnMapDesktopSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "UnMapDesktopSurface");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "UnMapDesktopSurface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -1322,9 +1383,9 @@ void Dx12JsonConsumer::Process_IDXGIOutputDuplication_ReleaseFrame(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "ReleaseFrame");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutputDuplication", object_id, "ReleaseFrame");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -1338,15 +1399,16 @@ void Dx12JsonConsumer::Process_IDXGISurface2_GetResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISurface2", object_id, "GetResource");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISurface2", object_id, "GetResource");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppParentResource"], ppParentResource, options);
-        FieldToJson(args["pSubresourceIndex"], pSubresourceIndex, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppParentResource"), ppParentResource, options);
+        FieldToJson(writer.Key("pSubresourceIndex"), pSubresourceIndex, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1359,14 +1421,15 @@ void Dx12JsonConsumer::Process_IDXGIResource1_CreateSubresourceSurface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSubresourceSurface");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSubresourceSurface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["index"], index, options);
-        FieldToJson(args["ppSurface"], ppSurface, options);
+        FieldToJson(writer.Key("index"), index, options);
+        FieldToJson(writer.Key("ppSurface"), ppSurface, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1381,16 +1444,17 @@ void Dx12JsonConsumer::Process_IDXGIResource1_CreateSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSharedHandle");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIResource1", object_id, "CreateSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pAttributes"], pAttributes, options);
-        FieldToJson(args["dwAccess"], dwAccess, options);
-        FieldToJson(args["lpName"], lpName, options);
-        FieldToJson(args["pHandle"], pHandle, options);
+        FieldToJson(writer.Key("pAttributes"), pAttributes, options);
+        FieldToJson(writer.Key("dwAccess"), dwAccess, options);
+        FieldToJson(writer.Key("lpName"), lpName, options);
+        FieldToJson(writer.Key("pHandle"), pHandle, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1404,15 +1468,16 @@ void Dx12JsonConsumer::Process_IDXGIDevice2_OfferResources(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "OfferResources");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "OfferResources");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumResources"], NumResources, options);
-        FieldToJson(args["ppResources"], ppResources, options);
-        FieldToJson(args["Priority"], Priority, options);
+        FieldToJson(writer.Key("NumResources"), NumResources, options);
+        FieldToJson(writer.Key("ppResources"), ppResources, options);
+        FieldToJson(writer.Key("Priority"), Priority, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1426,15 +1491,16 @@ void Dx12JsonConsumer::Process_IDXGIDevice2_ReclaimResources(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "ReclaimResources");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "ReclaimResources");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumResources"], NumResources, options);
-        FieldToJson(args["ppResources"], ppResources, options);
-        Bool32ToJson(args["pDiscarded"], pDiscarded, options);
+        FieldToJson(writer.Key("NumResources"), NumResources, options);
+        FieldToJson(writer.Key("ppResources"), ppResources, options);
+        Bool32ToJson(writer.Key("pDiscarded"), pDiscarded, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1446,13 +1512,14 @@ void Dx12JsonConsumer::Process_IDXGIDevice2_EnqueueSetEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "EnqueueSetEvent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice2", object_id, "EnqueueSetEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
+        FieldToJson(writer.Key("hEvent"), hEvent, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1464,13 +1531,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetDesc1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1482,13 +1550,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetFullscreenDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetFullscreenDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetFullscreenDesc");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1500,13 +1569,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetHwnd(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetHwnd");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetHwnd");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pHwnd"], pHwnd, options);
+        FieldToJson(writer.Key("pHwnd"), pHwnd, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1519,14 +1589,15 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetCoreWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetCoreWindow");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetCoreWindow");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["refiid"], refiid, options);
-        FieldToJson(args["ppUnk"], ppUnk, options);
+        FieldToJson(writer.Key("refiid"), refiid, options);
+        FieldToJson(writer.Key("ppUnk"), ppUnk, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1540,15 +1611,16 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_Present1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "Present1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "Present1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["SyncInterval"], SyncInterval, options);
-        FieldToJson(args["PresentFlags"], PresentFlags, options);
-        FieldToJson(args["pPresentParameters"], pPresentParameters, options);
+        FieldToJson(writer.Key("SyncInterval"), SyncInterval, options);
+        FieldToJson(writer.Key("PresentFlags"), PresentFlags, options);
+        FieldToJson(writer.Key("pPresentParameters"), pPresentParameters, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1559,9 +1631,9 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_IsTemporaryMonoSupported(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "IsTemporaryMonoSupported");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "IsTemporaryMonoSupported");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -1573,13 +1645,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetRestrictToOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRestrictToOutput");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRestrictToOutput");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ppRestrictToOutput"], ppRestrictToOutput, options);
+        FieldToJson(writer.Key("ppRestrictToOutput"), ppRestrictToOutput, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1591,13 +1664,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_SetBackgroundColor(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetBackgroundColor");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetBackgroundColor");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pColor"], pColor, options);
+        FieldToJson(writer.Key("pColor"), pColor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1609,13 +1683,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetBackgroundColor(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetBackgroundColor");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetBackgroundColor");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pColor"], pColor, options);
+        FieldToJson(writer.Key("pColor"), pColor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1627,13 +1702,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_SetRotation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetRotation");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "SetRotation");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Rotation"], Rotation, options);
+        FieldToJson(writer.Key("Rotation"), Rotation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1645,13 +1721,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain1_GetRotation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRotation");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain1", object_id, "GetRotation");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pRotation"], pRotation, options);
+        FieldToJson(writer.Key("pRotation"), pRotation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1662,9 +1739,9 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_IsWindowedStereoEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "IsWindowedStereoEnabled");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "IsWindowedStereoEnabled");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -1681,18 +1758,19 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForHwnd(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForHwnd");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForHwnd");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["hWnd"], hWnd, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pFullscreenDesc"], pFullscreenDesc, options);
-        FieldToJson(args["pRestrictToOutput"], pRestrictToOutput, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        FieldToJson(writer.Key("pDevice"), pDevice, options);
+        FieldToJson(writer.Key("hWnd"), hWnd, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("pFullscreenDesc"), pFullscreenDesc, options);
+        FieldToJson(writer.Key("pRestrictToOutput"), pRestrictToOutput, options);
+        FieldToJson(writer.Key("ppSwapChain"), ppSwapChain, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1708,17 +1786,18 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForCoreWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForCoreWindow");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForCoreWindow");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["pWindow"], pWindow, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pRestrictToOutput"], pRestrictToOutput, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        FieldToJson(writer.Key("pDevice"), pDevice, options);
+        FieldToJson(writer.Key("pWindow"), pWindow, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("pRestrictToOutput"), pRestrictToOutput, options);
+        FieldToJson(writer.Key("ppSwapChain"), ppSwapChain, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1731,14 +1810,15 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_GetSharedResourceAdapterLuid(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "GetSharedResourceAdapterLuid");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "GetSharedResourceAdapterLuid");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["hResource"], hResource, options);
-        FieldToJson(args["pLuid"], pLuid, options);
+        FieldToJson(writer.Key("hResource"), hResource, options);
+        FieldToJson(writer.Key("pLuid"), pLuid, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1752,15 +1832,16 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterStereoStatusWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusWindow");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusWindow");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["WindowHandle"], WindowHandle, options);
-        FieldToJson(args["wMsg"], wMsg, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        FieldToJson(writer.Key("WindowHandle"), WindowHandle, options);
+        FieldToJson(writer.Key("wMsg"), wMsg, options);
+        FieldToJson(writer.Key("pdwCookie"), pdwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1773,14 +1854,15 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterStereoStatusEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusEvent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterStereoStatusEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        FieldToJson(writer.Key("hEvent"), hEvent, options);
+        FieldToJson(writer.Key("pdwCookie"), pdwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1791,12 +1873,13 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_UnregisterStereoStatus(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterStereoStatus");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterStereoStatus");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["dwCookie"], dwCookie, options);
+        FieldToJson(writer.Key("dwCookie"), dwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1810,15 +1893,16 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterOcclusionStatusWindow(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusWindow");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusWindow");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["WindowHandle"], WindowHandle, options);
-        FieldToJson(args["wMsg"], wMsg, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        FieldToJson(writer.Key("WindowHandle"), WindowHandle, options);
+        FieldToJson(writer.Key("wMsg"), wMsg, options);
+        FieldToJson(writer.Key("pdwCookie"), pdwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1831,14 +1915,15 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_RegisterOcclusionStatusEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusEvent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "RegisterOcclusionStatusEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        FieldToJson(writer.Key("hEvent"), hEvent, options);
+        FieldToJson(writer.Key("pdwCookie"), pdwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1849,12 +1934,13 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_UnregisterOcclusionStatus(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterOcclusionStatus");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "UnregisterOcclusionStatus");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["dwCookie"], dwCookie, options);
+        FieldToJson(writer.Key("dwCookie"), dwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1869,16 +1955,17 @@ void Dx12JsonConsumer::Process_IDXGIFactory2_CreateSwapChainForComposition(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForComposition");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory2", object_id, "CreateSwapChainForComposition");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pRestrictToOutput"], pRestrictToOutput, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        FieldToJson(writer.Key("pDevice"), pDevice, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("pRestrictToOutput"), pRestrictToOutput, options);
+        FieldToJson(writer.Key("ppSwapChain"), ppSwapChain, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1890,13 +1977,14 @@ void Dx12JsonConsumer::Process_IDXGIAdapter2_GetDesc2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter2", object_id, "GetDesc2");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter2", object_id, "GetDesc2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1911,16 +1999,17 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_GetDisplayModeList1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplayModeList1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplayModeList1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["EnumFormat"], EnumFormat, options);
-        FieldToJson(args["Flags"], Flags, options);
-        FieldToJson(args["pNumModes"], pNumModes, options);
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("EnumFormat"), EnumFormat, options);
+        FieldToJson(writer.Key("Flags"), Flags, options);
+        FieldToJson(writer.Key("pNumModes"), pNumModes, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1934,15 +2023,16 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_FindClosestMatchingMode1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "FindClosestMatchingMode1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "FindClosestMatchingMode1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pModeToMatch"], pModeToMatch, options);
-        FieldToJson(args["pClosestMatch"], pClosestMatch, options);
-        FieldToJson(args["pConcernedDevice"], pConcernedDevice, options);
+        FieldToJson(writer.Key("pModeToMatch"), pModeToMatch, options);
+        FieldToJson(writer.Key("pClosestMatch"), pClosestMatch, options);
+        FieldToJson(writer.Key("pConcernedDevice"), pConcernedDevice, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1954,13 +2044,14 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_GetDisplaySurfaceData1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplaySurfaceData1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "GetDisplaySurfaceData1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDestination"], pDestination, options);
+        FieldToJson(writer.Key("pDestination"), pDestination, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1973,14 +2064,15 @@ void Dx12JsonConsumer::Process_IDXGIOutput1_DuplicateOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "DuplicateOutput");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput1", object_id, "DuplicateOutput");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["ppOutputDuplication"], ppOutputDuplication, options);
+        FieldToJson(writer.Key("pDevice"), pDevice, options);
+        FieldToJson(writer.Key("ppOutputDuplication"), ppOutputDuplication, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -1997,15 +2089,16 @@ void Dx12JsonConsumer::Process_CreateDXGIFactory2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory2");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "CreateDXGIFactory2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Flags"], Flags, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppFactory"], ppFactory, options);
+        FieldToJson(writer.Key("Flags"), Flags, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppFactory"), ppFactory, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -2019,15 +2112,16 @@ void Dx12JsonConsumer::Process_DXGIGetDebugInterface1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "DXGIGetDebugInterface1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "DXGIGetDebugInterface1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Flags"], Flags, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["pDebug"], pDebug, options);
+        FieldToJson(writer.Key("Flags"), Flags, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("pDebug"), pDebug, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -2038,7 +2132,7 @@ void Dx12JsonConsumer::Process_IDXGIDevice3_Trim(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice3", object_id, "Trim");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice3", object_id, "Trim");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -2052,14 +2146,15 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_SetSourceSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetSourceSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetSourceSize");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Width"], Width, options);
-        FieldToJson(args["Height"], Height, options);
+        FieldToJson(writer.Key("Width"), Width, options);
+        FieldToJson(writer.Key("Height"), Height, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2072,14 +2167,15 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetSourceSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetSourceSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetSourceSize");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pWidth"], pWidth, options);
-        FieldToJson(args["pHeight"], pHeight, options);
+        FieldToJson(writer.Key("pWidth"), pWidth, options);
+        FieldToJson(writer.Key("pHeight"), pHeight, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2091,13 +2187,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_SetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMaximumFrameLatency");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["MaxLatency"], MaxLatency, options);
+        FieldToJson(writer.Key("MaxLatency"), MaxLatency, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2109,13 +2206,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetMaximumFrameLatency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMaximumFrameLatency");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMaximumFrameLatency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pMaxLatency"], pMaxLatency, options);
+        FieldToJson(writer.Key("pMaxLatency"), pMaxLatency, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2126,9 +2224,9 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetFrameLatencyWaitableObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetFrameLatencyWaitableObject");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetFrameLatencyWaitableObject");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -2140,13 +2238,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_SetMatrixTransform(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMatrixTransform");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "SetMatrixTransform");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pMatrix"], pMatrix, options);
+        FieldToJson(writer.Key("pMatrix"), pMatrix, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2158,13 +2257,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain2_GetMatrixTransform(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMatrixTransform");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain2", object_id, "GetMatrixTransform");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pMatrix"], pMatrix, options);
+        FieldToJson(writer.Key("pMatrix"), pMatrix, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2175,9 +2275,9 @@ void Dx12JsonConsumer::Process_IDXGIOutput2_SupportsOverlays(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput2", object_id, "SupportsOverlays");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput2", object_id, "SupportsOverlays");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -2188,9 +2288,9 @@ void Dx12JsonConsumer::Process_IDXGIFactory3_GetCreationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory3", object_id, "GetCreationFlags");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory3", object_id, "GetCreationFlags");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -2204,15 +2304,16 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_PresentBuffer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "PresentBuffer");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "PresentBuffer");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["BufferToPresent"], BufferToPresent, options);
-        FieldToJson(args["SyncInterval"], SyncInterval, options);
-        FieldToJson(args["Flags"], Flags, options);
+        FieldToJson(writer.Key("BufferToPresent"), BufferToPresent, options);
+        FieldToJson(writer.Key("SyncInterval"), SyncInterval, options);
+        FieldToJson(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2224,13 +2325,14 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetSourceRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetSourceRect");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetSourceRect");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pRect"], pRect, options);
+        FieldToJson(writer.Key("pRect"), pRect, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2242,13 +2344,14 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetTargetRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetTargetRect");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetTargetRect");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pRect"], pRect, options);
+        FieldToJson(writer.Key("pRect"), pRect, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2261,14 +2364,15 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetDestSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetDestSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetDestSize");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Width"], Width, options);
-        FieldToJson(args["Height"], Height, options);
+        FieldToJson(writer.Key("Width"), Width, options);
+        FieldToJson(writer.Key("Height"), Height, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2280,13 +2384,14 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetSourceRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetSourceRect");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetSourceRect");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pRect"], pRect, options);
+        FieldToJson(writer.Key("pRect"), pRect, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2298,13 +2403,14 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetTargetRect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetTargetRect");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetTargetRect");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pRect"], pRect, options);
+        FieldToJson(writer.Key("pRect"), pRect, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2317,14 +2423,15 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetDestSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetDestSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetDestSize");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pWidth"], pWidth, options);
-        FieldToJson(args["pHeight"], pHeight, options);
+        FieldToJson(writer.Key("pWidth"), pWidth, options);
+        FieldToJson(writer.Key("pHeight"), pHeight, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2336,13 +2443,14 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_SetColorSpace(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetColorSpace");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "SetColorSpace");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(args["ColorSpace"], ColorSpace, options);
+        FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(writer.Key("ColorSpace"), ColorSpace, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2353,9 +2461,9 @@ void Dx12JsonConsumer::Process_IDXGIDecodeSwapChain_GetColorSpace(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetColorSpace");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDecodeSwapChain", object_id, "GetColorSpace");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(method[format::kNameReturn], return_value, options);
+    FieldToJson_DXGI_MULTIPLANE_OVERLAY_YCbCr_FLAGS(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -2371,17 +2479,18 @@ void Dx12JsonConsumer::Process_IDXGIFactoryMedia_CreateSwapChainForCompositionSu
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateSwapChainForCompositionSurfaceHandle");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateSwapChainForCompositionSurfaceHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["hSurface"], hSurface, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pRestrictToOutput"], pRestrictToOutput, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        FieldToJson(writer.Key("pDevice"), pDevice, options);
+        FieldToJson(writer.Key("hSurface"), hSurface, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("pRestrictToOutput"), pRestrictToOutput, options);
+        FieldToJson(writer.Key("ppSwapChain"), ppSwapChain, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2398,18 +2507,19 @@ void Dx12JsonConsumer::Process_IDXGIFactoryMedia_CreateDecodeSwapChainForComposi
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateDecodeSwapChainForCompositionSurfaceHandle");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactoryMedia", object_id, "CreateDecodeSwapChainForCompositionSurfaceHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["hSurface"], hSurface, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pYuvDecodeBuffers"], pYuvDecodeBuffers, options);
-        FieldToJson(args["pRestrictToOutput"], pRestrictToOutput, options);
-        FieldToJson(args["ppSwapChain"], ppSwapChain, options);
+        FieldToJson(writer.Key("pDevice"), pDevice, options);
+        FieldToJson(writer.Key("hSurface"), hSurface, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("pYuvDecodeBuffers"), pYuvDecodeBuffers, options);
+        FieldToJson(writer.Key("pRestrictToOutput"), pRestrictToOutput, options);
+        FieldToJson(writer.Key("ppSwapChain"), ppSwapChain, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2421,13 +2531,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChainMedia_GetFrameStatisticsMedia(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "GetFrameStatisticsMedia");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "GetFrameStatisticsMedia");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pStats"], pStats, options);
+        FieldToJson(writer.Key("pStats"), pStats, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2439,13 +2550,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChainMedia_SetPresentDuration(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "SetPresentDuration");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "SetPresentDuration");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Duration"], Duration, options);
+        FieldToJson(writer.Key("Duration"), Duration, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2459,15 +2571,16 @@ void Dx12JsonConsumer::Process_IDXGISwapChainMedia_CheckPresentDurationSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "CheckPresentDurationSupport");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChainMedia", object_id, "CheckPresentDurationSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["DesiredPresentDuration"], DesiredPresentDuration, options);
-        FieldToJson(args["pClosestSmallerPresentDuration"], pClosestSmallerPresentDuration, options);
-        FieldToJson(args["pClosestLargerPresentDuration"], pClosestLargerPresentDuration, options);
+        FieldToJson(writer.Key("DesiredPresentDuration"), DesiredPresentDuration, options);
+        FieldToJson(writer.Key("pClosestSmallerPresentDuration"), pClosestSmallerPresentDuration, options);
+        FieldToJson(writer.Key("pClosestLargerPresentDuration"), pClosestLargerPresentDuration, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2481,15 +2594,16 @@ void Dx12JsonConsumer::Process_IDXGIOutput3_CheckOverlaySupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput3", object_id, "CheckOverlaySupport");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput3", object_id, "CheckOverlaySupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["EnumFormat"], EnumFormat, options);
-        FieldToJson(args["pConcernedDevice"], pConcernedDevice, options);
-        FieldToJson(args["pFlags"], pFlags, options);
+        FieldToJson(writer.Key("EnumFormat"), EnumFormat, options);
+        FieldToJson(writer.Key("pConcernedDevice"), pConcernedDevice, options);
+        FieldToJson(writer.Key("pFlags"), pFlags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2504,9 +2618,9 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_GetCurrentBackBufferIndex(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "GetCurrentBackBufferIndex");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "GetCurrentBackBufferIndex");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -2519,14 +2633,15 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_CheckColorSpaceSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "CheckColorSpaceSupport");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "CheckColorSpaceSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ColorSpace"], ColorSpace, options);
-        FieldToJson(args["pColorSpaceSupport"], pColorSpaceSupport, options);
+        FieldToJson(writer.Key("ColorSpace"), ColorSpace, options);
+        FieldToJson(writer.Key("pColorSpaceSupport"), pColorSpaceSupport, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2538,13 +2653,14 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_SetColorSpace1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "SetColorSpace1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "SetColorSpace1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ColorSpace"], ColorSpace, options);
+        FieldToJson(writer.Key("ColorSpace"), ColorSpace, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2562,19 +2678,20 @@ void Dx12JsonConsumer::Process_IDXGISwapChain3_ResizeBuffers1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "ResizeBuffers1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain3", object_id, "ResizeBuffers1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["BufferCount"], BufferCount, options);
-        FieldToJson(args["Width"], Width, options);
-        FieldToJson(args["Height"], Height, options);
-        FieldToJson(args["Format"], Format, options);
-        FieldToJson(args["SwapChainFlags"], SwapChainFlags, options);
-        FieldToJsonAsFixedWidthBinary(args["pCreationNodeMask"], pCreationNodeMask, options);
-        FieldToJson(args["ppPresentQueue"], ppPresentQueue, options);
+        FieldToJson(writer.Key("BufferCount"), BufferCount, options);
+        FieldToJson(writer.Key("Width"), Width, options);
+        FieldToJson(writer.Key("Height"), Height, options);
+        FieldToJson(writer.Key("Format"), Format, options);
+        FieldToJson(writer.Key("SwapChainFlags"), SwapChainFlags, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("pCreationNodeMask"), pCreationNodeMask, options);
+        FieldToJson(writer.Key("ppPresentQueue"), ppPresentQueue, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2589,16 +2706,17 @@ void Dx12JsonConsumer::Process_IDXGIOutput4_CheckOverlayColorSpaceSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput4", object_id, "CheckOverlayColorSpaceSupport");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput4", object_id, "CheckOverlayColorSpaceSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Format"], Format, options);
-        FieldToJson(args["ColorSpace"], ColorSpace, options);
-        FieldToJson(args["pConcernedDevice"], pConcernedDevice, options);
-        FieldToJson(args["pFlags"], pFlags, options);
+        FieldToJson(writer.Key("Format"), Format, options);
+        FieldToJson(writer.Key("ColorSpace"), ColorSpace, options);
+        FieldToJson(writer.Key("pConcernedDevice"), pConcernedDevice, options);
+        FieldToJson(writer.Key("pFlags"), pFlags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2612,15 +2730,16 @@ void Dx12JsonConsumer::Process_IDXGIFactory4_EnumAdapterByLuid(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumAdapterByLuid");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumAdapterByLuid");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["AdapterLuid"], AdapterLuid, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvAdapter"], ppvAdapter, options);
+        FieldToJson(writer.Key("AdapterLuid"), AdapterLuid, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvAdapter"), ppvAdapter, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2633,14 +2752,15 @@ void Dx12JsonConsumer::Process_IDXGIFactory4_EnumWarpAdapter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumWarpAdapter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory4", object_id, "EnumWarpAdapter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvAdapter"], ppvAdapter, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvAdapter"), ppvAdapter, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2653,14 +2773,15 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_RegisterHardwareContentProtectionTe
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterHardwareContentProtectionTeardownStatusEvent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterHardwareContentProtectionTeardownStatusEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        FieldToJson(writer.Key("hEvent"), hEvent, options);
+        FieldToJson(writer.Key("pdwCookie"), pdwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2671,12 +2792,13 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_UnregisterHardwareContentProtection
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterHardwareContentProtectionTeardownStatus");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterHardwareContentProtectionTeardownStatus");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["dwCookie"], dwCookie, options);
+        FieldToJson(writer.Key("dwCookie"), dwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2690,15 +2812,16 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_QueryVideoMemoryInfo(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "QueryVideoMemoryInfo");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "QueryVideoMemoryInfo");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NodeIndex"], NodeIndex, options);
-        FieldToJson(args["MemorySegmentGroup"], MemorySegmentGroup, options);
-        FieldToJson(args["pVideoMemoryInfo"], pVideoMemoryInfo, options);
+        FieldToJson(writer.Key("NodeIndex"), NodeIndex, options);
+        FieldToJson(writer.Key("MemorySegmentGroup"), MemorySegmentGroup, options);
+        FieldToJson(writer.Key("pVideoMemoryInfo"), pVideoMemoryInfo, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2712,15 +2835,16 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_SetVideoMemoryReservation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "SetVideoMemoryReservation");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "SetVideoMemoryReservation");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NodeIndex"], NodeIndex, options);
-        FieldToJson(args["MemorySegmentGroup"], MemorySegmentGroup, options);
-        FieldToJson(args["Reservation"], Reservation, options);
+        FieldToJson(writer.Key("NodeIndex"), NodeIndex, options);
+        FieldToJson(writer.Key("MemorySegmentGroup"), MemorySegmentGroup, options);
+        FieldToJson(writer.Key("Reservation"), Reservation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2733,14 +2857,15 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_RegisterVideoMemoryBudgetChangeNoti
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterVideoMemoryBudgetChangeNotificationEvent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "RegisterVideoMemoryBudgetChangeNotificationEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        FieldToJson(writer.Key("hEvent"), hEvent, options);
+        FieldToJson(writer.Key("pdwCookie"), pdwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2751,12 +2876,13 @@ void Dx12JsonConsumer::Process_IDXGIAdapter3_UnregisterVideoMemoryBudgetChangeNo
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterVideoMemoryBudgetChangeNotification");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter3", object_id, "UnregisterVideoMemoryBudgetChangeNotification");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["dwCookie"], dwCookie, options);
+        FieldToJson(writer.Key("dwCookie"), dwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2776,17 +2902,18 @@ void Dx12JsonConsumer::Process_IDXGIOutput5_DuplicateOutput1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput5", object_id, "DuplicateOutput1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput5", object_id, "DuplicateOutput1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDevice"], pDevice, options);
-        FieldToJson(args["Flags"], Flags, options);
-        FieldToJson(args["SupportedFormatsCount"], SupportedFormatsCount, options);
-        FieldToJson(args["pSupportedFormats"], pSupportedFormats, options);
-        FieldToJson(args["ppOutputDuplication"], ppOutputDuplication, options);
+        FieldToJson(writer.Key("pDevice"), pDevice, options);
+        FieldToJson(writer.Key("Flags"), Flags, options);
+        FieldToJson(writer.Key("SupportedFormatsCount"), SupportedFormatsCount, options);
+        FieldToJson(writer.Key("pSupportedFormats"), pSupportedFormats, options);
+        FieldToJson(writer.Key("ppOutputDuplication"), ppOutputDuplication, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2800,15 +2927,16 @@ void Dx12JsonConsumer::Process_IDXGISwapChain4_SetHDRMetaData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGISwapChain4", object_id, "SetHDRMetaData");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGISwapChain4", object_id, "SetHDRMetaData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["Size"], Size, options);
-        FieldToJson(args["pMetaData"], pMetaData, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("Size"), Size, options);
+        FieldToJson(writer.Key("pMetaData"), pMetaData, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2823,16 +2951,17 @@ void Dx12JsonConsumer::Process_IDXGIDevice4_OfferResources1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice4", object_id, "OfferResources1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice4", object_id, "OfferResources1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumResources"], NumResources, options);
-        FieldToJson(args["ppResources"], ppResources, options);
-        FieldToJson(args["Priority"], Priority, options);
-        FieldToJson(args["Flags"], Flags, options);
+        FieldToJson(writer.Key("NumResources"), NumResources, options);
+        FieldToJson(writer.Key("ppResources"), ppResources, options);
+        FieldToJson(writer.Key("Priority"), Priority, options);
+        FieldToJson(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2846,15 +2975,16 @@ void Dx12JsonConsumer::Process_IDXGIDevice4_ReclaimResources1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIDevice4", object_id, "ReclaimResources1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIDevice4", object_id, "ReclaimResources1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumResources"], NumResources, options);
-        FieldToJson(args["ppResources"], ppResources, options);
-        FieldToJson(args["pResults"], pResults, options);
+        FieldToJson(writer.Key("NumResources"), NumResources, options);
+        FieldToJson(writer.Key("ppResources"), ppResources, options);
+        FieldToJson(writer.Key("pResults"), pResults, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2868,12 +2998,10 @@ void Dx12JsonConsumer::Process_DXGIDeclareAdapterRemovalSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "DXGIDeclareAdapterRemovalSupport");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "DXGIDeclareAdapterRemovalSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
-    {
-    }
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).Null();
     writer_->WriteBlockEnd();
 
 }
@@ -2886,13 +3014,14 @@ void Dx12JsonConsumer::Process_IDXGIAdapter4_GetDesc3(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIAdapter4", object_id, "GetDesc3");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIAdapter4", object_id, "GetDesc3");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2904,13 +3033,14 @@ void Dx12JsonConsumer::Process_IDXGIOutput6_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput6", object_id, "GetDesc1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput6", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2922,13 +3052,14 @@ void Dx12JsonConsumer::Process_IDXGIOutput6_CheckHardwareCompositionSupport(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIOutput6", object_id, "CheckHardwareCompositionSupport");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIOutput6", object_id, "CheckHardwareCompositionSupport");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFlags"], pFlags, options);
+        FieldToJson(writer.Key("pFlags"), pFlags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2943,16 +3074,17 @@ void Dx12JsonConsumer::Process_IDXGIFactory6_EnumAdapterByGpuPreference(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory6", object_id, "EnumAdapterByGpuPreference");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory6", object_id, "EnumAdapterByGpuPreference");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Adapter"], Adapter, options);
-        FieldToJson(args["GpuPreference"], GpuPreference, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvAdapter"], ppvAdapter, options);
+        FieldToJson(writer.Key("Adapter"), Adapter, options);
+        FieldToJson(writer.Key("GpuPreference"), GpuPreference, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvAdapter"), ppvAdapter, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2965,14 +3097,15 @@ void Dx12JsonConsumer::Process_IDXGIFactory7_RegisterAdaptersChangedEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory7", object_id, "RegisterAdaptersChangedEvent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory7", object_id, "RegisterAdaptersChangedEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["hEvent"], hEvent, options);
-        FieldToJson(args["pdwCookie"], pdwCookie, options);
+        FieldToJson(writer.Key("hEvent"), hEvent, options);
+        FieldToJson(writer.Key("pdwCookie"), pdwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -2984,13 +3117,14 @@ void Dx12JsonConsumer::Process_IDXGIFactory7_UnregisterAdaptersChangedEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IDXGIFactory7", object_id, "UnregisterAdaptersChangedEvent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IDXGIFactory7", object_id, "UnregisterAdaptersChangedEvent");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["dwCookie"], dwCookie, options);
+        FieldToJson(writer.Key("dwCookie"), dwCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3008,16 +3142,17 @@ void Dx12JsonConsumer::Process_D3D12SerializeRootSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12SerializeRootSignature");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "D3D12SerializeRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pRootSignature"], pRootSignature, options);
-        FieldToJson(args["Version"], Version, options);
-        FieldToJson(args["ppBlob"], ppBlob, options);
-        FieldToJson(args["ppErrorBlob"], ppErrorBlob, options);
+        FieldToJson(writer.Key("pRootSignature"), pRootSignature, options);
+        FieldToJson(writer.Key("Version"), Version, options);
+        FieldToJson(writer.Key("ppBlob"), ppBlob, options);
+        FieldToJson(writer.Key("ppErrorBlob"), ppErrorBlob, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -3032,16 +3167,17 @@ void Dx12JsonConsumer::Process_D3D12CreateRootSignatureDeserializer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12CreateRootSignatureDeserializer");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "D3D12CreateRootSignatureDeserializer");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pSrcData"], pSrcData, options);
-        FieldToJson(args["SrcDataSizeInBytes"], SrcDataSizeInBytes, options);
-        FieldToJson(args["pRootSignatureDeserializerInterface"], pRootSignatureDeserializerInterface, options);
-        FieldToJson(args["ppRootSignatureDeserializer"], ppRootSignatureDeserializer, options);
+        FieldToJson(writer.Key("pSrcData"), pSrcData, options);
+        FieldToJson(writer.Key("SrcDataSizeInBytes"), SrcDataSizeInBytes, options);
+        FieldToJson(writer.Key("pRootSignatureDeserializerInterface"), pRootSignatureDeserializerInterface, options);
+        FieldToJson(writer.Key("ppRootSignatureDeserializer"), ppRootSignatureDeserializer, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -3055,15 +3191,16 @@ void Dx12JsonConsumer::Process_D3D12SerializeVersionedRootSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12SerializeVersionedRootSignature");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "D3D12SerializeVersionedRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pRootSignature"], pRootSignature, options);
-        FieldToJson(args["ppBlob"], ppBlob, options);
-        FieldToJson(args["ppErrorBlob"], ppErrorBlob, options);
+        FieldToJson(writer.Key("pRootSignature"), pRootSignature, options);
+        FieldToJson(writer.Key("ppBlob"), ppBlob, options);
+        FieldToJson(writer.Key("ppErrorBlob"), ppErrorBlob, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -3078,16 +3215,17 @@ void Dx12JsonConsumer::Process_D3D12CreateVersionedRootSignatureDeserializer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12CreateVersionedRootSignatureDeserializer");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "D3D12CreateVersionedRootSignatureDeserializer");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pSrcData"], pSrcData, options);
-        FieldToJson(args["SrcDataSizeInBytes"], SrcDataSizeInBytes, options);
-        FieldToJson(args["pRootSignatureDeserializerInterface"], pRootSignatureDeserializerInterface, options);
-        FieldToJson(args["ppRootSignatureDeserializer"], ppRootSignatureDeserializer, options);
+        FieldToJson(writer.Key("pSrcData"), pSrcData, options);
+        FieldToJson(writer.Key("SrcDataSizeInBytes"), SrcDataSizeInBytes, options);
+        FieldToJson(writer.Key("pRootSignatureDeserializerInterface"), pRootSignatureDeserializerInterface, options);
+        FieldToJson(writer.Key("ppRootSignatureDeserializer"), ppRootSignatureDeserializer, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -3102,16 +3240,17 @@ void Dx12JsonConsumer::Process_D3D12CreateDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12CreateDevice");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "D3D12CreateDevice");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pAdapter"], pAdapter, options);
-        FieldToJson(args["MinimumFeatureLevel"], MinimumFeatureLevel, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppDevice"], ppDevice, options);
+        FieldToJson(writer.Key("pAdapter"), pAdapter, options);
+        FieldToJson(writer.Key("MinimumFeatureLevel"), MinimumFeatureLevel, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppDevice"), ppDevice, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -3124,14 +3263,15 @@ void Dx12JsonConsumer::Process_D3D12GetDebugInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12GetDebugInterface");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "D3D12GetDebugInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDebug"], ppvDebug, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvDebug"), ppvDebug, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -3146,16 +3286,17 @@ void Dx12JsonConsumer::Process_D3D12EnableExperimentalFeatures(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12EnableExperimentalFeatures");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "D3D12EnableExperimentalFeatures");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumFeatures"], NumFeatures, options);
-        FieldToJson(args["pIIDs"], pIIDs, options);
-        FieldToJson(args["pConfigurationStructs"], pConfigurationStructs, options);
-        FieldToJson(args["pConfigurationStructSizes"], pConfigurationStructSizes, options);
+        FieldToJson(writer.Key("NumFeatures"), NumFeatures, options);
+        FieldToJson(writer.Key("pIIDs"), pIIDs, options);
+        FieldToJson(writer.Key("pConfigurationStructs"), pConfigurationStructs, options);
+        FieldToJson(writer.Key("pConfigurationStructSizes"), pConfigurationStructSizes, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -3169,15 +3310,16 @@ void Dx12JsonConsumer::Process_D3D12GetInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& function = writer_->WriteApiCallStart(call_info, "D3D12GetInterface");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "D3D12GetInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(function[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = function[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["rclsid"], rclsid, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDebug"], ppvDebug, options);
+        FieldToJson(writer.Key("rclsid"), rclsid, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvDebug"), ppvDebug, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 
 }
@@ -3192,15 +3334,16 @@ void Dx12JsonConsumer::Process_ID3D12Object_GetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "GetPrivateData");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "GetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["guid"], guid, options);
-        FieldToJson(args["pDataSize"], pDataSize, options);
-        FieldToJson(args["pData"], pData, options);
+        FieldToJson(writer.Key("guid"), guid, options);
+        FieldToJson(writer.Key("pDataSize"), pDataSize, options);
+        FieldToJson(writer.Key("pData"), pData, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3214,15 +3357,16 @@ void Dx12JsonConsumer::Process_ID3D12Object_SetPrivateData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateData");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateData");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["guid"], guid, options);
-        FieldToJson(args["DataSize"], DataSize, options);
-        FieldToJson(args["pData"], pData, options);
+        FieldToJson(writer.Key("guid"), guid, options);
+        FieldToJson(writer.Key("DataSize"), DataSize, options);
+        FieldToJson(writer.Key("pData"), pData, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3235,14 +3379,15 @@ void Dx12JsonConsumer::Process_ID3D12Object_SetPrivateDataInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateDataInterface");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetPrivateDataInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["guid"], guid, options);
-        FieldToJson(args["pData"], pData, options);
+        FieldToJson(writer.Key("guid"), guid, options);
+        FieldToJson(writer.Key("pData"), pData, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3254,13 +3399,14 @@ void Dx12JsonConsumer::Process_ID3D12Object_SetName(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetName");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Object", object_id, "SetName");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Name"], Name, options);
+        FieldToJson(writer.Key("Name"), Name, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3273,14 +3419,15 @@ void Dx12JsonConsumer::Process_ID3D12DeviceChild_GetDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceChild", object_id, "GetDevice");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceChild", object_id, "GetDevice");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDevice"], ppvDevice, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvDevice"), ppvDevice, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3291,9 +3438,9 @@ void Dx12JsonConsumer::Process_ID3D12RootSignatureDeserializer_GetRootSignatureD
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12RootSignatureDeserializer", object_id, "GetRootSignatureDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12RootSignatureDeserializer", object_id, "GetRootSignatureDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3306,14 +3453,15 @@ void Dx12JsonConsumer::Process_ID3D12VersionedRootSignatureDeserializer_GetRootS
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetRootSignatureDescAtVersion");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetRootSignatureDescAtVersion");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["convertToVersion"], convertToVersion, options);
-        FieldToJson(args["ppDesc"], ppDesc, options);
+        FieldToJson(writer.Key("convertToVersion"), convertToVersion, options);
+        FieldToJson(writer.Key("ppDesc"), ppDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3324,9 +3472,9 @@ void Dx12JsonConsumer::Process_ID3D12VersionedRootSignatureDeserializer_GetUncon
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetUnconvertedRootSignatureDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12VersionedRootSignatureDeserializer", object_id, "GetUnconvertedRootSignatureDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3337,9 +3485,9 @@ void Dx12JsonConsumer::Process_ID3D12Heap_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Heap", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Heap", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3353,15 +3501,16 @@ void Dx12JsonConsumer::Process_ID3D12Resource_Map(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "Map");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "Map");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["pReadRange"], pReadRange, options);
-        FieldToJson(args["ppData"], ppData, options);
+        FieldToJson(writer.Key("Subresource"), Subresource, options);
+        FieldToJson(writer.Key("pReadRange"), pReadRange, options);
+        FieldToJson(writer.Key("ppData"), ppData, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3373,13 +3522,14 @@ void Dx12JsonConsumer::Process_ID3D12Resource_Unmap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "Unmap");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "Unmap");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["pWrittenRange"], pWrittenRange, options);
+        FieldToJson(writer.Key("Subresource"), Subresource, options);
+        FieldToJson(writer.Key("pWrittenRange"), pWrittenRange, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3390,9 +3540,9 @@ void Dx12JsonConsumer::Process_ID3D12Resource_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3403,9 +3553,9 @@ void Dx12JsonConsumer::Process_ID3D12Resource_GetGPUVirtualAddress(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetGPUVirtualAddress");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetGPUVirtualAddress");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJsonAsHex(method[format::kNameReturn], return_value, options);
+    FieldToJsonAsHex(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3421,17 +3571,18 @@ void Dx12JsonConsumer::Process_ID3D12Resource_ReadFromSubresource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "ReadFromSubresource");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "ReadFromSubresource");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDstData"], pDstData, options);
-        FieldToJson(args["DstRowPitch"], DstRowPitch, options);
-        FieldToJson(args["DstDepthPitch"], DstDepthPitch, options);
-        FieldToJson(args["SrcSubresource"], SrcSubresource, options);
-        FieldToJson(args["pSrcBox"], pSrcBox, options);
+        FieldToJson(writer.Key("pDstData"), pDstData, options);
+        FieldToJson(writer.Key("DstRowPitch"), DstRowPitch, options);
+        FieldToJson(writer.Key("DstDepthPitch"), DstDepthPitch, options);
+        FieldToJson(writer.Key("SrcSubresource"), SrcSubresource, options);
+        FieldToJson(writer.Key("pSrcBox"), pSrcBox, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3444,14 +3595,15 @@ void Dx12JsonConsumer::Process_ID3D12Resource_GetHeapProperties(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetHeapProperties");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Resource", object_id, "GetHeapProperties");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pHeapProperties"], pHeapProperties, options);
-        FieldToJson_D3D12_HEAP_FLAGS(args["pHeapFlags"], *pHeapFlags->GetPointer(), options);
+        FieldToJson(writer.Key("pHeapProperties"), pHeapProperties, options);
+        FieldToJson_D3D12_HEAP_FLAGS(writer.Key("pHeapFlags"), *pHeapFlags->GetPointer(), options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3462,9 +3614,9 @@ void Dx12JsonConsumer::Process_ID3D12CommandAllocator_Reset(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandAllocator", object_id, "Reset");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandAllocator", object_id, "Reset");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3475,9 +3627,9 @@ void Dx12JsonConsumer::Process_ID3D12Fence_GetCompletedValue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "GetCompletedValue");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "GetCompletedValue");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3490,14 +3642,15 @@ void Dx12JsonConsumer::Process_ID3D12Fence_SetEventOnCompletion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "SetEventOnCompletion");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "SetEventOnCompletion");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Value"], Value, options);
-        FieldToJson(args["hEvent"], hEvent, options);
+        FieldToJson(writer.Key("Value"), Value, options);
+        FieldToJson(writer.Key("hEvent"), hEvent, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3509,13 +3662,14 @@ void Dx12JsonConsumer::Process_ID3D12Fence_Signal(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "Signal");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Fence", object_id, "Signal");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Value"], Value, options);
+        FieldToJson(writer.Key("Value"), Value, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3526,9 +3680,9 @@ void Dx12JsonConsumer::Process_ID3D12Fence1_GetCreationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Fence1", object_id, "GetCreationFlags");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Fence1", object_id, "GetCreationFlags");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson_D3D12_FENCE_FLAGS(method[format::kNameReturn], return_value, options);
+    FieldToJson_D3D12_FENCE_FLAGS(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3540,13 +3694,14 @@ void Dx12JsonConsumer::Process_ID3D12PipelineState_GetCachedBlob(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineState", object_id, "GetCachedBlob");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12PipelineState", object_id, "GetCachedBlob");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ppBlob"], ppBlob, options);
+        FieldToJson(writer.Key("ppBlob"), ppBlob, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3557,9 +3712,9 @@ void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3570,9 +3725,9 @@ void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetCPUDescriptorHandleForHea
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetCPUDescriptorHandleForHeapStart");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetCPUDescriptorHandleForHeapStart");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3583,9 +3738,9 @@ void Dx12JsonConsumer::Process_ID3D12DescriptorHeap_GetGPUDescriptorHandleForHea
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetGPUDescriptorHandleForHeapStart");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DescriptorHeap", object_id, "GetGPUDescriptorHandleForHeapStart");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3596,9 +3751,9 @@ void Dx12JsonConsumer::Process_ID3D12CommandList_GetType(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandList", object_id, "GetType");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandList", object_id, "GetType");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3609,9 +3764,9 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Close(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Close");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Close");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -3624,14 +3779,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Reset(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Reset");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Reset");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pAllocator"], pAllocator, options);
-        FieldToJson(args["pInitialState"], pInitialState, options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, options);
+        FieldToJson(writer.Key("pInitialState"), pInitialState, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3642,12 +3798,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearState");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pPipelineState"], pPipelineState, options);
+        FieldToJson(writer.Key("pPipelineState"), pPipelineState, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3661,15 +3818,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DrawInstanced(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawInstanced");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawInstanced");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["VertexCountPerInstance"], VertexCountPerInstance, options);
-        FieldToJson(args["InstanceCount"], InstanceCount, options);
-        FieldToJson(args["StartVertexLocation"], StartVertexLocation, options);
-        FieldToJson(args["StartInstanceLocation"], StartInstanceLocation, options);
+        FieldToJson(writer.Key("VertexCountPerInstance"), VertexCountPerInstance, options);
+        FieldToJson(writer.Key("InstanceCount"), InstanceCount, options);
+        FieldToJson(writer.Key("StartVertexLocation"), StartVertexLocation, options);
+        FieldToJson(writer.Key("StartInstanceLocation"), StartInstanceLocation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3684,16 +3842,17 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DrawIndexedInstanced(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawIndexedInstanced");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DrawIndexedInstanced");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["IndexCountPerInstance"], IndexCountPerInstance, options);
-        FieldToJson(args["InstanceCount"], InstanceCount, options);
-        FieldToJson(args["StartIndexLocation"], StartIndexLocation, options);
-        FieldToJson(args["BaseVertexLocation"], BaseVertexLocation, options);
-        FieldToJson(args["StartInstanceLocation"], StartInstanceLocation, options);
+        FieldToJson(writer.Key("IndexCountPerInstance"), IndexCountPerInstance, options);
+        FieldToJson(writer.Key("InstanceCount"), InstanceCount, options);
+        FieldToJson(writer.Key("StartIndexLocation"), StartIndexLocation, options);
+        FieldToJson(writer.Key("BaseVertexLocation"), BaseVertexLocation, options);
+        FieldToJson(writer.Key("StartInstanceLocation"), StartInstanceLocation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3706,14 +3865,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_Dispatch(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Dispatch");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "Dispatch");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ThreadGroupCountX"], ThreadGroupCountX, options);
-        FieldToJson(args["ThreadGroupCountY"], ThreadGroupCountY, options);
-        FieldToJson(args["ThreadGroupCountZ"], ThreadGroupCountZ, options);
+        FieldToJson(writer.Key("ThreadGroupCountX"), ThreadGroupCountX, options);
+        FieldToJson(writer.Key("ThreadGroupCountY"), ThreadGroupCountY, options);
+        FieldToJson(writer.Key("ThreadGroupCountZ"), ThreadGroupCountZ, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3728,16 +3888,17 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyBufferRegion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyBufferRegion");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyBufferRegion");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDstBuffer"], pDstBuffer, options);
-        FieldToJson(args["DstOffset"], DstOffset, options);
-        FieldToJson(args["pSrcBuffer"], pSrcBuffer, options);
-        FieldToJson(args["SrcOffset"], SrcOffset, options);
-        FieldToJson(args["NumBytes"], NumBytes, options);
+        FieldToJson(writer.Key("pDstBuffer"), pDstBuffer, options);
+        FieldToJson(writer.Key("DstOffset"), DstOffset, options);
+        FieldToJson(writer.Key("pSrcBuffer"), pSrcBuffer, options);
+        FieldToJson(writer.Key("SrcOffset"), SrcOffset, options);
+        FieldToJson(writer.Key("NumBytes"), NumBytes, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3753,17 +3914,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyTextureRegion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTextureRegion");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTextureRegion");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDst"], pDst, options);
-        FieldToJson(args["DstX"], DstX, options);
-        FieldToJson(args["DstY"], DstY, options);
-        FieldToJson(args["DstZ"], DstZ, options);
-        FieldToJson(args["pSrc"], pSrc, options);
-        FieldToJson(args["pSrcBox"], pSrcBox, options);
+        FieldToJson(writer.Key("pDst"), pDst, options);
+        FieldToJson(writer.Key("DstX"), DstX, options);
+        FieldToJson(writer.Key("DstY"), DstY, options);
+        FieldToJson(writer.Key("DstZ"), DstZ, options);
+        FieldToJson(writer.Key("pSrc"), pSrc, options);
+        FieldToJson(writer.Key("pSrcBox"), pSrcBox, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3775,13 +3937,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyResource");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyResource");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDstResource"], pDstResource, options);
-        FieldToJson(args["pSrcResource"], pSrcResource, options);
+        FieldToJson(writer.Key("pDstResource"), pDstResource, options);
+        FieldToJson(writer.Key("pSrcResource"), pSrcResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3797,17 +3960,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_CopyTiles(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTiles");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "CopyTiles");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pTiledResource"], pTiledResource, options);
-        FieldToJson(args["pTileRegionStartCoordinate"], pTileRegionStartCoordinate, options);
-        FieldToJson(args["pTileRegionSize"], pTileRegionSize, options);
-        FieldToJson(args["pBuffer"], pBuffer, options);
-        FieldToJson(args["BufferStartOffsetInBytes"], BufferStartOffsetInBytes, options);
-        FieldToJson_D3D12_TILE_COPY_FLAGS(args["Flags"], Flags, options);
+        FieldToJson(writer.Key("pTiledResource"), pTiledResource, options);
+        FieldToJson(writer.Key("pTileRegionStartCoordinate"), pTileRegionStartCoordinate, options);
+        FieldToJson(writer.Key("pTileRegionSize"), pTileRegionSize, options);
+        FieldToJson(writer.Key("pBuffer"), pBuffer, options);
+        FieldToJson(writer.Key("BufferStartOffsetInBytes"), BufferStartOffsetInBytes, options);
+        FieldToJson_D3D12_TILE_COPY_FLAGS(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3822,16 +3986,17 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResolveSubresource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveSubresource");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveSubresource");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDstResource"], pDstResource, options);
-        FieldToJson(args["DstSubresource"], DstSubresource, options);
-        FieldToJson(args["pSrcResource"], pSrcResource, options);
-        FieldToJson(args["SrcSubresource"], SrcSubresource, options);
-        FieldToJson(args["Format"], Format, options);
+        FieldToJson(writer.Key("pDstResource"), pDstResource, options);
+        FieldToJson(writer.Key("DstSubresource"), DstSubresource, options);
+        FieldToJson(writer.Key("pSrcResource"), pSrcResource, options);
+        FieldToJson(writer.Key("SrcSubresource"), SrcSubresource, options);
+        FieldToJson(writer.Key("Format"), Format, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3842,12 +4007,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetPrimitiveTopology(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetPrimitiveTopology");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetPrimitiveTopology");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["PrimitiveTopology"], PrimitiveTopology, options);
+        FieldToJson(writer.Key("PrimitiveTopology"), PrimitiveTopology, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3859,13 +4025,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_RSSetViewports(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetViewports");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetViewports");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumViewports"], NumViewports, options);
-        FieldToJson(args["pViewports"], pViewports, options);
+        FieldToJson(writer.Key("NumViewports"), NumViewports, options);
+        FieldToJson(writer.Key("pViewports"), pViewports, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3877,13 +4044,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_RSSetScissorRects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetScissorRects");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "RSSetScissorRects");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumRects"], NumRects, options);
-        FieldToJson(args["pRects"], pRects, options);
+        FieldToJson(writer.Key("NumRects"), NumRects, options);
+        FieldToJson(writer.Key("pRects"), pRects, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3894,12 +4062,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetBlendFactor(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetBlendFactor");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetBlendFactor");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["BlendFactor"], BlendFactor, options);
+        FieldToJson(writer.Key("BlendFactor"), BlendFactor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3910,12 +4079,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetStencilRef(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetStencilRef");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetStencilRef");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["StencilRef"], StencilRef, options);
+        FieldToJson(writer.Key("StencilRef"), StencilRef, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3926,12 +4096,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetPipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPipelineState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPipelineState");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pPipelineState"], pPipelineState, options);
+        FieldToJson(writer.Key("pPipelineState"), pPipelineState, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3943,13 +4114,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResourceBarrier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResourceBarrier");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResourceBarrier");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumBarriers"], NumBarriers, options);
-        FieldToJson(args["pBarriers"], pBarriers, options);
+        FieldToJson(writer.Key("NumBarriers"), NumBarriers, options);
+        FieldToJson(writer.Key("pBarriers"), pBarriers, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3960,12 +4132,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ExecuteBundle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteBundle");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteBundle");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pCommandList"], pCommandList, options);
+        FieldToJson(writer.Key("pCommandList"), pCommandList, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3977,13 +4150,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetDescriptorHeaps(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetDescriptorHeaps");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetDescriptorHeaps");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumDescriptorHeaps"], NumDescriptorHeaps, options);
-        FieldToJson(args["ppDescriptorHeaps"], ppDescriptorHeaps, options);
+        FieldToJson(writer.Key("NumDescriptorHeaps"), NumDescriptorHeaps, options);
+        FieldToJson(writer.Key("ppDescriptorHeaps"), ppDescriptorHeaps, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -3994,12 +4168,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootSignature
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootSignature");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pRootSignature"], pRootSignature, options);
+        FieldToJson(writer.Key("pRootSignature"), pRootSignature, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4010,12 +4185,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootSignatur
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootSignature");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pRootSignature"], pRootSignature, options);
+        FieldToJson(writer.Key("pRootSignature"), pRootSignature, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4027,13 +4203,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootDescripto
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootDescriptorTable");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootDescriptorTable");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["BaseDescriptor"], BaseDescriptor, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJson(writer.Key("BaseDescriptor"), BaseDescriptor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4045,13 +4222,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootDescript
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootDescriptorTable");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootDescriptorTable");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["BaseDescriptor"], BaseDescriptor, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJson(writer.Key("BaseDescriptor"), BaseDescriptor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4064,14 +4242,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRoot32BitCons
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstant");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstant");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["SrcData"], SrcData, options);
-        FieldToJson(args["DestOffsetIn32BitValues"], DestOffsetIn32BitValues, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJson(writer.Key("SrcData"), SrcData, options);
+        FieldToJson(writer.Key("DestOffsetIn32BitValues"), DestOffsetIn32BitValues, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4084,14 +4263,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRoot32BitCon
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstant");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstant");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["SrcData"], SrcData, options);
-        FieldToJson(args["DestOffsetIn32BitValues"], DestOffsetIn32BitValues, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJson(writer.Key("SrcData"), SrcData, options);
+        FieldToJson(writer.Key("DestOffsetIn32BitValues"), DestOffsetIn32BitValues, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4105,15 +4285,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRoot32BitCons
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstants");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRoot32BitConstants");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["Num32BitValuesToSet"], Num32BitValuesToSet, options);
-        FieldToJson(args["pSrcData"], pSrcData, options);
-        FieldToJson(args["DestOffsetIn32BitValues"], DestOffsetIn32BitValues, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJson(writer.Key("Num32BitValuesToSet"), Num32BitValuesToSet, options);
+        FieldToJson(writer.Key("pSrcData"), pSrcData, options);
+        FieldToJson(writer.Key("DestOffsetIn32BitValues"), DestOffsetIn32BitValues, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4127,15 +4308,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRoot32BitCon
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstants");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRoot32BitConstants");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJson(args["Num32BitValuesToSet"], Num32BitValuesToSet, options);
-        FieldToJson(args["pSrcData"], pSrcData, options);
-        FieldToJson(args["DestOffsetIn32BitValues"], DestOffsetIn32BitValues, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJson(writer.Key("Num32BitValuesToSet"), Num32BitValuesToSet, options);
+        FieldToJson(writer.Key("pSrcData"), pSrcData, options);
+        FieldToJson(writer.Key("DestOffsetIn32BitValues"), DestOffsetIn32BitValues, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4147,13 +4329,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootConstantB
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootConstantBufferView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootConstantBufferView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJsonAsHex(writer.Key("BufferLocation"), BufferLocation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4165,13 +4348,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootConstant
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootConstantBufferView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootConstantBufferView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJsonAsHex(writer.Key("BufferLocation"), BufferLocation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4183,13 +4367,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootShaderRes
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootShaderResourceView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootShaderResourceView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJsonAsHex(writer.Key("BufferLocation"), BufferLocation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4201,13 +4386,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootShaderRe
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootShaderResourceView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootShaderResourceView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJsonAsHex(writer.Key("BufferLocation"), BufferLocation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4219,13 +4405,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetComputeRootUnordered
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootUnorderedAccessView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetComputeRootUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJsonAsHex(writer.Key("BufferLocation"), BufferLocation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4237,13 +4424,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetGraphicsRootUnordere
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootUnorderedAccessView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetGraphicsRootUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RootParameterIndex"], RootParameterIndex, options);
-        FieldToJsonAsHex(args["BufferLocation"], BufferLocation, options);
+        FieldToJson(writer.Key("RootParameterIndex"), RootParameterIndex, options);
+        FieldToJsonAsHex(writer.Key("BufferLocation"), BufferLocation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4254,12 +4442,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetIndexBuffer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetIndexBuffer");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetIndexBuffer");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pView"], pView, options);
+        FieldToJson(writer.Key("pView"), pView, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4272,14 +4461,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_IASetVertexBuffers(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetVertexBuffers");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "IASetVertexBuffers");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["StartSlot"], StartSlot, options);
-        FieldToJson(args["NumViews"], NumViews, options);
-        FieldToJson(args["pViews"], pViews, options);
+        FieldToJson(writer.Key("StartSlot"), StartSlot, options);
+        FieldToJson(writer.Key("NumViews"), NumViews, options);
+        FieldToJson(writer.Key("pViews"), pViews, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4292,14 +4482,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SOSetTargets(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SOSetTargets");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SOSetTargets");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["StartSlot"], StartSlot, options);
-        FieldToJson(args["NumViews"], NumViews, options);
-        FieldToJson(args["pViews"], pViews, options);
+        FieldToJson(writer.Key("StartSlot"), StartSlot, options);
+        FieldToJson(writer.Key("NumViews"), NumViews, options);
+        FieldToJson(writer.Key("pViews"), pViews, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4313,15 +4504,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_OMSetRenderTargets(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetRenderTargets");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "OMSetRenderTargets");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumRenderTargetDescriptors"], NumRenderTargetDescriptors, options);
-        FieldToJson(args["pRenderTargetDescriptors"], pRenderTargetDescriptors, options);
-        Bool32ToJson(args["RTsSingleHandleToDescriptorRange"], RTsSingleHandleToDescriptorRange, options);
-        FieldToJson(args["pDepthStencilDescriptor"], pDepthStencilDescriptor, options);
+        FieldToJson(writer.Key("NumRenderTargetDescriptors"), NumRenderTargetDescriptors, options);
+        FieldToJson(writer.Key("pRenderTargetDescriptors"), pRenderTargetDescriptors, options);
+        Bool32ToJson(writer.Key("RTsSingleHandleToDescriptorRange"), RTsSingleHandleToDescriptorRange, options);
+        FieldToJson(writer.Key("pDepthStencilDescriptor"), pDepthStencilDescriptor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4337,17 +4529,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearDepthStencilView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearDepthStencilView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearDepthStencilView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["DepthStencilView"], DepthStencilView, options);
-        FieldToJson_D3D12_CLEAR_FLAGS(args["ClearFlags"], ClearFlags, options);
-        FieldToJson(args["Depth"], Depth, options);
-        FieldToJson(args["Stencil"], Stencil, options);
-        FieldToJson(args["NumRects"], NumRects, options);
-        FieldToJson(args["pRects"], pRects, options);
+        FieldToJson(writer.Key("DepthStencilView"), DepthStencilView, options);
+        FieldToJson_D3D12_CLEAR_FLAGS(writer.Key("ClearFlags"), ClearFlags, options);
+        FieldToJson(writer.Key("Depth"), Depth, options);
+        FieldToJson(writer.Key("Stencil"), Stencil, options);
+        FieldToJson(writer.Key("NumRects"), NumRects, options);
+        FieldToJson(writer.Key("pRects"), pRects, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4361,15 +4554,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearRenderTargetView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearRenderTargetView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearRenderTargetView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["RenderTargetView"], RenderTargetView, options);
-        FieldToJson(args["ColorRGBA"], ColorRGBA, options);
-        FieldToJson(args["NumRects"], NumRects, options);
-        FieldToJson(args["pRects"], pRects, options);
+        FieldToJson(writer.Key("RenderTargetView"), RenderTargetView, options);
+        FieldToJson(writer.Key("ColorRGBA"), ColorRGBA, options);
+        FieldToJson(writer.Key("NumRects"), NumRects, options);
+        FieldToJson(writer.Key("pRects"), pRects, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4385,17 +4579,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearUnorderedAccessVie
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewUint");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewUint");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ViewGPUHandleInCurrentHeap"], ViewGPUHandleInCurrentHeap, options);
-        FieldToJson(args["ViewCPUHandle"], ViewCPUHandle, options);
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Values"], Values, options);
-        FieldToJson(args["NumRects"], NumRects, options);
-        FieldToJson(args["pRects"], pRects, options);
+        FieldToJson(writer.Key("ViewGPUHandleInCurrentHeap"), ViewGPUHandleInCurrentHeap, options);
+        FieldToJson(writer.Key("ViewCPUHandle"), ViewCPUHandle, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("Values"), Values, options);
+        FieldToJson(writer.Key("NumRects"), NumRects, options);
+        FieldToJson(writer.Key("pRects"), pRects, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4411,17 +4606,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ClearUnorderedAccessVie
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewFloat");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ClearUnorderedAccessViewFloat");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ViewGPUHandleInCurrentHeap"], ViewGPUHandleInCurrentHeap, options);
-        FieldToJson(args["ViewCPUHandle"], ViewCPUHandle, options);
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Values"], Values, options);
-        FieldToJson(args["NumRects"], NumRects, options);
-        FieldToJson(args["pRects"], pRects, options);
+        FieldToJson(writer.Key("ViewGPUHandleInCurrentHeap"), ViewGPUHandleInCurrentHeap, options);
+        FieldToJson(writer.Key("ViewCPUHandle"), ViewCPUHandle, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("Values"), Values, options);
+        FieldToJson(writer.Key("NumRects"), NumRects, options);
+        FieldToJson(writer.Key("pRects"), pRects, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4433,13 +4629,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_DiscardResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DiscardResource");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "DiscardResource");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["pRegion"], pRegion, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("pRegion"), pRegion, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4452,14 +4649,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_BeginQuery(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginQuery");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginQuery");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pQueryHeap"], pQueryHeap, options);
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["Index"], Index, options);
+        FieldToJson(writer.Key("pQueryHeap"), pQueryHeap, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("Index"), Index, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4472,14 +4670,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_EndQuery(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndQuery");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndQuery");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pQueryHeap"], pQueryHeap, options);
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["Index"], Index, options);
+        FieldToJson(writer.Key("pQueryHeap"), pQueryHeap, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("Index"), Index, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4495,17 +4694,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ResolveQueryData(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveQueryData");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ResolveQueryData");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pQueryHeap"], pQueryHeap, options);
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["StartIndex"], StartIndex, options);
-        FieldToJson(args["NumQueries"], NumQueries, options);
-        FieldToJson(args["pDestinationBuffer"], pDestinationBuffer, options);
-        FieldToJson(args["AlignedDestinationBufferOffset"], AlignedDestinationBufferOffset, options);
+        FieldToJson(writer.Key("pQueryHeap"), pQueryHeap, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("StartIndex"), StartIndex, options);
+        FieldToJson(writer.Key("NumQueries"), NumQueries, options);
+        FieldToJson(writer.Key("pDestinationBuffer"), pDestinationBuffer, options);
+        FieldToJson(writer.Key("AlignedDestinationBufferOffset"), AlignedDestinationBufferOffset, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4518,14 +4718,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetPredication(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPredication");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetPredication");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pBuffer"], pBuffer, options);
-        FieldToJson(args["AlignedBufferOffset"], AlignedBufferOffset, options);
-        FieldToJson(args["Operation"], Operation, options);
+        FieldToJson(writer.Key("pBuffer"), pBuffer, options);
+        FieldToJson(writer.Key("AlignedBufferOffset"), AlignedBufferOffset, options);
+        FieldToJson(writer.Key("Operation"), Operation, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4538,14 +4739,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_SetMarker(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetMarker");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "SetMarker");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Metadata"], Metadata, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["Size"], Size, options);
+        FieldToJson(writer.Key("Metadata"), Metadata, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("Size"), Size, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4558,14 +4760,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_BeginEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginEvent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "BeginEvent");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Metadata"], Metadata, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["Size"], Size, options);
+        FieldToJson(writer.Key("Metadata"), Metadata, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("Size"), Size, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4575,7 +4778,7 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_EndEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndEvent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "EndEvent");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -4592,17 +4795,18 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList_ExecuteIndirect(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteIndirect");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList", object_id, "ExecuteIndirect");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pCommandSignature"], pCommandSignature, options);
-        FieldToJson(args["MaxCommandCount"], MaxCommandCount, options);
-        FieldToJson(args["pArgumentBuffer"], pArgumentBuffer, options);
-        FieldToJson(args["ArgumentBufferOffset"], ArgumentBufferOffset, options);
-        FieldToJson(args["pCountBuffer"], pCountBuffer, options);
-        FieldToJson(args["CountBufferOffset"], CountBufferOffset, options);
+        FieldToJson(writer.Key("pCommandSignature"), pCommandSignature, options);
+        FieldToJson(writer.Key("MaxCommandCount"), MaxCommandCount, options);
+        FieldToJson(writer.Key("pArgumentBuffer"), pArgumentBuffer, options);
+        FieldToJson(writer.Key("ArgumentBufferOffset"), ArgumentBufferOffset, options);
+        FieldToJson(writer.Key("pCountBuffer"), pCountBuffer, options);
+        FieldToJson(writer.Key("CountBufferOffset"), CountBufferOffset, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4619,18 +4823,19 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDstBuffer"], pDstBuffer, options);
-        FieldToJson(args["DstOffset"], DstOffset, options);
-        FieldToJson(args["pSrcBuffer"], pSrcBuffer, options);
-        FieldToJson(args["SrcOffset"], SrcOffset, options);
-        FieldToJson(args["Dependencies"], Dependencies, options);
-        FieldToJson(args["ppDependentResources"], ppDependentResources, options);
-        FieldToJson(args["pDependentSubresourceRanges"], pDependentSubresourceRanges, options);
+        FieldToJson(writer.Key("pDstBuffer"), pDstBuffer, options);
+        FieldToJson(writer.Key("DstOffset"), DstOffset, options);
+        FieldToJson(writer.Key("pSrcBuffer"), pSrcBuffer, options);
+        FieldToJson(writer.Key("SrcOffset"), SrcOffset, options);
+        FieldToJson(writer.Key("Dependencies"), Dependencies, options);
+        FieldToJson(writer.Key("ppDependentResources"), ppDependentResources, options);
+        FieldToJson(writer.Key("pDependentSubresourceRanges"), pDependentSubresourceRanges, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4647,18 +4852,19 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_AtomicCopyBufferUINT64
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT64");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "AtomicCopyBufferUINT64");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDstBuffer"], pDstBuffer, options);
-        FieldToJson(args["DstOffset"], DstOffset, options);
-        FieldToJson(args["pSrcBuffer"], pSrcBuffer, options);
-        FieldToJson(args["SrcOffset"], SrcOffset, options);
-        FieldToJson(args["Dependencies"], Dependencies, options);
-        FieldToJson(args["ppDependentResources"], ppDependentResources, options);
-        FieldToJson(args["pDependentSubresourceRanges"], pDependentSubresourceRanges, options);
+        FieldToJson(writer.Key("pDstBuffer"), pDstBuffer, options);
+        FieldToJson(writer.Key("DstOffset"), DstOffset, options);
+        FieldToJson(writer.Key("pSrcBuffer"), pSrcBuffer, options);
+        FieldToJson(writer.Key("SrcOffset"), SrcOffset, options);
+        FieldToJson(writer.Key("Dependencies"), Dependencies, options);
+        FieldToJson(writer.Key("ppDependentResources"), ppDependentResources, options);
+        FieldToJson(writer.Key("pDependentSubresourceRanges"), pDependentSubresourceRanges, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4670,13 +4876,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_OMSetDepthBounds(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "OMSetDepthBounds");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "OMSetDepthBounds");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Min"], Min, options);
-        FieldToJson(args["Max"], Max, options);
+        FieldToJson(writer.Key("Min"), Min, options);
+        FieldToJson(writer.Key("Max"), Max, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4689,14 +4896,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_SetSamplePositions(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetSamplePositions");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetSamplePositions");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumSamplesPerPixel"], NumSamplesPerPixel, options);
-        FieldToJson(args["NumPixels"], NumPixels, options);
-        FieldToJson(args["pSamplePositions"], pSamplePositions, options);
+        FieldToJson(writer.Key("NumSamplesPerPixel"), NumSamplesPerPixel, options);
+        FieldToJson(writer.Key("NumPixels"), NumPixels, options);
+        FieldToJson(writer.Key("pSamplePositions"), pSamplePositions, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4715,20 +4923,21 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_ResolveSubresourceRegi
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "ResolveSubresourceRegion");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "ResolveSubresourceRegion");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDstResource"], pDstResource, options);
-        FieldToJson(args["DstSubresource"], DstSubresource, options);
-        FieldToJson(args["DstX"], DstX, options);
-        FieldToJson(args["DstY"], DstY, options);
-        FieldToJson(args["pSrcResource"], pSrcResource, options);
-        FieldToJson(args["SrcSubresource"], SrcSubresource, options);
-        FieldToJson(args["pSrcRect"], pSrcRect, options);
-        FieldToJson(args["Format"], Format, options);
-        FieldToJson(args["ResolveMode"], ResolveMode, options);
+        FieldToJson(writer.Key("pDstResource"), pDstResource, options);
+        FieldToJson(writer.Key("DstSubresource"), DstSubresource, options);
+        FieldToJson(writer.Key("DstX"), DstX, options);
+        FieldToJson(writer.Key("DstY"), DstY, options);
+        FieldToJson(writer.Key("pSrcResource"), pSrcResource, options);
+        FieldToJson(writer.Key("SrcSubresource"), SrcSubresource, options);
+        FieldToJson(writer.Key("pSrcRect"), pSrcRect, options);
+        FieldToJson(writer.Key("Format"), Format, options);
+        FieldToJson(writer.Key("ResolveMode"), ResolveMode, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4739,12 +4948,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList1_SetViewInstanceMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetViewInstanceMask");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList1", object_id, "SetViewInstanceMask");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["Mask"], Mask, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("Mask"), Mask, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4757,14 +4967,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList2_WriteBufferImmediate(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList2", object_id, "WriteBufferImmediate");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList2", object_id, "WriteBufferImmediate");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Count"], Count, options);
-        FieldToJson(args["pParams"], pParams, options);
-        FieldToJson(args["pModes"], pModes, options);
+        FieldToJson(writer.Key("Count"), Count, options);
+        FieldToJson(writer.Key("pParams"), pParams, options);
+        FieldToJson(writer.Key("pModes"), pModes, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4784,21 +4995,22 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_UpdateTileMappings(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "UpdateTileMappings");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "UpdateTileMappings");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["NumResourceRegions"], NumResourceRegions, options);
-        FieldToJson(args["pResourceRegionStartCoordinates"], pResourceRegionStartCoordinates, options);
-        FieldToJson(args["pResourceRegionSizes"], pResourceRegionSizes, options);
-        FieldToJson(args["pHeap"], pHeap, options);
-        FieldToJson(args["NumRanges"], NumRanges, options);
-        FieldToJson_D3D12_TILE_RANGE_FLAGS(args["pRangeFlags"], *pRangeFlags->GetPointer(), options);
-        FieldToJson(args["pHeapRangeStartOffsets"], pHeapRangeStartOffsets, options);
-        FieldToJson(args["pRangeTileCounts"], pRangeTileCounts, options);
-        FieldToJson_D3D12_TILE_MAPPING_FLAGS(args["Flags"], Flags, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("NumResourceRegions"), NumResourceRegions, options);
+        FieldToJson(writer.Key("pResourceRegionStartCoordinates"), pResourceRegionStartCoordinates, options);
+        FieldToJson(writer.Key("pResourceRegionSizes"), pResourceRegionSizes, options);
+        FieldToJson(writer.Key("pHeap"), pHeap, options);
+        FieldToJson(writer.Key("NumRanges"), NumRanges, options);
+        FieldToJson_D3D12_TILE_RANGE_FLAGS(writer.Key("pRangeFlags"), *pRangeFlags->GetPointer(), options);
+        FieldToJson(writer.Key("pHeapRangeStartOffsets"), pHeapRangeStartOffsets, options);
+        FieldToJson(writer.Key("pRangeTileCounts"), pRangeTileCounts, options);
+        FieldToJson_D3D12_TILE_MAPPING_FLAGS(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4814,17 +5026,18 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_CopyTileMappings(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "CopyTileMappings");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "CopyTileMappings");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDstResource"], pDstResource, options);
-        FieldToJson(args["pDstRegionStartCoordinate"], pDstRegionStartCoordinate, options);
-        FieldToJson(args["pSrcResource"], pSrcResource, options);
-        FieldToJson(args["pSrcRegionStartCoordinate"], pSrcRegionStartCoordinate, options);
-        FieldToJson(args["pRegionSize"], pRegionSize, options);
-        FieldToJson_D3D12_TILE_MAPPING_FLAGS(args["Flags"], Flags, options);
+        FieldToJson(writer.Key("pDstResource"), pDstResource, options);
+        FieldToJson(writer.Key("pDstRegionStartCoordinate"), pDstRegionStartCoordinate, options);
+        FieldToJson(writer.Key("pSrcResource"), pSrcResource, options);
+        FieldToJson(writer.Key("pSrcRegionStartCoordinate"), pSrcRegionStartCoordinate, options);
+        FieldToJson(writer.Key("pRegionSize"), pRegionSize, options);
+        FieldToJson_D3D12_TILE_MAPPING_FLAGS(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4836,13 +5049,14 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_ExecuteCommandLists(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "ExecuteCommandLists");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "ExecuteCommandLists");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumCommandLists"], NumCommandLists, options);
-        FieldToJson(args["ppCommandLists"], ppCommandLists, options);
+        FieldToJson(writer.Key("NumCommandLists"), NumCommandLists, options);
+        FieldToJson(writer.Key("ppCommandLists"), ppCommandLists, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4855,14 +5069,15 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_SetMarker(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "SetMarker");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "SetMarker");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Metadata"], Metadata, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["Size"], Size, options);
+        FieldToJson(writer.Key("Metadata"), Metadata, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("Size"), Size, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4875,14 +5090,15 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_BeginEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "BeginEvent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "BeginEvent");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Metadata"], Metadata, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["Size"], Size, options);
+        FieldToJson(writer.Key("Metadata"), Metadata, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("Size"), Size, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4892,7 +5108,7 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_EndEvent(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "EndEvent");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "EndEvent");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -4906,14 +5122,15 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_Signal(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Signal");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Signal");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFence"], pFence, options);
-        FieldToJson(args["Value"], Value, options);
+        FieldToJson(writer.Key("pFence"), pFence, options);
+        FieldToJson(writer.Key("Value"), Value, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4926,14 +5143,15 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_Wait(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Wait");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "Wait");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFence"], pFence, options);
-        FieldToJson(args["Value"], Value, options);
+        FieldToJson(writer.Key("pFence"), pFence, options);
+        FieldToJson(writer.Key("Value"), Value, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4945,13 +5163,14 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetTimestampFrequency(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetTimestampFrequency");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetTimestampFrequency");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFrequency"], pFrequency, options);
+        FieldToJson(writer.Key("pFrequency"), pFrequency, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4964,14 +5183,15 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetClockCalibration(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetClockCalibration");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetClockCalibration");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pGpuTimestamp"], pGpuTimestamp, options);
-        FieldToJson(args["pCpuTimestamp"], pCpuTimestamp, options);
+        FieldToJson(writer.Key("pGpuTimestamp"), pGpuTimestamp, options);
+        FieldToJson(writer.Key("pCpuTimestamp"), pCpuTimestamp, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -4982,9 +5202,9 @@ void Dx12JsonConsumer::Process_ID3D12CommandQueue_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12CommandQueue", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -4995,9 +5215,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetNodeCount(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetNodeCount");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetNodeCount");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -5011,15 +5231,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandQueue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandQueue");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandQueue");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppCommandQueue"], ppCommandQueue, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppCommandQueue"), ppCommandQueue, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5033,15 +5254,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandAllocator(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandAllocator");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandAllocator");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["type"], type, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppCommandAllocator"], ppCommandAllocator, options);
+        FieldToJson(writer.Key("type"), type, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppCommandAllocator"), ppCommandAllocator, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5055,15 +5277,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateGraphicsPipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateGraphicsPipelineState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateGraphicsPipelineState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppPipelineState"), ppPipelineState, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5077,15 +5300,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateComputePipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateComputePipelineState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateComputePipelineState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppPipelineState"), ppPipelineState, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5102,18 +5326,19 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandList(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandList");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandList");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
-        FieldToJson(args["type"], type, options);
-        FieldToJson(args["pCommandAllocator"], pCommandAllocator, options);
-        FieldToJson(args["pInitialState"], pInitialState, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppCommandList"], ppCommandList, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("nodeMask"), nodeMask, options);
+        FieldToJson(writer.Key("type"), type, options);
+        FieldToJson(writer.Key("pCommandAllocator"), pCommandAllocator, options);
+        FieldToJson(writer.Key("pInitialState"), pInitialState, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppCommandList"), ppCommandList, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5127,15 +5352,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateDescriptorHeap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateDescriptorHeap");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateDescriptorHeap");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDescriptorHeapDesc"], pDescriptorHeapDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        FieldToJson(writer.Key("pDescriptorHeapDesc"), pDescriptorHeapDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvHeap"), ppvHeap, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5147,13 +5373,14 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetDescriptorHandleIncrementSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetDescriptorHandleIncrementSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetDescriptorHandleIncrementSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["DescriptorHeapType"], DescriptorHeapType, options);
+        FieldToJson(writer.Key("DescriptorHeapType"), DescriptorHeapType, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5169,17 +5396,18 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateRootSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateRootSignature");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
-        FieldToJson(args["pBlobWithRootSignature"], pBlobWithRootSignature, options);
-        FieldToJson(args["blobLengthInBytes"], blobLengthInBytes, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvRootSignature"], ppvRootSignature, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("nodeMask"), nodeMask, options);
+        FieldToJson(writer.Key("pBlobWithRootSignature"), pBlobWithRootSignature, options);
+        FieldToJson(writer.Key("blobLengthInBytes"), blobLengthInBytes, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvRootSignature"), ppvRootSignature, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5191,13 +5419,14 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateConstantBufferView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateConstantBufferView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateConstantBufferView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("DestDescriptor"), DestDescriptor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5210,14 +5439,15 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateShaderResourceView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateShaderResourceView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateShaderResourceView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("DestDescriptor"), DestDescriptor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5231,15 +5461,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateUnorderedAccessView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateUnorderedAccessView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["pCounterResource"], pCounterResource, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("pCounterResource"), pCounterResource, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("DestDescriptor"), DestDescriptor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5252,14 +5483,15 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateRenderTargetView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateRenderTargetView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateRenderTargetView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("DestDescriptor"), DestDescriptor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5272,14 +5504,15 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateDepthStencilView(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateDepthStencilView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateDepthStencilView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("DestDescriptor"), DestDescriptor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5291,13 +5524,14 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateSampler(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateSampler");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateSampler");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("DestDescriptor"), DestDescriptor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5314,18 +5548,19 @@ void Dx12JsonConsumer::Process_ID3D12Device_CopyDescriptors(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptors");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptors");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumDestDescriptorRanges"], NumDestDescriptorRanges, options);
-        FieldToJson(args["pDestDescriptorRangeStarts"], pDestDescriptorRangeStarts, options);
-        FieldToJson(args["pDestDescriptorRangeSizes"], pDestDescriptorRangeSizes, options);
-        FieldToJson(args["NumSrcDescriptorRanges"], NumSrcDescriptorRanges, options);
-        FieldToJson(args["pSrcDescriptorRangeStarts"], pSrcDescriptorRangeStarts, options);
-        FieldToJson(args["pSrcDescriptorRangeSizes"], pSrcDescriptorRangeSizes, options);
-        FieldToJson(args["DescriptorHeapsType"], DescriptorHeapsType, options);
+        FieldToJson(writer.Key("NumDestDescriptorRanges"), NumDestDescriptorRanges, options);
+        FieldToJson(writer.Key("pDestDescriptorRangeStarts"), pDestDescriptorRangeStarts, options);
+        FieldToJson(writer.Key("pDestDescriptorRangeSizes"), pDestDescriptorRangeSizes, options);
+        FieldToJson(writer.Key("NumSrcDescriptorRanges"), NumSrcDescriptorRanges, options);
+        FieldToJson(writer.Key("pSrcDescriptorRangeStarts"), pSrcDescriptorRangeStarts, options);
+        FieldToJson(writer.Key("pSrcDescriptorRangeSizes"), pSrcDescriptorRangeSizes, options);
+        FieldToJson(writer.Key("DescriptorHeapsType"), DescriptorHeapsType, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5339,15 +5574,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_CopyDescriptorsSimple(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptorsSimple");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CopyDescriptorsSimple");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumDescriptors"], NumDescriptors, options);
-        FieldToJson(args["DestDescriptorRangeStart"], DestDescriptorRangeStart, options);
-        FieldToJson(args["SrcDescriptorRangeStart"], SrcDescriptorRangeStart, options);
-        FieldToJson(args["DescriptorHeapsType"], DescriptorHeapsType, options);
+        FieldToJson(writer.Key("NumDescriptors"), NumDescriptors, options);
+        FieldToJson(writer.Key("DestDescriptorRangeStart"), DestDescriptorRangeStart, options);
+        FieldToJson(writer.Key("SrcDescriptorRangeStart"), SrcDescriptorRangeStart, options);
+        FieldToJson(writer.Key("DescriptorHeapsType"), DescriptorHeapsType, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5361,15 +5597,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetResourceAllocationInfo(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceAllocationInfo");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceAllocationInfo");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
-        FieldToJson(args["numResourceDescs"], numResourceDescs, options);
-        FieldToJson(args["pResourceDescs"], pResourceDescs, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("visibleMask"), visibleMask, options);
+        FieldToJson(writer.Key("numResourceDescs"), numResourceDescs, options);
+        FieldToJson(writer.Key("pResourceDescs"), pResourceDescs, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5382,14 +5619,15 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetCustomHeapProperties(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetCustomHeapProperties");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetCustomHeapProperties");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
-        FieldToJson(args["heapType"], heapType, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("nodeMask"), nodeMask, options);
+        FieldToJson(writer.Key("heapType"), heapType, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5407,19 +5645,20 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommittedResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommittedResource");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommittedResource");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pHeapProperties"], pHeapProperties, options);
-        FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialResourceState"], InitialResourceState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["riidResource"], riidResource, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        FieldToJson(writer.Key("pHeapProperties"), pHeapProperties, options);
+        FieldToJson_D3D12_HEAP_FLAGS(writer.Key("HeapFlags"), HeapFlags, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson_D3D12_RESOURCE_STATES(writer.Key("InitialResourceState"), InitialResourceState, options);
+        FieldToJson(writer.Key("pOptimizedClearValue"), pOptimizedClearValue, options);
+        FieldToJson(writer.Key("riidResource"), riidResource, options);
+        FieldToJson(writer.Key("ppvResource"), ppvResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5433,15 +5672,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateHeap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateHeap");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateHeap");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvHeap"), ppvHeap, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5459,19 +5699,20 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreatePlacedResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreatePlacedResource");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreatePlacedResource");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pHeap"], pHeap, options);
-        FieldToJson(args["HeapOffset"], HeapOffset, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialState"], InitialState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        FieldToJson(writer.Key("pHeap"), pHeap, options);
+        FieldToJson(writer.Key("HeapOffset"), HeapOffset, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson_D3D12_RESOURCE_STATES(writer.Key("InitialState"), InitialState, options);
+        FieldToJson(writer.Key("pOptimizedClearValue"), pOptimizedClearValue, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvResource"), ppvResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5487,17 +5728,18 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateReservedResource(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateReservedResource");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateReservedResource");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialState"], InitialState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson_D3D12_RESOURCE_STATES(writer.Key("InitialState"), InitialState, options);
+        FieldToJson(writer.Key("pOptimizedClearValue"), pOptimizedClearValue, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvResource"), ppvResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5513,17 +5755,18 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateSharedHandle");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pObject"], pObject, options);
-        FieldToJson(args["pAttributes"], pAttributes, options);
-        FieldToJson(args["Access"], Access, options);
-        FieldToJson(args["Name"], Name, options);
-        FieldToJson(args["pHandle"], pHandle, options);
+        FieldToJson(writer.Key("pObject"), pObject, options);
+        FieldToJson(writer.Key("pAttributes"), pAttributes, options);
+        FieldToJson(writer.Key("Access"), Access, options);
+        FieldToJson(writer.Key("Name"), Name, options);
+        FieldToJson(writer.Key("pHandle"), pHandle, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5537,15 +5780,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_OpenSharedHandle(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandle");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandle");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NTHandle"], NTHandle, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvObj"], ppvObj, options);
+        FieldToJson(writer.Key("NTHandle"), NTHandle, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvObj"), ppvObj, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5559,15 +5803,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_OpenSharedHandleByName(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandleByName");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "OpenSharedHandleByName");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Name"], Name, options);
-        FieldToJson(args["Access"], Access, options);
-        FieldToJson(args["pNTHandle"], pNTHandle, options);
+        FieldToJson(writer.Key("Name"), Name, options);
+        FieldToJson(writer.Key("Access"), Access, options);
+        FieldToJson(writer.Key("pNTHandle"), pNTHandle, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5580,14 +5825,15 @@ void Dx12JsonConsumer::Process_ID3D12Device_MakeResident(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "MakeResident");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "MakeResident");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumObjects"], NumObjects, options);
-        FieldToJson(args["ppObjects"], ppObjects, options);
+        FieldToJson(writer.Key("NumObjects"), NumObjects, options);
+        FieldToJson(writer.Key("ppObjects"), ppObjects, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5600,14 +5846,15 @@ void Dx12JsonConsumer::Process_ID3D12Device_Evict(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "Evict");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "Evict");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumObjects"], NumObjects, options);
-        FieldToJson(args["ppObjects"], ppObjects, options);
+        FieldToJson(writer.Key("NumObjects"), NumObjects, options);
+        FieldToJson(writer.Key("ppObjects"), ppObjects, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5622,16 +5869,17 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateFence(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateFence");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateFence");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["InitialValue"], InitialValue, options);
-        FieldToJson_D3D12_FENCE_FLAGS(args["Flags"], Flags, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppFence"], ppFence, options);
+        FieldToJson(writer.Key("InitialValue"), InitialValue, options);
+        FieldToJson_D3D12_FENCE_FLAGS(writer.Key("Flags"), Flags, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppFence"), ppFence, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5642,9 +5890,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetDeviceRemovedReason(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetDeviceRemovedReason");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetDeviceRemovedReason");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -5662,19 +5910,20 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetCopyableFootprints(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetCopyableFootprints");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetCopyableFootprints");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResourceDesc"], pResourceDesc, options);
-        FieldToJson(args["FirstSubresource"], FirstSubresource, options);
-        FieldToJson(args["NumSubresources"], NumSubresources, options);
-        FieldToJson(args["BaseOffset"], BaseOffset, options);
-        FieldToJson(args["pLayouts"], pLayouts, options);
-        FieldToJson(args["pNumRows"], pNumRows, options);
-        FieldToJson(args["pRowSizeInBytes"], pRowSizeInBytes, options);
-        FieldToJson(args["pTotalBytes"], pTotalBytes, options);
+        FieldToJson(writer.Key("pResourceDesc"), pResourceDesc, options);
+        FieldToJson(writer.Key("FirstSubresource"), FirstSubresource, options);
+        FieldToJson(writer.Key("NumSubresources"), NumSubresources, options);
+        FieldToJson(writer.Key("BaseOffset"), BaseOffset, options);
+        FieldToJson(writer.Key("pLayouts"), pLayouts, options);
+        FieldToJson(writer.Key("pNumRows"), pNumRows, options);
+        FieldToJson(writer.Key("pRowSizeInBytes"), pRowSizeInBytes, options);
+        FieldToJson(writer.Key("pTotalBytes"), pTotalBytes, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5688,15 +5937,16 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateQueryHeap(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateQueryHeap");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateQueryHeap");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvHeap"), ppvHeap, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5708,13 +5958,14 @@ void Dx12JsonConsumer::Process_ID3D12Device_SetStablePowerState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "SetStablePowerState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "SetStablePowerState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        Bool32ToJson(writer.Key("Enable"), Enable, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5729,16 +5980,17 @@ void Dx12JsonConsumer::Process_ID3D12Device_CreateCommandSignature(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandSignature");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "CreateCommandSignature");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pRootSignature"], pRootSignature, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvCommandSignature"], ppvCommandSignature, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("pRootSignature"), pRootSignature, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvCommandSignature"), ppvCommandSignature, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5755,18 +6007,19 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetResourceTiling(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceTiling");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetResourceTiling");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pTiledResource"], pTiledResource, options);
-        FieldToJson(args["pNumTilesForEntireResource"], pNumTilesForEntireResource, options);
-        FieldToJson(args["pPackedMipDesc"], pPackedMipDesc, options);
-        FieldToJson(args["pStandardTileShapeForNonPackedMips"], pStandardTileShapeForNonPackedMips, options);
-        FieldToJson(args["pNumSubresourceTilings"], pNumSubresourceTilings, options);
-        FieldToJson(args["FirstSubresourceTilingToGet"], FirstSubresourceTilingToGet, options);
-        FieldToJson(args["pSubresourceTilingsForNonPackedMips"], pSubresourceTilingsForNonPackedMips, options);
+        FieldToJson(writer.Key("pTiledResource"), pTiledResource, options);
+        FieldToJson(writer.Key("pNumTilesForEntireResource"), pNumTilesForEntireResource, options);
+        FieldToJson(writer.Key("pPackedMipDesc"), pPackedMipDesc, options);
+        FieldToJson(writer.Key("pStandardTileShapeForNonPackedMips"), pStandardTileShapeForNonPackedMips, options);
+        FieldToJson(writer.Key("pNumSubresourceTilings"), pNumSubresourceTilings, options);
+        FieldToJson(writer.Key("FirstSubresourceTilingToGet"), FirstSubresourceTilingToGet, options);
+        FieldToJson(writer.Key("pSubresourceTilingsForNonPackedMips"), pSubresourceTilingsForNonPackedMips, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5777,9 +6030,9 @@ void Dx12JsonConsumer::Process_ID3D12Device_GetAdapterLuid(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetAdapterLuid");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device", object_id, "GetAdapterLuid");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -5792,14 +6045,15 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_StorePipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "StorePipeline");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "StorePipeline");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pName"], pName, options);
-        FieldToJson(args["pPipeline"], pPipeline, options);
+        FieldToJson(writer.Key("pName"), pName, options);
+        FieldToJson(writer.Key("pPipeline"), pPipeline, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5814,16 +6068,17 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_LoadGraphicsPipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadGraphicsPipeline");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadGraphicsPipeline");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pName"], pName, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        FieldToJson(writer.Key("pName"), pName, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppPipelineState"), ppPipelineState, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5838,16 +6093,17 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_LoadComputePipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadComputePipeline");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "LoadComputePipeline");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pName"], pName, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        FieldToJson(writer.Key("pName"), pName, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppPipelineState"), ppPipelineState, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5858,9 +6114,9 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_GetSerializedSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "GetSerializedSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "GetSerializedSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -5873,14 +6129,15 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary_Serialize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "Serialize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary", object_id, "Serialize");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSizeInBytes"], DataSizeInBytes, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("DataSizeInBytes"), DataSizeInBytes, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5895,16 +6152,17 @@ void Dx12JsonConsumer::Process_ID3D12PipelineLibrary1_LoadPipeline(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary1", object_id, "LoadPipeline");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12PipelineLibrary1", object_id, "LoadPipeline");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pName"], pName, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        FieldToJson(writer.Key("pName"), pName, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppPipelineState"), ppPipelineState, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5919,16 +6177,17 @@ void Dx12JsonConsumer::Process_ID3D12Device1_CreatePipelineLibrary(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "CreatePipelineLibrary");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "CreatePipelineLibrary");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pLibraryBlob"], pLibraryBlob, options);
-        FieldToJson(args["BlobLength"], BlobLength, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineLibrary"], ppPipelineLibrary, options);
+        FieldToJson(writer.Key("pLibraryBlob"), pLibraryBlob, options);
+        FieldToJson(writer.Key("BlobLength"), BlobLength, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppPipelineLibrary"), ppPipelineLibrary, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5944,17 +6203,18 @@ void Dx12JsonConsumer::Process_ID3D12Device1_SetEventOnMultipleFenceCompletion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "SetEventOnMultipleFenceCompletion");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "SetEventOnMultipleFenceCompletion");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ppFences"], ppFences, options);
-        FieldToJson(args["pFenceValues"], pFenceValues, options);
-        FieldToJson(args["NumFences"], NumFences, options);
-        FieldToJson_D3D12_MULTIPLE_FENCE_WAIT_FLAGS(args["Flags"], Flags, options);
-        FieldToJson(args["hEvent"], hEvent, options);
+        FieldToJson(writer.Key("ppFences"), ppFences, options);
+        FieldToJson(writer.Key("pFenceValues"), pFenceValues, options);
+        FieldToJson(writer.Key("NumFences"), NumFences, options);
+        FieldToJson_D3D12_MULTIPLE_FENCE_WAIT_FLAGS(writer.Key("Flags"), Flags, options);
+        FieldToJson(writer.Key("hEvent"), hEvent, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5968,15 +6228,16 @@ void Dx12JsonConsumer::Process_ID3D12Device1_SetResidencyPriority(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "SetResidencyPriority");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device1", object_id, "SetResidencyPriority");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumObjects"], NumObjects, options);
-        FieldToJson(args["ppObjects"], ppObjects, options);
-        FieldToJson(args["pPriorities"], pPriorities, options);
+        FieldToJson(writer.Key("NumObjects"), NumObjects, options);
+        FieldToJson(writer.Key("ppObjects"), ppObjects, options);
+        FieldToJson(writer.Key("pPriorities"), pPriorities, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -5990,15 +6251,16 @@ void Dx12JsonConsumer::Process_ID3D12Device2_CreatePipelineState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device2", object_id, "CreatePipelineState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device2", object_id, "CreatePipelineState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppPipelineState"], ppPipelineState, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppPipelineState"), ppPipelineState, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6012,15 +6274,16 @@ void Dx12JsonConsumer::Process_ID3D12Device3_OpenExistingHeapFromAddress(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromAddress");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromAddress");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pAddress"], pAddress, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        FieldToJson(writer.Key("pAddress"), pAddress, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvHeap"), ppvHeap, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6034,15 +6297,16 @@ void Dx12JsonConsumer::Process_ID3D12Device3_OpenExistingHeapFromFileMapping(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromFileMapping");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "OpenExistingHeapFromFileMapping");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["hFileMapping"], hFileMapping, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        FieldToJson(writer.Key("hFileMapping"), hFileMapping, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvHeap"), ppvHeap, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6058,17 +6322,18 @@ void Dx12JsonConsumer::Process_ID3D12Device3_EnqueueMakeResident(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "EnqueueMakeResident");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device3", object_id, "EnqueueMakeResident");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson_D3D12_RESIDENCY_FLAGS(args["Flags"], Flags, options);
-        FieldToJson(args["NumObjects"], NumObjects, options);
-        FieldToJson(args["ppObjects"], ppObjects, options);
-        FieldToJson(args["pFenceToSignal"], pFenceToSignal, options);
-        FieldToJson(args["FenceValueToSignal"], FenceValueToSignal, options);
+        FieldToJson_D3D12_RESIDENCY_FLAGS(writer.Key("Flags"), Flags, options);
+        FieldToJson(writer.Key("NumObjects"), NumObjects, options);
+        FieldToJson(writer.Key("ppObjects"), ppObjects, options);
+        FieldToJson(writer.Key("pFenceToSignal"), pFenceToSignal, options);
+        FieldToJson(writer.Key("FenceValueToSignal"), FenceValueToSignal, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6081,14 +6346,15 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedSession_GetStatusFence(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetStatusFence");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetStatusFence");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppFence"], ppFence, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppFence"), ppFence, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6099,9 +6365,9 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedSession_GetSessionStatus(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetSessionStatus");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedSession", object_id, "GetSessionStatus");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson_D3D12_PROTECTED_SESSION_STATUS(method[format::kNameReturn], return_value, options);
+    FieldToJson_D3D12_PROTECTED_SESSION_STATUS(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -6112,9 +6378,9 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedResourceSession_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedResourceSession", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedResourceSession", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -6130,17 +6396,18 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateCommandList1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommandList1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommandList1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["nodeMask"], nodeMask, options);
-        FieldToJson(args["type"], type, options);
-        FieldToJson_D3D12_COMMAND_LIST_FLAGS(args["flags"], flags, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppCommandList"], ppCommandList, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("nodeMask"), nodeMask, options);
+        FieldToJson(writer.Key("type"), type, options);
+        FieldToJson_D3D12_COMMAND_LIST_FLAGS(writer.Key("flags"), flags, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppCommandList"), ppCommandList, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6154,15 +6421,16 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateProtectedResourceSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateProtectedResourceSession");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppSession"], ppSession, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppSession"), ppSession, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6181,20 +6449,21 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateCommittedResource1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommittedResource1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateCommittedResource1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pHeapProperties"], pHeapProperties, options);
-        FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialResourceState"], InitialResourceState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["riidResource"], riidResource, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        FieldToJson(writer.Key("pHeapProperties"), pHeapProperties, options);
+        FieldToJson_D3D12_HEAP_FLAGS(writer.Key("HeapFlags"), HeapFlags, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson_D3D12_RESOURCE_STATES(writer.Key("InitialResourceState"), InitialResourceState, options);
+        FieldToJson(writer.Key("pOptimizedClearValue"), pOptimizedClearValue, options);
+        FieldToJson(writer.Key("pProtectedSession"), pProtectedSession, options);
+        FieldToJson(writer.Key("riidResource"), riidResource, options);
+        FieldToJson(writer.Key("ppvResource"), ppvResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6209,16 +6478,17 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateHeap1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateHeap1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateHeap1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvHeap"], ppvHeap, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("pProtectedSession"), pProtectedSession, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvHeap"), ppvHeap, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6235,18 +6505,19 @@ void Dx12JsonConsumer::Process_ID3D12Device4_CreateReservedResource1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateReservedResource1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "CreateReservedResource1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialState"], InitialState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson_D3D12_RESOURCE_STATES(writer.Key("InitialState"), InitialState, options);
+        FieldToJson(writer.Key("pOptimizedClearValue"), pOptimizedClearValue, options);
+        FieldToJson(writer.Key("pProtectedSession"), pProtectedSession, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvResource"), ppvResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6261,16 +6532,17 @@ void Dx12JsonConsumer::Process_ID3D12Device4_GetResourceAllocationInfo1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "GetResourceAllocationInfo1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device4", object_id, "GetResourceAllocationInfo1");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
-        FieldToJson(args["numResourceDescs"], numResourceDescs, options);
-        FieldToJson(args["pResourceDescs"], pResourceDescs, options);
-        FieldToJson(args["pResourceAllocationInfo1"], pResourceAllocationInfo1, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("visibleMask"), visibleMask, options);
+        FieldToJson(writer.Key("numResourceDescs"), numResourceDescs, options);
+        FieldToJson(writer.Key("pResourceDescs"), pResourceDescs, options);
+        FieldToJson(writer.Key("pResourceAllocationInfo1"), pResourceAllocationInfo1, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6281,12 +6553,13 @@ void Dx12JsonConsumer::Process_ID3D12LifetimeOwner_LifetimeStateUpdated(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12LifetimeOwner", object_id, "LifetimeStateUpdated");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12LifetimeOwner", object_id, "LifetimeStateUpdated");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NewState"], NewState, options);
+        FieldToJson(writer.Key("NewState"), NewState, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6297,9 +6570,9 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetLUID(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetLUID");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetLUID");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -6312,14 +6585,15 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetSwapChainObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetSwapChainObject");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetSwapChainObject");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppv"], ppv, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppv"), ppv, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6334,16 +6608,17 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_GetCurrentResourceAndCom
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetCurrentResourceAndCommandQueue");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "GetCurrentResourceAndCommandQueue");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riidResource"], riidResource, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
-        FieldToJson(args["riidQueue"], riidQueue, options);
-        FieldToJson(args["ppvQueue"], ppvQueue, options);
+        FieldToJson(writer.Key("riidResource"), riidResource, options);
+        FieldToJson(writer.Key("ppvResource"), ppvResource, options);
+        FieldToJson(writer.Key("riidQueue"), riidQueue, options);
+        FieldToJson(writer.Key("ppvQueue"), ppvQueue, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6354,9 +6629,9 @@ void Dx12JsonConsumer::Process_ID3D12SwapChainAssistant_InsertImplicitSync(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "InsertImplicitSync");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12SwapChainAssistant", object_id, "InsertImplicitSync");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -6368,13 +6643,14 @@ void Dx12JsonConsumer::Process_ID3D12LifetimeTracker_DestroyOwnedObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12LifetimeTracker", object_id, "DestroyOwnedObject");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12LifetimeTracker", object_id, "DestroyOwnedObject");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pObject"], pObject, options);
+        FieldToJson(writer.Key("pObject"), pObject, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6386,13 +6662,14 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetShaderIdentifier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderIdentifier");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderIdentifier");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pExportName"], pExportName, options);
+        FieldToJson(writer.Key("pExportName"), pExportName, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6404,13 +6681,14 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetShaderStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderStackSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetShaderStackSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pExportName"], pExportName, options);
+        FieldToJson(writer.Key("pExportName"), pExportName, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6421,9 +6699,9 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_GetPipelineStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetPipelineStackSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "GetPipelineStackSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -6434,12 +6712,13 @@ void Dx12JsonConsumer::Process_ID3D12StateObjectProperties_SetPipelineStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "SetPipelineStackSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12StateObjectProperties", object_id, "SetPipelineStackSize");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["PipelineStackSizeInBytes"], PipelineStackSizeInBytes, options);
+        FieldToJson(writer.Key("PipelineStackSizeInBytes"), PipelineStackSizeInBytes, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6453,15 +6732,16 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CreateLifetimeTracker(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateLifetimeTracker");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateLifetimeTracker");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pOwner"], pOwner, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvTracker"], ppvTracker, options);
+        FieldToJson(writer.Key("pOwner"), pOwner, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvTracker"), ppvTracker, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6471,7 +6751,7 @@ void Dx12JsonConsumer::Process_ID3D12Device5_RemoveDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "RemoveDevice");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "RemoveDevice");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -6485,14 +6765,15 @@ void Dx12JsonConsumer::Process_ID3D12Device5_EnumerateMetaCommands(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommands");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommands");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pNumMetaCommands"], pNumMetaCommands, options);
-        FieldToJson(args["pDescs"], pDescs, options);
+        FieldToJson(writer.Key("pNumMetaCommands"), pNumMetaCommands, options);
+        FieldToJson(writer.Key("pDescs"), pDescs, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6508,17 +6789,18 @@ void Dx12JsonConsumer::Process_ID3D12Device5_EnumerateMetaCommandParameters(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommandParameters");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "EnumerateMetaCommandParameters");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["CommandId"], CommandId, options);
-        FieldToJson(args["Stage"], Stage, options);
-        FieldToJson(args["pTotalStructureSizeInBytes"], pTotalStructureSizeInBytes, options);
-        FieldToJson(args["pParameterCount"], pParameterCount, options);
-        FieldToJson(args["pParameterDescs"], pParameterDescs, options);
+        FieldToJson(writer.Key("CommandId"), CommandId, options);
+        FieldToJson(writer.Key("Stage"), Stage, options);
+        FieldToJson(writer.Key("pTotalStructureSizeInBytes"), pTotalStructureSizeInBytes, options);
+        FieldToJson(writer.Key("pParameterCount"), pParameterCount, options);
+        FieldToJson(writer.Key("pParameterDescs"), pParameterDescs, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6535,18 +6817,19 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CreateMetaCommand(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateMetaCommand");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateMetaCommand");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["CommandId"], CommandId, options);
-        FieldToJsonAsFixedWidthBinary(args["NodeMask"], NodeMask, options);
-        FieldToJson(args["pCreationParametersData"], pCreationParametersData, options);
-        FieldToJson(args["CreationParametersDataSizeInBytes"], CreationParametersDataSizeInBytes, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppMetaCommand"], ppMetaCommand, options);
+        FieldToJson(writer.Key("CommandId"), CommandId, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("NodeMask"), NodeMask, options);
+        FieldToJson(writer.Key("pCreationParametersData"), pCreationParametersData, options);
+        FieldToJson(writer.Key("CreationParametersDataSizeInBytes"), CreationParametersDataSizeInBytes, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppMetaCommand"), ppMetaCommand, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6560,15 +6843,16 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CreateStateObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateStateObject");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CreateStateObject");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppStateObject"], ppStateObject, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppStateObject"), ppStateObject, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6580,13 +6864,14 @@ void Dx12JsonConsumer::Process_ID3D12Device5_GetRaytracingAccelerationStructureP
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "GetRaytracingAccelerationStructurePrebuildInfo");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "GetRaytracingAccelerationStructurePrebuildInfo");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["pInfo"], pInfo, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("pInfo"), pInfo, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6599,14 +6884,15 @@ void Dx12JsonConsumer::Process_ID3D12Device5_CheckDriverMatchingIdentifier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CheckDriverMatchingIdentifier");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device5", object_id, "CheckDriverMatchingIdentifier");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson_D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    FieldToJson_D3D12_DRIVER_MATCHING_IDENTIFIER_STATUS(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["SerializedDataType"], SerializedDataType, options);
-        FieldToJson(args["pIdentifierToCheck"], pIdentifierToCheck, options);
+        FieldToJson(writer.Key("SerializedDataType"), SerializedDataType, options);
+        FieldToJson(writer.Key("pIdentifierToCheck"), pIdentifierToCheck, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6617,12 +6903,13 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetAutoBr
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetAutoBreadcrumbsEnablement");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetAutoBreadcrumbsEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Enablement"], Enablement, options);
+        FieldToJson(writer.Key("Enablement"), Enablement, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6633,12 +6920,13 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetPageFa
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetPageFaultEnablement");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetPageFaultEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Enablement"], Enablement, options);
+        FieldToJson(writer.Key("Enablement"), Enablement, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6649,12 +6937,13 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings_SetWatson
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetWatsonDumpEnablement");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings", object_id, "SetWatsonDumpEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Enablement"], Enablement, options);
+        FieldToJson(writer.Key("Enablement"), Enablement, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6665,12 +6954,13 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings1_SetBread
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings1", object_id, "SetBreadcrumbContextEnablement");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings1", object_id, "SetBreadcrumbContextEnablement");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Enablement"], Enablement, options);
+        FieldToJson(writer.Key("Enablement"), Enablement, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6681,12 +6971,13 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedDataSettings2_UseMarke
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings2", object_id, "UseMarkersOnlyAutoBreadcrumbs");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedDataSettings2", object_id, "UseMarkersOnlyAutoBreadcrumbs");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["MarkersOnly"], MarkersOnly, options);
+        Bool32ToJson(writer.Key("MarkersOnly"), MarkersOnly, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6698,13 +6989,14 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData_GetAutoBreadcrumb
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetAutoBreadcrumbsOutput");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetAutoBreadcrumbsOutput");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pOutput"], pOutput, options);
+        FieldToJson(writer.Key("pOutput"), pOutput, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6716,13 +7008,14 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData_GetPageFaultAlloc
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetPageFaultAllocationOutput");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData", object_id, "GetPageFaultAllocationOutput");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pOutput"], pOutput, options);
+        FieldToJson(writer.Key("pOutput"), pOutput, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6734,13 +7027,14 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData1_GetAutoBreadcrum
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetAutoBreadcrumbsOutput1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetAutoBreadcrumbsOutput1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pOutput"], pOutput, options);
+        FieldToJson(writer.Key("pOutput"), pOutput, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6752,13 +7046,14 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData1_GetPageFaultAllo
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetPageFaultAllocationOutput1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData1", object_id, "GetPageFaultAllocationOutput1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pOutput"], pOutput, options);
+        FieldToJson(writer.Key("pOutput"), pOutput, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6770,13 +7065,14 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData2_GetPageFaultAllo
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetPageFaultAllocationOutput2");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetPageFaultAllocationOutput2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pOutput"], pOutput, options);
+        FieldToJson(writer.Key("pOutput"), pOutput, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6787,9 +7083,9 @@ void Dx12JsonConsumer::Process_ID3D12DeviceRemovedExtendedData2_GetDeviceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetDeviceState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceRemovedExtendedData2", object_id, "GetDeviceState");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -6804,16 +7100,17 @@ void Dx12JsonConsumer::Process_ID3D12Device6_SetBackgroundProcessingMode(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device6", object_id, "SetBackgroundProcessingMode");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device6", object_id, "SetBackgroundProcessingMode");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Mode"], Mode, options);
-        FieldToJson(args["MeasurementsAction"], MeasurementsAction, options);
-        FieldToJson(args["hEventToSignalUponCompletion"], hEventToSignalUponCompletion, options);
-        Bool32ToJson(args["pbFurtherMeasurementsDesired"], pbFurtherMeasurementsDesired, options);
+        FieldToJson(writer.Key("Mode"), Mode, options);
+        FieldToJson(writer.Key("MeasurementsAction"), MeasurementsAction, options);
+        FieldToJson(writer.Key("hEventToSignalUponCompletion"), hEventToSignalUponCompletion, options);
+        Bool32ToJson(writer.Key("pbFurtherMeasurementsDesired"), pbFurtherMeasurementsDesired, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6824,9 +7121,9 @@ void Dx12JsonConsumer::Process_ID3D12ProtectedResourceSession1_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedResourceSession1", object_id, "GetDesc1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12ProtectedResourceSession1", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -6841,16 +7138,17 @@ void Dx12JsonConsumer::Process_ID3D12Device7_AddToStateObject(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device7", object_id, "AddToStateObject");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device7", object_id, "AddToStateObject");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pAddition"], pAddition, options);
-        FieldToJson(args["pStateObjectToGrowFrom"], pStateObjectToGrowFrom, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppNewStateObject"], ppNewStateObject, options);
+        FieldToJson(writer.Key("pAddition"), pAddition, options);
+        FieldToJson(writer.Key("pStateObjectToGrowFrom"), pStateObjectToGrowFrom, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppNewStateObject"), ppNewStateObject, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6864,15 +7162,16 @@ void Dx12JsonConsumer::Process_ID3D12Device7_CreateProtectedResourceSession1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device7", object_id, "CreateProtectedResourceSession1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device7", object_id, "CreateProtectedResourceSession1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppSession"], ppSession, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppSession"), ppSession, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6887,16 +7186,17 @@ void Dx12JsonConsumer::Process_ID3D12Device8_GetResourceAllocationInfo2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "GetResourceAllocationInfo2");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "GetResourceAllocationInfo2");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
-        FieldToJson(args["numResourceDescs"], numResourceDescs, options);
-        FieldToJson(args["pResourceDescs"], pResourceDescs, options);
-        FieldToJson(args["pResourceAllocationInfo1"], pResourceAllocationInfo1, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("visibleMask"), visibleMask, options);
+        FieldToJson(writer.Key("numResourceDescs"), numResourceDescs, options);
+        FieldToJson(writer.Key("pResourceDescs"), pResourceDescs, options);
+        FieldToJson(writer.Key("pResourceAllocationInfo1"), pResourceAllocationInfo1, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6915,20 +7215,21 @@ void Dx12JsonConsumer::Process_ID3D12Device8_CreateCommittedResource2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreateCommittedResource2");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreateCommittedResource2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pHeapProperties"], pHeapProperties, options);
-        FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialResourceState"], InitialResourceState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["riidResource"], riidResource, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        FieldToJson(writer.Key("pHeapProperties"), pHeapProperties, options);
+        FieldToJson_D3D12_HEAP_FLAGS(writer.Key("HeapFlags"), HeapFlags, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson_D3D12_RESOURCE_STATES(writer.Key("InitialResourceState"), InitialResourceState, options);
+        FieldToJson(writer.Key("pOptimizedClearValue"), pOptimizedClearValue, options);
+        FieldToJson(writer.Key("pProtectedSession"), pProtectedSession, options);
+        FieldToJson(writer.Key("riidResource"), riidResource, options);
+        FieldToJson(writer.Key("ppvResource"), ppvResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6946,19 +7247,20 @@ void Dx12JsonConsumer::Process_ID3D12Device8_CreatePlacedResource1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreatePlacedResource1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreatePlacedResource1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pHeap"], pHeap, options);
-        FieldToJson(args["HeapOffset"], HeapOffset, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson_D3D12_RESOURCE_STATES(args["InitialState"], InitialState, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        FieldToJson(writer.Key("pHeap"), pHeap, options);
+        FieldToJson(writer.Key("HeapOffset"), HeapOffset, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson_D3D12_RESOURCE_STATES(writer.Key("InitialState"), InitialState, options);
+        FieldToJson(writer.Key("pOptimizedClearValue"), pOptimizedClearValue, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvResource"), ppvResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6971,14 +7273,15 @@ void Dx12JsonConsumer::Process_ID3D12Device8_CreateSamplerFeedbackUnorderedAcces
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreateSamplerFeedbackUnorderedAccessView");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "CreateSamplerFeedbackUnorderedAccessView");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pTargetedResource"], pTargetedResource, options);
-        FieldToJson(args["pFeedbackResource"], pFeedbackResource, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        FieldToJson(writer.Key("pTargetedResource"), pTargetedResource, options);
+        FieldToJson(writer.Key("pFeedbackResource"), pFeedbackResource, options);
+        FieldToJson(writer.Key("DestDescriptor"), DestDescriptor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -6996,19 +7299,20 @@ void Dx12JsonConsumer::Process_ID3D12Device8_GetCopyableFootprints1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "GetCopyableFootprints1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device8", object_id, "GetCopyableFootprints1");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResourceDesc"], pResourceDesc, options);
-        FieldToJson(args["FirstSubresource"], FirstSubresource, options);
-        FieldToJson(args["NumSubresources"], NumSubresources, options);
-        FieldToJson(args["BaseOffset"], BaseOffset, options);
-        FieldToJson(args["pLayouts"], pLayouts, options);
-        FieldToJson(args["pNumRows"], pNumRows, options);
-        FieldToJson(args["pRowSizeInBytes"], pRowSizeInBytes, options);
-        FieldToJson(args["pTotalBytes"], pTotalBytes, options);
+        FieldToJson(writer.Key("pResourceDesc"), pResourceDesc, options);
+        FieldToJson(writer.Key("FirstSubresource"), FirstSubresource, options);
+        FieldToJson(writer.Key("NumSubresources"), NumSubresources, options);
+        FieldToJson(writer.Key("BaseOffset"), BaseOffset, options);
+        FieldToJson(writer.Key("pLayouts"), pLayouts, options);
+        FieldToJson(writer.Key("pNumRows"), pNumRows, options);
+        FieldToJson(writer.Key("pRowSizeInBytes"), pRowSizeInBytes, options);
+        FieldToJson(writer.Key("pTotalBytes"), pTotalBytes, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7021,14 +7325,15 @@ void Dx12JsonConsumer::Process_ID3D12Resource1_GetProtectedResourceSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource1", object_id, "GetProtectedResourceSession");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Resource1", object_id, "GetProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppProtectedSession"], ppProtectedSession, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppProtectedSession"), ppProtectedSession, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7039,9 +7344,9 @@ void Dx12JsonConsumer::Process_ID3D12Resource2_GetDesc1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Resource2", object_id, "GetDesc1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Resource2", object_id, "GetDesc1");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -7054,14 +7359,15 @@ void Dx12JsonConsumer::Process_ID3D12Heap1_GetProtectedResourceSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Heap1", object_id, "GetProtectedResourceSession");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Heap1", object_id, "GetProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppProtectedSession"], ppProtectedSession, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppProtectedSession"), ppProtectedSession, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7072,12 +7378,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList3_SetProtectedResourceSe
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList3", object_id, "SetProtectedResourceSession");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList3", object_id, "SetProtectedResourceSession");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pProtectedResourceSession"], pProtectedResourceSession, options);
+        FieldToJson(writer.Key("pProtectedResourceSession"), pProtectedResourceSession, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7090,14 +7397,15 @@ void Dx12JsonConsumer::Process_ID3D12MetaCommand_GetRequiredParameterResourceSiz
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12MetaCommand", object_id, "GetRequiredParameterResourceSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12MetaCommand", object_id, "GetRequiredParameterResourceSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Stage"], Stage, options);
-        FieldToJson(args["ParameterIndex"], ParameterIndex, options);
+        FieldToJson(writer.Key("Stage"), Stage, options);
+        FieldToJson(writer.Key("ParameterIndex"), ParameterIndex, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7111,15 +7419,16 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_BeginRenderPass(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BeginRenderPass");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BeginRenderPass");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumRenderTargets"], NumRenderTargets, options);
-        FieldToJson(args["pRenderTargets"], pRenderTargets, options);
-        FieldToJson(args["pDepthStencil"], pDepthStencil, options);
-        FieldToJson_D3D12_RENDER_PASS_FLAGS(args["Flags"], Flags, options);
+        FieldToJson(writer.Key("NumRenderTargets"), NumRenderTargets, options);
+        FieldToJson(writer.Key("pRenderTargets"), pRenderTargets, options);
+        FieldToJson(writer.Key("pDepthStencil"), pDepthStencil, options);
+        FieldToJson_D3D12_RENDER_PASS_FLAGS(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7129,7 +7438,7 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_EndRenderPass(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EndRenderPass");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EndRenderPass");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -7143,14 +7452,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_InitializeMetaCommand(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "InitializeMetaCommand");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "InitializeMetaCommand");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pMetaCommand"], pMetaCommand, options);
-        FieldToJson(args["pInitializationParametersData"], pInitializationParametersData, options);
-        FieldToJson(args["InitializationParametersDataSizeInBytes"], InitializationParametersDataSizeInBytes, options);
+        FieldToJson(writer.Key("pMetaCommand"), pMetaCommand, options);
+        FieldToJson(writer.Key("pInitializationParametersData"), pInitializationParametersData, options);
+        FieldToJson(writer.Key("InitializationParametersDataSizeInBytes"), InitializationParametersDataSizeInBytes, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7163,14 +7473,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_ExecuteMetaCommand(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "ExecuteMetaCommand");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "ExecuteMetaCommand");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pMetaCommand"], pMetaCommand, options);
-        FieldToJson(args["pExecutionParametersData"], pExecutionParametersData, options);
-        FieldToJson(args["ExecutionParametersDataSizeInBytes"], ExecutionParametersDataSizeInBytes, options);
+        FieldToJson(writer.Key("pMetaCommand"), pMetaCommand, options);
+        FieldToJson(writer.Key("pExecutionParametersData"), pExecutionParametersData, options);
+        FieldToJson(writer.Key("ExecutionParametersDataSizeInBytes"), ExecutionParametersDataSizeInBytes, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7183,14 +7494,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_BuildRaytracingAcceler
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BuildRaytracingAccelerationStructure");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "BuildRaytracingAccelerationStructure");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["NumPostbuildInfoDescs"], NumPostbuildInfoDescs, options);
-        FieldToJson(args["pPostbuildInfoDescs"], pPostbuildInfoDescs, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("NumPostbuildInfoDescs"), NumPostbuildInfoDescs, options);
+        FieldToJson(writer.Key("pPostbuildInfoDescs"), pPostbuildInfoDescs, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7203,14 +7515,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_EmitRaytracingAccelera
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EmitRaytracingAccelerationStructurePostbuildInfo");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "EmitRaytracingAccelerationStructurePostbuildInfo");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["NumSourceAccelerationStructures"], NumSourceAccelerationStructures, options);
-        FieldToJsonAsHex(args["pSourceAccelerationStructureData"], pSourceAccelerationStructureData, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("NumSourceAccelerationStructures"), NumSourceAccelerationStructures, options);
+        FieldToJsonAsHex(writer.Key("pSourceAccelerationStructureData"), pSourceAccelerationStructureData, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7223,14 +7536,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_CopyRaytracingAccelera
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "CopyRaytracingAccelerationStructure");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "CopyRaytracingAccelerationStructure");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJsonAsHex(args["DestAccelerationStructureData"], DestAccelerationStructureData, options);
-        FieldToJsonAsHex(args["SourceAccelerationStructureData"], SourceAccelerationStructureData, options);
-        FieldToJson(args["Mode"], Mode, options);
+        FieldToJsonAsHex(writer.Key("DestAccelerationStructureData"), DestAccelerationStructureData, options);
+        FieldToJsonAsHex(writer.Key("SourceAccelerationStructureData"), SourceAccelerationStructureData, options);
+        FieldToJson(writer.Key("Mode"), Mode, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7241,12 +7555,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_SetPipelineState1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "SetPipelineState1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "SetPipelineState1");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pStateObject"], pStateObject, options);
+        FieldToJson(writer.Key("pStateObject"), pStateObject, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7257,12 +7572,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList4_DispatchRays(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "DispatchRays");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList4", object_id, "DispatchRays");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7277,16 +7593,17 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_FindValue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "FindValue");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "FindValue");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pKey"], pKey, options);
-        FieldToJson(args["KeySize"], KeySize, options);
-        FieldToJson(args["pValue"], pValue, options);
-        FieldToJson(args["pValueSize"], pValueSize, options);
+        FieldToJson(writer.Key("pKey"), pKey, options);
+        FieldToJson(writer.Key("KeySize"), KeySize, options);
+        FieldToJson(writer.Key("pValue"), pValue, options);
+        FieldToJson(writer.Key("pValueSize"), pValueSize, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7301,16 +7618,17 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_StoreValue(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "StoreValue");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "StoreValue");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pKey"], pKey, options);
-        FieldToJson(args["KeySize"], KeySize, options);
-        FieldToJson(args["pValue"], pValue, options);
-        FieldToJson(args["ValueSize"], ValueSize, options);
+        FieldToJson(writer.Key("pKey"), pKey, options);
+        FieldToJson(writer.Key("KeySize"), KeySize, options);
+        FieldToJson(writer.Key("pValue"), pValue, options);
+        FieldToJson(writer.Key("ValueSize"), ValueSize, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7320,7 +7638,7 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_SetDeleteOnDestroy(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "SetDeleteOnDestroy");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "SetDeleteOnDestroy");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -7332,9 +7650,9 @@ void Dx12JsonConsumer::Process_ID3D12ShaderCacheSession_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12ShaderCacheSession", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -7348,15 +7666,16 @@ void Dx12JsonConsumer::Process_ID3D12Device9_CreateShaderCacheSession(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "CreateShaderCacheSession");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "CreateShaderCacheSession");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvSession"], ppvSession, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvSession"), ppvSession, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7369,14 +7688,15 @@ void Dx12JsonConsumer::Process_ID3D12Device9_ShaderCacheControl(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "ShaderCacheControl");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "ShaderCacheControl");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson_D3D12_SHADER_CACHE_KIND_FLAGS(args["Kinds"], Kinds, options);
-        FieldToJson_D3D12_SHADER_CACHE_CONTROL_FLAGS(args["Control"], Control, options);
+        FieldToJson_D3D12_SHADER_CACHE_KIND_FLAGS(writer.Key("Kinds"), Kinds, options);
+        FieldToJson_D3D12_SHADER_CACHE_CONTROL_FLAGS(writer.Key("Control"), Control, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7391,16 +7711,17 @@ void Dx12JsonConsumer::Process_ID3D12Device9_CreateCommandQueue1(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "CreateCommandQueue1");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device9", object_id, "CreateCommandQueue1");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["CreatorID"], CreatorID, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppCommandQueue"], ppCommandQueue, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("CreatorID"), CreatorID, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppCommandQueue"), ppCommandQueue, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7421,22 +7742,23 @@ void Dx12JsonConsumer::Process_ID3D12Device10_CreateCommittedResource3(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreateCommittedResource3");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreateCommittedResource3");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pHeapProperties"], pHeapProperties, options);
-        FieldToJson_D3D12_HEAP_FLAGS(args["HeapFlags"], HeapFlags, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["InitialLayout"], InitialLayout, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["NumCastableFormats"], NumCastableFormats, options);
-        FieldToJson(args["pCastableFormats"], pCastableFormats, options);
-        FieldToJson(args["riidResource"], riidResource, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        FieldToJson(writer.Key("pHeapProperties"), pHeapProperties, options);
+        FieldToJson_D3D12_HEAP_FLAGS(writer.Key("HeapFlags"), HeapFlags, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("InitialLayout"), InitialLayout, options);
+        FieldToJson(writer.Key("pOptimizedClearValue"), pOptimizedClearValue, options);
+        FieldToJson(writer.Key("pProtectedSession"), pProtectedSession, options);
+        FieldToJson(writer.Key("NumCastableFormats"), NumCastableFormats, options);
+        FieldToJson(writer.Key("pCastableFormats"), pCastableFormats, options);
+        FieldToJson(writer.Key("riidResource"), riidResource, options);
+        FieldToJson(writer.Key("ppvResource"), ppvResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7456,21 +7778,22 @@ void Dx12JsonConsumer::Process_ID3D12Device10_CreatePlacedResource2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreatePlacedResource2");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreatePlacedResource2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pHeap"], pHeap, options);
-        FieldToJson(args["HeapOffset"], HeapOffset, options);
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["InitialLayout"], InitialLayout, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["NumCastableFormats"], NumCastableFormats, options);
-        FieldToJson(args["pCastableFormats"], pCastableFormats, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        FieldToJson(writer.Key("pHeap"), pHeap, options);
+        FieldToJson(writer.Key("HeapOffset"), HeapOffset, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("InitialLayout"), InitialLayout, options);
+        FieldToJson(writer.Key("pOptimizedClearValue"), pOptimizedClearValue, options);
+        FieldToJson(writer.Key("NumCastableFormats"), NumCastableFormats, options);
+        FieldToJson(writer.Key("pCastableFormats"), pCastableFormats, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvResource"), ppvResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7489,20 +7812,21 @@ void Dx12JsonConsumer::Process_ID3D12Device10_CreateReservedResource2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreateReservedResource2");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device10", object_id, "CreateReservedResource2");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["InitialLayout"], InitialLayout, options);
-        FieldToJson(args["pOptimizedClearValue"], pOptimizedClearValue, options);
-        FieldToJson(args["pProtectedSession"], pProtectedSession, options);
-        FieldToJson(args["NumCastableFormats"], NumCastableFormats, options);
-        FieldToJson(args["pCastableFormats"], pCastableFormats, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvResource"], ppvResource, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("InitialLayout"), InitialLayout, options);
+        FieldToJson(writer.Key("pOptimizedClearValue"), pOptimizedClearValue, options);
+        FieldToJson(writer.Key("pProtectedSession"), pProtectedSession, options);
+        FieldToJson(writer.Key("NumCastableFormats"), NumCastableFormats, options);
+        FieldToJson(writer.Key("pCastableFormats"), pCastableFormats, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvResource"), ppvResource, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7514,13 +7838,14 @@ void Dx12JsonConsumer::Process_ID3D12Device11_CreateSampler2(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device11", object_id, "CreateSampler2");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device11", object_id, "CreateSampler2");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["DestDescriptor"], DestDescriptor, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("DestDescriptor"), DestDescriptor, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7537,18 +7862,19 @@ void Dx12JsonConsumer::Process_ID3D12Device12_GetResourceAllocationInfo3(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Device12", object_id, "GetResourceAllocationInfo3");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Device12", object_id, "GetResourceAllocationInfo3");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJsonAsFixedWidthBinary(args["visibleMask"], visibleMask, options);
-        FieldToJson(args["numResourceDescs"], numResourceDescs, options);
-        FieldToJson(args["pResourceDescs"], pResourceDescs, options);
-        FieldToJson(args["pNumCastableFormats"], pNumCastableFormats, options);
-        FieldToJson(args["ppCastableFormats"], ppCastableFormats, options);
-        FieldToJson(args["pResourceAllocationInfo1"], pResourceAllocationInfo1, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("visibleMask"), visibleMask, options);
+        FieldToJson(writer.Key("numResourceDescs"), numResourceDescs, options);
+        FieldToJson(writer.Key("pResourceDescs"), pResourceDescs, options);
+        FieldToJson(writer.Key("pNumCastableFormats"), pNumCastableFormats, options);
+        FieldToJson(writer.Key("ppCastableFormats"), ppCastableFormats, options);
+        FieldToJson(writer.Key("pResourceAllocationInfo1"), pResourceAllocationInfo1, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7561,14 +7887,15 @@ void Dx12JsonConsumer::Process_ID3D12VirtualizationGuestDevice_ShareWithHost(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "ShareWithHost");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "ShareWithHost");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pObject"], pObject, options);
-        FieldToJson(args["pHandle"], pHandle, options);
+        FieldToJson(writer.Key("pObject"), pObject, options);
+        FieldToJson(writer.Key("pHandle"), pHandle, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7582,15 +7909,16 @@ void Dx12JsonConsumer::Process_ID3D12VirtualizationGuestDevice_CreateFenceFd(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "CreateFenceFd");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12VirtualizationGuestDevice", object_id, "CreateFenceFd");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFence"], pFence, options);
-        FieldToJson(args["FenceValue"], FenceValue, options);
-        FieldToJson(args["pFenceFd"], pFenceFd, options);
+        FieldToJson(writer.Key("pFence"), pFence, options);
+        FieldToJson(writer.Key("FenceValue"), FenceValue, options);
+        FieldToJson(writer.Key("pFenceFd"), pFenceFd, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7601,12 +7929,13 @@ void Dx12JsonConsumer::Process_ID3D12Tools_EnableShaderInstrumentation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Tools", object_id, "EnableShaderInstrumentation");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Tools", object_id, "EnableShaderInstrumentation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["bEnable"], bEnable, options);
+        Bool32ToJson(writer.Key("bEnable"), bEnable, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7617,9 +7946,9 @@ void Dx12JsonConsumer::Process_ID3D12Tools_ShaderInstrumentationEnabled(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Tools", object_id, "ShaderInstrumentationEnabled");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Tools", object_id, "ShaderInstrumentationEnabled");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -7632,14 +7961,15 @@ void Dx12JsonConsumer::Process_ID3D12SDKConfiguration_SetSDKVersion(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration", object_id, "SetSDKVersion");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration", object_id, "SetSDKVersion");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["SDKVersion"], SDKVersion, options);
-        FieldToJson(args["SDKPath"], SDKPath, options);
+        FieldToJson(writer.Key("SDKVersion"), SDKVersion, options);
+        FieldToJson(writer.Key("SDKPath"), SDKPath, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7654,16 +7984,17 @@ void Dx12JsonConsumer::Process_ID3D12SDKConfiguration1_CreateDeviceFactory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "CreateDeviceFactory");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "CreateDeviceFactory");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["SDKVersion"], SDKVersion, options);
-        FieldToJson(args["SDKPath"], SDKPath, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvFactory"], ppvFactory, options);
+        FieldToJson(writer.Key("SDKVersion"), SDKVersion, options);
+        FieldToJson(writer.Key("SDKPath"), SDKPath, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvFactory"), ppvFactory, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7673,7 +8004,7 @@ void Dx12JsonConsumer::Process_ID3D12SDKConfiguration1_FreeUnusedSDKs(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "FreeUnusedSDKs");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12SDKConfiguration1", object_id, "FreeUnusedSDKs");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -7685,9 +8016,9 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_InitializeFromGlobalState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "InitializeFromGlobalState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "InitializeFromGlobalState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -7698,9 +8029,9 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_ApplyToGlobalState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "ApplyToGlobalState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "ApplyToGlobalState");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -7712,13 +8043,14 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_SetFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "SetFlags");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "SetFlags");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(args["flags"], flags, options);
+        FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(writer.Key("flags"), flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7729,9 +8061,9 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_GetFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetFlags");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetFlags");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(method[format::kNameReturn], return_value, options);
+    FieldToJson_D3D12_DEVICE_FACTORY_FLAGS(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -7745,15 +8077,16 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_GetConfigurationInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetConfigurationInterface");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "GetConfigurationInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["clsid"], clsid, options);
-        FieldToJson(args["iid"], iid, options);
-        FieldToJson(args["ppv"], ppv, options);
+        FieldToJson(writer.Key("clsid"), clsid, options);
+        FieldToJson(writer.Key("iid"), iid, options);
+        FieldToJson(writer.Key("ppv"), ppv, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7768,16 +8101,17 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_EnableExperimentalFeatures(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "EnableExperimentalFeatures");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "EnableExperimentalFeatures");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumFeatures"], NumFeatures, options);
-        FieldToJson(args["pIIDs"], pIIDs, options);
-        FieldToJson(args["pConfigurationStructs"], pConfigurationStructs, options);
-        FieldToJson(args["pConfigurationStructSizes"], pConfigurationStructSizes, options);
+        FieldToJson(writer.Key("NumFeatures"), NumFeatures, options);
+        FieldToJson(writer.Key("pIIDs"), pIIDs, options);
+        FieldToJson(writer.Key("pConfigurationStructs"), pConfigurationStructs, options);
+        FieldToJson(writer.Key("pConfigurationStructSizes"), pConfigurationStructSizes, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7792,16 +8126,17 @@ void Dx12JsonConsumer::Process_ID3D12DeviceFactory_CreateDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "CreateDevice");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceFactory", object_id, "CreateDevice");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["adapter"], adapter, options);
-        FieldToJson(args["FeatureLevel"], FeatureLevel, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDevice"], ppvDevice, options);
+        FieldToJson(writer.Key("adapter"), adapter, options);
+        FieldToJson(writer.Key("FeatureLevel"), FeatureLevel, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvDevice"), ppvDevice, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7812,9 +8147,9 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_GetDesc(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetDesc");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetDesc");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -7827,14 +8162,15 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_GetEnabledExperimentalF
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetEnabledExperimentalFeatures");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "GetEnabledExperimentalFeatures");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pGuids"], pGuids, options);
-        FieldToJson(args["NumGuids"], NumGuids, options);
+        FieldToJson(writer.Key("pGuids"), pGuids, options);
+        FieldToJson(writer.Key("NumGuids"), NumGuids, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7848,15 +8184,16 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_SerializeVersionedRootS
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "SerializeVersionedRootSignature");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "SerializeVersionedRootSignature");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pDesc"], pDesc, options);
-        FieldToJson(args["ppResult"], ppResult, options);
-        FieldToJson(args["ppError"], ppError, options);
+        FieldToJson(writer.Key("pDesc"), pDesc, options);
+        FieldToJson(writer.Key("ppResult"), ppResult, options);
+        FieldToJson(writer.Key("ppError"), ppError, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7871,16 +8208,17 @@ void Dx12JsonConsumer::Process_ID3D12DeviceConfiguration_CreateVersionedRootSign
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "CreateVersionedRootSignatureDeserializer");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DeviceConfiguration", object_id, "CreateVersionedRootSignatureDeserializer");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pBlob"], pBlob, options);
-        FieldToJson(args["Size"], Size, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDeserializer"], ppvDeserializer, options);
+        FieldToJson(writer.Key("pBlob"), pBlob, options);
+        FieldToJson(writer.Key("Size"), Size, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvDeserializer"), ppvDeserializer, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7892,13 +8230,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList5_RSSetShadingRate(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRate");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRate");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["baseShadingRate"], baseShadingRate, options);
-        FieldToJson(args["combiners"], combiners, options);
+        FieldToJson(writer.Key("baseShadingRate"), baseShadingRate, options);
+        FieldToJson(writer.Key("combiners"), combiners, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7909,12 +8248,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList5_RSSetShadingRateImage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRateImage");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList5", object_id, "RSSetShadingRateImage");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["shadingRateImage"], shadingRateImage, options);
+        FieldToJson(writer.Key("shadingRateImage"), shadingRateImage, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7927,14 +8267,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList6_DispatchMesh(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList6", object_id, "DispatchMesh");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList6", object_id, "DispatchMesh");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ThreadGroupCountX"], ThreadGroupCountX, options);
-        FieldToJson(args["ThreadGroupCountY"], ThreadGroupCountY, options);
-        FieldToJson(args["ThreadGroupCountZ"], ThreadGroupCountZ, options);
+        FieldToJson(writer.Key("ThreadGroupCountX"), ThreadGroupCountX, options);
+        FieldToJson(writer.Key("ThreadGroupCountY"), ThreadGroupCountY, options);
+        FieldToJson(writer.Key("ThreadGroupCountZ"), ThreadGroupCountZ, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7946,13 +8287,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList7_Barrier(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList7", object_id, "Barrier");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList7", object_id, "Barrier");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["NumBarrierGroups"], NumBarrierGroups, options);
-        FieldToJson(args["pBarrierGroups"], pBarrierGroups, options);
+        FieldToJson(writer.Key("NumBarrierGroups"), NumBarrierGroups, options);
+        FieldToJson(writer.Key("pBarrierGroups"), pBarrierGroups, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7964,13 +8306,14 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList8_OMSetFrontAndBackStenc
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList8", object_id, "OMSetFrontAndBackStencilRef");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList8", object_id, "OMSetFrontAndBackStencilRef");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["FrontStencilRef"], FrontStencilRef, options);
-        FieldToJson(args["BackStencilRef"], BackStencilRef, options);
+        FieldToJson(writer.Key("FrontStencilRef"), FrontStencilRef, options);
+        FieldToJson(writer.Key("BackStencilRef"), BackStencilRef, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -7983,14 +8326,15 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList9_RSSetDepthBias(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "RSSetDepthBias");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "RSSetDepthBias");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["DepthBias"], DepthBias, options);
-        FieldToJson(args["DepthBiasClamp"], DepthBiasClamp, options);
-        FieldToJson(args["SlopeScaledDepthBias"], SlopeScaledDepthBias, options);
+        FieldToJson(writer.Key("DepthBias"), DepthBias, options);
+        FieldToJson(writer.Key("DepthBiasClamp"), DepthBiasClamp, options);
+        FieldToJson(writer.Key("SlopeScaledDepthBias"), SlopeScaledDepthBias, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8001,12 +8345,13 @@ void Dx12JsonConsumer::Process_ID3D12GraphicsCommandList9_IASetIndexBufferStripC
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "IASetIndexBufferStripCutValue");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12GraphicsCommandList9", object_id, "IASetIndexBufferStripCutValue");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["IBStripCutValue"], IBStripCutValue, options);
+        FieldToJson(writer.Key("IBStripCutValue"), IBStripCutValue, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8021,16 +8366,17 @@ void Dx12JsonConsumer::Process_ID3D12DSRDeviceFactory_CreateDSRDevice(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DSRDeviceFactory", object_id, "CreateDSRDevice");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DSRDeviceFactory", object_id, "CreateDSRDevice");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pD3D12Device"], pD3D12Device, options);
-        FieldToJsonAsFixedWidthBinary(args["NodeMask"], NodeMask, options);
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvDSRDevice"], ppvDSRDevice, options);
+        FieldToJson(writer.Key("pD3D12Device"), pD3D12Device, options);
+        FieldToJsonAsFixedWidthBinary(writer.Key("NodeMask"), NodeMask, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvDSRDevice"), ppvDSRDevice, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8045,9 +8391,9 @@ void Dx12JsonConsumer::Process_ID3D10Blob_GetBufferPointer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferPointer");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferPointer");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8058,9 +8404,9 @@ void Dx12JsonConsumer::Process_ID3D10Blob_GetBufferSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D10Blob", object_id, "GetBufferSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8074,15 +8420,16 @@ void Dx12JsonConsumer::Process_ID3DDestructionNotifier_RegisterDestructionCallba
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "RegisterDestructionCallback");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "RegisterDestructionCallback");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["callbackFn"], callbackFn, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["pCallbackID"], pCallbackID, options);
+        FieldToJson(writer.Key("callbackFn"), callbackFn, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("pCallbackID"), pCallbackID, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8094,13 +8441,14 @@ void Dx12JsonConsumer::Process_ID3DDestructionNotifier_UnregisterDestructionCall
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "UnregisterDestructionCallback");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3DDestructionNotifier", object_id, "UnregisterDestructionCallback");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["callbackID"], callbackID, options);
+        FieldToJson(writer.Key("callbackID"), callbackID, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8114,7 +8462,7 @@ void Dx12JsonConsumer::Process_ID3D12Debug_EnableDebugLayer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug", object_id, "EnableDebugLayer");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Debug", object_id, "EnableDebugLayer");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -8125,7 +8473,7 @@ void Dx12JsonConsumer::Process_ID3D12Debug1_EnableDebugLayer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "EnableDebugLayer");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "EnableDebugLayer");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -8137,12 +8485,13 @@ void Dx12JsonConsumer::Process_ID3D12Debug1_SetEnableGPUBasedValidation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableGPUBasedValidation");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableGPUBasedValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        Bool32ToJson(writer.Key("Enable"), Enable, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8153,12 +8502,13 @@ void Dx12JsonConsumer::Process_ID3D12Debug1_SetEnableSynchronizedCommandQueueVal
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableSynchronizedCommandQueueValidation");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Debug1", object_id, "SetEnableSynchronizedCommandQueueValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        Bool32ToJson(writer.Key("Enable"), Enable, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8169,12 +8519,13 @@ void Dx12JsonConsumer::Process_ID3D12Debug2_SetGPUBasedValidationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug2", object_id, "SetGPUBasedValidationFlags");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Debug2", object_id, "SetGPUBasedValidationFlags");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(args["Flags"], Flags, options);
+        FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8185,12 +8536,13 @@ void Dx12JsonConsumer::Process_ID3D12Debug3_SetEnableGPUBasedValidation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableGPUBasedValidation");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableGPUBasedValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        Bool32ToJson(writer.Key("Enable"), Enable, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8201,12 +8553,13 @@ void Dx12JsonConsumer::Process_ID3D12Debug3_SetEnableSynchronizedCommandQueueVal
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableSynchronizedCommandQueueValidation");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetEnableSynchronizedCommandQueueValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        Bool32ToJson(writer.Key("Enable"), Enable, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8217,12 +8570,13 @@ void Dx12JsonConsumer::Process_ID3D12Debug3_SetGPUBasedValidationFlags(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetGPUBasedValidationFlags");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Debug3", object_id, "SetGPUBasedValidationFlags");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(args["Flags"], Flags, options);
+        FieldToJson_D3D12_GPU_BASED_VALIDATION_FLAGS(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8232,7 +8586,7 @@ void Dx12JsonConsumer::Process_ID3D12Debug4_DisableDebugLayer(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug4", object_id, "DisableDebugLayer");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Debug4", object_id, "DisableDebugLayer");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -8244,12 +8598,13 @@ void Dx12JsonConsumer::Process_ID3D12Debug5_SetEnableAutoName(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug5", object_id, "SetEnableAutoName");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Debug5", object_id, "SetEnableAutoName");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        Bool32ToJson(writer.Key("Enable"), Enable, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8260,12 +8615,13 @@ void Dx12JsonConsumer::Process_ID3D12Debug6_SetForceLegacyBarrierValidation(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12Debug6", object_id, "SetForceLegacyBarrierValidation");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12Debug6", object_id, "SetForceLegacyBarrierValidation");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["Enable"], Enable, options);
+        Bool32ToJson(writer.Key("Enable"), Enable, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8279,15 +8635,16 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice1_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "SetDebugParameter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("DataSize"), DataSize, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8301,15 +8658,16 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice1_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "GetDebugParameter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("DataSize"), DataSize, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8321,13 +8679,14 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice1_ReportLiveDeviceObjects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "ReportLiveDeviceObjects");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice1", object_id, "ReportLiveDeviceObjects");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson_D3D12_RLDO_FLAGS(args["Flags"], Flags, options);
+        FieldToJson_D3D12_RLDO_FLAGS(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8339,13 +8698,14 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice_SetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "SetFeatureMask");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "SetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Mask"], Mask, options);
+        FieldToJson(writer.Key("Mask"), Mask, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8356,9 +8716,9 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice_GetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "GetFeatureMask");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "GetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8370,13 +8730,14 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice_ReportLiveDeviceObjects(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "ReportLiveDeviceObjects");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice", object_id, "ReportLiveDeviceObjects");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson_D3D12_RLDO_FLAGS(args["Flags"], Flags, options);
+        FieldToJson_D3D12_RLDO_FLAGS(writer.Key("Flags"), Flags, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8390,15 +8751,16 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice2_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "SetDebugParameter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("DataSize"), DataSize, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8412,15 +8774,16 @@ void Dx12JsonConsumer::Process_ID3D12DebugDevice2_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "GetDebugParameter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugDevice2", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("DataSize"), DataSize, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8434,15 +8797,16 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue_AssertResourceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue", object_id, "AssertResourceState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue", object_id, "AssertResourceState");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["State"], State, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("Subresource"), Subresource, options);
+        FieldToJson(writer.Key("State"), State, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8455,14 +8819,15 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue1_AssertResourceAccess(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertResourceAccess");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertResourceAccess");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["Access"], Access, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("Subresource"), Subresource, options);
+        FieldToJson(writer.Key("Access"), Access, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8475,14 +8840,15 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandQueue1_AssertTextureLayout(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertTextureLayout");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandQueue1", object_id, "AssertTextureLayout");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["Layout"], Layout, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("Subresource"), Subresource, options);
+        FieldToJson(writer.Key("Layout"), Layout, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8496,15 +8862,16 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_AssertResourceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "AssertResourceState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "AssertResourceState");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["State"], State, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("Subresource"), Subresource, options);
+        FieldToJson(writer.Key("State"), State, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8518,15 +8885,16 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "SetDebugParameter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("DataSize"), DataSize, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8540,15 +8908,16 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList1_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "GetDebugParameter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList1", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("DataSize"), DataSize, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8562,15 +8931,16 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList_AssertResourceState(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "AssertResourceState");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "AssertResourceState");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["State"], State, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("Subresource"), Subresource, options);
+        FieldToJson(writer.Key("State"), State, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8582,13 +8952,14 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList_SetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "SetFeatureMask");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "SetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Mask"], Mask, options);
+        FieldToJson(writer.Key("Mask"), Mask, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8599,9 +8970,9 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList_GetFeatureMask(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "GetFeatureMask");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList", object_id, "GetFeatureMask");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8615,15 +8986,16 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList2_SetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "SetDebugParameter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "SetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("DataSize"), DataSize, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8637,15 +9009,16 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList2_GetDebugParameter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "GetDebugParameter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList2", object_id, "GetDebugParameter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Type"], Type, options);
-        FieldToJson(args["pData"], pData, options);
-        FieldToJson(args["DataSize"], DataSize, options);
+        FieldToJson(writer.Key("Type"), Type, options);
+        FieldToJson(writer.Key("pData"), pData, options);
+        FieldToJson(writer.Key("DataSize"), DataSize, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8658,14 +9031,15 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList3_AssertResourceAccess(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertResourceAccess");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertResourceAccess");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["Access"], Access, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("Subresource"), Subresource, options);
+        FieldToJson(writer.Key("Access"), Access, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8678,14 +9052,15 @@ void Dx12JsonConsumer::Process_ID3D12DebugCommandList3_AssertTextureLayout(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertTextureLayout");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12DebugCommandList3", object_id, "AssertTextureLayout");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["Layout"], Layout, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("Subresource"), Subresource, options);
+        FieldToJson(writer.Key("Layout"), Layout, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8698,14 +9073,15 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_Present(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "Present");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "Present");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pResource"], pResource, options);
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["window"], window, options);
+        FieldToJson(writer.Key("pResource"), pResource, options);
+        FieldToJson(writer.Key("Subresource"), Subresource, options);
+        FieldToJson(writer.Key("window"), window, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8717,13 +9093,14 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_SharedFenceSignal(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "SharedFenceSignal");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "SharedFenceSignal");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFence"], pFence, options);
-        FieldToJson(args["FenceValue"], FenceValue, options);
+        FieldToJson(writer.Key("pFence"), pFence, options);
+        FieldToJson(writer.Key("FenceValue"), FenceValue, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8734,12 +9111,13 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_BeginCapturableWork(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "BeginCapturableWork");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "BeginCapturableWork");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["guid"], guid, options);
+        FieldToJson(writer.Key("guid"), guid, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8750,12 +9128,13 @@ void Dx12JsonConsumer::Process_ID3D12SharingContract_EndCapturableWork(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "EndCapturableWork");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12SharingContract", object_id, "EndCapturableWork");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["guid"], guid, options);
+        FieldToJson(writer.Key("guid"), guid, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8767,13 +9146,14 @@ void Dx12JsonConsumer::Process_ID3D12ManualWriteTrackingResource_TrackWrite(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12ManualWriteTrackingResource", object_id, "TrackWrite");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12ManualWriteTrackingResource", object_id, "TrackWrite");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Subresource"], Subresource, options);
-        FieldToJson(args["pWrittenRange"], pWrittenRange, options);
+        FieldToJson(writer.Key("Subresource"), Subresource, options);
+        FieldToJson(writer.Key("pWrittenRange"), pWrittenRange, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8785,13 +9165,14 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetMessageCountLimit(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMessageCountLimit");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMessageCountLimit");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["MessageCountLimit"], MessageCountLimit, options);
+        FieldToJson(writer.Key("MessageCountLimit"), MessageCountLimit, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8801,7 +9182,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearStoredMessages(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStoredMessages");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStoredMessages");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -8816,15 +9197,16 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMessage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessage");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessage");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["MessageIndex"], MessageIndex, options);
-        FieldToJson(args["pMessage"], pMessage, options);
-        FieldToJson(args["pMessageByteLength"], pMessageByteLength, options);
+        FieldToJson(writer.Key("MessageIndex"), MessageIndex, options);
+        FieldToJson(writer.Key("pMessage"), pMessage, options);
+        FieldToJson(writer.Key("pMessageByteLength"), pMessageByteLength, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8835,9 +9217,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesAllowedByStorageFil
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesAllowedByStorageFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesAllowedByStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8848,9 +9230,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesDeniedByStorageFilt
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDeniedByStorageFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDeniedByStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8861,9 +9243,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumStoredMessages(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessages");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessages");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8874,9 +9256,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumStoredMessagesAllowedByRetr
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessagesAllowedByRetrievalFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumStoredMessagesAllowedByRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8887,9 +9269,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetNumMessagesDiscardedByMessageC
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDiscardedByMessageCountLimit");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetNumMessagesDiscardedByMessageCountLimit");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8900,9 +9282,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMessageCountLimit(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessageCountLimit");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMessageCountLimit");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8914,13 +9296,14 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddStorageFilterEntries(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddStorageFilterEntries");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddStorageFilterEntries");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
+        FieldToJson(writer.Key("pFilter"), pFilter, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8933,14 +9316,15 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
-        FieldToJson(args["pFilterByteLength"], pFilterByteLength, options);
+        FieldToJson(writer.Key("pFilter"), pFilter, options);
+        FieldToJson(writer.Key("pFilterByteLength"), pFilterByteLength, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -8950,7 +9334,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStorageFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -8962,9 +9346,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushEmptyStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyStorageFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8975,9 +9359,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushCopyOfStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfStorageFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -8989,13 +9373,14 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushStorageFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
+        FieldToJson(writer.Key("pFilter"), pFilter, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9005,7 +9390,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PopStorageFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopStorageFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopStorageFilter");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -9017,9 +9402,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetStorageFilterStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilterStackSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetStorageFilterStackSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -9031,13 +9416,14 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddRetrievalFilterEntries(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddRetrievalFilterEntries");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddRetrievalFilterEntries");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
+        FieldToJson(writer.Key("pFilter"), pFilter, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9050,14 +9436,15 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
-        FieldToJson(args["pFilterByteLength"], pFilterByteLength, options);
+        FieldToJson(writer.Key("pFilter"), pFilter, options);
+        FieldToJson(writer.Key("pFilterByteLength"), pFilterByteLength, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9067,7 +9454,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_ClearRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearRetrievalFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "ClearRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -9079,9 +9466,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushEmptyRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyRetrievalFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushEmptyRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -9092,9 +9479,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushCopyOfRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfRetrievalFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushCopyOfRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -9106,13 +9493,14 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PushRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushRetrievalFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PushRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["pFilter"], pFilter, options);
+        FieldToJson(writer.Key("pFilter"), pFilter, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9122,7 +9510,7 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_PopRetrievalFilter(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopRetrievalFilter");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "PopRetrievalFilter");
     const JsonOptions& options = writer_->GetOptions();
     writer_->WriteBlockEnd();
 }
@@ -9134,9 +9522,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetRetrievalFilterStackSize(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilterStackSize");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetRetrievalFilterStackSize");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -9151,16 +9539,17 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddMessage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddMessage");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddMessage");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Category"], Category, options);
-        FieldToJson(args["Severity"], Severity, options);
-        FieldToJson(args["ID"], ID, options);
-        FieldToJson(args["pDescription"], pDescription, options);
+        FieldToJson(writer.Key("Category"), Category, options);
+        FieldToJson(writer.Key("Severity"), Severity, options);
+        FieldToJson(writer.Key("ID"), ID, options);
+        FieldToJson(writer.Key("pDescription"), pDescription, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9173,14 +9562,15 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_AddApplicationMessage(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddApplicationMessage");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "AddApplicationMessage");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Severity"], Severity, options);
-        FieldToJson(args["pDescription"], pDescription, options);
+        FieldToJson(writer.Key("Severity"), Severity, options);
+        FieldToJson(writer.Key("pDescription"), pDescription, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9193,14 +9583,15 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnCategory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnCategory");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnCategory");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Category"], Category, options);
-        Bool32ToJson(args["bEnable"], bEnable, options);
+        FieldToJson(writer.Key("Category"), Category, options);
+        Bool32ToJson(writer.Key("bEnable"), bEnable, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9213,14 +9604,15 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnSeverity(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnSeverity");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnSeverity");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Severity"], Severity, options);
-        Bool32ToJson(args["bEnable"], bEnable, options);
+        FieldToJson(writer.Key("Severity"), Severity, options);
+        Bool32ToJson(writer.Key("bEnable"), bEnable, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9233,14 +9625,15 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetBreakOnID(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnID");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetBreakOnID");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ID"], ID, options);
-        Bool32ToJson(args["bEnable"], bEnable, options);
+        FieldToJson(writer.Key("ID"), ID, options);
+        Bool32ToJson(writer.Key("bEnable"), bEnable, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9252,13 +9645,14 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnCategory(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnCategory");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnCategory");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Category"], Category, options);
+        FieldToJson(writer.Key("Category"), Category, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9270,13 +9664,14 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnSeverity(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnSeverity");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnSeverity");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["Severity"], Severity, options);
+        FieldToJson(writer.Key("Severity"), Severity, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9288,13 +9683,14 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetBreakOnID(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnID");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetBreakOnID");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["ID"], ID, options);
+        FieldToJson(writer.Key("ID"), ID, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9305,12 +9701,13 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_SetMuteDebugOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMuteDebugOutput");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "SetMuteDebugOutput");
     const JsonOptions& options = writer_->GetOptions();
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        Bool32ToJson(args["bMute"], bMute, options);
+        Bool32ToJson(writer.Key("bMute"), bMute, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9321,9 +9718,9 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue_GetMuteDebugOutput(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMuteDebugOutput");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue", object_id, "GetMuteDebugOutput");
     const JsonOptions& options = writer_->GetOptions();
-    Bool32ToJson(method[format::kNameReturn], return_value, options);
+    Bool32ToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -9338,16 +9735,17 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue1_RegisterMessageCallback(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "RegisterMessageCallback");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "RegisterMessageCallback");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["CallbackFunc"], CallbackFunc, options);
-        FieldToJson_D3D12_MESSAGE_CALLBACK_FLAGS(args["CallbackFilterFlags"], CallbackFilterFlags, options);
-        FieldToJson(args["pContext"], pContext, options);
-        FieldToJson(args["pCallbackCookie"], pCallbackCookie, options);
+        FieldToJson(writer.Key("CallbackFunc"), CallbackFunc, options);
+        FieldToJson_D3D12_MESSAGE_CALLBACK_FLAGS(writer.Key("CallbackFilterFlags"), CallbackFilterFlags, options);
+        FieldToJson(writer.Key("pContext"), pContext, options);
+        FieldToJson(writer.Key("pCallbackCookie"), pCallbackCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9359,13 +9757,14 @@ void Dx12JsonConsumer::Process_ID3D12InfoQueue1_UnregisterMessageCallback(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "UnregisterMessageCallback");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "ID3D12InfoQueue1", object_id, "UnregisterMessageCallback");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["CallbackCookie"], CallbackCookie, options);
+        FieldToJson(writer.Key("CallbackCookie"), CallbackCookie, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9382,14 +9781,15 @@ void Dx12JsonConsumer::Process_IUnknown_QueryInterface(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "QueryInterface");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "QueryInterface");
     const JsonOptions& options = writer_->GetOptions();
-    HresultToJson(method[format::kNameReturn], return_value, options);
-    nlohmann::ordered_json& args = method[format::kNameArgs];
+    HresultToJson(writer.Key(format::kNameReturn), return_value, options);
+    writer.Key(format::kNameArgs).BeginObject();
     {
-        FieldToJson(args["riid"], riid, options);
-        FieldToJson(args["ppvObject"], ppvObject, options);
+        FieldToJson(writer.Key("riid"), riid, options);
+        FieldToJson(writer.Key("ppvObject"), ppvObject, options);
     }
+    writer.EndObject();
     writer_->WriteBlockEnd();
 }
 
@@ -9400,9 +9800,9 @@ void Dx12JsonConsumer::Process_IUnknown_AddRef(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "AddRef");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "AddRef");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -9413,9 +9813,9 @@ void Dx12JsonConsumer::Process_IUnknown_Release(
 {
     using namespace gfxrecon::util;
 
-    nlohmann::ordered_json& method = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "Release");
+    JsonStreamWriter& writer = writer_->WriteApiCallStart(call_info, "IUnknown", object_id, "Release");
     const JsonOptions& options = writer_->GetOptions();
-    FieldToJson(method[format::kNameReturn], return_value, options);
+    FieldToJson(writer.Key(format::kNameReturn), return_value, options);
     writer_->WriteBlockEnd();
 }
 
@@ -234,477 +234,477 @@ struct VkPhysicalDeviceSchedulingControlsFlagBitsARM_t { };
 struct VkPipelineCreateFlagBits2KHR_t { };
 struct VkPipelineStageFlagBits2_t { };
 
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1ChromaSamplePosition& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1ColorPrimaries& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1FrameRestorationType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1FrameType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1InterpolationFilter& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1Level& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1MatrixCoefficients& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1Profile& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1ReferenceName& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1TransferCharacteristics& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoAV1TxMode& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoDecodeH264FieldOrderCount& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264AspectRatioIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264CabacInitIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264ChromaFormatIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264DisableDeblockingFilterIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264LevelIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264MemMgmtControlOp& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264ModificationOfPicNumsIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264NonVclNaluType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264PictureType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264PocType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264ProfileIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264SliceType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH264WeightedBipredIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265AspectRatioIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265ChromaFormatIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265LevelIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265PictureType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265ProfileIdc& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const StdVideoH265SliceType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureBuildTypeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureCompatibilityKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureCreateFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureMemoryRequirementsTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureMotionInstanceTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccelerationStructureTypeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAccessFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkAccessFlagBits2_t, nlohmann::ordered_json& jdata, const VkAccessFlagBits2& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAcquireProfilingLockFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAttachmentDescriptionFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAttachmentLoadOp& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkAttachmentStoreOp& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBlendFactor& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBlendOp& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBlendOverlapEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBlockMatchWindowCompareModeQCOM& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBorderColor& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBufferCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBufferUsageFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkBufferUsageFlagBits2KHR_t, nlohmann::ordered_json& jdata, const VkBufferUsageFlagBits2KHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildAccelerationStructureFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildAccelerationStructureModeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildMicromapFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkBuildMicromapModeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkChromaLocation& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCoarseSampleOrderTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkColorComponentFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkColorSpaceKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandBufferLevel& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandBufferResetFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandBufferUsageFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandPoolCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCommandPoolResetFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCompareOp& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkComponentSwizzle& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkComponentTypeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCompositeAlphaFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkConditionalRenderingFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkConservativeRasterizationModeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCopyAccelerationStructureModeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCopyMicromapModeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCoverageModulationModeNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCoverageReductionModeNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCubicFilterWeightsQCOM& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkCullModeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugReportFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugReportObjectTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugUtilsMessageSeverityFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDebugUtilsMessageTypeFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDependencyFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDepthBiasRepresentationEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorBindingFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorPoolCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorSetLayoutCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDescriptorUpdateTemplateType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceAddressBindingFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceAddressBindingTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceDiagnosticsConfigFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceEventTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceFaultAddressTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceFaultVendorBinaryHeaderVersionEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceGroupPresentModeFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceMemoryReportEventTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDeviceQueueCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDirectDriverLoadingModeLUNARG& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDiscardRectangleModeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplacementMicromapFormatNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplayEventTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplayPlaneAlphaFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDisplayPowerStateEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDriverId& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkDynamicState& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkEventCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalFenceFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalFenceHandleTypeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryFeatureFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryHandleTypeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalMemoryHandleTypeFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalSemaphoreFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkExternalSemaphoreHandleTypeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFenceCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFenceImportFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFilter& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFormat& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFormatFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkFormatFeatureFlagBits2_t, nlohmann::ordered_json& jdata, const VkFormatFeatureFlagBits2& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFragmentShadingRateCombinerOpKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFragmentShadingRateNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFragmentShadingRateTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFrameBoundaryFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFramebufferCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFrontFace& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkFullScreenExclusiveEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkGeometryFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkGeometryInstanceFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkGeometryTypeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkGraphicsPipelineLibraryFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkHostImageCopyFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageAspectFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageCompressionFixedRateFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageCompressionFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageLayout& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageTiling& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageUsageFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageViewCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkImageViewType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndexType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsLayoutUsageFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectCommandsTokenTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkIndirectStateFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkInstanceCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkInternalAllocationType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkLatencyMarkerNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkLayerSettingTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkLayeredDriverUnderlyingApiMSFT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkLineRasterizationModeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkLogicOp& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryAllocateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryHeapFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryMapFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryOverallocationBehaviorAMD& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryPropertyFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMemoryUnmapFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMicromapCreateFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkMicromapTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkObjectType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpacityMicromapFormatEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpacityMicromapSpecialIndexEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowExecuteFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowGridSizeFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowPerformanceLevelNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowSessionBindingPointNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowSessionCreateFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOpticalFlowUsageFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkOutOfBandQueueTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPeerMemoryFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceConfigurationTypeINTEL& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterDescriptionFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterScopeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterStorageKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceCounterUnitKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceOverrideTypeINTEL& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceParameterTypeINTEL& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPerformanceValueTypeINTEL& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPhysicalDeviceLayeredApiKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPhysicalDeviceSchedulingControlsFlagBitsARM_t, nlohmann::ordered_json& jdata, const VkPhysicalDeviceSchedulingControlsFlagBitsARM& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPhysicalDeviceType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineBindPoint& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCacheCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCacheHeaderVersion& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineColorBlendStateCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCompilerControlFlagBitsAMD& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineCreateFlagBits2KHR_t, nlohmann::ordered_json& jdata, const VkPipelineCreateFlagBits2KHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineCreationFeedbackFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineDepthStencilStateCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineExecutableStatisticFormatKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineLayoutCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineRobustnessBufferBehaviorEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineRobustnessImageBehaviorEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineShaderStageCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPipelineStageFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineStageFlagBits2_t, nlohmann::ordered_json& jdata, const VkPipelineStageFlagBits2& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPointClippingBehavior& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPolygonMode& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPresentGravityFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPresentModeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPresentScalingFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkPrimitiveTopology& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkProvokingVertexModeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryControlFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryPipelineStatisticFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryPoolSamplingModeINTEL& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryResultFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryResultStatusKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueryType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueueFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkQueueGlobalPriorityKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkRasterizationOrderAMD& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkRayTracingInvocationReorderModeNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkRayTracingShaderGroupTypeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkRenderPassCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkRenderingFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkResolveModeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkResult& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSampleCountFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerAddressMode& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerMipmapMode& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerReductionMode& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerYcbcrModelConversion& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSamplerYcbcrRange& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkScopeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSemaphoreImportFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSemaphoreType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSemaphoreWaitFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderCodeTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderCorePropertiesFlagBitsAMD& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderCreateFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderFloatControlsIndependence& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderGroupShaderKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderInfoTypeAMD& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShaderStageFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkShadingRatePaletteEntryNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSharingMode& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSparseImageFormatFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSparseMemoryBindFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkStencilFaceFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkStencilOp& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkStructureType& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSubgroupFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSubmitFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSubpassContents& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSubpassDescriptionFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSubpassMergeStatusEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSurfaceCounterFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSurfaceTransformFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSwapchainCreateFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkSystemAllocationScope& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkTessellationDomainOrigin& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkTimeDomainKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkToolPurposeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationCacheHeaderVersionEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationCheckEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationFeatureDisableEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkValidationFeatureEnableEXT& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVendorId& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVertexInputRate& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoCapabilityFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoChromaSubsamplingFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoCodecOperationFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoCodingControlFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoComponentBitDepthFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoDecodeCapabilityFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoDecodeH264PictureLayoutFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoDecodeUsageFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeCapabilityFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeContentFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeFeedbackFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH264CapabilityFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH264RateControlFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH264StdFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265CapabilityFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265CtbSizeFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265RateControlFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265StdFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeH265TransformBlockSizeFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeRateControlModeFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeTuningModeKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoEncodeUsageFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkVideoSessionCreateFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(nlohmann::ordered_json& jdata, const VkViewportCoordinateSwizzleNV& value, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkAccelerationStructureCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkAccelerationStructureMotionInfoFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkAccelerationStructureMotionInstanceFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkAccessFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkAccessFlags2_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkAcquireProfilingLockFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkAndroidSurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkAttachmentDescriptionFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkBufferCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkBufferUsageFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkBufferUsageFlags2KHR_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkBufferViewCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkBuildAccelerationStructureFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkBuildMicromapFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkColorComponentFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkCommandBufferResetFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkCommandBufferUsageFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkCommandPoolCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkCommandPoolResetFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkCommandPoolTrimFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkCompositeAlphaFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkConditionalRenderingFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkCullModeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDebugReportFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDebugUtilsMessageSeverityFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDebugUtilsMessageTypeFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDebugUtilsMessengerCallbackDataFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDebugUtilsMessengerCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDependencyFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDescriptorBindingFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDescriptorPoolCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDescriptorPoolResetFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDescriptorSetLayoutCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDescriptorUpdateTemplateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDeviceAddressBindingFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDeviceCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDeviceDiagnosticsConfigFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDeviceGroupPresentModeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDeviceMemoryReportFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDeviceQueueCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDirectDriverLoadingFlagsLUNARG_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDirectFBSurfaceCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDisplayModeCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDisplayPlaneAlphaFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkDisplaySurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkEventCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkExternalFenceFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkExternalFenceHandleTypeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkExternalMemoryFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkExternalMemoryFeatureFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkExternalMemoryHandleTypeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkExternalSemaphoreFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkExternalSemaphoreHandleTypeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkFenceCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkFenceImportFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkFormatFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkFormatFeatureFlags2_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkFrameBoundaryFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkFramebufferCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkGeometryFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkGeometryInstanceFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkGraphicsPipelineLibraryFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkHeadlessSurfaceCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkHostImageCopyFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkIOSSurfaceCreateFlagsMVK_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkImageAspectFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkImageCompressionFixedRateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkImageCompressionFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkImageCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkImagePipeSurfaceCreateFlagsFUCHSIA_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkImageUsageFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkImageViewCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkIndirectCommandsLayoutUsageFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkIndirectStateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkInstanceCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkMacOSSurfaceCreateFlagsMVK_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkMemoryAllocateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkMemoryHeapFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkMemoryMapFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkMemoryPropertyFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkMemoryUnmapFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkMetalSurfaceCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkMicromapCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkOpticalFlowExecuteFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkOpticalFlowGridSizeFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkOpticalFlowSessionCreateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkOpticalFlowUsageFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPeerMemoryFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPerformanceCounterDescriptionFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPhysicalDeviceSchedulingControlsFlagsARM_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineCacheCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineColorBlendStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineCompilerControlFlagsAMD_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineCoverageModulationStateCreateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineCoverageReductionStateCreateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineCoverageToColorStateCreateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineCreateFlags2KHR_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineCreationFeedbackFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineDepthStencilStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineDiscardRectangleStateCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineDynamicStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineInputAssemblyStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineLayoutCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineMultisampleStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineRasterizationConservativeStateCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineRasterizationDepthClipStateCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineRasterizationStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineRasterizationStateStreamCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineShaderStageCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineStageFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineStageFlags2_t, nlohmann::ordered_json& jdata, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineTessellationStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineVertexInputStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineViewportStateCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPipelineViewportSwizzleStateCreateFlagsNV_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPresentGravityFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPresentScalingFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkPrivateDataSlotCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkQueryControlFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkQueryPipelineStatisticFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkQueryPoolCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkQueryResultFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkQueueFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkRenderPassCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkRenderingFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkResolveModeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSampleCountFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSamplerCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkScreenSurfaceCreateFlagsQNX_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSemaphoreCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSemaphoreImportFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSemaphoreWaitFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkShaderCorePropertiesFlagsAMD_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkShaderCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkShaderModuleCreateFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkShaderStageFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSparseImageFormatFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSparseMemoryBindFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkStencilFaceFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkStreamDescriptorSurfaceCreateFlagsGGP_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSubgroupFeatureFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSubmitFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSubpassDescriptionFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSurfaceCounterFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSurfaceTransformFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkSwapchainCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkToolPurposeFlags_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkValidationCacheCreateFlagsEXT_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkViSurfaceCreateFlagsNN_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoBeginCodingFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoCapabilityFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoChromaSubsamplingFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoCodecOperationFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoCodingControlFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoComponentBitDepthFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoDecodeCapabilityFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoDecodeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoDecodeH264PictureLayoutFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoDecodeUsageFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeCapabilityFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeContentFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeFeedbackFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeH264CapabilityFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeH264RateControlFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeH264StdFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeH265CapabilityFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeH265CtbSizeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeH265RateControlFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeH265StdFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeH265TransformBlockSizeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeRateControlFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeRateControlModeFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEncodeUsageFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoEndCodingFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoSessionCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkVideoSessionParametersCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkWaylandSurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkWin32SurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkXcbSurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
-void FieldToJson(VkXlibSurfaceCreateFlagsKHR_t, nlohmann::ordered_json& jdata, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoAV1ChromaSamplePosition& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoAV1ColorPrimaries& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoAV1FrameRestorationType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoAV1FrameType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoAV1InterpolationFilter& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoAV1Level& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoAV1MatrixCoefficients& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoAV1Profile& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoAV1ReferenceName& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoAV1TransferCharacteristics& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoAV1TxMode& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoDecodeH264FieldOrderCount& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264AspectRatioIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264CabacInitIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264ChromaFormatIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264DisableDeblockingFilterIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264LevelIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264MemMgmtControlOp& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264ModificationOfPicNumsIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264NonVclNaluType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264PictureType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264PocType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264ProfileIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264SliceType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH264WeightedBipredIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH265AspectRatioIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH265ChromaFormatIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH265LevelIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH265PictureType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH265ProfileIdc& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const StdVideoH265SliceType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkAccelerationStructureBuildTypeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkAccelerationStructureCompatibilityKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkAccelerationStructureCreateFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkAccelerationStructureMemoryRequirementsTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkAccelerationStructureMotionInstanceTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkAccelerationStructureTypeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkAccessFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkAccessFlagBits2_t, util::JsonStreamWriter& writer, const VkAccessFlagBits2& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkAcquireProfilingLockFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkAttachmentDescriptionFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkAttachmentLoadOp& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkAttachmentStoreOp& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkBlendFactor& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkBlendOp& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkBlendOverlapEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkBlockMatchWindowCompareModeQCOM& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkBorderColor& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkBufferCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkBufferUsageFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkBufferUsageFlagBits2KHR_t, util::JsonStreamWriter& writer, const VkBufferUsageFlagBits2KHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkBuildAccelerationStructureFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkBuildAccelerationStructureModeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkBuildMicromapFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkBuildMicromapModeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkChromaLocation& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCoarseSampleOrderTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkColorComponentFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkColorSpaceKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCommandBufferLevel& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCommandBufferResetFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCommandBufferUsageFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCommandPoolCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCommandPoolResetFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCompareOp& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkComponentSwizzle& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkComponentTypeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCompositeAlphaFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkConditionalRenderingFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkConservativeRasterizationModeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCopyAccelerationStructureModeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCopyMicromapModeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCoverageModulationModeNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCoverageReductionModeNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCubicFilterWeightsQCOM& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkCullModeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDebugReportFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDebugReportObjectTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDebugUtilsMessageSeverityFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDebugUtilsMessageTypeFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDependencyFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDepthBiasRepresentationEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDescriptorBindingFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDescriptorPoolCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDescriptorSetLayoutCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDescriptorType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDescriptorUpdateTemplateType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDeviceAddressBindingFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDeviceAddressBindingTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDeviceDiagnosticsConfigFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDeviceEventTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDeviceFaultAddressTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDeviceFaultVendorBinaryHeaderVersionEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDeviceGroupPresentModeFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDeviceMemoryReportEventTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDeviceQueueCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDirectDriverLoadingModeLUNARG& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDiscardRectangleModeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDisplacementMicromapFormatNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDisplayEventTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDisplayPlaneAlphaFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDisplayPowerStateEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDriverId& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkDynamicState& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkEventCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkExternalFenceFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkExternalFenceHandleTypeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkExternalMemoryFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkExternalMemoryFeatureFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkExternalMemoryHandleTypeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkExternalMemoryHandleTypeFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkExternalSemaphoreFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkExternalSemaphoreHandleTypeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFenceCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFenceImportFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFilter& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFormat& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFormatFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkFormatFeatureFlagBits2_t, util::JsonStreamWriter& writer, const VkFormatFeatureFlagBits2& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFragmentShadingRateCombinerOpKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFragmentShadingRateNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFragmentShadingRateTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFrameBoundaryFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFramebufferCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFrontFace& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkFullScreenExclusiveEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkGeometryFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkGeometryInstanceFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkGeometryTypeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkGraphicsPipelineLibraryFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkHostImageCopyFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkImageAspectFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkImageCompressionFixedRateFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkImageCompressionFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkImageCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkImageLayout& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkImageTiling& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkImageType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkImageUsageFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkImageViewCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkImageViewType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkIndexType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkIndirectCommandsLayoutUsageFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkIndirectCommandsTokenTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkIndirectStateFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkInstanceCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkInternalAllocationType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkLatencyMarkerNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkLayerSettingTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkLayeredDriverUnderlyingApiMSFT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkLineRasterizationModeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkLogicOp& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkMemoryAllocateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkMemoryHeapFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkMemoryMapFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkMemoryOverallocationBehaviorAMD& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkMemoryPropertyFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkMemoryUnmapFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkMicromapCreateFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkMicromapTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkObjectType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkOpacityMicromapFormatEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkOpacityMicromapSpecialIndexEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkOpticalFlowExecuteFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkOpticalFlowGridSizeFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkOpticalFlowPerformanceLevelNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkOpticalFlowSessionBindingPointNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkOpticalFlowSessionCreateFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkOpticalFlowUsageFlagBitsNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkOutOfBandQueueTypeNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPeerMemoryFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPerformanceConfigurationTypeINTEL& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPerformanceCounterDescriptionFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPerformanceCounterScopeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPerformanceCounterStorageKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPerformanceCounterUnitKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPerformanceOverrideTypeINTEL& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPerformanceParameterTypeINTEL& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPerformanceValueTypeINTEL& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPhysicalDeviceLayeredApiKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPhysicalDeviceSchedulingControlsFlagBitsARM_t, util::JsonStreamWriter& writer, const VkPhysicalDeviceSchedulingControlsFlagBitsARM& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPhysicalDeviceType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineBindPoint& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineCacheCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineCacheHeaderVersion& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineColorBlendStateCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineCompilerControlFlagBitsAMD& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineCreateFlagBits2KHR_t, util::JsonStreamWriter& writer, const VkPipelineCreateFlagBits2KHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineCreationFeedbackFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineDepthStencilStateCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineExecutableStatisticFormatKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineLayoutCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineRobustnessBufferBehaviorEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineRobustnessImageBehaviorEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineShaderStageCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPipelineStageFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineStageFlagBits2_t, util::JsonStreamWriter& writer, const VkPipelineStageFlagBits2& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPointClippingBehavior& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPolygonMode& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPresentGravityFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPresentModeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPresentScalingFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkPrimitiveTopology& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkProvokingVertexModeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkQueryControlFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkQueryPipelineStatisticFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkQueryPoolSamplingModeINTEL& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkQueryResultFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkQueryResultStatusKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkQueryType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkQueueFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkQueueGlobalPriorityKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkRasterizationOrderAMD& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkRayTracingInvocationReorderModeNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkRayTracingShaderGroupTypeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkRenderPassCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkRenderingFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkResolveModeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkResult& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSampleCountFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSamplerAddressMode& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSamplerCreateFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSamplerMipmapMode& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSamplerReductionMode& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSamplerYcbcrModelConversion& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSamplerYcbcrRange& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkScopeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSemaphoreImportFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSemaphoreType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSemaphoreWaitFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkShaderCodeTypeEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkShaderCorePropertiesFlagBitsAMD& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkShaderCreateFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkShaderFloatControlsIndependence& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkShaderGroupShaderKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkShaderInfoTypeAMD& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkShaderStageFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkShadingRatePaletteEntryNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSharingMode& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSparseImageFormatFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSparseMemoryBindFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkStencilFaceFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkStencilOp& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkStructureType& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSubgroupFeatureFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSubmitFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSubpassContents& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSubpassDescriptionFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSubpassMergeStatusEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSurfaceCounterFlagBitsEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSurfaceTransformFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSwapchainCreateFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkSystemAllocationScope& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkTessellationDomainOrigin& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkTimeDomainKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkToolPurposeFlagBits& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkValidationCacheHeaderVersionEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkValidationCheckEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkValidationFeatureDisableEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkValidationFeatureEnableEXT& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVendorId& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVertexInputRate& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoCapabilityFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoChromaSubsamplingFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoCodecOperationFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoCodingControlFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoComponentBitDepthFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoDecodeCapabilityFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoDecodeH264PictureLayoutFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoDecodeUsageFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeCapabilityFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeContentFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeFeedbackFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeH264CapabilityFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeH264RateControlFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeH264StdFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeH265CapabilityFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeH265CtbSizeFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeH265RateControlFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeH265StdFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeH265TransformBlockSizeFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeRateControlModeFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeTuningModeKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoEncodeUsageFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkVideoSessionCreateFlagBitsKHR& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(util::JsonStreamWriter& writer, const VkViewportCoordinateSwizzleNV& value, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkAccelerationStructureCreateFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkAccelerationStructureMotionInfoFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkAccelerationStructureMotionInstanceFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkAccessFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkAccessFlags2_t, util::JsonStreamWriter& writer, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkAcquireProfilingLockFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkAndroidSurfaceCreateFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkAttachmentDescriptionFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkBufferCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkBufferUsageFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkBufferUsageFlags2KHR_t, util::JsonStreamWriter& writer, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkBufferViewCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkBuildAccelerationStructureFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkBuildMicromapFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkColorComponentFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkCommandBufferResetFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkCommandBufferUsageFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkCommandPoolCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkCommandPoolResetFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkCommandPoolTrimFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkCompositeAlphaFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkConditionalRenderingFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkCullModeFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDebugReportFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDebugUtilsMessageSeverityFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDebugUtilsMessageTypeFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDebugUtilsMessengerCallbackDataFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDebugUtilsMessengerCreateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDependencyFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDescriptorBindingFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDescriptorPoolCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDescriptorPoolResetFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDescriptorSetLayoutCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDescriptorUpdateTemplateCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDeviceAddressBindingFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDeviceCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDeviceDiagnosticsConfigFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDeviceGroupPresentModeFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDeviceMemoryReportFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDeviceQueueCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDirectDriverLoadingFlagsLUNARG_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDirectFBSurfaceCreateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDisplayModeCreateFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDisplayPlaneAlphaFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkDisplaySurfaceCreateFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkEventCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkExternalFenceFeatureFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkExternalFenceHandleTypeFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkExternalMemoryFeatureFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkExternalMemoryFeatureFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkExternalMemoryHandleTypeFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkExternalSemaphoreFeatureFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkExternalSemaphoreHandleTypeFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkFenceCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkFenceImportFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkFormatFeatureFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkFormatFeatureFlags2_t, util::JsonStreamWriter& writer, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkFrameBoundaryFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkFramebufferCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkGeometryFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkGeometryInstanceFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkGraphicsPipelineLibraryFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkHeadlessSurfaceCreateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkHostImageCopyFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkIOSSurfaceCreateFlagsMVK_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkImageAspectFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkImageCompressionFixedRateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkImageCompressionFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkImageCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkImagePipeSurfaceCreateFlagsFUCHSIA_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkImageUsageFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkImageViewCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkIndirectCommandsLayoutUsageFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkIndirectStateFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkInstanceCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkMacOSSurfaceCreateFlagsMVK_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkMemoryAllocateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkMemoryHeapFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkMemoryMapFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkMemoryPropertyFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkMemoryUnmapFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkMetalSurfaceCreateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkMicromapCreateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkOpticalFlowExecuteFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkOpticalFlowGridSizeFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkOpticalFlowSessionCreateFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkOpticalFlowUsageFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPeerMemoryFeatureFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPerformanceCounterDescriptionFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPhysicalDeviceSchedulingControlsFlagsARM_t, util::JsonStreamWriter& writer, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineCacheCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineColorBlendStateCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineCompilerControlFlagsAMD_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineCoverageModulationStateCreateFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineCoverageReductionStateCreateFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineCoverageToColorStateCreateFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineCreateFlags2KHR_t, util::JsonStreamWriter& writer, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineCreationFeedbackFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineDepthStencilStateCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineDiscardRectangleStateCreateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineDynamicStateCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineInputAssemblyStateCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineLayoutCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineMultisampleStateCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineRasterizationConservativeStateCreateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineRasterizationDepthClipStateCreateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineRasterizationStateCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineRasterizationStateStreamCreateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineShaderStageCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineStageFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineStageFlags2_t, util::JsonStreamWriter& writer, const VkFlags64 flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineTessellationStateCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineVertexInputStateCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineViewportStateCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPipelineViewportSwizzleStateCreateFlagsNV_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPresentGravityFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPresentScalingFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkPrivateDataSlotCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkQueryControlFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkQueryPipelineStatisticFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkQueryPoolCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkQueryResultFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkQueueFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkRenderPassCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkRenderingFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkResolveModeFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSampleCountFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSamplerCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkScreenSurfaceCreateFlagsQNX_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSemaphoreCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSemaphoreImportFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSemaphoreWaitFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkShaderCorePropertiesFlagsAMD_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkShaderCreateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkShaderModuleCreateFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkShaderStageFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSparseImageFormatFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSparseMemoryBindFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkStencilFaceFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkStreamDescriptorSurfaceCreateFlagsGGP_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSubgroupFeatureFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSubmitFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSubpassDescriptionFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSurfaceCounterFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSurfaceTransformFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkSwapchainCreateFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkToolPurposeFlags_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkValidationCacheCreateFlagsEXT_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkViSurfaceCreateFlagsNN_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoBeginCodingFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoCapabilityFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoChromaSubsamplingFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoCodecOperationFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoCodingControlFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoComponentBitDepthFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoDecodeCapabilityFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoDecodeFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoDecodeH264PictureLayoutFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoDecodeUsageFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeCapabilityFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeContentFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeFeedbackFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeH264CapabilityFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeH264RateControlFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeH264StdFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeH265CapabilityFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeH265CtbSizeFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeH265RateControlFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeH265StdFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeH265TransformBlockSizeFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeRateControlFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeRateControlModeFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEncodeUsageFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoEndCodingFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoSessionCreateFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkVideoSessionParametersCreateFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkWaylandSurfaceCreateFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkWin32SurfaceCreateFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkXcbSurfaceCreateFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(VkXlibSurfaceCreateFlagsKHR_t, util::JsonStreamWriter& writer, const VkFlags flags, const util::JsonOptions& options = util::JsonOptions());
 
 GFXRECON_END_NAMESPACE(decode)
 GFXRECON_END_NAMESPACE(gfxrecon)
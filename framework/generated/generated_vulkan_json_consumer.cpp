@@ -43,6 +43,7 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 using util::JsonOptions;
+using util::JsonStreamWriter;
 
 void VulkanExportJsonConsumer::Process_vkCreateInstance(
     const ApiCallInfo&                          call_info,
@@ -51,13 +52,14 @@ void VulkanExportJsonConsumer::Process_vkCreateInstance(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkInstance>*           pInstance)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateInstance");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateInstance");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pInstance"], pInstance, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pInstance"), pInstance, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -66,11 +68,12 @@ void VulkanExportJsonConsumer::Process_vkDestroyInstance(
     format::HandleId                            instance,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyInstance");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyInstance");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -81,13 +84,14 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDevices(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceCount,
     HandlePointerDecoder<VkPhysicalDevice>*     pPhysicalDevices)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDevices");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkEnumeratePhysicalDevices");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pPhysicalDeviceCount"], pPhysicalDeviceCount, json_options);
-        HandleToJson(args["pPhysicalDevices"], pPhysicalDevices, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pPhysicalDeviceCount"), pPhysicalDeviceCount, json_options);
+        HandleToJson(writer.Key("pPhysicalDevices"), pPhysicalDevices, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -96,11 +100,12 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures>* pFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFeatures"], pFeatures, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pFeatures"), pFeatures, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -110,12 +115,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties>* pFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["pFormatProperties"], pFormatProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("format"), format, json_options);
+        FieldToJson(writer.Key("pFormatProperties"), pFormatProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -130,17 +136,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties(
     VkImageCreateFlags                          flags,
     StructPointerDecoder<Decoded_VkImageFormatProperties>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["type"], type, json_options);
-        FieldToJson(args["tiling"], tiling, json_options);
-        FieldToJson(VkImageUsageFlags_t(), args["usage"], usage, json_options);
-        FieldToJson(VkImageCreateFlags_t(), args["flags"], flags, json_options);
-        FieldToJson(args["pImageFormatProperties"], pImageFormatProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("format"), format, json_options);
+        FieldToJson(writer.Key("type"), type, json_options);
+        FieldToJson(writer.Key("tiling"), tiling, json_options);
+        FieldToJson(VkImageUsageFlags_t(), writer.Key("usage"), usage, json_options);
+        FieldToJson(VkImageCreateFlags_t(), writer.Key("flags"), flags, json_options);
+        FieldToJson(writer.Key("pImageFormatProperties"), pImageFormatProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -149,11 +156,12 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -163,12 +171,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties(
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties>* pQueueFamilyProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pQueueFamilyPropertyCount"], pQueueFamilyPropertyCount, json_options);
-        FieldToJson(args["pQueueFamilyProperties"], pQueueFamilyProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pQueueFamilyPropertyCount"), pQueueFamilyPropertyCount, json_options);
+        FieldToJson(writer.Key("pQueueFamilyProperties"), pQueueFamilyProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -177,11 +186,12 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties>* pMemoryProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pMemoryProperties"], pMemoryProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pMemoryProperties"), pMemoryProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -193,14 +203,15 @@ void VulkanExportJsonConsumer::Process_vkCreateDevice(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDevice>*             pDevice)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDevice");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateDevice");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pDevice"], pDevice, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pDevice"), pDevice, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -209,11 +220,12 @@ void VulkanExportJsonConsumer::Process_vkDestroyDevice(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDevice");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyDevice");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -224,13 +236,14 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceQueue(
     uint32_t                                    queueIndex,
     HandlePointerDecoder<VkQueue>*              pQueue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceQueue");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceQueue");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["queueIndex"], queueIndex, json_options);
-        HandleToJson(args["pQueue"], pQueue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("queueFamilyIndex"), queueFamilyIndex, json_options);
+        FieldToJson(writer.Key("queueIndex"), queueIndex, json_options);
+        HandleToJson(writer.Key("pQueue"), pQueue, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -242,15 +255,16 @@ void VulkanExportJsonConsumer::Process_vkQueueSubmit(
     StructPointerDecoder<Decoded_VkSubmitInfo>* pSubmits,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSubmit");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkQueueSubmit");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["submitCount"], submitCount, json_options);
-        FieldToJson(args["pSubmits"], pSubmits, json_options);
-        HandleToJson(args["fence"], fence, json_options);
+    FieldToJson(writer.Key(NameSubmitIndex()), ++submit_index_, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+        FieldToJson(writer.Key("submitCount"), submitCount, json_options);
+        FieldToJson(writer.Key("pSubmits"), pSubmits, json_options);
+        HandleToJson(writer.Key("fence"), fence, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -259,11 +273,12 @@ void VulkanExportJsonConsumer::Process_vkQueueWaitIdle(
     VkResult                                    returnValue,
     format::HandleId                            queue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueWaitIdle");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkQueueWaitIdle");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -272,11 +287,12 @@ void VulkanExportJsonConsumer::Process_vkDeviceWaitIdle(
     VkResult                                    returnValue,
     format::HandleId                            device)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDeviceWaitIdle");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDeviceWaitIdle");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -288,14 +304,15 @@ void VulkanExportJsonConsumer::Process_vkAllocateMemory(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDeviceMemory>*       pMemory)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAllocateMemory");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkAllocateMemory");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAllocateInfo"], pAllocateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pMemory"], pMemory, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pAllocateInfo"), pAllocateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pMemory"), pMemory, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -305,12 +322,13 @@ void VulkanExportJsonConsumer::Process_vkFreeMemory(
     format::HandleId                            memory,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFreeMemory");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkFreeMemory");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("memory"), memory, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -324,16 +342,17 @@ void VulkanExportJsonConsumer::Process_vkMapMemory(
     VkMemoryMapFlags                            flags,
     PointerDecoder<uint64_t, void*>*            ppData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMapMemory");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkMapMemory");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["size"], size, json_options);
-        FieldToJson(VkMemoryMapFlags_t(), args["flags"], flags, json_options);
-        FieldToJsonAsHex(args["ppData"], ppData, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("memory"), memory, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        FieldToJson(writer.Key("size"), size, json_options);
+        FieldToJson(VkMemoryMapFlags_t(), writer.Key("flags"), flags, json_options);
+        FieldToJsonAsHex(writer.Key("ppData"), ppData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -342,11 +361,12 @@ void VulkanExportJsonConsumer::Process_vkUnmapMemory(
     format::HandleId                            device,
     format::HandleId                            memory)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUnmapMemory");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkUnmapMemory");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("memory"), memory, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -357,13 +377,14 @@ void VulkanExportJsonConsumer::Process_vkFlushMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFlushMappedMemoryRanges");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkFlushMappedMemoryRanges");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["memoryRangeCount"], memoryRangeCount, json_options);
-        FieldToJson(args["pMemoryRanges"], pMemoryRanges, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("memoryRangeCount"), memoryRangeCount, json_options);
+        FieldToJson(writer.Key("pMemoryRanges"), pMemoryRanges, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -374,13 +395,14 @@ void VulkanExportJsonConsumer::Process_vkInvalidateMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkInvalidateMappedMemoryRanges");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkInvalidateMappedMemoryRanges");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["memoryRangeCount"], memoryRangeCount, json_options);
-        FieldToJson(args["pMemoryRanges"], pMemoryRanges, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("memoryRangeCount"), memoryRangeCount, json_options);
+        FieldToJson(writer.Key("pMemoryRanges"), pMemoryRanges, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -390,12 +412,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryCommitment(
     format::HandleId                            memory,
     PointerDecoder<VkDeviceSize>*               pCommittedMemoryInBytes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryCommitment");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceMemoryCommitment");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["pCommittedMemoryInBytes"], pCommittedMemoryInBytes, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("memory"), memory, json_options);
+        FieldToJson(writer.Key("pCommittedMemoryInBytes"), pCommittedMemoryInBytes, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -407,14 +430,15 @@ void VulkanExportJsonConsumer::Process_vkBindBufferMemory(
     format::HandleId                            memory,
     VkDeviceSize                                memoryOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkBindBufferMemory");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["memoryOffset"], memoryOffset, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        HandleToJson(writer.Key("memory"), memory, json_options);
+        FieldToJson(writer.Key("memoryOffset"), memoryOffset, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -426,14 +450,15 @@ void VulkanExportJsonConsumer::Process_vkBindImageMemory(
     format::HandleId                            memory,
     VkDeviceSize                                memoryOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindImageMemory");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkBindImageMemory");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["memoryOffset"], memoryOffset, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("image"), image, json_options);
+        HandleToJson(writer.Key("memory"), memory, json_options);
+        FieldToJson(writer.Key("memoryOffset"), memoryOffset, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -443,12 +468,13 @@ void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements(
     format::HandleId                            buffer,
     StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -458,12 +484,13 @@ void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("image"), image, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -474,13 +501,14 @@ void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pSparseMemoryRequirementCount"], pSparseMemoryRequirementCount, json_options);
-        FieldToJson(args["pSparseMemoryRequirements"], pSparseMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("image"), image, json_options);
+        FieldToJson(writer.Key("pSparseMemoryRequirementCount"), pSparseMemoryRequirementCount, json_options);
+        FieldToJson(writer.Key("pSparseMemoryRequirements"), pSparseMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -495,17 +523,18 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["type"], type, json_options);
-        FieldToJson(args["samples"], samples, json_options);
-        FieldToJson(VkImageUsageFlags_t(), args["usage"], usage, json_options);
-        FieldToJson(args["tiling"], tiling, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("format"), format, json_options);
+        FieldToJson(writer.Key("type"), type, json_options);
+        FieldToJson(writer.Key("samples"), samples, json_options);
+        FieldToJson(VkImageUsageFlags_t(), writer.Key("usage"), usage, json_options);
+        FieldToJson(writer.Key("tiling"), tiling, json_options);
+        FieldToJson(writer.Key("pPropertyCount"), pPropertyCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -517,14 +546,15 @@ void VulkanExportJsonConsumer::Process_vkQueueBindSparse(
     StructPointerDecoder<Decoded_VkBindSparseInfo>* pBindInfo,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueBindSparse");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkQueueBindSparse");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfo"], pBindInfo, json_options);
-        HandleToJson(args["fence"], fence, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+        FieldToJson(writer.Key("bindInfoCount"), bindInfoCount, json_options);
+        FieldToJson(writer.Key("pBindInfo"), pBindInfo, json_options);
+        HandleToJson(writer.Key("fence"), fence, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -536,14 +566,15 @@ void VulkanExportJsonConsumer::Process_vkCreateFence(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateFence");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateFence");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pFence"], pFence, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pFence"), pFence, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -553,12 +584,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyFence(
     format::HandleId                            fence,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyFence");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyFence");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["fence"], fence, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("fence"), fence, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -569,13 +601,14 @@ void VulkanExportJsonConsumer::Process_vkResetFences(
     uint32_t                                    fenceCount,
     HandlePointerDecoder<VkFence>*              pFences)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetFences");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkResetFences");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["fenceCount"], fenceCount, json_options);
-        HandleToJson(args["pFences"], pFences, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("fenceCount"), fenceCount, json_options);
+        HandleToJson(writer.Key("pFences"), pFences, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -585,12 +618,13 @@ void VulkanExportJsonConsumer::Process_vkGetFenceStatus(
     format::HandleId                            device,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFenceStatus");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetFenceStatus");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["fence"], fence, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("fence"), fence, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -603,15 +637,16 @@ void VulkanExportJsonConsumer::Process_vkWaitForFences(
     VkBool32                                    waitAll,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitForFences");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkWaitForFences");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["fenceCount"], fenceCount, json_options);
-        HandleToJson(args["pFences"], pFences, json_options);
-        Bool32ToJson(args["waitAll"], waitAll, json_options);
-        FieldToJson(args["timeout"], timeout, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("fenceCount"), fenceCount, json_options);
+        HandleToJson(writer.Key("pFences"), pFences, json_options);
+        Bool32ToJson(writer.Key("waitAll"), waitAll, json_options);
+        FieldToJson(writer.Key("timeout"), timeout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -623,14 +658,15 @@ void VulkanExportJsonConsumer::Process_vkCreateSemaphore(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSemaphore>*          pSemaphore)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSemaphore");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateSemaphore");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSemaphore"], pSemaphore, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSemaphore"), pSemaphore, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -640,12 +676,13 @@ void VulkanExportJsonConsumer::Process_vkDestroySemaphore(
     format::HandleId                            semaphore,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySemaphore");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroySemaphore");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["semaphore"], semaphore, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("semaphore"), semaphore, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -657,14 +694,15 @@ void VulkanExportJsonConsumer::Process_vkCreateEvent(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkEvent>*              pEvent)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateEvent");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pEvent"], pEvent, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pEvent"), pEvent, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -674,12 +712,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyEvent(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyEvent");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("event"), event, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -689,12 +728,13 @@ void VulkanExportJsonConsumer::Process_vkGetEventStatus(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetEventStatus");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetEventStatus");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["event"], event, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("event"), event, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -704,12 +744,13 @@ void VulkanExportJsonConsumer::Process_vkSetEvent(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetEvent");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSetEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["event"], event, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("event"), event, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -719,12 +760,13 @@ void VulkanExportJsonConsumer::Process_vkResetEvent(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetEvent");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkResetEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["event"], event, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("event"), event, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -736,14 +778,15 @@ void VulkanExportJsonConsumer::Process_vkCreateQueryPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkQueryPool>*          pQueryPool)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateQueryPool");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pQueryPool"], pQueryPool, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pQueryPool"), pQueryPool, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -753,12 +796,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyQueryPool(
     format::HandleId                            queryPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyQueryPool");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -774,18 +818,19 @@ void VulkanExportJsonConsumer::Process_vkGetQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetQueryPoolResults");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetQueryPoolResults");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-        FieldToJson(args["queryCount"], queryCount, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-        FieldToJson(VkQueryResultFlags_t(), args["flags"], flags, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("firstQuery"), firstQuery, json_options);
+        FieldToJson(writer.Key("queryCount"), queryCount, json_options);
+        FieldToJson(writer.Key("dataSize"), dataSize, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+        FieldToJson(VkQueryResultFlags_t(), writer.Key("flags"), flags, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -797,14 +842,15 @@ void VulkanExportJsonConsumer::Process_vkCreateBuffer(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkBuffer>*             pBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateBuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pBuffer"], pBuffer, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pBuffer"), pBuffer, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -814,12 +860,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyBuffer(
     format::HandleId                            buffer,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyBuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -831,14 +878,15 @@ void VulkanExportJsonConsumer::Process_vkCreateBufferView(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkBufferView>*         pView)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateBufferView");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateBufferView");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pView"], pView, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pView"), pView, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -848,12 +896,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyBufferView(
     format::HandleId                            bufferView,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyBufferView");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyBufferView");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["bufferView"], bufferView, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("bufferView"), bufferView, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -865,14 +914,15 @@ void VulkanExportJsonConsumer::Process_vkCreateImage(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkImage>*              pImage)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateImage");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateImage");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pImage"], pImage, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pImage"), pImage, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -882,12 +932,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyImage(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyImage");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyImage");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("image"), image, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -898,13 +949,14 @@ void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout(
     StructPointerDecoder<Decoded_VkImageSubresource>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pSubresource"], pSubresource, json_options);
-        FieldToJson(args["pLayout"], pLayout, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("image"), image, json_options);
+        FieldToJson(writer.Key("pSubresource"), pSubresource, json_options);
+        FieldToJson(writer.Key("pLayout"), pLayout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -916,14 +968,15 @@ void VulkanExportJsonConsumer::Process_vkCreateImageView(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkImageView>*          pView)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateImageView");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateImageView");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pView"], pView, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pView"), pView, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -933,12 +986,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyImageView(
     format::HandleId                            imageView,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyImageView");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyImageView");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["imageView"], imageView, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("imageView"), imageView, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -948,12 +1002,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyShaderModule(
     format::HandleId                            shaderModule,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyShaderModule");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyShaderModule");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["shaderModule"], shaderModule, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("shaderModule"), shaderModule, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -963,12 +1018,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyPipelineCache(
     format::HandleId                            pipelineCache,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPipelineCache");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyPipelineCache");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipelineCache"], pipelineCache, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipelineCache"), pipelineCache, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -980,14 +1036,15 @@ void VulkanExportJsonConsumer::Process_vkMergePipelineCaches(
     uint32_t                                    srcCacheCount,
     HandlePointerDecoder<VkPipelineCache>*      pSrcCaches)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMergePipelineCaches");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkMergePipelineCaches");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["dstCache"], dstCache, json_options);
-        FieldToJson(args["srcCacheCount"], srcCacheCount, json_options);
-        HandleToJson(args["pSrcCaches"], pSrcCaches, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("dstCache"), dstCache, json_options);
+        FieldToJson(writer.Key("srcCacheCount"), srcCacheCount, json_options);
+        HandleToJson(writer.Key("pSrcCaches"), pSrcCaches, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1001,16 +1058,17 @@ void VulkanExportJsonConsumer::Process_vkCreateGraphicsPipelines(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateGraphicsPipelines");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateGraphicsPipelines");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipelineCache"], pipelineCache, json_options);
-        FieldToJson(args["createInfoCount"], createInfoCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelines"], pPipelines, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipelineCache"), pipelineCache, json_options);
+        FieldToJson(writer.Key("createInfoCount"), createInfoCount, json_options);
+        FieldToJson(writer.Key("pCreateInfos"), pCreateInfos, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pPipelines"), pPipelines, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1024,16 +1082,17 @@ void VulkanExportJsonConsumer::Process_vkCreateComputePipelines(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateComputePipelines");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateComputePipelines");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipelineCache"], pipelineCache, json_options);
-        FieldToJson(args["createInfoCount"], createInfoCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelines"], pPipelines, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipelineCache"), pipelineCache, json_options);
+        FieldToJson(writer.Key("createInfoCount"), createInfoCount, json_options);
+        FieldToJson(writer.Key("pCreateInfos"), pCreateInfos, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pPipelines"), pPipelines, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1043,12 +1102,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyPipeline(
     format::HandleId                            pipeline,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPipeline");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyPipeline");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipeline"), pipeline, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1060,14 +1120,15 @@ void VulkanExportJsonConsumer::Process_vkCreatePipelineLayout(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipelineLayout>*     pPipelineLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreatePipelineLayout");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreatePipelineLayout");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelineLayout"], pPipelineLayout, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pPipelineLayout"), pPipelineLayout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1077,12 +1138,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyPipelineLayout(
     format::HandleId                            pipelineLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPipelineLayout");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyPipelineLayout");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipelineLayout"], pipelineLayout, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipelineLayout"), pipelineLayout, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1094,14 +1156,15 @@ void VulkanExportJsonConsumer::Process_vkCreateSampler(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSampler>*            pSampler)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSampler");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateSampler");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSampler"], pSampler, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSampler"), pSampler, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1111,12 +1174,13 @@ void VulkanExportJsonConsumer::Process_vkDestroySampler(
     format::HandleId                            sampler,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySampler");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroySampler");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["sampler"], sampler, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("sampler"), sampler, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1128,14 +1192,15 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorSetLayout(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorSetLayout>* pSetLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorSetLayout");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateDescriptorSetLayout");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSetLayout"], pSetLayout, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSetLayout"), pSetLayout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1145,12 +1210,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorSetLayout(
     format::HandleId                            descriptorSetLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorSetLayout");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyDescriptorSetLayout");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorSetLayout"], descriptorSetLayout, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("descriptorSetLayout"), descriptorSetLayout, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1162,14 +1228,15 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorPool>*     pDescriptorPool)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorPool");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateDescriptorPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pDescriptorPool"], pDescriptorPool, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pDescriptorPool"), pDescriptorPool, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1179,12 +1246,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorPool(
     format::HandleId                            descriptorPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorPool");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyDescriptorPool");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorPool"], descriptorPool, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("descriptorPool"), descriptorPool, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1195,13 +1263,14 @@ void VulkanExportJsonConsumer::Process_vkResetDescriptorPool(
     format::HandleId                            descriptorPool,
     VkDescriptorPoolResetFlags                  flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetDescriptorPool");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkResetDescriptorPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorPool"], descriptorPool, json_options);
-        FieldToJson(VkDescriptorPoolResetFlags_t(), args["flags"], flags, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("descriptorPool"), descriptorPool, json_options);
+        FieldToJson(VkDescriptorPoolResetFlags_t(), writer.Key("flags"), flags, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1212,13 +1281,14 @@ void VulkanExportJsonConsumer::Process_vkAllocateDescriptorSets(
     StructPointerDecoder<Decoded_VkDescriptorSetAllocateInfo>* pAllocateInfo,
     HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAllocateDescriptorSets");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkAllocateDescriptorSets");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAllocateInfo"], pAllocateInfo, json_options);
-        HandleToJson(args["pDescriptorSets"], pDescriptorSets, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pAllocateInfo"), pAllocateInfo, json_options);
+        HandleToJson(writer.Key("pDescriptorSets"), pDescriptorSets, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1230,14 +1300,15 @@ void VulkanExportJsonConsumer::Process_vkFreeDescriptorSets(
     uint32_t                                    descriptorSetCount,
     HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFreeDescriptorSets");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkFreeDescriptorSets");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorPool"], descriptorPool, json_options);
-        FieldToJson(args["descriptorSetCount"], descriptorSetCount, json_options);
-        HandleToJson(args["pDescriptorSets"], pDescriptorSets, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("descriptorPool"), descriptorPool, json_options);
+        FieldToJson(writer.Key("descriptorSetCount"), descriptorSetCount, json_options);
+        HandleToJson(writer.Key("pDescriptorSets"), pDescriptorSets, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1249,14 +1320,15 @@ void VulkanExportJsonConsumer::Process_vkUpdateDescriptorSets(
     uint32_t                                    descriptorCopyCount,
     StructPointerDecoder<Decoded_VkCopyDescriptorSet>* pDescriptorCopies)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUpdateDescriptorSets");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkUpdateDescriptorSets");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["descriptorWriteCount"], descriptorWriteCount, json_options);
-        FieldToJson(args["pDescriptorWrites"], pDescriptorWrites, json_options);
-        FieldToJson(args["descriptorCopyCount"], descriptorCopyCount, json_options);
-        FieldToJson(args["pDescriptorCopies"], pDescriptorCopies, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("descriptorWriteCount"), descriptorWriteCount, json_options);
+        FieldToJson(writer.Key("pDescriptorWrites"), pDescriptorWrites, json_options);
+        FieldToJson(writer.Key("descriptorCopyCount"), descriptorCopyCount, json_options);
+        FieldToJson(writer.Key("pDescriptorCopies"), pDescriptorCopies, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1268,14 +1340,15 @@ void VulkanExportJsonConsumer::Process_vkCreateFramebuffer(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFramebuffer>*        pFramebuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateFramebuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateFramebuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pFramebuffer"], pFramebuffer, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pFramebuffer"), pFramebuffer, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1285,12 +1358,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyFramebuffer(
     format::HandleId                            framebuffer,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyFramebuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyFramebuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["framebuffer"], framebuffer, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("framebuffer"), framebuffer, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1302,14 +1376,15 @@ void VulkanExportJsonConsumer::Process_vkCreateRenderPass(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pRenderPass"], pRenderPass, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pRenderPass"), pRenderPass, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1319,12 +1394,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyRenderPass(
     format::HandleId                            renderPass,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyRenderPass");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["renderPass"], renderPass, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("renderPass"), renderPass, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1334,12 +1410,13 @@ void VulkanExportJsonConsumer::Process_vkGetRenderAreaGranularity(
     format::HandleId                            renderPass,
     StructPointerDecoder<Decoded_VkExtent2D>*   pGranularity)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRenderAreaGranularity");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetRenderAreaGranularity");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["renderPass"], renderPass, json_options);
-        FieldToJson(args["pGranularity"], pGranularity, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("renderPass"), renderPass, json_options);
+        FieldToJson(writer.Key("pGranularity"), pGranularity, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1351,14 +1428,15 @@ void VulkanExportJsonConsumer::Process_vkCreateCommandPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkCommandPool>*        pCommandPool)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateCommandPool");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pCommandPool"], pCommandPool, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pCommandPool"), pCommandPool, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1368,12 +1446,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyCommandPool(
     format::HandleId                            commandPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyCommandPool");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["commandPool"], commandPool, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("commandPool"), commandPool, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1384,13 +1463,14 @@ void VulkanExportJsonConsumer::Process_vkResetCommandPool(
     format::HandleId                            commandPool,
     VkCommandPoolResetFlags                     flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetCommandPool");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkResetCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["commandPool"], commandPool, json_options);
-        FieldToJson(VkCommandPoolResetFlags_t(), args["flags"], flags, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("commandPool"), commandPool, json_options);
+        FieldToJson(VkCommandPoolResetFlags_t(), writer.Key("flags"), flags, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1401,13 +1481,14 @@ void VulkanExportJsonConsumer::Process_vkAllocateCommandBuffers(
     StructPointerDecoder<Decoded_VkCommandBufferAllocateInfo>* pAllocateInfo,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAllocateCommandBuffers");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkAllocateCommandBuffers");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAllocateInfo"], pAllocateInfo, json_options);
-        HandleToJson(args["pCommandBuffers"], pCommandBuffers, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pAllocateInfo"), pAllocateInfo, json_options);
+        HandleToJson(writer.Key("pCommandBuffers"), pCommandBuffers, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1418,13 +1499,14 @@ void VulkanExportJsonConsumer::Process_vkFreeCommandBuffers(
     uint32_t                                    commandBufferCount,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFreeCommandBuffers");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkFreeCommandBuffers");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["commandPool"], commandPool, json_options);
-        FieldToJson(args["commandBufferCount"], commandBufferCount, json_options);
-        HandleToJson(args["pCommandBuffers"], pCommandBuffers, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("commandPool"), commandPool, json_options);
+        FieldToJson(writer.Key("commandBufferCount"), commandBufferCount, json_options);
+        HandleToJson(writer.Key("pCommandBuffers"), pCommandBuffers, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1434,12 +1516,13 @@ void VulkanExportJsonConsumer::Process_vkBeginCommandBuffer(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCommandBufferBeginInfo>* pBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBeginCommandBuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkBeginCommandBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBeginInfo"], pBeginInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pBeginInfo"), pBeginInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1448,11 +1531,12 @@ void VulkanExportJsonConsumer::Process_vkEndCommandBuffer(
     VkResult                                    returnValue,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEndCommandBuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkEndCommandBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1462,12 +1546,13 @@ void VulkanExportJsonConsumer::Process_vkResetCommandBuffer(
     format::HandleId                            commandBuffer,
     VkCommandBufferResetFlags                   flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetCommandBuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkResetCommandBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkCommandBufferResetFlags_t(), args["flags"], flags, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkCommandBufferResetFlags_t(), writer.Key("flags"), flags, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1477,13 +1562,14 @@ void VulkanExportJsonConsumer::Process_vkCmdBindPipeline(
     VkPipelineBindPoint                         pipelineBindPoint,
     format::HandleId                            pipeline)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindPipeline");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindPipeline");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineBindPoint"], pipelineBindPoint, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pipelineBindPoint"), pipelineBindPoint, json_options);
+        HandleToJson(writer.Key("pipeline"), pipeline, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1494,14 +1580,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewport(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewport");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetViewport");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstViewport"], firstViewport, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pViewports"], pViewports, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstViewport"), firstViewport, json_options);
+        FieldToJson(writer.Key("viewportCount"), viewportCount, json_options);
+        FieldToJson(writer.Key("pViewports"), pViewports, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1512,14 +1599,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetScissor(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetScissor");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetScissor");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstScissor"], firstScissor, json_options);
-        FieldToJson(args["scissorCount"], scissorCount, json_options);
-        FieldToJson(args["pScissors"], pScissors, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstScissor"), firstScissor, json_options);
+        FieldToJson(writer.Key("scissorCount"), scissorCount, json_options);
+        FieldToJson(writer.Key("pScissors"), pScissors, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1528,12 +1616,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineWidth(
     format::HandleId                            commandBuffer,
     float                                       lineWidth)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineWidth");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetLineWidth");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["lineWidth"], lineWidth, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("lineWidth"), lineWidth, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1544,14 +1633,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBias(
     float                                       depthBiasClamp,
     float                                       depthBiasSlopeFactor)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBias");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthBias");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["depthBiasConstantFactor"], depthBiasConstantFactor, json_options);
-        FieldToJson(args["depthBiasClamp"], depthBiasClamp, json_options);
-        FieldToJson(args["depthBiasSlopeFactor"], depthBiasSlopeFactor, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("depthBiasConstantFactor"), depthBiasConstantFactor, json_options);
+        FieldToJson(writer.Key("depthBiasClamp"), depthBiasClamp, json_options);
+        FieldToJson(writer.Key("depthBiasSlopeFactor"), depthBiasSlopeFactor, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1560,12 +1650,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetBlendConstants(
     format::HandleId                            commandBuffer,
     PointerDecoder<float>*                      blendConstants)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetBlendConstants");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetBlendConstants");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["blendConstants"], blendConstants, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("blendConstants"), blendConstants, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1575,13 +1666,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBounds(
     float                                       minDepthBounds,
     float                                       maxDepthBounds)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBounds");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthBounds");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["minDepthBounds"], minDepthBounds, json_options);
-        FieldToJson(args["maxDepthBounds"], maxDepthBounds, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("minDepthBounds"), minDepthBounds, json_options);
+        FieldToJson(writer.Key("maxDepthBounds"), maxDepthBounds, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1591,13 +1683,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilCompareMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    compareMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilCompareMask");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetStencilCompareMask");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkStencilFaceFlags_t(), args["faceMask"], faceMask, json_options);
-        FieldToJson(args["compareMask"], compareMask, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkStencilFaceFlags_t(), writer.Key("faceMask"), faceMask, json_options);
+        FieldToJson(writer.Key("compareMask"), compareMask, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1607,13 +1700,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilWriteMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    writeMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilWriteMask");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetStencilWriteMask");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkStencilFaceFlags_t(), args["faceMask"], faceMask, json_options);
-        FieldToJson(args["writeMask"], writeMask, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkStencilFaceFlags_t(), writer.Key("faceMask"), faceMask, json_options);
+        FieldToJson(writer.Key("writeMask"), writeMask, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1623,13 +1717,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilReference(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    reference)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilReference");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetStencilReference");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkStencilFaceFlags_t(), args["faceMask"], faceMask, json_options);
-        FieldToJson(args["reference"], reference, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkStencilFaceFlags_t(), writer.Key("faceMask"), faceMask, json_options);
+        FieldToJson(writer.Key("reference"), reference, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1644,18 +1739,19 @@ void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorSets(
     uint32_t                                    dynamicOffsetCount,
     PointerDecoder<uint32_t>*                   pDynamicOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorSets");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindDescriptorSets");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineBindPoint"], pipelineBindPoint, json_options);
-        HandleToJson(args["layout"], layout, json_options);
-        FieldToJson(args["firstSet"], firstSet, json_options);
-        FieldToJson(args["descriptorSetCount"], descriptorSetCount, json_options);
-        HandleToJson(args["pDescriptorSets"], pDescriptorSets, json_options);
-        FieldToJson(args["dynamicOffsetCount"], dynamicOffsetCount, json_options);
-        FieldToJson(args["pDynamicOffsets"], pDynamicOffsets, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pipelineBindPoint"), pipelineBindPoint, json_options);
+        HandleToJson(writer.Key("layout"), layout, json_options);
+        FieldToJson(writer.Key("firstSet"), firstSet, json_options);
+        FieldToJson(writer.Key("descriptorSetCount"), descriptorSetCount, json_options);
+        HandleToJson(writer.Key("pDescriptorSets"), pDescriptorSets, json_options);
+        FieldToJson(writer.Key("dynamicOffsetCount"), dynamicOffsetCount, json_options);
+        FieldToJson(writer.Key("pDynamicOffsets"), pDynamicOffsets, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1666,14 +1762,15 @@ void VulkanExportJsonConsumer::Process_vkCmdBindIndexBuffer(
     VkDeviceSize                                offset,
     VkIndexType                                 indexType)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindIndexBuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindIndexBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["indexType"], indexType, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        FieldToJson(writer.Key("indexType"), indexType, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1685,15 +1782,16 @@ void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers(
     HandlePointerDecoder<VkBuffer>*             pBuffers,
     PointerDecoder<VkDeviceSize>*               pOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstBinding"], firstBinding, json_options);
-        FieldToJson(args["bindingCount"], bindingCount, json_options);
-        HandleToJson(args["pBuffers"], pBuffers, json_options);
-        FieldToJson(args["pOffsets"], pOffsets, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstBinding"), firstBinding, json_options);
+        FieldToJson(writer.Key("bindingCount"), bindingCount, json_options);
+        HandleToJson(writer.Key("pBuffers"), pBuffers, json_options);
+        FieldToJson(writer.Key("pOffsets"), pOffsets, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1705,15 +1803,16 @@ void VulkanExportJsonConsumer::Process_vkCmdDraw(
     uint32_t                                    firstVertex,
     uint32_t                                    firstInstance)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDraw");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDraw");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["vertexCount"], vertexCount, json_options);
-        FieldToJson(args["instanceCount"], instanceCount, json_options);
-        FieldToJson(args["firstVertex"], firstVertex, json_options);
-        FieldToJson(args["firstInstance"], firstInstance, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("vertexCount"), vertexCount, json_options);
+        FieldToJson(writer.Key("instanceCount"), instanceCount, json_options);
+        FieldToJson(writer.Key("firstVertex"), firstVertex, json_options);
+        FieldToJson(writer.Key("firstInstance"), firstInstance, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1726,16 +1825,17 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexed(
     int32_t                                     vertexOffset,
     uint32_t                                    firstInstance)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexed");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawIndexed");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["indexCount"], indexCount, json_options);
-        FieldToJson(args["instanceCount"], instanceCount, json_options);
-        FieldToJson(args["firstIndex"], firstIndex, json_options);
-        FieldToJson(args["vertexOffset"], vertexOffset, json_options);
-        FieldToJson(args["firstInstance"], firstInstance, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("indexCount"), indexCount, json_options);
+        FieldToJson(writer.Key("instanceCount"), instanceCount, json_options);
+        FieldToJson(writer.Key("firstIndex"), firstIndex, json_options);
+        FieldToJson(writer.Key("vertexOffset"), vertexOffset, json_options);
+        FieldToJson(writer.Key("firstInstance"), firstInstance, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1747,15 +1847,16 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirect");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawIndirect");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        FieldToJson(writer.Key("drawCount"), drawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1767,15 +1868,16 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirect");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirect");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        FieldToJson(writer.Key("drawCount"), drawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1786,14 +1888,15 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatch(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatch");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDispatch");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["groupCountX"], groupCountX, json_options);
-        FieldToJson(args["groupCountY"], groupCountY, json_options);
-        FieldToJson(args["groupCountZ"], groupCountZ, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("groupCountX"), groupCountX, json_options);
+        FieldToJson(writer.Key("groupCountY"), groupCountY, json_options);
+        FieldToJson(writer.Key("groupCountZ"), groupCountZ, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1803,13 +1906,14 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatchIndirect(
     format::HandleId                            buffer,
     VkDeviceSize                                offset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatchIndirect");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDispatchIndirect");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1821,15 +1925,16 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferCopy>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcBuffer"], srcBuffer, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("srcBuffer"), srcBuffer, json_options);
+        HandleToJson(writer.Key("dstBuffer"), dstBuffer, json_options);
+        FieldToJson(writer.Key("regionCount"), regionCount, json_options);
+        FieldToJson(writer.Key("pRegions"), pRegions, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1843,17 +1948,18 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkImageCopy>*  pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyImage");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcImage"], srcImage, json_options);
-        FieldToJson(args["srcImageLayout"], srcImageLayout, json_options);
-        HandleToJson(args["dstImage"], dstImage, json_options);
-        FieldToJson(args["dstImageLayout"], dstImageLayout, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("srcImage"), srcImage, json_options);
+        FieldToJson(writer.Key("srcImageLayout"), srcImageLayout, json_options);
+        HandleToJson(writer.Key("dstImage"), dstImage, json_options);
+        FieldToJson(writer.Key("dstImageLayout"), dstImageLayout, json_options);
+        FieldToJson(writer.Key("regionCount"), regionCount, json_options);
+        FieldToJson(writer.Key("pRegions"), pRegions, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1868,18 +1974,19 @@ void VulkanExportJsonConsumer::Process_vkCmdBlitImage(
     StructPointerDecoder<Decoded_VkImageBlit>*  pRegions,
     VkFilter                                    filter)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBlitImage");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcImage"], srcImage, json_options);
-        FieldToJson(args["srcImageLayout"], srcImageLayout, json_options);
-        HandleToJson(args["dstImage"], dstImage, json_options);
-        FieldToJson(args["dstImageLayout"], dstImageLayout, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
-        FieldToJson(args["filter"], filter, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("srcImage"), srcImage, json_options);
+        FieldToJson(writer.Key("srcImageLayout"), srcImageLayout, json_options);
+        HandleToJson(writer.Key("dstImage"), dstImage, json_options);
+        FieldToJson(writer.Key("dstImageLayout"), dstImageLayout, json_options);
+        FieldToJson(writer.Key("regionCount"), regionCount, json_options);
+        FieldToJson(writer.Key("pRegions"), pRegions, json_options);
+        FieldToJson(writer.Key("filter"), filter, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1892,16 +1999,17 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcBuffer"], srcBuffer, json_options);
-        HandleToJson(args["dstImage"], dstImage, json_options);
-        FieldToJson(args["dstImageLayout"], dstImageLayout, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("srcBuffer"), srcBuffer, json_options);
+        HandleToJson(writer.Key("dstImage"), dstImage, json_options);
+        FieldToJson(writer.Key("dstImageLayout"), dstImageLayout, json_options);
+        FieldToJson(writer.Key("regionCount"), regionCount, json_options);
+        FieldToJson(writer.Key("pRegions"), pRegions, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1914,16 +2022,17 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcImage"], srcImage, json_options);
-        FieldToJson(args["srcImageLayout"], srcImageLayout, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("srcImage"), srcImage, json_options);
+        FieldToJson(writer.Key("srcImageLayout"), srcImageLayout, json_options);
+        HandleToJson(writer.Key("dstBuffer"), dstBuffer, json_options);
+        FieldToJson(writer.Key("regionCount"), regionCount, json_options);
+        FieldToJson(writer.Key("pRegions"), pRegions, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1935,15 +2044,16 @@ void VulkanExportJsonConsumer::Process_vkCmdUpdateBuffer(
     VkDeviceSize                                dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdUpdateBuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdUpdateBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["dstOffset"], dstOffset, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("dstBuffer"), dstBuffer, json_options);
+        FieldToJson(writer.Key("dstOffset"), dstOffset, json_options);
+        FieldToJson(writer.Key("dataSize"), dataSize, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1955,15 +2065,16 @@ void VulkanExportJsonConsumer::Process_vkCmdFillBuffer(
     VkDeviceSize                                size,
     uint32_t                                    data)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdFillBuffer");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdFillBuffer");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["dstOffset"], dstOffset, json_options);
-        FieldToJson(args["size"], size, json_options);
-        FieldToJson(args["data"], data, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("dstBuffer"), dstBuffer, json_options);
+        FieldToJson(writer.Key("dstOffset"), dstOffset, json_options);
+        FieldToJson(writer.Key("size"), size, json_options);
+        FieldToJson(writer.Key("data"), data, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1976,16 +2087,17 @@ void VulkanExportJsonConsumer::Process_vkCmdClearColorImage(
     uint32_t                                    rangeCount,
     StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdClearColorImage");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdClearColorImage");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["imageLayout"], imageLayout, json_options);
-        FieldToJson(args["pColor"], pColor, json_options);
-        FieldToJson(args["rangeCount"], rangeCount, json_options);
-        FieldToJson(args["pRanges"], pRanges, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("image"), image, json_options);
+        FieldToJson(writer.Key("imageLayout"), imageLayout, json_options);
+        FieldToJson(writer.Key("pColor"), pColor, json_options);
+        FieldToJson(writer.Key("rangeCount"), rangeCount, json_options);
+        FieldToJson(writer.Key("pRanges"), pRanges, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -1998,16 +2110,17 @@ void VulkanExportJsonConsumer::Process_vkCmdClearDepthStencilImage(
     uint32_t                                    rangeCount,
     StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdClearDepthStencilImage");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdClearDepthStencilImage");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["imageLayout"], imageLayout, json_options);
-        FieldToJson(args["pDepthStencil"], pDepthStencil, json_options);
-        FieldToJson(args["rangeCount"], rangeCount, json_options);
-        FieldToJson(args["pRanges"], pRanges, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("image"), image, json_options);
+        FieldToJson(writer.Key("imageLayout"), imageLayout, json_options);
+        FieldToJson(writer.Key("pDepthStencil"), pDepthStencil, json_options);
+        FieldToJson(writer.Key("rangeCount"), rangeCount, json_options);
+        FieldToJson(writer.Key("pRanges"), pRanges, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2019,15 +2132,16 @@ void VulkanExportJsonConsumer::Process_vkCmdClearAttachments(
     uint32_t                                    rectCount,
     StructPointerDecoder<Decoded_VkClearRect>*  pRects)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdClearAttachments");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdClearAttachments");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        FieldToJson(args["pAttachments"], pAttachments, json_options);
-        FieldToJson(args["rectCount"], rectCount, json_options);
-        FieldToJson(args["pRects"], pRects, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("attachmentCount"), attachmentCount, json_options);
+        FieldToJson(writer.Key("pAttachments"), pAttachments, json_options);
+        FieldToJson(writer.Key("rectCount"), rectCount, json_options);
+        FieldToJson(writer.Key("pRects"), pRects, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2041,17 +2155,18 @@ void VulkanExportJsonConsumer::Process_vkCmdResolveImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkImageResolve>* pRegions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdResolveImage");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["srcImage"], srcImage, json_options);
-        FieldToJson(args["srcImageLayout"], srcImageLayout, json_options);
-        HandleToJson(args["dstImage"], dstImage, json_options);
-        FieldToJson(args["dstImageLayout"], dstImageLayout, json_options);
-        FieldToJson(args["regionCount"], regionCount, json_options);
-        FieldToJson(args["pRegions"], pRegions, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("srcImage"), srcImage, json_options);
+        FieldToJson(writer.Key("srcImageLayout"), srcImageLayout, json_options);
+        HandleToJson(writer.Key("dstImage"), dstImage, json_options);
+        FieldToJson(writer.Key("dstImageLayout"), dstImageLayout, json_options);
+        FieldToJson(writer.Key("regionCount"), regionCount, json_options);
+        FieldToJson(writer.Key("pRegions"), pRegions, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2061,13 +2176,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetEvent(
     format::HandleId                            event,
     VkPipelineStageFlags                        stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["stageMask"], stageMask, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("event"), event, json_options);
+        FieldToJson(VkPipelineStageFlags_t(), writer.Key("stageMask"), stageMask, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2077,13 +2193,14 @@ void VulkanExportJsonConsumer::Process_vkCmdResetEvent(
     format::HandleId                            event,
     VkPipelineStageFlags                        stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdResetEvent");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["stageMask"], stageMask, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("event"), event, json_options);
+        FieldToJson(VkPipelineStageFlags_t(), writer.Key("stageMask"), stageMask, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2101,21 +2218,22 @@ void VulkanExportJsonConsumer::Process_vkCmdWaitEvents(
     uint32_t                                    imageMemoryBarrierCount,
     StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdWaitEvents");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["eventCount"], eventCount, json_options);
-        HandleToJson(args["pEvents"], pEvents, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["srcStageMask"], srcStageMask, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["dstStageMask"], dstStageMask, json_options);
-        FieldToJson(args["memoryBarrierCount"], memoryBarrierCount, json_options);
-        FieldToJson(args["pMemoryBarriers"], pMemoryBarriers, json_options);
-        FieldToJson(args["bufferMemoryBarrierCount"], bufferMemoryBarrierCount, json_options);
-        FieldToJson(args["pBufferMemoryBarriers"], pBufferMemoryBarriers, json_options);
-        FieldToJson(args["imageMemoryBarrierCount"], imageMemoryBarrierCount, json_options);
-        FieldToJson(args["pImageMemoryBarriers"], pImageMemoryBarriers, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("eventCount"), eventCount, json_options);
+        HandleToJson(writer.Key("pEvents"), pEvents, json_options);
+        FieldToJson(VkPipelineStageFlags_t(), writer.Key("srcStageMask"), srcStageMask, json_options);
+        FieldToJson(VkPipelineStageFlags_t(), writer.Key("dstStageMask"), dstStageMask, json_options);
+        FieldToJson(writer.Key("memoryBarrierCount"), memoryBarrierCount, json_options);
+        FieldToJson(writer.Key("pMemoryBarriers"), pMemoryBarriers, json_options);
+        FieldToJson(writer.Key("bufferMemoryBarrierCount"), bufferMemoryBarrierCount, json_options);
+        FieldToJson(writer.Key("pBufferMemoryBarriers"), pBufferMemoryBarriers, json_options);
+        FieldToJson(writer.Key("imageMemoryBarrierCount"), imageMemoryBarrierCount, json_options);
+        FieldToJson(writer.Key("pImageMemoryBarriers"), pImageMemoryBarriers, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2132,20 +2250,21 @@ void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier(
     uint32_t                                    imageMemoryBarrierCount,
     StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdPipelineBarrier");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["srcStageMask"], srcStageMask, json_options);
-        FieldToJson(VkPipelineStageFlags_t(), args["dstStageMask"], dstStageMask, json_options);
-        FieldToJson(VkDependencyFlags_t(), args["dependencyFlags"], dependencyFlags, json_options);
-        FieldToJson(args["memoryBarrierCount"], memoryBarrierCount, json_options);
-        FieldToJson(args["pMemoryBarriers"], pMemoryBarriers, json_options);
-        FieldToJson(args["bufferMemoryBarrierCount"], bufferMemoryBarrierCount, json_options);
-        FieldToJson(args["pBufferMemoryBarriers"], pBufferMemoryBarriers, json_options);
-        FieldToJson(args["imageMemoryBarrierCount"], imageMemoryBarrierCount, json_options);
-        FieldToJson(args["pImageMemoryBarriers"], pImageMemoryBarriers, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkPipelineStageFlags_t(), writer.Key("srcStageMask"), srcStageMask, json_options);
+        FieldToJson(VkPipelineStageFlags_t(), writer.Key("dstStageMask"), dstStageMask, json_options);
+        FieldToJson(VkDependencyFlags_t(), writer.Key("dependencyFlags"), dependencyFlags, json_options);
+        FieldToJson(writer.Key("memoryBarrierCount"), memoryBarrierCount, json_options);
+        FieldToJson(writer.Key("pMemoryBarriers"), pMemoryBarriers, json_options);
+        FieldToJson(writer.Key("bufferMemoryBarrierCount"), bufferMemoryBarrierCount, json_options);
+        FieldToJson(writer.Key("pBufferMemoryBarriers"), pBufferMemoryBarriers, json_options);
+        FieldToJson(writer.Key("imageMemoryBarrierCount"), imageMemoryBarrierCount, json_options);
+        FieldToJson(writer.Key("pImageMemoryBarriers"), pImageMemoryBarriers, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2156,14 +2275,15 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginQuery(
     uint32_t                                    query,
     VkQueryControlFlags                         flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginQuery");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBeginQuery");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
-        FieldToJson(VkQueryControlFlags_t(), args["flags"], flags, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("query"), query, json_options);
+        FieldToJson(VkQueryControlFlags_t(), writer.Key("flags"), flags, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2173,13 +2293,14 @@ void VulkanExportJsonConsumer::Process_vkCmdEndQuery(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndQuery");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEndQuery");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("query"), query, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2190,14 +2311,15 @@ void VulkanExportJsonConsumer::Process_vkCmdResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetQueryPool");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdResetQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-        FieldToJson(args["queryCount"], queryCount, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("firstQuery"), firstQuery, json_options);
+        FieldToJson(writer.Key("queryCount"), queryCount, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2208,14 +2330,15 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdWriteTimestamp");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineStage"], pipelineStage, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pipelineStage"), pipelineStage, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("query"), query, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2230,18 +2353,19 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyQueryPoolResults");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyQueryPoolResults");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-        FieldToJson(args["queryCount"], queryCount, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["dstOffset"], dstOffset, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-        FieldToJson(VkQueryResultFlags_t(), args["flags"], flags, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("firstQuery"), firstQuery, json_options);
+        FieldToJson(writer.Key("queryCount"), queryCount, json_options);
+        HandleToJson(writer.Key("dstBuffer"), dstBuffer, json_options);
+        FieldToJson(writer.Key("dstOffset"), dstOffset, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+        FieldToJson(VkQueryResultFlags_t(), writer.Key("flags"), flags, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2251,13 +2375,14 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     VkSubpassContents                           contents)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBeginRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRenderPassBegin"], pRenderPassBegin, json_options);
-        FieldToJson(args["contents"], contents, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pRenderPassBegin"), pRenderPassBegin, json_options);
+        FieldToJson(writer.Key("contents"), contents, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2266,12 +2391,13 @@ void VulkanExportJsonConsumer::Process_vkCmdNextSubpass(
     format::HandleId                            commandBuffer,
     VkSubpassContents                           contents)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdNextSubpass");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["contents"], contents, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("contents"), contents, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2279,11 +2405,12 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRenderPass(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEndRenderPass");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2293,13 +2420,14 @@ void VulkanExportJsonConsumer::Process_vkCmdExecuteCommands(
     uint32_t                                    commandBufferCount,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdExecuteCommands");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdExecuteCommands");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["commandBufferCount"], commandBufferCount, json_options);
-        HandleToJson(args["pCommandBuffers"], pCommandBuffers, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("commandBufferCount"), commandBufferCount, json_options);
+        HandleToJson(writer.Key("pCommandBuffers"), pCommandBuffers, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2310,13 +2438,14 @@ void VulkanExportJsonConsumer::Process_vkBindBufferMemory2(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkBindBufferMemory2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfos"], pBindInfos, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("bindInfoCount"), bindInfoCount, json_options);
+        FieldToJson(writer.Key("pBindInfos"), pBindInfos, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2327,13 +2456,14 @@ void VulkanExportJsonConsumer::Process_vkBindImageMemory2(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindImageMemory2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkBindImageMemory2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfos"], pBindInfos, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("bindInfoCount"), bindInfoCount, json_options);
+        FieldToJson(writer.Key("pBindInfos"), pBindInfos, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2345,14 +2475,15 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPeerMemoryFeatures(
     uint32_t                                    remoteDeviceIndex,
     PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeatures");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeatures");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["heapIndex"], heapIndex, json_options);
-        FieldToJson(args["localDeviceIndex"], localDeviceIndex, json_options);
-        FieldToJson(args["remoteDeviceIndex"], remoteDeviceIndex, json_options);
-        FieldToJson(args["pPeerMemoryFeatures"], pPeerMemoryFeatures, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("heapIndex"), heapIndex, json_options);
+        FieldToJson(writer.Key("localDeviceIndex"), localDeviceIndex, json_options);
+        FieldToJson(writer.Key("remoteDeviceIndex"), remoteDeviceIndex, json_options);
+        FieldToJson(writer.Key("pPeerMemoryFeatures"), pPeerMemoryFeatures, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2361,12 +2492,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDeviceMask(
     format::HandleId                            commandBuffer,
     uint32_t                                    deviceMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDeviceMask");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDeviceMask");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["deviceMask"], deviceMask, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("deviceMask"), deviceMask, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2380,17 +2512,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatchBase(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatchBase");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDispatchBase");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["baseGroupX"], baseGroupX, json_options);
-        FieldToJson(args["baseGroupY"], baseGroupY, json_options);
-        FieldToJson(args["baseGroupZ"], baseGroupZ, json_options);
-        FieldToJson(args["groupCountX"], groupCountX, json_options);
-        FieldToJson(args["groupCountY"], groupCountY, json_options);
-        FieldToJson(args["groupCountZ"], groupCountZ, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("baseGroupX"), baseGroupX, json_options);
+        FieldToJson(writer.Key("baseGroupY"), baseGroupY, json_options);
+        FieldToJson(writer.Key("baseGroupZ"), baseGroupZ, json_options);
+        FieldToJson(writer.Key("groupCountX"), groupCountX, json_options);
+        FieldToJson(writer.Key("groupCountY"), groupCountY, json_options);
+        FieldToJson(writer.Key("groupCountZ"), groupCountZ, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2401,13 +2534,14 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceGroups(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroups");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroups");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pPhysicalDeviceGroupCount"], pPhysicalDeviceGroupCount, json_options);
-        FieldToJson(args["pPhysicalDeviceGroupProperties"], pPhysicalDeviceGroupProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pPhysicalDeviceGroupCount"), pPhysicalDeviceGroupCount, json_options);
+        FieldToJson(writer.Key("pPhysicalDeviceGroupProperties"), pPhysicalDeviceGroupProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2417,12 +2551,13 @@ void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements2(
     StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2432,12 +2567,13 @@ void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements2(
     StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2448,13 +2584,14 @@ void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements2(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pSparseMemoryRequirementCount"], pSparseMemoryRequirementCount, json_options);
-        FieldToJson(args["pSparseMemoryRequirements"], pSparseMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pSparseMemoryRequirementCount"), pSparseMemoryRequirementCount, json_options);
+        FieldToJson(writer.Key("pSparseMemoryRequirements"), pSparseMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2463,11 +2600,12 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFeatures"], pFeatures, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pFeatures"), pFeatures, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2476,11 +2614,12 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2490,12 +2629,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties2(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["pFormatProperties"], pFormatProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("format"), format, json_options);
+        FieldToJson(writer.Key("pFormatProperties"), pFormatProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2506,13 +2646,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2
     StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
     StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pImageFormatInfo"], pImageFormatInfo, json_options);
-        FieldToJson(args["pImageFormatProperties"], pImageFormatProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pImageFormatInfo"), pImageFormatInfo, json_options);
+        FieldToJson(writer.Key("pImageFormatProperties"), pImageFormatProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2522,12 +2663,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pQueueFamilyPropertyCount"], pQueueFamilyPropertyCount, json_options);
-        FieldToJson(args["pQueueFamilyProperties"], pQueueFamilyProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pQueueFamilyPropertyCount"), pQueueFamilyPropertyCount, json_options);
+        FieldToJson(writer.Key("pQueueFamilyProperties"), pQueueFamilyProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2536,11 +2678,12 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pMemoryProperties"], pMemoryProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pMemoryProperties"), pMemoryProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2551,13 +2694,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFormatInfo"], pFormatInfo, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pFormatInfo"), pFormatInfo, json_options);
+        FieldToJson(writer.Key("pPropertyCount"), pPropertyCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2567,12 +2711,13 @@ void VulkanExportJsonConsumer::Process_vkTrimCommandPool(
     format::HandleId                            commandPool,
     VkCommandPoolTrimFlags                      flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkTrimCommandPool");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkTrimCommandPool");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["commandPool"], commandPool, json_options);
-        FieldToJson(VkCommandPoolTrimFlags_t(), args["flags"], flags, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("commandPool"), commandPool, json_options);
+        FieldToJson(VkCommandPoolTrimFlags_t(), writer.Key("flags"), flags, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2582,12 +2727,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceQueue2(
     StructPointerDecoder<Decoded_VkDeviceQueueInfo2>* pQueueInfo,
     HandlePointerDecoder<VkQueue>*              pQueue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceQueue2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceQueue2");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pQueueInfo"], pQueueInfo, json_options);
-        HandleToJson(args["pQueue"], pQueue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pQueueInfo"), pQueueInfo, json_options);
+        HandleToJson(writer.Key("pQueue"), pQueue, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2599,14 +2745,15 @@ void VulkanExportJsonConsumer::Process_vkCreateSamplerYcbcrConversion(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSamplerYcbcrConversion");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateSamplerYcbcrConversion");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pYcbcrConversion"], pYcbcrConversion, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pYcbcrConversion"), pYcbcrConversion, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2616,12 +2763,13 @@ void VulkanExportJsonConsumer::Process_vkDestroySamplerYcbcrConversion(
     format::HandleId                            ycbcrConversion,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySamplerYcbcrConversion");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroySamplerYcbcrConversion");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["ycbcrConversion"], ycbcrConversion, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("ycbcrConversion"), ycbcrConversion, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2633,14 +2781,15 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorUpdateTemplate(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorUpdateTemplate");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateDescriptorUpdateTemplate");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pDescriptorUpdateTemplate"], pDescriptorUpdateTemplate, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pDescriptorUpdateTemplate"), pDescriptorUpdateTemplate, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2650,12 +2799,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorUpdateTemplate(
     format::HandleId                            descriptorUpdateTemplate,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplate");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplate");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorUpdateTemplate"], descriptorUpdateTemplate, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("descriptorUpdateTemplate"), descriptorUpdateTemplate, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2665,12 +2815,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalBufferProperti
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
     StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferProperties");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalBufferInfo"], pExternalBufferInfo, json_options);
-        FieldToJson(args["pExternalBufferProperties"], pExternalBufferProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pExternalBufferInfo"), pExternalBufferInfo, json_options);
+        FieldToJson(writer.Key("pExternalBufferProperties"), pExternalBufferProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2680,12 +2831,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalFencePropertie
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
     StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalFenceProperties");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalFenceProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalFenceInfo"], pExternalFenceInfo, json_options);
-        FieldToJson(args["pExternalFenceProperties"], pExternalFenceProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pExternalFenceInfo"), pExternalFenceInfo, json_options);
+        FieldToJson(writer.Key("pExternalFenceProperties"), pExternalFenceProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2695,12 +2847,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalSemaphorePrope
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
     StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphoreProperties");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphoreProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalSemaphoreInfo"], pExternalSemaphoreInfo, json_options);
-        FieldToJson(args["pExternalSemaphoreProperties"], pExternalSemaphoreProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pExternalSemaphoreInfo"), pExternalSemaphoreInfo, json_options);
+        FieldToJson(writer.Key("pExternalSemaphoreProperties"), pExternalSemaphoreProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2710,12 +2863,13 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutSupport(
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutSupport");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutSupport");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pSupport"], pSupport, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pSupport"), pSupport, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2729,17 +2883,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCount");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawIndirectCount");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        HandleToJson(writer.Key("countBuffer"), countBuffer, json_options);
+        FieldToJson(writer.Key("countBufferOffset"), countBufferOffset, json_options);
+        FieldToJson(writer.Key("maxDrawCount"), maxDrawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2753,17 +2908,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCount");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCount");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        HandleToJson(writer.Key("countBuffer"), countBuffer, json_options);
+        FieldToJson(writer.Key("countBufferOffset"), countBufferOffset, json_options);
+        FieldToJson(writer.Key("maxDrawCount"), maxDrawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2775,14 +2931,15 @@ void VulkanExportJsonConsumer::Process_vkCreateRenderPass2(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateRenderPass2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pRenderPass"], pRenderPass, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pRenderPass"), pRenderPass, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2792,13 +2949,14 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass2(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBeginRenderPass2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRenderPassBegin"], pRenderPassBegin, json_options);
-        FieldToJson(args["pSubpassBeginInfo"], pSubpassBeginInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pRenderPassBegin"), pRenderPassBegin, json_options);
+        FieldToJson(writer.Key("pSubpassBeginInfo"), pSubpassBeginInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2808,13 +2966,14 @@ void VulkanExportJsonConsumer::Process_vkCmdNextSubpass2(
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdNextSubpass2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSubpassBeginInfo"], pSubpassBeginInfo, json_options);
-        FieldToJson(args["pSubpassEndInfo"], pSubpassEndInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pSubpassBeginInfo"), pSubpassBeginInfo, json_options);
+        FieldToJson(writer.Key("pSubpassEndInfo"), pSubpassEndInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2823,12 +2982,13 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRenderPass2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEndRenderPass2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSubpassEndInfo"], pSubpassEndInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pSubpassEndInfo"), pSubpassEndInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2839,13 +2999,14 @@ void VulkanExportJsonConsumer::Process_vkResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetQueryPool");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkResetQueryPool");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-        FieldToJson(args["queryCount"], queryCount, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("firstQuery"), firstQuery, json_options);
+        FieldToJson(writer.Key("queryCount"), queryCount, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2856,13 +3017,14 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreCounterValue(
     format::HandleId                            semaphore,
     PointerDecoder<uint64_t>*                   pValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreCounterValue");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetSemaphoreCounterValue");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["semaphore"], semaphore, json_options);
-        FieldToJson(args["pValue"], pValue, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("semaphore"), semaphore, json_options);
+        FieldToJson(writer.Key("pValue"), pValue, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2873,13 +3035,14 @@ void VulkanExportJsonConsumer::Process_vkWaitSemaphores(
     StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitSemaphores");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkWaitSemaphores");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pWaitInfo"], pWaitInfo, json_options);
-        FieldToJson(args["timeout"], timeout, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pWaitInfo"), pWaitInfo, json_options);
+        FieldToJson(writer.Key("timeout"), timeout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2889,12 +3052,13 @@ void VulkanExportJsonConsumer::Process_vkSignalSemaphore(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSignalSemaphore");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSignalSemaphore");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pSignalInfo"], pSignalInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pSignalInfo"), pSignalInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2904,12 +3068,13 @@ void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddress");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetBufferDeviceAddress");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJsonAsHex(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2919,12 +3084,13 @@ void VulkanExportJsonConsumer::Process_vkGetBufferOpaqueCaptureAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddress");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddress");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2934,12 +3100,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddress");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddress");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2950,13 +3117,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceToolProperties(
     PointerDecoder<uint32_t>*                   pToolCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceToolProperties>* pToolProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceToolProperties");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceToolProperties");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pToolCount"], pToolCount, json_options);
-        FieldToJson(args["pToolProperties"], pToolProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pToolCount"), pToolCount, json_options);
+        FieldToJson(writer.Key("pToolProperties"), pToolProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2968,14 +3136,15 @@ void VulkanExportJsonConsumer::Process_vkCreatePrivateDataSlot(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPrivateDataSlot>*    pPrivateDataSlot)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreatePrivateDataSlot");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreatePrivateDataSlot");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPrivateDataSlot"], pPrivateDataSlot, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pPrivateDataSlot"), pPrivateDataSlot, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -2985,12 +3154,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyPrivateDataSlot(
     format::HandleId                            privateDataSlot,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPrivateDataSlot");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyPrivateDataSlot");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("privateDataSlot"), privateDataSlot, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3003,15 +3173,16 @@ void VulkanExportJsonConsumer::Process_vkSetPrivateData(
     format::HandleId                            privateDataSlot,
     uint64_t                                    data)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetPrivateData");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSetPrivateData");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["objectType"], objectType, json_options);
-        HandleToJson(args["objectHandle"], objectHandle, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["data"], data, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("objectType"), objectType, json_options);
+        HandleToJson(writer.Key("objectHandle"), objectHandle, json_options);
+        HandleToJson(writer.Key("privateDataSlot"), privateDataSlot, json_options);
+        FieldToJson(writer.Key("data"), data, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3023,14 +3194,15 @@ void VulkanExportJsonConsumer::Process_vkGetPrivateData(
     format::HandleId                            privateDataSlot,
     PointerDecoder<uint64_t>*                   pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPrivateData");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPrivateData");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["objectType"], objectType, json_options);
-        HandleToJson(args["objectHandle"], objectHandle, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["pData"], pData, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("objectType"), objectType, json_options);
+        HandleToJson(writer.Key("objectHandle"), objectHandle, json_options);
+        HandleToJson(writer.Key("privateDataSlot"), privateDataSlot, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3040,13 +3212,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetEvent2(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetEvent2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(args["pDependencyInfo"], pDependencyInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("event"), event, json_options);
+        FieldToJson(writer.Key("pDependencyInfo"), pDependencyInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3056,13 +3229,14 @@ void VulkanExportJsonConsumer::Process_vkCmdResetEvent2(
     format::HandleId                            event,
     VkPipelineStageFlags2                       stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdResetEvent2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(VkPipelineStageFlags2_t(), args["stageMask"], stageMask, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("event"), event, json_options);
+        FieldToJson(VkPipelineStageFlags2_t(), writer.Key("stageMask"), stageMask, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3073,14 +3247,15 @@ void VulkanExportJsonConsumer::Process_vkCmdWaitEvents2(
     HandlePointerDecoder<VkEvent>*              pEvents,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdWaitEvents2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["eventCount"], eventCount, json_options);
-        HandleToJson(args["pEvents"], pEvents, json_options);
-        FieldToJson(args["pDependencyInfos"], pDependencyInfos, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("eventCount"), eventCount, json_options);
+        HandleToJson(writer.Key("pEvents"), pEvents, json_options);
+        FieldToJson(writer.Key("pDependencyInfos"), pDependencyInfos, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3089,12 +3264,13 @@ void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdPipelineBarrier2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pDependencyInfo"], pDependencyInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pDependencyInfo"), pDependencyInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3105,14 +3281,15 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp2(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdWriteTimestamp2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkPipelineStageFlags2_t(), args["stage"], stage, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkPipelineStageFlags2_t(), writer.Key("stage"), stage, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("query"), query, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3124,15 +3301,16 @@ void VulkanExportJsonConsumer::Process_vkQueueSubmit2(
     StructPointerDecoder<Decoded_VkSubmitInfo2>* pSubmits,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSubmit2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkQueueSubmit2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["submitCount"], submitCount, json_options);
-        FieldToJson(args["pSubmits"], pSubmits, json_options);
-        HandleToJson(args["fence"], fence, json_options);
+    FieldToJson(writer.Key(NameSubmitIndex()), ++submit_index_, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+        FieldToJson(writer.Key("submitCount"), submitCount, json_options);
+        FieldToJson(writer.Key("pSubmits"), pSubmits, json_options);
+        HandleToJson(writer.Key("fence"), fence, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3141,12 +3319,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferInfo2>* pCopyBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyBuffer2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyBufferInfo"], pCopyBufferInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pCopyBufferInfo"), pCopyBufferInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3155,12 +3334,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageInfo2>* pCopyImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyImage2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyImageInfo"], pCopyImageInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pCopyImageInfo"), pCopyImageInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3169,12 +3349,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferToImageInfo2>* pCopyBufferToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyBufferToImageInfo"], pCopyBufferToImageInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pCopyBufferToImageInfo"), pCopyBufferToImageInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3183,12 +3364,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageToBufferInfo2>* pCopyImageToBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyImageToBufferInfo"], pCopyImageToBufferInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pCopyImageToBufferInfo"), pCopyImageToBufferInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3197,12 +3379,13 @@ void VulkanExportJsonConsumer::Process_vkCmdBlitImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBlitImageInfo2>* pBlitImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBlitImage2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBlitImageInfo"], pBlitImageInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pBlitImageInfo"), pBlitImageInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3211,12 +3394,13 @@ void VulkanExportJsonConsumer::Process_vkCmdResolveImage2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkResolveImageInfo2>* pResolveImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdResolveImage2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pResolveImageInfo"], pResolveImageInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pResolveImageInfo"), pResolveImageInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3225,12 +3409,13 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRendering(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingInfo>* pRenderingInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRendering");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBeginRendering");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRenderingInfo"], pRenderingInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pRenderingInfo"), pRenderingInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3238,11 +3423,12 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRendering(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRendering");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEndRendering");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3251,12 +3437,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCullMode(
     format::HandleId                            commandBuffer,
     VkCullModeFlags                             cullMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCullMode");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetCullMode");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkCullModeFlags_t(), args["cullMode"], cullMode, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkCullModeFlags_t(), writer.Key("cullMode"), cullMode, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3265,12 +3452,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFrontFace(
     format::HandleId                            commandBuffer,
     VkFrontFace                                 frontFace)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFrontFace");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetFrontFace");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["frontFace"], frontFace, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("frontFace"), frontFace, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3279,12 +3467,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveTopology(
     format::HandleId                            commandBuffer,
     VkPrimitiveTopology                         primitiveTopology)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveTopology");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetPrimitiveTopology");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["primitiveTopology"], primitiveTopology, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("primitiveTopology"), primitiveTopology, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3294,13 +3483,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWithCount(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWithCount");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetViewportWithCount");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pViewports"], pViewports, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("viewportCount"), viewportCount, json_options);
+        FieldToJson(writer.Key("pViewports"), pViewports, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3310,13 +3500,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetScissorWithCount(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetScissorWithCount");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetScissorWithCount");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["scissorCount"], scissorCount, json_options);
-        FieldToJson(args["pScissors"], pScissors, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("scissorCount"), scissorCount, json_options);
+        FieldToJson(writer.Key("pScissors"), pScissors, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3330,17 +3521,18 @@ void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers2(
     PointerDecoder<VkDeviceSize>*               pSizes,
     PointerDecoder<VkDeviceSize>*               pStrides)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers2");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers2");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstBinding"], firstBinding, json_options);
-        FieldToJson(args["bindingCount"], bindingCount, json_options);
-        HandleToJson(args["pBuffers"], pBuffers, json_options);
-        FieldToJson(args["pOffsets"], pOffsets, json_options);
-        FieldToJson(args["pSizes"], pSizes, json_options);
-        FieldToJson(args["pStrides"], pStrides, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstBinding"), firstBinding, json_options);
+        FieldToJson(writer.Key("bindingCount"), bindingCount, json_options);
+        HandleToJson(writer.Key("pBuffers"), pBuffers, json_options);
+        FieldToJson(writer.Key("pOffsets"), pOffsets, json_options);
+        FieldToJson(writer.Key("pSizes"), pSizes, json_options);
+        FieldToJson(writer.Key("pStrides"), pStrides, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3349,12 +3541,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthTestEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthTestEnable");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthTestEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthTestEnable"], depthTestEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("depthTestEnable"), depthTestEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3363,12 +3556,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthWriteEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthWriteEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthWriteEnable");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthWriteEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthWriteEnable"], depthWriteEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("depthWriteEnable"), depthWriteEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3377,12 +3571,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthCompareOp(
     format::HandleId                            commandBuffer,
     VkCompareOp                                 depthCompareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthCompareOp");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthCompareOp");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["depthCompareOp"], depthCompareOp, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("depthCompareOp"), depthCompareOp, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3391,12 +3586,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBoundsTestEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBoundsTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnable");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthBoundsTestEnable"], depthBoundsTestEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("depthBoundsTestEnable"), depthBoundsTestEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3405,12 +3601,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilTestEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    stencilTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilTestEnable");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetStencilTestEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["stencilTestEnable"], stencilTestEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("stencilTestEnable"), stencilTestEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3423,16 +3620,17 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilOp(
     VkStencilOp                                 depthFailOp,
     VkCompareOp                                 compareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilOp");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetStencilOp");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkStencilFaceFlags_t(), args["faceMask"], faceMask, json_options);
-        FieldToJson(args["failOp"], failOp, json_options);
-        FieldToJson(args["passOp"], passOp, json_options);
-        FieldToJson(args["depthFailOp"], depthFailOp, json_options);
-        FieldToJson(args["compareOp"], compareOp, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkStencilFaceFlags_t(), writer.Key("faceMask"), faceMask, json_options);
+        FieldToJson(writer.Key("failOp"), failOp, json_options);
+        FieldToJson(writer.Key("passOp"), passOp, json_options);
+        FieldToJson(writer.Key("depthFailOp"), depthFailOp, json_options);
+        FieldToJson(writer.Key("compareOp"), compareOp, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3441,12 +3639,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizerDiscardEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    rasterizerDiscardEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnable");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["rasterizerDiscardEnable"], rasterizerDiscardEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("rasterizerDiscardEnable"), rasterizerDiscardEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3455,12 +3654,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBiasEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBiasEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBiasEnable");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthBiasEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthBiasEnable"], depthBiasEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("depthBiasEnable"), depthBiasEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3469,12 +3669,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveRestartEnable(
     format::HandleId                            commandBuffer,
     VkBool32                                    primitiveRestartEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnable");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnable");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["primitiveRestartEnable"], primitiveRestartEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("primitiveRestartEnable"), primitiveRestartEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3484,12 +3685,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceBufferMemoryRequirements(
     StructPointerDecoder<Decoded_VkDeviceBufferMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirements");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3499,12 +3701,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageMemoryRequirements(
     StructPointerDecoder<Decoded_VkDeviceImageMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageMemoryRequirements");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceImageMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3515,13 +3718,14 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageSparseMemoryRequirements(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirements");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirements");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pSparseMemoryRequirementCount"], pSparseMemoryRequirementCount, json_options);
-        FieldToJson(args["pSparseMemoryRequirements"], pSparseMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pSparseMemoryRequirementCount"), pSparseMemoryRequirementCount, json_options);
+        FieldToJson(writer.Key("pSparseMemoryRequirements"), pSparseMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3531,12 +3735,13 @@ void VulkanExportJsonConsumer::Process_vkDestroySurfaceKHR(
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySurfaceKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroySurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        HandleToJson(writer.Key("surface"), surface, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3548,14 +3753,15 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceSupportKHR(
     format::HandleId                            surface,
     PointerDecoder<VkBool32>*                   pSupported)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceSupportKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        Bool32ToJson(args["pSupported"], pSupported, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("queueFamilyIndex"), queueFamilyIndex, json_options);
+        HandleToJson(writer.Key("surface"), surface, json_options);
+        Bool32ToJson(writer.Key("pSupported"), pSupported, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3566,13 +3772,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilitiesKHR
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkSurfaceCapabilitiesKHR>* pSurfaceCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pSurfaceCapabilities"], pSurfaceCapabilities, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        HandleToJson(writer.Key("surface"), surface, json_options);
+        FieldToJson(writer.Key("pSurfaceCapabilities"), pSurfaceCapabilities, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3584,14 +3791,15 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceFormatsKHR(
     PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
     StructPointerDecoder<Decoded_VkSurfaceFormatKHR>* pSurfaceFormats)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormatsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormatsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pSurfaceFormatCount"], pSurfaceFormatCount, json_options);
-        FieldToJson(args["pSurfaceFormats"], pSurfaceFormats, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        HandleToJson(writer.Key("surface"), surface, json_options);
+        FieldToJson(writer.Key("pSurfaceFormatCount"), pSurfaceFormatCount, json_options);
+        FieldToJson(writer.Key("pSurfaceFormats"), pSurfaceFormats, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3603,14 +3811,15 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfacePresentModesKHR
     PointerDecoder<uint32_t>*                   pPresentModeCount,
     PointerDecoder<VkPresentModeKHR>*           pPresentModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pPresentModeCount"], pPresentModeCount, json_options);
-        FieldToJson(args["pPresentModes"], pPresentModes, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        HandleToJson(writer.Key("surface"), surface, json_options);
+        FieldToJson(writer.Key("pPresentModeCount"), pPresentModeCount, json_options);
+        FieldToJson(writer.Key("pPresentModes"), pPresentModes, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3622,14 +3831,15 @@ void VulkanExportJsonConsumer::Process_vkCreateSwapchainKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSwapchainKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateSwapchainKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSwapchain"], pSwapchain, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSwapchain"), pSwapchain, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3639,12 +3849,13 @@ void VulkanExportJsonConsumer::Process_vkDestroySwapchainKHR(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySwapchainKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroySwapchainKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3656,14 +3867,15 @@ void VulkanExportJsonConsumer::Process_vkGetSwapchainImagesKHR(
     PointerDecoder<uint32_t>*                   pSwapchainImageCount,
     HandlePointerDecoder<VkImage>*              pSwapchainImages)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSwapchainImagesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetSwapchainImagesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pSwapchainImageCount"], pSwapchainImageCount, json_options);
-        HandleToJson(args["pSwapchainImages"], pSwapchainImages, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+        FieldToJson(writer.Key("pSwapchainImageCount"), pSwapchainImageCount, json_options);
+        HandleToJson(writer.Key("pSwapchainImages"), pSwapchainImages, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3677,16 +3889,17 @@ void VulkanExportJsonConsumer::Process_vkAcquireNextImageKHR(
     format::HandleId                            fence,
     PointerDecoder<uint32_t>*                   pImageIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireNextImageKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkAcquireNextImageKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["timeout"], timeout, json_options);
-        HandleToJson(args["semaphore"], semaphore, json_options);
-        HandleToJson(args["fence"], fence, json_options);
-        FieldToJson(args["pImageIndex"], pImageIndex, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+        FieldToJson(writer.Key("timeout"), timeout, json_options);
+        HandleToJson(writer.Key("semaphore"), semaphore, json_options);
+        HandleToJson(writer.Key("fence"), fence, json_options);
+        FieldToJson(writer.Key("pImageIndex"), pImageIndex, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3696,13 +3909,14 @@ void VulkanExportJsonConsumer::Process_vkQueuePresentKHR(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkPresentInfoKHR>* pPresentInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueuePresentKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkQueuePresentKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pPresentInfo"], pPresentInfo, json_options);
+    FieldToJson(writer.Key(NameSubmitIndex()), ++submit_index_, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+        FieldToJson(writer.Key("pPresentInfo"), pPresentInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3712,12 +3926,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPresentCapabilitiesKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceGroupPresentCapabilitiesKHR>* pDeviceGroupPresentCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPresentCapabilitiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceGroupPresentCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pDeviceGroupPresentCapabilities"], pDeviceGroupPresentCapabilities, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pDeviceGroupPresentCapabilities"), pDeviceGroupPresentCapabilities, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3728,13 +3943,14 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupSurfacePresentModesKHR(
     format::HandleId                            surface,
     PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pModes"], pModes, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("surface"), surface, json_options);
+        FieldToJson(writer.Key("pModes"), pModes, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3746,14 +3962,15 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDevicePresentRectanglesKHR(
     PointerDecoder<uint32_t>*                   pRectCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pRects)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDevicePresentRectanglesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDevicePresentRectanglesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pRectCount"], pRectCount, json_options);
-        FieldToJson(args["pRects"], pRects, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        HandleToJson(writer.Key("surface"), surface, json_options);
+        FieldToJson(writer.Key("pRectCount"), pRectCount, json_options);
+        FieldToJson(writer.Key("pRects"), pRects, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3764,13 +3981,14 @@ void VulkanExportJsonConsumer::Process_vkAcquireNextImage2KHR(
     StructPointerDecoder<Decoded_VkAcquireNextImageInfoKHR>* pAcquireInfo,
     PointerDecoder<uint32_t>*                   pImageIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireNextImage2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkAcquireNextImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAcquireInfo"], pAcquireInfo, json_options);
-        FieldToJson(args["pImageIndex"], pImageIndex, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pAcquireInfo"), pAcquireInfo, json_options);
+        FieldToJson(writer.Key("pImageIndex"), pImageIndex, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3781,13 +3999,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pPropertyCount"), pPropertyCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3798,13 +4017,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPlanePropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pPropertyCount"), pPropertyCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3816,14 +4036,15 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneSupportedDisplaysKHR(
     PointerDecoder<uint32_t>*                   pDisplayCount,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplays)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneSupportedDisplaysKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDisplayPlaneSupportedDisplaysKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["planeIndex"], planeIndex, json_options);
-        FieldToJson(args["pDisplayCount"], pDisplayCount, json_options);
-        HandleToJson(args["pDisplays"], pDisplays, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("planeIndex"), planeIndex, json_options);
+        FieldToJson(writer.Key("pDisplayCount"), pDisplayCount, json_options);
+        HandleToJson(writer.Key("pDisplays"), pDisplays, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3835,14 +4056,15 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayModePropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayModePropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayModePropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDisplayModePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["display"], display, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        HandleToJson(writer.Key("display"), display, json_options);
+        FieldToJson(writer.Key("pPropertyCount"), pPropertyCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3855,15 +4077,16 @@ void VulkanExportJsonConsumer::Process_vkCreateDisplayModeKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDisplayModeKHR>*     pMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDisplayModeKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateDisplayModeKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["display"], display, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pMode"], pMode, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        HandleToJson(writer.Key("display"), display, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pMode"), pMode, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3875,14 +4098,15 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneCapabilitiesKHR(
     uint32_t                                    planeIndex,
     StructPointerDecoder<Decoded_VkDisplayPlaneCapabilitiesKHR>* pCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneCapabilitiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDisplayPlaneCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["mode"], mode, json_options);
-        FieldToJson(args["planeIndex"], planeIndex, json_options);
-        FieldToJson(args["pCapabilities"], pCapabilities, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        HandleToJson(writer.Key("mode"), mode, json_options);
+        FieldToJson(writer.Key("planeIndex"), planeIndex, json_options);
+        FieldToJson(writer.Key("pCapabilities"), pCapabilities, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3894,14 +4118,15 @@ void VulkanExportJsonConsumer::Process_vkCreateDisplayPlaneSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDisplayPlaneSurfaceKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateDisplayPlaneSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3914,15 +4139,16 @@ void VulkanExportJsonConsumer::Process_vkCreateSharedSwapchainsKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSharedSwapchainsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateSharedSwapchainsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["swapchainCount"], swapchainCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSwapchains"], pSwapchains, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("swapchainCount"), swapchainCount, json_options);
+        FieldToJson(writer.Key("pCreateInfos"), pCreateInfos, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSwapchains"), pSwapchains, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3934,14 +4160,15 @@ void VulkanExportJsonConsumer::Process_vkCreateXlibSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateXlibSurfaceKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateXlibSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3953,14 +4180,15 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceXlibPresentationSuppor
     uint64_t                                    dpy,
     size_t                                      visualID)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceXlibPresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["dpy"], dpy, json_options);
-        FieldToJson(args["visualID"], visualID, json_options);
+            Bool32ToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("queueFamilyIndex"), queueFamilyIndex, json_options);
+        FieldToJson(writer.Key("dpy"), dpy, json_options);
+        FieldToJson(writer.Key("visualID"), visualID, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3972,14 +4200,15 @@ void VulkanExportJsonConsumer::Process_vkCreateXcbSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateXcbSurfaceKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateXcbSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -3991,14 +4220,15 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceXcbPresentationSupport
     uint64_t                                    connection,
     uint32_t                                    visual_id)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceXcbPresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["connection"], connection, json_options);
-        FieldToJson(args["visual_id"], visual_id, json_options);
+            Bool32ToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("queueFamilyIndex"), queueFamilyIndex, json_options);
+        FieldToJson(writer.Key("connection"), connection, json_options);
+        FieldToJson(writer.Key("visual_id"), visual_id, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4010,14 +4240,15 @@ void VulkanExportJsonConsumer::Process_vkCreateWaylandSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateWaylandSurfaceKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateWaylandSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4028,13 +4259,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceWaylandPresentationSup
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["display"], display, json_options);
+            Bool32ToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("queueFamilyIndex"), queueFamilyIndex, json_options);
+        FieldToJson(writer.Key("display"), display, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4046,14 +4278,15 @@ void VulkanExportJsonConsumer::Process_vkCreateAndroidSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateAndroidSurfaceKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateAndroidSurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4065,14 +4298,15 @@ void VulkanExportJsonConsumer::Process_vkCreateWin32SurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateWin32SurfaceKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateWin32SurfaceKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4082,12 +4316,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceWin32PresentationSuppo
     format::HandleId                            physicalDevice,
     uint32_t                                    queueFamilyIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceWin32PresentationSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
+            Bool32ToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("queueFamilyIndex"), queueFamilyIndex, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4098,13 +4333,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoCapabilitiesKHR(
     StructPointerDecoder<Decoded_VkVideoProfileInfoKHR>* pVideoProfile,
     StructPointerDecoder<Decoded_VkVideoCapabilitiesKHR>* pCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoCapabilitiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoCapabilitiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pVideoProfile"], pVideoProfile, json_options);
-        FieldToJson(args["pCapabilities"], pCapabilities, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pVideoProfile"), pVideoProfile, json_options);
+        FieldToJson(writer.Key("pCapabilities"), pCapabilities, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4116,14 +4352,15 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoFormatPropertiesK
     PointerDecoder<uint32_t>*                   pVideoFormatPropertyCount,
     StructPointerDecoder<Decoded_VkVideoFormatPropertiesKHR>* pVideoFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoFormatPropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoFormatPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pVideoFormatInfo"], pVideoFormatInfo, json_options);
-        FieldToJson(args["pVideoFormatPropertyCount"], pVideoFormatPropertyCount, json_options);
-        FieldToJson(args["pVideoFormatProperties"], pVideoFormatProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pVideoFormatInfo"), pVideoFormatInfo, json_options);
+        FieldToJson(writer.Key("pVideoFormatPropertyCount"), pVideoFormatPropertyCount, json_options);
+        FieldToJson(writer.Key("pVideoFormatProperties"), pVideoFormatProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4135,14 +4372,15 @@ void VulkanExportJsonConsumer::Process_vkCreateVideoSessionKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkVideoSessionKHR>*    pVideoSession)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateVideoSessionKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateVideoSessionKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pVideoSession"], pVideoSession, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pVideoSession"), pVideoSession, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4152,12 +4390,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyVideoSessionKHR(
     format::HandleId                            videoSession,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyVideoSessionKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyVideoSessionKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["videoSession"], videoSession, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("videoSession"), videoSession, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4169,14 +4408,15 @@ void VulkanExportJsonConsumer::Process_vkGetVideoSessionMemoryRequirementsKHR(
     PointerDecoder<uint32_t>*                   pMemoryRequirementsCount,
     StructPointerDecoder<Decoded_VkVideoSessionMemoryRequirementsKHR>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetVideoSessionMemoryRequirementsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetVideoSessionMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["videoSession"], videoSession, json_options);
-        FieldToJson(args["pMemoryRequirementsCount"], pMemoryRequirementsCount, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("videoSession"), videoSession, json_options);
+        FieldToJson(writer.Key("pMemoryRequirementsCount"), pMemoryRequirementsCount, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4188,14 +4428,15 @@ void VulkanExportJsonConsumer::Process_vkBindVideoSessionMemoryKHR(
     uint32_t                                    bindSessionMemoryInfoCount,
     StructPointerDecoder<Decoded_VkBindVideoSessionMemoryInfoKHR>* pBindSessionMemoryInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindVideoSessionMemoryKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkBindVideoSessionMemoryKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["videoSession"], videoSession, json_options);
-        FieldToJson(args["bindSessionMemoryInfoCount"], bindSessionMemoryInfoCount, json_options);
-        FieldToJson(args["pBindSessionMemoryInfos"], pBindSessionMemoryInfos, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("videoSession"), videoSession, json_options);
+        FieldToJson(writer.Key("bindSessionMemoryInfoCount"), bindSessionMemoryInfoCount, json_options);
+        FieldToJson(writer.Key("pBindSessionMemoryInfos"), pBindSessionMemoryInfos, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4207,14 +4448,15 @@ void VulkanExportJsonConsumer::Process_vkCreateVideoSessionParametersKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkVideoSessionParametersKHR>* pVideoSessionParameters)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateVideoSessionParametersKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateVideoSessionParametersKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pVideoSessionParameters"], pVideoSessionParameters, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pVideoSessionParameters"), pVideoSessionParameters, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4225,13 +4467,14 @@ void VulkanExportJsonConsumer::Process_vkUpdateVideoSessionParametersKHR(
     format::HandleId                            videoSessionParameters,
     StructPointerDecoder<Decoded_VkVideoSessionParametersUpdateInfoKHR>* pUpdateInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUpdateVideoSessionParametersKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkUpdateVideoSessionParametersKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["videoSessionParameters"], videoSessionParameters, json_options);
-        FieldToJson(args["pUpdateInfo"], pUpdateInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("videoSessionParameters"), videoSessionParameters, json_options);
+        FieldToJson(writer.Key("pUpdateInfo"), pUpdateInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4241,12 +4484,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyVideoSessionParametersKHR(
     format::HandleId                            videoSessionParameters,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyVideoSessionParametersKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyVideoSessionParametersKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["videoSessionParameters"], videoSessionParameters, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("videoSessionParameters"), videoSessionParameters, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4255,12 +4499,13 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginVideoCodingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoBeginCodingInfoKHR>* pBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginVideoCodingKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBeginVideoCodingKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBeginInfo"], pBeginInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pBeginInfo"), pBeginInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4269,12 +4514,13 @@ void VulkanExportJsonConsumer::Process_vkCmdEndVideoCodingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoEndCodingInfoKHR>* pEndCodingInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndVideoCodingKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEndVideoCodingKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pEndCodingInfo"], pEndCodingInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pEndCodingInfo"), pEndCodingInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4283,12 +4529,13 @@ void VulkanExportJsonConsumer::Process_vkCmdControlVideoCodingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoCodingControlInfoKHR>* pCodingControlInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdControlVideoCodingKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdControlVideoCodingKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCodingControlInfo"], pCodingControlInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pCodingControlInfo"), pCodingControlInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4297,12 +4544,13 @@ void VulkanExportJsonConsumer::Process_vkCmdDecodeVideoKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoDecodeInfoKHR>* pDecodeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDecodeVideoKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDecodeVideoKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pDecodeInfo"], pDecodeInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pDecodeInfo"), pDecodeInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4311,12 +4559,13 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderingKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingInfo>* pRenderingInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderingKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBeginRenderingKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRenderingInfo"], pRenderingInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pRenderingInfo"), pRenderingInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4324,11 +4573,12 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRenderingKHR(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderingKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEndRenderingKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4337,11 +4587,12 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFeatures2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFeatures2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFeatures"], pFeatures, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pFeatures"), pFeatures, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4350,11 +4601,12 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceProperties2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4364,12 +4616,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFormatProperties2KHR(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFormatProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["pFormatProperties"], pFormatProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("format"), format, json_options);
+        FieldToJson(writer.Key("pFormatProperties"), pFormatProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4380,13 +4633,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2
     StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
     StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceImageFormatProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pImageFormatInfo"], pImageFormatInfo, json_options);
-        FieldToJson(args["pImageFormatProperties"], pImageFormatProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pImageFormatInfo"), pImageFormatInfo, json_options);
+        FieldToJson(writer.Key("pImageFormatProperties"), pImageFormatProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4396,12 +4650,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pQueueFamilyPropertyCount"], pQueueFamilyPropertyCount, json_options);
-        FieldToJson(args["pQueueFamilyProperties"], pQueueFamilyProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pQueueFamilyPropertyCount"), pQueueFamilyPropertyCount, json_options);
+        FieldToJson(writer.Key("pQueueFamilyProperties"), pQueueFamilyProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4410,11 +4665,12 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMemoryProperties2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMemoryProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pMemoryProperties"], pMemoryProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pMemoryProperties"), pMemoryProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4425,13 +4681,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSparseImageFormatPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFormatInfo"], pFormatInfo, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pFormatInfo"), pFormatInfo, json_options);
+        FieldToJson(writer.Key("pPropertyCount"), pPropertyCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4443,14 +4700,15 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupPeerMemoryFeaturesKHR(
     uint32_t                                    remoteDeviceIndex,
     PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceGroupPeerMemoryFeaturesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["heapIndex"], heapIndex, json_options);
-        FieldToJson(args["localDeviceIndex"], localDeviceIndex, json_options);
-        FieldToJson(args["remoteDeviceIndex"], remoteDeviceIndex, json_options);
-        FieldToJson(args["pPeerMemoryFeatures"], pPeerMemoryFeatures, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("heapIndex"), heapIndex, json_options);
+        FieldToJson(writer.Key("localDeviceIndex"), localDeviceIndex, json_options);
+        FieldToJson(writer.Key("remoteDeviceIndex"), remoteDeviceIndex, json_options);
+        FieldToJson(writer.Key("pPeerMemoryFeatures"), pPeerMemoryFeatures, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4459,12 +4717,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDeviceMaskKHR(
     format::HandleId                            commandBuffer,
     uint32_t                                    deviceMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDeviceMaskKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDeviceMaskKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["deviceMask"], deviceMask, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("deviceMask"), deviceMask, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4478,17 +4737,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDispatchBaseKHR(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDispatchBaseKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDispatchBaseKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["baseGroupX"], baseGroupX, json_options);
-        FieldToJson(args["baseGroupY"], baseGroupY, json_options);
-        FieldToJson(args["baseGroupZ"], baseGroupZ, json_options);
-        FieldToJson(args["groupCountX"], groupCountX, json_options);
-        FieldToJson(args["groupCountY"], groupCountY, json_options);
-        FieldToJson(args["groupCountZ"], groupCountZ, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("baseGroupX"), baseGroupX, json_options);
+        FieldToJson(writer.Key("baseGroupY"), baseGroupY, json_options);
+        FieldToJson(writer.Key("baseGroupZ"), baseGroupZ, json_options);
+        FieldToJson(writer.Key("groupCountX"), groupCountX, json_options);
+        FieldToJson(writer.Key("groupCountY"), groupCountY, json_options);
+        FieldToJson(writer.Key("groupCountZ"), groupCountZ, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4498,12 +4758,13 @@ void VulkanExportJsonConsumer::Process_vkTrimCommandPoolKHR(
     format::HandleId                            commandPool,
     VkCommandPoolTrimFlags                      flags)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkTrimCommandPoolKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkTrimCommandPoolKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["commandPool"], commandPool, json_options);
-        FieldToJson(VkCommandPoolTrimFlags_t(), args["flags"], flags, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("commandPool"), commandPool, json_options);
+        FieldToJson(VkCommandPoolTrimFlags_t(), writer.Key("flags"), flags, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4514,13 +4775,14 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceGroupsKHR(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroupsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceGroupsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pPhysicalDeviceGroupCount"], pPhysicalDeviceGroupCount, json_options);
-        FieldToJson(args["pPhysicalDeviceGroupProperties"], pPhysicalDeviceGroupProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pPhysicalDeviceGroupCount"), pPhysicalDeviceGroupCount, json_options);
+        FieldToJson(writer.Key("pPhysicalDeviceGroupProperties"), pPhysicalDeviceGroupProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4530,12 +4792,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalBufferProperti
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
     StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalBufferInfo"], pExternalBufferInfo, json_options);
-        FieldToJson(args["pExternalBufferProperties"], pExternalBufferProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pExternalBufferInfo"), pExternalBufferInfo, json_options);
+        FieldToJson(writer.Key("pExternalBufferProperties"), pExternalBufferProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4546,13 +4809,14 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandleKHR(
     StructPointerDecoder<Decoded_VkMemoryGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandleKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetMemoryWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetWin32HandleInfo"], pGetWin32HandleInfo, json_options);
-        FieldToJson(args["pHandle"], pHandle, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pGetWin32HandleInfo"), pGetWin32HandleInfo, json_options);
+        FieldToJson(writer.Key("pHandle"), pHandle, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4564,14 +4828,15 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandlePropertiesKHR(
     uint64_t                                    handle,
     StructPointerDecoder<Decoded_VkMemoryWin32HandlePropertiesKHR>* pMemoryWin32HandleProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandlePropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetMemoryWin32HandlePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["handleType"], handleType, json_options);
-        FieldToJson(args["handle"], handle, json_options);
-        FieldToJson(args["pMemoryWin32HandleProperties"], pMemoryWin32HandleProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("handleType"), handleType, json_options);
+        FieldToJson(writer.Key("handle"), handle, json_options);
+        FieldToJson(writer.Key("pMemoryWin32HandleProperties"), pMemoryWin32HandleProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4582,13 +4847,14 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryFdKHR(
     StructPointerDecoder<Decoded_VkMemoryGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryFdKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetMemoryFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetFdInfo"], pGetFdInfo, json_options);
-        FieldToJson(args["pFd"], pFd, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pGetFdInfo"), pGetFdInfo, json_options);
+        FieldToJson(writer.Key("pFd"), pFd, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4600,14 +4866,15 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryFdPropertiesKHR(
     int                                         fd,
     StructPointerDecoder<Decoded_VkMemoryFdPropertiesKHR>* pMemoryFdProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryFdPropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetMemoryFdPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["handleType"], handleType, json_options);
-        FieldToJson(args["fd"], fd, json_options);
-        FieldToJson(args["pMemoryFdProperties"], pMemoryFdProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("handleType"), handleType, json_options);
+        FieldToJson(writer.Key("fd"), fd, json_options);
+        FieldToJson(writer.Key("pMemoryFdProperties"), pMemoryFdProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4617,12 +4884,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalSemaphorePrope
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
     StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalSemaphoreInfo"], pExternalSemaphoreInfo, json_options);
-        FieldToJson(args["pExternalSemaphoreProperties"], pExternalSemaphoreProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pExternalSemaphoreInfo"), pExternalSemaphoreInfo, json_options);
+        FieldToJson(writer.Key("pExternalSemaphoreProperties"), pExternalSemaphoreProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4632,12 +4900,13 @@ void VulkanExportJsonConsumer::Process_vkImportSemaphoreWin32HandleKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreWin32HandleInfoKHR>* pImportSemaphoreWin32HandleInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreWin32HandleKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkImportSemaphoreWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pImportSemaphoreWin32HandleInfo"], pImportSemaphoreWin32HandleInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pImportSemaphoreWin32HandleInfo"), pImportSemaphoreWin32HandleInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4648,13 +4917,14 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreWin32HandleKHR(
     StructPointerDecoder<Decoded_VkSemaphoreGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreWin32HandleKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetSemaphoreWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetWin32HandleInfo"], pGetWin32HandleInfo, json_options);
-        FieldToJson(args["pHandle"], pHandle, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pGetWin32HandleInfo"), pGetWin32HandleInfo, json_options);
+        FieldToJson(writer.Key("pHandle"), pHandle, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4664,12 +4934,13 @@ void VulkanExportJsonConsumer::Process_vkImportSemaphoreFdKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreFdInfoKHR>* pImportSemaphoreFdInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreFdKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkImportSemaphoreFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pImportSemaphoreFdInfo"], pImportSemaphoreFdInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pImportSemaphoreFdInfo"), pImportSemaphoreFdInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4680,13 +4951,14 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreFdKHR(
     StructPointerDecoder<Decoded_VkSemaphoreGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreFdKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetSemaphoreFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetFdInfo"], pGetFdInfo, json_options);
-        FieldToJson(args["pFd"], pFd, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pGetFdInfo"), pGetFdInfo, json_options);
+        FieldToJson(writer.Key("pFd"), pFd, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4699,16 +4971,17 @@ void VulkanExportJsonConsumer::Process_vkCmdPushDescriptorSetKHR(
     uint32_t                                    descriptorWriteCount,
     StructPointerDecoder<Decoded_VkWriteDescriptorSet>* pDescriptorWrites)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPushDescriptorSetKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdPushDescriptorSetKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineBindPoint"], pipelineBindPoint, json_options);
-        HandleToJson(args["layout"], layout, json_options);
-        FieldToJson(args["set"], set, json_options);
-        FieldToJson(args["descriptorWriteCount"], descriptorWriteCount, json_options);
-        FieldToJson(args["pDescriptorWrites"], pDescriptorWrites, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pipelineBindPoint"), pipelineBindPoint, json_options);
+        HandleToJson(writer.Key("layout"), layout, json_options);
+        FieldToJson(writer.Key("set"), set, json_options);
+        FieldToJson(writer.Key("descriptorWriteCount"), descriptorWriteCount, json_options);
+        FieldToJson(writer.Key("pDescriptorWrites"), pDescriptorWrites, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4720,14 +4993,15 @@ void VulkanExportJsonConsumer::Process_vkCreateDescriptorUpdateTemplateKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDescriptorUpdateTemplateKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateDescriptorUpdateTemplateKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pDescriptorUpdateTemplate"], pDescriptorUpdateTemplate, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pDescriptorUpdateTemplate"), pDescriptorUpdateTemplate, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4737,12 +5011,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyDescriptorUpdateTemplateKHR(
     format::HandleId                            descriptorUpdateTemplate,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplateKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyDescriptorUpdateTemplateKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorUpdateTemplate"], descriptorUpdateTemplate, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("descriptorUpdateTemplate"), descriptorUpdateTemplate, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4754,14 +5029,15 @@ void VulkanExportJsonConsumer::Process_vkCreateRenderPass2KHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRenderPass2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateRenderPass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pRenderPass"], pRenderPass, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pRenderPass"), pRenderPass, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4771,13 +5047,14 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginRenderPass2KHR(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginRenderPass2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBeginRenderPass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRenderPassBegin"], pRenderPassBegin, json_options);
-        FieldToJson(args["pSubpassBeginInfo"], pSubpassBeginInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pRenderPassBegin"), pRenderPassBegin, json_options);
+        FieldToJson(writer.Key("pSubpassBeginInfo"), pSubpassBeginInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4787,13 +5064,14 @@ void VulkanExportJsonConsumer::Process_vkCmdNextSubpass2KHR(
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdNextSubpass2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdNextSubpass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSubpassBeginInfo"], pSubpassBeginInfo, json_options);
-        FieldToJson(args["pSubpassEndInfo"], pSubpassEndInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pSubpassBeginInfo"), pSubpassBeginInfo, json_options);
+        FieldToJson(writer.Key("pSubpassEndInfo"), pSubpassEndInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4802,12 +5080,13 @@ void VulkanExportJsonConsumer::Process_vkCmdEndRenderPass2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndRenderPass2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEndRenderPass2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSubpassEndInfo"], pSubpassEndInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pSubpassEndInfo"), pSubpassEndInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4817,12 +5096,13 @@ void VulkanExportJsonConsumer::Process_vkGetSwapchainStatusKHR(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSwapchainStatusKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetSwapchainStatusKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4832,12 +5112,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalFencePropertie
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
     StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalFencePropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalFencePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pExternalFenceInfo"], pExternalFenceInfo, json_options);
-        FieldToJson(args["pExternalFenceProperties"], pExternalFenceProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pExternalFenceInfo"), pExternalFenceInfo, json_options);
+        FieldToJson(writer.Key("pExternalFenceProperties"), pExternalFenceProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4847,12 +5128,13 @@ void VulkanExportJsonConsumer::Process_vkImportFenceWin32HandleKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportFenceWin32HandleInfoKHR>* pImportFenceWin32HandleInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportFenceWin32HandleKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkImportFenceWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pImportFenceWin32HandleInfo"], pImportFenceWin32HandleInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pImportFenceWin32HandleInfo"), pImportFenceWin32HandleInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4863,13 +5145,14 @@ void VulkanExportJsonConsumer::Process_vkGetFenceWin32HandleKHR(
     StructPointerDecoder<Decoded_VkFenceGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFenceWin32HandleKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetFenceWin32HandleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetWin32HandleInfo"], pGetWin32HandleInfo, json_options);
-        FieldToJson(args["pHandle"], pHandle, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pGetWin32HandleInfo"), pGetWin32HandleInfo, json_options);
+        FieldToJson(writer.Key("pHandle"), pHandle, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4879,12 +5162,13 @@ void VulkanExportJsonConsumer::Process_vkImportFenceFdKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportFenceFdInfoKHR>* pImportFenceFdInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportFenceFdKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkImportFenceFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pImportFenceFdInfo"], pImportFenceFdInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pImportFenceFdInfo"), pImportFenceFdInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4895,13 +5179,14 @@ void VulkanExportJsonConsumer::Process_vkGetFenceFdKHR(
     StructPointerDecoder<Decoded_VkFenceGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFenceFdKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetFenceFdKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetFdInfo"], pGetFdInfo, json_options);
-        FieldToJson(args["pFd"], pFd, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pGetFdInfo"), pGetFdInfo, json_options);
+        FieldToJson(writer.Key("pFd"), pFd, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4914,15 +5199,16 @@ void VulkanExportJsonConsumer::Process_vkEnumeratePhysicalDeviceQueueFamilyPerfo
     StructPointerDecoder<Decoded_VkPerformanceCounterKHR>* pCounters,
     StructPointerDecoder<Decoded_VkPerformanceCounterDescriptionKHR>* pCounterDescriptions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["pCounterCount"], pCounterCount, json_options);
-        FieldToJson(args["pCounters"], pCounters, json_options);
-        FieldToJson(args["pCounterDescriptions"], pCounterDescriptions, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("queueFamilyIndex"), queueFamilyIndex, json_options);
+        FieldToJson(writer.Key("pCounterCount"), pCounterCount, json_options);
+        FieldToJson(writer.Key("pCounters"), pCounters, json_options);
+        FieldToJson(writer.Key("pCounterDescriptions"), pCounterDescriptions, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4932,12 +5218,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceQueueFamilyPerformance
     StructPointerDecoder<Decoded_VkQueryPoolPerformanceCreateInfoKHR>* pPerformanceQueryCreateInfo,
     PointerDecoder<uint32_t>*                   pNumPasses)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPerformanceQueryCreateInfo"], pPerformanceQueryCreateInfo, json_options);
-        FieldToJson(args["pNumPasses"], pNumPasses, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pPerformanceQueryCreateInfo"), pPerformanceQueryCreateInfo, json_options);
+        FieldToJson(writer.Key("pNumPasses"), pNumPasses, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4947,12 +5234,13 @@ void VulkanExportJsonConsumer::Process_vkAcquireProfilingLockKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAcquireProfilingLockInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireProfilingLockKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkAcquireProfilingLockKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4960,10 +5248,11 @@ void VulkanExportJsonConsumer::Process_vkReleaseProfilingLockKHR(
     const ApiCallInfo&                          call_info,
     format::HandleId                            device)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseProfilingLockKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkReleaseProfilingLockKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4974,13 +5263,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2KH
     StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
     StructPointerDecoder<Decoded_VkSurfaceCapabilities2KHR>* pSurfaceCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pSurfaceInfo"], pSurfaceInfo, json_options);
-        FieldToJson(args["pSurfaceCapabilities"], pSurfaceCapabilities, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pSurfaceInfo"), pSurfaceInfo, json_options);
+        FieldToJson(writer.Key("pSurfaceCapabilities"), pSurfaceCapabilities, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -4992,14 +5282,15 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceFormats2KHR(
     PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
     StructPointerDecoder<Decoded_VkSurfaceFormat2KHR>* pSurfaceFormats)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormats2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceFormats2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pSurfaceInfo"], pSurfaceInfo, json_options);
-        FieldToJson(args["pSurfaceFormatCount"], pSurfaceFormatCount, json_options);
-        FieldToJson(args["pSurfaceFormats"], pSurfaceFormats, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pSurfaceInfo"), pSurfaceInfo, json_options);
+        FieldToJson(writer.Key("pSurfaceFormatCount"), pSurfaceFormatCount, json_options);
+        FieldToJson(writer.Key("pSurfaceFormats"), pSurfaceFormats, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5010,13 +5301,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayProperties2KHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayProperties2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pPropertyCount"), pPropertyCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5027,13 +5319,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPlaneProperties2KHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pPropertyCount"), pPropertyCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5045,14 +5338,15 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayModeProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayModeProperties2KHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayModeProperties2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDisplayModeProperties2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["display"], display, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        HandleToJson(writer.Key("display"), display, json_options);
+        FieldToJson(writer.Key("pPropertyCount"), pPropertyCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5063,13 +5357,14 @@ void VulkanExportJsonConsumer::Process_vkGetDisplayPlaneCapabilities2KHR(
     StructPointerDecoder<Decoded_VkDisplayPlaneInfo2KHR>* pDisplayPlaneInfo,
     StructPointerDecoder<Decoded_VkDisplayPlaneCapabilities2KHR>* pCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDisplayPlaneCapabilities2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDisplayPlaneCapabilities2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pDisplayPlaneInfo"], pDisplayPlaneInfo, json_options);
-        FieldToJson(args["pCapabilities"], pCapabilities, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pDisplayPlaneInfo"), pDisplayPlaneInfo, json_options);
+        FieldToJson(writer.Key("pCapabilities"), pCapabilities, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5079,12 +5374,13 @@ void VulkanExportJsonConsumer::Process_vkGetImageMemoryRequirements2KHR(
     StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageMemoryRequirements2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5094,12 +5390,13 @@ void VulkanExportJsonConsumer::Process_vkGetBufferMemoryRequirements2KHR(
     StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetBufferMemoryRequirements2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5110,13 +5407,14 @@ void VulkanExportJsonConsumer::Process_vkGetImageSparseMemoryRequirements2KHR(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageSparseMemoryRequirements2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pSparseMemoryRequirementCount"], pSparseMemoryRequirementCount, json_options);
-        FieldToJson(args["pSparseMemoryRequirements"], pSparseMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pSparseMemoryRequirementCount"), pSparseMemoryRequirementCount, json_options);
+        FieldToJson(writer.Key("pSparseMemoryRequirements"), pSparseMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5128,14 +5426,15 @@ void VulkanExportJsonConsumer::Process_vkCreateSamplerYcbcrConversionKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateSamplerYcbcrConversionKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateSamplerYcbcrConversionKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pYcbcrConversion"], pYcbcrConversion, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pYcbcrConversion"), pYcbcrConversion, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5145,12 +5444,13 @@ void VulkanExportJsonConsumer::Process_vkDestroySamplerYcbcrConversionKHR(
     format::HandleId                            ycbcrConversion,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroySamplerYcbcrConversionKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroySamplerYcbcrConversionKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["ycbcrConversion"], ycbcrConversion, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("ycbcrConversion"), ycbcrConversion, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5161,13 +5461,14 @@ void VulkanExportJsonConsumer::Process_vkBindBufferMemory2KHR(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindBufferMemory2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkBindBufferMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfos"], pBindInfos, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("bindInfoCount"), bindInfoCount, json_options);
+        FieldToJson(writer.Key("pBindInfos"), pBindInfos, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5178,13 +5479,14 @@ void VulkanExportJsonConsumer::Process_vkBindImageMemory2KHR(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindImageMemory2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkBindImageMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfos"], pBindInfos, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("bindInfoCount"), bindInfoCount, json_options);
+        FieldToJson(writer.Key("pBindInfos"), pBindInfos, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5194,12 +5496,13 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutSupportKHR(
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutSupportKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutSupportKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pSupport"], pSupport, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pSupport"), pSupport, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5213,17 +5516,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCountKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawIndirectCountKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        HandleToJson(writer.Key("countBuffer"), countBuffer, json_options);
+        FieldToJson(writer.Key("countBufferOffset"), countBufferOffset, json_options);
+        FieldToJson(writer.Key("maxDrawCount"), maxDrawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5237,17 +5541,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        HandleToJson(writer.Key("countBuffer"), countBuffer, json_options);
+        FieldToJson(writer.Key("countBufferOffset"), countBufferOffset, json_options);
+        FieldToJson(writer.Key("maxDrawCount"), maxDrawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5258,13 +5563,14 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreCounterValueKHR(
     format::HandleId                            semaphore,
     PointerDecoder<uint64_t>*                   pValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreCounterValueKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetSemaphoreCounterValueKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["semaphore"], semaphore, json_options);
-        FieldToJson(args["pValue"], pValue, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("semaphore"), semaphore, json_options);
+        FieldToJson(writer.Key("pValue"), pValue, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5275,13 +5581,14 @@ void VulkanExportJsonConsumer::Process_vkWaitSemaphoresKHR(
     StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitSemaphoresKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkWaitSemaphoresKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pWaitInfo"], pWaitInfo, json_options);
-        FieldToJson(args["timeout"], timeout, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pWaitInfo"), pWaitInfo, json_options);
+        FieldToJson(writer.Key("timeout"), timeout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5291,12 +5598,13 @@ void VulkanExportJsonConsumer::Process_vkSignalSemaphoreKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSignalSemaphoreKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSignalSemaphoreKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pSignalInfo"], pSignalInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pSignalInfo"), pSignalInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5307,13 +5615,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceFragmentShadingRatesKH
     PointerDecoder<uint32_t>*                   pFragmentShadingRateCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFragmentShadingRateKHR>* pFragmentShadingRates)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFragmentShadingRatesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceFragmentShadingRatesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pFragmentShadingRateCount"], pFragmentShadingRateCount, json_options);
-        FieldToJson(args["pFragmentShadingRates"], pFragmentShadingRates, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pFragmentShadingRateCount"), pFragmentShadingRateCount, json_options);
+        FieldToJson(writer.Key("pFragmentShadingRates"), pFragmentShadingRates, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5323,13 +5632,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFragmentShadingRateKHR(
     StructPointerDecoder<Decoded_VkExtent2D>*   pFragmentSize,
     PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFragmentShadingRateKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetFragmentShadingRateKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pFragmentSize"], pFragmentSize, json_options);
-        FieldToJson(args["combinerOps"], combinerOps, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pFragmentSize"), pFragmentSize, json_options);
+        FieldToJson(writer.Key("combinerOps"), combinerOps, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5338,12 +5648,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRenderingAttachmentLocationsKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingAttachmentLocationInfoKHR>* pLocationInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRenderingAttachmentLocationsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetRenderingAttachmentLocationsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pLocationInfo"], pLocationInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pLocationInfo"), pLocationInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5352,12 +5663,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRenderingInputAttachmentIndicesKH
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkRenderingInputAttachmentIndexInfoKHR>* pInputAttachmentIndexInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRenderingInputAttachmentIndicesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetRenderingInputAttachmentIndicesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInputAttachmentIndexInfo"], pInputAttachmentIndexInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pInputAttachmentIndexInfo"), pInputAttachmentIndexInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5369,14 +5681,15 @@ void VulkanExportJsonConsumer::Process_vkWaitForPresentKHR(
     uint64_t                                    presentId,
     uint64_t                                    timeout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWaitForPresentKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkWaitForPresentKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["presentId"], presentId, json_options);
-        FieldToJson(args["timeout"], timeout, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+        FieldToJson(writer.Key("presentId"), presentId, json_options);
+        FieldToJson(writer.Key("timeout"), timeout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5386,12 +5699,13 @@ void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddressKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetBufferDeviceAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJsonAsHex(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5401,12 +5715,13 @@ void VulkanExportJsonConsumer::Process_vkGetBufferOpaqueCaptureAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddressKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetBufferOpaqueCaptureAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5416,12 +5731,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5432,13 +5748,14 @@ void VulkanExportJsonConsumer::Process_vkCreateDeferredOperationKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDeferredOperationKHR>* pDeferredOperation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDeferredOperationKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateDeferredOperationKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pDeferredOperation"], pDeferredOperation, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pDeferredOperation"), pDeferredOperation, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5448,12 +5765,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyDeferredOperationKHR(
     format::HandleId                            operation,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDeferredOperationKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyDeferredOperationKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["operation"], operation, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("operation"), operation, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5463,12 +5781,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeferredOperationMaxConcurrencyKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeferredOperationMaxConcurrencyKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeferredOperationMaxConcurrencyKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["operation"], operation, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("operation"), operation, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5478,12 +5797,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeferredOperationResultKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeferredOperationResultKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeferredOperationResultKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["operation"], operation, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("operation"), operation, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5493,12 +5813,13 @@ void VulkanExportJsonConsumer::Process_vkDeferredOperationJoinKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDeferredOperationJoinKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDeferredOperationJoinKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["operation"], operation, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("operation"), operation, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5510,14 +5831,15 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineExecutablePropertiesKHR(
     PointerDecoder<uint32_t>*                   pExecutableCount,
     StructPointerDecoder<Decoded_VkPipelineExecutablePropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutablePropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPipelineExecutablePropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pPipelineInfo"], pPipelineInfo, json_options);
-        FieldToJson(args["pExecutableCount"], pExecutableCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pPipelineInfo"), pPipelineInfo, json_options);
+        FieldToJson(writer.Key("pExecutableCount"), pExecutableCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5529,14 +5851,15 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineExecutableStatisticsKHR(
     PointerDecoder<uint32_t>*                   pStatisticCount,
     StructPointerDecoder<Decoded_VkPipelineExecutableStatisticKHR>* pStatistics)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutableStatisticsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPipelineExecutableStatisticsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pExecutableInfo"], pExecutableInfo, json_options);
-        FieldToJson(args["pStatisticCount"], pStatisticCount, json_options);
-        FieldToJson(args["pStatistics"], pStatistics, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pExecutableInfo"), pExecutableInfo, json_options);
+        FieldToJson(writer.Key("pStatisticCount"), pStatisticCount, json_options);
+        FieldToJson(writer.Key("pStatistics"), pStatistics, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5548,14 +5871,15 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineExecutableInternalRepresenta
     PointerDecoder<uint32_t>*                   pInternalRepresentationCount,
     StructPointerDecoder<Decoded_VkPipelineExecutableInternalRepresentationKHR>* pInternalRepresentations)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineExecutableInternalRepresentationsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPipelineExecutableInternalRepresentationsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pExecutableInfo"], pExecutableInfo, json_options);
-        FieldToJson(args["pInternalRepresentationCount"], pInternalRepresentationCount, json_options);
-        FieldToJson(args["pInternalRepresentations"], pInternalRepresentations, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pExecutableInfo"), pExecutableInfo, json_options);
+        FieldToJson(writer.Key("pInternalRepresentationCount"), pInternalRepresentationCount, json_options);
+        FieldToJson(writer.Key("pInternalRepresentations"), pInternalRepresentations, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5566,13 +5890,14 @@ void VulkanExportJsonConsumer::Process_vkMapMemory2KHR(
     StructPointerDecoder<Decoded_VkMemoryMapInfoKHR>* pMemoryMapInfo,
     PointerDecoder<uint64_t, void*>*            ppData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMapMemory2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkMapMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pMemoryMapInfo"], pMemoryMapInfo, json_options);
-        FieldToJsonAsHex(args["ppData"], ppData, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pMemoryMapInfo"), pMemoryMapInfo, json_options);
+        FieldToJsonAsHex(writer.Key("ppData"), ppData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5582,12 +5907,13 @@ void VulkanExportJsonConsumer::Process_vkUnmapMemory2KHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkMemoryUnmapInfoKHR>* pMemoryUnmapInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUnmapMemory2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkUnmapMemory2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pMemoryUnmapInfo"], pMemoryUnmapInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pMemoryUnmapInfo"), pMemoryUnmapInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5598,13 +5924,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceVideoEncodeQualityLeve
     StructPointerDecoder<Decoded_VkPhysicalDeviceVideoEncodeQualityLevelInfoKHR>* pQualityLevelInfo,
     StructPointerDecoder<Decoded_VkVideoEncodeQualityLevelPropertiesKHR>* pQualityLevelProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceVideoEncodeQualityLevelPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pQualityLevelInfo"], pQualityLevelInfo, json_options);
-        FieldToJson(args["pQualityLevelProperties"], pQualityLevelProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pQualityLevelInfo"), pQualityLevelInfo, json_options);
+        FieldToJson(writer.Key("pQualityLevelProperties"), pQualityLevelProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5617,15 +5944,16 @@ void VulkanExportJsonConsumer::Process_vkGetEncodedVideoSessionParametersKHR(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetEncodedVideoSessionParametersKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetEncodedVideoSessionParametersKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pVideoSessionParametersInfo"], pVideoSessionParametersInfo, json_options);
-        FieldToJson(args["pFeedbackInfo"], pFeedbackInfo, json_options);
-        FieldToJson(args["pDataSize"], pDataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pVideoSessionParametersInfo"), pVideoSessionParametersInfo, json_options);
+        FieldToJson(writer.Key("pFeedbackInfo"), pFeedbackInfo, json_options);
+        FieldToJson(writer.Key("pDataSize"), pDataSize, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5634,12 +5962,13 @@ void VulkanExportJsonConsumer::Process_vkCmdEncodeVideoKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkVideoEncodeInfoKHR>* pEncodeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEncodeVideoKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEncodeVideoKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pEncodeInfo"], pEncodeInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pEncodeInfo"), pEncodeInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5649,13 +5978,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetEvent2KHR(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetEvent2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetEvent2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(args["pDependencyInfo"], pDependencyInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("event"), event, json_options);
+        FieldToJson(writer.Key("pDependencyInfo"), pDependencyInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5665,13 +5995,14 @@ void VulkanExportJsonConsumer::Process_vkCmdResetEvent2KHR(
     format::HandleId                            event,
     VkPipelineStageFlags2                       stageMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResetEvent2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdResetEvent2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["event"], event, json_options);
-        FieldToJson(VkPipelineStageFlags2_t(), args["stageMask"], stageMask, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("event"), event, json_options);
+        FieldToJson(VkPipelineStageFlags2_t(), writer.Key("stageMask"), stageMask, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5682,14 +6013,15 @@ void VulkanExportJsonConsumer::Process_vkCmdWaitEvents2KHR(
     HandlePointerDecoder<VkEvent>*              pEvents,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWaitEvents2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdWaitEvents2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["eventCount"], eventCount, json_options);
-        HandleToJson(args["pEvents"], pEvents, json_options);
-        FieldToJson(args["pDependencyInfos"], pDependencyInfos, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("eventCount"), eventCount, json_options);
+        HandleToJson(writer.Key("pEvents"), pEvents, json_options);
+        FieldToJson(writer.Key("pDependencyInfos"), pDependencyInfos, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5698,12 +6030,13 @@ void VulkanExportJsonConsumer::Process_vkCmdPipelineBarrier2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDependencyInfo>* pDependencyInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPipelineBarrier2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdPipelineBarrier2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pDependencyInfo"], pDependencyInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pDependencyInfo"), pDependencyInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5714,14 +6047,15 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteTimestamp2KHR(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteTimestamp2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdWriteTimestamp2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkPipelineStageFlags2_t(), args["stage"], stage, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkPipelineStageFlags2_t(), writer.Key("stage"), stage, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("query"), query, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5733,15 +6067,16 @@ void VulkanExportJsonConsumer::Process_vkQueueSubmit2KHR(
     StructPointerDecoder<Decoded_VkSubmitInfo2>* pSubmits,
     format::HandleId                            fence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSubmit2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkQueueSubmit2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameSubmitIndex()], ++submit_index_, json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["submitCount"], submitCount, json_options);
-        FieldToJson(args["pSubmits"], pSubmits, json_options);
-        HandleToJson(args["fence"], fence, json_options);
+    FieldToJson(writer.Key(NameSubmitIndex()), ++submit_index_, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+        FieldToJson(writer.Key("submitCount"), submitCount, json_options);
+        FieldToJson(writer.Key("pSubmits"), pSubmits, json_options);
+        HandleToJson(writer.Key("fence"), fence, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5753,15 +6088,16 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteBufferMarker2AMD(
     VkDeviceSize                                dstOffset,
     uint32_t                                    marker)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteBufferMarker2AMD");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdWriteBufferMarker2AMD");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkPipelineStageFlags2_t(), args["stage"], stage, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["dstOffset"], dstOffset, json_options);
-        FieldToJson(args["marker"], marker, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkPipelineStageFlags2_t(), writer.Key("stage"), stage, json_options);
+        HandleToJson(writer.Key("dstBuffer"), dstBuffer, json_options);
+        FieldToJson(writer.Key("dstOffset"), dstOffset, json_options);
+        FieldToJson(writer.Key("marker"), marker, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5771,12 +6107,13 @@ void VulkanExportJsonConsumer::Process_vkGetQueueCheckpointData2NV(
     PointerDecoder<uint32_t>*                   pCheckpointDataCount,
     StructPointerDecoder<Decoded_VkCheckpointData2NV>* pCheckpointData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetQueueCheckpointData2NV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetQueueCheckpointData2NV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pCheckpointDataCount"], pCheckpointDataCount, json_options);
-        FieldToJson(args["pCheckpointData"], pCheckpointData, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+        FieldToJson(writer.Key("pCheckpointDataCount"), pCheckpointDataCount, json_options);
+        FieldToJson(writer.Key("pCheckpointData"), pCheckpointData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5785,12 +6122,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBuffer2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferInfo2>* pCopyBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBuffer2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyBuffer2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyBufferInfo"], pCopyBufferInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pCopyBufferInfo"), pCopyBufferInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5799,12 +6137,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageInfo2>* pCopyImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImage2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyImageInfo"], pCopyImageInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pCopyImageInfo"), pCopyImageInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5813,12 +6152,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyBufferToImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferToImageInfo2>* pCopyBufferToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyBufferToImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyBufferToImageInfo"], pCopyBufferToImageInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pCopyBufferToImageInfo"), pCopyBufferToImageInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5827,12 +6167,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyImageToBuffer2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageToBufferInfo2>* pCopyImageToBufferInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyImageToBuffer2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCopyImageToBufferInfo"], pCopyImageToBufferInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pCopyImageToBufferInfo"), pCopyImageToBufferInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5841,12 +6182,13 @@ void VulkanExportJsonConsumer::Process_vkCmdBlitImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBlitImageInfo2>* pBlitImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBlitImage2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBlitImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBlitImageInfo"], pBlitImageInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pBlitImageInfo"), pBlitImageInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5855,12 +6197,13 @@ void VulkanExportJsonConsumer::Process_vkCmdResolveImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkResolveImageInfo2>* pResolveImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdResolveImage2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdResolveImage2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pResolveImageInfo"], pResolveImageInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pResolveImageInfo"), pResolveImageInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5869,12 +6212,13 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysIndirect2KHR(
     format::HandleId                            commandBuffer,
     VkDeviceAddress                             indirectDeviceAddress)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysIndirect2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdTraceRaysIndirect2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJsonAsHex(args["indirectDeviceAddress"], indirectDeviceAddress, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJsonAsHex(writer.Key("indirectDeviceAddress"), indirectDeviceAddress, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5884,12 +6228,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceBufferMemoryRequirementsKHR(
     StructPointerDecoder<Decoded_VkDeviceBufferMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirementsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceBufferMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5899,12 +6244,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageMemoryRequirementsKHR(
     StructPointerDecoder<Decoded_VkDeviceImageMemoryRequirements>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageMemoryRequirementsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceImageMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5915,13 +6261,14 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageSparseMemoryRequirementsK
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirementsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceImageSparseMemoryRequirementsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pSparseMemoryRequirementCount"], pSparseMemoryRequirementCount, json_options);
-        FieldToJson(args["pSparseMemoryRequirements"], pSparseMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pSparseMemoryRequirementCount"), pSparseMemoryRequirementCount, json_options);
+        FieldToJson(writer.Key("pSparseMemoryRequirements"), pSparseMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5933,15 +6280,16 @@ void VulkanExportJsonConsumer::Process_vkCmdBindIndexBuffer2KHR(
     VkDeviceSize                                size,
     VkIndexType                                 indexType)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindIndexBuffer2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindIndexBuffer2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["size"], size, json_options);
-        FieldToJson(args["indexType"], indexType, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        FieldToJson(writer.Key("size"), size, json_options);
+        FieldToJson(writer.Key("indexType"), indexType, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5951,12 +6299,13 @@ void VulkanExportJsonConsumer::Process_vkGetRenderingAreaGranularityKHR(
     StructPointerDecoder<Decoded_VkRenderingAreaInfoKHR>* pRenderingAreaInfo,
     StructPointerDecoder<Decoded_VkExtent2D>*   pGranularity)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRenderingAreaGranularityKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetRenderingAreaGranularityKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pRenderingAreaInfo"], pRenderingAreaInfo, json_options);
-        FieldToJson(args["pGranularity"], pGranularity, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pRenderingAreaInfo"), pRenderingAreaInfo, json_options);
+        FieldToJson(writer.Key("pGranularity"), pGranularity, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5966,12 +6315,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceImageSubresourceLayoutKHR(
     StructPointerDecoder<Decoded_VkDeviceImageSubresourceInfoKHR>* pInfo,
     StructPointerDecoder<Decoded_VkSubresourceLayout2KHR>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceImageSubresourceLayoutKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceImageSubresourceLayoutKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pLayout"], pLayout, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pLayout"), pLayout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5982,13 +6332,14 @@ void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout2KHR(
     StructPointerDecoder<Decoded_VkImageSubresource2KHR>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout2KHR>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pSubresource"], pSubresource, json_options);
-        FieldToJson(args["pLayout"], pLayout, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("image"), image, json_options);
+        FieldToJson(writer.Key("pSubresource"), pSubresource, json_options);
+        FieldToJson(writer.Key("pLayout"), pLayout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -5999,13 +6350,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkCooperativeMatrixPropertiesKHR>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pPropertyCount"), pPropertyCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6015,13 +6367,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleKHR(
     uint32_t                                    lineStippleFactor,
     uint16_t                                    lineStipplePattern)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetLineStippleKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["lineStippleFactor"], lineStippleFactor, json_options);
-        FieldToJson(args["lineStipplePattern"], lineStipplePattern, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("lineStippleFactor"), lineStippleFactor, json_options);
+        FieldToJson(writer.Key("lineStipplePattern"), lineStipplePattern, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6032,13 +6385,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomai
     PointerDecoder<uint32_t>*                   pTimeDomainCount,
     PointerDecoder<VkTimeDomainKHR>*            pTimeDomains)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pTimeDomainCount"], pTimeDomainCount, json_options);
-        FieldToJson(args["pTimeDomains"], pTimeDomains, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pTimeDomainCount"), pTimeDomainCount, json_options);
+        FieldToJson(writer.Key("pTimeDomains"), pTimeDomains, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6051,15 +6405,16 @@ void VulkanExportJsonConsumer::Process_vkGetCalibratedTimestampsKHR(
     PointerDecoder<uint64_t>*                   pTimestamps,
     PointerDecoder<uint64_t>*                   pMaxDeviation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetCalibratedTimestampsKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetCalibratedTimestampsKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["timestampCount"], timestampCount, json_options);
-        FieldToJson(args["pTimestampInfos"], pTimestampInfos, json_options);
-        FieldToJson(args["pTimestamps"], pTimestamps, json_options);
-        FieldToJson(args["pMaxDeviation"], pMaxDeviation, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("timestampCount"), timestampCount, json_options);
+        FieldToJson(writer.Key("pTimestampInfos"), pTimestampInfos, json_options);
+        FieldToJson(writer.Key("pTimestamps"), pTimestamps, json_options);
+        FieldToJson(writer.Key("pMaxDeviation"), pMaxDeviation, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6068,12 +6423,13 @@ void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorSets2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBindDescriptorSetsInfoKHR>* pBindDescriptorSetsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorSets2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindDescriptorSets2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBindDescriptorSetsInfo"], pBindDescriptorSetsInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pBindDescriptorSetsInfo"), pBindDescriptorSetsInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6082,12 +6438,13 @@ void VulkanExportJsonConsumer::Process_vkCmdPushConstants2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPushConstantsInfoKHR>* pPushConstantsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPushConstants2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdPushConstants2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pPushConstantsInfo"], pPushConstantsInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pPushConstantsInfo"), pPushConstantsInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6096,12 +6453,13 @@ void VulkanExportJsonConsumer::Process_vkCmdPushDescriptorSet2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPushDescriptorSetInfoKHR>* pPushDescriptorSetInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPushDescriptorSet2KHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdPushDescriptorSet2KHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pPushDescriptorSetInfo"], pPushDescriptorSetInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pPushDescriptorSetInfo"), pPushDescriptorSetInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6110,12 +6468,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDescriptorBufferOffsets2EXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSetDescriptorBufferOffsetsInfoEXT>* pSetDescriptorBufferOffsetsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDescriptorBufferOffsets2EXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDescriptorBufferOffsets2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSetDescriptorBufferOffsetsInfo"], pSetDescriptorBufferOffsetsInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pSetDescriptorBufferOffsetsInfo"), pSetDescriptorBufferOffsetsInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6124,12 +6483,13 @@ void VulkanExportJsonConsumer::Process_vkCmdBindDescriptorBufferEmbeddedSamplers
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBindDescriptorBufferEmbeddedSamplersInfoEXT>* pBindDescriptorBufferEmbeddedSamplersInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindDescriptorBufferEmbeddedSamplers2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pBindDescriptorBufferEmbeddedSamplersInfo"], pBindDescriptorBufferEmbeddedSamplersInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pBindDescriptorBufferEmbeddedSamplersInfo"), pBindDescriptorBufferEmbeddedSamplersInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6139,12 +6499,13 @@ void VulkanExportJsonConsumer::Process_vkFrameBoundaryANDROID(
     format::HandleId                            semaphore,
     format::HandleId                            image)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkFrameBoundaryANDROID");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkFrameBoundaryANDROID");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["semaphore"], semaphore, json_options);
-        HandleToJson(args["image"], image, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("semaphore"), semaphore, json_options);
+        HandleToJson(writer.Key("image"), image, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6156,14 +6517,15 @@ void VulkanExportJsonConsumer::Process_vkCreateDebugReportCallbackEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDebugReportCallbackEXT>* pCallback)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDebugReportCallbackEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateDebugReportCallbackEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pCallback"], pCallback, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pCallback"), pCallback, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6173,12 +6535,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyDebugReportCallbackEXT(
     format::HandleId                            callback,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDebugReportCallbackEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyDebugReportCallbackEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        HandleToJson(args["callback"], callback, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        HandleToJson(writer.Key("callback"), callback, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6193,17 +6556,18 @@ void VulkanExportJsonConsumer::Process_vkDebugReportMessageEXT(
     StringDecoder*                              pLayerPrefix,
     StringDecoder*                              pMessage)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDebugReportMessageEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDebugReportMessageEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(VkDebugReportFlagsEXT_t(), args["flags"], flags, json_options);
-        FieldToJson(args["objectType"], objectType, json_options);
-        FieldToJson(args["object"], object, json_options);
-        FieldToJson(args["location"], location, json_options);
-        FieldToJson(args["messageCode"], messageCode, json_options);
-        FieldToJson(args["pLayerPrefix"], pLayerPrefix, json_options);
-        FieldToJson(args["pMessage"], pMessage, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(VkDebugReportFlagsEXT_t(), writer.Key("flags"), flags, json_options);
+        FieldToJson(writer.Key("objectType"), objectType, json_options);
+        FieldToJson(writer.Key("object"), object, json_options);
+        FieldToJson(writer.Key("location"), location, json_options);
+        FieldToJson(writer.Key("messageCode"), messageCode, json_options);
+        FieldToJson(writer.Key("pLayerPrefix"), pLayerPrefix, json_options);
+        FieldToJson(writer.Key("pMessage"), pMessage, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6213,12 +6577,13 @@ void VulkanExportJsonConsumer::Process_vkDebugMarkerSetObjectTagEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugMarkerObjectTagInfoEXT>* pTagInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDebugMarkerSetObjectTagEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDebugMarkerSetObjectTagEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pTagInfo"], pTagInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pTagInfo"), pTagInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6228,12 +6593,13 @@ void VulkanExportJsonConsumer::Process_vkDebugMarkerSetObjectNameEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugMarkerObjectNameInfoEXT>* pNameInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDebugMarkerSetObjectNameEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDebugMarkerSetObjectNameEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pNameInfo"], pNameInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pNameInfo"), pNameInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6242,12 +6608,13 @@ void VulkanExportJsonConsumer::Process_vkCmdDebugMarkerBeginEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerBeginEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDebugMarkerBeginEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pMarkerInfo"], pMarkerInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pMarkerInfo"), pMarkerInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6255,11 +6622,12 @@ void VulkanExportJsonConsumer::Process_vkCmdDebugMarkerEndEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerEndEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDebugMarkerEndEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6268,12 +6636,13 @@ void VulkanExportJsonConsumer::Process_vkCmdDebugMarkerInsertEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDebugMarkerInsertEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDebugMarkerInsertEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pMarkerInfo"], pMarkerInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pMarkerInfo"), pMarkerInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6286,16 +6655,17 @@ void VulkanExportJsonConsumer::Process_vkCmdBindTransformFeedbackBuffersEXT(
     PointerDecoder<VkDeviceSize>*               pOffsets,
     PointerDecoder<VkDeviceSize>*               pSizes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindTransformFeedbackBuffersEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindTransformFeedbackBuffersEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstBinding"], firstBinding, json_options);
-        FieldToJson(args["bindingCount"], bindingCount, json_options);
-        HandleToJson(args["pBuffers"], pBuffers, json_options);
-        FieldToJson(args["pOffsets"], pOffsets, json_options);
-        FieldToJson(args["pSizes"], pSizes, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstBinding"), firstBinding, json_options);
+        FieldToJson(writer.Key("bindingCount"), bindingCount, json_options);
+        HandleToJson(writer.Key("pBuffers"), pBuffers, json_options);
+        FieldToJson(writer.Key("pOffsets"), pOffsets, json_options);
+        FieldToJson(writer.Key("pSizes"), pSizes, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6307,15 +6677,16 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginTransformFeedbackEXT(
     HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
     PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginTransformFeedbackEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBeginTransformFeedbackEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstCounterBuffer"], firstCounterBuffer, json_options);
-        FieldToJson(args["counterBufferCount"], counterBufferCount, json_options);
-        HandleToJson(args["pCounterBuffers"], pCounterBuffers, json_options);
-        FieldToJson(args["pCounterBufferOffsets"], pCounterBufferOffsets, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstCounterBuffer"), firstCounterBuffer, json_options);
+        FieldToJson(writer.Key("counterBufferCount"), counterBufferCount, json_options);
+        HandleToJson(writer.Key("pCounterBuffers"), pCounterBuffers, json_options);
+        FieldToJson(writer.Key("pCounterBufferOffsets"), pCounterBufferOffsets, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6327,15 +6698,16 @@ void VulkanExportJsonConsumer::Process_vkCmdEndTransformFeedbackEXT(
     HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
     PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndTransformFeedbackEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEndTransformFeedbackEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstCounterBuffer"], firstCounterBuffer, json_options);
-        FieldToJson(args["counterBufferCount"], counterBufferCount, json_options);
-        HandleToJson(args["pCounterBuffers"], pCounterBuffers, json_options);
-        FieldToJson(args["pCounterBufferOffsets"], pCounterBufferOffsets, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstCounterBuffer"), firstCounterBuffer, json_options);
+        FieldToJson(writer.Key("counterBufferCount"), counterBufferCount, json_options);
+        HandleToJson(writer.Key("pCounterBuffers"), pCounterBuffers, json_options);
+        FieldToJson(writer.Key("pCounterBufferOffsets"), pCounterBufferOffsets, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6347,15 +6719,16 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginQueryIndexedEXT(
     VkQueryControlFlags                         flags,
     uint32_t                                    index)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginQueryIndexedEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBeginQueryIndexedEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
-        FieldToJson(VkQueryControlFlags_t(), args["flags"], flags, json_options);
-        FieldToJson(args["index"], index, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("query"), query, json_options);
+        FieldToJson(VkQueryControlFlags_t(), writer.Key("flags"), flags, json_options);
+        FieldToJson(writer.Key("index"), index, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6366,14 +6739,15 @@ void VulkanExportJsonConsumer::Process_vkCmdEndQueryIndexedEXT(
     uint32_t                                    query,
     uint32_t                                    index)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndQueryIndexedEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEndQueryIndexedEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["query"], query, json_options);
-        FieldToJson(args["index"], index, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("query"), query, json_options);
+        FieldToJson(writer.Key("index"), index, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6387,17 +6761,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectByteCountEXT(
     uint32_t                                    counterOffset,
     uint32_t                                    vertexStride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectByteCountEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawIndirectByteCountEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["instanceCount"], instanceCount, json_options);
-        FieldToJson(args["firstInstance"], firstInstance, json_options);
-        HandleToJson(args["counterBuffer"], counterBuffer, json_options);
-        FieldToJson(args["counterBufferOffset"], counterBufferOffset, json_options);
-        FieldToJson(args["counterOffset"], counterOffset, json_options);
-        FieldToJson(args["vertexStride"], vertexStride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("instanceCount"), instanceCount, json_options);
+        FieldToJson(writer.Key("firstInstance"), firstInstance, json_options);
+        HandleToJson(writer.Key("counterBuffer"), counterBuffer, json_options);
+        FieldToJson(writer.Key("counterBufferOffset"), counterBufferOffset, json_options);
+        FieldToJson(writer.Key("counterOffset"), counterOffset, json_options);
+        FieldToJson(writer.Key("vertexStride"), vertexStride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6407,12 +6782,13 @@ void VulkanExportJsonConsumer::Process_vkGetImageViewHandleNVX(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImageViewHandleInfoNVX>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageViewHandleNVX");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageViewHandleNVX");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6423,13 +6799,14 @@ void VulkanExportJsonConsumer::Process_vkGetImageViewAddressNVX(
     format::HandleId                            imageView,
     StructPointerDecoder<Decoded_VkImageViewAddressPropertiesNVX>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageViewAddressNVX");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageViewAddressNVX");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["imageView"], imageView, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("imageView"), imageView, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6443,17 +6820,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndirectCountAMD");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawIndirectCountAMD");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        HandleToJson(writer.Key("countBuffer"), countBuffer, json_options);
+        FieldToJson(writer.Key("countBufferOffset"), countBufferOffset, json_options);
+        FieldToJson(writer.Key("maxDrawCount"), maxDrawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6467,17 +6845,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawIndexedIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountAMD");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawIndexedIndirectCountAMD");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        HandleToJson(writer.Key("countBuffer"), countBuffer, json_options);
+        FieldToJson(writer.Key("countBufferOffset"), countBufferOffset, json_options);
+        FieldToJson(writer.Key("maxDrawCount"), maxDrawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6491,16 +6870,17 @@ void VulkanExportJsonConsumer::Process_vkGetShaderInfoAMD(
     PointerDecoder<size_t>*                     pInfoSize,
     PointerDecoder<uint8_t>*                    pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderInfoAMD");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetShaderInfoAMD");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["shaderStage"], shaderStage, json_options);
-        FieldToJson(args["infoType"], infoType, json_options);
-        FieldToJson(args["pInfoSize"], pInfoSize, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipeline"), pipeline, json_options);
+        FieldToJson(writer.Key("shaderStage"), shaderStage, json_options);
+        FieldToJson(writer.Key("infoType"), infoType, json_options);
+        FieldToJson(writer.Key("pInfoSize"), pInfoSize, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6512,14 +6892,15 @@ void VulkanExportJsonConsumer::Process_vkCreateStreamDescriptorSurfaceGGP(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateStreamDescriptorSurfaceGGP");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateStreamDescriptorSurfaceGGP");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6535,18 +6916,19 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceExternalImageFormatPro
     VkExternalMemoryHandleTypeFlagsNV           externalHandleType,
     StructPointerDecoder<Decoded_VkExternalImageFormatPropertiesNV>* pExternalImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["format"], format, json_options);
-        FieldToJson(args["type"], type, json_options);
-        FieldToJson(args["tiling"], tiling, json_options);
-        FieldToJson(VkImageUsageFlags_t(), args["usage"], usage, json_options);
-        FieldToJson(VkImageCreateFlags_t(), args["flags"], flags, json_options);
-        FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t(), args["externalHandleType"], externalHandleType, json_options);
-        FieldToJson(args["pExternalImageFormatProperties"], pExternalImageFormatProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("format"), format, json_options);
+        FieldToJson(writer.Key("type"), type, json_options);
+        FieldToJson(writer.Key("tiling"), tiling, json_options);
+        FieldToJson(VkImageUsageFlags_t(), writer.Key("usage"), usage, json_options);
+        FieldToJson(VkImageCreateFlags_t(), writer.Key("flags"), flags, json_options);
+        FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t(), writer.Key("externalHandleType"), externalHandleType, json_options);
+        FieldToJson(writer.Key("pExternalImageFormatProperties"), pExternalImageFormatProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6558,14 +6940,15 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryWin32HandleNV(
     VkExternalMemoryHandleTypeFlagsNV           handleType,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryWin32HandleNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetMemoryWin32HandleNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t(), args["handleType"], handleType, json_options);
-        FieldToJson(args["pHandle"], pHandle, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("memory"), memory, json_options);
+        FieldToJson(VkExternalMemoryHandleTypeFlagsNV_t(), writer.Key("handleType"), handleType, json_options);
+        FieldToJson(writer.Key("pHandle"), pHandle, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6577,14 +6960,15 @@ void VulkanExportJsonConsumer::Process_vkCreateViSurfaceNN(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateViSurfaceNN");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateViSurfaceNN");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6593,12 +6977,13 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginConditionalRenderingEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkConditionalRenderingBeginInfoEXT>* pConditionalRenderingBegin)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginConditionalRenderingEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBeginConditionalRenderingEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pConditionalRenderingBegin"], pConditionalRenderingBegin, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pConditionalRenderingBegin"), pConditionalRenderingBegin, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6606,11 +6991,12 @@ void VulkanExportJsonConsumer::Process_vkCmdEndConditionalRenderingEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndConditionalRenderingEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEndConditionalRenderingEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6621,14 +7007,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWScalingNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewportWScalingNV>* pViewportWScalings)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWScalingNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetViewportWScalingNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstViewport"], firstViewport, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pViewportWScalings"], pViewportWScalings, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstViewport"), firstViewport, json_options);
+        FieldToJson(writer.Key("viewportCount"), viewportCount, json_options);
+        FieldToJson(writer.Key("pViewportWScalings"), pViewportWScalings, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6638,12 +7025,13 @@ void VulkanExportJsonConsumer::Process_vkReleaseDisplayEXT(
     format::HandleId                            physicalDevice,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseDisplayEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkReleaseDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["display"], display, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        HandleToJson(writer.Key("display"), display, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6654,13 +7042,14 @@ void VulkanExportJsonConsumer::Process_vkAcquireXlibDisplayEXT(
     uint64_t                                    dpy,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireXlibDisplayEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkAcquireXlibDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["dpy"], dpy, json_options);
-        HandleToJson(args["display"], display, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("dpy"), dpy, json_options);
+        HandleToJson(writer.Key("display"), display, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6672,14 +7061,15 @@ void VulkanExportJsonConsumer::Process_vkGetRandROutputDisplayEXT(
     size_t                                      rrOutput,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRandROutputDisplayEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetRandROutputDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["dpy"], dpy, json_options);
-        FieldToJson(args["rrOutput"], rrOutput, json_options);
-        HandleToJson(args["pDisplay"], pDisplay, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("dpy"), dpy, json_options);
+        FieldToJson(writer.Key("rrOutput"), rrOutput, json_options);
+        HandleToJson(writer.Key("pDisplay"), pDisplay, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6690,13 +7080,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2EX
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkSurfaceCapabilities2EXT>* pSurfaceCapabilities)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["surface"], surface, json_options);
-        FieldToJson(args["pSurfaceCapabilities"], pSurfaceCapabilities, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        HandleToJson(writer.Key("surface"), surface, json_options);
+        FieldToJson(writer.Key("pSurfaceCapabilities"), pSurfaceCapabilities, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6707,13 +7098,14 @@ void VulkanExportJsonConsumer::Process_vkDisplayPowerControlEXT(
     format::HandleId                            display,
     StructPointerDecoder<Decoded_VkDisplayPowerInfoEXT>* pDisplayPowerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDisplayPowerControlEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDisplayPowerControlEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["display"], display, json_options);
-        FieldToJson(args["pDisplayPowerInfo"], pDisplayPowerInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("display"), display, json_options);
+        FieldToJson(writer.Key("pDisplayPowerInfo"), pDisplayPowerInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6725,14 +7117,15 @@ void VulkanExportJsonConsumer::Process_vkRegisterDeviceEventEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkRegisterDeviceEventEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkRegisterDeviceEventEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pDeviceEventInfo"], pDeviceEventInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pFence"], pFence, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pDeviceEventInfo"), pDeviceEventInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pFence"), pFence, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6745,15 +7138,16 @@ void VulkanExportJsonConsumer::Process_vkRegisterDisplayEventEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkRegisterDisplayEventEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkRegisterDisplayEventEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["display"], display, json_options);
-        FieldToJson(args["pDisplayEventInfo"], pDisplayEventInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pFence"], pFence, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("display"), display, json_options);
+        FieldToJson(writer.Key("pDisplayEventInfo"), pDisplayEventInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pFence"), pFence, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6765,14 +7159,15 @@ void VulkanExportJsonConsumer::Process_vkGetSwapchainCounterEXT(
     VkSurfaceCounterFlagBitsEXT                 counter,
     PointerDecoder<uint64_t>*                   pCounterValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSwapchainCounterEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetSwapchainCounterEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["counter"], counter, json_options);
-        FieldToJson(args["pCounterValue"], pCounterValue, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+        FieldToJson(writer.Key("counter"), counter, json_options);
+        FieldToJson(writer.Key("pCounterValue"), pCounterValue, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6783,13 +7178,14 @@ void VulkanExportJsonConsumer::Process_vkGetRefreshCycleDurationGOOGLE(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkRefreshCycleDurationGOOGLE>* pDisplayTimingProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRefreshCycleDurationGOOGLE");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetRefreshCycleDurationGOOGLE");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pDisplayTimingProperties"], pDisplayTimingProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+        FieldToJson(writer.Key("pDisplayTimingProperties"), pDisplayTimingProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6801,14 +7197,15 @@ void VulkanExportJsonConsumer::Process_vkGetPastPresentationTimingGOOGLE(
     PointerDecoder<uint32_t>*                   pPresentationTimingCount,
     StructPointerDecoder<Decoded_VkPastPresentationTimingGOOGLE>* pPresentationTimings)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPastPresentationTimingGOOGLE");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPastPresentationTimingGOOGLE");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pPresentationTimingCount"], pPresentationTimingCount, json_options);
-        FieldToJson(args["pPresentationTimings"], pPresentationTimings, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+        FieldToJson(writer.Key("pPresentationTimingCount"), pPresentationTimingCount, json_options);
+        FieldToJson(writer.Key("pPresentationTimings"), pPresentationTimings, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6819,14 +7216,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleEXT(
     uint32_t                                    discardRectangleCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pDiscardRectangles)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstDiscardRectangle"], firstDiscardRectangle, json_options);
-        FieldToJson(args["discardRectangleCount"], discardRectangleCount, json_options);
-        FieldToJson(args["pDiscardRectangles"], pDiscardRectangles, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstDiscardRectangle"), firstDiscardRectangle, json_options);
+        FieldToJson(writer.Key("discardRectangleCount"), discardRectangleCount, json_options);
+        FieldToJson(writer.Key("pDiscardRectangles"), pDiscardRectangles, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6835,12 +7233,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    discardRectangleEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["discardRectangleEnable"], discardRectangleEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("discardRectangleEnable"), discardRectangleEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6849,12 +7248,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDiscardRectangleModeEXT(
     format::HandleId                            commandBuffer,
     VkDiscardRectangleModeEXT                   discardRectangleMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleModeEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDiscardRectangleModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["discardRectangleMode"], discardRectangleMode, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("discardRectangleMode"), discardRectangleMode, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6865,13 +7265,14 @@ void VulkanExportJsonConsumer::Process_vkSetHdrMetadataEXT(
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains,
     StructPointerDecoder<Decoded_VkHdrMetadataEXT>* pMetadata)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetHdrMetadataEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSetHdrMetadataEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["swapchainCount"], swapchainCount, json_options);
-        HandleToJson(args["pSwapchains"], pSwapchains, json_options);
-        FieldToJson(args["pMetadata"], pMetadata, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("swapchainCount"), swapchainCount, json_options);
+        HandleToJson(writer.Key("pSwapchains"), pSwapchains, json_options);
+        FieldToJson(writer.Key("pMetadata"), pMetadata, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6883,14 +7284,15 @@ void VulkanExportJsonConsumer::Process_vkCreateIOSSurfaceMVK(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateIOSSurfaceMVK");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateIOSSurfaceMVK");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6902,14 +7304,15 @@ void VulkanExportJsonConsumer::Process_vkCreateMacOSSurfaceMVK(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateMacOSSurfaceMVK");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateMacOSSurfaceMVK");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6919,12 +7322,13 @@ void VulkanExportJsonConsumer::Process_vkSetDebugUtilsObjectNameEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugUtilsObjectNameInfoEXT>* pNameInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetDebugUtilsObjectNameEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSetDebugUtilsObjectNameEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pNameInfo"], pNameInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pNameInfo"), pNameInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6934,12 +7338,13 @@ void VulkanExportJsonConsumer::Process_vkSetDebugUtilsObjectTagEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugUtilsObjectTagInfoEXT>* pTagInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetDebugUtilsObjectTagEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSetDebugUtilsObjectTagEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pTagInfo"], pTagInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pTagInfo"), pTagInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6948,11 +7353,12 @@ void VulkanExportJsonConsumer::Process_vkQueueBeginDebugUtilsLabelEXT(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueBeginDebugUtilsLabelEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkQueueBeginDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pLabelInfo"], pLabelInfo, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+        FieldToJson(writer.Key("pLabelInfo"), pLabelInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6960,10 +7366,11 @@ void VulkanExportJsonConsumer::Process_vkQueueEndDebugUtilsLabelEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            queue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueEndDebugUtilsLabelEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkQueueEndDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6972,11 +7379,12 @@ void VulkanExportJsonConsumer::Process_vkQueueInsertDebugUtilsLabelEXT(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueInsertDebugUtilsLabelEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkQueueInsertDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pLabelInfo"], pLabelInfo, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+        FieldToJson(writer.Key("pLabelInfo"), pLabelInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6985,12 +7393,13 @@ void VulkanExportJsonConsumer::Process_vkCmdBeginDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBeginDebugUtilsLabelEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBeginDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pLabelInfo"], pLabelInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pLabelInfo"), pLabelInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -6998,11 +7407,12 @@ void VulkanExportJsonConsumer::Process_vkCmdEndDebugUtilsLabelEXT(
     const ApiCallInfo&                          call_info,
     format::HandleId                            commandBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdEndDebugUtilsLabelEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdEndDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7011,12 +7421,13 @@ void VulkanExportJsonConsumer::Process_vkCmdInsertDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdInsertDebugUtilsLabelEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdInsertDebugUtilsLabelEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pLabelInfo"], pLabelInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pLabelInfo"), pLabelInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7028,14 +7439,15 @@ void VulkanExportJsonConsumer::Process_vkCreateDebugUtilsMessengerEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDebugUtilsMessengerEXT>* pMessenger)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDebugUtilsMessengerEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateDebugUtilsMessengerEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pMessenger"], pMessenger, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pMessenger"), pMessenger, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7045,12 +7457,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyDebugUtilsMessengerEXT(
     format::HandleId                            messenger,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyDebugUtilsMessengerEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyDebugUtilsMessengerEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        HandleToJson(args["messenger"], messenger, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        HandleToJson(writer.Key("messenger"), messenger, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7061,13 +7474,14 @@ void VulkanExportJsonConsumer::Process_vkSubmitDebugUtilsMessageEXT(
     VkDebugUtilsMessageTypeFlagsEXT             messageTypes,
     StructPointerDecoder<Decoded_VkDebugUtilsMessengerCallbackDataEXT>* pCallbackData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSubmitDebugUtilsMessageEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSubmitDebugUtilsMessageEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["messageSeverity"], messageSeverity, json_options);
-        FieldToJson(VkDebugUtilsMessageTypeFlagsEXT_t(), args["messageTypes"], messageTypes, json_options);
-        FieldToJson(args["pCallbackData"], pCallbackData, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("messageSeverity"), messageSeverity, json_options);
+        FieldToJson(VkDebugUtilsMessageTypeFlagsEXT_t(), writer.Key("messageTypes"), messageTypes, json_options);
+        FieldToJson(writer.Key("pCallbackData"), pCallbackData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7078,13 +7492,14 @@ void VulkanExportJsonConsumer::Process_vkGetAndroidHardwareBufferPropertiesANDRO
     uint64_t                                    buffer,
     StructPointerDecoder<Decoded_VkAndroidHardwareBufferPropertiesANDROID>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAndroidHardwareBufferPropertiesANDROID");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetAndroidHardwareBufferPropertiesANDROID");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7095,13 +7510,14 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryAndroidHardwareBufferANDROID(
     StructPointerDecoder<Decoded_VkMemoryGetAndroidHardwareBufferInfoANDROID>* pInfo,
     PointerDecoder<uint64_t, void*>*            pBuffer)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryAndroidHardwareBufferANDROID");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetMemoryAndroidHardwareBufferANDROID");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pBuffer"], pBuffer, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pBuffer"), pBuffer, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7110,12 +7526,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetSampleLocationsEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSampleLocationsInfoEXT>* pSampleLocationsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleLocationsEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetSampleLocationsEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pSampleLocationsInfo"], pSampleLocationsInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pSampleLocationsInfo"), pSampleLocationsInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7125,12 +7542,13 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceMultisamplePropertiesE
     VkSampleCountFlagBits                       samples,
     StructPointerDecoder<Decoded_VkMultisamplePropertiesEXT>* pMultisampleProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceMultisamplePropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["samples"], samples, json_options);
-        FieldToJson(args["pMultisampleProperties"], pMultisampleProperties, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("samples"), samples, json_options);
+        FieldToJson(writer.Key("pMultisampleProperties"), pMultisampleProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7141,13 +7559,14 @@ void VulkanExportJsonConsumer::Process_vkGetImageDrmFormatModifierPropertiesEXT(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkImageDrmFormatModifierPropertiesEXT>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageDrmFormatModifierPropertiesEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageDrmFormatModifierPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("image"), image, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7159,14 +7578,15 @@ void VulkanExportJsonConsumer::Process_vkCreateValidationCacheEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkValidationCacheEXT>* pValidationCache)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateValidationCacheEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateValidationCacheEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pValidationCache"], pValidationCache, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pValidationCache"), pValidationCache, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7176,12 +7596,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyValidationCacheEXT(
     format::HandleId                            validationCache,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyValidationCacheEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyValidationCacheEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["validationCache"], validationCache, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("validationCache"), validationCache, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7193,14 +7614,15 @@ void VulkanExportJsonConsumer::Process_vkMergeValidationCachesEXT(
     uint32_t                                    srcCacheCount,
     HandlePointerDecoder<VkValidationCacheEXT>* pSrcCaches)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkMergeValidationCachesEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkMergeValidationCachesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["dstCache"], dstCache, json_options);
-        FieldToJson(args["srcCacheCount"], srcCacheCount, json_options);
-        HandleToJson(args["pSrcCaches"], pSrcCaches, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("dstCache"), dstCache, json_options);
+        FieldToJson(writer.Key("srcCacheCount"), srcCacheCount, json_options);
+        HandleToJson(writer.Key("pSrcCaches"), pSrcCaches, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7212,14 +7634,15 @@ void VulkanExportJsonConsumer::Process_vkGetValidationCacheDataEXT(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetValidationCacheDataEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetValidationCacheDataEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["validationCache"], validationCache, json_options);
-        FieldToJson(args["pDataSize"], pDataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("validationCache"), validationCache, json_options);
+        FieldToJson(writer.Key("pDataSize"), pDataSize, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7229,13 +7652,14 @@ void VulkanExportJsonConsumer::Process_vkCmdBindShadingRateImageNV(
     format::HandleId                            imageView,
     VkImageLayout                               imageLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindShadingRateImageNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindShadingRateImageNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["imageView"], imageView, json_options);
-        FieldToJson(args["imageLayout"], imageLayout, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("imageView"), imageView, json_options);
+        FieldToJson(writer.Key("imageLayout"), imageLayout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7246,14 +7670,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportShadingRatePaletteNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkShadingRatePaletteNV>* pShadingRatePalettes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportShadingRatePaletteNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetViewportShadingRatePaletteNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstViewport"], firstViewport, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pShadingRatePalettes"], pShadingRatePalettes, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstViewport"), firstViewport, json_options);
+        FieldToJson(writer.Key("viewportCount"), viewportCount, json_options);
+        FieldToJson(writer.Key("pShadingRatePalettes"), pShadingRatePalettes, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7264,14 +7689,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoarseSampleOrderNV(
     uint32_t                                    customSampleOrderCount,
     StructPointerDecoder<Decoded_VkCoarseSampleOrderCustomNV>* pCustomSampleOrders)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoarseSampleOrderNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetCoarseSampleOrderNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["sampleOrderType"], sampleOrderType, json_options);
-        FieldToJson(args["customSampleOrderCount"], customSampleOrderCount, json_options);
-        FieldToJson(args["pCustomSampleOrders"], pCustomSampleOrders, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("sampleOrderType"), sampleOrderType, json_options);
+        FieldToJson(writer.Key("customSampleOrderCount"), customSampleOrderCount, json_options);
+        FieldToJson(writer.Key("pCustomSampleOrders"), pCustomSampleOrders, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7283,14 +7709,15 @@ void VulkanExportJsonConsumer::Process_vkCreateAccelerationStructureNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkAccelerationStructureNV>* pAccelerationStructure)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateAccelerationStructureNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateAccelerationStructureNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pAccelerationStructure"], pAccelerationStructure, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pAccelerationStructure"), pAccelerationStructure, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7300,12 +7727,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyAccelerationStructureNV(
     format::HandleId                            accelerationStructure,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyAccelerationStructureNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyAccelerationStructureNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["accelerationStructure"], accelerationStructure, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("accelerationStructure"), accelerationStructure, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7315,12 +7743,13 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureMemoryRequireme
     StructPointerDecoder<Decoded_VkAccelerationStructureMemoryRequirementsInfoNV>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2KHR>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureMemoryRequirementsNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetAccelerationStructureMemoryRequirementsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7331,13 +7760,14 @@ void VulkanExportJsonConsumer::Process_vkBindAccelerationStructureMemoryNV(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindAccelerationStructureMemoryInfoNV>* pBindInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindAccelerationStructureMemoryNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkBindAccelerationStructureMemoryNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["bindInfoCount"], bindInfoCount, json_options);
-        FieldToJson(args["pBindInfos"], pBindInfos, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("bindInfoCount"), bindInfoCount, json_options);
+        FieldToJson(writer.Key("pBindInfos"), pBindInfos, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7353,19 +7783,20 @@ void VulkanExportJsonConsumer::Process_vkCmdBuildAccelerationStructureNV(
     format::HandleId                            scratch,
     VkDeviceSize                                scratchOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBuildAccelerationStructureNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBuildAccelerationStructureNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        HandleToJson(args["instanceData"], instanceData, json_options);
-        FieldToJson(args["instanceOffset"], instanceOffset, json_options);
-        Bool32ToJson(args["update"], update, json_options);
-        HandleToJson(args["dst"], dst, json_options);
-        HandleToJson(args["src"], src, json_options);
-        HandleToJson(args["scratch"], scratch, json_options);
-        FieldToJson(args["scratchOffset"], scratchOffset, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        HandleToJson(writer.Key("instanceData"), instanceData, json_options);
+        FieldToJson(writer.Key("instanceOffset"), instanceOffset, json_options);
+        Bool32ToJson(writer.Key("update"), update, json_options);
+        HandleToJson(writer.Key("dst"), dst, json_options);
+        HandleToJson(writer.Key("src"), src, json_options);
+        HandleToJson(writer.Key("scratch"), scratch, json_options);
+        FieldToJson(writer.Key("scratchOffset"), scratchOffset, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7376,14 +7807,15 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureNV(
     format::HandleId                            src,
     VkCopyAccelerationStructureModeKHR          mode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["dst"], dst, json_options);
-        HandleToJson(args["src"], src, json_options);
-        FieldToJson(args["mode"], mode, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("dst"), dst, json_options);
+        HandleToJson(writer.Key("src"), src, json_options);
+        FieldToJson(writer.Key("mode"), mode, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7405,25 +7837,26 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysNV(
     uint32_t                                    height,
     uint32_t                                    depth)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysNV");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["raygenShaderBindingTableBuffer"], raygenShaderBindingTableBuffer, json_options);
-        FieldToJson(args["raygenShaderBindingOffset"], raygenShaderBindingOffset, json_options);
-        HandleToJson(args["missShaderBindingTableBuffer"], missShaderBindingTableBuffer, json_options);
-        FieldToJson(args["missShaderBindingOffset"], missShaderBindingOffset, json_options);
-        FieldToJson(args["missShaderBindingStride"], missShaderBindingStride, json_options);
-        HandleToJson(args["hitShaderBindingTableBuffer"], hitShaderBindingTableBuffer, json_options);
-        FieldToJson(args["hitShaderBindingOffset"], hitShaderBindingOffset, json_options);
-        FieldToJson(args["hitShaderBindingStride"], hitShaderBindingStride, json_options);
-        HandleToJson(args["callableShaderBindingTableBuffer"], callableShaderBindingTableBuffer, json_options);
-        FieldToJson(args["callableShaderBindingOffset"], callableShaderBindingOffset, json_options);
-        FieldToJson(args["callableShaderBindingStride"], callableShaderBindingStride, json_options);
-        FieldToJson(args["width"], width, json_options);
-        FieldToJson(args["height"], height, json_options);
-        FieldToJson(args["depth"], depth, json_options);
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdTraceRaysNV");
+    const JsonOptions& json_options = GetJsonOptions();
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("raygenShaderBindingTableBuffer"), raygenShaderBindingTableBuffer, json_options);
+        FieldToJson(writer.Key("raygenShaderBindingOffset"), raygenShaderBindingOffset, json_options);
+        HandleToJson(writer.Key("missShaderBindingTableBuffer"), missShaderBindingTableBuffer, json_options);
+        FieldToJson(writer.Key("missShaderBindingOffset"), missShaderBindingOffset, json_options);
+        FieldToJson(writer.Key("missShaderBindingStride"), missShaderBindingStride, json_options);
+        HandleToJson(writer.Key("hitShaderBindingTableBuffer"), hitShaderBindingTableBuffer, json_options);
+        FieldToJson(writer.Key("hitShaderBindingOffset"), hitShaderBindingOffset, json_options);
+        FieldToJson(writer.Key("hitShaderBindingStride"), hitShaderBindingStride, json_options);
+        HandleToJson(writer.Key("callableShaderBindingTableBuffer"), callableShaderBindingTableBuffer, json_options);
+        FieldToJson(writer.Key("callableShaderBindingOffset"), callableShaderBindingOffset, json_options);
+        FieldToJson(writer.Key("callableShaderBindingStride"), callableShaderBindingStride, json_options);
+        FieldToJson(writer.Key("width"), width, json_options);
+        FieldToJson(writer.Key("height"), height, json_options);
+        FieldToJson(writer.Key("depth"), depth, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7437,16 +7870,17 @@ void VulkanExportJsonConsumer::Process_vkCreateRayTracingPipelinesNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRayTracingPipelinesNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateRayTracingPipelinesNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipelineCache"], pipelineCache, json_options);
-        FieldToJson(args["createInfoCount"], createInfoCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelines"], pPipelines, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipelineCache"), pipelineCache, json_options);
+        FieldToJson(writer.Key("createInfoCount"), createInfoCount, json_options);
+        FieldToJson(writer.Key("pCreateInfos"), pCreateInfos, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pPipelines"), pPipelines, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7460,16 +7894,17 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupHandlesKHR(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["firstGroup"], firstGroup, json_options);
-        FieldToJson(args["groupCount"], groupCount, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipeline"), pipeline, json_options);
+        FieldToJson(writer.Key("firstGroup"), firstGroup, json_options);
+        FieldToJson(writer.Key("groupCount"), groupCount, json_options);
+        FieldToJson(writer.Key("dataSize"), dataSize, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7483,16 +7918,17 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupHandlesNV(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupHandlesNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["firstGroup"], firstGroup, json_options);
-        FieldToJson(args["groupCount"], groupCount, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipeline"), pipeline, json_options);
+        FieldToJson(writer.Key("firstGroup"), firstGroup, json_options);
+        FieldToJson(writer.Key("groupCount"), groupCount, json_options);
+        FieldToJson(writer.Key("dataSize"), dataSize, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7504,14 +7940,15 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureHandleNV(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureHandleNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetAccelerationStructureHandleNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["accelerationStructure"], accelerationStructure, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("accelerationStructure"), accelerationStructure, json_options);
+        FieldToJson(writer.Key("dataSize"), dataSize, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7524,16 +7961,17 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteAccelerationStructuresPropertie
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["accelerationStructureCount"], accelerationStructureCount, json_options);
-        HandleToJson(args["pAccelerationStructures"], pAccelerationStructures, json_options);
-        FieldToJson(args["queryType"], queryType, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("accelerationStructureCount"), accelerationStructureCount, json_options);
+        HandleToJson(writer.Key("pAccelerationStructures"), pAccelerationStructures, json_options);
+        FieldToJson(writer.Key("queryType"), queryType, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("firstQuery"), firstQuery, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7544,13 +7982,14 @@ void VulkanExportJsonConsumer::Process_vkCompileDeferredNV(
     format::HandleId                            pipeline,
     uint32_t                                    shader)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCompileDeferredNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCompileDeferredNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["shader"], shader, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipeline"), pipeline, json_options);
+        FieldToJson(writer.Key("shader"), shader, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7562,14 +8001,15 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryHostPointerPropertiesEXT(
     uint64_t                                    pHostPointer,
     StructPointerDecoder<Decoded_VkMemoryHostPointerPropertiesEXT>* pMemoryHostPointerProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryHostPointerPropertiesEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetMemoryHostPointerPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["handleType"], handleType, json_options);
-        FieldToJson(args["pHostPointer"], pHostPointer, json_options);
-        FieldToJson(args["pMemoryHostPointerProperties"], pMemoryHostPointerProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("handleType"), handleType, json_options);
+        FieldToJson(writer.Key("pHostPointer"), pHostPointer, json_options);
+        FieldToJson(writer.Key("pMemoryHostPointerProperties"), pMemoryHostPointerProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7581,15 +8021,16 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteBufferMarkerAMD(
     VkDeviceSize                                dstOffset,
     uint32_t                                    marker)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteBufferMarkerAMD");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdWriteBufferMarkerAMD");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineStage"], pipelineStage, json_options);
-        HandleToJson(args["dstBuffer"], dstBuffer, json_options);
-        FieldToJson(args["dstOffset"], dstOffset, json_options);
-        FieldToJson(args["marker"], marker, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pipelineStage"), pipelineStage, json_options);
+        HandleToJson(writer.Key("dstBuffer"), dstBuffer, json_options);
+        FieldToJson(writer.Key("dstOffset"), dstOffset, json_options);
+        FieldToJson(writer.Key("marker"), marker, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7600,13 +8041,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomai
     PointerDecoder<uint32_t>*                   pTimeDomainCount,
     PointerDecoder<VkTimeDomainKHR>*            pTimeDomains)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pTimeDomainCount"], pTimeDomainCount, json_options);
-        FieldToJson(args["pTimeDomains"], pTimeDomains, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pTimeDomainCount"), pTimeDomainCount, json_options);
+        FieldToJson(writer.Key("pTimeDomains"), pTimeDomains, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7619,15 +8061,16 @@ void VulkanExportJsonConsumer::Process_vkGetCalibratedTimestampsEXT(
     PointerDecoder<uint64_t>*                   pTimestamps,
     PointerDecoder<uint64_t>*                   pMaxDeviation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetCalibratedTimestampsEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetCalibratedTimestampsEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["timestampCount"], timestampCount, json_options);
-        FieldToJson(args["pTimestampInfos"], pTimestampInfos, json_options);
-        FieldToJson(args["pTimestamps"], pTimestamps, json_options);
-        FieldToJson(args["pMaxDeviation"], pMaxDeviation, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("timestampCount"), timestampCount, json_options);
+        FieldToJson(writer.Key("pTimestampInfos"), pTimestampInfos, json_options);
+        FieldToJson(writer.Key("pTimestamps"), pTimestamps, json_options);
+        FieldToJson(writer.Key("pMaxDeviation"), pMaxDeviation, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7637,13 +8080,14 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksNV(
     uint32_t                                    taskCount,
     uint32_t                                    firstTask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["taskCount"], taskCount, json_options);
-        FieldToJson(args["firstTask"], firstTask, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("taskCount"), taskCount, json_options);
+        FieldToJson(writer.Key("firstTask"), firstTask, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7655,15 +8099,16 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectNV(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        FieldToJson(writer.Key("drawCount"), drawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7677,17 +8122,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectCountNV(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        HandleToJson(writer.Key("countBuffer"), countBuffer, json_options);
+        FieldToJson(writer.Key("countBufferOffset"), countBufferOffset, json_options);
+        FieldToJson(writer.Key("maxDrawCount"), maxDrawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7698,14 +8144,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetExclusiveScissorEnableNV(
     uint32_t                                    exclusiveScissorCount,
     PointerDecoder<VkBool32>*                   pExclusiveScissorEnables)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetExclusiveScissorEnableNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetExclusiveScissorEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstExclusiveScissor"], firstExclusiveScissor, json_options);
-        FieldToJson(args["exclusiveScissorCount"], exclusiveScissorCount, json_options);
-        Bool32ToJson(args["pExclusiveScissorEnables"], pExclusiveScissorEnables, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstExclusiveScissor"), firstExclusiveScissor, json_options);
+        FieldToJson(writer.Key("exclusiveScissorCount"), exclusiveScissorCount, json_options);
+        Bool32ToJson(writer.Key("pExclusiveScissorEnables"), pExclusiveScissorEnables, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7716,14 +8163,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetExclusiveScissorNV(
     uint32_t                                    exclusiveScissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pExclusiveScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetExclusiveScissorNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetExclusiveScissorNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstExclusiveScissor"], firstExclusiveScissor, json_options);
-        FieldToJson(args["exclusiveScissorCount"], exclusiveScissorCount, json_options);
-        FieldToJson(args["pExclusiveScissors"], pExclusiveScissors, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstExclusiveScissor"), firstExclusiveScissor, json_options);
+        FieldToJson(writer.Key("exclusiveScissorCount"), exclusiveScissorCount, json_options);
+        FieldToJson(writer.Key("pExclusiveScissors"), pExclusiveScissors, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7732,12 +8180,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCheckpointNV(
     format::HandleId                            commandBuffer,
     uint64_t                                    pCheckpointMarker)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCheckpointNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetCheckpointNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pCheckpointMarker"], pCheckpointMarker, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pCheckpointMarker"), pCheckpointMarker, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7747,12 +8196,13 @@ void VulkanExportJsonConsumer::Process_vkGetQueueCheckpointDataNV(
     PointerDecoder<uint32_t>*                   pCheckpointDataCount,
     StructPointerDecoder<Decoded_VkCheckpointDataNV>* pCheckpointData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetQueueCheckpointDataNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetQueueCheckpointDataNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pCheckpointDataCount"], pCheckpointDataCount, json_options);
-        FieldToJson(args["pCheckpointData"], pCheckpointData, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+        FieldToJson(writer.Key("pCheckpointDataCount"), pCheckpointDataCount, json_options);
+        FieldToJson(writer.Key("pCheckpointData"), pCheckpointData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7762,12 +8212,13 @@ void VulkanExportJsonConsumer::Process_vkInitializePerformanceApiINTEL(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkInitializePerformanceApiInfoINTEL>* pInitializeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkInitializePerformanceApiINTEL");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkInitializePerformanceApiINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInitializeInfo"], pInitializeInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInitializeInfo"), pInitializeInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7775,10 +8226,11 @@ void VulkanExportJsonConsumer::Process_vkUninitializePerformanceApiINTEL(
     const ApiCallInfo&                          call_info,
     format::HandleId                            device)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkUninitializePerformanceApiINTEL");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkUninitializePerformanceApiINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7788,13 +8240,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceMarkerINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceMarkerInfoINTEL>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceMarkerINTEL");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetPerformanceMarkerINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pMarkerInfo"], pMarkerInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pMarkerInfo"), pMarkerInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7804,13 +8257,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceStreamMarkerINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceStreamMarkerInfoINTEL>* pMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceStreamMarkerINTEL");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetPerformanceStreamMarkerINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pMarkerInfo"], pMarkerInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pMarkerInfo"), pMarkerInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7820,13 +8274,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPerformanceOverrideINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceOverrideInfoINTEL>* pOverrideInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPerformanceOverrideINTEL");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetPerformanceOverrideINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pOverrideInfo"], pOverrideInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pOverrideInfo"), pOverrideInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7837,13 +8292,14 @@ void VulkanExportJsonConsumer::Process_vkAcquirePerformanceConfigurationINTEL(
     StructPointerDecoder<Decoded_VkPerformanceConfigurationAcquireInfoINTEL>* pAcquireInfo,
     HandlePointerDecoder<VkPerformanceConfigurationINTEL>* pConfiguration)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquirePerformanceConfigurationINTEL");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkAcquirePerformanceConfigurationINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pAcquireInfo"], pAcquireInfo, json_options);
-        HandleToJson(args["pConfiguration"], pConfiguration, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pAcquireInfo"), pAcquireInfo, json_options);
+        HandleToJson(writer.Key("pConfiguration"), pConfiguration, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7853,12 +8309,13 @@ void VulkanExportJsonConsumer::Process_vkReleasePerformanceConfigurationINTEL(
     format::HandleId                            device,
     format::HandleId                            configuration)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleasePerformanceConfigurationINTEL");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkReleasePerformanceConfigurationINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["configuration"], configuration, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("configuration"), configuration, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7868,12 +8325,13 @@ void VulkanExportJsonConsumer::Process_vkQueueSetPerformanceConfigurationINTEL(
     format::HandleId                            queue,
     format::HandleId                            configuration)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueSetPerformanceConfigurationINTEL");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkQueueSetPerformanceConfigurationINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        HandleToJson(args["configuration"], configuration, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+        HandleToJson(writer.Key("configuration"), configuration, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7884,13 +8342,14 @@ void VulkanExportJsonConsumer::Process_vkGetPerformanceParameterINTEL(
     VkPerformanceParameterTypeINTEL             parameter,
     StructPointerDecoder<Decoded_VkPerformanceValueINTEL>* pValue)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPerformanceParameterINTEL");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPerformanceParameterINTEL");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["parameter"], parameter, json_options);
-        FieldToJson(args["pValue"], pValue, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("parameter"), parameter, json_options);
+        FieldToJson(writer.Key("pValue"), pValue, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7900,12 +8359,13 @@ void VulkanExportJsonConsumer::Process_vkSetLocalDimmingAMD(
     format::HandleId                            swapChain,
     VkBool32                                    localDimmingEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetLocalDimmingAMD");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSetLocalDimmingAMD");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapChain"], swapChain, json_options);
-        Bool32ToJson(args["localDimmingEnable"], localDimmingEnable, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapChain"), swapChain, json_options);
+        Bool32ToJson(writer.Key("localDimmingEnable"), localDimmingEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7917,14 +8377,15 @@ void VulkanExportJsonConsumer::Process_vkCreateImagePipeSurfaceFUCHSIA(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateImagePipeSurfaceFUCHSIA");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateImagePipeSurfaceFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7936,14 +8397,15 @@ void VulkanExportJsonConsumer::Process_vkCreateMetalSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateMetalSurfaceEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateMetalSurfaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7953,12 +8415,13 @@ void VulkanExportJsonConsumer::Process_vkGetBufferDeviceAddressEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetBufferDeviceAddressEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetBufferDeviceAddressEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJsonAsHex(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7969,13 +8432,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceToolPropertiesEXT(
     PointerDecoder<uint32_t>*                   pToolCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceToolProperties>* pToolProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceToolPropertiesEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceToolPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pToolCount"], pToolCount, json_options);
-        FieldToJson(args["pToolProperties"], pToolProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pToolCount"), pToolCount, json_options);
+        FieldToJson(writer.Key("pToolProperties"), pToolProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -7986,13 +8450,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixPrope
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkCooperativeMatrixPropertiesNV>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pPropertyCount"], pPropertyCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pPropertyCount"), pPropertyCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8003,13 +8468,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSupportedFramebufferMi
     PointerDecoder<uint32_t>*                   pCombinationCount,
     StructPointerDecoder<Decoded_VkFramebufferMixedSamplesCombinationNV>* pCombinations)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pCombinationCount"], pCombinationCount, json_options);
-        FieldToJson(args["pCombinations"], pCombinations, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pCombinationCount"), pCombinationCount, json_options);
+        FieldToJson(writer.Key("pCombinations"), pCombinations, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8021,14 +8487,15 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceSurfacePresentModes2EX
     PointerDecoder<uint32_t>*                   pPresentModeCount,
     PointerDecoder<VkPresentModeKHR>*           pPresentModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceSurfacePresentModes2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pSurfaceInfo"], pSurfaceInfo, json_options);
-        FieldToJson(args["pPresentModeCount"], pPresentModeCount, json_options);
-        FieldToJson(args["pPresentModes"], pPresentModes, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pSurfaceInfo"), pSurfaceInfo, json_options);
+        FieldToJson(writer.Key("pPresentModeCount"), pPresentModeCount, json_options);
+        FieldToJson(writer.Key("pPresentModes"), pPresentModes, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8038,12 +8505,13 @@ void VulkanExportJsonConsumer::Process_vkAcquireFullScreenExclusiveModeEXT(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireFullScreenExclusiveModeEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkAcquireFullScreenExclusiveModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8053,12 +8521,13 @@ void VulkanExportJsonConsumer::Process_vkReleaseFullScreenExclusiveModeEXT(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseFullScreenExclusiveModeEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkReleaseFullScreenExclusiveModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8069,13 +8538,14 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceGroupSurfacePresentModes2EXT(
     StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
     PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModes2EXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceGroupSurfacePresentModes2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pSurfaceInfo"], pSurfaceInfo, json_options);
-        FieldToJson(args["pModes"], pModes, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pSurfaceInfo"), pSurfaceInfo, json_options);
+        FieldToJson(writer.Key("pModes"), pModes, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8087,14 +8557,15 @@ void VulkanExportJsonConsumer::Process_vkCreateHeadlessSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateHeadlessSurfaceEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateHeadlessSurfaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8104,13 +8575,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleEXT(
     uint32_t                                    lineStippleFactor,
     uint16_t                                    lineStipplePattern)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetLineStippleEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["lineStippleFactor"], lineStippleFactor, json_options);
-        FieldToJson(args["lineStipplePattern"], lineStipplePattern, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("lineStippleFactor"), lineStippleFactor, json_options);
+        FieldToJson(writer.Key("lineStipplePattern"), lineStipplePattern, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8121,13 +8593,14 @@ void VulkanExportJsonConsumer::Process_vkResetQueryPoolEXT(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkResetQueryPoolEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkResetQueryPoolEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
-        FieldToJson(args["queryCount"], queryCount, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("firstQuery"), firstQuery, json_options);
+        FieldToJson(writer.Key("queryCount"), queryCount, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8136,12 +8609,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCullModeEXT(
     format::HandleId                            commandBuffer,
     VkCullModeFlags                             cullMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCullModeEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetCullModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkCullModeFlags_t(), args["cullMode"], cullMode, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkCullModeFlags_t(), writer.Key("cullMode"), cullMode, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8150,12 +8624,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFrontFaceEXT(
     format::HandleId                            commandBuffer,
     VkFrontFace                                 frontFace)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFrontFaceEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetFrontFaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["frontFace"], frontFace, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("frontFace"), frontFace, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8164,12 +8639,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveTopologyEXT(
     format::HandleId                            commandBuffer,
     VkPrimitiveTopology                         primitiveTopology)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveTopologyEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetPrimitiveTopologyEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["primitiveTopology"], primitiveTopology, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("primitiveTopology"), primitiveTopology, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8179,13 +8655,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWithCountEXT(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWithCountEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetViewportWithCountEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pViewports"], pViewports, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("viewportCount"), viewportCount, json_options);
+        FieldToJson(writer.Key("pViewports"), pViewports, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8195,13 +8672,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetScissorWithCountEXT(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetScissorWithCountEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetScissorWithCountEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["scissorCount"], scissorCount, json_options);
-        FieldToJson(args["pScissors"], pScissors, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("scissorCount"), scissorCount, json_options);
+        FieldToJson(writer.Key("pScissors"), pScissors, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8215,17 +8693,18 @@ void VulkanExportJsonConsumer::Process_vkCmdBindVertexBuffers2EXT(
     PointerDecoder<VkDeviceSize>*               pSizes,
     PointerDecoder<VkDeviceSize>*               pStrides)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers2EXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindVertexBuffers2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstBinding"], firstBinding, json_options);
-        FieldToJson(args["bindingCount"], bindingCount, json_options);
-        HandleToJson(args["pBuffers"], pBuffers, json_options);
-        FieldToJson(args["pOffsets"], pOffsets, json_options);
-        FieldToJson(args["pSizes"], pSizes, json_options);
-        FieldToJson(args["pStrides"], pStrides, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstBinding"), firstBinding, json_options);
+        FieldToJson(writer.Key("bindingCount"), bindingCount, json_options);
+        HandleToJson(writer.Key("pBuffers"), pBuffers, json_options);
+        FieldToJson(writer.Key("pOffsets"), pOffsets, json_options);
+        FieldToJson(writer.Key("pSizes"), pSizes, json_options);
+        FieldToJson(writer.Key("pStrides"), pStrides, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8234,12 +8713,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthTestEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthTestEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthTestEnable"], depthTestEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("depthTestEnable"), depthTestEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8248,12 +8728,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthWriteEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthWriteEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthWriteEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthWriteEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthWriteEnable"], depthWriteEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("depthWriteEnable"), depthWriteEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8262,12 +8743,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthCompareOpEXT(
     format::HandleId                            commandBuffer,
     VkCompareOp                                 depthCompareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthCompareOpEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthCompareOpEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["depthCompareOp"], depthCompareOp, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("depthCompareOp"), depthCompareOp, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8276,12 +8758,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBoundsTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBoundsTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthBoundsTestEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthBoundsTestEnable"], depthBoundsTestEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("depthBoundsTestEnable"), depthBoundsTestEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8290,12 +8773,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    stencilTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilTestEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetStencilTestEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["stencilTestEnable"], stencilTestEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("stencilTestEnable"), stencilTestEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8308,16 +8792,17 @@ void VulkanExportJsonConsumer::Process_vkCmdSetStencilOpEXT(
     VkStencilOp                                 depthFailOp,
     VkCompareOp                                 compareOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetStencilOpEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetStencilOpEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkStencilFaceFlags_t(), args["faceMask"], faceMask, json_options);
-        FieldToJson(args["failOp"], failOp, json_options);
-        FieldToJson(args["passOp"], passOp, json_options);
-        FieldToJson(args["depthFailOp"], depthFailOp, json_options);
-        FieldToJson(args["compareOp"], compareOp, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkStencilFaceFlags_t(), writer.Key("faceMask"), faceMask, json_options);
+        FieldToJson(writer.Key("failOp"), failOp, json_options);
+        FieldToJson(writer.Key("passOp"), passOp, json_options);
+        FieldToJson(writer.Key("depthFailOp"), depthFailOp, json_options);
+        FieldToJson(writer.Key("compareOp"), compareOp, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8327,12 +8812,13 @@ void VulkanExportJsonConsumer::Process_vkCopyMemoryToImageEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkCopyMemoryToImageInfoEXT>* pCopyMemoryToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToImageEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCopyMemoryToImageEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCopyMemoryToImageInfo"], pCopyMemoryToImageInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCopyMemoryToImageInfo"), pCopyMemoryToImageInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8342,12 +8828,13 @@ void VulkanExportJsonConsumer::Process_vkCopyImageToMemoryEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkCopyImageToMemoryInfoEXT>* pCopyImageToMemoryInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyImageToMemoryEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCopyImageToMemoryEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCopyImageToMemoryInfo"], pCopyImageToMemoryInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCopyImageToMemoryInfo"), pCopyImageToMemoryInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8357,12 +8844,13 @@ void VulkanExportJsonConsumer::Process_vkCopyImageToImageEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkCopyImageToImageInfoEXT>* pCopyImageToImageInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyImageToImageEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCopyImageToImageEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCopyImageToImageInfo"], pCopyImageToImageInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCopyImageToImageInfo"), pCopyImageToImageInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8373,13 +8861,14 @@ void VulkanExportJsonConsumer::Process_vkTransitionImageLayoutEXT(
     uint32_t                                    transitionCount,
     StructPointerDecoder<Decoded_VkHostImageLayoutTransitionInfoEXT>* pTransitions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkTransitionImageLayoutEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkTransitionImageLayoutEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["transitionCount"], transitionCount, json_options);
-        FieldToJson(args["pTransitions"], pTransitions, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("transitionCount"), transitionCount, json_options);
+        FieldToJson(writer.Key("pTransitions"), pTransitions, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8390,13 +8879,14 @@ void VulkanExportJsonConsumer::Process_vkGetImageSubresourceLayout2EXT(
     StructPointerDecoder<Decoded_VkImageSubresource2KHR>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout2KHR>* pLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout2EXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetImageSubresourceLayout2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["image"], image, json_options);
-        FieldToJson(args["pSubresource"], pSubresource, json_options);
-        FieldToJson(args["pLayout"], pLayout, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("image"), image, json_options);
+        FieldToJson(writer.Key("pSubresource"), pSubresource, json_options);
+        FieldToJson(writer.Key("pLayout"), pLayout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8406,12 +8896,13 @@ void VulkanExportJsonConsumer::Process_vkReleaseSwapchainImagesEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkReleaseSwapchainImagesInfoEXT>* pReleaseInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkReleaseSwapchainImagesEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkReleaseSwapchainImagesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pReleaseInfo"], pReleaseInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pReleaseInfo"), pReleaseInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8421,12 +8912,13 @@ void VulkanExportJsonConsumer::Process_vkGetGeneratedCommandsMemoryRequirementsN
     StructPointerDecoder<Decoded_VkGeneratedCommandsMemoryRequirementsInfoNV>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetGeneratedCommandsMemoryRequirementsNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetGeneratedCommandsMemoryRequirementsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8435,12 +8927,13 @@ void VulkanExportJsonConsumer::Process_vkCmdPreprocessGeneratedCommandsNV(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdPreprocessGeneratedCommandsNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdPreprocessGeneratedCommandsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pGeneratedCommandsInfo"], pGeneratedCommandsInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pGeneratedCommandsInfo"), pGeneratedCommandsInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8450,13 +8943,14 @@ void VulkanExportJsonConsumer::Process_vkCmdExecuteGeneratedCommandsNV(
     VkBool32                                    isPreprocessed,
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdExecuteGeneratedCommandsNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdExecuteGeneratedCommandsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["isPreprocessed"], isPreprocessed, json_options);
-        FieldToJson(args["pGeneratedCommandsInfo"], pGeneratedCommandsInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("isPreprocessed"), isPreprocessed, json_options);
+        FieldToJson(writer.Key("pGeneratedCommandsInfo"), pGeneratedCommandsInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8467,14 +8961,15 @@ void VulkanExportJsonConsumer::Process_vkCmdBindPipelineShaderGroupNV(
     format::HandleId                            pipeline,
     uint32_t                                    groupIndex)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindPipelineShaderGroupNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindPipelineShaderGroupNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineBindPoint"], pipelineBindPoint, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["groupIndex"], groupIndex, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pipelineBindPoint"), pipelineBindPoint, json_options);
+        HandleToJson(writer.Key("pipeline"), pipeline, json_options);
+        FieldToJson(writer.Key("groupIndex"), groupIndex, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8486,14 +8981,15 @@ void VulkanExportJsonConsumer::Process_vkCreateIndirectCommandsLayoutNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkIndirectCommandsLayoutNV>* pIndirectCommandsLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateIndirectCommandsLayoutNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateIndirectCommandsLayoutNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pIndirectCommandsLayout"], pIndirectCommandsLayout, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pIndirectCommandsLayout"), pIndirectCommandsLayout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8503,12 +8999,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyIndirectCommandsLayoutNV(
     format::HandleId                            indirectCommandsLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyIndirectCommandsLayoutNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyIndirectCommandsLayoutNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["indirectCommandsLayout"], indirectCommandsLayout, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("indirectCommandsLayout"), indirectCommandsLayout, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8517,12 +9014,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBias2EXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDepthBiasInfoEXT>* pDepthBiasInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBias2EXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthBias2EXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pDepthBiasInfo"], pDepthBiasInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pDepthBiasInfo"), pDepthBiasInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8533,13 +9031,14 @@ void VulkanExportJsonConsumer::Process_vkAcquireDrmDisplayEXT(
     int32_t                                     drmFd,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireDrmDisplayEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkAcquireDrmDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["drmFd"], drmFd, json_options);
-        HandleToJson(args["display"], display, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("drmFd"), drmFd, json_options);
+        HandleToJson(writer.Key("display"), display, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8551,14 +9050,15 @@ void VulkanExportJsonConsumer::Process_vkGetDrmDisplayEXT(
     uint32_t                                    connectorId,
     HandlePointerDecoder<VkDisplayKHR>*         display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDrmDisplayEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDrmDisplayEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["drmFd"], drmFd, json_options);
-        FieldToJson(args["connectorId"], connectorId, json_options);
-        HandleToJson(args["display"], display, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("drmFd"), drmFd, json_options);
+        FieldToJson(writer.Key("connectorId"), connectorId, json_options);
+        HandleToJson(writer.Key("display"), display, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8570,14 +9070,15 @@ void VulkanExportJsonConsumer::Process_vkCreatePrivateDataSlotEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPrivateDataSlot>*    pPrivateDataSlot)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreatePrivateDataSlotEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreatePrivateDataSlotEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPrivateDataSlot"], pPrivateDataSlot, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pPrivateDataSlot"), pPrivateDataSlot, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8587,12 +9088,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyPrivateDataSlotEXT(
     format::HandleId                            privateDataSlot,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyPrivateDataSlotEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyPrivateDataSlotEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("privateDataSlot"), privateDataSlot, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8605,15 +9107,16 @@ void VulkanExportJsonConsumer::Process_vkSetPrivateDataEXT(
     format::HandleId                            privateDataSlot,
     uint64_t                                    data)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetPrivateDataEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSetPrivateDataEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["objectType"], objectType, json_options);
-        HandleToJson(args["objectHandle"], objectHandle, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["data"], data, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("objectType"), objectType, json_options);
+        HandleToJson(writer.Key("objectHandle"), objectHandle, json_options);
+        HandleToJson(writer.Key("privateDataSlot"), privateDataSlot, json_options);
+        FieldToJson(writer.Key("data"), data, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8625,14 +9128,15 @@ void VulkanExportJsonConsumer::Process_vkGetPrivateDataEXT(
     format::HandleId                            privateDataSlot,
     PointerDecoder<uint64_t>*                   pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPrivateDataEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPrivateDataEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["objectType"], objectType, json_options);
-        HandleToJson(args["objectHandle"], objectHandle, json_options);
-        HandleToJson(args["privateDataSlot"], privateDataSlot, json_options);
-        FieldToJson(args["pData"], pData, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("objectType"), objectType, json_options);
+        HandleToJson(writer.Key("objectHandle"), objectHandle, json_options);
+        HandleToJson(writer.Key("privateDataSlot"), privateDataSlot, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8642,13 +9146,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetFragmentShadingRateEnumNV(
     VkFragmentShadingRateNV                     shadingRate,
     PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetFragmentShadingRateEnumNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetFragmentShadingRateEnumNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["shadingRate"], shadingRate, json_options);
-        FieldToJson(args["combinerOps"], combinerOps, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("shadingRate"), shadingRate, json_options);
+        FieldToJson(writer.Key("combinerOps"), combinerOps, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8659,13 +9164,14 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceFaultInfoEXT(
     StructPointerDecoder<Decoded_VkDeviceFaultCountsEXT>* pFaultCounts,
     StructPointerDecoder<Decoded_VkDeviceFaultInfoEXT>* pFaultInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceFaultInfoEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceFaultInfoEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pFaultCounts"], pFaultCounts, json_options);
-        FieldToJson(args["pFaultInfo"], pFaultInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pFaultCounts"), pFaultCounts, json_options);
+        FieldToJson(writer.Key("pFaultInfo"), pFaultInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8675,12 +9181,13 @@ void VulkanExportJsonConsumer::Process_vkAcquireWinrtDisplayNV(
     format::HandleId                            physicalDevice,
     format::HandleId                            display)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkAcquireWinrtDisplayNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkAcquireWinrtDisplayNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        HandleToJson(args["display"], display, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        HandleToJson(writer.Key("display"), display, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8691,13 +9198,14 @@ void VulkanExportJsonConsumer::Process_vkGetWinrtDisplayNV(
     uint32_t                                    deviceRelativeId,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetWinrtDisplayNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetWinrtDisplayNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["deviceRelativeId"], deviceRelativeId, json_options);
-        HandleToJson(args["pDisplay"], pDisplay, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("deviceRelativeId"), deviceRelativeId, json_options);
+        HandleToJson(writer.Key("pDisplay"), pDisplay, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8709,14 +9217,15 @@ void VulkanExportJsonConsumer::Process_vkCreateDirectFBSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateDirectFBSurfaceEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateDirectFBSurfaceEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8727,13 +9236,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceDirectFBPresentationSu
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    dfb)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["dfb"], dfb, json_options);
+            Bool32ToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("queueFamilyIndex"), queueFamilyIndex, json_options);
+        FieldToJson(writer.Key("dfb"), dfb, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8745,15 +9255,16 @@ void VulkanExportJsonConsumer::Process_vkCmdSetVertexInputEXT(
     uint32_t                                    vertexAttributeDescriptionCount,
     StructPointerDecoder<Decoded_VkVertexInputAttributeDescription2EXT>* pVertexAttributeDescriptions)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetVertexInputEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetVertexInputEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["vertexBindingDescriptionCount"], vertexBindingDescriptionCount, json_options);
-        FieldToJson(args["pVertexBindingDescriptions"], pVertexBindingDescriptions, json_options);
-        FieldToJson(args["vertexAttributeDescriptionCount"], vertexAttributeDescriptionCount, json_options);
-        FieldToJson(args["pVertexAttributeDescriptions"], pVertexAttributeDescriptions, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("vertexBindingDescriptionCount"), vertexBindingDescriptionCount, json_options);
+        FieldToJson(writer.Key("pVertexBindingDescriptions"), pVertexBindingDescriptions, json_options);
+        FieldToJson(writer.Key("vertexAttributeDescriptionCount"), vertexAttributeDescriptionCount, json_options);
+        FieldToJson(writer.Key("pVertexAttributeDescriptions"), pVertexAttributeDescriptions, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8764,13 +9275,14 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryZirconHandleFUCHSIA(
     StructPointerDecoder<Decoded_VkMemoryGetZirconHandleInfoFUCHSIA>* pGetZirconHandleInfo,
     PointerDecoder<uint32_t>*                   pZirconHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryZirconHandleFUCHSIA");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetMemoryZirconHandleFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetZirconHandleInfo"], pGetZirconHandleInfo, json_options);
-        FieldToJson(args["pZirconHandle"], pZirconHandle, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pGetZirconHandleInfo"), pGetZirconHandleInfo, json_options);
+        FieldToJson(writer.Key("pZirconHandle"), pZirconHandle, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8782,14 +9294,15 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryZirconHandlePropertiesFUCHSIA(
     uint32_t                                    zirconHandle,
     StructPointerDecoder<Decoded_VkMemoryZirconHandlePropertiesFUCHSIA>* pMemoryZirconHandleProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryZirconHandlePropertiesFUCHSIA");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetMemoryZirconHandlePropertiesFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["handleType"], handleType, json_options);
-        FieldToJson(args["zirconHandle"], zirconHandle, json_options);
-        FieldToJson(args["pMemoryZirconHandleProperties"], pMemoryZirconHandleProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("handleType"), handleType, json_options);
+        FieldToJson(writer.Key("zirconHandle"), zirconHandle, json_options);
+        FieldToJson(writer.Key("pMemoryZirconHandleProperties"), pMemoryZirconHandleProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8799,12 +9312,13 @@ void VulkanExportJsonConsumer::Process_vkImportSemaphoreZirconHandleFUCHSIA(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreZirconHandleInfoFUCHSIA>* pImportSemaphoreZirconHandleInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkImportSemaphoreZirconHandleFUCHSIA");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkImportSemaphoreZirconHandleFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pImportSemaphoreZirconHandleInfo"], pImportSemaphoreZirconHandleInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pImportSemaphoreZirconHandleInfo"), pImportSemaphoreZirconHandleInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8815,13 +9329,14 @@ void VulkanExportJsonConsumer::Process_vkGetSemaphoreZirconHandleFUCHSIA(
     StructPointerDecoder<Decoded_VkSemaphoreGetZirconHandleInfoFUCHSIA>* pGetZirconHandleInfo,
     PointerDecoder<uint32_t>*                   pZirconHandle)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetSemaphoreZirconHandleFUCHSIA");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetSemaphoreZirconHandleFUCHSIA");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pGetZirconHandleInfo"], pGetZirconHandleInfo, json_options);
-        FieldToJson(args["pZirconHandle"], pZirconHandle, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pGetZirconHandleInfo"), pGetZirconHandleInfo, json_options);
+        FieldToJson(writer.Key("pZirconHandle"), pZirconHandle, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8831,13 +9346,14 @@ void VulkanExportJsonConsumer::Process_vkCmdBindInvocationMaskHUAWEI(
     format::HandleId                            imageView,
     VkImageLayout                               imageLayout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindInvocationMaskHUAWEI");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindInvocationMaskHUAWEI");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["imageView"], imageView, json_options);
-        FieldToJson(args["imageLayout"], imageLayout, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("imageView"), imageView, json_options);
+        FieldToJson(writer.Key("imageLayout"), imageLayout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8848,13 +9364,14 @@ void VulkanExportJsonConsumer::Process_vkGetMemoryRemoteAddressNV(
     StructPointerDecoder<Decoded_VkMemoryGetRemoteAddressInfoNV>* pMemoryGetRemoteAddressInfo,
     PointerDecoder<uint64_t, void*>*            pAddress)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMemoryRemoteAddressNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetMemoryRemoteAddressNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pMemoryGetRemoteAddressInfo"], pMemoryGetRemoteAddressInfo, json_options);
-        FieldToJson(args["pAddress"], pAddress, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pMemoryGetRemoteAddressInfo"), pMemoryGetRemoteAddressInfo, json_options);
+        FieldToJson(writer.Key("pAddress"), pAddress, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8863,12 +9380,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPatchControlPointsEXT(
     format::HandleId                            commandBuffer,
     uint32_t                                    patchControlPoints)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPatchControlPointsEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetPatchControlPointsEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["patchControlPoints"], patchControlPoints, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("patchControlPoints"), patchControlPoints, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8877,12 +9395,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizerDiscardEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    rasterizerDiscardEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetRasterizerDiscardEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["rasterizerDiscardEnable"], rasterizerDiscardEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("rasterizerDiscardEnable"), rasterizerDiscardEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8891,12 +9410,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthBiasEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBiasEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthBiasEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthBiasEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthBiasEnable"], depthBiasEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("depthBiasEnable"), depthBiasEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8905,12 +9425,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLogicOpEXT(
     format::HandleId                            commandBuffer,
     VkLogicOp                                   logicOp)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLogicOpEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetLogicOpEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["logicOp"], logicOp, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("logicOp"), logicOp, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8919,12 +9440,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPrimitiveRestartEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    primitiveRestartEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetPrimitiveRestartEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["primitiveRestartEnable"], primitiveRestartEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("primitiveRestartEnable"), primitiveRestartEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8936,14 +9458,15 @@ void VulkanExportJsonConsumer::Process_vkCreateScreenSurfaceQNX(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateScreenSurfaceQNX");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateScreenSurfaceQNX");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["instance"], instance, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSurface"], pSurface, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("instance"), instance, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSurface"), pSurface, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8954,13 +9477,14 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceScreenPresentationSupp
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    window)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceScreenPresentationSupportQNX");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceScreenPresentationSupportQNX");
     const JsonOptions& json_options = GetJsonOptions();
-            Bool32ToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["queueFamilyIndex"], queueFamilyIndex, json_options);
-        FieldToJson(args["window"], window, json_options);
+            Bool32ToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("queueFamilyIndex"), queueFamilyIndex, json_options);
+        FieldToJson(writer.Key("window"), window, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8970,13 +9494,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorWriteEnableEXT(
     uint32_t                                    attachmentCount,
     PointerDecoder<VkBool32>*                   pColorWriteEnables)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorWriteEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetColorWriteEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        Bool32ToJson(args["pColorWriteEnables"], pColorWriteEnables, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("attachmentCount"), attachmentCount, json_options);
+        Bool32ToJson(writer.Key("pColorWriteEnables"), pColorWriteEnables, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -8989,16 +9514,17 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMultiEXT(
     uint32_t                                    firstInstance,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMultiEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawMultiEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["pVertexInfo"], pVertexInfo, json_options);
-        FieldToJson(args["instanceCount"], instanceCount, json_options);
-        FieldToJson(args["firstInstance"], firstInstance, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("drawCount"), drawCount, json_options);
+        FieldToJson(writer.Key("pVertexInfo"), pVertexInfo, json_options);
+        FieldToJson(writer.Key("instanceCount"), instanceCount, json_options);
+        FieldToJson(writer.Key("firstInstance"), firstInstance, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9012,17 +9538,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMultiIndexedEXT(
     uint32_t                                    stride,
     PointerDecoder<int32_t>*                    pVertexOffset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMultiIndexedEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawMultiIndexedEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["pIndexInfo"], pIndexInfo, json_options);
-        FieldToJson(args["instanceCount"], instanceCount, json_options);
-        FieldToJson(args["firstInstance"], firstInstance, json_options);
-        FieldToJson(args["stride"], stride, json_options);
-        FieldToJson(args["pVertexOffset"], pVertexOffset, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("drawCount"), drawCount, json_options);
+        FieldToJson(writer.Key("pIndexInfo"), pIndexInfo, json_options);
+        FieldToJson(writer.Key("instanceCount"), instanceCount, json_options);
+        FieldToJson(writer.Key("firstInstance"), firstInstance, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+        FieldToJson(writer.Key("pVertexOffset"), pVertexOffset, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9034,14 +9561,15 @@ void VulkanExportJsonConsumer::Process_vkCreateMicromapEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkMicromapEXT>*        pMicromap)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateMicromapEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pMicromap"], pMicromap, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pMicromap"), pMicromap, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9051,12 +9579,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyMicromapEXT(
     format::HandleId                            micromap,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyMicromapEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["micromap"], micromap, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("micromap"), micromap, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9066,13 +9595,14 @@ void VulkanExportJsonConsumer::Process_vkCmdBuildMicromapsEXT(
     uint32_t                                    infoCount,
     StructPointerDecoder<Decoded_VkMicromapBuildInfoEXT>* pInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBuildMicromapsEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBuildMicromapsEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["infoCount"], infoCount, json_options);
-        FieldToJson(args["pInfos"], pInfos, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("infoCount"), infoCount, json_options);
+        FieldToJson(writer.Key("pInfos"), pInfos, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9084,14 +9614,15 @@ void VulkanExportJsonConsumer::Process_vkBuildMicromapsEXT(
     uint32_t                                    infoCount,
     StructPointerDecoder<Decoded_VkMicromapBuildInfoEXT>* pInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBuildMicromapsEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkBuildMicromapsEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["infoCount"], infoCount, json_options);
-        FieldToJson(args["pInfos"], pInfos, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("deferredOperation"), deferredOperation, json_options);
+        FieldToJson(writer.Key("infoCount"), infoCount, json_options);
+        FieldToJson(writer.Key("pInfos"), pInfos, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9102,13 +9633,14 @@ void VulkanExportJsonConsumer::Process_vkCopyMicromapEXT(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMicromapEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCopyMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("deferredOperation"), deferredOperation, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9119,13 +9651,14 @@ void VulkanExportJsonConsumer::Process_vkCopyMicromapToMemoryEXT(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMicromapToMemoryInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMicromapToMemoryEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCopyMicromapToMemoryEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("deferredOperation"), deferredOperation, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9136,13 +9669,14 @@ void VulkanExportJsonConsumer::Process_vkCopyMemoryToMicromapEXT(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMemoryToMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToMicromapEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCopyMemoryToMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("deferredOperation"), deferredOperation, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9157,17 +9691,18 @@ void VulkanExportJsonConsumer::Process_vkWriteMicromapsPropertiesEXT(
     PointerDecoder<uint8_t>*                    pData,
     size_t                                      stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWriteMicromapsPropertiesEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkWriteMicromapsPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["micromapCount"], micromapCount, json_options);
-        HandleToJson(args["pMicromaps"], pMicromaps, json_options);
-        FieldToJson(args["queryType"], queryType, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("micromapCount"), micromapCount, json_options);
+        HandleToJson(writer.Key("pMicromaps"), pMicromaps, json_options);
+        FieldToJson(writer.Key("queryType"), queryType, json_options);
+        FieldToJson(writer.Key("dataSize"), dataSize, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9176,12 +9711,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMicromapEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMicromapEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9190,12 +9726,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMicromapToMemoryEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMicromapToMemoryInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMicromapToMemoryEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyMicromapToMemoryEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9204,12 +9741,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMemoryToMicromapEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMemoryToMicromapInfoEXT>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMemoryToMicromapEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyMemoryToMicromapEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9222,16 +9760,17 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteMicromapsPropertiesEXT(
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteMicromapsPropertiesEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdWriteMicromapsPropertiesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["micromapCount"], micromapCount, json_options);
-        HandleToJson(args["pMicromaps"], pMicromaps, json_options);
-        FieldToJson(args["queryType"], queryType, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("micromapCount"), micromapCount, json_options);
+        HandleToJson(writer.Key("pMicromaps"), pMicromaps, json_options);
+        FieldToJson(writer.Key("queryType"), queryType, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("firstQuery"), firstQuery, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9241,12 +9780,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceMicromapCompatibilityEXT(
     StructPointerDecoder<Decoded_VkMicromapVersionInfoEXT>* pVersionInfo,
     PointerDecoder<VkAccelerationStructureCompatibilityKHR>* pCompatibility)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceMicromapCompatibilityEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceMicromapCompatibilityEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pVersionInfo"], pVersionInfo, json_options);
-        FieldToJson(args["pCompatibility"], pCompatibility, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pVersionInfo"), pVersionInfo, json_options);
+        FieldToJson(writer.Key("pCompatibility"), pCompatibility, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9257,13 +9797,14 @@ void VulkanExportJsonConsumer::Process_vkGetMicromapBuildSizesEXT(
     StructPointerDecoder<Decoded_VkMicromapBuildInfoEXT>* pBuildInfo,
     StructPointerDecoder<Decoded_VkMicromapBuildSizesInfoEXT>* pSizeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetMicromapBuildSizesEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetMicromapBuildSizesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["buildType"], buildType, json_options);
-        FieldToJson(args["pBuildInfo"], pBuildInfo, json_options);
-        FieldToJson(args["pSizeInfo"], pSizeInfo, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("buildType"), buildType, json_options);
+        FieldToJson(writer.Key("pBuildInfo"), pBuildInfo, json_options);
+        FieldToJson(writer.Key("pSizeInfo"), pSizeInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9274,14 +9815,15 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawClusterHUAWEI(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawClusterHUAWEI");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawClusterHUAWEI");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["groupCountX"], groupCountX, json_options);
-        FieldToJson(args["groupCountY"], groupCountY, json_options);
-        FieldToJson(args["groupCountZ"], groupCountZ, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("groupCountX"), groupCountX, json_options);
+        FieldToJson(writer.Key("groupCountY"), groupCountY, json_options);
+        FieldToJson(writer.Key("groupCountZ"), groupCountZ, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9291,13 +9833,14 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawClusterIndirectHUAWEI(
     format::HandleId                            buffer,
     VkDeviceSize                                offset)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawClusterIndirectHUAWEI");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawClusterIndirectHUAWEI");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9307,12 +9850,13 @@ void VulkanExportJsonConsumer::Process_vkSetDeviceMemoryPriorityEXT(
     format::HandleId                            memory,
     float                                       priority)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetDeviceMemoryPriorityEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSetDeviceMemoryPriorityEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["memory"], memory, json_options);
-        FieldToJson(args["priority"], priority, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("memory"), memory, json_options);
+        FieldToJson(writer.Key("priority"), priority, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9322,12 +9866,13 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetLayoutHostMappingInfoVA
     StructPointerDecoder<Decoded_VkDescriptorSetBindingReferenceVALVE>* pBindingReference,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutHostMappingInfoVALVE>* pHostMapping)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutHostMappingInfoVALVE");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDescriptorSetLayoutHostMappingInfoVALVE");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pBindingReference"], pBindingReference, json_options);
-        FieldToJson(args["pHostMapping"], pHostMapping, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pBindingReference"), pBindingReference, json_options);
+        FieldToJson(writer.Key("pHostMapping"), pHostMapping, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9337,12 +9882,13 @@ void VulkanExportJsonConsumer::Process_vkGetDescriptorSetHostMappingVALVE(
     format::HandleId                            descriptorSet,
     PointerDecoder<uint64_t, void*>*            ppData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDescriptorSetHostMappingVALVE");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDescriptorSetHostMappingVALVE");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["descriptorSet"], descriptorSet, json_options);
-        FieldToJsonAsHex(args["ppData"], ppData, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("descriptorSet"), descriptorSet, json_options);
+        FieldToJsonAsHex(writer.Key("ppData"), ppData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9352,12 +9898,13 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineIndirectMemoryRequirementsNV
     StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineIndirectMemoryRequirementsNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPipelineIndirectMemoryRequirementsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pMemoryRequirements"], pMemoryRequirements, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pMemoryRequirements"), pMemoryRequirements, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9367,13 +9914,14 @@ void VulkanExportJsonConsumer::Process_vkCmdUpdatePipelineIndirectBufferNV(
     VkPipelineBindPoint                         pipelineBindPoint,
     format::HandleId                            pipeline)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdUpdatePipelineIndirectBufferNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdUpdatePipelineIndirectBufferNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineBindPoint"], pipelineBindPoint, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pipelineBindPoint"), pipelineBindPoint, json_options);
+        HandleToJson(writer.Key("pipeline"), pipeline, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9383,12 +9931,13 @@ void VulkanExportJsonConsumer::Process_vkGetPipelineIndirectDeviceAddressNV(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkPipelineIndirectDeviceAddressInfoNV>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPipelineIndirectDeviceAddressNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPipelineIndirectDeviceAddressNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJsonAsHex(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9397,12 +9946,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthClampEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthClampEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClampEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthClampEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthClampEnable"], depthClampEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("depthClampEnable"), depthClampEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9411,12 +9961,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetPolygonModeEXT(
     format::HandleId                            commandBuffer,
     VkPolygonMode                               polygonMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetPolygonModeEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetPolygonModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["polygonMode"], polygonMode, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("polygonMode"), polygonMode, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9425,12 +9976,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizationSamplesEXT(
     format::HandleId                            commandBuffer,
     VkSampleCountFlagBits                       rasterizationSamples)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizationSamplesEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetRasterizationSamplesEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["rasterizationSamples"], rasterizationSamples, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("rasterizationSamples"), rasterizationSamples, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9440,13 +9992,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetSampleMaskEXT(
     VkSampleCountFlagBits                       samples,
     PointerDecoder<VkSampleMask>*               pSampleMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleMaskEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetSampleMaskEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["samples"], samples, json_options);
-        FieldToJson(args["pSampleMask"], pSampleMask, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("samples"), samples, json_options);
+        FieldToJson(writer.Key("pSampleMask"), pSampleMask, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9455,12 +10008,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetAlphaToCoverageEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    alphaToCoverageEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetAlphaToCoverageEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetAlphaToCoverageEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["alphaToCoverageEnable"], alphaToCoverageEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("alphaToCoverageEnable"), alphaToCoverageEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9469,12 +10023,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetAlphaToOneEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    alphaToOneEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetAlphaToOneEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetAlphaToOneEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["alphaToOneEnable"], alphaToOneEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("alphaToOneEnable"), alphaToOneEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9483,12 +10038,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLogicOpEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    logicOpEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLogicOpEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetLogicOpEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["logicOpEnable"], logicOpEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("logicOpEnable"), logicOpEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9499,14 +10055,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendEnableEXT(
     uint32_t                                    attachmentCount,
     PointerDecoder<VkBool32>*                   pColorBlendEnables)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetColorBlendEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstAttachment"], firstAttachment, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        Bool32ToJson(args["pColorBlendEnables"], pColorBlendEnables, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstAttachment"), firstAttachment, json_options);
+        FieldToJson(writer.Key("attachmentCount"), attachmentCount, json_options);
+        Bool32ToJson(writer.Key("pColorBlendEnables"), pColorBlendEnables, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9517,14 +10074,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendEquationEXT(
     uint32_t                                    attachmentCount,
     StructPointerDecoder<Decoded_VkColorBlendEquationEXT>* pColorBlendEquations)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendEquationEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetColorBlendEquationEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstAttachment"], firstAttachment, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        FieldToJson(args["pColorBlendEquations"], pColorBlendEquations, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstAttachment"), firstAttachment, json_options);
+        FieldToJson(writer.Key("attachmentCount"), attachmentCount, json_options);
+        FieldToJson(writer.Key("pColorBlendEquations"), pColorBlendEquations, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9535,14 +10093,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorWriteMaskEXT(
     uint32_t                                    attachmentCount,
     PointerDecoder<VkColorComponentFlags>*      pColorWriteMasks)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorWriteMaskEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetColorWriteMaskEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstAttachment"], firstAttachment, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        FieldToJson(args["pColorWriteMasks"], pColorWriteMasks, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstAttachment"), firstAttachment, json_options);
+        FieldToJson(writer.Key("attachmentCount"), attachmentCount, json_options);
+        FieldToJson(writer.Key("pColorWriteMasks"), pColorWriteMasks, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9551,12 +10110,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetTessellationDomainOriginEXT(
     format::HandleId                            commandBuffer,
     VkTessellationDomainOrigin                  domainOrigin)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetTessellationDomainOriginEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetTessellationDomainOriginEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["domainOrigin"], domainOrigin, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("domainOrigin"), domainOrigin, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9565,12 +10125,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRasterizationStreamEXT(
     format::HandleId                            commandBuffer,
     uint32_t                                    rasterizationStream)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRasterizationStreamEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetRasterizationStreamEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["rasterizationStream"], rasterizationStream, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("rasterizationStream"), rasterizationStream, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9579,12 +10140,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetConservativeRasterizationModeEXT(
     format::HandleId                            commandBuffer,
     VkConservativeRasterizationModeEXT          conservativeRasterizationMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetConservativeRasterizationModeEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetConservativeRasterizationModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["conservativeRasterizationMode"], conservativeRasterizationMode, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("conservativeRasterizationMode"), conservativeRasterizationMode, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9593,12 +10155,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetExtraPrimitiveOverestimationSizeE
     format::HandleId                            commandBuffer,
     float                                       extraPrimitiveOverestimationSize)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetExtraPrimitiveOverestimationSizeEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetExtraPrimitiveOverestimationSizeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["extraPrimitiveOverestimationSize"], extraPrimitiveOverestimationSize, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("extraPrimitiveOverestimationSize"), extraPrimitiveOverestimationSize, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9607,12 +10170,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthClipEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthClipEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClipEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthClipEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["depthClipEnable"], depthClipEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("depthClipEnable"), depthClipEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9621,12 +10185,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetSampleLocationsEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    sampleLocationsEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetSampleLocationsEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetSampleLocationsEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["sampleLocationsEnable"], sampleLocationsEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("sampleLocationsEnable"), sampleLocationsEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9637,14 +10202,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetColorBlendAdvancedEXT(
     uint32_t                                    attachmentCount,
     StructPointerDecoder<Decoded_VkColorBlendAdvancedEXT>* pColorBlendAdvanced)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetColorBlendAdvancedEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetColorBlendAdvancedEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstAttachment"], firstAttachment, json_options);
-        FieldToJson(args["attachmentCount"], attachmentCount, json_options);
-        FieldToJson(args["pColorBlendAdvanced"], pColorBlendAdvanced, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstAttachment"), firstAttachment, json_options);
+        FieldToJson(writer.Key("attachmentCount"), attachmentCount, json_options);
+        FieldToJson(writer.Key("pColorBlendAdvanced"), pColorBlendAdvanced, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9653,12 +10219,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetProvokingVertexModeEXT(
     format::HandleId                            commandBuffer,
     VkProvokingVertexModeEXT                    provokingVertexMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetProvokingVertexModeEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetProvokingVertexModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["provokingVertexMode"], provokingVertexMode, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("provokingVertexMode"), provokingVertexMode, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9667,12 +10234,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineRasterizationModeEXT(
     format::HandleId                            commandBuffer,
     VkLineRasterizationModeEXT                  lineRasterizationMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineRasterizationModeEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetLineRasterizationModeEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["lineRasterizationMode"], lineRasterizationMode, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("lineRasterizationMode"), lineRasterizationMode, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9681,12 +10249,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetLineStippleEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    stippledLineEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetLineStippleEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetLineStippleEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["stippledLineEnable"], stippledLineEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("stippledLineEnable"), stippledLineEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9695,12 +10264,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetDepthClipNegativeOneToOneEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    negativeOneToOne)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetDepthClipNegativeOneToOneEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetDepthClipNegativeOneToOneEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["negativeOneToOne"], negativeOneToOne, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("negativeOneToOne"), negativeOneToOne, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9709,12 +10279,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportWScalingEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    viewportWScalingEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportWScalingEnableNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetViewportWScalingEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["viewportWScalingEnable"], viewportWScalingEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("viewportWScalingEnable"), viewportWScalingEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9725,14 +10296,15 @@ void VulkanExportJsonConsumer::Process_vkCmdSetViewportSwizzleNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewportSwizzleNV>* pViewportSwizzles)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetViewportSwizzleNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetViewportSwizzleNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["firstViewport"], firstViewport, json_options);
-        FieldToJson(args["viewportCount"], viewportCount, json_options);
-        FieldToJson(args["pViewportSwizzles"], pViewportSwizzles, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("firstViewport"), firstViewport, json_options);
+        FieldToJson(writer.Key("viewportCount"), viewportCount, json_options);
+        FieldToJson(writer.Key("pViewportSwizzles"), pViewportSwizzles, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9741,12 +10313,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageToColorEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    coverageToColorEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageToColorEnableNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetCoverageToColorEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["coverageToColorEnable"], coverageToColorEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("coverageToColorEnable"), coverageToColorEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9755,12 +10328,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageToColorLocationNV(
     format::HandleId                            commandBuffer,
     uint32_t                                    coverageToColorLocation)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageToColorLocationNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetCoverageToColorLocationNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["coverageToColorLocation"], coverageToColorLocation, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("coverageToColorLocation"), coverageToColorLocation, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9769,12 +10343,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationModeNV(
     format::HandleId                            commandBuffer,
     VkCoverageModulationModeNV                  coverageModulationMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationModeNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationModeNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["coverageModulationMode"], coverageModulationMode, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("coverageModulationMode"), coverageModulationMode, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9783,12 +10358,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationTableEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    coverageModulationTableEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationTableEnableNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationTableEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["coverageModulationTableEnable"], coverageModulationTableEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("coverageModulationTableEnable"), coverageModulationTableEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9798,13 +10374,14 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageModulationTableNV(
     uint32_t                                    coverageModulationTableCount,
     PointerDecoder<float>*                      pCoverageModulationTable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationTableNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetCoverageModulationTableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["coverageModulationTableCount"], coverageModulationTableCount, json_options);
-        FieldToJson(args["pCoverageModulationTable"], pCoverageModulationTable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("coverageModulationTableCount"), coverageModulationTableCount, json_options);
+        FieldToJson(writer.Key("pCoverageModulationTable"), pCoverageModulationTable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9813,12 +10390,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetShadingRateImageEnableNV(
     format::HandleId                            commandBuffer,
     VkBool32                                    shadingRateImageEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetShadingRateImageEnableNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetShadingRateImageEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["shadingRateImageEnable"], shadingRateImageEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("shadingRateImageEnable"), shadingRateImageEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9827,12 +10405,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRepresentativeFragmentTestEnableN
     format::HandleId                            commandBuffer,
     VkBool32                                    representativeFragmentTestEnable)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRepresentativeFragmentTestEnableNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetRepresentativeFragmentTestEnableNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        Bool32ToJson(args["representativeFragmentTestEnable"], representativeFragmentTestEnable, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        Bool32ToJson(writer.Key("representativeFragmentTestEnable"), representativeFragmentTestEnable, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9841,12 +10420,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetCoverageReductionModeNV(
     format::HandleId                            commandBuffer,
     VkCoverageReductionModeNV                   coverageReductionMode)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetCoverageReductionModeNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetCoverageReductionModeNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["coverageReductionMode"], coverageReductionMode, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("coverageReductionMode"), coverageReductionMode, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9856,12 +10436,13 @@ void VulkanExportJsonConsumer::Process_vkGetShaderModuleIdentifierEXT(
     format::HandleId                            shaderModule,
     StructPointerDecoder<Decoded_VkShaderModuleIdentifierEXT>* pIdentifier)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderModuleIdentifierEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetShaderModuleIdentifierEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["shaderModule"], shaderModule, json_options);
-        FieldToJson(args["pIdentifier"], pIdentifier, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("shaderModule"), shaderModule, json_options);
+        FieldToJson(writer.Key("pIdentifier"), pIdentifier, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9871,12 +10452,13 @@ void VulkanExportJsonConsumer::Process_vkGetShaderModuleCreateInfoIdentifierEXT(
     StructPointerDecoder<Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkShaderModuleIdentifierEXT>* pIdentifier)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderModuleCreateInfoIdentifierEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetShaderModuleCreateInfoIdentifierEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pIdentifier"], pIdentifier, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pIdentifier"), pIdentifier, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9888,14 +10470,15 @@ void VulkanExportJsonConsumer::Process_vkGetPhysicalDeviceOpticalFlowImageFormat
     PointerDecoder<uint32_t>*                   pFormatCount,
     StructPointerDecoder<Decoded_VkOpticalFlowImageFormatPropertiesNV>* pImageFormatProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetPhysicalDeviceOpticalFlowImageFormatsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["physicalDevice"], physicalDevice, json_options);
-        FieldToJson(args["pOpticalFlowImageFormatInfo"], pOpticalFlowImageFormatInfo, json_options);
-        FieldToJson(args["pFormatCount"], pFormatCount, json_options);
-        FieldToJson(args["pImageFormatProperties"], pImageFormatProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("physicalDevice"), physicalDevice, json_options);
+        FieldToJson(writer.Key("pOpticalFlowImageFormatInfo"), pOpticalFlowImageFormatInfo, json_options);
+        FieldToJson(writer.Key("pFormatCount"), pFormatCount, json_options);
+        FieldToJson(writer.Key("pImageFormatProperties"), pImageFormatProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9907,14 +10490,15 @@ void VulkanExportJsonConsumer::Process_vkCreateOpticalFlowSessionNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkOpticalFlowSessionNV>* pSession)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateOpticalFlowSessionNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateOpticalFlowSessionNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pSession"], pSession, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pSession"), pSession, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9924,12 +10508,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyOpticalFlowSessionNV(
     format::HandleId                            session,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyOpticalFlowSessionNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyOpticalFlowSessionNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["session"], session, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("session"), session, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9942,15 +10527,16 @@ void VulkanExportJsonConsumer::Process_vkBindOpticalFlowSessionImageNV(
     format::HandleId                            view,
     VkImageLayout                               layout)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkBindOpticalFlowSessionImageNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkBindOpticalFlowSessionImageNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["session"], session, json_options);
-        FieldToJson(args["bindingPoint"], bindingPoint, json_options);
-        HandleToJson(args["view"], view, json_options);
-        FieldToJson(args["layout"], layout, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("session"), session, json_options);
+        FieldToJson(writer.Key("bindingPoint"), bindingPoint, json_options);
+        HandleToJson(writer.Key("view"), view, json_options);
+        FieldToJson(writer.Key("layout"), layout, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9960,13 +10546,14 @@ void VulkanExportJsonConsumer::Process_vkCmdOpticalFlowExecuteNV(
     format::HandleId                            session,
     StructPointerDecoder<Decoded_VkOpticalFlowExecuteInfoNV>* pExecuteInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdOpticalFlowExecuteNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdOpticalFlowExecuteNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["session"], session, json_options);
-        FieldToJson(args["pExecuteInfo"], pExecuteInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("session"), session, json_options);
+        FieldToJson(writer.Key("pExecuteInfo"), pExecuteInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9979,15 +10566,16 @@ void VulkanExportJsonConsumer::Process_vkCreateShadersEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkShaderEXT>*          pShaders)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateShadersEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateShadersEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["createInfoCount"], createInfoCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pShaders"], pShaders, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("createInfoCount"), createInfoCount, json_options);
+        FieldToJson(writer.Key("pCreateInfos"), pCreateInfos, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pShaders"), pShaders, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -9997,12 +10585,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyShaderEXT(
     format::HandleId                            shader,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyShaderEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyShaderEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["shader"], shader, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("shader"), shader, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10014,14 +10603,15 @@ void VulkanExportJsonConsumer::Process_vkGetShaderBinaryDataEXT(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetShaderBinaryDataEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetShaderBinaryDataEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["shader"], shader, json_options);
-        FieldToJson(args["pDataSize"], pDataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("shader"), shader, json_options);
+        FieldToJson(writer.Key("pDataSize"), pDataSize, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10032,14 +10622,15 @@ void VulkanExportJsonConsumer::Process_vkCmdBindShadersEXT(
     PointerDecoder<VkShaderStageFlagBits>*      pStages,
     HandlePointerDecoder<VkShaderEXT>*          pShaders)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBindShadersEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBindShadersEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["stageCount"], stageCount, json_options);
-        FieldToJson(args["pStages"], pStages, json_options);
-        HandleToJson(args["pShaders"], pShaders, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("stageCount"), stageCount, json_options);
+        FieldToJson(writer.Key("pStages"), pStages, json_options);
+        HandleToJson(writer.Key("pShaders"), pShaders, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10051,14 +10642,15 @@ void VulkanExportJsonConsumer::Process_vkGetFramebufferTilePropertiesQCOM(
     PointerDecoder<uint32_t>*                   pPropertiesCount,
     StructPointerDecoder<Decoded_VkTilePropertiesQCOM>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetFramebufferTilePropertiesQCOM");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetFramebufferTilePropertiesQCOM");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["framebuffer"], framebuffer, json_options);
-        FieldToJson(args["pPropertiesCount"], pPropertiesCount, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("framebuffer"), framebuffer, json_options);
+        FieldToJson(writer.Key("pPropertiesCount"), pPropertiesCount, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10069,13 +10661,14 @@ void VulkanExportJsonConsumer::Process_vkGetDynamicRenderingTilePropertiesQCOM(
     StructPointerDecoder<Decoded_VkRenderingInfo>* pRenderingInfo,
     StructPointerDecoder<Decoded_VkTilePropertiesQCOM>* pProperties)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDynamicRenderingTilePropertiesQCOM");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDynamicRenderingTilePropertiesQCOM");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pRenderingInfo"], pRenderingInfo, json_options);
-        FieldToJson(args["pProperties"], pProperties, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pRenderingInfo"), pRenderingInfo, json_options);
+        FieldToJson(writer.Key("pProperties"), pProperties, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10086,13 +10679,14 @@ void VulkanExportJsonConsumer::Process_vkSetLatencySleepModeNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkLatencySleepModeInfoNV>* pSleepModeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetLatencySleepModeNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSetLatencySleepModeNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pSleepModeInfo"], pSleepModeInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+        FieldToJson(writer.Key("pSleepModeInfo"), pSleepModeInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10103,13 +10697,14 @@ void VulkanExportJsonConsumer::Process_vkLatencySleepNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkLatencySleepInfoNV>* pSleepInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkLatencySleepNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkLatencySleepNV");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pSleepInfo"], pSleepInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+        FieldToJson(writer.Key("pSleepInfo"), pSleepInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10119,12 +10714,13 @@ void VulkanExportJsonConsumer::Process_vkSetLatencyMarkerNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkSetLatencyMarkerInfoNV>* pLatencyMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkSetLatencyMarkerNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkSetLatencyMarkerNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pLatencyMarkerInfo"], pLatencyMarkerInfo, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+        FieldToJson(writer.Key("pLatencyMarkerInfo"), pLatencyMarkerInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10134,12 +10730,13 @@ void VulkanExportJsonConsumer::Process_vkGetLatencyTimingsNV(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkGetLatencyMarkerInfoNV>* pLatencyMarkerInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetLatencyTimingsNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetLatencyTimingsNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["swapchain"], swapchain, json_options);
-        FieldToJson(args["pLatencyMarkerInfo"], pLatencyMarkerInfo, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("swapchain"), swapchain, json_options);
+        FieldToJson(writer.Key("pLatencyMarkerInfo"), pLatencyMarkerInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10148,11 +10745,12 @@ void VulkanExportJsonConsumer::Process_vkQueueNotifyOutOfBandNV(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkOutOfBandQueueTypeInfoNV>* pQueueTypeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkQueueNotifyOutOfBandNV");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkQueueNotifyOutOfBandNV");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["queue"], queue, json_options);
-        FieldToJson(args["pQueueTypeInfo"], pQueueTypeInfo, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("queue"), queue, json_options);
+        FieldToJson(writer.Key("pQueueTypeInfo"), pQueueTypeInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10161,12 +10759,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetAttachmentFeedbackLoopEnableEXT(
     format::HandleId                            commandBuffer,
     VkImageAspectFlags                          aspectMask)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetAttachmentFeedbackLoopEnableEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetAttachmentFeedbackLoopEnableEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(VkImageAspectFlags_t(), args["aspectMask"], aspectMask, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(VkImageAspectFlags_t(), writer.Key("aspectMask"), aspectMask, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10178,14 +10777,15 @@ void VulkanExportJsonConsumer::Process_vkCreateAccelerationStructureKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkAccelerationStructureKHR>* pAccelerationStructure)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateAccelerationStructureKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pCreateInfo"], pCreateInfo, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pAccelerationStructure"], pAccelerationStructure, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pCreateInfo"), pCreateInfo, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pAccelerationStructure"), pAccelerationStructure, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10195,12 +10795,13 @@ void VulkanExportJsonConsumer::Process_vkDestroyAccelerationStructureKHR(
     format::HandleId                            accelerationStructure,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkDestroyAccelerationStructureKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkDestroyAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["accelerationStructure"], accelerationStructure, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("accelerationStructure"), accelerationStructure, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10211,14 +10812,15 @@ void VulkanExportJsonConsumer::Process_vkCmdBuildAccelerationStructuresKHR(
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildGeometryInfoKHR>* pInfos,
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildRangeInfoKHR*>* ppBuildRangeInfos)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdBuildAccelerationStructuresKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdBuildAccelerationStructuresKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["infoCount"], infoCount, json_options);
-        FieldToJson(args["pInfos"], pInfos, json_options);
-        FieldToJson(args["ppBuildRangeInfos"], ppBuildRangeInfos, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("infoCount"), infoCount, json_options);
+        FieldToJson(writer.Key("pInfos"), pInfos, json_options);
+        FieldToJson(writer.Key("ppBuildRangeInfos"), ppBuildRangeInfos, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10229,13 +10831,14 @@ void VulkanExportJsonConsumer::Process_vkCopyAccelerationStructureToMemoryKHR(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyAccelerationStructureToMemoryKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCopyAccelerationStructureToMemoryKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("deferredOperation"), deferredOperation, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10246,13 +10849,14 @@ void VulkanExportJsonConsumer::Process_vkCopyMemoryToAccelerationStructureKHR(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCopyMemoryToAccelerationStructureKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCopyMemoryToAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("deferredOperation"), deferredOperation, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10267,17 +10871,18 @@ void VulkanExportJsonConsumer::Process_vkWriteAccelerationStructuresPropertiesKH
     PointerDecoder<uint8_t>*                    pData,
     size_t                                      stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkWriteAccelerationStructuresPropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkWriteAccelerationStructuresPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["accelerationStructureCount"], accelerationStructureCount, json_options);
-        HandleToJson(args["pAccelerationStructures"], pAccelerationStructures, json_options);
-        FieldToJson(args["queryType"], queryType, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("accelerationStructureCount"), accelerationStructureCount, json_options);
+        HandleToJson(writer.Key("pAccelerationStructures"), pAccelerationStructures, json_options);
+        FieldToJson(writer.Key("queryType"), queryType, json_options);
+        FieldToJson(writer.Key("dataSize"), dataSize, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10286,12 +10891,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10300,12 +10906,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyAccelerationStructureToMemoryKHR
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureToMemoryKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyAccelerationStructureToMemoryKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10314,12 +10921,13 @@ void VulkanExportJsonConsumer::Process_vkCmdCopyMemoryToAccelerationStructureKHR
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdCopyMemoryToAccelerationStructureKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdCopyMemoryToAccelerationStructureKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10329,12 +10937,13 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureDeviceAddressKH
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAccelerationStructureDeviceAddressInfoKHR>* pInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureDeviceAddressKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetAccelerationStructureDeviceAddressKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJsonAsHex(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pInfo"], pInfo, json_options);
+    FieldToJsonAsHex(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pInfo"), pInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10347,16 +10956,17 @@ void VulkanExportJsonConsumer::Process_vkCmdWriteAccelerationStructuresPropertie
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdWriteAccelerationStructuresPropertiesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["accelerationStructureCount"], accelerationStructureCount, json_options);
-        HandleToJson(args["pAccelerationStructures"], pAccelerationStructures, json_options);
-        FieldToJson(args["queryType"], queryType, json_options);
-        HandleToJson(args["queryPool"], queryPool, json_options);
-        FieldToJson(args["firstQuery"], firstQuery, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("accelerationStructureCount"), accelerationStructureCount, json_options);
+        HandleToJson(writer.Key("pAccelerationStructures"), pAccelerationStructures, json_options);
+        FieldToJson(writer.Key("queryType"), queryType, json_options);
+        HandleToJson(writer.Key("queryPool"), queryPool, json_options);
+        FieldToJson(writer.Key("firstQuery"), firstQuery, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10366,12 +10976,13 @@ void VulkanExportJsonConsumer::Process_vkGetDeviceAccelerationStructureCompatibi
     StructPointerDecoder<Decoded_VkAccelerationStructureVersionInfoKHR>* pVersionInfo,
     PointerDecoder<VkAccelerationStructureCompatibilityKHR>* pCompatibility)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetDeviceAccelerationStructureCompatibilityKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetDeviceAccelerationStructureCompatibilityKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["pVersionInfo"], pVersionInfo, json_options);
-        FieldToJson(args["pCompatibility"], pCompatibility, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("pVersionInfo"), pVersionInfo, json_options);
+        FieldToJson(writer.Key("pCompatibility"), pCompatibility, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10383,14 +10994,15 @@ void VulkanExportJsonConsumer::Process_vkGetAccelerationStructureBuildSizesKHR(
     PointerDecoder<uint32_t>*                   pMaxPrimitiveCounts,
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildSizesInfoKHR>* pSizeInfo)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetAccelerationStructureBuildSizesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetAccelerationStructureBuildSizesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        FieldToJson(args["buildType"], buildType, json_options);
-        FieldToJson(args["pBuildInfo"], pBuildInfo, json_options);
-        FieldToJson(args["pMaxPrimitiveCounts"], pMaxPrimitiveCounts, json_options);
-        FieldToJson(args["pSizeInfo"], pSizeInfo, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        FieldToJson(writer.Key("buildType"), buildType, json_options);
+        FieldToJson(writer.Key("pBuildInfo"), pBuildInfo, json_options);
+        FieldToJson(writer.Key("pMaxPrimitiveCounts"), pMaxPrimitiveCounts, json_options);
+        FieldToJson(writer.Key("pSizeInfo"), pSizeInfo, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10405,18 +11017,19 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysKHR(
     uint32_t                                    height,
     uint32_t                                    depth)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdTraceRaysKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRaygenShaderBindingTable"], pRaygenShaderBindingTable, json_options);
-        FieldToJson(args["pMissShaderBindingTable"], pMissShaderBindingTable, json_options);
-        FieldToJson(args["pHitShaderBindingTable"], pHitShaderBindingTable, json_options);
-        FieldToJson(args["pCallableShaderBindingTable"], pCallableShaderBindingTable, json_options);
-        FieldToJson(args["width"], width, json_options);
-        FieldToJson(args["height"], height, json_options);
-        FieldToJson(args["depth"], depth, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pRaygenShaderBindingTable"), pRaygenShaderBindingTable, json_options);
+        FieldToJson(writer.Key("pMissShaderBindingTable"), pMissShaderBindingTable, json_options);
+        FieldToJson(writer.Key("pHitShaderBindingTable"), pHitShaderBindingTable, json_options);
+        FieldToJson(writer.Key("pCallableShaderBindingTable"), pCallableShaderBindingTable, json_options);
+        FieldToJson(writer.Key("width"), width, json_options);
+        FieldToJson(writer.Key("height"), height, json_options);
+        FieldToJson(writer.Key("depth"), depth, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10431,17 +11044,18 @@ void VulkanExportJsonConsumer::Process_vkCreateRayTracingPipelinesKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCreateRayTracingPipelinesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCreateRayTracingPipelinesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["deferredOperation"], deferredOperation, json_options);
-        HandleToJson(args["pipelineCache"], pipelineCache, json_options);
-        FieldToJson(args["createInfoCount"], createInfoCount, json_options);
-        FieldToJson(args["pCreateInfos"], pCreateInfos, json_options);
-        FieldToJson(args["pAllocator"], pAllocator, json_options);
-        HandleToJson(args["pPipelines"], pPipelines, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("deferredOperation"), deferredOperation, json_options);
+        HandleToJson(writer.Key("pipelineCache"), pipelineCache, json_options);
+        FieldToJson(writer.Key("createInfoCount"), createInfoCount, json_options);
+        FieldToJson(writer.Key("pCreateInfos"), pCreateInfos, json_options);
+        FieldToJson(writer.Key("pAllocator"), pAllocator, json_options);
+        HandleToJson(writer.Key("pPipelines"), pPipelines, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10455,16 +11069,17 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingCaptureReplayShaderGroupHa
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["firstGroup"], firstGroup, json_options);
-        FieldToJson(args["groupCount"], groupCount, json_options);
-        FieldToJson(args["dataSize"], dataSize, json_options);
-        FieldToJson(args["pData"], pData, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipeline"), pipeline, json_options);
+        FieldToJson(writer.Key("firstGroup"), firstGroup, json_options);
+        FieldToJson(writer.Key("groupCount"), groupCount, json_options);
+        FieldToJson(writer.Key("dataSize"), dataSize, json_options);
+        FieldToJson(writer.Key("pData"), pData, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10477,16 +11092,17 @@ void VulkanExportJsonConsumer::Process_vkCmdTraceRaysIndirectKHR(
     StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pCallableShaderBindingTable,
     VkDeviceAddress                             indirectDeviceAddress)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdTraceRaysIndirectKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdTraceRaysIndirectKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pRaygenShaderBindingTable"], pRaygenShaderBindingTable, json_options);
-        FieldToJson(args["pMissShaderBindingTable"], pMissShaderBindingTable, json_options);
-        FieldToJson(args["pHitShaderBindingTable"], pHitShaderBindingTable, json_options);
-        FieldToJson(args["pCallableShaderBindingTable"], pCallableShaderBindingTable, json_options);
-        FieldToJsonAsHex(args["indirectDeviceAddress"], indirectDeviceAddress, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pRaygenShaderBindingTable"), pRaygenShaderBindingTable, json_options);
+        FieldToJson(writer.Key("pMissShaderBindingTable"), pMissShaderBindingTable, json_options);
+        FieldToJson(writer.Key("pHitShaderBindingTable"), pHitShaderBindingTable, json_options);
+        FieldToJson(writer.Key("pCallableShaderBindingTable"), pCallableShaderBindingTable, json_options);
+        FieldToJsonAsHex(writer.Key("indirectDeviceAddress"), indirectDeviceAddress, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10498,14 +11114,15 @@ void VulkanExportJsonConsumer::Process_vkGetRayTracingShaderGroupStackSizeKHR(
     uint32_t                                    group,
     VkShaderGroupShaderKHR                      groupShader)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupStackSizeKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkGetRayTracingShaderGroupStackSizeKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameReturn()], returnValue, json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["device"], device, json_options);
-        HandleToJson(args["pipeline"], pipeline, json_options);
-        FieldToJson(args["group"], group, json_options);
-        FieldToJson(args["groupShader"], groupShader, json_options);
+    FieldToJson(writer.Key(NameReturn()), returnValue, json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("device"), device, json_options);
+        HandleToJson(writer.Key("pipeline"), pipeline, json_options);
+        FieldToJson(writer.Key("group"), group, json_options);
+        FieldToJson(writer.Key("groupShader"), groupShader, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10514,12 +11131,13 @@ void VulkanExportJsonConsumer::Process_vkCmdSetRayTracingPipelineStackSizeKHR(
     format::HandleId                            commandBuffer,
     uint32_t                                    pipelineStackSize)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdSetRayTracingPipelineStackSizeKHR");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdSetRayTracingPipelineStackSizeKHR");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["pipelineStackSize"], pipelineStackSize, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("pipelineStackSize"), pipelineStackSize, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10530,14 +11148,15 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksEXT(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        FieldToJson(args["groupCountX"], groupCountX, json_options);
-        FieldToJson(args["groupCountY"], groupCountY, json_options);
-        FieldToJson(args["groupCountZ"], groupCountZ, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        FieldToJson(writer.Key("groupCountX"), groupCountX, json_options);
+        FieldToJson(writer.Key("groupCountY"), groupCountY, json_options);
+        FieldToJson(writer.Key("groupCountZ"), groupCountZ, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10549,15 +11168,16 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectEXT(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectEXT");
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectEXT");
     const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        FieldToJson(args["drawCount"], drawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        FieldToJson(writer.Key("drawCount"), drawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 
@@ -10571,17 +11191,18 @@ void VulkanExportJsonConsumer::Process_vkCmdDrawMeshTasksIndirectCountEXT(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    nlohmann::ordered_json& jdata = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountEXT");
-    const JsonOptions& json_options = GetJsonOptions();
-    FieldToJson(jdata[NameCommandIndex()], GetCommandBufferRecordIndex(commandBuffer), json_options);
-    auto& args = jdata[NameArgs()];
-        HandleToJson(args["commandBuffer"], commandBuffer, json_options);
-        HandleToJson(args["buffer"], buffer, json_options);
-        FieldToJson(args["offset"], offset, json_options);
-        HandleToJson(args["countBuffer"], countBuffer, json_options);
-        FieldToJson(args["countBufferOffset"], countBufferOffset, json_options);
-        FieldToJson(args["maxDrawCount"], maxDrawCount, json_options);
-        FieldToJson(args["stride"], stride, json_options);
+    JsonStreamWriter& writer = WriteApiCallStart(call_info, "vkCmdDrawMeshTasksIndirectCountEXT");
+    const JsonOptions& json_options = GetJsonOptions();
+    FieldToJson(writer.Key(NameCommandIndex()), GetCommandBufferRecordIndex(commandBuffer), json_options);
+    writer.Key(NameArgs()).BeginObject();
+        HandleToJson(writer.Key("commandBuffer"), commandBuffer, json_options);
+        HandleToJson(writer.Key("buffer"), buffer, json_options);
+        FieldToJson(writer.Key("offset"), offset, json_options);
+        HandleToJson(writer.Key("countBuffer"), countBuffer, json_options);
+        FieldToJson(writer.Key("countBufferOffset"), countBufferOffset, json_options);
+        FieldToJson(writer.Key("maxDrawCount"), maxDrawCount, json_options);
+        FieldToJson(writer.Key("stride"), stride, json_options);
+    writer.EndObject();
     WriteBlockEnd();
 }
 GFXRECON_END_NAMESPACE(decode)
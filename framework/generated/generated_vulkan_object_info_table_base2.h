@@ -88,51 +88,51 @@ class VulkanObjectInfoTableBase2 : VulkanObjectInfoTableBase
     void AddVideoSessionKHRInfo(VideoSessionKHRInfo&& info) { AddObjectInfo(std::move(info), &videoSessionKHR_map_); }
     void AddVideoSessionParametersKHRInfo(VideoSessionParametersKHRInfo&& info) { AddObjectInfo(std::move(info), &videoSessionParametersKHR_map_); }
 
-    void RemoveAccelerationStructureKHRInfo(format::HandleId id) { accelerationStructureKHR_map_.erase(id); }
-    void RemoveAccelerationStructureNVInfo(format::HandleId id) { accelerationStructureNV_map_.erase(id); }
-    void RemoveBufferInfo(format::HandleId id) { buffer_map_.erase(id); }
-    void RemoveBufferViewInfo(format::HandleId id) { bufferView_map_.erase(id); }
-    void RemoveCommandBufferInfo(format::HandleId id) { commandBuffer_map_.erase(id); }
-    void RemoveCommandPoolInfo(format::HandleId id) { commandPool_map_.erase(id); }
-    void RemoveDebugReportCallbackEXTInfo(format::HandleId id) { debugReportCallbackEXT_map_.erase(id); }
-    void RemoveDebugUtilsMessengerEXTInfo(format::HandleId id) { debugUtilsMessengerEXT_map_.erase(id); }
-    void RemoveDeferredOperationKHRInfo(format::HandleId id) { deferredOperationKHR_map_.erase(id); }
-    void RemoveDescriptorPoolInfo(format::HandleId id) { descriptorPool_map_.erase(id); }
-    void RemoveDescriptorSetInfo(format::HandleId id) { descriptorSet_map_.erase(id); }
-    void RemoveDescriptorSetLayoutInfo(format::HandleId id) { descriptorSetLayout_map_.erase(id); }
-    void RemoveDescriptorUpdateTemplateInfo(format::HandleId id) { descriptorUpdateTemplate_map_.erase(id); }
-    void RemoveDeviceInfo(format::HandleId id) { device_map_.erase(id); }
-    void RemoveDeviceMemoryInfo(format::HandleId id) { deviceMemory_map_.erase(id); }
-    void RemoveDisplayKHRInfo(format::HandleId id) { displayKHR_map_.erase(id); }
-    void RemoveDisplayModeKHRInfo(format::HandleId id) { displayModeKHR_map_.erase(id); }
-    void RemoveEventInfo(format::HandleId id) { event_map_.erase(id); }
-    void RemoveFenceInfo(format::HandleId id) { fence_map_.erase(id); }
-    void RemoveFramebufferInfo(format::HandleId id) { framebuffer_map_.erase(id); }
-    void RemoveImageInfo(format::HandleId id) { image_map_.erase(id); }
-    void RemoveImageViewInfo(format::HandleId id) { imageView_map_.erase(id); }
-    void RemoveIndirectCommandsLayoutNVInfo(format::HandleId id) { indirectCommandsLayoutNV_map_.erase(id); }
-    void RemoveInstanceInfo(format::HandleId id) { instance_map_.erase(id); }
-    void RemoveMicromapEXTInfo(format::HandleId id) { micromapEXT_map_.erase(id); }
-    void RemoveOpticalFlowSessionNVInfo(format::HandleId id) { opticalFlowSessionNV_map_.erase(id); }
-    void RemovePerformanceConfigurationINTELInfo(format::HandleId id) { performanceConfigurationINTEL_map_.erase(id); }
-    void RemovePhysicalDeviceInfo(format::HandleId id) { physicalDevice_map_.erase(id); }
-    void RemovePipelineInfo(format::HandleId id) { pipeline_map_.erase(id); }
-    void RemovePipelineCacheInfo(format::HandleId id) { pipelineCache_map_.erase(id); }
-    void RemovePipelineLayoutInfo(format::HandleId id) { pipelineLayout_map_.erase(id); }
-    void RemovePrivateDataSlotInfo(format::HandleId id) { privateDataSlot_map_.erase(id); }
-    void RemoveQueryPoolInfo(format::HandleId id) { queryPool_map_.erase(id); }
-    void RemoveQueueInfo(format::HandleId id) { queue_map_.erase(id); }
-    void RemoveRenderPassInfo(format::HandleId id) { renderPass_map_.erase(id); }
-    void RemoveSamplerInfo(format::HandleId id) { sampler_map_.erase(id); }
-    void RemoveSamplerYcbcrConversionInfo(format::HandleId id) { samplerYcbcrConversion_map_.erase(id); }
-    void RemoveSemaphoreInfo(format::HandleId id) { semaphore_map_.erase(id); }
-    void RemoveShaderEXTInfo(format::HandleId id) { shaderEXT_map_.erase(id); }
-    void RemoveShaderModuleInfo(format::HandleId id) { shaderModule_map_.erase(id); }
-    void RemoveSurfaceKHRInfo(format::HandleId id) { surfaceKHR_map_.erase(id); }
-    void RemoveSwapchainKHRInfo(format::HandleId id) { swapchainKHR_map_.erase(id); }
-    void RemoveValidationCacheEXTInfo(format::HandleId id) { validationCacheEXT_map_.erase(id); }
-    void RemoveVideoSessionKHRInfo(format::HandleId id) { videoSessionKHR_map_.erase(id); }
-    void RemoveVideoSessionParametersKHRInfo(format::HandleId id) { videoSessionParametersKHR_map_.erase(id); }
+    void RemoveAccelerationStructureKHRInfo(format::HandleId id) { accelerationStructureKHR_map_.Erase(id); }
+    void RemoveAccelerationStructureNVInfo(format::HandleId id) { accelerationStructureNV_map_.Erase(id); }
+    void RemoveBufferInfo(format::HandleId id) { buffer_map_.Erase(id); }
+    void RemoveBufferViewInfo(format::HandleId id) { bufferView_map_.Erase(id); }
+    void RemoveCommandBufferInfo(format::HandleId id) { commandBuffer_map_.Erase(id); }
+    void RemoveCommandPoolInfo(format::HandleId id) { commandPool_map_.Erase(id); }
+    void RemoveDebugReportCallbackEXTInfo(format::HandleId id) { debugReportCallbackEXT_map_.Erase(id); }
+    void RemoveDebugUtilsMessengerEXTInfo(format::HandleId id) { debugUtilsMessengerEXT_map_.Erase(id); }
+    void RemoveDeferredOperationKHRInfo(format::HandleId id) { deferredOperationKHR_map_.Erase(id); }
+    void RemoveDescriptorPoolInfo(format::HandleId id) { descriptorPool_map_.Erase(id); }
+    void RemoveDescriptorSetInfo(format::HandleId id) { descriptorSet_map_.Erase(id); }
+    void RemoveDescriptorSetLayoutInfo(format::HandleId id) { descriptorSetLayout_map_.Erase(id); }
+    void RemoveDescriptorUpdateTemplateInfo(format::HandleId id) { descriptorUpdateTemplate_map_.Erase(id); }
+    void RemoveDeviceInfo(format::HandleId id) { device_map_.Erase(id); }
+    void RemoveDeviceMemoryInfo(format::HandleId id) { deviceMemory_map_.Erase(id); }
+    void RemoveDisplayKHRInfo(format::HandleId id) { displayKHR_map_.Erase(id); }
+    void RemoveDisplayModeKHRInfo(format::HandleId id) { displayModeKHR_map_.Erase(id); }
+    void RemoveEventInfo(format::HandleId id) { event_map_.Erase(id); }
+    void RemoveFenceInfo(format::HandleId id) { fence_map_.Erase(id); }
+    void RemoveFramebufferInfo(format::HandleId id) { framebuffer_map_.Erase(id); }
+    void RemoveImageInfo(format::HandleId id) { image_map_.Erase(id); }
+    void RemoveImageViewInfo(format::HandleId id) { imageView_map_.Erase(id); }
+    void RemoveIndirectCommandsLayoutNVInfo(format::HandleId id) { indirectCommandsLayoutNV_map_.Erase(id); }
+    void RemoveInstanceInfo(format::HandleId id) { instance_map_.Erase(id); }
+    void RemoveMicromapEXTInfo(format::HandleId id) { micromapEXT_map_.Erase(id); }
+    void RemoveOpticalFlowSessionNVInfo(format::HandleId id) { opticalFlowSessionNV_map_.Erase(id); }
+    void RemovePerformanceConfigurationINTELInfo(format::HandleId id) { performanceConfigurationINTEL_map_.Erase(id); }
+    void RemovePhysicalDeviceInfo(format::HandleId id) { physicalDevice_map_.Erase(id); }
+    void RemovePipelineInfo(format::HandleId id) { pipeline_map_.Erase(id); }
+    void RemovePipelineCacheInfo(format::HandleId id) { pipelineCache_map_.Erase(id); }
+    void RemovePipelineLayoutInfo(format::HandleId id) { pipelineLayout_map_.Erase(id); }
+    void RemovePrivateDataSlotInfo(format::HandleId id) { privateDataSlot_map_.Erase(id); }
+    void RemoveQueryPoolInfo(format::HandleId id) { queryPool_map_.Erase(id); }
+    void RemoveQueueInfo(format::HandleId id) { queue_map_.Erase(id); }
+    void RemoveRenderPassInfo(format::HandleId id) { renderPass_map_.Erase(id); }
+    void RemoveSamplerInfo(format::HandleId id) { sampler_map_.Erase(id); }
+    void RemoveSamplerYcbcrConversionInfo(format::HandleId id) { samplerYcbcrConversion_map_.Erase(id); }
+    void RemoveSemaphoreInfo(format::HandleId id) { semaphore_map_.Erase(id); }
+    void RemoveShaderEXTInfo(format::HandleId id) { shaderEXT_map_.Erase(id); }
+    void RemoveShaderModuleInfo(format::HandleId id) { shaderModule_map_.Erase(id); }
+    void RemoveSurfaceKHRInfo(format::HandleId id) { surfaceKHR_map_.Erase(id); }
+    void RemoveSwapchainKHRInfo(format::HandleId id) { swapchainKHR_map_.Erase(id); }
+    void RemoveValidationCacheEXTInfo(format::HandleId id) { validationCacheEXT_map_.Erase(id); }
+    void RemoveVideoSessionKHRInfo(format::HandleId id) { videoSessionKHR_map_.Erase(id); }
+    void RemoveVideoSessionParametersKHRInfo(format::HandleId id) { videoSessionParametersKHR_map_.Erase(id); }
 
     const AccelerationStructureKHRInfo* GetAccelerationStructureKHRInfo(format::HandleId id) const { return GetObjectInfo<AccelerationStructureKHRInfo>(id, &accelerationStructureKHR_map_); }
     const AccelerationStructureNVInfo* GetAccelerationStructureNVInfo(format::HandleId id) const { return GetObjectInfo<AccelerationStructureNVInfo>(id, &accelerationStructureNV_map_); }
@@ -226,98 +226,98 @@ class VulkanObjectInfoTableBase2 : VulkanObjectInfoTableBase
     VideoSessionKHRInfo* GetVideoSessionKHRInfo(format::HandleId id) { return GetObjectInfo<VideoSessionKHRInfo>(id, &videoSessionKHR_map_); }
     VideoSessionParametersKHRInfo* GetVideoSessionParametersKHRInfo(format::HandleId id) { return GetObjectInfo<VideoSessionParametersKHRInfo>(id, &videoSessionParametersKHR_map_); }
 
-    void VisitAccelerationStructureKHRInfo(std::function<void(const AccelerationStructureKHRInfo*)> visitor) const {  for (const auto& entry : accelerationStructureKHR_map_) { visitor(&entry.second); }  }
-    void VisitAccelerationStructureNVInfo(std::function<void(const AccelerationStructureNVInfo*)> visitor) const {  for (const auto& entry : accelerationStructureNV_map_) { visitor(&entry.second); }  }
-    void VisitBufferInfo(std::function<void(const BufferInfo*)> visitor) const {  for (const auto& entry : buffer_map_) { visitor(&entry.second); }  }
-    void VisitBufferViewInfo(std::function<void(const BufferViewInfo*)> visitor) const {  for (const auto& entry : bufferView_map_) { visitor(&entry.second); }  }
-    void VisitCommandBufferInfo(std::function<void(const CommandBufferInfo*)> visitor) const {  for (const auto& entry : commandBuffer_map_) { visitor(&entry.second); }  }
-    void VisitCommandPoolInfo(std::function<void(const CommandPoolInfo*)> visitor) const {  for (const auto& entry : commandPool_map_) { visitor(&entry.second); }  }
-    void VisitDebugReportCallbackEXTInfo(std::function<void(const DebugReportCallbackEXTInfo*)> visitor) const {  for (const auto& entry : debugReportCallbackEXT_map_) { visitor(&entry.second); }  }
-    void VisitDebugUtilsMessengerEXTInfo(std::function<void(const DebugUtilsMessengerEXTInfo*)> visitor) const {  for (const auto& entry : debugUtilsMessengerEXT_map_) { visitor(&entry.second); }  }
-    void VisitDeferredOperationKHRInfo(std::function<void(const DeferredOperationKHRInfo*)> visitor) const {  for (const auto& entry : deferredOperationKHR_map_) { visitor(&entry.second); }  }
-    void VisitDescriptorPoolInfo(std::function<void(const DescriptorPoolInfo*)> visitor) const {  for (const auto& entry : descriptorPool_map_) { visitor(&entry.second); }  }
-    void VisitDescriptorSetInfo(std::function<void(const DescriptorSetInfo*)> visitor) const {  for (const auto& entry : descriptorSet_map_) { visitor(&entry.second); }  }
-    void VisitDescriptorSetLayoutInfo(std::function<void(const DescriptorSetLayoutInfo*)> visitor) const {  for (const auto& entry : descriptorSetLayout_map_) { visitor(&entry.second); }  }
-    void VisitDescriptorUpdateTemplateInfo(std::function<void(const DescriptorUpdateTemplateInfo*)> visitor) const {  for (const auto& entry : descriptorUpdateTemplate_map_) { visitor(&entry.second); }  }
-    void VisitDeviceInfo(std::function<void(const DeviceInfo*)> visitor) const {  for (const auto& entry : device_map_) { visitor(&entry.second); }  }
-    void VisitDeviceMemoryInfo(std::function<void(const DeviceMemoryInfo*)> visitor) const {  for (const auto& entry : deviceMemory_map_) { visitor(&entry.second); }  }
-    void VisitDisplayKHRInfo(std::function<void(const DisplayKHRInfo*)> visitor) const {  for (const auto& entry : displayKHR_map_) { visitor(&entry.second); }  }
-    void VisitDisplayModeKHRInfo(std::function<void(const DisplayModeKHRInfo*)> visitor) const {  for (const auto& entry : displayModeKHR_map_) { visitor(&entry.second); }  }
-    void VisitEventInfo(std::function<void(const EventInfo*)> visitor) const {  for (const auto& entry : event_map_) { visitor(&entry.second); }  }
-    void VisitFenceInfo(std::function<void(const FenceInfo*)> visitor) const {  for (const auto& entry : fence_map_) { visitor(&entry.second); }  }
-    void VisitFramebufferInfo(std::function<void(const FramebufferInfo*)> visitor) const {  for (const auto& entry : framebuffer_map_) { visitor(&entry.second); }  }
-    void VisitImageInfo(std::function<void(const ImageInfo*)> visitor) const {  for (const auto& entry : image_map_) { visitor(&entry.second); }  }
-    void VisitImageViewInfo(std::function<void(const ImageViewInfo*)> visitor) const {  for (const auto& entry : imageView_map_) { visitor(&entry.second); }  }
-    void VisitIndirectCommandsLayoutNVInfo(std::function<void(const IndirectCommandsLayoutNVInfo*)> visitor) const {  for (const auto& entry : indirectCommandsLayoutNV_map_) { visitor(&entry.second); }  }
-    void VisitInstanceInfo(std::function<void(const InstanceInfo*)> visitor) const {  for (const auto& entry : instance_map_) { visitor(&entry.second); }  }
-    void VisitMicromapEXTInfo(std::function<void(const MicromapEXTInfo*)> visitor) const {  for (const auto& entry : micromapEXT_map_) { visitor(&entry.second); }  }
-    void VisitOpticalFlowSessionNVInfo(std::function<void(const OpticalFlowSessionNVInfo*)> visitor) const {  for (const auto& entry : opticalFlowSessionNV_map_) { visitor(&entry.second); }  }
-    void VisitPerformanceConfigurationINTELInfo(std::function<void(const PerformanceConfigurationINTELInfo*)> visitor) const {  for (const auto& entry : performanceConfigurationINTEL_map_) { visitor(&entry.second); }  }
-    void VisitPhysicalDeviceInfo(std::function<void(const PhysicalDeviceInfo*)> visitor) const {  for (const auto& entry : physicalDevice_map_) { visitor(&entry.second); }  }
-    void VisitPipelineInfo(std::function<void(const PipelineInfo*)> visitor) const {  for (const auto& entry : pipeline_map_) { visitor(&entry.second); }  }
-    void VisitPipelineCacheInfo(std::function<void(const PipelineCacheInfo*)> visitor) const {  for (const auto& entry : pipelineCache_map_) { visitor(&entry.second); }  }
-    void VisitPipelineLayoutInfo(std::function<void(const PipelineLayoutInfo*)> visitor) const {  for (const auto& entry : pipelineLayout_map_) { visitor(&entry.second); }  }
-    void VisitPrivateDataSlotInfo(std::function<void(const PrivateDataSlotInfo*)> visitor) const {  for (const auto& entry : privateDataSlot_map_) { visitor(&entry.second); }  }
-    void VisitQueryPoolInfo(std::function<void(const QueryPoolInfo*)> visitor) const {  for (const auto& entry : queryPool_map_) { visitor(&entry.second); }  }
-    void VisitQueueInfo(std::function<void(const QueueInfo*)> visitor) const {  for (const auto& entry : queue_map_) { visitor(&entry.second); }  }
-    void VisitRenderPassInfo(std::function<void(const RenderPassInfo*)> visitor) const {  for (const auto& entry : renderPass_map_) { visitor(&entry.second); }  }
-    void VisitSamplerInfo(std::function<void(const SamplerInfo*)> visitor) const {  for (const auto& entry : sampler_map_) { visitor(&entry.second); }  }
-    void VisitSamplerYcbcrConversionInfo(std::function<void(const SamplerYcbcrConversionInfo*)> visitor) const {  for (const auto& entry : samplerYcbcrConversion_map_) { visitor(&entry.second); }  }
-    void VisitSemaphoreInfo(std::function<void(const SemaphoreInfo*)> visitor) const {  for (const auto& entry : semaphore_map_) { visitor(&entry.second); }  }
-    void VisitShaderEXTInfo(std::function<void(const ShaderEXTInfo*)> visitor) const {  for (const auto& entry : shaderEXT_map_) { visitor(&entry.second); }  }
-    void VisitShaderModuleInfo(std::function<void(const ShaderModuleInfo*)> visitor) const {  for (const auto& entry : shaderModule_map_) { visitor(&entry.second); }  }
-    void VisitSurfaceKHRInfo(std::function<void(const SurfaceKHRInfo*)> visitor) const {  for (const auto& entry : surfaceKHR_map_) { visitor(&entry.second); }  }
-    void VisitSwapchainKHRInfo(std::function<void(const SwapchainKHRInfo*)> visitor) const {  for (const auto& entry : swapchainKHR_map_) { visitor(&entry.second); }  }
-    void VisitValidationCacheEXTInfo(std::function<void(const ValidationCacheEXTInfo*)> visitor) const {  for (const auto& entry : validationCacheEXT_map_) { visitor(&entry.second); }  }
-    void VisitVideoSessionKHRInfo(std::function<void(const VideoSessionKHRInfo*)> visitor) const {  for (const auto& entry : videoSessionKHR_map_) { visitor(&entry.second); }  }
-    void VisitVideoSessionParametersKHRInfo(std::function<void(const VideoSessionParametersKHRInfo*)> visitor) const {  for (const auto& entry : videoSessionParametersKHR_map_) { visitor(&entry.second); }  }
+    void VisitAccelerationStructureKHRInfo(std::function<void(const AccelerationStructureKHRInfo*)> visitor) const {  accelerationStructureKHR_map_.ForEach([&visitor](const AccelerationStructureKHRInfo& info) { visitor(&info); });  }
+    void VisitAccelerationStructureNVInfo(std::function<void(const AccelerationStructureNVInfo*)> visitor) const {  accelerationStructureNV_map_.ForEach([&visitor](const AccelerationStructureNVInfo& info) { visitor(&info); });  }
+    void VisitBufferInfo(std::function<void(const BufferInfo*)> visitor) const {  buffer_map_.ForEach([&visitor](const BufferInfo& info) { visitor(&info); });  }
+    void VisitBufferViewInfo(std::function<void(const BufferViewInfo*)> visitor) const {  bufferView_map_.ForEach([&visitor](const BufferViewInfo& info) { visitor(&info); });  }
+    void VisitCommandBufferInfo(std::function<void(const CommandBufferInfo*)> visitor) const {  commandBuffer_map_.ForEach([&visitor](const CommandBufferInfo& info) { visitor(&info); });  }
+    void VisitCommandPoolInfo(std::function<void(const CommandPoolInfo*)> visitor) const {  commandPool_map_.ForEach([&visitor](const CommandPoolInfo& info) { visitor(&info); });  }
+    void VisitDebugReportCallbackEXTInfo(std::function<void(const DebugReportCallbackEXTInfo*)> visitor) const {  debugReportCallbackEXT_map_.ForEach([&visitor](const DebugReportCallbackEXTInfo& info) { visitor(&info); });  }
+    void VisitDebugUtilsMessengerEXTInfo(std::function<void(const DebugUtilsMessengerEXTInfo*)> visitor) const {  debugUtilsMessengerEXT_map_.ForEach([&visitor](const DebugUtilsMessengerEXTInfo& info) { visitor(&info); });  }
+    void VisitDeferredOperationKHRInfo(std::function<void(const DeferredOperationKHRInfo*)> visitor) const {  deferredOperationKHR_map_.ForEach([&visitor](const DeferredOperationKHRInfo& info) { visitor(&info); });  }
+    void VisitDescriptorPoolInfo(std::function<void(const DescriptorPoolInfo*)> visitor) const {  descriptorPool_map_.ForEach([&visitor](const DescriptorPoolInfo& info) { visitor(&info); });  }
+    void VisitDescriptorSetInfo(std::function<void(const DescriptorSetInfo*)> visitor) const {  descriptorSet_map_.ForEach([&visitor](const DescriptorSetInfo& info) { visitor(&info); });  }
+    void VisitDescriptorSetLayoutInfo(std::function<void(const DescriptorSetLayoutInfo*)> visitor) const {  descriptorSetLayout_map_.ForEach([&visitor](const DescriptorSetLayoutInfo& info) { visitor(&info); });  }
+    void VisitDescriptorUpdateTemplateInfo(std::function<void(const DescriptorUpdateTemplateInfo*)> visitor) const {  descriptorUpdateTemplate_map_.ForEach([&visitor](const DescriptorUpdateTemplateInfo& info) { visitor(&info); });  }
+    void VisitDeviceInfo(std::function<void(const DeviceInfo*)> visitor) const {  device_map_.ForEach([&visitor](const DeviceInfo& info) { visitor(&info); });  }
+    void VisitDeviceMemoryInfo(std::function<void(const DeviceMemoryInfo*)> visitor) const {  deviceMemory_map_.ForEach([&visitor](const DeviceMemoryInfo& info) { visitor(&info); });  }
+    void VisitDisplayKHRInfo(std::function<void(const DisplayKHRInfo*)> visitor) const {  displayKHR_map_.ForEach([&visitor](const DisplayKHRInfo& info) { visitor(&info); });  }
+    void VisitDisplayModeKHRInfo(std::function<void(const DisplayModeKHRInfo*)> visitor) const {  displayModeKHR_map_.ForEach([&visitor](const DisplayModeKHRInfo& info) { visitor(&info); });  }
+    void VisitEventInfo(std::function<void(const EventInfo*)> visitor) const {  event_map_.ForEach([&visitor](const EventInfo& info) { visitor(&info); });  }
+    void VisitFenceInfo(std::function<void(const FenceInfo*)> visitor) const {  fence_map_.ForEach([&visitor](const FenceInfo& info) { visitor(&info); });  }
+    void VisitFramebufferInfo(std::function<void(const FramebufferInfo*)> visitor) const {  framebuffer_map_.ForEach([&visitor](const FramebufferInfo& info) { visitor(&info); });  }
+    void VisitImageInfo(std::function<void(const ImageInfo*)> visitor) const {  image_map_.ForEach([&visitor](const ImageInfo& info) { visitor(&info); });  }
+    void VisitImageViewInfo(std::function<void(const ImageViewInfo*)> visitor) const {  imageView_map_.ForEach([&visitor](const ImageViewInfo& info) { visitor(&info); });  }
+    void VisitIndirectCommandsLayoutNVInfo(std::function<void(const IndirectCommandsLayoutNVInfo*)> visitor) const {  indirectCommandsLayoutNV_map_.ForEach([&visitor](const IndirectCommandsLayoutNVInfo& info) { visitor(&info); });  }
+    void VisitInstanceInfo(std::function<void(const InstanceInfo*)> visitor) const {  instance_map_.ForEach([&visitor](const InstanceInfo& info) { visitor(&info); });  }
+    void VisitMicromapEXTInfo(std::function<void(const MicromapEXTInfo*)> visitor) const {  micromapEXT_map_.ForEach([&visitor](const MicromapEXTInfo& info) { visitor(&info); });  }
+    void VisitOpticalFlowSessionNVInfo(std::function<void(const OpticalFlowSessionNVInfo*)> visitor) const {  opticalFlowSessionNV_map_.ForEach([&visitor](const OpticalFlowSessionNVInfo& info) { visitor(&info); });  }
+    void VisitPerformanceConfigurationINTELInfo(std::function<void(const PerformanceConfigurationINTELInfo*)> visitor) const {  performanceConfigurationINTEL_map_.ForEach([&visitor](const PerformanceConfigurationINTELInfo& info) { visitor(&info); });  }
+    void VisitPhysicalDeviceInfo(std::function<void(const PhysicalDeviceInfo*)> visitor) const {  physicalDevice_map_.ForEach([&visitor](const PhysicalDeviceInfo& info) { visitor(&info); });  }
+    void VisitPipelineInfo(std::function<void(const PipelineInfo*)> visitor) const {  pipeline_map_.ForEach([&visitor](const PipelineInfo& info) { visitor(&info); });  }
+    void VisitPipelineCacheInfo(std::function<void(const PipelineCacheInfo*)> visitor) const {  pipelineCache_map_.ForEach([&visitor](const PipelineCacheInfo& info) { visitor(&info); });  }
+    void VisitPipelineLayoutInfo(std::function<void(const PipelineLayoutInfo*)> visitor) const {  pipelineLayout_map_.ForEach([&visitor](const PipelineLayoutInfo& info) { visitor(&info); });  }
+    void VisitPrivateDataSlotInfo(std::function<void(const PrivateDataSlotInfo*)> visitor) const {  privateDataSlot_map_.ForEach([&visitor](const PrivateDataSlotInfo& info) { visitor(&info); });  }
+    void VisitQueryPoolInfo(std::function<void(const QueryPoolInfo*)> visitor) const {  queryPool_map_.ForEach([&visitor](const QueryPoolInfo& info) { visitor(&info); });  }
+    void VisitQueueInfo(std::function<void(const QueueInfo*)> visitor) const {  queue_map_.ForEach([&visitor](const QueueInfo& info) { visitor(&info); });  }
+    void VisitRenderPassInfo(std::function<void(const RenderPassInfo*)> visitor) const {  renderPass_map_.ForEach([&visitor](const RenderPassInfo& info) { visitor(&info); });  }
+    void VisitSamplerInfo(std::function<void(const SamplerInfo*)> visitor) const {  sampler_map_.ForEach([&visitor](const SamplerInfo& info) { visitor(&info); });  }
+    void VisitSamplerYcbcrConversionInfo(std::function<void(const SamplerYcbcrConversionInfo*)> visitor) const {  samplerYcbcrConversion_map_.ForEach([&visitor](const SamplerYcbcrConversionInfo& info) { visitor(&info); });  }
+    void VisitSemaphoreInfo(std::function<void(const SemaphoreInfo*)> visitor) const {  semaphore_map_.ForEach([&visitor](const SemaphoreInfo& info) { visitor(&info); });  }
+    void VisitShaderEXTInfo(std::function<void(const ShaderEXTInfo*)> visitor) const {  shaderEXT_map_.ForEach([&visitor](const ShaderEXTInfo& info) { visitor(&info); });  }
+    void VisitShaderModuleInfo(std::function<void(const ShaderModuleInfo*)> visitor) const {  shaderModule_map_.ForEach([&visitor](const ShaderModuleInfo& info) { visitor(&info); });  }
+    void VisitSurfaceKHRInfo(std::function<void(const SurfaceKHRInfo*)> visitor) const {  surfaceKHR_map_.ForEach([&visitor](const SurfaceKHRInfo& info) { visitor(&info); });  }
+    void VisitSwapchainKHRInfo(std::function<void(const SwapchainKHRInfo*)> visitor) const {  swapchainKHR_map_.ForEach([&visitor](const SwapchainKHRInfo& info) { visitor(&info); });  }
+    void VisitValidationCacheEXTInfo(std::function<void(const ValidationCacheEXTInfo*)> visitor) const {  validationCacheEXT_map_.ForEach([&visitor](const ValidationCacheEXTInfo& info) { visitor(&info); });  }
+    void VisitVideoSessionKHRInfo(std::function<void(const VideoSessionKHRInfo*)> visitor) const {  videoSessionKHR_map_.ForEach([&visitor](const VideoSessionKHRInfo& info) { visitor(&info); });  }
+    void VisitVideoSessionParametersKHRInfo(std::function<void(const VideoSessionParametersKHRInfo*)> visitor) const {  videoSessionParametersKHR_map_.ForEach([&visitor](const VideoSessionParametersKHRInfo& info) { visitor(&info); });  }
 
   protected:
-     std::unordered_map<format::HandleId, AccelerationStructureKHRInfo> accelerationStructureKHR_map_;
-     std::unordered_map<format::HandleId, AccelerationStructureNVInfo> accelerationStructureNV_map_;
-     std::unordered_map<format::HandleId, BufferInfo> buffer_map_;
-     std::unordered_map<format::HandleId, BufferViewInfo> bufferView_map_;
-     std::unordered_map<format::HandleId, CommandBufferInfo> commandBuffer_map_;
-     std::unordered_map<format::HandleId, CommandPoolInfo> commandPool_map_;
-     std::unordered_map<format::HandleId, DebugReportCallbackEXTInfo> debugReportCallbackEXT_map_;
-     std::unordered_map<format::HandleId, DebugUtilsMessengerEXTInfo> debugUtilsMessengerEXT_map_;
-     std::unordered_map<format::HandleId, DeferredOperationKHRInfo> deferredOperationKHR_map_;
-     std::unordered_map<format::HandleId, DescriptorPoolInfo> descriptorPool_map_;
-     std::unordered_map<format::HandleId, DescriptorSetInfo> descriptorSet_map_;
-     std::unordered_map<format::HandleId, DescriptorSetLayoutInfo> descriptorSetLayout_map_;
-     std::unordered_map<format::HandleId, DescriptorUpdateTemplateInfo> descriptorUpdateTemplate_map_;
-     std::unordered_map<format::HandleId, DeviceInfo> device_map_;
-     std::unordered_map<format::HandleId, DeviceMemoryInfo> deviceMemory_map_;
-     std::unordered_map<format::HandleId, DisplayKHRInfo> displayKHR_map_;
-     std::unordered_map<format::HandleId, DisplayModeKHRInfo> displayModeKHR_map_;
-     std::unordered_map<format::HandleId, EventInfo> event_map_;
-     std::unordered_map<format::HandleId, FenceInfo> fence_map_;
-     std::unordered_map<format::HandleId, FramebufferInfo> framebuffer_map_;
-     std::unordered_map<format::HandleId, ImageInfo> image_map_;
-     std::unordered_map<format::HandleId, ImageViewInfo> imageView_map_;
-     std::unordered_map<format::HandleId, IndirectCommandsLayoutNVInfo> indirectCommandsLayoutNV_map_;
-     std::unordered_map<format::HandleId, InstanceInfo> instance_map_;
-     std::unordered_map<format::HandleId, MicromapEXTInfo> micromapEXT_map_;
-     std::unordered_map<format::HandleId, OpticalFlowSessionNVInfo> opticalFlowSessionNV_map_;
-     std::unordered_map<format::HandleId, PerformanceConfigurationINTELInfo> performanceConfigurationINTEL_map_;
-     std::unordered_map<format::HandleId, PhysicalDeviceInfo> physicalDevice_map_;
-     std::unordered_map<format::HandleId, PipelineInfo> pipeline_map_;
-     std::unordered_map<format::HandleId, PipelineCacheInfo> pipelineCache_map_;
-     std::unordered_map<format::HandleId, PipelineLayoutInfo> pipelineLayout_map_;
-     std::unordered_map<format::HandleId, PrivateDataSlotInfo> privateDataSlot_map_;
-     std::unordered_map<format::HandleId, QueryPoolInfo> queryPool_map_;
-     std::unordered_map<format::HandleId, QueueInfo> queue_map_;
-     std::unordered_map<format::HandleId, RenderPassInfo> renderPass_map_;
-     std::unordered_map<format::HandleId, SamplerInfo> sampler_map_;
-     std::unordered_map<format::HandleId, SamplerYcbcrConversionInfo> samplerYcbcrConversion_map_;
-     std::unordered_map<format::HandleId, SemaphoreInfo> semaphore_map_;
-     std::unordered_map<format::HandleId, ShaderEXTInfo> shaderEXT_map_;
-     std::unordered_map<format::HandleId, ShaderModuleInfo> shaderModule_map_;
-     std::unordered_map<format::HandleId, SurfaceKHRInfo> surfaceKHR_map_;
-     std::unordered_map<format::HandleId, SwapchainKHRInfo> swapchainKHR_map_;
-     std::unordered_map<format::HandleId, ValidationCacheEXTInfo> validationCacheEXT_map_;
-     std::unordered_map<format::HandleId, VideoSessionKHRInfo> videoSessionKHR_map_;
-     std::unordered_map<format::HandleId, VideoSessionParametersKHRInfo> videoSessionParametersKHR_map_;
+     util::PagedIdMap<AccelerationStructureKHRInfo> accelerationStructureKHR_map_;
+     util::PagedIdMap<AccelerationStructureNVInfo> accelerationStructureNV_map_;
+     util::PagedIdMap<BufferInfo> buffer_map_;
+     util::PagedIdMap<BufferViewInfo> bufferView_map_;
+     util::PagedIdMap<CommandBufferInfo> commandBuffer_map_;
+     util::PagedIdMap<CommandPoolInfo> commandPool_map_;
+     util::PagedIdMap<DebugReportCallbackEXTInfo> debugReportCallbackEXT_map_;
+     util::PagedIdMap<DebugUtilsMessengerEXTInfo> debugUtilsMessengerEXT_map_;
+     util::PagedIdMap<DeferredOperationKHRInfo> deferredOperationKHR_map_;
+     util::PagedIdMap<DescriptorPoolInfo> descriptorPool_map_;
+     util::PagedIdMap<DescriptorSetInfo> descriptorSet_map_;
+     util::PagedIdMap<DescriptorSetLayoutInfo> descriptorSetLayout_map_;
+     util::PagedIdMap<DescriptorUpdateTemplateInfo> descriptorUpdateTemplate_map_;
+     util::PagedIdMap<DeviceInfo> device_map_;
+     util::PagedIdMap<DeviceMemoryInfo> deviceMemory_map_;
+     util::PagedIdMap<DisplayKHRInfo> displayKHR_map_;
+     util::PagedIdMap<DisplayModeKHRInfo> displayModeKHR_map_;
+     util::PagedIdMap<EventInfo> event_map_;
+     util::PagedIdMap<FenceInfo> fence_map_;
+     util::PagedIdMap<FramebufferInfo> framebuffer_map_;
+     util::PagedIdMap<ImageInfo> image_map_;
+     util::PagedIdMap<ImageViewInfo> imageView_map_;
+     util::PagedIdMap<IndirectCommandsLayoutNVInfo> indirectCommandsLayoutNV_map_;
+     util::PagedIdMap<InstanceInfo> instance_map_;
+     util::PagedIdMap<MicromapEXTInfo> micromapEXT_map_;
+     util::PagedIdMap<OpticalFlowSessionNVInfo> opticalFlowSessionNV_map_;
+     util::PagedIdMap<PerformanceConfigurationINTELInfo> performanceConfigurationINTEL_map_;
+     util::PagedIdMap<PhysicalDeviceInfo> physicalDevice_map_;
+     util::PagedIdMap<PipelineInfo> pipeline_map_;
+     util::PagedIdMap<PipelineCacheInfo> pipelineCache_map_;
+     util::PagedIdMap<PipelineLayoutInfo> pipelineLayout_map_;
+     util::PagedIdMap<PrivateDataSlotInfo> privateDataSlot_map_;
+     util::PagedIdMap<QueryPoolInfo> queryPool_map_;
+     util::PagedIdMap<QueueInfo> queue_map_;
+     util::PagedIdMap<RenderPassInfo> renderPass_map_;
+     util::PagedIdMap<SamplerInfo> sampler_map_;
+     util::PagedIdMap<SamplerYcbcrConversionInfo> samplerYcbcrConversion_map_;
+     util::PagedIdMap<SemaphoreInfo> semaphore_map_;
+     util::PagedIdMap<ShaderEXTInfo> shaderEXT_map_;
+     util::PagedIdMap<ShaderModuleInfo> shaderModule_map_;
+     util::PagedIdMap<SurfaceKHRInfo> surfaceKHR_map_;
+     util::PagedIdMap<SwapchainKHRInfo> swapchainKHR_map_;
+     util::PagedIdMap<ValidationCacheEXTInfo> validationCacheEXT_map_;
+     util::PagedIdMap<VideoSessionKHRInfo> videoSessionKHR_map_;
+     util::PagedIdMap<VideoSessionParametersKHRInfo> videoSessionParametersKHR_map_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -558,51 +558,51 @@ class VulkanStateHandleTable : VulkanStateTableBase
     template<typename Wrapper> Wrapper* GetWrapper(typename Wrapper::HandleType handle) { return nullptr; }
 
   private:
-    std::unordered_map<VkAccelerationStructureKHR, vulkan_wrappers::AccelerationStructureKHRWrapper*> accelerationStructureKHR_map_;
-    std::unordered_map<VkAccelerationStructureNV, vulkan_wrappers::AccelerationStructureNVWrapper*> accelerationStructureNV_map_;
-    std::unordered_map<VkBuffer, vulkan_wrappers::BufferWrapper*> buffer_map_;
-    std::unordered_map<VkBufferView, vulkan_wrappers::BufferViewWrapper*> bufferView_map_;
-    std::unordered_map<VkCommandBuffer, vulkan_wrappers::CommandBufferWrapper*> commandBuffer_map_;
-    std::unordered_map<VkCommandPool, vulkan_wrappers::CommandPoolWrapper*> commandPool_map_;
-    std::unordered_map<VkDebugReportCallbackEXT, vulkan_wrappers::DebugReportCallbackEXTWrapper*> debugReportCallbackEXT_map_;
-    std::unordered_map<VkDebugUtilsMessengerEXT, vulkan_wrappers::DebugUtilsMessengerEXTWrapper*> debugUtilsMessengerEXT_map_;
-    std::unordered_map<VkDeferredOperationKHR, vulkan_wrappers::DeferredOperationKHRWrapper*> deferredOperationKHR_map_;
-    std::unordered_map<VkDescriptorPool, vulkan_wrappers::DescriptorPoolWrapper*> descriptorPool_map_;
-    std::unordered_map<VkDescriptorSet, vulkan_wrappers::DescriptorSetWrapper*> descriptorSet_map_;
-    std::unordered_map<VkDescriptorSetLayout, vulkan_wrappers::DescriptorSetLayoutWrapper*> descriptorSetLayout_map_;
-    std::unordered_map<VkDescriptorUpdateTemplate, vulkan_wrappers::DescriptorUpdateTemplateWrapper*> descriptorUpdateTemplate_map_;
-    std::unordered_map<VkDevice, vulkan_wrappers::DeviceWrapper*> device_map_;
-    std::unordered_map<VkDeviceMemory, vulkan_wrappers::DeviceMemoryWrapper*> deviceMemory_map_;
-    std::unordered_map<VkDisplayKHR, vulkan_wrappers::DisplayKHRWrapper*> displayKHR_map_;
-    std::unordered_map<VkDisplayModeKHR, vulkan_wrappers::DisplayModeKHRWrapper*> displayModeKHR_map_;
-    std::unordered_map<VkEvent, vulkan_wrappers::EventWrapper*> event_map_;
-    std::unordered_map<VkFence, vulkan_wrappers::FenceWrapper*> fence_map_;
-    std::unordered_map<VkFramebuffer, vulkan_wrappers::FramebufferWrapper*> framebuffer_map_;
-    std::unordered_map<VkImage, vulkan_wrappers::ImageWrapper*> image_map_;
-    std::unordered_map<VkImageView, vulkan_wrappers::ImageViewWrapper*> imageView_map_;
-    std::unordered_map<VkIndirectCommandsLayoutNV, vulkan_wrappers::IndirectCommandsLayoutNVWrapper*> indirectCommandsLayoutNV_map_;
-    std::unordered_map<VkInstance, vulkan_wrappers::InstanceWrapper*> instance_map_;
-    std::unordered_map<VkMicromapEXT, vulkan_wrappers::MicromapEXTWrapper*> micromapEXT_map_;
-    std::unordered_map<VkOpticalFlowSessionNV, vulkan_wrappers::OpticalFlowSessionNVWrapper*> opticalFlowSessionNV_map_;
-    std::unordered_map<VkPerformanceConfigurationINTEL, vulkan_wrappers::PerformanceConfigurationINTELWrapper*> performanceConfigurationINTEL_map_;
-    std::unordered_map<VkPhysicalDevice, vulkan_wrappers::PhysicalDeviceWrapper*> physicalDevice_map_;
-    std::unordered_map<VkPipeline, vulkan_wrappers::PipelineWrapper*> pipeline_map_;
-    std::unordered_map<VkPipelineCache, vulkan_wrappers::PipelineCacheWrapper*> pipelineCache_map_;
-    std::unordered_map<VkPipelineLayout, vulkan_wrappers::PipelineLayoutWrapper*> pipelineLayout_map_;
-    std::unordered_map<VkPrivateDataSlot, vulkan_wrappers::PrivateDataSlotWrapper*> privateDataSlot_map_;
-    std::unordered_map<VkQueryPool, vulkan_wrappers::QueryPoolWrapper*> queryPool_map_;
-    std::unordered_map<VkQueue, vulkan_wrappers::QueueWrapper*> queue_map_;
-    std::unordered_map<VkRenderPass, vulkan_wrappers::RenderPassWrapper*> renderPass_map_;
-    std::unordered_map<VkSampler, vulkan_wrappers::SamplerWrapper*> sampler_map_;
-    std::unordered_map<VkSamplerYcbcrConversion, vulkan_wrappers::SamplerYcbcrConversionWrapper*> samplerYcbcrConversion_map_;
-    std::unordered_map<VkSemaphore, vulkan_wrappers::SemaphoreWrapper*> semaphore_map_;
-    std::unordered_map<VkShaderEXT, vulkan_wrappers::ShaderEXTWrapper*> shaderEXT_map_;
-    std::unordered_map<VkShaderModule, vulkan_wrappers::ShaderModuleWrapper*> shaderModule_map_;
-    std::unordered_map<VkSurfaceKHR, vulkan_wrappers::SurfaceKHRWrapper*> surfaceKHR_map_;
-    std::unordered_map<VkSwapchainKHR, vulkan_wrappers::SwapchainKHRWrapper*> swapchainKHR_map_;
-    std::unordered_map<VkValidationCacheEXT, vulkan_wrappers::ValidationCacheEXTWrapper*> validationCacheEXT_map_;
-    std::unordered_map<VkVideoSessionKHR, vulkan_wrappers::VideoSessionKHRWrapper*> videoSessionKHR_map_;
-    std::unordered_map<VkVideoSessionParametersKHR, vulkan_wrappers::VideoSessionParametersKHRWrapper*> videoSessionParametersKHR_map_;
+    util::ShardedHashMap<VkAccelerationStructureKHR, vulkan_wrappers::AccelerationStructureKHRWrapper*> accelerationStructureKHR_map_;
+    util::ShardedHashMap<VkAccelerationStructureNV, vulkan_wrappers::AccelerationStructureNVWrapper*> accelerationStructureNV_map_;
+    util::ShardedHashMap<VkBuffer, vulkan_wrappers::BufferWrapper*> buffer_map_;
+    util::ShardedHashMap<VkBufferView, vulkan_wrappers::BufferViewWrapper*> bufferView_map_;
+    util::ShardedHashMap<VkCommandBuffer, vulkan_wrappers::CommandBufferWrapper*> commandBuffer_map_;
+    util::ShardedHashMap<VkCommandPool, vulkan_wrappers::CommandPoolWrapper*> commandPool_map_;
+    util::ShardedHashMap<VkDebugReportCallbackEXT, vulkan_wrappers::DebugReportCallbackEXTWrapper*> debugReportCallbackEXT_map_;
+    util::ShardedHashMap<VkDebugUtilsMessengerEXT, vulkan_wrappers::DebugUtilsMessengerEXTWrapper*> debugUtilsMessengerEXT_map_;
+    util::ShardedHashMap<VkDeferredOperationKHR, vulkan_wrappers::DeferredOperationKHRWrapper*> deferredOperationKHR_map_;
+    util::ShardedHashMap<VkDescriptorPool, vulkan_wrappers::DescriptorPoolWrapper*> descriptorPool_map_;
+    util::ShardedHashMap<VkDescriptorSet, vulkan_wrappers::DescriptorSetWrapper*> descriptorSet_map_;
+    util::ShardedHashMap<VkDescriptorSetLayout, vulkan_wrappers::DescriptorSetLayoutWrapper*> descriptorSetLayout_map_;
+    util::ShardedHashMap<VkDescriptorUpdateTemplate, vulkan_wrappers::DescriptorUpdateTemplateWrapper*> descriptorUpdateTemplate_map_;
+    util::ShardedHashMap<VkDevice, vulkan_wrappers::DeviceWrapper*> device_map_;
+    util::ShardedHashMap<VkDeviceMemory, vulkan_wrappers::DeviceMemoryWrapper*> deviceMemory_map_;
+    util::ShardedHashMap<VkDisplayKHR, vulkan_wrappers::DisplayKHRWrapper*> displayKHR_map_;
+    util::ShardedHashMap<VkDisplayModeKHR, vulkan_wrappers::DisplayModeKHRWrapper*> displayModeKHR_map_;
+    util::ShardedHashMap<VkEvent, vulkan_wrappers::EventWrapper*> event_map_;
+    util::ShardedHashMap<VkFence, vulkan_wrappers::FenceWrapper*> fence_map_;
+    util::ShardedHashMap<VkFramebuffer, vulkan_wrappers::FramebufferWrapper*> framebuffer_map_;
+    util::ShardedHashMap<VkImage, vulkan_wrappers::ImageWrapper*> image_map_;
+    util::ShardedHashMap<VkImageView, vulkan_wrappers::ImageViewWrapper*> imageView_map_;
+    util::ShardedHashMap<VkIndirectCommandsLayoutNV, vulkan_wrappers::IndirectCommandsLayoutNVWrapper*> indirectCommandsLayoutNV_map_;
+    util::ShardedHashMap<VkInstance, vulkan_wrappers::InstanceWrapper*> instance_map_;
+    util::ShardedHashMap<VkMicromapEXT, vulkan_wrappers::MicromapEXTWrapper*> micromapEXT_map_;
+    util::ShardedHashMap<VkOpticalFlowSessionNV, vulkan_wrappers::OpticalFlowSessionNVWrapper*> opticalFlowSessionNV_map_;
+    util::ShardedHashMap<VkPerformanceConfigurationINTEL, vulkan_wrappers::PerformanceConfigurationINTELWrapper*> performanceConfigurationINTEL_map_;
+    util::ShardedHashMap<VkPhysicalDevice, vulkan_wrappers::PhysicalDeviceWrapper*> physicalDevice_map_;
+    util::ShardedHashMap<VkPipeline, vulkan_wrappers::PipelineWrapper*> pipeline_map_;
+    util::ShardedHashMap<VkPipelineCache, vulkan_wrappers::PipelineCacheWrapper*> pipelineCache_map_;
+    util::ShardedHashMap<VkPipelineLayout, vulkan_wrappers::PipelineLayoutWrapper*> pipelineLayout_map_;
+    util::ShardedHashMap<VkPrivateDataSlot, vulkan_wrappers::PrivateDataSlotWrapper*> privateDataSlot_map_;
+    util::ShardedHashMap<VkQueryPool, vulkan_wrappers::QueryPoolWrapper*> queryPool_map_;
+    util::ShardedHashMap<VkQueue, vulkan_wrappers::QueueWrapper*> queue_map_;
+    util::ShardedHashMap<VkRenderPass, vulkan_wrappers::RenderPassWrapper*> renderPass_map_;
+    util::ShardedHashMap<VkSampler, vulkan_wrappers::SamplerWrapper*> sampler_map_;
+    util::ShardedHashMap<VkSamplerYcbcrConversion, vulkan_wrappers::SamplerYcbcrConversionWrapper*> samplerYcbcrConversion_map_;
+    util::ShardedHashMap<VkSemaphore, vulkan_wrappers::SemaphoreWrapper*> semaphore_map_;
+    util::ShardedHashMap<VkShaderEXT, vulkan_wrappers::ShaderEXTWrapper*> shaderEXT_map_;
+    util::ShardedHashMap<VkShaderModule, vulkan_wrappers::ShaderModuleWrapper*> shaderModule_map_;
+    util::ShardedHashMap<VkSurfaceKHR, vulkan_wrappers::SurfaceKHRWrapper*> surfaceKHR_map_;
+    util::ShardedHashMap<VkSwapchainKHR, vulkan_wrappers::SwapchainKHRWrapper*> swapchainKHR_map_;
+    util::ShardedHashMap<VkValidationCacheEXT, vulkan_wrappers::ValidationCacheEXTWrapper*> validationCacheEXT_map_;
+    util::ShardedHashMap<VkVideoSessionKHR, vulkan_wrappers::VideoSessionKHRWrapper*> videoSessionKHR_map_;
+    util::ShardedHashMap<VkVideoSessionParametersKHR, vulkan_wrappers::VideoSessionParametersKHRWrapper*> videoSessionParametersKHR_map_;
 };
 
 template<> inline const vulkan_wrappers::AccelerationStructureKHRWrapper* VulkanStateHandleTable::GetWrapper<vulkan_wrappers::AccelerationStructureKHRWrapper>(VkAccelerationStructureKHR handle) const { return VulkanStateTableBase::GetWrapper(handle, accelerationStructureKHR_map_); }
@@ -143,24 +143,29 @@ class DecodePNextStructGenerator(BaseGenerator):
             file=self.outFile
         )
         write('            {', file=self.outFile)
+        write('                uint64_t address = 0;', file=self.outFile)
         write(
-            '                stype_offset += sizeof(format::AddressEncodeType);',
+            '                stype_offset += ValueDecoder::DecodeAddress((parameter_buffer + stype_offset), (buffer_size - stype_offset), &address);',
             file=self.outFile
         )
         write('            }', file=self.outFile)
         write('        }', file=self.outFile)
         self.newline()
         write(
-            '        if ((stype_offset != 0) && ((buffer_size - stype_offset) >= sizeof(VkStructureType)))',
+            '        // The sType and address sizes depend on the parameter encoding of the capture file.',
             file=self.outFile
         )
-        write('        {', file=self.outFile)
         write(
-            '            const VkStructureType* sType = reinterpret_cast<const VkStructureType*>(parameter_buffer + stype_offset);',
+            '        VkStructureType sType = VK_STRUCTURE_TYPE_APPLICATION_INFO;',
             file=self.outFile
         )
         self.newline()
-        write('            switch (*sType)', file=self.outFile)
+        write(
+            '        if ((stype_offset != 0) && (ValueDecoder::DecodeEnumValue((parameter_buffer + stype_offset), (buffer_size - stype_offset), &sType) != 0))',
+            file=self.outFile
+        )
+        write('        {', file=self.outFile)
+        write('            switch (sType)', file=self.outFile)
         write('            {', file=self.outFile)
         write('            default:', file=self.outFile)
         write(
@@ -168,7 +173,7 @@ class DecodePNextStructGenerator(BaseGenerator):
             file=self.outFile
         )
         write(
-            '                GFXRECON_LOG_ERROR("Failed to decode pNext value with unrecognized VkStructureType = %s", (util::ToString(*sType).c_str()));',
+            '                GFXRECON_LOG_ERROR("Failed to decode pNext value with unrecognized VkStructureType = %s", (util::ToString(sType).c_str()));',
             file=self.outFile
         )
         write('                break;', file=self.outFile)
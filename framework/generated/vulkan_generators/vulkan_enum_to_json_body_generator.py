@@ -94,6 +94,7 @@ class VulkanEnumToJsonBodyGenerator(BaseGenerator):
             GFXRECON_BEGIN_NAMESPACE(decode)
 
             using util::JsonOptions;
+            using util::JsonStreamWriter;
             using util::to_hex_fixed_width;
 
             template<typename TFlags, typename ToStringFunctionType>
@@ -174,24 +175,24 @@ class VulkanEnumToJsonBodyGenerator(BaseGenerator):
                 bitwidth = 'VkFlags'
 
                 if enum in self.enumType and self.enumType[enum] == 'VkFlags64':
-                    body = 'void FieldToJson({0}_t, nlohmann::ordered_json& jdata, const {0}& value, const JsonOptions& options)\n'
+                    body = 'void FieldToJson({0}_t, JsonStreamWriter& writer, const {0}& value, const JsonOptions& options)\n'
                 else:
-                    body = 'void FieldToJson(nlohmann::ordered_json& jdata, const {0}& value, const JsonOptions& options)\n'
+                    body = 'void FieldToJson(JsonStreamWriter& writer, const {0}& value, const JsonOptions& options)\n'
                 body += '{{\n'
                 if len(self.enumEnumerants[enum]):
                     body += '    switch (value) {{\n'
                     for enumerant in self.enumEnumerants[enum]:
                         body += textwrap.indent(prefix='        ', text=textwrap.dedent('''\
                         case {0}:
-                            jdata = "{0}";
+                            writer.String("{0}");
                             break;
                         '''.format(enumerant)))
                     body += '        default:\n'
-                    body += '            jdata = to_hex_fixed_width(value);\n'
+                    body += '            writer.String(to_hex_fixed_width(value));\n'
                     body += '            break;\n'
                     body += '    }}\n'
                 else:
-                    body += '    jdata = to_hex_fixed_width(value);\n'
+                    body += '    writer.String(to_hex_fixed_width(value));\n'
 
                 body += '}}\n'
                 body = body.format(enum, bitwidth)
@@ -201,15 +202,15 @@ class VulkanEnumToJsonBodyGenerator(BaseGenerator):
             bittype = None
             if enum in self.flagEnumBitsType:
                 bittype = self.flagEnumBitsType[enum]
-            body = 'void FieldToJson({0}_t, nlohmann::ordered_json& jdata, const {1} flags, const JsonOptions& options)\n'
+            body = 'void FieldToJson({0}_t, JsonStreamWriter& writer, const {1} flags, const JsonOptions& options)\n'
             body += '{{\n'
             if bittype is not None and bittype in self.enum_names and len(self.enumEnumerants[bittype]):
                 body += "    if (!options.expand_flags)\n"
                 body += "    {{\n"
-                body += "        jdata = to_hex_fixed_width(flags);\n"
+                body += "        writer.String(to_hex_fixed_width(flags));\n"
                 body += "        return;\n"
                 body += "    }}\n"
-                body += "    jdata = ExpandFlags(flags, []({1} flags)\n"
+                body += "    writer.String(ExpandFlags(flags, []({1} flags)\n"
                 body += "    {{\n"
                 body += '        switch (flags)\n'
                 body += '        {{\n'
@@ -220,9 +221,9 @@ class VulkanEnumToJsonBodyGenerator(BaseGenerator):
                     '''.format(enumerant)))
                 body += '        }}\n'
                 body += '        return to_hex_fixed_width(flags);\n'
-                body += '    }});\n'
+                body += '    }}));\n'
             else:
-                body += '    jdata = to_hex_fixed_width(flags);\n'
+                body += '    writer.String(to_hex_fixed_width(flags));\n'
 
             body += '}}\n'
             write(body.format(enum, self.flags_types[enum]), file=self.outFile)
@@ -108,6 +108,7 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
             GFXRECON_BEGIN_NAMESPACE(gfxrecon)
             GFXRECON_BEGIN_NAMESPACE(decode)
             using util::JsonOptions;
+            using util::JsonStreamWriter;
             using util::to_hex_variable_width;
             using util::uuid_to_string;
         ''')
@@ -119,7 +120,7 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
     # yapf: disable
     def endFile(self):
         body = '''
-            void FieldToJson(nlohmann::ordered_json& jdata, const PNextNode* data, const JsonOptions& options)
+            void FieldToJson(JsonStreamWriter& writer, const PNextNode* data, const JsonOptions& options)
             {
                 if (data && data->GetPointer())
                 {
@@ -131,9 +132,14 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
                         default:
                         {
                             GFXRECON_LOG_WARNING("Unknown pnext node type: %u.", (unsigned) s_type);
+                            writer.Null();
                         }
                     }
                 }
+                else
+                {
+                    writer.Null();
+                }
             }
 
             GFXRECON_END_NAMESPACE(decode)
@@ -161,16 +167,22 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
         for struct in self.get_filtered_struct_names():
             if not struct in self.customImplementationRequired:
                 body = '''
-                    void FieldToJson(nlohmann::ordered_json& jdata, const Decoded_{0}* data, const JsonOptions& options)
+                    void FieldToJson(JsonStreamWriter& writer, const Decoded_{0}* data, const JsonOptions& options)
                     {{
                         if (data && data->decoded_value)
                         {{
                             const {0}& decoded_value = *data->decoded_value;
                             const Decoded_{0}& meta_struct = *data;
 
+                            writer.BeginObject();
                     '''.format(struct)
                 body += self.makeStructBody(struct, self.feature_struct_members[struct])
                 body += remove_leading_empty_lines('''
+                            writer.EndObject();
+                        }
+                        else
+                        {
+                            writer.Null();
                         }
                     }
                     ''')
@@ -194,52 +206,52 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
                 continue
 
             # Default to getting the data from the native Vulkan struct:
-            to_json = 'FieldToJson(jdata["{0}"], decoded_value.{0}, options)'
+            to_json = 'FieldToJson(writer.Key("{0}"), decoded_value.{0}, options)'
 
             if 'pfn' in value.name or 'pUserData' in value.name:
-                to_json = 'FieldToJson(jdata["{0}"], to_hex_variable_width(meta_struct.{0}), options)'
+                to_json = 'FieldToJson(writer.Key("{0}"), to_hex_variable_width(meta_struct.{0}), options)'
             elif value.is_pointer:
                 if 'String' in type_name:
-                    to_json = 'FieldToJson(jdata["{0}"], &meta_struct.{0}, options)'
+                    to_json = 'FieldToJson(writer.Key("{0}"), &meta_struct.{0}, options)'
                 elif self.is_handle(value.base_type):
-                    to_json = 'HandleToJson(jdata["{0}"], &meta_struct.{0}, options)'
+                    to_json = 'HandleToJson(writer.Key("{0}"), &meta_struct.{0}, options)'
                 else:
-                    to_json = 'FieldToJson(jdata["{0}"], meta_struct.{0}, options)'
+                    to_json = 'FieldToJson(writer.Key("{0}"), meta_struct.{0}, options)'
             else:
                 if value.is_array:
                     if 'UUID' in value.array_length or 'LUID' in value.array_length:
-                        to_json = 'FieldToJson(jdata["{0}"], uuid_to_string(sizeof(decoded_value.{0}), decoded_value.{0}), options)'
+                        to_json = 'FieldToJson(writer.Key("{0}"), uuid_to_string(sizeof(decoded_value.{0}), decoded_value.{0}), options)'
                     elif 'String' in type_name:
-                        to_json = 'FieldToJson(jdata["{0}"], &meta_struct.{0}, options)'
+                        to_json = 'FieldToJson(writer.Key("{0}"), &meta_struct.{0}, options)'
                     elif self.is_handle(value.base_type):
-                        to_json = 'HandleToJson(jdata["{0}"], &meta_struct.{0}, options)'
+                        to_json = 'HandleToJson(writer.Key("{0}"), &meta_struct.{0}, options)'
                     elif self.is_struct(value.base_type):
-                        to_json = 'FieldToJson(jdata["{0}"], meta_struct.{0}, options)'
+                        to_json = 'FieldToJson(writer.Key("{0}"), meta_struct.{0}, options)'
                     elif not value.is_dynamic:
-                        to_json = 'FieldToJson(jdata["{0}"], &meta_struct.{0}, options)'
+                        to_json = 'FieldToJson(writer.Key("{0}"), &meta_struct.{0}, options)'
                     else:
-                        to_json = 'FieldToJson(jdata["{0}"], meta_struct.{0}, options)'
+                        to_json = 'FieldToJson(writer.Key("{0}"), meta_struct.{0}, options)'
                 else:
                     if (self.is_handle(value.base_type) or value.name in self.formatAsHandle) and not (name in self.notDecoded):
-                        to_json = 'HandleToJson(jdata["{0}"], meta_struct.{0}, options)'
+                        to_json = 'HandleToJson(writer.Key("{0}"), meta_struct.{0}, options)'
                     elif value.base_type in self.formatAsHex:
-                        to_json = 'FieldToJson(jdata["{0}"], to_hex_variable_width(decoded_value.{0}), options)'
+                        to_json = 'FieldToJson(writer.Key("{0}"), to_hex_variable_width(decoded_value.{0}), options)'
                     elif self.is_struct(value.base_type):
-                        to_json = 'FieldToJson(jdata["{0}"], meta_struct.{0}, options)'
+                        to_json = 'FieldToJson(writer.Key("{0}"), meta_struct.{0}, options)'
                     elif self.is_flags(value.base_type):
                         if value.base_type in self.flagsTypeAlias:
                             flagsEnumType = self.flagsTypeAlias[value.base_type]
-                        to_json = 'FieldToJson({2}_t(),jdata["{0}"], decoded_value.{0}, options)'
+                        to_json = 'FieldToJson({2}_t(), writer.Key("{0}"), decoded_value.{0}, options)'
                     elif self.is_enum(value.base_type):
-                        to_json = 'FieldToJson(jdata["{0}"], decoded_value.{0}, options)'
+                        to_json = 'FieldToJson(writer.Key("{0}"), decoded_value.{0}, options)'
                     elif 'VkBool32' == value.base_type:
-                        to_json = 'jdata["{0}"] = static_cast<bool>(decoded_value.{0})'
+                        to_json = 'writer.Key("{0}").Bool(static_cast<bool>(decoded_value.{0}))'
 
             to_json = to_json.format(value.name, value.base_type, flagsEnumType)
             body += '        {0};\n'.format(to_json)
         # Save pnext as last member
         if has_pnext:
-            body += '        FieldToJson(jdata["pNext"], meta_struct.pNext, options);\n'
+            body += '        FieldToJson(writer.Key("pNext"), meta_struct.pNext, options);\n'
 
         return body
     # yapf: enable
@@ -273,7 +285,7 @@ class VulkanStructToJsonBodyGenerator(BaseGenerator):
             case {1}:
             {{
                const auto* pnext = reinterpret_cast<const Decoded_{0}*>(data->GetMetaStructPointer());
-               FieldToJson(jdata, pnext, options);
+               FieldToJson(writer, pnext, options);
                break;
             }}
             '''.format(struct, self.pnext_extension_structs[struct])
@@ -46,10 +46,44 @@ class Compressor
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) = 0;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) = 0;
+    // uncompressed_data must already be large enough to hold expected_uncompressed_size bytes.
+    virtual size_t Decompress(const size_t          compressed_size,
+                              const uint8_t*        compressed_data,
+                              const size_t          expected_uncompressed_size,
+                              std::vector<uint8_t>* uncompressed_data) = 0;
+
+    size_t Decompress(const size_t                compressed_size,
+                      const std::vector<uint8_t>& compressed_data,
+                      const size_t                expected_uncompressed_size,
+                      std::vector<uint8_t>*       uncompressed_data)
+    {
+        return Decompress(compressed_size, compressed_data.data(), expected_uncompressed_size, uncompressed_data);
+    }
+
+    // Returns false if the compression type does not support dictionaries.
+    virtual bool SupportsDictionary() const { return false; }
+
+    // Builds a dictionary of at most max_dictionary_size bytes from the concatenated samples.  Returns an empty
+    // dictionary if training failed or is not supported.
+    virtual std::vector<uint8_t> TrainDictionary(const std::vector<uint8_t>& samples,
+                                                 const std::vector<size_t>&  sample_sizes,
+                                                 size_t                      max_dictionary_size)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(samples);
+        GFXRECON_UNREFERENCED_PARAMETER(sample_sizes);
+        GFXRECON_UNREFERENCED_PARAMETER(max_dictionary_size);
+        return {};
+    }
+
+    // Sets the dictionary used by all subsequent Compress and Decompress calls.  Data that was compressed with a
+    // dictionary can only be decompressed with the same dictionary.  Must not be called while other threads are using
+    // the compressor.
+    virtual bool SetDictionary(const uint8_t* dictionary_data, size_t dictionary_size)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(dictionary_data);
+        GFXRECON_UNREFERENCED_PARAMETER(dictionary_size);
+        return false;
+    }
 };
 
 GFXRECON_END_NAMESPACE(util)
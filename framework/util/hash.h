@@ -26,6 +26,8 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -61,6 +63,113 @@ Type GenerateCheckSum(const uint8_t* code, size_t code_size)
     return current_sum;
 }
 
+// Implementation of the 64-bit xxHash algorithm (XXH64).  Input is consumed in 32 byte stripes by four independent
+// accumulators, which keeps several multiplies in flight and processes several bytes per cycle.  Prefer this over
+// GenerateCheckSum for large blocks of data.
+const uint64_t kHash64Prime1 = 0x9E3779B185EBCA87ULL;
+const uint64_t kHash64Prime2 = 0xC2B2AE3D27D4EB4FULL;
+const uint64_t kHash64Prime3 = 0x165667B19E3779F9ULL;
+const uint64_t kHash64Prime4 = 0x85EBCA77C2B2AE63ULL;
+const uint64_t kHash64Prime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t Hash64RotateLeft(uint64_t value, uint32_t bits)
+{
+    return (value << bits) | (value >> (64 - bits));
+}
+
+inline uint64_t Hash64Load64(const uint8_t* data)
+{
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint32_t Hash64Load32(const uint8_t* data)
+{
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+inline uint64_t Hash64Round(uint64_t accumulator, uint64_t input)
+{
+    accumulator += input * kHash64Prime2;
+    accumulator = Hash64RotateLeft(accumulator, 31);
+    return accumulator * kHash64Prime1;
+}
+
+inline uint64_t Hash64MergeRound(uint64_t accumulator, uint64_t value)
+{
+    accumulator ^= Hash64Round(0, value);
+    return (accumulator * kHash64Prime1) + kHash64Prime4;
+}
+
+inline uint64_t GenerateHash64(const uint8_t* data, size_t data_size, uint64_t seed = 0)
+{
+    const uint8_t* end = data + data_size;
+    uint64_t       hash;
+
+    if (data_size >= 32)
+    {
+        const uint8_t* stripe_end = end - 32;
+
+        uint64_t v1 = seed + kHash64Prime1 + kHash64Prime2;
+        uint64_t v2 = seed + kHash64Prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - kHash64Prime1;
+
+        do
+        {
+            v1 = Hash64Round(v1, Hash64Load64(data));
+            v2 = Hash64Round(v2, Hash64Load64(data + 8));
+            v3 = Hash64Round(v3, Hash64Load64(data + 16));
+            v4 = Hash64Round(v4, Hash64Load64(data + 24));
+            data += 32;
+        } while (data <= stripe_end);
+
+        hash = Hash64RotateLeft(v1, 1) + Hash64RotateLeft(v2, 7) + Hash64RotateLeft(v3, 12) + Hash64RotateLeft(v4, 18);
+        hash = Hash64MergeRound(hash, v1);
+        hash = Hash64MergeRound(hash, v2);
+        hash = Hash64MergeRound(hash, v3);
+        hash = Hash64MergeRound(hash, v4);
+    }
+    else
+    {
+        hash = seed + kHash64Prime5;
+    }
+
+    hash += static_cast<uint64_t>(data_size);
+
+    while ((data + 8) <= end)
+    {
+        hash ^= Hash64Round(0, Hash64Load64(data));
+        hash = (Hash64RotateLeft(hash, 27) * kHash64Prime1) + kHash64Prime4;
+        data += 8;
+    }
+
+    if ((data + 4) <= end)
+    {
+        hash ^= static_cast<uint64_t>(Hash64Load32(data)) * kHash64Prime1;
+        hash = (Hash64RotateLeft(hash, 23) * kHash64Prime2) + kHash64Prime3;
+        data += 4;
+    }
+
+    while (data < end)
+    {
+        hash ^= static_cast<uint64_t>(*data) * kHash64Prime5;
+        hash = Hash64RotateLeft(hash, 11) * kHash64Prime1;
+        ++data;
+    }
+
+    hash ^= hash >> 33;
+    hash *= kHash64Prime2;
+    hash ^= hash >> 29;
+    hash *= kHash64Prime3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
 /**
  * @brief       hash_combine can be used to create a hash-value and combine with an existing hash-value.
  *
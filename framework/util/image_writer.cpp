@@ -26,17 +26,27 @@
 #include "platform.h"
 #include "util/logging.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <inttypes.h>
 #include <limits>
 #include <math.h>
 #include <memory>
+#include <vector>
 #if !defined(WIN32)
 #include <unistd.h>
 #endif
 
+// Row conversion is only vectorized with SSE2, which every x86-64 CPU supports, so no runtime dispatch is needed.  There
+// are no AVX2 or NEON kernels: other targets, including ARM, use the scalar conversion.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define GFXRECON_IMAGE_WRITER_SSE2
+#endif
+
 #if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION) && defined(GFXRECON_ENABLE_PNG_SCREENSHOT)
 #include <zlib.h>
 
@@ -82,9 +92,6 @@ const uint32_t kImageBpp    = 4;  // Expecting 4 bytes per pixel for 32-bit BGRA
 const uint16_t kBmpBitCountNoAlpha = 24; // Expecting 24-bit BGR bitmap data.
 const uint32_t kImageBppNoAlpha    = 3;  // Expecting 3 bytes per pixel for 32-bit BGRA bitmap data; alpha removed.
 
-static std::unique_ptr<uint8_t[]> temporary_buffer;
-static size_t                     temporary_buffer_size = 0;
-
 // This function is a copy from Renderdoc sources
 inline float ConvertFromHalf(uint16_t comp)
 {
@@ -215,6 +222,335 @@ static float Ufloat10ToFloat(uint16_t val)
     }
 }
 
+// Converts a float to an 8-bit unorm value without clamping, producing the pixels that earlier versions wrote with a
+// direct cast to uint8_t on x86: the scaled value is truncated to a 32-bit integer and its low byte is kept, and values
+// outside of the 32-bit range, including NaN and infinity, are written as 0.
+inline uint8_t UnitFloatToUnorm8(float value)
+{
+    const float scaled = value * 255.0f;
+    return ((scaled > -2147483648.0f) && (scaled < 2147483648.0f)) ? static_cast<uint8_t>(static_cast<int32_t>(scaled))
+                                                                   : 0;
+}
+
+inline void StorePixel(uint8_t* dst, uint8_t r, uint8_t g, uint8_t b, uint8_t a, bool rgba_order)
+{
+    dst[0] = rgba_order ? r : b;
+    dst[1] = g;
+    dst[2] = rgba_order ? b : r;
+    dst[3] = a;
+}
+
+template <typename T>
+inline T LoadTexel(const uint8_t* src, uint32_t index)
+{
+    T value;
+    memcpy(&value, src + (index * sizeof(T)), sizeof(T));
+    return value;
+}
+
+// Swaps the first and third bytes of each 32-bit RGBA or BGRA pixel.
+inline uint32_t SwapRedBlue(uint32_t pixel)
+{
+    return (pixel & 0xFF00FF00) | ((pixel >> 16) & 0xFF) | ((pixel & 0xFF) << 16);
+}
+
+// Converts the texels in [begin, end) of a row, one texel at a time.  Returns false if the format is not converted by
+// row.
+static bool ConvertTexels(
+    DataFormats format, const uint8_t* src, uint32_t begin, uint32_t end, bool rgba_order, uint8_t* dst)
+{
+    switch (format)
+    {
+        case kFormat_RGBA:
+        case kFormat_BGRA:
+            if (rgba_order == (format == kFormat_RGBA))
+            {
+                memcpy(dst + (begin * 4), src + (begin * 4), (end - begin) * 4);
+            }
+            else
+            {
+                for (uint32_t x = begin; x < end; ++x)
+                {
+                    const uint32_t pixel = SwapRedBlue(LoadTexel<uint32_t>(src, x));
+                    memcpy(dst + (x * 4), &pixel, sizeof(pixel));
+                }
+            }
+            break;
+
+        case kFormat_B10G11R11_UFLOAT:
+            for (uint32_t x = begin; x < end; ++x)
+            {
+                const uint32_t texel = LoadTexel<uint32_t>(src, x);
+                const float    b     = Ufloat10ToFloat(static_cast<uint16_t>((texel & 0xFFC00000) >> 22));
+                const float    g     = Ufloat11ToFloat(static_cast<uint16_t>((texel & 0x003FF800) >> 11));
+                const float    r     = Ufloat11ToFloat(static_cast<uint16_t>((texel & 0x000007FF) >> 0));
+
+                StorePixel(dst + (x * 4),
+                           UnitFloatToUnorm8(std::min(r, 1.0f)),
+                           UnitFloatToUnorm8(std::min(g, 1.0f)),
+                           UnitFloatToUnorm8(std::min(b, 1.0f)),
+                           0xff,
+                           rgba_order);
+            }
+            break;
+
+        case kFormat_A2B10G10R10:
+            for (uint32_t x = begin; x < end; ++x)
+            {
+                // The 10-bit color components are truncated to their low 8 bits before they are scaled, as in
+                // earlier versions.
+                const uint32_t texel = LoadTexel<uint32_t>(src, x);
+                const uint8_t  a     = static_cast<uint8_t>((texel & 0xC0000000) >> 30);
+                const uint8_t  b     = static_cast<uint8_t>((texel & 0x3FF00000) >> 20);
+                const uint8_t  g     = static_cast<uint8_t>((texel & 0x000FFC00) >> 10);
+                const uint8_t  r     = static_cast<uint8_t>((texel & 0x000003FF) >> 0);
+
+                StorePixel(dst + (x * 4),
+                           static_cast<uint8_t>(static_cast<float>(r) / 1023.0f * 255.0f),
+                           static_cast<uint8_t>(static_cast<float>(g) / 1023.0f * 255.0f),
+                           static_cast<uint8_t>(static_cast<float>(b) / 1023.0f * 255.0f),
+                           static_cast<uint8_t>(static_cast<float>(a) / 3.0f * 255.0f),
+                           rgba_order);
+            }
+            break;
+
+        case kFormat_R16G16B16A16_SFLOAT:
+            for (uint32_t x = begin; x < end; ++x)
+            {
+                const uint64_t texel = LoadTexel<uint64_t>(src, x);
+                const float    a     = ConvertFromHalf(static_cast<uint16_t>((texel & 0xFFFF000000000000ULL) >> 48));
+                const float    b     = ConvertFromHalf(static_cast<uint16_t>((texel & 0x0000FFFF00000000ULL) >> 32));
+                const float    g     = ConvertFromHalf(static_cast<uint16_t>((texel & 0x00000000FFFF0000ULL) >> 16));
+                const float    r     = ConvertFromHalf(static_cast<uint16_t>((texel & 0x000000000000FFFFULL) >> 0));
+
+                StorePixel(dst + (x * 4),
+                           UnitFloatToUnorm8(r),
+                           UnitFloatToUnorm8(g),
+                           UnitFloatToUnorm8(b),
+                           UnitFloatToUnorm8(a),
+                           rgba_order);
+            }
+            break;
+
+        case kFormat_D32_FLOAT:
+            for (uint32_t x = begin; x < end; ++x)
+            {
+                const uint8_t depth = UnitFloatToUnorm8(LoadTexel<float>(src, x));
+                StorePixel(dst + (x * 4), depth, depth, depth, 0xff, rgba_order);
+            }
+            break;
+
+        case kFormat_D24_UNORM:
+            for (uint32_t x = begin; x < end; ++x)
+            {
+                const uint32_t normalized_depth = LoadTexel<uint32_t>(src, x) & 0x00FFFFFF;
+                const float    float_depth      = static_cast<float>(normalized_depth) / 8388607.0f;
+                const uint8_t  depth            = UnitFloatToUnorm8(float_depth);
+                StorePixel(dst + (x * 4), depth, depth, depth, 0xff, rgba_order);
+            }
+            break;
+
+        case kFormat_D16_UNORM:
+            for (uint32_t x = begin; x < end; ++x)
+            {
+                const uint16_t normalized_depth = LoadTexel<uint16_t>(src, x);
+                const float    float_depth      = static_cast<float>(normalized_depth) / 32767.0f;
+                const uint8_t  depth            = UnitFloatToUnorm8(float_depth);
+                StorePixel(dst + (x * 4), depth, depth, depth, 0xff, rgba_order);
+            }
+            break;
+
+        default:
+            return false;
+    }
+
+    return true;
+}
+
+// The vector kernels perform the same float operations as ConvertTexels, so that their output is identical.  Small
+// floats (half, and the unsigned 11 and 10 bit floats) are converted by shifting their exponent and mantissa bits to
+// the float bit positions and multiplying by 2^112 to rebias the exponent, which also converts denormals exactly.
+const uint32_t kSmallFloatInfBits = 0x7C00 << 13;   // Half infinity shifted to the float bit positions.
+const uint32_t kSmallFloatRebias  = (127 + 112) << 23; // 2^112
+
+#if defined(GFXRECON_IMAGE_WRITER_SSE2)
+
+// Converts to 8-bit unorm values in 32-bit lanes.  CVTTPS2DQ returns 0x80000000 for values outside of the 32-bit range
+// and NaN, so keeping the low byte matches the scalar conversion.
+static __m128i UnitFloatToUnorm8(__m128 value)
+{
+    const __m128i scaled = _mm_cvttps_epi32(_mm_mul_ps(value, _mm_set1_ps(255.0f)));
+    return _mm_and_si128(scaled, _mm_set1_epi32(0xFF));
+}
+
+static __m128 SmallFloatBitsToFloat(__m128i bits)
+{
+    const __m128i nan   = _mm_cmpgt_epi32(bits, _mm_set1_epi32(kSmallFloatInfBits));
+    const __m128  value = _mm_mul_ps(_mm_castsi128_ps(bits), _mm_castsi128_ps(_mm_set1_epi32(kSmallFloatRebias)));
+    return _mm_andnot_ps(_mm_castsi128_ps(nan), value);
+}
+
+// Converts halfs in 32-bit lanes.  NaN is converted to a signed zero, which is converted to 0 like the scalar NaN.
+static __m128 HalfToFloat(__m128i half)
+{
+    const __m128i sign  = _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x8000)), 16);
+    const __m128  value = SmallFloatBitsToFloat(_mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x7FFF)), 13));
+    return _mm_or_ps(value, _mm_castsi128_ps(sign));
+}
+
+static __m128i UnormToUnorm8(__m128i value, float max_value)
+{
+    return UnitFloatToUnorm8(_mm_div_ps(_mm_cvtepi32_ps(value), _mm_set1_ps(max_value)));
+}
+
+static void StorePixels(uint8_t* dst, __m128i r, __m128i g, __m128i b, __m128i a, bool rgba_order)
+{
+    const __m128i first  = rgba_order ? r : b;
+    const __m128i third  = rgba_order ? b : r;
+    const __m128i pixels = _mm_or_si128(_mm_or_si128(first, _mm_slli_epi32(g, 8)),
+                                        _mm_or_si128(_mm_slli_epi32(third, 16), _mm_slli_epi32(a, 24)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), pixels);
+}
+
+// Converts the leading texels of a row, four at a time.  Returns the number of texels converted, which is a multiple
+// of four.
+static uint32_t
+ConvertVectorTexels(DataFormats format, const uint8_t* src, uint32_t count, bool rgba_order, uint8_t* dst)
+{
+    const uint32_t vector_count = count & ~3u;
+    const __m128i  opaque       = _mm_set1_epi32(0xFF);
+
+    switch (format)
+    {
+        case kFormat_RGBA:
+        case kFormat_BGRA:
+            if (rgba_order == (format == kFormat_RGBA))
+            {
+                // ConvertTexels copies the row.
+                return 0;
+            }
+
+            for (uint32_t x = 0; x < vector_count; x += 4)
+            {
+                const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (x * 4)));
+                const __m128i red_blue =
+                    _mm_or_si128(_mm_and_si128(_mm_srli_epi32(pixels, 16), opaque),
+                                 _mm_slli_epi32(_mm_and_si128(pixels, opaque), 16));
+                const __m128i swapped = _mm_or_si128(_mm_and_si128(pixels, _mm_set1_epi32(0xFF00FF00)), red_blue);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + (x * 4)), swapped);
+            }
+            break;
+
+        case kFormat_B10G11R11_UFLOAT:
+            for (uint32_t x = 0; x < vector_count; x += 4)
+            {
+                const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (x * 4)));
+                const __m128i mask11 = _mm_set1_epi32(0x7FF);
+                const __m128i r      = _mm_slli_epi32(_mm_and_si128(texels, mask11), 17);
+                const __m128i g      = _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(texels, 11), mask11), 17);
+                const __m128i b      = _mm_slli_epi32(_mm_srli_epi32(texels, 22), 18);
+                const __m128  one    = _mm_set1_ps(1.0f);
+
+                StorePixels(dst + (x * 4),
+                            UnitFloatToUnorm8(_mm_min_ps(SmallFloatBitsToFloat(r), one)),
+                            UnitFloatToUnorm8(_mm_min_ps(SmallFloatBitsToFloat(g), one)),
+                            UnitFloatToUnorm8(_mm_min_ps(SmallFloatBitsToFloat(b), one)),
+                            opaque,
+                            rgba_order);
+            }
+            break;
+
+        case kFormat_A2B10G10R10:
+            for (uint32_t x = 0; x < vector_count; x += 4)
+            {
+                // Like ConvertTexels, keep the low 8 bits of the 10-bit color components.
+                const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (x * 4)));
+                const __m128i mask8  = _mm_set1_epi32(0xFF);
+
+                StorePixels(dst + (x * 4),
+                            UnormToUnorm8(_mm_and_si128(texels, mask8), 1023.0f),
+                            UnormToUnorm8(_mm_and_si128(_mm_srli_epi32(texels, 10), mask8), 1023.0f),
+                            UnormToUnorm8(_mm_and_si128(_mm_srli_epi32(texels, 20), mask8), 1023.0f),
+                            UnormToUnorm8(_mm_srli_epi32(texels, 30), 3.0f),
+                            rgba_order);
+            }
+            break;
+
+        case kFormat_R16G16B16A16_SFLOAT:
+            for (uint32_t x = 0; x < vector_count; x += 4)
+            {
+                // Deinterleave the components of four texels, then widen them to 32-bit lanes.
+                const __m128i texels01 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (x * 8)));
+                const __m128i texels23 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (x * 8) + 16));
+                const __m128i lo       = _mm_unpacklo_epi16(texels01, texels23);
+                const __m128i hi       = _mm_unpackhi_epi16(texels01, texels23);
+                const __m128i rg       = _mm_unpacklo_epi16(lo, hi);
+                const __m128i ba       = _mm_unpackhi_epi16(lo, hi);
+                const __m128i zero     = _mm_setzero_si128();
+
+                StorePixels(dst + (x * 4),
+                            UnitFloatToUnorm8(HalfToFloat(_mm_unpacklo_epi16(rg, zero))),
+                            UnitFloatToUnorm8(HalfToFloat(_mm_unpackhi_epi16(rg, zero))),
+                            UnitFloatToUnorm8(HalfToFloat(_mm_unpacklo_epi16(ba, zero))),
+                            UnitFloatToUnorm8(HalfToFloat(_mm_unpackhi_epi16(ba, zero))),
+                            rgba_order);
+            }
+            break;
+
+        case kFormat_D32_FLOAT:
+            for (uint32_t x = 0; x < vector_count; x += 4)
+            {
+                const __m128i depth = UnitFloatToUnorm8(_mm_loadu_ps(reinterpret_cast<const float*>(src + (x * 4))));
+                StorePixels(dst + (x * 4), depth, depth, depth, opaque, rgba_order);
+            }
+            break;
+
+        case kFormat_D24_UNORM:
+            for (uint32_t x = 0; x < vector_count; x += 4)
+            {
+                const __m128i texels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (x * 4)));
+                const __m128i depth  = UnormToUnorm8(_mm_and_si128(texels, _mm_set1_epi32(0x00FFFFFF)), 8388607.0f);
+                StorePixels(dst + (x * 4), depth, depth, depth, opaque, rgba_order);
+            }
+            break;
+
+        case kFormat_D16_UNORM:
+            for (uint32_t x = 0; x < vector_count; x += 4)
+            {
+                const __m128i texels = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + (x * 2)));
+                const __m128i depth  = UnormToUnorm8(_mm_unpacklo_epi16(texels, _mm_setzero_si128()), 32767.0f);
+                StorePixels(dst + (x * 4), depth, depth, depth, opaque, rgba_order);
+            }
+            break;
+
+        default:
+            return 0;
+    }
+
+    return vector_count;
+}
+
+#else
+
+static uint32_t ConvertVectorTexels(DataFormats, const uint8_t*, uint32_t, bool, uint8_t*)
+{
+    return 0;
+}
+
+#endif
+
+bool ConvertRow(DataFormats format, const void* src, uint32_t count, bool rgba_order, uint8_t* dst)
+{
+    const uint8_t* bytes     = reinterpret_cast<const uint8_t*>(src);
+    const uint32_t converted = ConvertVectorTexels(format, bytes, count, rgba_order, dst);
+    return ConvertTexels(format, bytes, converted, count, rgba_order, dst);
+}
+
+bool ConvertRowScalar(DataFormats format, const void* src, uint32_t count, bool rgba_order, uint8_t* dst)
+{
+    return ConvertTexels(format, reinterpret_cast<const uint8_t*>(src), 0, count, rgba_order, dst);
+}
+
 #define CheckFwriteRetVal(_val_, _file_)                                                              \
     {                                                                                                 \
         if (!_val_)                                                                                   \
@@ -236,8 +572,9 @@ static const uint8_t* ConvertIntoTemporaryBuffer(uint32_t    width,
 {
     assert(data_pitch);
 
-    static std::unique_ptr<uint8_t[]> temporary_buffer;
-    static size_t                     temporary_buffer_size = 0;
+    // Images may be written from multiple threads, so each thread converts into its own buffer.
+    static thread_local std::unique_ptr<uint8_t[]> temporary_buffer;
+    static thread_local size_t                     temporary_buffer_size = 0;
 
     uint32_t output_pitch = width * (write_alpha ? kImageBpp : kImageBppNoAlpha);
     if (!is_png)
@@ -319,44 +656,6 @@ static const uint8_t* ConvertIntoTemporaryBuffer(uint32_t    width,
         }
         break;
 
-        case kFormat_RGBA:
-        {
-            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
-
-            for (uint32_t y = 0; y < height; ++y)
-            {
-                for (uint32_t x = 0; x < width; ++x)
-                {
-                    const uint8_t r = bytes[(4 * x) + 0];
-                    const uint8_t g = bytes[(4 * x) + 1];
-                    const uint8_t b = bytes[(4 * x) + 2];
-                    const uint8_t a = bytes[(4 * x) + 3];
-
-                    if (is_png)
-                    {
-                        *(temp_buffer++) = r;
-                        *(temp_buffer++) = g;
-                        *(temp_buffer++) = b;
-                    }
-                    else
-                    {
-                        *(temp_buffer++) = b;
-                        *(temp_buffer++) = g;
-                        *(temp_buffer++) = r;
-                    }
-
-                    if (write_alpha)
-                    {
-                        *(temp_buffer++) = a;
-                    }
-                }
-
-                bytes += data_pitch;
-                temp_buffer = reinterpret_cast<uint8_t*>(temporary_buffer.get()) + (y + 1) * output_pitch;
-            }
-        }
-        break;
-
         case kFormat_BGR:
         {
             const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
@@ -394,256 +693,43 @@ static const uint8_t* ConvertIntoTemporaryBuffer(uint32_t    width,
         }
         break;
 
+        case kFormat_RGBA:
         case kFormat_BGRA:
-        {
-            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
-
-            for (uint32_t y = 0; y < height; ++y)
-            {
-                for (uint32_t x = 0; x < width; ++x)
-                {
-                    const uint8_t b = bytes[(4 * x) + 0];
-                    const uint8_t g = bytes[(4 * x) + 1];
-                    const uint8_t r = bytes[(4 * x) + 2];
-                    const uint8_t a = bytes[(4 * x) + 3];
-
-                    if (is_png)
-                    {
-                        *(temp_buffer++) = r;
-                        *(temp_buffer++) = g;
-                        *(temp_buffer++) = b;
-                    }
-                    else
-                    {
-                        *(temp_buffer++) = b;
-                        *(temp_buffer++) = g;
-                        *(temp_buffer++) = r;
-                    }
-
-                    if (write_alpha)
-                    {
-                        *(temp_buffer++) = a;
-                    }
-                }
-
-                bytes += data_pitch;
-                temp_buffer = reinterpret_cast<uint8_t*>(temporary_buffer.get()) + (y + 1) * output_pitch;
-            }
-        }
-        break;
-
         case kFormat_B10G11R11_UFLOAT:
-        {
-            const uint32_t* u32_vals = reinterpret_cast<const uint32_t*>(data);
-
-            for (uint32_t y = 0; y < height; ++y)
-            {
-                for (uint32_t x = 0; x < width; ++x)
-                {
-                    // clang-format off
-                    const float b = Ufloat10ToFloat(static_cast<uint16_t>((u32_vals[x] & (0xFFC00000)) >> 22));
-                    const float g = Ufloat11ToFloat(static_cast<uint16_t>((u32_vals[x] & (0x003FF800)) >> 11));
-                    const float r = Ufloat11ToFloat(static_cast<uint16_t>((u32_vals[x] & (0x000007FF)) >> 0));
-                    // clang-format on
-
-                    const uint8_t b_u8 = static_cast<uint8_t>(std::min(b, 1.0f) * 255.0f);
-                    const uint8_t g_u8 = static_cast<uint8_t>(std::min(g, 1.0f) * 255.0f);
-                    const uint8_t r_u8 = static_cast<uint8_t>(std::min(r, 1.0f) * 255.0f);
-
-                    if (is_png)
-                    {
-                        *(temp_buffer++) = r_u8;
-                        *(temp_buffer++) = g_u8;
-                        *(temp_buffer++) = b_u8;
-                    }
-                    else
-                    {
-                        *(temp_buffer++) = b_u8;
-                        *(temp_buffer++) = g_u8;
-                        *(temp_buffer++) = r_u8;
-                    }
-
-                    if (write_alpha)
-                    {
-                        *(temp_buffer++) = 0xff;
-                    }
-                }
-
-                u32_vals = reinterpret_cast<const uint32_t*>(reinterpret_cast<const uint8_t*>(u32_vals) + data_pitch);
-                temp_buffer = reinterpret_cast<uint8_t*>(temporary_buffer.get()) + (y + 1) * output_pitch;
-            }
-        }
-        break;
-
         case kFormat_A2B10G10R10:
-        {
-            const uint32_t* u32_vals = reinterpret_cast<const uint32_t*>(data);
-
-            for (uint32_t y = 0; y < height; ++y)
-            {
-                for (uint32_t x = 0; x < width; ++x)
-                {
-                    uint8_t a = static_cast<uint8_t>((u32_vals[x] & 0xC0000000) >> 30);
-                    uint8_t b = static_cast<uint8_t>((u32_vals[x] & 0x3FF00000) >> 20);
-                    uint8_t g = static_cast<uint8_t>((u32_vals[x] & 0x000FFC00) >> 10);
-                    uint8_t r = static_cast<uint8_t>((u32_vals[x] & 0x000003FF) >> 0);
-
-                    r = static_cast<uint8_t>(static_cast<float>(r) / 1023.0f * 255.0f);
-                    g = static_cast<uint8_t>(static_cast<float>(g) / 1023.0f * 255.0f);
-                    b = static_cast<uint8_t>(static_cast<float>(b) / 1023.0f * 255.0f);
-                    a = static_cast<uint8_t>(static_cast<float>(a) / 3.0f * 255.0f);
-
-                    if (is_png)
-                    {
-                        *(temp_buffer++) = r;
-                        *(temp_buffer++) = g;
-                        *(temp_buffer++) = b;
-                    }
-                    else
-                    {
-                        *(temp_buffer++) = b;
-                        *(temp_buffer++) = g;
-                        *(temp_buffer++) = r;
-                    }
-
-                    if (write_alpha)
-                    {
-                        *(temp_buffer++) = a;
-                    }
-                }
-
-                u32_vals = reinterpret_cast<const uint32_t*>(reinterpret_cast<const uint8_t*>(u32_vals) + data_pitch);
-                temp_buffer = reinterpret_cast<uint8_t*>(temporary_buffer.get()) + (y + 1) * output_pitch;
-            }
-        }
-        break;
-
         case kFormat_R16G16B16A16_SFLOAT:
-        {
-            const uint64_t* u64_vals = reinterpret_cast<const uint64_t*>(data);
-
-            for (uint32_t y = 0; y < height; ++y)
-            {
-                for (uint32_t x = 0; x < width; ++x)
-                {
-                    uint16_t a_u16 = static_cast<uint16_t>((u64_vals[x] & 0xFFFF000000000000ULL) >> 48);
-                    uint16_t b_u16 = static_cast<uint16_t>((u64_vals[x] & 0x0000FFFF00000000ULL) >> 32);
-                    uint16_t g_u16 = static_cast<uint16_t>((u64_vals[x] & 0x00000000FFFF0000ULL) >> 16);
-                    uint16_t r_u16 = static_cast<uint16_t>((u64_vals[x] & 0x000000000000FFFFULL) >> 0);
-
-                    float r_f = ConvertFromHalf(r_u16);
-                    float g_f = ConvertFromHalf(g_u16);
-                    float b_f = ConvertFromHalf(b_u16);
-                    float a_f = ConvertFromHalf(a_u16);
-
-                    uint8_t r = static_cast<uint8_t>(r_f * 255.0f);
-                    uint8_t g = static_cast<uint8_t>(g_f * 255.0f);
-                    uint8_t b = static_cast<uint8_t>(b_f * 255.0f);
-                    uint8_t a = static_cast<uint8_t>(a_f * 255.0f);
-
-                    if (is_png)
-                    {
-                        *(temp_buffer++) = r;
-                        *(temp_buffer++) = g;
-                        *(temp_buffer++) = b;
-                    }
-                    else
-                    {
-                        *(temp_buffer++) = b;
-                        *(temp_buffer++) = g;
-                        *(temp_buffer++) = r;
-                    }
-
-                    if (write_alpha)
-                    {
-                        *(temp_buffer++) = a;
-                    }
-                }
-
-                u64_vals = reinterpret_cast<const uint64_t*>(reinterpret_cast<const uint8_t*>(u64_vals) + data_pitch);
-                temp_buffer = reinterpret_cast<uint8_t*>(temporary_buffer.get()) + (y + 1) * output_pitch;
-            }
-        }
-        break;
-
         case kFormat_D32_FLOAT:
-        {
-            const float* floats = reinterpret_cast<const float*>(data);
-
-            for (uint32_t y = 0; y < height; ++y)
-            {
-                for (uint32_t x = 0; x < width; ++x)
-                {
-                    const float   float_depth = floats[x];
-                    const uint8_t depth       = static_cast<uint8_t>(float_depth * 255.0f);
-
-                    *(temp_buffer++) = depth;
-                    *(temp_buffer++) = depth;
-                    *(temp_buffer++) = depth;
-
-                    if (write_alpha)
-                    {
-                        *(temp_buffer++) = 0xff;
-                    }
-                }
-
-                floats      = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(floats) + data_pitch);
-                temp_buffer = reinterpret_cast<uint8_t*>(temporary_buffer.get()) + (y + 1) * output_pitch;
-            }
-        }
-        break;
-
         case kFormat_D24_UNORM:
+        case kFormat_D16_UNORM:
         {
-            const uint32_t* bytes_u32 = reinterpret_cast<const uint32_t*>(data);
-
-            for (uint32_t y = 0; y < height; ++y)
-            {
-                for (uint32_t x = 0; x < width; ++x)
-                {
-                    const uint32_t normalized_depth = bytes_u32[x] & 0x00FFFFFF;
-                    const float    float_depth      = static_cast<float>(normalized_depth) / 8388607.0f;
-                    const uint8_t  depth            = static_cast<uint8_t>(float_depth * 255.0f);
+            // Rows are converted to four component pixels, directly into the output when alpha is written, or into a
+            // row buffer that the alpha component is dropped from otherwise.
+            static thread_local std::vector<uint8_t> row_buffer;
 
-                    *(temp_buffer++) = depth;
-                    *(temp_buffer++) = depth;
-                    *(temp_buffer++) = depth;
-
-                    if (write_alpha)
-                    {
-                        *(temp_buffer++) = 0xff;
-                    }
-                }
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
 
-                bytes_u32 = reinterpret_cast<const uint32_t*>(reinterpret_cast<const uint8_t*>(bytes_u32) + data_pitch);
-                temp_buffer = reinterpret_cast<uint8_t*>(temporary_buffer.get()) + (y + 1) * output_pitch;
+            if (!write_alpha)
+            {
+                row_buffer.resize(static_cast<size_t>(width) * kImageBpp);
             }
-        }
-        break;
-
-        case kFormat_D16_UNORM:
-        {
-            const uint16_t* bytes_u16 = reinterpret_cast<const uint16_t*>(data);
 
             for (uint32_t y = 0; y < height; ++y)
             {
-                for (uint32_t x = 0; x < width; ++x)
-                {
-                    const uint16_t normalized_depth = bytes_u16[x];
-                    const float    float_depth      = static_cast<float>(normalized_depth) / 32767.0f;
-                    const uint8_t  depth            = static_cast<uint8_t>(float_depth * 255.0f);
+                uint8_t* pixels = write_alpha ? temp_buffer : row_buffer.data();
 
-                    *(temp_buffer++) = depth;
-                    *(temp_buffer++) = depth;
-                    *(temp_buffer++) = depth;
+                ConvertRow(format, bytes, width, is_png, pixels);
 
-                    if (write_alpha)
+                if (!write_alpha)
+                {
+                    for (uint32_t x = 0; x < width; ++x)
                     {
-                        *(temp_buffer++) = 0xff;
+                        temp_buffer[(x * kImageBppNoAlpha) + 0] = pixels[(x * kImageBpp) + 0];
+                        temp_buffer[(x * kImageBppNoAlpha) + 1] = pixels[(x * kImageBpp) + 1];
+                        temp_buffer[(x * kImageBppNoAlpha) + 2] = pixels[(x * kImageBpp) + 2];
                     }
                 }
 
-                bytes_u16 = reinterpret_cast<const uint16_t*>(reinterpret_cast<const uint8_t*>(bytes_u16) + data_pitch);
+                bytes += data_pitch;
                 temp_buffer = reinterpret_cast<uint8_t*>(temporary_buffer.get()) + (y + 1) * output_pitch;
             }
         }
@@ -118,6 +118,15 @@ constexpr size_t DataFormatsSizes(DataFormats format)
     }
 }
 
+// Converts count texels of a row of data in the given format to 8-bit pixels with four components, in RGBA order when
+// rgba_order is true and in BGRA order otherwise.  The pixels are identical to the ones written before rows were
+// converted separately, depth is written to the color components, and formats without alpha are written with opaque
+// alpha.  Returns false for the formats that are not converted by row (R8, RGB, BGR, and ASTC).
+bool ConvertRow(DataFormats format, const void* src, uint32_t count, bool rgba_order, uint8_t* dst);
+
+// Performs the same conversion as ConvertRow without vectorization, producing identical output.
+bool ConvertRowScalar(DataFormats format, const void* src, uint32_t count, bool rgba_order, uint8_t* dst);
+
 struct AstcFileHeader
 {
     uint8_t magic[4];
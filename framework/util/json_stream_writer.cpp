@@ -0,0 +1,377 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/json_stream_writer.h"
+#include "util/logging.h"
+#include "util/output_stream.h"
+
+#include <cmath>
+#include <cstdlib>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+JsonStreamWriter::JsonStreamWriter(size_t buffer_size) :
+    os_(nullptr), buffer_size_(buffer_size), indent_width_(-1), after_key_(false)
+{
+    // Leave room for the value that crosses the threshold, so that most values are appended without reallocating.
+    buffer_.reserve(buffer_size_ + (buffer_size_ / 4));
+}
+
+JsonStreamWriter::~JsonStreamWriter()
+{
+    Flush();
+}
+
+void JsonStreamWriter::SetStream(OutputStream* os)
+{
+    Flush();
+
+    os_        = os;
+    after_key_ = false;
+    scopes_.clear();
+}
+
+void JsonStreamWriter::BeginObject()
+{
+    BeginScope('{', true);
+}
+
+void JsonStreamWriter::EndObject()
+{
+    GFXRECON_ASSERT(!scopes_.empty() && scopes_.back().is_object && !after_key_);
+    EndScope('}');
+}
+
+void JsonStreamWriter::BeginArray()
+{
+    BeginScope('[', false);
+}
+
+void JsonStreamWriter::EndArray()
+{
+    GFXRECON_ASSERT(!scopes_.empty() && !scopes_.back().is_object);
+    EndScope(']');
+}
+
+JsonStreamWriter& JsonStreamWriter::Key(std::string_view key)
+{
+    GFXRECON_ASSERT(!scopes_.empty() && scopes_.back().is_object && !after_key_);
+
+    Scope& scope = scopes_.back();
+    if (scope.count++ > 0)
+    {
+        buffer_.push_back(',');
+    }
+
+    if (indent_width_ >= 0)
+    {
+        WriteNewline(scopes_.size());
+    }
+
+    buffer_.push_back('"');
+    WriteEscaped(key);
+    buffer_.append((indent_width_ >= 0) ? "\": " : "\":");
+
+    after_key_ = true;
+
+    return *this;
+}
+
+void JsonStreamWriter::String(std::string_view value)
+{
+    BeginValue();
+    buffer_.push_back('"');
+    WriteEscaped(value);
+    buffer_.push_back('"');
+    FlushIfFull();
+}
+
+void JsonStreamWriter::Bool(bool value)
+{
+    BeginValue();
+    buffer_.append(value ? "true" : "false");
+    FlushIfFull();
+}
+
+void JsonStreamWriter::Null()
+{
+    BeginValue();
+    buffer_.append("null");
+    FlushIfFull();
+}
+
+void JsonStreamWriter::Number(double value)
+{
+    // nlohmann, which the JSON tree output used, has no representation for these.
+    if (!std::isfinite(value))
+    {
+        Null();
+        return;
+    }
+
+    BeginValue();
+
+    if (std::signbit(value))
+    {
+        buffer_.push_back('-');
+        value = -value;
+    }
+
+    if (value == 0.0)
+    {
+        buffer_.append("0.0");
+        FlushIfFull();
+        return;
+    }
+
+    // Format the shortest digits that round trip in scientific notation, d.ddde+xx, then lay them out as nlohmann does.
+    char scientific[32] = {};
+    auto result = std::to_chars(scientific, scientific + sizeof(scientific), value, std::chars_format::scientific);
+
+    *result.ptr = '\0';
+
+    char  digits[24];
+    int   num_digits = 0;
+    char* exponent   = scientific;
+    for (; *exponent != 'e'; ++exponent)
+    {
+        if (*exponent != '.')
+        {
+            digits[num_digits++] = *exponent;
+        }
+    }
+
+    // The position of the decimal point relative to the first digit.
+    const int point = std::atoi(exponent + 1) + 1;
+
+    // Numbers of up to 15 integer digits, the guaranteed precision of a double, are written in decimal notation, as are
+    // numbers down to 0.0001, while the rest use an exponent.
+    static constexpr int kMinPoint = -3;
+    static constexpr int kMaxPoint = 15;
+    if ((num_digits <= point) && (point <= kMaxPoint))
+    {
+        buffer_.append(digits, num_digits);
+        buffer_.append(point - num_digits, '0');
+        buffer_.append(".0");
+    }
+    else if ((0 < point) && (point <= kMaxPoint))
+    {
+        buffer_.append(digits, point);
+        buffer_.push_back('.');
+        buffer_.append(digits + point, num_digits - point);
+    }
+    else if ((kMinPoint <= point) && (point <= 0))
+    {
+        buffer_.append("0.");
+        buffer_.append(-point, '0');
+        buffer_.append(digits, num_digits);
+    }
+    else
+    {
+        buffer_.push_back(digits[0]);
+        if (num_digits > 1)
+        {
+            buffer_.push_back('.');
+            buffer_.append(digits + 1, num_digits - 1);
+        }
+
+        // The exponent has a sign and at least two digits.
+        int exponent_value = point - 1;
+        buffer_.append((exponent_value < 0) ? "e-" : "e+");
+        exponent_value = std::abs(exponent_value);
+        if (exponent_value < 10)
+        {
+            buffer_.push_back('0');
+        }
+        buffer_.append(std::to_string(exponent_value));
+    }
+
+    FlushIfFull();
+}
+
+void JsonStreamWriter::Value(const nlohmann::ordered_json& value)
+{
+    switch (value.type())
+    {
+        case nlohmann::ordered_json::value_t::object:
+            BeginObject();
+            for (const auto& member : value.items())
+            {
+                Key(member.key());
+                Value(member.value());
+            }
+            EndObject();
+            break;
+        case nlohmann::ordered_json::value_t::array:
+            BeginArray();
+            for (const auto& element : value)
+            {
+                Value(element);
+            }
+            EndArray();
+            break;
+        case nlohmann::ordered_json::value_t::string:
+            String(value.get_ref<const std::string&>());
+            break;
+        case nlohmann::ordered_json::value_t::boolean:
+            Bool(value.get<bool>());
+            break;
+        case nlohmann::ordered_json::value_t::number_integer:
+            Number(value.get<int64_t>());
+            break;
+        case nlohmann::ordered_json::value_t::number_unsigned:
+            Number(value.get<uint64_t>());
+            break;
+        case nlohmann::ordered_json::value_t::number_float:
+            Number(value.get<double>());
+            break;
+        default:
+            // Binary values are not used in JSON output, and null and discarded values are written as null.
+            Null();
+            break;
+    }
+}
+
+void JsonStreamWriter::Raw(std::string_view text)
+{
+    GFXRECON_ASSERT(scopes_.empty());
+    buffer_.append(text);
+}
+
+void JsonStreamWriter::Flush()
+{
+    if ((os_ != nullptr) && !buffer_.empty())
+    {
+        os_->Write(buffer_.data(), buffer_.size());
+    }
+
+    buffer_.clear();
+}
+
+void JsonStreamWriter::BeginValue()
+{
+    if (after_key_)
+    {
+        after_key_ = false;
+    }
+    else if (!scopes_.empty())
+    {
+        GFXRECON_ASSERT(!scopes_.back().is_object);
+
+        Scope& scope = scopes_.back();
+        if (scope.count++ > 0)
+        {
+            buffer_.push_back(',');
+        }
+
+        if (indent_width_ >= 0)
+        {
+            WriteNewline(scopes_.size());
+        }
+    }
+}
+
+void JsonStreamWriter::BeginScope(char open, bool is_object)
+{
+    BeginValue();
+    buffer_.push_back(open);
+    scopes_.push_back({ is_object, 0 });
+}
+
+void JsonStreamWriter::EndScope(char close)
+{
+    // Empty objects and arrays are written as {} and [], while the closing character of a non-empty scope is placed on
+    // its own line when pretty printing.
+    bool is_empty = (scopes_.back().count == 0);
+    scopes_.pop_back();
+
+    if (!is_empty && (indent_width_ >= 0))
+    {
+        WriteNewline(scopes_.size());
+    }
+
+    buffer_.push_back(close);
+    FlushIfFull();
+}
+
+void JsonStreamWriter::WriteNewline(size_t depth)
+{
+    buffer_.push_back('\n');
+    buffer_.append(depth * static_cast<size_t>(indent_width_), ' ');
+}
+
+void JsonStreamWriter::WriteEscaped(std::string_view text)
+{
+    // Matches the nlohmann serializer escaping without ensure_ascii: only the quote, the backslash, and the control
+    // characters are escaped, and UTF-8 sequences are copied unchanged.
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    size_t run_start = 0;
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        const auto c = static_cast<unsigned char>(text[i]);
+        if ((c >= 0x20) && (c != '"') && (c != '\\'))
+        {
+            continue;
+        }
+
+        buffer_.append(text.data() + run_start, i - run_start);
+        run_start = i + 1;
+
+        switch (c)
+        {
+            case '"':
+                buffer_.append("\\\"");
+                break;
+            case '\\':
+                buffer_.append("\\\\");
+                break;
+            case '\b':
+                buffer_.append("\\b");
+                break;
+            case '\f':
+                buffer_.append("\\f");
+                break;
+            case '\n':
+                buffer_.append("\\n");
+                break;
+            case '\r':
+                buffer_.append("\\r");
+                break;
+            case '\t':
+                buffer_.append("\\t");
+                break;
+            default:
+                buffer_.append("\\u00");
+                buffer_.push_back(kHexDigits[c >> 4]);
+                buffer_.push_back(kHexDigits[c & 0xf]);
+                break;
+        }
+    }
+
+    buffer_.append(text.data() + run_start, text.size() - run_start);
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
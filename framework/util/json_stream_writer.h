@@ -0,0 +1,146 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+/// @file A streaming JSON writer that emits values as they are produced instead of building an in-memory tree.
+
+#ifndef GFXRECON_UTIL_JSON_STREAM_WRITER_H
+#define GFXRECON_UTIL_JSON_STREAM_WRITER_H
+
+#include "util/defines.h"
+
+#include "nlohmann/json.hpp"
+
+#include <charconv>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+class OutputStream;
+
+/// Writes a JSON document to an OutputStream one token at a time, SAX style.  Objects and arrays are opened and closed
+/// explicitly, with Key() naming each object member before its value.  The text is accumulated in an internal buffer
+/// that is written to the stream when it fills up or when Flush() is called, so the stream sees a few large writes and
+/// is never flushed by the writer.  The output is laid out as nlohmann::ordered_json::dump() lays out the same document,
+/// with the indent width set by SetIndentWidth(), and Value() writes an existing nlohmann tree at the current position.
+class JsonStreamWriter
+{
+  public:
+    static constexpr size_t kDefaultBufferSize = 1024 * 1024;
+
+  public:
+    JsonStreamWriter(size_t buffer_size = kDefaultBufferSize);
+
+    ~JsonStreamWriter();
+
+    /// Flushes any buffered output to the current stream and starts a new document on os.
+    void SetStream(OutputStream* os);
+
+    /// A negative width selects the compact, single line format.
+    void SetIndentWidth(int indent_width) { indent_width_ = indent_width; }
+
+    void BeginObject();
+
+    void EndObject();
+
+    void BeginArray();
+
+    void EndArray();
+
+    /// @return This writer, so that the value can be written by a FieldToJson() call wrapped around the Key() call.
+    JsonStreamWriter& Key(std::string_view key);
+
+    void String(std::string_view value);
+
+    void Bool(bool value);
+
+    void Null();
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type Number(T value)
+    {
+        BeginValue();
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        buffer_.append(buffer, result.ptr);
+        FlushIfFull();
+    }
+
+    /// Writes the shortest decimal representation that reads back as value, in the notation that nlohmann uses for floating
+    /// point numbers: 100.0, 0.001, or 1e-05 and 1.5e+20 outside of that range.  Infinities and NaNs are written as null.
+    void Number(double value);
+
+    /// Writes a tree built with nlohmann::ordered_json as the next value.
+    void Value(const nlohmann::ordered_json& value);
+
+    /// Writes text between top-level values, such as the separators of a JSON array or JSONL stream, verbatim.
+    void Raw(std::string_view text);
+
+    /// Writes the buffered output to the stream.  Called automatically when the buffer fills up.
+    void Flush();
+
+    /// True when no object or array is open.
+    bool IsComplete() const { return scopes_.empty(); }
+
+  private:
+    struct Scope
+    {
+        bool     is_object;
+        uint32_t count;
+    };
+
+    void BeginValue();
+
+    void BeginScope(char open, bool is_object);
+
+    void EndScope(char close);
+
+    void WriteNewline(size_t depth);
+
+    void WriteEscaped(std::string_view text);
+
+    void FlushIfFull()
+    {
+        if (buffer_.size() >= buffer_size_)
+        {
+            Flush();
+        }
+    }
+
+  private:
+    OutputStream*      os_;
+    size_t             buffer_size_;
+    std::string        buffer_;
+    std::vector<Scope> scopes_;
+    int                indent_width_;
+    bool               after_key_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_JSON_STREAM_WRITER_H
@@ -143,7 +143,8 @@ void FieldToJson(nlohmann::ordered_json& jdata, const std::nullptr_t data, const
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, float data, const JsonOptions& options)
+// Replace the floats that have no JSON number representation, which the JSON library would turn into nulls.
+static float AdjustFloat(float data)
 {
     if (std::isnan(data))
     {
@@ -164,7 +165,12 @@ void FieldToJson(nlohmann::ordered_json& jdata, float data, const JsonOptions& o
     }
     // Normal and denormal/subnormal numbers pass through unchanged and unremarked.
 
-    jdata = data;
+    return data;
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, float data, const JsonOptions& options)
+{
+    jdata = AdjustFloat(data);
 }
 
 void FieldToJson(nlohmann::ordered_json& jdata, double data, const util::JsonOptions& options)
@@ -177,7 +183,7 @@ void FieldToJson(nlohmann::ordered_json& jdata, const std::string_view data, con
     jdata = data;
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const std::wstring_view data, const util::JsonOptions& options)
+static std::string WideToUtf8(const std::wstring_view data)
 {
 #if defined(__clang__)
 #pragma clang diagnostic push
@@ -187,7 +193,129 @@ void FieldToJson(nlohmann::ordered_json& jdata, const std::wstring_view data, co
 #if defined(__clang__)
 #pragma clang diagnostic pop
 #endif
-    jdata = utf8_conv.to_bytes(data.data(), data.data() + data.length());
+    return utf8_conv.to_bytes(data.data(), data.data() + data.length());
+}
+
+void FieldToJson(nlohmann::ordered_json& jdata, const std::wstring_view data, const util::JsonOptions& options)
+{
+    jdata = WideToUtf8(data);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const float data[4], const util::JsonOptions& options)
+{
+    FieldToJson(writer, data, 4, options);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const uint32_t data[4], const util::JsonOptions& options)
+{
+    FieldToJson(writer, data, 4, options);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const uint64_t data[4], const util::JsonOptions& options)
+{
+    FieldToJson(writer, data, 4, options);
+}
+
+void HandleToJson(JsonStreamWriter& writer, const format::HandleId handle, const JsonOptions& options)
+{
+    if (options.hex_handles)
+    {
+        writer.String(util::to_hex_variable_width(handle));
+    }
+    else
+    {
+        writer.Number(handle);
+    }
+}
+
+void HandleToJson(JsonStreamWriter&       writer,
+                  const format::HandleId* data,
+                  size_t                  num_elements,
+                  const JsonOptions&      options)
+{
+    if (data && (num_elements > 0))
+    {
+        writer.BeginArray();
+        for (size_t i = 0; i < num_elements; ++i)
+        {
+            HandleToJson(writer, data[i], options);
+        }
+        writer.EndArray();
+    }
+    else
+    {
+        writer.Null();
+    }
+}
+
+void Bool32ToJson(JsonStreamWriter& writer, const uint32_t& data, const util::JsonOptions& options)
+{
+    writer.Bool(static_cast<bool>(data));
+}
+
+void FieldToJson(JsonStreamWriter& writer, const short& data, const JsonOptions& options)
+{
+    writer.Number(data);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const int& data, const JsonOptions& options)
+{
+    writer.Number(data);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const long& data, const JsonOptions& options)
+{
+    writer.Number(data);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const long long& data, const JsonOptions& options)
+{
+    writer.Number(data);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const unsigned short& data, const JsonOptions& options)
+{
+    writer.Number(data);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const unsigned int& data, const JsonOptions& options)
+{
+    writer.Number(data);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const unsigned long& data, const JsonOptions& options)
+{
+    writer.Number(data);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const unsigned long long& data, const JsonOptions& options)
+{
+    writer.Number(data);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const std::nullptr_t data, const JsonOptions& options)
+{
+    writer.Null();
+}
+
+void FieldToJson(JsonStreamWriter& writer, float data, const JsonOptions& options)
+{
+    writer.Number(static_cast<double>(AdjustFloat(data)));
+}
+
+void FieldToJson(JsonStreamWriter& writer, double data, const util::JsonOptions& options)
+{
+    writer.Number(data);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const std::string_view data, const util::JsonOptions& options)
+{
+    writer.String(data);
+}
+
+void FieldToJson(JsonStreamWriter& writer, const std::wstring_view data, const util::JsonOptions& options)
+{
+    writer.String(WideToUtf8(data));
 }
 
 #if defined(D3D12_SUPPORT)
@@ -270,72 +398,86 @@ std::string HresultToString(const HRESULT hresult)
     return result;
 }
 
-void HresultToJson(nlohmann::ordered_json& jdata, const HRESULT hresult, const util::JsonOptions& options)
+void HresultToJson(JsonStreamWriter& writer, const HRESULT hresult, const util::JsonOptions& options)
 {
-    FieldToJson(jdata, HresultToString(hresult), options);
+    writer.String(HresultToString(hresult));
 }
 
-void FieldToJson(nlohmann::ordered_json&                                  jdata,
+void FieldToJson(JsonStreamWriter&                                        writer,
                  const format::InitDx12AccelerationStructureGeometryDesc& data,
                  const util::JsonOptions&                                 options)
 {
     /// @todo handle enums and so on.
-    FieldToJson(jdata["geometry_type"], static_cast<D3D12_RAYTRACING_GEOMETRY_TYPE>(data.geometry_type), options);
+    writer.BeginObject();
+    FieldToJson(writer.Key("geometry_type"), static_cast<D3D12_RAYTRACING_GEOMETRY_TYPE>(data.geometry_type), options);
     FieldToJson_D3D12_RAYTRACING_GEOMETRY_FLAGS(
-        jdata["geometry_flags"], static_cast<D3D12_RAYTRACING_GEOMETRY_FLAGS>(data.geometry_flags), options);
-    FieldToJson(jdata["aabbs_count"], data.aabbs_count, options);
-    FieldToJson(jdata["aabbs_stride"], data.aabbs_stride, options);
-    Bool32ToJson(jdata["triangles_has_transform"], data.triangles_has_transform, options);
-    FieldToJson(jdata["triangles_index_format"], static_cast<DXGI_FORMAT>(data.triangles_index_format), options);
-    FieldToJson(jdata["triangles_vertex_format"], static_cast<DXGI_FORMAT>(data.triangles_vertex_format), options);
-    FieldToJson(jdata["triangles_index_count"], data.triangles_index_count, options);
-    FieldToJson(jdata["triangles_vertex_count"], data.triangles_vertex_count, options);
-    FieldToJson(jdata["triangles_vertex_stride"], data.triangles_vertex_stride, options);
-}
-
-void FieldToJson(nlohmann::ordered_json& jdata, const format::DxgiAdapterDesc& data, const util::JsonOptions& options)
-{
-    FieldToJson(jdata["Description"], std::wstring_view(data.Description), options);
-    FieldToJson(jdata["VendorId"], data.VendorId, options);
-    FieldToJson(jdata["DeviceId"], data.DeviceId, options);
-    FieldToJson(jdata["SubSysId"], data.SubSysId, options);
-    FieldToJson(jdata["Revision"], data.Revision, options);
-    FieldToJson(jdata["DedicatedVideoMemory"], data.DedicatedVideoMemory, options);
-    FieldToJson(jdata["DedicatedSystemMemory"], data.DedicatedSystemMemory, options);
-    FieldToJson(jdata["SharedSystemMemory"], data.SharedSystemMemory, options);
-    FieldToJson(jdata["LuidLowPart"], data.LuidLowPart, options);
-    FieldToJson(jdata["LuidHighPar"], data.LuidHighPart, options);
+        writer.Key("geometry_flags"), static_cast<D3D12_RAYTRACING_GEOMETRY_FLAGS>(data.geometry_flags), options);
+    FieldToJson(writer.Key("aabbs_count"), data.aabbs_count, options);
+    FieldToJson(writer.Key("aabbs_stride"), data.aabbs_stride, options);
+    Bool32ToJson(writer.Key("triangles_has_transform"), data.triangles_has_transform, options);
+    FieldToJson(writer.Key("triangles_index_format"), static_cast<DXGI_FORMAT>(data.triangles_index_format), options);
+    FieldToJson(writer.Key("triangles_vertex_format"), static_cast<DXGI_FORMAT>(data.triangles_vertex_format), options);
+    FieldToJson(writer.Key("triangles_index_count"), data.triangles_index_count, options);
+    FieldToJson(writer.Key("triangles_vertex_count"), data.triangles_vertex_count, options);
+    FieldToJson(writer.Key("triangles_vertex_stride"), data.triangles_vertex_stride, options);
+    writer.EndObject();
+}
+
+void FieldToJson(JsonStreamWriter& writer, const format::DxgiAdapterDesc& data, const util::JsonOptions& options)
+{
+    writer.BeginObject();
+    FieldToJson(writer.Key("Description"), std::wstring_view(data.Description), options);
+    FieldToJson(writer.Key("VendorId"), data.VendorId, options);
+    FieldToJson(writer.Key("DeviceId"), data.DeviceId, options);
+    FieldToJson(writer.Key("SubSysId"), data.SubSysId, options);
+    FieldToJson(writer.Key("Revision"), data.Revision, options);
+    FieldToJson(writer.Key("DedicatedVideoMemory"), data.DedicatedVideoMemory, options);
+    FieldToJson(writer.Key("DedicatedSystemMemory"), data.DedicatedSystemMemory, options);
+    FieldToJson(writer.Key("SharedSystemMemory"), data.SharedSystemMemory, options);
+    FieldToJson(writer.Key("LuidLowPart"), data.LuidLowPart, options);
+    FieldToJson(writer.Key("LuidHighPar"), data.LuidHighPart, options);
     // Should we break out the packed data? (2 bits (LSB) to store Type and 30 bits for object ID)
-    FieldToJson(jdata["extra_info"], data.extra_info, options);
+    FieldToJson(writer.Key("extra_info"), data.extra_info, options);
+    writer.EndObject();
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const format::Dx12RuntimeInfo& data, const util::JsonOptions& options)
+void FieldToJson(JsonStreamWriter& writer, const format::Dx12RuntimeInfo& data, const util::JsonOptions& options)
 {
-    FieldToJson(jdata["version"], data.version, util::filepath::kFileVersionSize, options);
-    FieldToJson(jdata["src"], util::strings::ViewOfCharArray(data.src, util::filepath::kMaxFilePropertySize), options);
+    writer.BeginObject();
+    FieldToJson(writer.Key("version"), data.version, util::filepath::kFileVersionSize, options);
+    FieldToJson(
+        writer.Key("src"), util::strings::ViewOfCharArray(data.src, util::filepath::kMaxFilePropertySize), options);
+    writer.EndObject();
 }
 
-void FieldToJson(nlohmann::ordered_json& jdata, const util::filepath::FileInfo& data, const util::JsonOptions& options)
+void FieldToJson(JsonStreamWriter& writer, const util::filepath::FileInfo& data, const util::JsonOptions& options)
 {
-    FieldToJson(jdata["ProductVersion"],
+    writer.BeginObject();
+    FieldToJson(writer.Key("ProductVersion"),
                 strings::ViewOfCharArray(data.ProductVersion, filepath::kMaxFilePropertySize),
                 options);
+    FieldToJson(writer.Key("FileVersion"),
+                strings::ViewOfCharArray(data.FileVersion, filepath::kMaxFilePropertySize),
+                options);
+    FieldToJson(writer.Key("AppVersion"), data.AppVersion, filepath::kMaxFilePropertySize, options);
     FieldToJson(
-        jdata["FileVersion"], strings::ViewOfCharArray(data.FileVersion, filepath::kMaxFilePropertySize), options);
-    FieldToJson(jdata["AppVersion"], data.AppVersion, filepath::kMaxFilePropertySize, options);
-    FieldToJson(jdata["AppName"], strings::ViewOfCharArray(data.AppName, filepath::kMaxFilePropertySize), options);
-    FieldToJson(
-        jdata["CompanyName"], strings::ViewOfCharArray(data.CompanyName, filepath::kMaxFilePropertySize), options);
-    FieldToJson(jdata["FileDescription"],
+        writer.Key("AppName"), strings::ViewOfCharArray(data.AppName, filepath::kMaxFilePropertySize), options);
+    FieldToJson(writer.Key("CompanyName"),
+                strings::ViewOfCharArray(data.CompanyName, filepath::kMaxFilePropertySize),
+                options);
+    FieldToJson(writer.Key("FileDescription"),
                 strings::ViewOfCharArray(data.FileDescription, filepath::kMaxFilePropertySize),
                 options);
-    FieldToJson(
-        jdata["InternalName"], strings::ViewOfCharArray(data.InternalName, filepath::kMaxFilePropertySize), options);
-    FieldToJson(jdata["OriginalFilename"],
+    FieldToJson(writer.Key("InternalName"),
+                strings::ViewOfCharArray(data.InternalName, filepath::kMaxFilePropertySize),
+                options);
+    FieldToJson(writer.Key("OriginalFilename"),
                 strings::ViewOfCharArray(data.OriginalFilename, filepath::kMaxFilePropertySize),
                 options);
-    FieldToJson(
-        jdata["ProductName"], strings::ViewOfCharArray(data.ProductName, filepath::kMaxFilePropertySize), options);
+    FieldToJson(writer.Key("ProductName"),
+                strings::ViewOfCharArray(data.ProductName, filepath::kMaxFilePropertySize),
+                options);
+    writer.EndObject();
 }
 
 #endif
@@ -367,7 +509,7 @@ static bool WriteBinaryFile(const std::string& filename, uint64_t data_size, con
 }
 
 bool RepresentBinaryFile(const util::JsonOptions& json_options,
-                         nlohmann::ordered_json&  jdata,
+                         JsonStreamWriter&        writer,
                          std::string_view         filename_base,
                          const uint64_t           instance_counter,
                          const uint64_t           data_size,
@@ -377,7 +519,7 @@ bool RepresentBinaryFile(const util::JsonOptions& json_options,
     // If the data is null or empty, put a null in the JSON.
     if (data_size < 1 || nullptr == data)
     {
-        FieldToJson(jdata, nullptr, json_options);
+        FieldToJson(writer, nullptr, json_options);
     }
     else
     {
@@ -388,17 +530,17 @@ bool RepresentBinaryFile(const util::JsonOptions& json_options,
             std::string filepath = gfxrecon::util::filepath::Join(json_options.root_dir, basename);
             if (WriteBinaryFile(filepath, data_size, data))
             {
-                FieldToJson(jdata, basename, json_options);
+                FieldToJson(writer, basename, json_options);
                 written = true;
             }
             else
             {
-                FieldToJson(jdata, format::kValWriteFailed, json_options);
+                FieldToJson(writer, format::kValWriteFailed, json_options);
             }
         }
         else
         {
-            FieldToJson(jdata, format::kValBinary, json_options);
+            FieldToJson(writer, format::kValBinary, json_options);
         }
     }
     return written;
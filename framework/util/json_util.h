@@ -29,6 +29,7 @@
 #define GFXRECON_UTIL_JSON_UTIL_H
 
 #include "util/defines.h"
+#include "util/json_stream_writer.h"
 #include "util/to_string.h"
 #include "util/logging.h"
 #include "format/format.h"
@@ -47,7 +48,7 @@ static constexpr int kJsonIndentWidth = 2;
 /// This selects between outputting an array of objects (JSON) or individual
 /// top-level objects separated by newlines (JSONL). A top-level component
 /// like Convert's main() needs to look at this but the FieldToJson functions
-/// ignore it. They build a nlohmann tree in memory.
+/// ignore it. They write straight to a JsonStreamWriter.
 enum class JsonFormat : uint8_t
 {
     JSON,
@@ -194,27 +195,109 @@ void HandleToJson(nlohmann::ordered_json&  jdata,
                   size_t                   num_elements,
                   const util::JsonOptions& options = util::JsonOptions());
 
+/// @defgroup JsonStreamFieldToJson Overloads of the functions above which write the
+/// same JSON value to a JsonStreamWriter, after the caller has written its Key(),
+/// rather than building it in a tree.
+/// @{
+void FieldToJson(JsonStreamWriter& writer, const short& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& writer, const int& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& writer, const long& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& writer, const long long& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& writer, const unsigned short& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& writer, const unsigned int& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& writer, const unsigned long& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& writer, const unsigned long long& data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& writer, const std::nullptr_t data, const JsonOptions& options = JsonOptions());
+void FieldToJson(JsonStreamWriter& writer, float data, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(JsonStreamWriter& writer, double data, const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(JsonStreamWriter&        writer,
+                 const std::string_view   data,
+                 const util::JsonOptions& options = util::JsonOptions());
+void FieldToJson(JsonStreamWriter&        writer,
+                 const std::wstring_view  data,
+                 const util::JsonOptions& options = util::JsonOptions());
+
+void HandleToJson(JsonStreamWriter& writer, const format::HandleId handle, const JsonOptions& options);
+
+void Bool32ToJson(JsonStreamWriter&        writer,
+                  const uint32_t&          data,
+                  const util::JsonOptions& options = util::JsonOptions());
+
+template <typename T>
+void FieldToJsonAsHex(JsonStreamWriter& writer, const T data, const util::JsonOptions& options = util::JsonOptions())
+{
+    writer.String(to_hex_variable_width(data));
+}
+
+template <typename T>
+void FieldToJsonAsFixedWidthBinary(JsonStreamWriter&        writer,
+                                   const T                  data,
+                                   const util::JsonOptions& options = util::JsonOptions())
+{
+    writer.String(to_binary_fixed_width(data));
+}
+
+template <typename T>
+void FieldToJson(JsonStreamWriter&        writer,
+                 const T*                 data,
+                 size_t                   num_elements,
+                 const util::JsonOptions& options = util::JsonOptions())
+{
+    // An empty array is null in a tree, as no element is ever assigned to it.
+    if (data && (num_elements > 0))
+    {
+        writer.BeginArray();
+        for (size_t i = 0; i < num_elements; ++i)
+        {
+            FieldToJson(writer, data[i], options);
+        }
+        writer.EndArray();
+    }
+    else
+    {
+        writer.Null();
+    }
+}
+
+void FieldToJson(JsonStreamWriter&        writer,
+                 const float              data[4],
+                 const util::JsonOptions& options = util::JsonOptions());
+
+void FieldToJson(JsonStreamWriter&        writer,
+                 const uint32_t           data[4],
+                 const util::JsonOptions& options = util::JsonOptions());
+
+void FieldToJson(JsonStreamWriter&        writer,
+                 const uint64_t           data[4],
+                 const util::JsonOptions& options = util::JsonOptions());
+
+void HandleToJson(JsonStreamWriter&        writer,
+                  const format::HandleId*  data,
+                  size_t                   num_elements,
+                  const util::JsonOptions& options = util::JsonOptions());
+/// @}
+
 #if defined(D3D12_SUPPORT)
 /// @brief Turn a D3D12 or DXGI HRESULT into a string with the same character
 /// sequence as the identifier of the C macro defining it in a header like
 /// winerror.h.
 /// @param hresult A D3D12 or DXGI result code.
 std::string HresultToString(const HRESULT hresult);
-void        HresultToJson(nlohmann::ordered_json& jdata, const HRESULT hresult, const util::JsonOptions& options);
+void        HresultToJson(JsonStreamWriter& writer, const HRESULT hresult, const util::JsonOptions& options);
 
-void FieldToJson(nlohmann::ordered_json&                                  jdata,
+void FieldToJson(JsonStreamWriter&                                        writer,
                  const format::InitDx12AccelerationStructureGeometryDesc& data,
                  const util::JsonOptions&                                 options);
-void FieldToJson(nlohmann::ordered_json& jdata, const format::DxgiAdapterDesc& data, const util::JsonOptions& options);
-void FieldToJson(nlohmann::ordered_json& jdata, const format::Dx12RuntimeInfo& data, const util::JsonOptions& options);
-void FieldToJson(nlohmann::ordered_json& jdata, const util::filepath::FileInfo& data, const util::JsonOptions& options);
+void FieldToJson(JsonStreamWriter& writer, const format::DxgiAdapterDesc& data, const util::JsonOptions& options);
+void FieldToJson(JsonStreamWriter& writer, const format::Dx12RuntimeInfo& data, const util::JsonOptions& options);
+void FieldToJson(JsonStreamWriter& writer, const util::filepath::FileInfo& data, const util::JsonOptions& options);
 #endif
 
-/// @brief Represent a binary blob in the JSON tree either as the filename of a file containing the data that is also
+/// @brief Represent a binary blob in the JSON either as the filename of a file containing the data that is also
 /// written, or as placeholder text with the binary file not written, depending on the JsonOptions in effect.
 /// @return true if a binary file was written to storage, false if not.
 bool RepresentBinaryFile(const util::JsonOptions& json_options,
-                         nlohmann::ordered_json&  jdata,
+                         JsonStreamWriter&        writer,
                          std::string_view         filename_base,
                          const uint64_t           instance_counter,
                          const uint64_t           data_size,
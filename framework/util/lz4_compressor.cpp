@@ -32,6 +32,10 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+// Compression state reused by every block compressed on a thread, instead of the stack allocated state that
+// LZ4_compress_fast sets up for each call.
+static thread_local LZ4_stream_t thread_stream;
+
 size_t Lz4Compressor::Compress(const size_t          uncompressed_size,
                                const uint8_t*        uncompressed_data,
                                std::vector<uint8_t>* compressed_data,
@@ -52,11 +56,12 @@ size_t Lz4Compressor::Compress(const size_t          uncompressed_size,
     }
 
     int compressed_size_generated =
-        LZ4_compress_fast(reinterpret_cast<const char*>(uncompressed_data),
-                          reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
-                          static_cast<const int32_t>(uncompressed_size),
-                          static_cast<int32_t>(lz4_compressed_size),
-                          1);
+        LZ4_compress_fast_extState(&thread_stream,
+                                   reinterpret_cast<const char*>(uncompressed_data),
+                                   reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
+                                   static_cast<const int32_t>(uncompressed_size),
+                                   static_cast<int32_t>(lz4_compressed_size),
+                                   1);
 
     if (compressed_size_generated > 0)
     {
@@ -66,10 +71,10 @@ size_t Lz4Compressor::Compress(const size_t          uncompressed_size,
     return data_size;
 }
 
-size_t Lz4Compressor::Decompress(const size_t                compressed_size,
-                                 const std::vector<uint8_t>& compressed_data,
-                                 const size_t                expected_uncompressed_size,
-                                 std::vector<uint8_t>*       uncompressed_data)
+size_t Lz4Compressor::Decompress(const size_t          compressed_size,
+                                 const uint8_t*        compressed_data,
+                                 const size_t          expected_uncompressed_size,
+                                 std::vector<uint8_t>* uncompressed_data)
 {
     size_t data_size = 0;
 
@@ -78,7 +83,7 @@ size_t Lz4Compressor::Decompress(const size_t                compressed_size,
         return 0;
     }
 
-    int uncompressed_size_generated = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed_data.data()),
+    int uncompressed_size_generated = LZ4_decompress_safe(reinterpret_cast<const char*>(compressed_data),
                                                           reinterpret_cast<char*>(uncompressed_data->data()),
                                                           static_cast<int32_t>(compressed_size),
                                                           static_cast<int32_t>(expected_uncompressed_size));
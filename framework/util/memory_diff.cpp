@@ -0,0 +1,212 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/memory_diff.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define GFXRECON_MEMORY_DIFF_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define GFXRECON_MEMORY_DIFF_NEON
+#endif
+
+// AVX2 is not part of the baseline ISA, so it is compiled for a single function and selected at runtime.
+#if defined(GFXRECON_MEMORY_DIFF_SSE2) && !defined(__ANDROID__)
+#if defined(__GNUC__)
+#include <immintrin.h>
+#define GFXRECON_MEMORY_DIFF_AVX2
+#define GFXRECON_MEMORY_DIFF_AVX2_TARGET __attribute__((target("avx2")))
+#elif defined(_MSC_VER) && !defined(__clang__)
+#include <immintrin.h>
+#include <intrin.h>
+#define GFXRECON_MEMORY_DIFF_AVX2
+#define GFXRECON_MEMORY_DIFF_AVX2_TARGET
+#endif
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+static_assert(kMemoryDiffBlockSize == 64, "BlockDiffers compares 64 bytes");
+
+static bool BlockDiffers(const uint8_t* a, const uint8_t* b)
+{
+#if defined(GFXRECON_MEMORY_DIFF_SSE2)
+    const __m128i* va = reinterpret_cast<const __m128i*>(a);
+    const __m128i* vb = reinterpret_cast<const __m128i*>(b);
+    __m128i        e0 = _mm_cmpeq_epi8(_mm_loadu_si128(va + 0), _mm_loadu_si128(vb + 0));
+    __m128i        e1 = _mm_cmpeq_epi8(_mm_loadu_si128(va + 1), _mm_loadu_si128(vb + 1));
+    __m128i        e2 = _mm_cmpeq_epi8(_mm_loadu_si128(va + 2), _mm_loadu_si128(vb + 2));
+    __m128i        e3 = _mm_cmpeq_epi8(_mm_loadu_si128(va + 3), _mm_loadu_si128(vb + 3));
+    __m128i        eq = _mm_and_si128(_mm_and_si128(e0, e1), _mm_and_si128(e2, e3));
+    return (_mm_movemask_epi8(eq) != 0xFFFF);
+#elif defined(GFXRECON_MEMORY_DIFF_NEON)
+    uint8x16_t e0 = vceqq_u8(vld1q_u8(a), vld1q_u8(b));
+    uint8x16_t e1 = vceqq_u8(vld1q_u8(a + 16), vld1q_u8(b + 16));
+    uint8x16_t e2 = vceqq_u8(vld1q_u8(a + 32), vld1q_u8(b + 32));
+    uint8x16_t e3 = vceqq_u8(vld1q_u8(a + 48), vld1q_u8(b + 48));
+    uint8x16_t eq = vandq_u8(vandq_u8(e0, e1), vandq_u8(e2, e3));
+    uint8x8_t  m  = vpmin_u8(vget_low_u8(eq), vget_high_u8(eq));
+    m             = vpmin_u8(m, m);
+    m             = vpmin_u8(m, m);
+    m             = vpmin_u8(m, m);
+    return (vget_lane_u8(m, 0) != 0xFF);
+#else
+    uint64_t diff = 0;
+    for (size_t i = 0; i < kMemoryDiffBlockSize; i += sizeof(uint64_t))
+    {
+        uint64_t wa;
+        uint64_t wb;
+        memcpy(&wa, a + i, sizeof(wa));
+        memcpy(&wb, b + i, sizeof(wb));
+        diff |= (wa ^ wb);
+    }
+    return (diff != 0);
+#endif
+}
+
+// Returns the offset of the first block in [offset, end) that differs, or end if all blocks match.  end - offset
+// must be a multiple of kMemoryDiffBlockSize.
+typedef size_t (*FindModifiedBlockFunc)(const uint8_t* a, const uint8_t* b, size_t offset, size_t end);
+
+static size_t FindModifiedBlock(const uint8_t* a, const uint8_t* b, size_t offset, size_t end)
+{
+    for (; offset < end; offset += kMemoryDiffBlockSize)
+    {
+        if (BlockDiffers(a + offset, b + offset))
+        {
+            break;
+        }
+    }
+    return offset;
+}
+
+#if defined(GFXRECON_MEMORY_DIFF_AVX2)
+
+GFXRECON_MEMORY_DIFF_AVX2_TARGET static size_t
+FindModifiedBlockAvx2(const uint8_t* a, const uint8_t* b, size_t offset, size_t end)
+{
+    for (; offset < end; offset += kMemoryDiffBlockSize)
+    {
+        const __m256i* va = reinterpret_cast<const __m256i*>(a + offset);
+        const __m256i* vb = reinterpret_cast<const __m256i*>(b + offset);
+        __m256i        e0 = _mm256_cmpeq_epi8(_mm256_loadu_si256(va + 0), _mm256_loadu_si256(vb + 0));
+        __m256i        e1 = _mm256_cmpeq_epi8(_mm256_loadu_si256(va + 1), _mm256_loadu_si256(vb + 1));
+
+        if (_mm256_movemask_epi8(_mm256_and_si256(e0, e1)) != -1)
+        {
+            break;
+        }
+    }
+    return offset;
+}
+
+static bool IsAvx2Supported()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+
+    // The AVX bit and the OSXSAVE bit, which indicates that _xgetbv can check if the OS saves the YMM registers.
+    const int kAvxOsxsave = (1 << 27) | (1 << 28);
+    __cpuid(info, 1);
+    if (((info[2] & kAvxOsxsave) != kAvxOsxsave) || ((_xgetbv(0) & 0x6) != 0x6))
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return ((info[1] & (1 << 5)) != 0);
+#else
+    // Also checks that the OS saves the YMM registers.
+    __builtin_cpu_init();
+    return (__builtin_cpu_supports("avx2") != 0);
+#endif
+}
+
+#endif // GFXRECON_MEMORY_DIFF_AVX2
+
+static FindModifiedBlockFunc SelectFindModifiedBlock()
+{
+#if defined(GFXRECON_MEMORY_DIFF_AVX2)
+    if (IsAvx2Supported())
+    {
+        return FindModifiedBlockAvx2;
+    }
+#endif
+    return FindModifiedBlock;
+}
+
+void FindModifiedRanges(const void*               current,
+                        const void*               previous,
+                        size_t                    size,
+                        size_t                    merge_distance,
+                        std::vector<MemoryRange>* ranges)
+{
+    assert(ranges != nullptr);
+
+    static const FindModifiedBlockFunc find_modified_block = SelectFindModifiedBlock();
+
+    ranges->clear();
+
+    const uint8_t* current_bytes  = static_cast<const uint8_t*>(current);
+    const uint8_t* previous_bytes = static_cast<const uint8_t*>(previous);
+    const size_t   blocks_end     = size - (size % kMemoryDiffBlockSize);
+
+    auto add_range = [ranges, merge_distance](size_t range_offset, size_t range_size) {
+        if (!ranges->empty() && ((range_offset - (ranges->back().offset + ranges->back().size)) <= merge_distance))
+        {
+            ranges->back().size = (range_offset + range_size) - ranges->back().offset;
+        }
+        else
+        {
+            ranges->push_back({ range_offset, range_size });
+        }
+    };
+
+    // Runs of unmodified blocks are skipped within find_modified_block, which only returns for a modified block.
+    size_t offset = find_modified_block(current_bytes, previous_bytes, 0, blocks_end);
+    while (offset < blocks_end)
+    {
+        add_range(offset, kMemoryDiffBlockSize);
+        offset = find_modified_block(current_bytes, previous_bytes, offset + kMemoryDiffBlockSize, blocks_end);
+    }
+
+    if ((blocks_end < size) &&
+        (memcmp(current_bytes + blocks_end, previous_bytes + blocks_end, size - blocks_end) != 0))
+    {
+        add_range(blocks_end, size - blocks_end);
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
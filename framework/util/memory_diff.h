@@ -0,0 +1,59 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_MEMORY_DIFF_H
+#define GFXRECON_UTIL_MEMORY_DIFF_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+struct MemoryRange
+{
+    size_t offset;
+    size_t size;
+};
+
+// Memory is compared in blocks of this many bytes, which is the granularity of the reported ranges.
+const size_t kMemoryDiffBlockSize = 64;
+
+// Modified ranges separated by fewer than this many unmodified bytes are merged into a single range, trading a few
+// redundant bytes for fewer fill memory commands.
+const size_t kDefaultMemoryDiffMergeDistance = 256;
+
+// Compares size bytes of current and previous, replacing the contents of ranges with the sorted, non-overlapping
+// ranges that differ. Comparison is vectorized with SSE2 or NEON when available, and with AVX2 when the CPU supports
+// it.
+void FindModifiedRanges(const void*               current,
+                        const void*               previous,
+                        size_t                    size,
+                        size_t                    merge_distance,
+                        std::vector<MemoryRange>* ranges);
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_MEMORY_DIFF_H
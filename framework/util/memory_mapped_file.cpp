@@ -0,0 +1,188 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/memory_mapped_file.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+
+#if !defined(WIN32)
+#include <fcntl.h>
+#endif
+
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+#if defined(WIN32)
+
+MemoryMappedFile::MemoryMappedFile() :
+    data_(nullptr), size_(0), file_handle_(INVALID_HANDLE_VALUE), mapping_handle_(nullptr)
+{}
+
+bool MemoryMappedFile::Open(const std::string& filename)
+{
+    Close();
+
+    HANDLE file = CreateFileA(filename.c_str(),
+                              GENERIC_READ,
+                              FILE_SHARE_READ,
+                              nullptr,
+                              OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                              nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER file_size = {};
+    if (!GetFileSizeEx(file, &file_size) || (file_size.QuadPart == 0) ||
+        (static_cast<uint64_t>(file_size.QuadPart) > std::numeric_limits<size_t>::max()))
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+    if (mapping == nullptr)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+    if (view == nullptr)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    data_           = reinterpret_cast<uint8_t*>(view);
+    size_           = static_cast<uint64_t>(file_size.QuadPart);
+    file_handle_    = file;
+    mapping_handle_ = mapping;
+
+    return true;
+}
+
+void MemoryMappedFile::SetSequentialAccess(bool sequential)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(sequential);
+}
+
+void MemoryMappedFile::Close()
+{
+    if (data_ != nullptr)
+    {
+        UnmapViewOfFile(data_);
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    if (mapping_handle_ != nullptr)
+    {
+        CloseHandle(mapping_handle_);
+        mapping_handle_ = nullptr;
+    }
+
+    if (file_handle_ != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(file_handle_);
+        file_handle_ = INVALID_HANDLE_VALUE;
+    }
+}
+
+#else // WIN32
+
+MemoryMappedFile::MemoryMappedFile() : data_(nullptr), size_(0), file_descriptor_(-1) {}
+
+bool MemoryMappedFile::Open(const std::string& filename)
+{
+    Close();
+
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat file_stat = {};
+    if ((fstat(fd, &file_stat) != 0) || (file_stat.st_size <= 0) ||
+        (static_cast<uint64_t>(file_stat.st_size) > std::numeric_limits<size_t>::max()))
+    {
+        close(fd);
+        return false;
+    }
+
+    size_t map_size = static_cast<size_t>(file_stat.st_size);
+    void*  view     = mmap(nullptr, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+    if (view == MAP_FAILED)
+    {
+        close(fd);
+        return false;
+    }
+
+    data_            = reinterpret_cast<uint8_t*>(view);
+    size_            = static_cast<uint64_t>(file_stat.st_size);
+    file_descriptor_ = fd;
+
+    return true;
+}
+
+void MemoryMappedFile::SetSequentialAccess(bool sequential)
+{
+    if (data_ != nullptr)
+    {
+        madvise(data_, static_cast<size_t>(size_), sequential ? MADV_SEQUENTIAL : MADV_NORMAL);
+    }
+}
+
+void MemoryMappedFile::Close()
+{
+    if (data_ != nullptr)
+    {
+        munmap(data_, static_cast<size_t>(size_));
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    if (file_descriptor_ >= 0)
+    {
+        close(file_descriptor_);
+        file_descriptor_ = -1;
+    }
+}
+
+#endif // WIN32
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    Close();
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,80 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_MEMORY_MAPPED_FILE_H
+#define GFXRECON_UTIL_MEMORY_MAPPED_FILE_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Read-only view of an entire file mapped into the process address space.  The view is created with copy-on-write
+// protection so that consumers which patch decoded data in place do not modify the file on disk.
+class MemoryMappedFile
+{
+  public:
+    MemoryMappedFile();
+
+    ~MemoryMappedFile();
+
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    // Returns false if the file could not be opened or mapped, which is expected for files that exceed the available
+    // address space on 32-bit platforms.  Callers should fall back to stream based reads in that case.
+    bool Open(const std::string& filename);
+
+    void Close();
+
+    // Hints that the view will be read front to back, so that the system can read ahead aggressively and release the
+    // pages that have been read.  Views are opened for random access, which is restored by passing false.  Has no
+    // effect on Windows.
+    void SetSequentialAccess(bool sequential);
+
+    bool IsOpen() const { return (data_ != nullptr); }
+
+    const uint8_t* GetData() const { return data_; }
+
+    uint64_t GetSize() const { return size_; }
+
+  private:
+    uint8_t* data_;
+    uint64_t size_;
+
+#if defined(WIN32)
+    void* file_handle_;
+    void* mapping_handle_;
+#else
+    int file_descriptor_;
+#endif
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_MEMORY_MAPPED_FILE_H
@@ -25,33 +25,37 @@
 
 #include "util/platform.h"
 
+#include <algorithm>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
-MemoryOutputStream::MemoryOutputStream()
-{
-    buffer_.reserve(kDefaultBufferSize);
-}
+MemoryOutputStream::MemoryOutputStream() : buffer_(kDefaultBufferSize), size_(0) {}
 
-MemoryOutputStream::MemoryOutputStream(size_t initial_size)
-{
-    buffer_.reserve(initial_size);
-}
+MemoryOutputStream::MemoryOutputStream(size_t initial_size) : buffer_(initial_size), size_(0) {}
 
-MemoryOutputStream::MemoryOutputStream(const void* initial_data, size_t initial_data_size)
+MemoryOutputStream::MemoryOutputStream(const void* initial_data, size_t initial_data_size) : size_(initial_data_size)
 {
     const uint8_t* bytes = reinterpret_cast<const uint8_t*>(initial_data);
-    buffer_.insert(buffer_.end(), bytes, bytes + initial_data_size);
+    buffer_.assign(bytes, bytes + initial_data_size);
 }
 
 MemoryOutputStream::~MemoryOutputStream() {}
 
-bool MemoryOutputStream::Write(const void* data, size_t len)
+void MemoryOutputStream::Resize(size_t size)
 {
-    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
-    buffer_.insert(buffer_.end(), bytes, bytes + len);
+    if (size > buffer_.size())
+    {
+        Grow(size - size_);
+    }
+
+    size_ = size;
+}
 
-    return true;
+void MemoryOutputStream::Grow(size_t len)
+{
+    // Grow geometrically, so that a stream that is repeatedly extended by small writes is reallocated rarely.
+    buffer_.resize(std::max(size_ + len, buffer_.size() * 2));
 }
 
 GFXRECON_END_NAMESPACE(util)
@@ -28,6 +28,8 @@
 #include "util/output_stream.h"
 
 #include <cstdint>
+#include <cstring>
+#include <utility>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -49,19 +51,68 @@ class MemoryOutputStream : public OutputStream
 
     virtual bool IsValid() override { return true; }
 
-    virtual void Clear() { buffer_.clear(); };
-
-    virtual bool Write(const void* data, size_t len) override;
+    virtual void Clear() { size_ = 0; };
+
+    virtual bool Write(const void* data, size_t len) override
+    {
+        Append(data, len);
+        return true;
+    }
+
+    // Non-virtual alternative to Write() for callers that know the concrete stream type, such as ParameterEncoder.
+    void Append(const void* data, size_t len) { memcpy(Allocate(len), data, len); }
+
+    // Extends the stream by len bytes and returns a pointer to the new bytes, which the caller must fill in.  The
+    // pointer is only valid until the next call that extends the stream.
+    uint8_t* Allocate(size_t len)
+    {
+        uint8_t* data = Reserve(len);
+        size_ += len;
+        return data;
+    }
+
+    // Ensures that len bytes can be written past the end of the stream and returns a pointer to them without extending
+    // the stream.  Commit() extends the stream by the number of bytes that were actually written, which may be less than
+    // len.  Used for variable length encodings where only an upper bound for the size is known in advance.
+    uint8_t* Reserve(size_t len)
+    {
+        if (len > (buffer_.size() - size_))
+        {
+            Grow(len);
+        }
+
+        return buffer_.data() + size_;
+    }
+
+    void Commit(size_t len) { size_ += len; }
+
+    // Exchanges the contents and buffer allocations of two streams.
+    void Swap(MemoryOutputStream* other)
+    {
+        buffer_.swap(other->buffer_);
+        std::swap(size_, other->size_);
+    }
 
     virtual const uint8_t* GetData() const { return buffer_.data(); }
 
-    virtual size_t GetDataSize() const { return buffer_.size(); }
+    virtual size_t GetDataSize() const { return size_; }
+
+    // Returns the number of bytes allocated for the stream.
+    size_t GetCapacity() const { return buffer_.size(); }
 
   protected:
-    std::vector<uint8_t>* GetBuffer() { return &buffer_; }
+    // Sets the size of the stream, growing the buffer if necessary.  Bytes added to the stream are not initialized.
+    void Resize(size_t size);
+
+    uint8_t* GetBufferData() { return buffer_.data(); }
+
+  private:
+    void Grow(size_t len);
 
   private:
+    // The vector size is the capacity of the stream; size_ is the number of bytes that have been written.
     std::vector<uint8_t> buffer_;
+    size_t               size_;
 };
 
 GFXRECON_END_NAMESPACE(util)
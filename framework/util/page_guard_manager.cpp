@@ -222,7 +222,8 @@ PageGuardManager::PageGuardManager() :
                      kDefaultEnableSignalHandlerWatcher,
                      kDefaultSignalHandlerWatcherMaxRestores,
                      kDefaultEnableReadWriteSamePage,
-                     kDefaultMemoryProtMode)
+                     kDefaultMemoryProtMode,
+                     kDefaultEnableDiff)
 {}
 
 PageGuardManager::PageGuardManager(bool                 enable_copy_on_map,
@@ -231,13 +232,14 @@ PageGuardManager::PageGuardManager(bool                 enable_copy_on_map,
                                    bool                 unblock_SIGSEGV,
                                    bool                 enable_signal_handler_watcher,
                                    int                  signal_handler_watcher_max_restores,
-                                   MemoryProtectionMode protection_mode) :
+                                   MemoryProtectionMode protection_mode,
+                                   bool                 enable_diff) :
     exception_handler_(nullptr),
     exception_handler_count_(0), system_page_size_(util::platform::GetSystemPageSize()),
     system_page_pot_shift_(GetSystemPagePotShift()), enable_copy_on_map_(enable_copy_on_map),
     enable_separate_read_(enable_separate_read), unblock_sigsegv_(unblock_SIGSEGV),
     enable_signal_handler_watcher_(enable_signal_handler_watcher),
-    signal_handler_watcher_max_restores_(signal_handler_watcher_max_restores),
+    signal_handler_watcher_max_restores_(signal_handler_watcher_max_restores), enable_diff_(enable_diff),
     enable_read_write_same_page_(expect_read_write_same_page), protection_mode_(protection_mode), uffd_is_init_(false)
 {
     if (kUserFaultFdMode == protection_mode_ && !USERFAULTFD_SUPPORTED)
@@ -360,7 +362,8 @@ void PageGuardManager::Create(bool                 enable_copy_on_map,
                               bool                 unblock_SIGSEGV,
                               bool                 enable_signal_handler_watcher,
                               int                  signal_handler_watcher_max_restores,
-                              MemoryProtectionMode protection_mode)
+                              MemoryProtectionMode protection_mode,
+                              bool                 enable_diff)
 {
     if (instance_ == nullptr)
     {
@@ -370,7 +373,8 @@ void PageGuardManager::Create(bool                 enable_copy_on_map,
                                          unblock_SIGSEGV,
                                          enable_signal_handler_watcher,
                                          signal_handler_watcher_max_restores,
-                                         protection_mode);
+                                         protection_mode,
+                                         enable_diff);
 
 #if !defined(WIN32)
         if (enable_signal_handler_watcher &&
@@ -849,13 +853,30 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
             page_offset -= memory_info->aligned_offset;
         }
 
-        void* source_address      = static_cast<uint8_t*>(memory_info->shadow_memory) + page_offset;
-        void* destination_address = static_cast<uint8_t*>(memory_info->mapped_memory) + page_offset;
-        MemoryCopy(destination_address, source_address, page_range);
+        uint8_t* source_address      = static_cast<uint8_t*>(memory_info->shadow_memory) + page_offset;
+        uint8_t* destination_address = static_cast<uint8_t*>(memory_info->mapped_memory) + page_offset;
 
-        // The shadow memory address, page offset, and range values to be provided to the callback, which will process
-        // the memory range.
-        handle_modified(memory_id, memory_info->shadow_memory, page_offset, page_range);
+        if (enable_diff_)
+        {
+            // The mapped memory still holds the content from before the writes to shadow memory, so it serves as the
+            // snapshot for the comparison.  Only the ranges that differ are copied and provided to the callback.
+            FindModifiedRanges(
+                source_address, destination_address, page_range, kDefaultMemoryDiffMergeDistance, &diff_ranges_);
+
+            for (const auto& range : diff_ranges_)
+            {
+                MemoryCopy(destination_address + range.offset, source_address + range.offset, range.size);
+                handle_modified(memory_id, memory_info->shadow_memory, page_offset + range.offset, range.size);
+            }
+        }
+        else
+        {
+            MemoryCopy(destination_address, source_address, page_range);
+
+            // The shadow memory address, page offset, and range values to be provided to the callback, which will
+            // process the memory range.
+            handle_modified(memory_id, memory_info->shadow_memory, page_offset, page_range);
+        }
 
         if (kMProtectMode == protection_mode_)
         {
@@ -894,9 +915,28 @@ void PageGuardManager::ProcessActiveRange(uint64_t                  memory_id,
             page_offset -= memory_info->aligned_offset;
         }
 
-        // The mapped memory address, page offset, and range values to be provided to the callback, which will process
-        // the memory range.
-        handle_modified(memory_id, memory_info->mapped_memory, page_offset, page_range);
+        if (memory_info->snapshot != nullptr)
+        {
+            // The snapshot is updated before invoking the callback, and the callback is given the snapshot content, so
+            // that a write made to the mapped memory after the comparison is detected by the next comparison.
+            uint8_t* current_address  = static_cast<uint8_t*>(memory_info->mapped_memory) + page_offset;
+            uint8_t* snapshot_address = memory_info->snapshot.get() + page_offset;
+
+            FindModifiedRanges(
+                current_address, snapshot_address, page_range, kDefaultMemoryDiffMergeDistance, &diff_ranges_);
+
+            for (const auto& range : diff_ranges_)
+            {
+                MemoryCopy(snapshot_address + range.offset, current_address + range.offset, range.size);
+                handle_modified(memory_id, memory_info->snapshot.get(), page_offset + range.offset, range.size);
+            }
+        }
+        else
+        {
+            // The mapped memory address, page offset, and range values to be provided to the callback, which will
+            // process the memory range.
+            handle_modified(memory_id, memory_info->mapped_memory, page_offset, page_range);
+        }
     }
 }
 
@@ -1068,6 +1108,14 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
             }
         }
 
+        std::unique_ptr<uint8_t[]> snapshot;
+        if (enable_diff_ && !use_shadow_memory)
+        {
+            // Without shadow memory, modified pages are compared with a copy of their previous content.
+            snapshot = std::make_unique<uint8_t[]>(mapped_range);
+            MemoryCopy(snapshot.get(), mapped_memory, mapped_range);
+        }
+
         bool        success       = true;
         const void* start_address = mapped_memory;
 
@@ -1122,7 +1170,11 @@ void* PageGuardManager::AddTrackedMemory(uint64_t  memory_id,
                                                            use_write_watch,
                                                            shadow_memory_handle == kNullShadowHandle));
 
-            if (!entry.second)
+            if (entry.second)
+            {
+                entry.first->second.snapshot = std::move(snapshot);
+            }
+            else
             {
                 if (!use_write_watch)
                 {
@@ -26,6 +26,7 @@
 #define GFXRECON_UTIL_PAGE_GUARD_MANAGER_H
 
 #include "util/defines.h"
+#include "util/memory_diff.h"
 #include "util/page_status_tracker.h"
 #include "util/platform.h"
 
@@ -74,6 +75,7 @@ class PageGuardManager
     static const bool                 kDefaultEnableSignalHandlerWatcher      = false;
     static const int                  kDefaultSignalHandlerWatcherMaxRestores = 1;
     static const MemoryProtectionMode kDefaultMemoryProtMode                  = kMProtectMode;
+    static const bool                 kDefaultEnableDiff                      = false;
 
     static const uintptr_t kNullShadowHandle = 0;
 
@@ -90,7 +92,8 @@ class PageGuardManager
                        bool                 unblock_SIGSEGV,
                        bool                 enable_signal_handler_watcher,
                        int                  signal_handler_watcher_max_restores,
-                       MemoryProtectionMode protection_mode);
+                       MemoryProtectionMode protection_mode,
+                       bool                 enable_diff);
 
     static void Destroy();
 
@@ -154,7 +157,8 @@ class PageGuardManager
                      bool                 unblock_SIGSEGV,
                      bool                 enable_signal_handler_watcher,
                      int                  signal_handler_watcher_max_restores,
-                     MemoryProtectionMode protection_mode);
+                     MemoryProtectionMode protection_mode,
+                     bool                 enable_diff);
 
     ~PageGuardManager();
 
@@ -204,6 +208,10 @@ class PageGuardManager
         bool        is_modified;
         bool        own_shadow_memory;
 
+        // Copy of the mapped memory content most recently provided to the modified memory callback, used to find the
+        // modified sub-ranges of dirty pages when diffing is enabled and shadow memory is not.
+        std::unique_ptr<uint8_t[]> snapshot;
+
 #if defined(WIN32)
         // Memory for retrieving modified pages with GetWriteWatch.
         std::unique_ptr<void*[]> modified_addresses;
@@ -270,6 +278,8 @@ class PageGuardManager
     const bool               unblock_sigsegv_;
     bool                     enable_signal_handler_watcher_;
     int                      signal_handler_watcher_max_restores_;
+    const bool               enable_diff_;
+    std::vector<MemoryRange> diff_ranges_; // Scratch storage for modified ranges, protected by tracked_memory_lock_.
 
     // Only applies to WIN32 builds and Linux/Android builds with PAGE_GUARD_ENABLE_UCONTEXT_WRITE_DETECTION defined.
     const bool enable_read_write_same_page_;
@@ -0,0 +1,319 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_PAGED_ID_MAP_H
+#define GFXRECON_UTIL_PAGED_ID_MAP_H
+
+#include "util/defines.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Map from integer IDs to values, optimized for the dense, monotonically increasing IDs that are assigned to captured
+// objects.  IDs are only dense across all object types, so the values of one map are usually interleaved with the IDs
+// of other maps.  The map is indexed directly by ID through fixed size pages of 32-bit slot indices, which are cheap to
+// allocate for sparse IDs, and the values are stored densely in a pool of fixed size chunks.  A lookup is a bounds
+// check and three loads instead of a hash table probe.  Pages are allocated on first use and released when their last
+// value is erased; the pool slots of erased values are reused.  IDs that are too large to index directly, such as the
+// reserved IDs of temporary objects, are stored in a hash table.  The address of a value does not change while it is
+// in the map.
+template <typename T>
+class PagedIdMap
+{
+  public:
+    static const uint64_t kPageShift  = 8;
+    static const uint64_t kPageSize   = 1ULL << kPageShift;
+    static const uint64_t kPageMask   = kPageSize - 1;
+    static const uint64_t kMaxPagedId = 1ULL << 28;
+
+    static const uint32_t kPoolChunkShift = 5;
+    static const uint32_t kPoolChunkSize  = 1U << kPoolChunkShift;
+    static const uint32_t kPoolChunkMask  = kPoolChunkSize - 1;
+
+  public:
+    PagedIdMap() : pool_size_(0), size_(0) {}
+
+    PagedIdMap(const PagedIdMap&) = delete;
+
+    PagedIdMap& operator=(const PagedIdMap&) = delete;
+
+    ~PagedIdMap() { Clear(); }
+
+    // Inserts value if id is not already in the map.  Returns a pointer to the value for id and true if the value was
+    // inserted, or a pointer to the existing value and false if it was not, in which case value is not moved from.
+    std::pair<T*, bool> Emplace(uint64_t id, T&& value)
+    {
+        if (id >= kMaxPagedId)
+        {
+            auto result = overflow_.find(id);
+            if (result != overflow_.end())
+            {
+                return std::make_pair(&result->second, false);
+            }
+
+            ++size_;
+            return std::make_pair(&overflow_.emplace(id, std::move(value)).first->second, true);
+        }
+
+        const size_t page_index = static_cast<size_t>(id >> kPageShift);
+        const size_t slot       = static_cast<size_t>(id & kPageMask);
+
+        if (page_index >= pages_.size())
+        {
+            pages_.resize(page_index + 1);
+        }
+
+        Page* page = pages_[page_index].get();
+        if (page == nullptr)
+        {
+            page        = new Page;
+            page->count = 0;
+            std::fill(std::begin(page->slots), std::end(page->slots), kEmptySlot);
+            pages_[page_index].reset(page);
+        }
+        else if (page->slots[slot] != kEmptySlot)
+        {
+            return std::make_pair(GetPoolValue(page->slots[slot]), false);
+        }
+
+        const uint32_t pool_index = AllocatePoolSlot();
+        T*             entry      = new (GetPoolValue(pool_index)) T(std::move(value));
+        page->slots[slot]         = pool_index;
+        ++page->count;
+        ++size_;
+
+        return std::make_pair(entry, true);
+    }
+
+    T* Find(uint64_t id) { return const_cast<T*>(static_cast<const PagedIdMap*>(this)->Find(id)); }
+
+    const T* Find(uint64_t id) const
+    {
+        if (id < kMaxPagedId)
+        {
+            const size_t page_index = static_cast<size_t>(id >> kPageShift);
+            if (page_index < pages_.size())
+            {
+                const Page* page = pages_[page_index].get();
+                if (page != nullptr)
+                {
+                    const uint32_t pool_index = page->slots[static_cast<size_t>(id & kPageMask)];
+                    if (pool_index != kEmptySlot)
+                    {
+                        return GetPoolValue(pool_index);
+                    }
+                }
+            }
+
+            return nullptr;
+        }
+
+        auto entry = overflow_.find(id);
+        return (entry != overflow_.end()) ? &entry->second : nullptr;
+    }
+
+    bool Erase(uint64_t id)
+    {
+        if (id >= kMaxPagedId)
+        {
+            if (overflow_.erase(id) == 0)
+            {
+                return false;
+            }
+
+            --size_;
+            return true;
+        }
+
+        const size_t page_index = static_cast<size_t>(id >> kPageShift);
+        const size_t slot       = static_cast<size_t>(id & kPageMask);
+
+        if ((page_index >= pages_.size()) || (pages_[page_index] == nullptr) ||
+            (pages_[page_index]->slots[slot] == kEmptySlot))
+        {
+            return false;
+        }
+
+        Page*          page       = pages_[page_index].get();
+        const uint32_t pool_index = page->slots[slot];
+
+        GetPoolValue(pool_index)->~T();
+        free_pool_slots_.push_back(pool_index);
+        page->slots[slot] = kEmptySlot;
+        --size_;
+
+        if (--page->count == 0)
+        {
+            pages_[page_index].reset();
+        }
+
+        return true;
+    }
+
+    size_t Size() const { return size_; }
+
+    void Clear()
+    {
+        ForEachPagedValue([](T& value) { value.~T(); });
+
+        pages_.clear();
+        pool_chunks_.clear();
+        free_pool_slots_.clear();
+        overflow_.clear();
+        pool_size_ = 0;
+        size_      = 0;
+    }
+
+    // Returns the number of bytes allocated for the pages and the value pool, which excludes the values with IDs that
+    // are stored in the hash table and any memory that is owned by the values.
+    size_t GetMemoryUsage() const
+    {
+        size_t page_count = 0;
+        for (const auto& page : pages_)
+        {
+            page_count += (page != nullptr) ? 1 : 0;
+        }
+
+        return (pages_.capacity() * sizeof(pages_[0])) + (page_count * sizeof(Page)) +
+               (pool_chunks_.capacity() * sizeof(pool_chunks_[0])) + (pool_chunks_.size() * sizeof(PoolChunk)) +
+               (free_pool_slots_.capacity() * sizeof(free_pool_slots_[0]));
+    }
+
+    // Calls visitor with a reference to each value in the map.  Values with directly indexed IDs are visited in ID
+    // order.
+    template <typename Visitor>
+    void ForEach(Visitor visitor)
+    {
+        ForEachPagedValue(visitor);
+
+        for (auto& entry : overflow_)
+        {
+            visitor(entry.second);
+        }
+    }
+
+    template <typename Visitor>
+    void ForEach(Visitor visitor) const
+    {
+        const_cast<PagedIdMap*>(this)->ForEach([&visitor](const T& value) { visitor(value); });
+    }
+
+    // Returns the first value for which predicate returns true, or nullptr if there is no such value.
+    template <typename Predicate>
+    T* FindIf(Predicate predicate)
+    {
+        T* match = nullptr;
+        ForEach([&match, &predicate](T& value) {
+            if ((match == nullptr) && predicate(static_cast<const T&>(value)))
+            {
+                match = &value;
+            }
+        });
+        return match;
+    }
+
+  private:
+    static constexpr uint32_t kEmptySlot = UINT32_MAX;
+
+    struct Page
+    {
+        uint32_t slots[kPageSize];
+        uint32_t count;
+    };
+
+    // Values are constructed in the chunk storage on insert, so the storage is not initialized.
+    struct PoolChunk
+    {
+        alignas(T) uint8_t storage[sizeof(T) * kPoolChunkSize];
+    };
+
+    T* GetPoolValue(uint32_t pool_index)
+    {
+        return reinterpret_cast<T*>(pool_chunks_[pool_index >> kPoolChunkShift]->storage) +
+               (pool_index & kPoolChunkMask);
+    }
+
+    const T* GetPoolValue(uint32_t pool_index) const
+    {
+        return reinterpret_cast<const T*>(pool_chunks_[pool_index >> kPoolChunkShift]->storage) +
+               (pool_index & kPoolChunkMask);
+    }
+
+    uint32_t AllocatePoolSlot()
+    {
+        if (!free_pool_slots_.empty())
+        {
+            const uint32_t pool_index = free_pool_slots_.back();
+            free_pool_slots_.pop_back();
+            return pool_index;
+        }
+
+        if ((pool_size_ >> kPoolChunkShift) >= pool_chunks_.size())
+        {
+            pool_chunks_.emplace_back(new PoolChunk);
+        }
+
+        return pool_size_++;
+    }
+
+    template <typename Visitor>
+    void ForEachPagedValue(Visitor visitor)
+    {
+        for (auto& page : pages_)
+        {
+            if (page != nullptr)
+            {
+                for (uint32_t pool_index : page->slots)
+                {
+                    if (pool_index != kEmptySlot)
+                    {
+                        visitor(*GetPoolValue(pool_index));
+                    }
+                }
+            }
+        }
+    }
+
+  private:
+    std::vector<std::unique_ptr<Page>>      pages_;
+    std::vector<std::unique_ptr<PoolChunk>> pool_chunks_;
+    std::vector<uint32_t>                   free_pool_slots_;
+    uint32_t                                pool_size_;
+    std::unordered_map<uint64_t, T>         overflow_;
+    size_t                                  size_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_PAGED_ID_MAP_H
@@ -0,0 +1,111 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_UTIL_SHARDED_HASH_MAP_H
+#define GFXRECON_UTIL_SHARDED_HASH_MAP_H
+
+#include "util/defines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Hash map that can be accessed concurrently from multiple threads.  Entries are distributed across shards by key,
+// with a separate lock for each shard, so that threads accessing different keys rarely contend for the same lock or
+// the same cache line.  Lookups take a shared lock on a single shard.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class ShardedHashMap
+{
+  public:
+    static const size_t kShardCount = 16;
+
+  public:
+    // Returns false if the key was already present, in which case the existing value is not replaced.
+    bool Insert(const Key& key, const Value& value)
+    {
+        Shard&                                    shard = GetShard(key);
+        const std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.entries.insert(std::make_pair(key, value)).second;
+    }
+
+    bool Erase(const Key& key)
+    {
+        Shard&                                    shard = GetShard(key);
+        const std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return (shard.entries.erase(key) != 0);
+    }
+
+    // Returns the value for key, or default_value when the key is not present.
+    Value Find(const Key& key, const Value& default_value) const
+    {
+        const Shard&                              shard = GetShard(key);
+        const std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto                                      entry = shard.entries.find(key);
+        return (entry != shard.entries.end()) ? entry->second : default_value;
+    }
+
+    size_t Size() const
+    {
+        size_t size = 0;
+        for (const auto& shard : shards_)
+        {
+            const std::shared_lock<std::shared_mutex> lock(shard.mutex);
+            size += shard.entries.size();
+        }
+        return size;
+    }
+
+  private:
+    // Each shard is aligned to a cache line so that locking one shard does not invalidate the lock of its neighbor.
+    struct alignas(64) Shard
+    {
+        mutable std::shared_mutex            mutex;
+        std::unordered_map<Key, Value, Hash> entries;
+    };
+
+    static size_t GetShardIndex(const Key& key)
+    {
+        // Handle and pointer keys are aligned, leaving the low bits of their hashes unused, so the shard is selected
+        // from the high bits of a multiplicative hash.
+        const uint64_t hash = static_cast<uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(hash >> 60) % kShardCount;
+    }
+
+    Shard& GetShard(const Key& key) { return shards_[GetShardIndex(key)]; }
+
+    const Shard& GetShard(const Key& key) const { return shards_[GetShardIndex(key)]; }
+
+  private:
+    Shard shards_[kShardCount];
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_SHARDED_HASH_MAP_H
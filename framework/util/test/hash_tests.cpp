@@ -0,0 +1,74 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/hash.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+static uint64_t HashString(const std::string& value, uint64_t seed = 0)
+{
+    return hash::GenerateHash64(reinterpret_cast<const uint8_t*>(value.data()), value.size(), seed);
+}
+
+TEST_CASE("GenerateHash64 matches the XXH64 reference values", "[hash]")
+{
+    REQUIRE(HashString("") == 0xEF46DB3751D8E999ULL);
+    REQUIRE(HashString("a") == 0xD24EC4F1A98C6E5BULL);
+    REQUIRE(HashString("abc") == 0x44BC2CF5AD770999ULL);
+    REQUIRE(HashString("Nobody inspects the spammish repetition") == 0xFBCEA83C8A378BF1ULL);
+}
+
+TEST_CASE("GenerateHash64 depends on every byte and the seed", "[hash]")
+{
+    // Cover the 32 byte stripes and each of the 8, 4, and 1 byte tails.
+    std::vector<uint8_t> data(1031);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i * 31);
+    }
+
+    const uint64_t original = hash::GenerateHash64(data.data(), data.size());
+    REQUIRE(hash::GenerateHash64(data.data(), data.size(), 1) != original);
+    REQUIRE(hash::GenerateHash64(data.data(), data.size() - 1) != original);
+
+    for (size_t i = 0; i < data.size(); i += 97)
+    {
+        data[i] ^= 1;
+        REQUIRE(hash::GenerateHash64(data.data(), data.size()) != original);
+        data[i] ^= 1;
+    }
+
+    REQUIRE(hash::GenerateHash64(data.data(), data.size()) == original);
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,151 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/image_writer.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+using namespace imagewriter;
+
+struct RowFormat
+{
+    DataFormats format;
+    const char* name;
+};
+
+static const RowFormat kRowFormats[] = { { kFormat_RGBA, "RGBA" },
+                                         { kFormat_BGRA, "BGRA" },
+                                         { kFormat_B10G11R11_UFLOAT, "B10G11R11_UFLOAT" },
+                                         { kFormat_A2B10G10R10, "A2B10G10R10" },
+                                         { kFormat_R16G16B16A16_SFLOAT, "R16G16B16A16_SFLOAT" },
+                                         { kFormat_D32_FLOAT, "D32_FLOAT" },
+                                         { kFormat_D24_UNORM, "D24_UNORM" },
+                                         { kFormat_D16_UNORM, "D16_UNORM" } };
+
+static std::vector<uint8_t> ConvertTexel(DataFormats format, uint64_t texel, bool rgba_order = true)
+{
+    std::vector<uint8_t> pixel(4);
+    REQUIRE(ConvertRow(format, &texel, 1, rgba_order, pixel.data()));
+    return pixel;
+}
+
+TEST_CASE("ConvertRow converts texels to 8-bit pixels", "[image_writer]")
+{
+    using Pixel = std::vector<uint8_t>;
+
+    REQUIRE(ConvertTexel(kFormat_RGBA, 0x44332211) == Pixel{ 0x11, 0x22, 0x33, 0x44 });
+    REQUIRE(ConvertTexel(kFormat_RGBA, 0x44332211, false) == Pixel{ 0x33, 0x22, 0x11, 0x44 });
+    REQUIRE(ConvertTexel(kFormat_BGRA, 0x44332211) == Pixel{ 0x33, 0x22, 0x11, 0x44 });
+
+    // Half 1.0, 0.5, -1.0, and infinity.  Float components are not clamped, so -255 keeps its low byte and infinity
+    // is written as 0.
+    REQUIRE(ConvertTexel(kFormat_R16G16B16A16_SFLOAT, 0x7C00BC0038003C00ULL) == Pixel{ 255, 127, 1, 0 });
+
+    // The largest half denormal, which is too small to be converted to a non-zero value.
+    REQUIRE(ConvertTexel(kFormat_R16G16B16A16_SFLOAT, 0x03FF) == Pixel{ 0, 0, 0, 0 });
+
+    // Red 1.0, green 0.5, and blue 2.0 as unsigned 11 and 10 bit floats.
+    REQUIRE(ConvertTexel(kFormat_B10G11R11_UFLOAT, (0x200u << 22) | (0x380u << 11) | 0x3C0u) ==
+            Pixel{ 255, 127, 255, 255 });
+
+    // The color components are truncated to their low 8 bits before they are scaled.
+    REQUIRE(ConvertTexel(kFormat_A2B10G10R10, 0xFFFFFFFF) == Pixel{ 63, 63, 63, 255 });
+    REQUIRE(ConvertTexel(kFormat_A2B10G10R10, (1u << 30) | (512u << 10) | 1023u) == Pixel{ 63, 0, 0, 85 });
+
+    // Depth is normalized by 2^23-1 and 2^15-1.
+    REQUIRE(ConvertTexel(kFormat_D24_UNORM, 0x00400000) == Pixel{ 127, 127, 127, 255 });
+    REQUIRE(ConvertTexel(kFormat_D24_UNORM, 0xFFFFFFFF) == Pixel{ 254, 254, 254, 255 });
+    REQUIRE(ConvertTexel(kFormat_D16_UNORM, 0x4000) == Pixel{ 127, 127, 127, 255 });
+
+    float    depth = 0.5f;
+    uint32_t depth_bits;
+    memcpy(&depth_bits, &depth, sizeof(depth));
+    REQUIRE(ConvertTexel(kFormat_D32_FLOAT, depth_bits) == Pixel{ 127, 127, 127, 255 });
+
+    REQUIRE(!ConvertRow(kFormat_RGB, &depth_bits, 1, true, nullptr));
+}
+
+TEST_CASE("ConvertRow does not clamp out of range float components", "[image_writer]")
+{
+    using Pixel = std::vector<uint8_t>;
+
+    // Half NaN, 2.0, -2.0, and negative infinity.
+    REQUIRE(ConvertTexel(kFormat_R16G16B16A16_SFLOAT, 0xFC00C00040007E00ULL) == Pixel{ 0, 254, 2, 0 });
+
+    const float depths[]   = { 1.5f, -0.5f, std::numeric_limits<float>::quiet_NaN() };
+    const Pixel expected[] = { { 126, 126, 126, 255 }, { 129, 129, 129, 255 }, { 0, 0, 0, 255 } };
+
+    for (size_t i = 0; i < 3; ++i)
+    {
+        uint32_t depth_bits;
+        memcpy(&depth_bits, &depths[i], sizeof(depths[i]));
+        REQUIRE(ConvertTexel(kFormat_D32_FLOAT, depth_bits) == expected[i]);
+    }
+}
+
+TEST_CASE("ConvertRow matches the scalar conversion", "[image_writer]")
+{
+    // Every half value, followed by random data, with a count that leaves a partial vector for the scalar tail.
+    const uint32_t       count = 16 * 1024 + 3;
+    std::vector<uint8_t> data(count * sizeof(uint64_t));
+    std::mt19937         rng(7);
+
+    for (uint32_t i = 0; i < 0x10000; ++i)
+    {
+        const uint16_t half = static_cast<uint16_t>(i);
+        memcpy(data.data() + (i * sizeof(half)), &half, sizeof(half));
+    }
+
+    for (size_t i = 0x10000 * sizeof(uint16_t); i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(rng());
+    }
+
+    std::vector<uint8_t> expected(count * 4);
+    std::vector<uint8_t> actual(count * 4);
+
+    for (const RowFormat& row_format : kRowFormats)
+    {
+        for (bool rgba_order : { true, false })
+        {
+            CAPTURE(row_format.name, rgba_order);
+
+            REQUIRE(ConvertRowScalar(row_format.format, data.data(), count, rgba_order, expected.data()));
+            REQUIRE(ConvertRow(row_format.format, data.data(), count, rgba_order, actual.data()));
+            REQUIRE(actual == expected);
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,289 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/json_stream_writer.h"
+#include "util/json_util.h"
+#include "util/memory_output_stream.h"
+
+#include <catch2/catch.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+static std::string GetText(const MemoryOutputStream& stream)
+{
+    return std::string(reinterpret_cast<const char*>(stream.GetData()), stream.GetDataSize());
+}
+
+// Writes the same document that BuildTree() builds, mixing streamed tokens with spliced subtrees.
+static void StreamDocument(JsonStreamWriter& writer)
+{
+    nlohmann::ordered_json args;
+    args["device"]  = 7;
+    args["pNames"]  = { "a", "b" };
+    args["pEmpty"]  = nlohmann::ordered_json::object();
+    args["pValues"] = { 1.5, -2 };
+
+    writer.BeginObject();
+    writer.Key("index");
+    writer.Number(uint64_t{ 42 });
+    writer.Key("function");
+    writer.BeginObject();
+    writer.Key("name");
+    writer.String("vkCmd\"Draw\"\n\x01\\");
+    writer.Key("thread");
+    writer.Number(-1);
+    writer.Key("enabled");
+    writer.Bool(true);
+    writer.Key("return");
+    writer.Null();
+    writer.Key("scale");
+    writer.Number(0.25);
+    writer.Key("args");
+    writer.Value(args);
+    writer.Key("empty");
+    writer.BeginArray();
+    writer.EndArray();
+    writer.Key("list");
+    writer.BeginArray();
+    writer.Number(1);
+    writer.BeginObject();
+    writer.EndObject();
+    writer.Value(args["pNames"]);
+    writer.EndArray();
+    writer.EndObject();
+    writer.EndObject();
+}
+
+static nlohmann::ordered_json BuildTree()
+{
+    nlohmann::ordered_json tree;
+    tree["index"]                = uint64_t{ 42 };
+    auto& function               = tree["function"];
+    function["name"]             = "vkCmd\"Draw\"\n\x01\\";
+    function["thread"]           = -1;
+    function["enabled"]          = true;
+    function["return"]           = nullptr;
+    function["scale"]            = 0.25;
+    auto& args                   = function["args"];
+    args["device"]               = 7;
+    args["pNames"]               = { "a", "b" };
+    args["pEmpty"]               = nlohmann::ordered_json::object();
+    args["pValues"]              = { 1.5, -2 };
+    function["empty"]            = nlohmann::ordered_json::array();
+    function["list"]             = nlohmann::ordered_json::array();
+    function["list"].push_back(1);
+    function["list"].push_back(nlohmann::ordered_json::object());
+    function["list"].push_back(args["pNames"]);
+    return tree;
+}
+
+TEST_CASE("JsonStreamWriter output matches nlohmann dump", "[json]")
+{
+    const auto indent_width = GENERATE(-1, 0, 2, 4);
+
+    MemoryOutputStream stream;
+    JsonStreamWriter   writer;
+    writer.SetIndentWidth(indent_width);
+    writer.SetStream(&stream);
+
+    StreamDocument(writer);
+    REQUIRE(writer.IsComplete());
+
+    writer.Raw("\n");
+    StreamDocument(writer);
+    writer.Flush();
+
+    const std::string expected = BuildTree().dump(indent_width);
+    REQUIRE(GetText(stream) == expected + "\n" + expected);
+}
+
+TEST_CASE("JsonStreamWriter writes to the stream when its buffer fills", "[json]")
+{
+    MemoryOutputStream stream;
+    JsonStreamWriter   writer(64);
+    writer.SetStream(&stream);
+
+    writer.BeginArray();
+    for (int i = 0; i < 100; ++i)
+    {
+        writer.Number(i);
+    }
+
+    REQUIRE(stream.GetDataSize() > 0);
+
+    writer.EndArray();
+    writer.Flush();
+
+    nlohmann::ordered_json expected = nlohmann::ordered_json::array();
+    for (int i = 0; i < 100; ++i)
+    {
+        expected.push_back(i);
+    }
+
+    REQUIRE(GetText(stream) == expected.dump());
+}
+
+TEST_CASE("JsonStreamWriter formats floating point numbers as nlohmann does", "[json]")
+{
+    const double values[] = { 0.0,
+                              -0.0,
+                              1.0,
+                              -2.0,
+                              0.25,
+                              100.0,
+                              123456789012345.0,
+                              1234567890123456.0,
+                              1.5e20,
+                              0.001,
+                              0.0001,
+                              0.00001,
+                              1.0e-300,
+                              -3.125e-7,
+                              4.9406564584124654e-324,
+                              std::numeric_limits<double>::max(),
+                              static_cast<double>(0.1f),
+                              static_cast<double>(3.4e38f),
+                              std::numeric_limits<double>::infinity(),
+                              std::numeric_limits<double>::quiet_NaN() };
+
+    for (double value : values)
+    {
+        MemoryOutputStream stream;
+        JsonStreamWriter   writer;
+        writer.SetStream(&stream);
+        writer.Number(value);
+        writer.Flush();
+
+        INFO(value);
+        REQUIRE(GetText(stream) == nlohmann::ordered_json(value).dump());
+    }
+}
+
+TEST_CASE("JsonStreamWriter writes floating point numbers that read back unchanged", "[json]")
+{
+    // The digits are the shortest that round trip, where nlohmann's Grisu2 digits are occasionally one longer or differ
+    // in the last place, so compare the values that are read back.
+    uint64_t bits = 0x9e3779b97f4a7c15ull;
+    for (int i = 0; i < 10000; ++i)
+    {
+        bits ^= bits << 13;
+        bits ^= bits >> 7;
+        bits ^= bits << 17;
+
+        double value = 0.0;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        MemoryOutputStream stream;
+        JsonStreamWriter   writer;
+        writer.SetStream(&stream);
+        writer.Number(value);
+        writer.Flush();
+
+        const auto parsed = nlohmann::ordered_json::parse(GetText(stream));
+
+        INFO(GetText(stream));
+        if (std::isfinite(value))
+        {
+            REQUIRE(parsed.is_number_float());
+            REQUIRE(parsed.get<double>() == value);
+        }
+        else
+        {
+            REQUIRE(parsed.is_null());
+        }
+    }
+}
+
+TEST_CASE("FieldToJson writes the same values to a JsonStreamWriter as to a tree", "[json]")
+{
+    const auto indent_width = GENERATE(-1, 2);
+
+    JsonOptions options;
+    options.hex_handles = GENERATE(false, true);
+
+    const uint32_t         uints[4]    = { 0, 1, 0xffffffff, 7 };
+    const float            floats[4]   = { 0.5f, std::numeric_limits<float>::quiet_NaN(), -1.0e-40f, 3.25f };
+    const format::HandleId handles[2]  = { 1, 0x1234 };
+    const int64_t*         null_values = nullptr;
+
+    nlohmann::ordered_json tree;
+    FieldToJson(tree["short"], static_cast<short>(-3), options);
+    FieldToJson(tree["uint64"], std::numeric_limits<uint64_t>::max(), options);
+    FieldToJson(tree["int64"], std::numeric_limits<int64_t>::min(), options);
+    FieldToJson(tree["float"], 0.1f, options);
+    FieldToJson(tree["infinity"], std::numeric_limits<float>::infinity(), options);
+    FieldToJson(tree["double"], 1.0e300, options);
+    FieldToJson(tree["null"], nullptr, options);
+    FieldToJson(tree["string"], "a \"quoted\" string", options);
+    FieldToJson(tree["wstring"], std::wstring_view(L"w\u00e9"), options);
+    HandleToJson(tree["handle"], format::HandleId{ 0xabcd }, options);
+    Bool32ToJson(tree["bool32"], 2u, options);
+    FieldToJsonAsHex(tree["hex"], uint64_t{ 0xfeed }, options);
+    FieldToJsonAsFixedWidthBinary(tree["binary"], uint8_t{ 5 }, options);
+    FieldToJson(tree["uints"], uints, options);
+    FieldToJson(tree["floats"], floats, options);
+    FieldToJson(tree["empty"], uints, 0, options);
+    FieldToJson(tree["missing"], null_values, 3, options);
+    HandleToJson(tree["handles"], handles, 2, options);
+
+    MemoryOutputStream stream;
+    JsonStreamWriter   writer;
+    writer.SetIndentWidth(indent_width);
+    writer.SetStream(&stream);
+
+    writer.BeginObject();
+    FieldToJson(writer.Key("short"), static_cast<short>(-3), options);
+    FieldToJson(writer.Key("uint64"), std::numeric_limits<uint64_t>::max(), options);
+    FieldToJson(writer.Key("int64"), std::numeric_limits<int64_t>::min(), options);
+    FieldToJson(writer.Key("float"), 0.1f, options);
+    FieldToJson(writer.Key("infinity"), std::numeric_limits<float>::infinity(), options);
+    FieldToJson(writer.Key("double"), 1.0e300, options);
+    FieldToJson(writer.Key("null"), nullptr, options);
+    FieldToJson(writer.Key("string"), "a \"quoted\" string", options);
+    FieldToJson(writer.Key("wstring"), std::wstring_view(L"w\u00e9"), options);
+    HandleToJson(writer.Key("handle"), format::HandleId{ 0xabcd }, options);
+    Bool32ToJson(writer.Key("bool32"), 2u, options);
+    FieldToJsonAsHex(writer.Key("hex"), uint64_t{ 0xfeed }, options);
+    FieldToJsonAsFixedWidthBinary(writer.Key("binary"), uint8_t{ 5 }, options);
+    FieldToJson(writer.Key("uints"), uints, options);
+    FieldToJson(writer.Key("floats"), floats, options);
+    FieldToJson(writer.Key("empty"), uints, 0, options);
+    FieldToJson(writer.Key("missing"), null_values, 3, options);
+    HandleToJson(writer.Key("handles"), handles, 2, options);
+    writer.EndObject();
+    writer.Flush();
+
+    REQUIRE(GetText(stream) == tree.dump(indent_width));
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
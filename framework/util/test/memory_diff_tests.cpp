@@ -0,0 +1,147 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/memory_diff.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+// Applies the modified ranges of current to previous, which must then match current.
+static void ApplyRanges(const std::vector<uint8_t>&     current,
+                        std::vector<uint8_t>*           previous,
+                        const std::vector<MemoryRange>& ranges)
+{
+    for (const auto& range : ranges)
+    {
+        memcpy(previous->data() + range.offset, current.data() + range.offset, range.size);
+    }
+}
+
+TEST_CASE("FindModifiedRanges reports nothing for identical memory", "[memory_diff]")
+{
+    std::vector<uint8_t>     current(4096 + 17, 0xAB);
+    std::vector<uint8_t>     previous = current;
+    std::vector<MemoryRange> ranges{ { 1, 1 } };
+
+    FindModifiedRanges(current.data(), previous.data(), current.size(), 0, &ranges);
+    REQUIRE(ranges.empty());
+}
+
+TEST_CASE("FindModifiedRanges reports block aligned ranges", "[memory_diff]")
+{
+    std::vector<uint8_t> previous(4096, 0);
+    std::vector<uint8_t> current = previous;
+    current[10]                  = 1;
+    current[1000]                = 1;
+    current[1001]                = 1;
+    current[4095]                = 1;
+
+    std::vector<MemoryRange> ranges;
+    FindModifiedRanges(current.data(), previous.data(), current.size(), 0, &ranges);
+
+    REQUIRE(ranges.size() == 3);
+    CHECK(ranges[0].offset == 0);
+    CHECK(ranges[0].size == kMemoryDiffBlockSize);
+    CHECK(ranges[1].offset == 960);
+    CHECK(ranges[1].size == kMemoryDiffBlockSize);
+    CHECK(ranges[2].offset == 4096 - kMemoryDiffBlockSize);
+    CHECK(ranges[2].size == kMemoryDiffBlockSize);
+
+    // Ranges separated by no more than the merge distance are combined.
+    FindModifiedRanges(current.data(), previous.data(), current.size(), 1024, &ranges);
+    REQUIRE(ranges.size() == 2);
+    CHECK(ranges[0].offset == 0);
+    CHECK(ranges[0].size == 1024);
+}
+
+TEST_CASE("FindModifiedRanges handles a partial trailing block", "[memory_diff]")
+{
+    std::vector<uint8_t> previous(kMemoryDiffBlockSize * 2 + 5, 0);
+    std::vector<uint8_t> current = previous;
+    current.back()               = 1;
+
+    std::vector<MemoryRange> ranges;
+    FindModifiedRanges(current.data(), previous.data(), current.size(), 0, &ranges);
+
+    REQUIRE(ranges.size() == 1);
+    CHECK(ranges[0].offset == kMemoryDiffBlockSize * 2);
+    CHECK(ranges[0].size == 5);
+}
+
+TEST_CASE("FindModifiedRanges finds a modification at every offset", "[memory_diff]")
+{
+    const size_t         size = (kMemoryDiffBlockSize * 4) + 7;
+    std::vector<uint8_t> previous(size, 0x5A);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        std::vector<uint8_t> current = previous;
+        current[i] ^= 0xFF;
+
+        std::vector<MemoryRange> ranges;
+        FindModifiedRanges(current.data(), previous.data(), size, 0, &ranges);
+
+        REQUIRE(ranges.size() == 1);
+        CHECK(ranges[0].offset == (i - (i % kMemoryDiffBlockSize)));
+        CHECK(ranges[0].size == std::min(kMemoryDiffBlockSize, size - ranges[0].offset));
+    }
+}
+
+TEST_CASE("FindModifiedRanges covers random modifications", "[memory_diff]")
+{
+    std::mt19937                            rng(1234);
+    std::uniform_int_distribution<uint32_t> byte_dist(0, 255);
+
+    for (size_t size : { size_t(1), size_t(63), size_t(4096), size_t(65536 + 33) })
+    {
+        std::vector<uint8_t> previous(size);
+        for (auto& value : previous)
+        {
+            value = static_cast<uint8_t>(byte_dist(rng));
+        }
+
+        std::vector<uint8_t>                  current = previous;
+        std::uniform_int_distribution<size_t> offset_dist(0, size - 1);
+        for (size_t i = 0; i < (size / 128) + 1; ++i)
+        {
+            current[offset_dist(rng)] ^= 0xFF;
+        }
+
+        std::vector<MemoryRange> ranges;
+        FindModifiedRanges(current.data(), previous.data(), size, kDefaultMemoryDiffMergeDistance, &ranges);
+        ApplyRanges(current, &previous, ranges);
+        REQUIRE(previous == current);
+    }
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
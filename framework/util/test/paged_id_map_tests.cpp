@@ -0,0 +1,163 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/paged_id_map.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+// Stand-in for the replay object info structures, which hold a handle and a variable amount of additional state.
+struct TestObjectInfo
+{
+    uint64_t    handle{ 0 };
+    uint64_t    capture_id{ 0 };
+    std::string name;
+    uint8_t     state[192]{};
+};
+
+static TestObjectInfo MakeInfo(uint64_t id)
+{
+    TestObjectInfo info;
+    info.handle     = id * 64;
+    info.capture_id = id;
+    info.name       = "object " + std::to_string(id);
+    return info;
+}
+
+TEST_CASE("PagedIdMap inserts, finds, and erases values", "[paged_id_map]")
+{
+    PagedIdMap<TestObjectInfo> map;
+    const uint64_t             kTempId = UINT64_MAX - 2;
+
+    REQUIRE(map.Emplace(1, MakeInfo(1)).second);
+    REQUIRE(map.Emplace(1000, MakeInfo(1000)).second);
+    REQUIRE(map.Emplace(kTempId, MakeInfo(kTempId)).second);
+    REQUIRE(map.Size() == 3);
+
+    // A duplicate insert returns the existing value and leaves the new value intact.
+    TestObjectInfo duplicate = MakeInfo(1);
+    duplicate.handle         = 7;
+    auto result              = map.Emplace(1, std::move(duplicate));
+    REQUIRE_FALSE(result.second);
+    REQUIRE(result.first->handle == 64);
+    REQUIRE(duplicate.name == "object 1");
+
+    REQUIRE(map.Find(1)->name == "object 1");
+    REQUIRE(map.Find(1000)->name == "object 1000");
+    REQUIRE(map.Find(kTempId)->name == MakeInfo(kTempId).name);
+    REQUIRE(map.Find(2) == nullptr);
+    REQUIRE(map.Find(1ULL << 40) == nullptr);
+
+    REQUIRE(map.Erase(1000));
+    REQUIRE_FALSE(map.Erase(1000));
+    REQUIRE(map.Find(1000) == nullptr);
+    REQUIRE(map.Erase(kTempId));
+    REQUIRE(map.Find(kTempId) == nullptr);
+    REQUIRE(map.Size() == 1);
+}
+
+TEST_CASE("PagedIdMap keeps value addresses stable", "[paged_id_map]")
+{
+    PagedIdMap<TestObjectInfo> map;
+    const TestObjectInfo*      first = map.Emplace(1, MakeInfo(1)).first;
+
+    for (uint64_t id = 2; id < 100000; ++id)
+    {
+        map.Emplace(id, MakeInfo(id));
+    }
+
+    REQUIRE(map.Find(1) == first);
+    REQUIRE(first->name == "object 1");
+}
+
+TEST_CASE("PagedIdMap visits values in ID order", "[paged_id_map]")
+{
+    PagedIdMap<TestObjectInfo> map;
+    const uint64_t             ids[] = { 700, 3, 64, 65, 300 };
+
+    for (auto id : ids)
+    {
+        map.Emplace(id, MakeInfo(id));
+    }
+
+    std::vector<uint64_t> visited;
+    map.ForEach([&visited](const TestObjectInfo& info) { visited.push_back(info.capture_id); });
+    REQUIRE(visited == std::vector<uint64_t>{ 3, 64, 65, 300, 700 });
+
+    auto match = map.FindIf([](const TestObjectInfo& info) { return info.handle == (300 * 64); });
+    REQUIRE(match == map.Find(300));
+
+    for (auto id : ids)
+    {
+        map.Erase(id);
+    }
+
+    visited.clear();
+    map.ForEach([&visited](const TestObjectInfo& info) { visited.push_back(info.capture_id); });
+    REQUIRE(visited.empty());
+}
+
+TEST_CASE("PagedIdMap memory use is proportional to its values when IDs are interleaved", "[paged_id_map]")
+{
+    // IDs are assigned in creation order across all object types, so each type's map holds a sparse subset of them.
+    const size_t   kTypeCount   = 16;
+    const uint64_t kObjectCount = 200000;
+
+    std::vector<PagedIdMap<TestObjectInfo>> maps(kTypeCount);
+    for (uint64_t id = 1; id <= kObjectCount; ++id)
+    {
+        maps[id % kTypeCount].Emplace(id, MakeInfo(id));
+    }
+
+    for (const auto& map : maps)
+    {
+        const size_t value_size = map.Size() * sizeof(TestObjectInfo);
+        INFO("Values: " << map.Size() << ", value bytes: " << value_size << ", map bytes: " << map.GetMemoryUsage());
+        CHECK(map.GetMemoryUsage() < (value_size + (value_size / 2)));
+    }
+
+    // The pool slots of erased values are reused.
+    PagedIdMap<TestObjectInfo>& map          = maps[0];
+    const size_t                memory_usage = map.GetMemoryUsage();
+    for (uint64_t id = kTypeCount; id <= kObjectCount; id += kTypeCount)
+    {
+        REQUIRE(map.Erase(id));
+        REQUIRE(map.Emplace(id + kObjectCount, MakeInfo(id + kObjectCount)).second);
+    }
+
+    REQUIRE(map.Find(kTypeCount) == nullptr);
+    REQUIRE(map.Find(kTypeCount + kObjectCount)->capture_id == (kTypeCount + kObjectCount));
+    INFO("Map bytes before: " << memory_usage << ", after reinserting: " << map.GetMemoryUsage());
+    CHECK(map.GetMemoryUsage() < (memory_usage * 2));
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,135 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/sharded_hash_map.h"
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+// Stand-in for the Vulkan handle wrappers, which are stored as pointers keyed by their handle values.
+struct TestWrapper
+{
+    uint64_t handle;
+};
+
+const size_t kThreadCount      = 8;
+const size_t kHandlesPerThread = 1024;
+const size_t kLookupsPerInsert = 8;
+const size_t kIterationCount   = 4;
+
+// Handle values that resemble driver allocations: 64 byte aligned and interleaved between threads.
+static uint64_t MakeHandle(size_t thread_index, size_t handle_index)
+{
+    return 0x10000000ULL + (((handle_index * kThreadCount) + thread_index) * 64);
+}
+
+// Simulates worker threads creating transient objects, using them, and destroying them.
+template <typename Map>
+static bool RunWorkers(Map* map)
+{
+    std::atomic<bool>        success{ true };
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < kThreadCount; ++t)
+    {
+        threads.emplace_back([map, t, &success]() {
+            std::vector<TestWrapper> wrappers(kHandlesPerThread);
+
+            for (size_t iteration = 0; iteration < kIterationCount; ++iteration)
+            {
+                for (size_t i = 0; i < kHandlesPerThread; ++i)
+                {
+                    wrappers[i].handle = MakeHandle(t, i);
+                    if (!map->Insert(wrappers[i].handle, &wrappers[i]))
+                    {
+                        success = false;
+                    }
+
+                    for (size_t lookup = 0; lookup < kLookupsPerInsert; ++lookup)
+                    {
+                        if (map->Find(wrappers[i].handle, nullptr) != &wrappers[i])
+                        {
+                            success = false;
+                        }
+                    }
+                }
+
+                for (size_t i = 0; i < kHandlesPerThread; ++i)
+                {
+                    if (!map->Erase(wrappers[i].handle))
+                    {
+                        success = false;
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return success;
+}
+
+TEST_CASE("ShardedHashMap inserts, finds, and erases entries", "[sharded_hash_map]")
+{
+    ShardedHashMap<uint64_t, TestWrapper*> map;
+    TestWrapper                            first{ 64 };
+    TestWrapper                            second{ 128 };
+
+    REQUIRE(map.Insert(first.handle, &first));
+    REQUIRE(map.Insert(second.handle, &second));
+    REQUIRE_FALSE(map.Insert(first.handle, &second));
+    REQUIRE(map.Size() == 2);
+
+    REQUIRE(map.Find(first.handle, nullptr) == &first);
+    REQUIRE(map.Find(second.handle, nullptr) == &second);
+    REQUIRE(map.Find(192, nullptr) == nullptr);
+
+    REQUIRE(map.Erase(first.handle));
+    REQUIRE_FALSE(map.Erase(first.handle));
+    REQUIRE(map.Find(first.handle, nullptr) == nullptr);
+    REQUIRE(map.Size() == 1);
+}
+
+TEST_CASE("ShardedHashMap supports concurrent access", "[sharded_hash_map]")
+{
+    ShardedHashMap<uint64_t, TestWrapper*> map;
+
+    REQUIRE(RunWorkers(&map));
+    REQUIRE(map.Size() == 0);
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
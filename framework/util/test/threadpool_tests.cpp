@@ -0,0 +1,215 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/threadpool.h"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+TEST_CASE("ThreadPool runs posted tasks", "[threadpool]")
+{
+    const size_t     num_tasks = 10000;
+    ThreadPool       thread_pool(4);
+    std::atomic<int> counter{ 0 };
+
+    std::vector<std::future<size_t>> results;
+    results.reserve(num_tasks);
+
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        results.push_back(thread_pool.post(
+            [&counter](size_t value) {
+                ++counter;
+                return value;
+            },
+            i));
+    }
+
+    size_t sum = 0;
+    for (auto& result : results)
+    {
+        sum += result.get();
+    }
+
+    REQUIRE(counter == num_tasks);
+    REQUIRE(sum == (num_tasks * (num_tasks - 1)) / 2);
+}
+
+TEST_CASE("ThreadPool runs tasks posted from worker threads", "[threadpool]")
+{
+    const size_t     num_outer_tasks = 2;
+    const size_t     num_inner_tasks = 500;
+    ThreadPool       thread_pool(4);
+    std::atomic<int> counter{ 0 };
+
+    std::vector<std::future<void>> results;
+    for (size_t i = 0; i < num_outer_tasks; ++i)
+    {
+        results.push_back(thread_pool.post([&]() {
+            std::vector<std::future<void>> inner_results;
+            for (size_t j = 0; j < num_inner_tasks; ++j)
+            {
+                inner_results.push_back(thread_pool.post([&counter]() { ++counter; }));
+            }
+
+            for (auto& result : inner_results)
+            {
+                result.wait();
+            }
+        }));
+    }
+
+    for (auto& result : results)
+    {
+        result.get();
+    }
+
+    REQUIRE(counter == (num_outer_tasks * num_inner_tasks));
+}
+
+TEST_CASE("ThreadPool without threads is polled", "[threadpool]")
+{
+    ThreadPool thread_pool;
+    int        counter = 0;
+
+    // more tasks than fit into the queue, the remainder goes to the overflow queue
+    const size_t num_tasks = 1000;
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        thread_pool.post_detached([&counter]() { ++counter; });
+    }
+
+    auto result = thread_pool.post<ThreadPool::Priority::High>([&counter]() { return counter; });
+
+    REQUIRE(thread_pool.poll() == (num_tasks + 1));
+    REQUIRE(counter == num_tasks);
+
+    // high priority tasks are run first
+    REQUIRE(result.get() == 0);
+}
+
+TEST_CASE("ThreadPool stores small tasks inline", "[threadpool]")
+{
+    auto small_task = []() {};
+    REQUIRE(ThreadPool::Task::is_stored_inline<decltype(small_task)>());
+    REQUIRE(ThreadPool::Task::is_stored_inline<std::packaged_task<int()>>());
+
+    // large function objects are stored on the heap and still run
+    std::array<uint8_t, 256> data{};
+    data.back()     = 1;
+    auto large_task = [data]() { return data.back(); };
+    REQUIRE(!ThreadPool::Task::is_stored_inline<decltype(large_task)>());
+
+    ThreadPool thread_pool(1);
+    REQUIRE(thread_pool.post(large_task).get() == 1);
+}
+
+TEST_CASE("ThreadPool default construction creates its queue on first use", "[threadpool]")
+{
+    ThreadPool thread_pool;
+    REQUIRE(thread_pool.numthreads() == 0);
+    REQUIRE(thread_pool.poll() == 0);
+
+    // moving an unused pool leaves both pools usable
+    ThreadPool moved_pool(std::move(thread_pool));
+    REQUIRE(moved_pool.poll() == 0);
+
+    // tasks may be posted from several threads before the queue exists
+    const size_t             num_threads = 4;
+    const size_t             num_tasks   = 100;
+    std::atomic<size_t>      counter{ 0 };
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back([&moved_pool, &counter]() {
+            for (size_t j = 0; j < num_tasks; ++j)
+            {
+                moved_pool.post_detached([&counter]() { ++counter; });
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(moved_pool.poll() == (num_threads * num_tasks));
+    REQUIRE(counter.load() == (num_threads * num_tasks));
+
+    // the pool can be given threads afterwards
+    moved_pool.set_num_threads(2);
+    REQUIRE(moved_pool.post([]() { return 1; }).get() == 1);
+}
+
+TEST_CASE("ThreadPool TaskCounter waits for detached tasks", "[threadpool]")
+{
+    const size_t num_tasks = 1000;
+    ThreadPool   thread_pool(4);
+
+    std::vector<size_t>     results(num_tasks, 0);
+    ThreadPool::TaskCounter tasks;
+    REQUIRE(tasks.is_done());
+
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        tasks.add();
+        thread_pool.post_detached([&results, &tasks, i]() {
+            results[i] = i;
+            tasks.done();
+        });
+    }
+
+    // results written by the tasks are visible once the counter has been waited for
+    tasks.wait();
+    REQUIRE(tasks.is_done());
+
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        REQUIRE(results[i] == i);
+    }
+
+    // a counter without threads completes when the queued tasks are polled
+    ThreadPool              polled_pool(0);
+    ThreadPool::TaskCounter polled_tasks;
+    polled_tasks.add(2);
+    polled_pool.post_detached([&polled_tasks]() { polled_tasks.done(); });
+    polled_pool.post_detached([&polled_tasks]() { polled_tasks.done(); });
+    REQUIRE(!polled_tasks.is_done());
+    REQUIRE(polled_pool.poll() == 2);
+    REQUIRE(polled_tasks.is_done());
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -24,15 +24,37 @@
 #define GFXRECON_UTIL_THREADPOOL_H
 
 #include "util/defines.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <functional>
 #include <future>
+#include <memory>
 #include <mutex>
+#include <new>
 #include <thread>
+#include <type_traits>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+/**
+ * @brief   Work-stealing thread pool.
+ *
+ * Every worker owns one lock-free queue per priority. Tasks posted from a worker go to the queue of that worker, other
+ * tasks are distributed round-robin over all queues. A worker that runs out of tasks steals from the queues of the other
+ * workers before it goes to sleep, so posting and running tasks never contend on a single lock.
+ *
+ * Tasks are stored in place in the queue slots. Apart from the shared state of the std::future returned by post(),
+ * posting a task does not allocate memory. Callers that only need to wait for their tasks use post_detached() with a
+ * TaskCounter instead, and keep results in storage of their own.
+ */
 class ThreadPool
 {
   public:
@@ -43,15 +65,204 @@ class ThreadPool
         NumPriorities
     };
 
+    /**
+     * @brief   Type-erased, move-only function object with inline storage for small function objects.
+     */
+    class Task
+    {
+      public:
+        static constexpr size_t kInlineSize = 64;
+
+        Task() = default;
+
+        template <typename Func, typename = std::enable_if_t<!std::is_same<std::decay_t<Func>, Task>::value>>
+        explicit Task(Func&& func)
+        {
+            emplace(std::forward<Func>(func));
+        }
+
+        Task(Task&& other) noexcept { move_from(other); }
+
+        Task(const Task& other) = delete;
+
+        ~Task() { reset(); }
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        Task& operator=(const Task& other) = delete;
+
+        explicit operator bool() const { return invoke_ != nullptr; }
+
+        void operator()() { invoke_(&storage_); }
+
+        void reset()
+        {
+            if (manage_ != nullptr)
+            {
+                manage_(Operation::Destroy, &storage_, nullptr);
+                manage_ = nullptr;
+                invoke_ = nullptr;
+            }
+        }
+
+        /**
+         * @return  true if the function object type is stored without a heap allocation.
+         */
+        template <typename Func>
+        static constexpr bool is_stored_inline()
+        {
+            return (sizeof(Func) <= kInlineSize) && (alignof(Func) <= alignof(std::max_align_t)) &&
+                   std::is_nothrow_move_constructible<Func>::value;
+        }
+
+      private:
+        enum class Operation
+        {
+            Move,
+            Destroy
+        };
+
+        using invoke_t = void (*)(void*);
+        using manage_t = void (*)(Operation, void*, void*);
+
+        template <typename Func>
+        void emplace(Func&& func)
+        {
+            using func_t = std::decay_t<Func>;
+
+            if constexpr (is_stored_inline<func_t>())
+            {
+                new (&storage_) func_t(std::forward<Func>(func));
+
+                invoke_ = [](void* storage) { (*static_cast<func_t*>(storage))(); };
+                manage_ = [](Operation operation, void* storage, void* other) {
+                    if (operation == Operation::Move)
+                    {
+                        new (storage) func_t(std::move(*static_cast<func_t*>(other)));
+                        static_cast<func_t*>(other)->~func_t();
+                    }
+                    else
+                    {
+                        static_cast<func_t*>(storage)->~func_t();
+                    }
+                };
+            }
+            else
+            {
+                // large function objects are kept on the heap, the storage holds the pointer
+                new (&storage_) func_t*(new func_t(std::forward<Func>(func)));
+
+                invoke_ = [](void* storage) { (**static_cast<func_t**>(storage))(); };
+                manage_ = [](Operation operation, void* storage, void* other) {
+                    if (operation == Operation::Move)
+                    {
+                        new (storage) func_t*(*static_cast<func_t**>(other));
+                    }
+                    else
+                    {
+                        delete *static_cast<func_t**>(storage);
+                    }
+                };
+            }
+        }
+
+        void move_from(Task& other) noexcept
+        {
+            if (other.manage_ != nullptr)
+            {
+                other.manage_(Operation::Move, &storage_, &other.storage_);
+                invoke_       = other.invoke_;
+                manage_       = other.manage_;
+                other.invoke_ = nullptr;
+                other.manage_ = nullptr;
+            }
+        }
+
+        std::aligned_storage_t<kInlineSize, alignof(std::max_align_t)> storage_;
+        invoke_t                                                       invoke_ = nullptr;
+        manage_t                                                       manage_ = nullptr;
+    };
+
+    /**
+     * @brief   Counts tasks that have not yet completed, so that they can be waited for without a std::future.
+     *          call add() before posting a task and done() at the end of the task.
+     */
+    class TaskCounter
+    {
+      public:
+        TaskCounter() = default;
+
+        TaskCounter(const TaskCounter& other) = delete;
+
+        TaskCounter& operator=(const TaskCounter& other) = delete;
+
+        ~TaskCounter() { wait(); }
+
+        void add(size_t count = 1)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_ += count;
+        }
+
+        void done()
+        {
+            // notify while holding the lock, so that a waiter cannot return and destroy the counter before the task
+            // has stopped touching it
+            std::lock_guard<std::mutex> lock(mutex_);
+            assert(pending_ > 0);
+            if (--pending_ == 0)
+            {
+                condition_.notify_all();
+            }
+        }
+
+        [[nodiscard]] bool is_done()
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return pending_ == 0;
+        }
+
+        /**
+         * @brief   Block until done() has been called for every task that was added.
+         *          writes made by the tasks before done() are visible to the caller afterwards.
+         */
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this] { return pending_ == 0; });
+        }
+
+      private:
+        size_t                  pending_ = 0;
+        std::mutex              mutex_;
+        std::condition_variable condition_;
+    };
+
+    /**
+     * @brief   Construct a ThreadPool without threads, which runs its tasks when poll() is called.
+     *          the queues are not allocated before the first task is posted.
+     */
     ThreadPool() = default;
 
     explicit ThreadPool(size_t num_threads) { start(num_threads); }
 
-    ThreadPool(ThreadPool&& other) noexcept : ThreadPool() { swap(*this, other); }
+    ThreadPool(ThreadPool&& other) noexcept { swap(*this, other); }
 
     ThreadPool(const ThreadPool& other) = delete;
 
-    ~ThreadPool() { join_all(); }
+    ~ThreadPool()
+    {
+        join_all();
+        delete state_.load();
+    }
 
     ThreadPool& operator=(ThreadPool other)
     {
@@ -88,20 +299,27 @@ class ThreadPool
     {
         using result_t        = typename std::invoke_result<Func, Args...>::type;
         using packaged_task_t = std::packaged_task<result_t()>;
-        auto packed_task =
-            std::make_shared<packaged_task_t>(std::bind(std::forward<Func>(f), std::forward<Args>(args)...));
-        auto future = packed_task->get_future();
 
-        {
-            std::unique_lock<std::mutex> lock(mutex_);
-            constexpr uint32_t           queue_index =
-                std::min(static_cast<uint32_t>(prio), static_cast<uint32_t>(Priority::Default));
-            queues_[queue_index].push_back(std::bind(&packaged_task_t::operator(), packed_task));
-        }
-        condition_.notify_one();
+        packaged_task_t packaged_task(std::bind(std::forward<Func>(f), std::forward<Args>(args)...));
+        auto            future = packaged_task.get_future();
+
+        push(prio, Task(std::move(packaged_task)));
         return future;
     }
 
+    /**
+     * @brief   post work without a std::future to retrieve its result.
+     *          does not allocate memory for function objects that fit into Task::kInlineSize.
+     *
+     * @tparam  Func    function template parameter
+     * @param   f       the function object to execute, must not throw
+     */
+    template <Priority prio = Priority::Default, typename Func>
+    void post_detached(Func&& f)
+    {
+        push(prio, Task(std::forward<Func>(f)));
+    }
+
     /**
      * @brief   Manually poll all queued tasks.
      *          useful when this ThreadPool has no threads
@@ -110,23 +328,19 @@ class ThreadPool
      */
     std::size_t poll()
     {
-        if (!running_ && threads_.empty())
+        State* state = state_.load();
+
+        if ((state != nullptr) && !state->running.load() && threads_.empty())
         {
-            std::unique_lock<std::mutex> lock(mutex_);
-            size_t                       ret = 0;
+            size_t ret = 0;
+            Task   task;
 
-            for (auto& queue : queues_)
+            while (try_pop(*state, 0, task))
             {
-                ret += queue.size();
-                while (!queue.empty())
-                {
-                    auto task = std::move(queue.front());
-                    queue.pop_front();
-                    if (task)
-                    {
-                        task();
-                    }
-                }
+                state->pending.fetch_sub(1);
+                task();
+                task.reset();
+                ++ret;
             }
             return ret;
         }
@@ -138,15 +352,27 @@ class ThreadPool
      */
     void join_all()
     {
+        State* state = state_.load();
+
+        if (state == nullptr)
         {
-            std::unique_lock<std::mutex> lock(mutex_);
-            running_ = false;
-            for (auto& queue : queues_)
-            {
-                queue.clear();
-            }
+            return;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->running.store(false);
         }
-        condition_.notify_all();
+
+        // discard the queued tasks, tasks that have already been started are completed
+        Task task;
+        while (try_pop(*state, 0, task))
+        {
+            state->pending.fetch_sub(1);
+            task.reset();
+        }
+
+        state->condition.notify_all();
 
         for (auto& thread : threads_)
         {
@@ -160,91 +386,311 @@ class ThreadPool
 
     friend void swap(ThreadPool& lhs, ThreadPool& rhs) noexcept
     {
-        std::lock(lhs.mutex_, rhs.mutex_);
-        std::unique_lock<std::mutex> lock_lhs(lhs.mutex_, std::adopt_lock);
-        std::unique_lock<std::mutex> lock_rhs(rhs.mutex_, std::adopt_lock);
-
-        std::swap(lhs.running_, rhs.running_);
+        State* state = lhs.state_.load();
+        lhs.state_.store(rhs.state_.load());
+        rhs.state_.store(state);
         std::swap(lhs.threads_, rhs.threads_);
-
-        for (uint32_t i = 0; i < static_cast<uint32_t>(Priority::NumPriorities); ++i)
-        {
-            std::swap(lhs.queues_[i], rhs.queues_[i]);
-        }
     }
 
   private:
-    using task_t = std::function<void()>;
+    // number of tasks that each queue holds before tasks are moved to the overflow queue
+    static constexpr size_t kQueueCapacity = 256;
 
-    void start(size_t num_threads)
+    // number of times an idle worker checks for new tasks before it goes to sleep
+    static constexpr uint32_t kIdleSpinCount = 16;
+
+    static constexpr uint32_t kNumPriorities = static_cast<uint32_t>(Priority::NumPriorities);
+
+    // bounded multi-producer, multi-consumer queue (D. Vyukov). workers pop from their own queue and steal from the
+    // queues of other workers with the same operation, so both ends accept concurrent callers.
+    class TaskQueue
     {
-        if (num_threads == 0)
+      public:
+        explicit TaskQueue(size_t capacity) : cells_(new Cell[capacity]), mask_(capacity - 1)
         {
-            return;
-        }
+            assert((capacity > 0) && ((capacity & (capacity - 1)) == 0));
 
-        running_ = true;
-        threads_.resize(num_threads);
+            for (size_t i = 0; i < capacity; ++i)
+            {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
 
-        auto worker_fn = [this]() noexcept {
-            task_t task;
+        bool try_push(Task& task)
+        {
+            Cell*  cell = nullptr;
+            size_t pos  = enqueue_pos_.load(std::memory_order_relaxed);
 
             for (;;)
             {
+                cell          = &cells_[pos & mask_];
+                size_t   seq  = cell->sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+                if (diff == 0)
                 {
-                    std::unique_lock<std::mutex> lock(mutex_);
-                    bool                         all_queues_empty = true;
-
-                    // wait for next task
-                    condition_.wait(lock, [this, &all_queues_empty] {
-                        for (const auto& queue : queues_)
-                        {
-                            if (!queue.empty())
-                            {
-                                all_queues_empty = false;
-                                break;
-                            }
-                        }
-                        return !running_ || !all_queues_empty;
-                    });
-
-                    // exit worker if requested and nothing is left in queue
-                    if (!running_ && all_queues_empty)
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
                     {
-                        return;
+                        break;
                     }
+                }
+                else if (diff < 0)
+                {
+                    // queue is full
+                    return false;
+                }
+                else
+                {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->task = std::move(task);
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
 
-                    // grab task from highest prio, non-empty queue
-                    for (auto& queue : queues_)
+        bool try_pop(Task& task)
+        {
+            Cell*  cell = nullptr;
+            size_t pos  = dequeue_pos_.load(std::memory_order_relaxed);
+
+            for (;;)
+            {
+                cell          = &cells_[pos & mask_];
+                size_t   seq  = cell->sequence.load(std::memory_order_acquire);
+                intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+                if (diff == 0)
+                {
+                    if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
                     {
-                        if (!queue.empty())
-                        {
-                            task = std::move(queue.front());
-                            queue.pop_front();
-                            break;
-                        }
+                        break;
                     }
                 }
-
-                // run task
-                if (task)
+                else if (diff < 0)
                 {
-                    task();
+                    // queue is empty
+                    return false;
+                }
+                else
+                {
+                    pos = dequeue_pos_.load(std::memory_order_relaxed);
                 }
             }
+
+            task = std::move(cell->task);
+            cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+            return true;
+        }
+
+      private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            Task                task;
         };
-        for (auto& thread : threads_)
+
+        std::unique_ptr<Cell[]>         cells_;
+        const size_t                    mask_;
+        alignas(64) std::atomic<size_t> enqueue_pos_{ 0 };
+        alignas(64) std::atomic<size_t> dequeue_pos_{ 0 };
+    };
+
+    // state shared with the worker-threads, kept at a fixed address so that pools can be swapped
+    struct State
+    {
+        explicit State(size_t queue_count) : num_queues(queue_count)
         {
-            thread = std::thread(worker_fn);
+            queues.reserve(num_queues * kNumPriorities);
+            for (size_t i = 0; i < (num_queues * kNumPriorities); ++i)
+            {
+                queues.push_back(std::make_unique<TaskQueue>(kQueueCapacity));
+            }
         }
+
+        TaskQueue& queue(uint32_t prio, size_t index) { return *queues[(prio * num_queues) + index]; }
+
+        const size_t                            num_queues;
+        std::vector<std::unique_ptr<TaskQueue>> queues;
+        std::atomic<size_t>                     next_queue{ 0 };
+        std::atomic<int64_t>                    pending{ 0 };
+        std::atomic<uint32_t>                   sleepers{ 0 };
+        std::atomic<bool>                       running{ false };
+        std::mutex                              mutex;
+        std::condition_variable                 condition;
+
+        // tasks that did not fit into any queue
+        std::mutex          overflow_mutex;
+        std::deque<Task>    overflow[kNumPriorities];
+        std::atomic<size_t> overflow_count{ 0 };
+    };
+
+    struct WorkerContext
+    {
+        const State* state = nullptr;
+        size_t       index = 0;
+    };
+
+    static WorkerContext& current_worker()
+    {
+        static thread_local WorkerContext context;
+        return context;
     }
 
-    bool                     running_ = false;
-    std::vector<std::thread> threads_;
+    void start(size_t num_threads)
+    {
+        State* state = new State(std::max<size_t>(num_threads, 1));
+        delete state_.exchange(state);
+
+        if (num_threads == 0)
+        {
+            return;
+        }
+
+        state->running.store(true);
+        threads_.reserve(num_threads);
+
+        for (size_t i = 0; i < num_threads; ++i)
+        {
+            threads_.emplace_back(&ThreadPool::worker_fn, state, i);
+        }
+    }
+
+    State& get_state()
+    {
+        State* state = state_.load(std::memory_order_acquire);
+
+        if (state == nullptr)
+        {
+            // a default constructed pool creates its queue when the first task is posted, which may happen on several
+            // threads at once
+            State* created = new State(1);
 
-    std::mutex              mutex_;
-    std::condition_variable condition_;
-    std::deque<task_t>      queues_[static_cast<uint32_t>(Priority::NumPriorities)];
+            if (state_.compare_exchange_strong(state, created, std::memory_order_acq_rel))
+            {
+                state = created;
+            }
+            else
+            {
+                delete created;
+            }
+        }
+
+        return *state;
+    }
+
+    void push(Priority prio, Task&& task)
+    {
+        State&         state       = get_state();
+        const uint32_t queue_index = std::min(static_cast<uint32_t>(prio), static_cast<uint32_t>(Priority::Default));
+        const auto&    worker      = current_worker();
+
+        // workers keep the tasks they post, other threads spread them over all queues
+        size_t first  = worker.index;
+        bool   pushed = false;
+
+        if (worker.state != &state)
+        {
+            first = state.next_queue.fetch_add(1, std::memory_order_relaxed) % state.num_queues;
+        }
+
+        for (size_t i = 0; (i < state.num_queues) && !pushed; ++i)
+        {
+            pushed = state.queue(queue_index, (first + i) % state.num_queues).try_push(task);
+        }
+
+        if (!pushed)
+        {
+            std::lock_guard<std::mutex> lock(state.overflow_mutex);
+            state.overflow[queue_index].push_back(std::move(task));
+            state.overflow_count.fetch_add(1);
+        }
+
+        // a worker that is about to sleep either sees the pending task, or is seen by the check of sleepers
+        state.pending.fetch_add(1);
+
+        if (state.sleepers.load() > 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock(state.mutex);
+            }
+            state.condition.notify_one();
+        }
+    }
+
+    static bool try_pop(State& state, size_t index, Task& task)
+    {
+        // grab task from highest prio, non-empty queue. the worker's own queue is checked first.
+        for (uint32_t prio = 0; prio < kNumPriorities; ++prio)
+        {
+            for (size_t i = 0; i < state.num_queues; ++i)
+            {
+                if (state.queue(prio, (index + i) % state.num_queues).try_pop(task))
+                {
+                    return true;
+                }
+            }
+
+            if (state.overflow_count.load(std::memory_order_relaxed) > 0)
+            {
+                std::lock_guard<std::mutex> lock(state.overflow_mutex);
+                if (!state.overflow[prio].empty())
+                {
+                    task = std::move(state.overflow[prio].front());
+                    state.overflow[prio].pop_front();
+                    state.overflow_count.fetch_sub(1);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    static void worker_fn(State* state, size_t index) noexcept
+    {
+        current_worker() = { state, index };
+
+        Task     task;
+        uint32_t idle_count = 0;
+
+        for (;;)
+        {
+            if (try_pop(*state, index, task))
+            {
+                state->pending.fetch_sub(1);
+                idle_count = 0;
+
+                // run task
+                task();
+                task.reset();
+            }
+            else if (++idle_count < kIdleSpinCount)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                idle_count = 0;
+
+                // wait for next task
+                std::unique_lock<std::mutex> lock(state->mutex);
+                state->sleepers.fetch_add(1);
+                state->condition.wait(lock, [state] { return !state->running.load() || (state->pending.load() > 0); });
+                state->sleepers.fetch_sub(1);
+
+                // exit worker if requested and nothing is left in queue
+                if (!state->running.load() && (state->pending.load() <= 0))
+                {
+                    current_worker() = {};
+                    return;
+                }
+            }
+        }
+    }
+
+    std::atomic<State*>      state_{ nullptr };
+    std::vector<std::thread> threads_;
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -27,12 +27,56 @@
 #include "util/logging.h"
 
 #include "zstd.h"
+#include "zdict.h"
 
 #include <cinttypes>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
+const int kCompressionLevel = 1;
+
+// Compression and decompression contexts are reused for every block that is processed by a thread, instead of being
+// created and destroyed by each one-shot ZSTD_compress/ZSTD_decompress call.
+struct ZstdThreadContexts
+{
+    ZSTD_CCtx* cctx{ nullptr };
+    ZSTD_DCtx* dctx{ nullptr };
+
+    ~ZstdThreadContexts()
+    {
+        ZSTD_freeCCtx(cctx);
+        ZSTD_freeDCtx(dctx);
+    }
+
+    ZSTD_CCtx* GetCompressionContext()
+    {
+        if (cctx == nullptr)
+        {
+            cctx = ZSTD_createCCtx();
+        }
+        return cctx;
+    }
+
+    ZSTD_DCtx* GetDecompressionContext()
+    {
+        if (dctx == nullptr)
+        {
+            dctx = ZSTD_createDCtx();
+        }
+        return dctx;
+    }
+};
+
+static thread_local ZstdThreadContexts thread_contexts;
+
+ZstdCompressor::ZstdCompressor() : compression_dictionary_(nullptr), decompression_dictionary_(nullptr) {}
+
+ZstdCompressor::~ZstdCompressor()
+{
+    ReleaseDictionary();
+}
+
 size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
                                 const uint8_t*        uncompressed_data,
                                 std::vector<uint8_t>* compressed_data,
@@ -52,12 +96,34 @@ size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
         compressed_data->resize(compressed_data_offset + zstd_compressed_size);
     }
 
-    size_t compressed_size_generated =
-        ZSTD_compress(reinterpret_cast<char*>(compressed_data->data() + compressed_data_offset),
-                      zstd_compressed_size,
-                      reinterpret_cast<const char*>(uncompressed_data),
-                      uncompressed_size,
-                      1);
+    ZSTD_CCtx* cctx = thread_contexts.GetCompressionContext();
+
+    if (cctx == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Failed to create Zstandard compression context");
+        return 0;
+    }
+
+    size_t compressed_size_generated = 0;
+
+    if (compression_dictionary_ != nullptr)
+    {
+        compressed_size_generated = ZSTD_compress_usingCDict(cctx,
+                                                             compressed_data->data() + compressed_data_offset,
+                                                             zstd_compressed_size,
+                                                             uncompressed_data,
+                                                             uncompressed_size,
+                                                             compression_dictionary_);
+    }
+    else
+    {
+        compressed_size_generated = ZSTD_compressCCtx(cctx,
+                                                      compressed_data->data() + compressed_data_offset,
+                                                      zstd_compressed_size,
+                                                      uncompressed_data,
+                                                      uncompressed_size,
+                                                      kCompressionLevel);
+    }
 
     if (!ZSTD_isError(compressed_size_generated))
     {
@@ -71,10 +137,10 @@ size_t ZstdCompressor::Compress(const size_t          uncompressed_size,
     return data_size;
 }
 
-size_t ZstdCompressor::Decompress(const size_t                compressed_size,
-                                  const std::vector<uint8_t>& compressed_data,
-                                  const size_t                expected_uncompressed_size,
-                                  std::vector<uint8_t>*       uncompressed_data)
+size_t ZstdCompressor::Decompress(const size_t          compressed_size,
+                                  const uint8_t*        compressed_data,
+                                  const size_t          expected_uncompressed_size,
+                                  std::vector<uint8_t>* uncompressed_data)
 {
     size_t data_size = 0;
 
@@ -83,10 +149,31 @@ size_t ZstdCompressor::Decompress(const size_t                compressed_size,
         return 0;
     }
 
-    size_t uncompressed_size_generated = ZSTD_decompress(reinterpret_cast<char*>(uncompressed_data->data()),
-                                                         expected_uncompressed_size,
-                                                         reinterpret_cast<const char*>(compressed_data.data()),
-                                                         compressed_size);
+    ZSTD_DCtx* dctx = thread_contexts.GetDecompressionContext();
+
+    if (dctx == nullptr)
+    {
+        GFXRECON_LOG_ERROR("Failed to create Zstandard decompression context");
+        return 0;
+    }
+
+    size_t uncompressed_size_generated = 0;
+
+    // Frames that were compressed without a dictionary are also decoded correctly when a dictionary is set.
+    if (decompression_dictionary_ != nullptr)
+    {
+        uncompressed_size_generated = ZSTD_decompress_usingDDict(dctx,
+                                                                 uncompressed_data->data(),
+                                                                 expected_uncompressed_size,
+                                                                 compressed_data,
+                                                                 compressed_size,
+                                                                 decompression_dictionary_);
+    }
+    else
+    {
+        uncompressed_size_generated = ZSTD_decompressDCtx(
+            dctx, uncompressed_data->data(), expected_uncompressed_size, compressed_data, compressed_size);
+    }
 
     if (!ZSTD_isError(uncompressed_size_generated))
     {
@@ -100,6 +187,62 @@ size_t ZstdCompressor::Decompress(const size_t                compressed_size,
     return data_size;
 }
 
+std::vector<uint8_t> ZstdCompressor::TrainDictionary(const std::vector<uint8_t>& samples,
+                                                     const std::vector<size_t>&  sample_sizes,
+                                                     size_t                      max_dictionary_size)
+{
+    std::vector<uint8_t> dictionary(max_dictionary_size);
+
+    size_t dictionary_size = ZDICT_trainFromBuffer(dictionary.data(),
+                                                   dictionary.size(),
+                                                   samples.data(),
+                                                   sample_sizes.data(),
+                                                   static_cast<unsigned>(sample_sizes.size()));
+
+    if (!ZDICT_isError(dictionary_size))
+    {
+        dictionary.resize(dictionary_size);
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Zstandard dictionary training failed: %s", ZDICT_getErrorName(dictionary_size));
+        dictionary.clear();
+    }
+
+    return dictionary;
+}
+
+bool ZstdCompressor::SetDictionary(const uint8_t* dictionary_data, size_t dictionary_size)
+{
+    ReleaseDictionary();
+
+    if ((dictionary_data == nullptr) || (dictionary_size == 0))
+    {
+        return true;
+    }
+
+    compression_dictionary_   = ZSTD_createCDict(dictionary_data, dictionary_size, kCompressionLevel);
+    decompression_dictionary_ = ZSTD_createDDict(dictionary_data, dictionary_size);
+
+    if ((compression_dictionary_ == nullptr) || (decompression_dictionary_ == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to load Zstandard dictionary");
+        ReleaseDictionary();
+        return false;
+    }
+
+    return true;
+}
+
+void ZstdCompressor::ReleaseDictionary()
+{
+    ZSTD_freeCDict(compression_dictionary_);
+    ZSTD_freeDDict(decompression_dictionary_);
+
+    compression_dictionary_   = nullptr;
+    decompression_dictionary_ = nullptr;
+}
+
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
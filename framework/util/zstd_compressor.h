@@ -25,25 +25,44 @@
 
 #include "util/compressor.h"
 
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
 class ZstdCompressor : public Compressor
 {
   public:
-    ZstdCompressor() {}
+    ZstdCompressor();
 
-    virtual ~ZstdCompressor() override {}
+    virtual ~ZstdCompressor() override;
 
     virtual size_t Compress(const size_t          uncompressed_size,
                             const uint8_t*        uncompressed_data,
                             std::vector<uint8_t>* compressed_data,
                             size_t                compressed_data_offset) override;
 
-    virtual size_t Decompress(const size_t                compressed_size,
-                              const std::vector<uint8_t>& compressed_data,
-                              const size_t                expected_uncompressed_size,
-                              std::vector<uint8_t>*       uncompressed_data) override;
+    virtual size_t Decompress(const size_t          compressed_size,
+                              const uint8_t*        compressed_data,
+                              const size_t          expected_uncompressed_size,
+                              std::vector<uint8_t>* uncompressed_data) override;
+
+    virtual bool SupportsDictionary() const override { return true; }
+
+    virtual std::vector<uint8_t> TrainDictionary(const std::vector<uint8_t>& samples,
+                                                 const std::vector<size_t>&  sample_sizes,
+                                                 size_t                      max_dictionary_size) override;
+
+    virtual bool SetDictionary(const uint8_t* dictionary_data, size_t dictionary_size) override;
+
+  private:
+    void ReleaseDictionary();
+
+  private:
+    // Digested dictionaries are shared by all threads; the compression and decompression contexts are per thread.
+    ZSTD_CDict_s* compression_dictionary_;
+    ZSTD_DDict_s* decompression_dictionary_;
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -0,0 +1,298 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "bench_util.h"
+
+#include "encode/parameter_encoder.h"
+#include "encode/struct_pointer_encoder.h"
+#include "format/format_util.h"
+#include "generated/generated_vulkan_struct_encoders.h"
+#include "util/compressor.h"
+#include "util/memory_output_stream.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <random>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(bench)
+
+const format::ThreadId kThreadId        = 1;
+const format::HandleId kDeviceId        = 1;
+const format::HandleId kCommandBufferId = 2;
+const format::HandleId kFirstBufferId   = 3;
+
+static bool WriteFunctionCallBlock(FILE*                           file,
+                                   format::ApiCallId               call_id,
+                                   const util::MemoryOutputStream& parameters,
+                                   util::Compressor*               compressor,
+                                   std::vector<uint8_t>*           compressed_buffer)
+{
+    const uint8_t* parameter_data = parameters.GetData();
+    size_t         data_size      = parameters.GetDataSize();
+
+    if (compressor != nullptr)
+    {
+        size_t header_size     = sizeof(format::CompressedFunctionCallHeader);
+        size_t compressed_size = compressor->Compress(data_size, parameter_data, compressed_buffer, header_size);
+
+        if ((compressed_size > 0) && (compressed_size < data_size))
+        {
+            auto compressed_header = reinterpret_cast<format::CompressedFunctionCallHeader*>(compressed_buffer->data());
+            compressed_header->block_header.type = format::BlockType::kCompressedFunctionCallBlock;
+            compressed_header->api_call_id       = call_id;
+            compressed_header->thread_id         = kThreadId;
+            compressed_header->uncompressed_size = data_size;
+            compressed_header->block_header.size = sizeof(compressed_header->api_call_id) +
+                                                   sizeof(compressed_header->thread_id) +
+                                                   sizeof(compressed_header->uncompressed_size) + compressed_size;
+
+            return util::platform::FileWrite(compressed_buffer->data(), header_size + compressed_size, file);
+        }
+    }
+
+    format::FunctionCallHeader header;
+    header.block_header.type = format::BlockType::kFunctionCallBlock;
+    header.api_call_id       = call_id;
+    header.thread_id         = kThreadId;
+    header.block_header.size = sizeof(header.api_call_id) + sizeof(header.thread_id) + data_size;
+
+    return util::platform::FileWrite(&header, sizeof(header), file) &&
+           util::platform::FileWrite(parameter_data, data_size, file);
+}
+
+static bool WriteFrameEndMarker(FILE* file, uint64_t frame_number)
+{
+    format::Marker marker;
+    marker.header.type  = format::BlockType::kFrameMarkerBlock;
+    marker.header.size  = sizeof(marker.marker_type) + sizeof(marker.frame_number);
+    marker.marker_type  = format::MarkerType::kEndMarker;
+    marker.frame_number = frame_number;
+
+    return util::platform::FileWrite(&marker, sizeof(marker), file);
+}
+
+SyntheticPipeline::SyntheticPipeline() :
+    stages_{}, bindings_{}, attributes_{}, blend_attachments_{}, dynamic_states_{}, vertex_input_{},
+    input_assembly_{}, viewport_{}, rasterization_{}, multisample_{}, depth_stencil_{}, color_blend_{}, dynamic_{},
+    create_info_{}
+{
+    static const char kEntryPoint[] = "main";
+
+    stages_[0].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages_[0].stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stages_[0].pName = kEntryPoint;
+    stages_[1].sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    stages_[1].stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+    stages_[1].pName = kEntryPoint;
+
+    for (uint32_t i = 0; i < bindings_.size(); ++i)
+    {
+        bindings_[i].binding   = i;
+        bindings_[i].stride    = 32;
+        bindings_[i].inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+    }
+
+    for (uint32_t i = 0; i < attributes_.size(); ++i)
+    {
+        attributes_[i].location = i;
+        attributes_[i].binding  = i % bindings_.size();
+        attributes_[i].format   = VK_FORMAT_R32G32B32A32_SFLOAT;
+        attributes_[i].offset   = (i / bindings_.size()) * 16;
+    }
+
+    for (auto& attachment : blend_attachments_)
+    {
+        attachment.blendEnable    = VK_TRUE;
+        attachment.colorWriteMask = VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT |
+                                    VK_COLOR_COMPONENT_A_BIT;
+    }
+
+    dynamic_states_ = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR, VK_DYNAMIC_STATE_BLEND_CONSTANTS };
+
+    vertex_input_.sType                           = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
+    vertex_input_.vertexBindingDescriptionCount   = static_cast<uint32_t>(bindings_.size());
+    vertex_input_.pVertexBindingDescriptions      = bindings_.data();
+    vertex_input_.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributes_.size());
+    vertex_input_.pVertexAttributeDescriptions    = attributes_.data();
+
+    input_assembly_.sType    = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
+    input_assembly_.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    viewport_.sType         = VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO;
+    viewport_.viewportCount = 1;
+    viewport_.scissorCount  = 1;
+
+    rasterization_.sType       = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO;
+    rasterization_.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterization_.cullMode    = VK_CULL_MODE_BACK_BIT;
+    rasterization_.frontFace   = VK_FRONT_FACE_COUNTER_CLOCKWISE;
+    rasterization_.lineWidth   = 1.0f;
+
+    multisample_.sType                = VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO;
+    multisample_.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    depth_stencil_.sType            = VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO;
+    depth_stencil_.depthTestEnable  = VK_TRUE;
+    depth_stencil_.depthWriteEnable = VK_TRUE;
+    depth_stencil_.depthCompareOp   = VK_COMPARE_OP_LESS_OR_EQUAL;
+
+    color_blend_.sType           = VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO;
+    color_blend_.attachmentCount = static_cast<uint32_t>(blend_attachments_.size());
+    color_blend_.pAttachments    = blend_attachments_.data();
+
+    dynamic_.sType             = VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO;
+    dynamic_.dynamicStateCount = static_cast<uint32_t>(dynamic_states_.size());
+    dynamic_.pDynamicStates    = dynamic_states_.data();
+
+    create_info_.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
+    create_info_.stageCount          = static_cast<uint32_t>(stages_.size());
+    create_info_.pStages             = stages_.data();
+    create_info_.pVertexInputState   = &vertex_input_;
+    create_info_.pInputAssemblyState = &input_assembly_;
+    create_info_.pViewportState      = &viewport_;
+    create_info_.pRasterizationState = &rasterization_;
+    create_info_.pMultisampleState   = &multisample_;
+    create_info_.pDepthStencilState  = &depth_stencil_;
+    create_info_.pColorBlendState    = &color_blend_;
+    create_info_.pDynamicState       = &dynamic_;
+    create_info_.basePipelineIndex   = -1;
+}
+
+std::string GetTempFilePath(const std::string& filename)
+{
+    return (std::filesystem::temp_directory_path() / filename).string();
+}
+
+std::vector<uint8_t> GenerateResourceData(size_t size, uint32_t seed)
+{
+    std::vector<uint8_t>                    data(size);
+    std::mt19937                            rng(seed);
+    std::uniform_int_distribution<uint32_t> byte_dist(0, 255);
+    std::uniform_int_distribution<size_t>   run_dist(1, 64);
+
+    size_t offset = 0;
+    while (offset < size)
+    {
+        size_t  run_size = std::min(run_dist(rng), size - offset);
+        uint8_t value    = static_cast<uint8_t>(byte_dist(rng));
+
+        // Alternate between runs of a repeated value and runs of random bytes.
+        if ((value & 1) == 0)
+        {
+            std::fill(data.begin() + offset, data.begin() + offset + run_size, value);
+        }
+        else
+        {
+            for (size_t i = 0; i < run_size; ++i)
+            {
+                data[offset + i] = static_cast<uint8_t>(byte_dist(rng));
+            }
+        }
+
+        offset += run_size;
+    }
+
+    return data;
+}
+
+bool WriteSyntheticCapture(const std::string& filename, const SyntheticCaptureOptions& options)
+{
+    FILE* file = nullptr;
+    if ((util::platform::FileOpen(&file, filename.c_str(), "wb") != 0) || (file == nullptr))
+    {
+        return false;
+    }
+
+    std::vector<format::FileOptionPair> option_list;
+    option_list.push_back({ format::FileOption::kCompressionType, options.compression_type });
+    if (options.parameter_encoding != format::ParameterEncoding::kFixedSize)
+    {
+        option_list.push_back({ format::FileOption::kParameterEncoding, options.parameter_encoding });
+    }
+
+    format::FileHeader file_header;
+    file_header.fourcc        = GFXRECON_FOURCC;
+    file_header.major_version = 0;
+    file_header.minor_version = 0;
+    file_header.num_options   = static_cast<uint32_t>(option_list.size());
+
+    bool success = util::platform::FileWrite(&file_header, sizeof(file_header), file) &&
+                   util::platform::FileWrite(
+                       option_list.data(), option_list.size() * sizeof(format::FileOptionPair), file);
+
+    std::unique_ptr<util::Compressor> compressor(format::CreateCompressor(options.compression_type));
+    std::vector<uint8_t>              compressed_buffer;
+    util::MemoryOutputStream          parameters;
+    encode::ParameterEncoder          encoder(&parameters, options.parameter_encoding);
+    format::HandleId                  next_buffer_id = kFirstBufferId;
+
+    VkBufferCreateInfo buffer_info = {};
+    buffer_info.sType              = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    buffer_info.usage              = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    buffer_info.sharingMode        = VK_SHARING_MODE_EXCLUSIVE;
+
+    for (uint32_t frame = 0; success && (frame < options.frame_count); ++frame)
+    {
+        for (uint32_t i = 0; success && (i < options.buffers_per_frame); ++i)
+        {
+            format::HandleId buffer_id = next_buffer_id++;
+            buffer_info.size           = (i + 1) * 256;
+
+            parameters.Clear();
+            encoder.EncodeHandleIdValue(kDeviceId);
+            encode::EncodeStructPtr(&encoder, &buffer_info);
+            encode::EncodeStructPtr<VkAllocationCallbacks>(&encoder, nullptr);
+            encoder.EncodeHandleIdPtr(&buffer_id);
+            encoder.EncodeEnumValue(VK_SUCCESS);
+
+            success = WriteFunctionCallBlock(
+                file, format::ApiCallId::ApiCall_vkCreateBuffer, parameters, compressor.get(), &compressed_buffer);
+        }
+
+        for (uint32_t i = 0; success && (i < options.draws_per_frame); ++i)
+        {
+            parameters.Clear();
+            encoder.EncodeHandleIdValue(kCommandBufferId);
+            encoder.EncodeUInt32Value(3 * (i + 1));
+            encoder.EncodeUInt32Value(1);
+            encoder.EncodeUInt32Value(i);
+            encoder.EncodeUInt32Value(0);
+
+            success = WriteFunctionCallBlock(
+                file, format::ApiCallId::ApiCall_vkCmdDraw, parameters, compressor.get(), &compressed_buffer);
+        }
+
+        success = success && WriteFrameEndMarker(file, frame);
+    }
+
+    util::platform::FileClose(file);
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(bench)
+GFXRECON_END_NAMESPACE(gfxrecon)
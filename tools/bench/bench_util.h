@@ -0,0 +1,92 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_TOOLS_BENCH_UTIL_H
+#define GFXRECON_TOOLS_BENCH_UTIL_H
+
+#include "format/format.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(bench)
+
+struct SyntheticCaptureOptions
+{
+    uint32_t                  frame_count{ 10 };
+    uint32_t                  buffers_per_frame{ 100 };
+    uint32_t                  draws_per_frame{ 1000 };
+    format::CompressionType   compression_type{ format::CompressionType::kNone };
+    format::ParameterEncoding parameter_encoding{ format::ParameterEncoding::kFixedSize };
+};
+
+// A graphics pipeline description with the nested structures and arrays of a typical application pipeline, used to
+// exercise the generated struct encoders and decoders.
+class SyntheticPipeline
+{
+  public:
+    SyntheticPipeline();
+
+    SyntheticPipeline(const SyntheticPipeline&) = delete;
+
+    SyntheticPipeline& operator=(const SyntheticPipeline&) = delete;
+
+    const VkGraphicsPipelineCreateInfo& GetCreateInfo() const { return create_info_; }
+
+  private:
+    std::array<VkPipelineShaderStageCreateInfo, 2>     stages_;
+    std::array<VkVertexInputBindingDescription, 2>     bindings_;
+    std::array<VkVertexInputAttributeDescription, 4>   attributes_;
+    std::array<VkPipelineColorBlendAttachmentState, 4> blend_attachments_;
+    std::array<VkDynamicState, 3>                      dynamic_states_;
+    VkPipelineVertexInputStateCreateInfo               vertex_input_;
+    VkPipelineInputAssemblyStateCreateInfo             input_assembly_;
+    VkPipelineViewportStateCreateInfo                  viewport_;
+    VkPipelineRasterizationStateCreateInfo             rasterization_;
+    VkPipelineMultisampleStateCreateInfo               multisample_;
+    VkPipelineDepthStencilStateCreateInfo              depth_stencil_;
+    VkPipelineColorBlendStateCreateInfo                color_blend_;
+    VkPipelineDynamicStateCreateInfo                   dynamic_;
+    VkGraphicsPipelineCreateInfo                       create_info_;
+};
+
+// Returns a path in the system temporary directory for a file written by a benchmark.
+std::string GetTempFilePath(const std::string& filename);
+
+// Returns data that compresses like typical resource uploads: runs of repeated values mixed with random bytes.
+std::vector<uint8_t> GenerateResourceData(size_t size, uint32_t seed);
+
+// Writes a Vulkan capture file containing vkCreateBuffer and vkCmdDraw calls, with an end of frame marker after each
+// frame.  The calls are encoded with the capture ParameterEncoder, so the file is readable by FileProcessor.
+bool WriteSyntheticCapture(const std::string& filename, const SyntheticCaptureOptions& options);
+
+GFXRECON_END_NAMESPACE(bench)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_TOOLS_BENCH_UTIL_H
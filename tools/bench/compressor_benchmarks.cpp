@@ -0,0 +1,94 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "bench_util.h"
+
+#include "format/format.h"
+#include "format/format_util.h"
+#include "util/compressor.h"
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(bench)
+
+const size_t kLargePayloadSize = 16 * 1024 * 1024;
+const size_t kSmallPayloadSize = 256;
+const size_t kSmallBlockCount  = 4096;
+
+TEST_CASE("Compressor throughput", "[bench][compressor]")
+{
+    auto compression_type = GENERATE(format::CompressionType::kLz4,
+                                     format::CompressionType::kZlib,
+                                     format::CompressionType::kZstd);
+
+    const std::string                 name = format::GetCompressionTypeName(compression_type);
+    std::unique_ptr<util::Compressor> compressor(format::CreateCompressor(compression_type));
+    if (compressor == nullptr)
+    {
+        WARN(name << " compression is not supported by this build");
+        return;
+    }
+
+    std::vector<uint8_t> large_data = GenerateResourceData(kLargePayloadSize, 1);
+    std::vector<uint8_t> small_data = GenerateResourceData(kSmallPayloadSize * kSmallBlockCount, 2);
+    std::vector<uint8_t> compressed;
+    std::vector<uint8_t> decompressed(kLargePayloadSize);
+
+    size_t compressed_size = compressor->Compress(large_data.size(), large_data.data(), &compressed, 0);
+    REQUIRE(compressed_size > 0);
+    REQUIRE(compressor->Decompress(compressed_size, compressed, large_data.size(), &decompressed) ==
+            large_data.size());
+    REQUIRE(decompressed == large_data);
+
+    BENCHMARK(name + " compress 16 MiB")
+    {
+        return compressor->Compress(large_data.size(), large_data.data(), &compressed, 0);
+    };
+
+    compressed_size = compressor->Compress(large_data.size(), large_data.data(), &compressed, 0);
+
+    BENCHMARK(name + " decompress 16 MiB")
+    {
+        return compressor->Decompress(compressed_size, compressed, large_data.size(), &decompressed);
+    };
+
+    // Parameter buffers are compressed one API call at a time, so per-call overhead dominates for small blocks.
+    BENCHMARK(name + " compress 4096 x 256 byte blocks")
+    {
+        size_t total_size = 0;
+        for (size_t i = 0; i < kSmallBlockCount; ++i)
+        {
+            total_size +=
+                compressor->Compress(kSmallPayloadSize, small_data.data() + (i * kSmallPayloadSize), &compressed, 0);
+        }
+        return total_size;
+    };
+}
+
+GFXRECON_END_NAMESPACE(bench)
+GFXRECON_END_NAMESPACE(gfxrecon)
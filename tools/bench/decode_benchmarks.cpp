@@ -0,0 +1,120 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "bench_util.h"
+
+#include "decode/decode_allocator.h"
+#include "decode/struct_pointer_decoder.h"
+#include "decode/value_decoder.h"
+#include "encode/parameter_encoder.h"
+#include "encode/struct_pointer_encoder.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_struct_decoders.h"
+#include "generated/generated_vulkan_struct_encoders.h"
+#include "util/memory_output_stream.h"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(bench)
+
+const uint32_t kDecodedCallCount   = 10000;
+const uint32_t kDecodedStructCount = 1000;
+
+TEST_CASE("StructPointerDecoder throughput", "[bench][decode]")
+{
+    auto encoding = GENERATE(format::ParameterEncoding::kFixedSize, format::ParameterEncoding::kCompact);
+
+    const std::string name = (encoding == format::ParameterEncoding::kCompact) ? "compact" : "fixed size";
+
+    util::MemoryOutputStream pipeline_stream;
+    util::MemoryOutputStream draw_stream;
+    encode::ParameterEncoder pipeline_encoder(&pipeline_stream, encoding);
+    encode::ParameterEncoder draw_encoder(&draw_stream, encoding);
+    SyntheticPipeline        pipeline;
+
+    encode::EncodeStructPtr(&pipeline_encoder, &pipeline.GetCreateInfo());
+
+    draw_encoder.EncodeHandleIdValue(2);
+    draw_encoder.EncodeUInt32Value(3);
+    draw_encoder.EncodeUInt32Value(1);
+    draw_encoder.EncodeUInt32Value(0);
+    draw_encoder.EncodeUInt32Value(0);
+
+    const uint8_t* pipeline_data = pipeline_stream.GetData();
+    const size_t   pipeline_size = pipeline_stream.GetDataSize();
+    const uint8_t* draw_data     = draw_stream.GetData();
+    const size_t   draw_size     = draw_stream.GetDataSize();
+
+    auto previous_encoding = decode::ValueDecoder::GetParameterEncoding();
+    decode::ValueDecoder::SetParameterEncoding(encoding);
+
+    {
+        decode::DecodeAllocator::Begin();
+        decode::StructPointerDecoder<decode::Decoded_VkGraphicsPipelineCreateInfo> decoder;
+        REQUIRE(decoder.Decode(pipeline_data, pipeline_size) == pipeline_size);
+        REQUIRE(decoder.GetPointer()->stageCount == pipeline.GetCreateInfo().stageCount);
+        REQUIRE(decoder.GetPointer()->pColorBlendState->attachmentCount ==
+                pipeline.GetCreateInfo().pColorBlendState->attachmentCount);
+        decode::DecodeAllocator::End();
+    }
+
+    BENCHMARK("Decode 1000 VkGraphicsPipelineCreateInfo, " + name)
+    {
+        size_t bytes_read = 0;
+        for (uint32_t i = 0; i < kDecodedStructCount; ++i)
+        {
+            // Each decoded block allocates from the DecodeAllocator between Begin and End, as in FileProcessor.
+            decode::DecodeAllocator::Begin();
+            decode::StructPointerDecoder<decode::Decoded_VkGraphicsPipelineCreateInfo> decoder;
+            bytes_read += decoder.Decode(pipeline_data, pipeline_size);
+            decode::DecodeAllocator::End();
+        }
+        return bytes_read;
+    };
+
+    BENCHMARK("Decode 10000 vkCmdDraw calls, " + name)
+    {
+        size_t bytes_read = 0;
+        for (uint32_t i = 0; i < kDecodedCallCount; ++i)
+        {
+            format::HandleId command_buffer;
+            uint32_t         values[4];
+
+            size_t offset = decode::ValueDecoder::DecodeHandleIdValue(draw_data, draw_size, &command_buffer);
+            for (uint32_t& value : values)
+            {
+                offset += decode::ValueDecoder::DecodeUInt32Value(draw_data + offset, draw_size - offset, &value);
+            }
+            bytes_read += offset + values[0];
+        }
+        return bytes_read;
+    };
+
+    decode::ValueDecoder::SetParameterEncoding(previous_encoding);
+}
+
+GFXRECON_END_NAMESPACE(bench)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,169 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "bench_util.h"
+
+#include "encode/parameter_buffer.h"
+#include "encode/parameter_encoder.h"
+#include "encode/struct_pointer_encoder.h"
+#include "encode/vulkan_handle_wrapper_util.h"
+#include "encode/vulkan_handle_wrappers.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_struct_encoders.h"
+#include "util/memory_output_stream.h"
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(bench)
+
+const uint32_t kEncodedCallCount   = 10000;
+const size_t   kHandleArrayLength  = 64;
+const uint32_t kEncodedStructCount = 1000;
+const uint32_t kDescriptorSetCount = 4;
+
+static format::HandleId GetDescriptorSetId()
+{
+    static format::HandleId next_id = 100;
+    return next_id++;
+}
+
+TEST_CASE("ParameterEncoder throughput", "[bench][encode]")
+{
+    auto encoding = GENERATE(format::ParameterEncoding::kFixedSize, format::ParameterEncoding::kCompact);
+
+    const std::string name = (encoding == format::ParameterEncoding::kCompact) ? "compact" : "fixed size";
+
+    util::MemoryOutputStream stream;
+    encode::ParameterEncoder encoder(&stream, encoding);
+    SyntheticPipeline        pipeline;
+
+    std::vector<format::HandleId> handle_ids(kHandleArrayLength);
+    for (size_t i = 0; i < handle_ids.size(); ++i)
+    {
+        handle_ids[i] = 1000 + i;
+    }
+
+    BENCHMARK("Encode 10000 vkCmdDraw calls, " + name)
+    {
+        for (uint32_t i = 0; i < kEncodedCallCount; ++i)
+        {
+            stream.Clear();
+            encoder.EncodeHandleIdValue(i);
+            encoder.EncodeUInt32Value(3 * i);
+            encoder.EncodeUInt32Value(1);
+            encoder.EncodeUInt32Value(i);
+            encoder.EncodeUInt32Value(0);
+        }
+        return stream.GetDataSize();
+    };
+
+    BENCHMARK("Encode 10000 handle ID arrays of 64, " + name)
+    {
+        for (uint32_t i = 0; i < kEncodedCallCount; ++i)
+        {
+            stream.Clear();
+            encoder.EncodeHandleIdArray(handle_ids.data(), handle_ids.size());
+        }
+        return stream.GetDataSize();
+    };
+
+    BENCHMARK("Encode 1000 VkGraphicsPipelineCreateInfo, " + name)
+    {
+        stream.Clear();
+        for (uint32_t i = 0; i < kEncodedStructCount; ++i)
+        {
+            encode::EncodeStructPtr(&encoder, &pipeline.GetCreateInfo());
+        }
+        return stream.GetDataSize();
+    };
+}
+
+TEST_CASE("ParameterEncoder wrapped handle throughput", "[bench][encode]")
+{
+    // Wrapped handles for the parameters of the encoded commands.
+    VkDescriptorSet descriptor_sets[kDescriptorSetCount];
+
+    for (uint32_t i = 0; i < kDescriptorSetCount; ++i)
+    {
+        descriptor_sets[i] = format::FromHandleId<VkDescriptorSet>(0x100 + i);
+        encode::vulkan_wrappers::CreateWrappedHandle<encode::vulkan_wrappers::DeviceWrapper,
+                                                     encode::vulkan_wrappers::NoParentWrapper,
+                                                     encode::vulkan_wrappers::DescriptorSetWrapper>(
+            VK_NULL_HANDLE,
+            encode::vulkan_wrappers::NoParentWrapper::kHandleValue,
+            &descriptor_sets[i],
+            GetDescriptorSetId);
+    }
+
+    const uint32_t dynamic_offsets[] = { 0, 256 };
+
+    encode::ParameterBuffer  buffer;
+    encode::ParameterEncoder encoder(&buffer);
+
+    // Parameter encoding of the generated vkCmdDrawIndexed and vkCmdBindDescriptorSets encoders, with the command
+    // buffer and pipeline layout handles encoded through the same wrapper lookup as the descriptor sets.
+    BENCHMARK("Encode 10000 vkCmdDrawIndexed calls with wrapped handles")
+    {
+        for (uint32_t i = 0; i < kEncodedCallCount; ++i)
+        {
+            buffer.ClearWithHeader(sizeof(format::FunctionCallHeader));
+            encoder.EncodeVulkanHandleValue<encode::vulkan_wrappers::DescriptorSetWrapper>(descriptor_sets[0]);
+            encoder.EncodeUInt32Value(36);
+            encoder.EncodeUInt32Value(1);
+            encoder.EncodeUInt32Value(i);
+            encoder.EncodeInt32Value(0);
+            encoder.EncodeUInt32Value(0);
+        }
+        return buffer.GetDataSize();
+    };
+
+    BENCHMARK("Encode 10000 vkCmdBindDescriptorSets calls with wrapped handles")
+    {
+        for (uint32_t i = 0; i < kEncodedCallCount; ++i)
+        {
+            buffer.ClearWithHeader(sizeof(format::FunctionCallHeader));
+            encoder.EncodeVulkanHandleValue<encode::vulkan_wrappers::DescriptorSetWrapper>(descriptor_sets[0]);
+            encoder.EncodeEnumValue(VK_PIPELINE_BIND_POINT_GRAPHICS);
+            encoder.EncodeVulkanHandleValue<encode::vulkan_wrappers::DescriptorSetWrapper>(descriptor_sets[1]);
+            encoder.EncodeUInt32Value(0);
+            encoder.EncodeUInt32Value(kDescriptorSetCount);
+            encoder.EncodeVulkanHandleArray<encode::vulkan_wrappers::DescriptorSetWrapper>(descriptor_sets,
+                                                                                           kDescriptorSetCount);
+            encoder.EncodeUInt32Value(2);
+            encoder.EncodeUInt32Array(dynamic_offsets, 2);
+        }
+        return buffer.GetDataSize();
+    };
+
+    for (auto descriptor_set : descriptor_sets)
+    {
+        encode::vulkan_wrappers::DestroyWrappedHandle<encode::vulkan_wrappers::DescriptorSetWrapper>(descriptor_set);
+    }
+}
+
+GFXRECON_END_NAMESPACE(bench)
+GFXRECON_END_NAMESPACE(gfxrecon)
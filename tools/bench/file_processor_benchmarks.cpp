@@ -0,0 +1,183 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include PROJECT_VERSION_HEADER_FILE
+#include "bench_util.h"
+
+#include "decode/file_processor.h"
+#include "decode/json_writer.h"
+#include "decode/marker_json_consumer.h"
+#include "decode/metadata_json_consumer.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "generated/generated_vulkan_json_consumer.h"
+#include "util/compressor.h"
+#include "util/json_util.h"
+#include "util/memory_output_stream.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(bench)
+
+using VulkanJsonConsumer = decode::MetadataJsonConsumer<decode::MarkerJsonConsumer<decode::VulkanExportJsonConsumer>>;
+
+const uint32_t kCaptureFrameCount      = 10;
+const uint32_t kCaptureBuffersPerFrame = 100;
+const uint32_t kCaptureDrawsPerFrame   = 1000;
+
+// Removes the capture file when the benchmark completes.
+class SyntheticCaptureFile
+{
+  public:
+    SyntheticCaptureFile(format::CompressionType compression_type) :
+        filename_(GetTempFilePath("gfxrecon_bench_" + format::GetCompressionTypeName(compression_type) + ".gfxr"))
+    {
+        SyntheticCaptureOptions options;
+        options.frame_count       = kCaptureFrameCount;
+        options.buffers_per_frame = kCaptureBuffersPerFrame;
+        options.draws_per_frame   = kCaptureDrawsPerFrame;
+        options.compression_type  = compression_type;
+
+        valid_ = WriteSyntheticCapture(filename_, options);
+    }
+
+    ~SyntheticCaptureFile() { std::remove(filename_.c_str()); }
+
+    bool IsValid() const { return valid_; }
+
+    const std::string& GetFilename() const { return filename_; }
+
+    uint64_t GetFileSize() const { return std::filesystem::file_size(filename_); }
+
+  private:
+    std::string filename_;
+    bool        valid_{ false };
+};
+
+static uint64_t ProcessCapture(const std::string& filename, bool use_memory_mapped_file, decode::ApiDecoder* decoder)
+{
+    decode::FileProcessor file_processor;
+    file_processor.SetUseMemoryMappedFile(use_memory_mapped_file);
+
+    if (decoder != nullptr)
+    {
+        file_processor.AddDecoder(decoder);
+    }
+
+    if (!file_processor.Initialize(filename) || !file_processor.ProcessAllFrames())
+    {
+        return 0;
+    }
+
+    return file_processor.GetNumBytesRead();
+}
+
+static uint64_t ConvertCaptureToJson(const std::string& filename)
+{
+    decode::FileProcessor file_processor;
+    if (!file_processor.Initialize(filename))
+    {
+        return 0;
+    }
+
+    util::MemoryOutputStream out_stream;
+    VulkanJsonConsumer       json_consumer;
+    util::JsonOptions        json_options;
+    decode::VulkanDecoder    decoder;
+    decoder.AddConsumer(&json_consumer);
+    file_processor.AddDecoder(&decoder);
+
+    decode::JsonWriter json_writer{ json_options, GFXRECON_PROJECT_VERSION_STRING, filename };
+    file_processor.SetAnnotationProcessor(&json_writer);
+
+    const std::string vulkan_version{ std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE)) + "." +
+                                      std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE)) + "." +
+                                      std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE)) };
+    json_consumer.Initialize(&json_writer, vulkan_version);
+    json_writer.StartStream(&out_stream);
+
+    bool success = file_processor.ProcessAllFrames();
+
+    json_writer.EndStream();
+    json_consumer.Destroy();
+
+    return success ? out_stream.GetDataSize() : 0;
+}
+
+TEST_CASE("FileProcessor block throughput", "[bench][file_processor]")
+{
+    auto compression_type = GENERATE(format::CompressionType::kNone,
+                                     format::CompressionType::kLz4,
+                                     format::CompressionType::kZstd);
+
+    const std::string                 name = format::GetCompressionTypeName(compression_type);
+    std::unique_ptr<util::Compressor> compressor(format::CreateCompressor(compression_type));
+    if ((compression_type != format::CompressionType::kNone) && (compressor == nullptr))
+    {
+        WARN(name << " compression is not supported by this build");
+        return;
+    }
+
+    SyntheticCaptureFile capture(compression_type);
+    REQUIRE(capture.IsValid());
+
+    decode::VulkanDecoder decoder;
+    REQUIRE(ProcessCapture(capture.GetFilename(), true, &decoder) == capture.GetFileSize());
+
+    BENCHMARK("Read blocks, memory mapped, " + name)
+    {
+        return ProcessCapture(capture.GetFilename(), true, nullptr);
+    };
+
+    BENCHMARK("Read blocks, buffered, " + name)
+    {
+        return ProcessCapture(capture.GetFilename(), false, nullptr);
+    };
+
+    BENCHMARK("Decode blocks, memory mapped, " + name)
+    {
+        return ProcessCapture(capture.GetFilename(), true, &decoder);
+    };
+}
+
+TEST_CASE("JSON conversion throughput", "[bench][convert]")
+{
+    SyntheticCaptureFile capture(format::CompressionType::kNone);
+    REQUIRE(capture.IsValid());
+    REQUIRE(ConvertCaptureToJson(capture.GetFilename()) > 0);
+
+    BENCHMARK("Convert to JSON")
+    {
+        return ConvertCaptureToJson(capture.GetFilename());
+    };
+}
+
+GFXRECON_END_NAMESPACE(bench)
+GFXRECON_END_NAMESPACE(gfxrecon)
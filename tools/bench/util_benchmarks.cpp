@@ -0,0 +1,403 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include "util/hash.h"
+#include "util/image_writer.h"
+#include "util/memory_diff.h"
+#include "util/monotonic_allocator.h"
+#include "util/paged_id_map.h"
+#include "util/sharded_hash_map.h"
+#include "util/threadpool.h"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(bench)
+
+const size_t   kAllocationCount     = 100000;
+const size_t   kAllocatorBlockSize  = 64 * 1024;
+const size_t   kThreadPoolTaskCount = 100000;
+const size_t   kDiffMemorySize      = 64 * 1024 * 1024;
+const size_t   kDiffModifiedCount   = 4096;
+const size_t   kDiffPageSize        = 4096;
+const size_t   kHashDataSize        = 64 * 1024 * 1024;
+const size_t   kObjectCount         = 100000;
+const size_t   kBindCount           = 1000000;
+const size_t   kHandleThreadCount   = 8;
+const size_t   kHandlesPerThread    = 1024;
+const size_t   kLookupsPerInsert    = 8;
+const size_t   kHandleIterations    = 4;
+const uint32_t kImageWidth          = 3840;
+const uint32_t kImageHeight         = 2160;
+
+struct AllocatedObject
+{
+    uint64_t handle_id;
+    uint32_t values[6];
+};
+
+TEST_CASE("MonotonicAllocator throughput", "[bench][allocator]")
+{
+    util::MonotonicAllocator allocator(kAllocatorBlockSize);
+
+    BENCHMARK("MonotonicAllocator 100000 allocations")
+    {
+        uint64_t sum = 0;
+        for (size_t i = 0; i < kAllocationCount; ++i)
+        {
+            auto object = allocator.Allocate<AllocatedObject>(1 + (i % 4));
+            sum += reinterpret_cast<uintptr_t>(object);
+        }
+        allocator.Clear(false);
+        return sum;
+    };
+
+    BENCHMARK("operator new 100000 allocations")
+    {
+        std::vector<std::unique_ptr<AllocatedObject[]>> objects(kAllocationCount);
+        for (size_t i = 0; i < kAllocationCount; ++i)
+        {
+            objects[i] = std::make_unique<AllocatedObject[]>(1 + (i % 4));
+        }
+        return objects.size();
+    };
+}
+
+TEST_CASE("ThreadPool throughput", "[bench][threadpool]")
+{
+    util::ThreadPool thread_pool(std::max(2u, std::thread::hardware_concurrency()));
+
+    BENCHMARK("ThreadPool 100000 detached tasks")
+    {
+        std::atomic<size_t> counter{ 0 };
+        for (size_t i = 0; i < kThreadPoolTaskCount; ++i)
+        {
+            thread_pool.post_detached([&counter]() { ++counter; });
+        }
+        while (counter.load() < kThreadPoolTaskCount)
+        {
+            std::this_thread::yield();
+        }
+        return counter.load();
+    };
+
+    BENCHMARK("ThreadPool 100000 tasks with futures")
+    {
+        std::vector<std::future<size_t>> results;
+        results.reserve(kThreadPoolTaskCount);
+        for (size_t i = 0; i < kThreadPoolTaskCount; ++i)
+        {
+            results.push_back(thread_pool.post([](size_t value) { return value; }, i));
+        }
+
+        size_t sum = 0;
+        for (auto& result : results)
+        {
+            sum += result.get();
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("PageGuardManager memory diff throughput", "[bench][page_guard]")
+{
+    std::vector<uint8_t>                  previous(kDiffMemorySize, 0);
+    std::vector<uint8_t>                  current(kDiffMemorySize, 0);
+    std::vector<util::MemoryRange>        ranges;
+    std::mt19937                          rng(1234);
+    std::uniform_int_distribution<size_t> offset_dist(0, kDiffMemorySize - 1);
+
+    // Scattered small writes, as with per-frame uniform and staging buffer updates.
+    for (size_t i = 0; i < kDiffModifiedCount; ++i)
+    {
+        current[offset_dist(rng)] = 1;
+    }
+
+    util::FindModifiedRanges(
+        current.data(), previous.data(), kDiffMemorySize, util::kDefaultMemoryDiffMergeDistance, &ranges);
+    REQUIRE(!ranges.empty());
+
+    BENCHMARK("FindModifiedRanges 64 MiB")
+    {
+        util::FindModifiedRanges(
+            current.data(), previous.data(), kDiffMemorySize, util::kDefaultMemoryDiffMergeDistance, &ranges);
+        return ranges.size();
+    };
+
+    BENCHMARK("memcmp per page 64 MiB")
+    {
+        size_t modified = 0;
+        for (size_t offset = 0; offset < kDiffMemorySize; offset += kDiffPageSize)
+        {
+            modified += (memcmp(current.data() + offset, previous.data() + offset, kDiffPageSize) != 0) ? 1 : 0;
+        }
+        return modified;
+    };
+
+    BENCHMARK("memcpy 64 MiB")
+    {
+        memcpy(previous.data(), current.data(), kDiffMemorySize);
+        return previous[0];
+    };
+}
+
+TEST_CASE("Hash throughput", "[bench][hash]")
+{
+    std::vector<uint8_t> data(kHashDataSize);
+    for (size_t i = 0; i < kHashDataSize; ++i)
+    {
+        data[i] = static_cast<uint8_t>(i ^ (i >> 8));
+    }
+
+    BENCHMARK("GenerateHash64 64 MiB")
+    {
+        return util::hash::GenerateHash64(data.data(), data.size());
+    };
+
+    BENCHMARK("GenerateCheckSum 64 MiB")
+    {
+        return util::hash::GenerateCheckSum<uint64_t>(data.data(), data.size());
+    };
+}
+
+// Stand-in for the replay object info structures, which hold a handle and a variable amount of additional state.
+struct ObjectInfo
+{
+    uint64_t handle{ 0 };
+    uint64_t capture_id{ 0 };
+    uint8_t  state[192]{};
+};
+
+TEST_CASE("PagedIdMap lookup throughput", "[bench][paged_id_map]")
+{
+    // Descriptor sets interleaved with other objects, as they are created by an application, and a stream of
+    // vkCmdBindDescriptorSets calls that bind four of them at a time.
+    std::vector<uint64_t> descriptor_set_ids;
+    for (uint64_t id = 1; id <= kObjectCount; id += 3)
+    {
+        descriptor_set_ids.push_back(id);
+    }
+
+    std::mt19937          rng(7);
+    std::vector<uint64_t> bind_stream(kBindCount * 4);
+    for (auto& id : bind_stream)
+    {
+        id = descriptor_set_ids[rng() % descriptor_set_ids.size()];
+    }
+
+    util::PagedIdMap<ObjectInfo>             paged_map;
+    std::unordered_map<uint64_t, ObjectInfo> hash_map;
+    for (auto id : descriptor_set_ids)
+    {
+        ObjectInfo info;
+        info.handle     = id * 64;
+        info.capture_id = id;
+        paged_map.Emplace(id, ObjectInfo(info));
+        hash_map.emplace(id, info);
+    }
+
+    BENCHMARK("PagedIdMap descriptor set lookup")
+    {
+        uint64_t handles = 0;
+        for (auto id : bind_stream)
+        {
+            handles += paged_map.Find(id)->handle;
+        }
+        return handles;
+    };
+
+    BENCHMARK("unordered_map descriptor set lookup")
+    {
+        uint64_t handles = 0;
+        for (auto id : bind_stream)
+        {
+            handles += hash_map.find(id)->second.handle;
+        }
+        return handles;
+    };
+}
+
+struct HandleWrapper
+{
+    uint64_t handle;
+};
+
+// The handle table implementation that preceded ShardedHashMap, with a single lock for all entries.
+class SingleLockHashMap
+{
+  public:
+    bool Insert(uint64_t key, HandleWrapper* value)
+    {
+        const std::unique_lock<std::shared_mutex> lock(mutex_);
+        return entries_.insert(std::make_pair(key, value)).second;
+    }
+
+    bool Erase(uint64_t key)
+    {
+        const std::unique_lock<std::shared_mutex> lock(mutex_);
+        return (entries_.erase(key) != 0);
+    }
+
+    HandleWrapper* Find(uint64_t key, HandleWrapper* default_value) const
+    {
+        const std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto                                      entry = entries_.find(key);
+        return (entry != entries_.end()) ? entry->second : default_value;
+    }
+
+  private:
+    mutable std::shared_mutex                    mutex_;
+    std::unordered_map<uint64_t, HandleWrapper*> entries_;
+};
+
+// Worker threads creating transient objects, using them, and destroying them.  Handle values resemble driver
+// allocations: 64 byte aligned and interleaved between threads.
+template <typename Map>
+static size_t RunHandleWorkers(Map* map)
+{
+    std::atomic<size_t>      found{ 0 };
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < kHandleThreadCount; ++t)
+    {
+        threads.emplace_back([map, t, &found]() {
+            std::vector<HandleWrapper> wrappers(kHandlesPerThread);
+            size_t                     thread_found = 0;
+
+            for (size_t iteration = 0; iteration < kHandleIterations; ++iteration)
+            {
+                for (size_t i = 0; i < kHandlesPerThread; ++i)
+                {
+                    wrappers[i].handle = 0x10000000ULL + (((i * kHandleThreadCount) + t) * 64);
+                    map->Insert(wrappers[i].handle, &wrappers[i]);
+
+                    for (size_t lookup = 0; lookup < kLookupsPerInsert; ++lookup)
+                    {
+                        thread_found += (map->Find(wrappers[i].handle, nullptr) != nullptr) ? 1 : 0;
+                    }
+                }
+
+                for (size_t i = 0; i < kHandlesPerThread; ++i)
+                {
+                    map->Erase(wrappers[i].handle);
+                }
+            }
+
+            found += thread_found;
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    return found.load();
+}
+
+TEST_CASE("Handle table contention", "[bench][sharded_hash_map]")
+{
+    BENCHMARK("ShardedHashMap 8 threads")
+    {
+        util::ShardedHashMap<uint64_t, HandleWrapper*> map;
+        return RunHandleWorkers(&map);
+    };
+
+    BENCHMARK("Single lock map 8 threads")
+    {
+        SingleLockHashMap map;
+        return RunHandleWorkers(&map);
+    };
+}
+
+TEST_CASE("Image writer row conversion throughput", "[bench][image_writer]")
+{
+    using namespace util::imagewriter;
+
+    struct RowFormat
+    {
+        DataFormats format;
+        const char* name;
+    };
+
+    const RowFormat row_formats[] = { { kFormat_RGBA, "RGBA" },
+                                      { kFormat_BGRA, "BGRA" },
+                                      { kFormat_B10G11R11_UFLOAT, "B10G11R11_UFLOAT" },
+                                      { kFormat_A2B10G10R10, "A2B10G10R10" },
+                                      { kFormat_R16G16B16A16_SFLOAT, "R16G16B16A16_SFLOAT" },
+                                      { kFormat_D32_FLOAT, "D32_FLOAT" },
+                                      { kFormat_D24_UNORM, "D24_UNORM" },
+                                      { kFormat_D16_UNORM, "D16_UNORM" } };
+
+    // One 4K image row at a time, as the image writers convert them.
+    std::vector<uint8_t> data(static_cast<size_t>(kImageWidth) * kImageHeight * sizeof(uint64_t));
+    std::vector<uint8_t> pixels(static_cast<size_t>(kImageWidth) * kImageHeight * 4);
+    std::mt19937         rng(7);
+
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(rng());
+    }
+
+    for (const RowFormat& row_format : row_formats)
+    {
+        const DataFormats format = row_format.format;
+        const size_t      pitch  = kImageWidth * DataFormatsSizes(format);
+
+        BENCHMARK(std::string("ConvertRow 4K ") + row_format.name)
+        {
+            for (uint32_t y = 0; y < kImageHeight; ++y)
+            {
+                ConvertRow(
+                    format, data.data() + (y * pitch), kImageWidth, false, pixels.data() + (y * kImageWidth * 4));
+            }
+            return pixels[0];
+        };
+
+        BENCHMARK(std::string("ConvertRowScalar 4K ") + row_format.name)
+        {
+            for (uint32_t y = 0; y < kImageHeight; ++y)
+            {
+                ConvertRowScalar(
+                    format, data.data() + (y * pitch), kImageWidth, false, pixels.data() + (y * kImageWidth * 4));
+            }
+            return pixels[0];
+        };
+    }
+}
+
+GFXRECON_END_NAMESPACE(bench)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -27,20 +27,30 @@
 #include "format/format_util.h"
 #include "util/logging.h"
 
+#include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
+template <typename T>
+static void StoreHeader(const T& header, std::vector<uint8_t>* buffer)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&header);
+    buffer->assign(bytes, bytes + sizeof(header));
+}
+
 CompressionConverter::CompressionConverter() :
-    decompressing_(true), target_compression_type_(format::CompressionType::kNone)
+    decompressing_(true), target_compression_type_(format::CompressionType::kNone), pending_bytes_(0), free_bytes_(0)
 {}
 
 CompressionConverter::~CompressionConverter() {}
 
 bool CompressionConverter::Initialize(const std::string&      input_filename,
                                       const std::string&      output_filename,
-                                      format::CompressionType target_compression_type)
+                                      format::CompressionType target_compression_type,
+                                      uint32_t                num_threads)
 {
     bool success = CreateCompressor(target_compression_type, &target_compressor_);
 
@@ -53,6 +63,11 @@ bool CompressionConverter::Initialize(const std::string&      input_filename,
         success                  = FileTransformer::Initialize(input_filename, output_filename);
     }
 
+    if (success && (num_threads > 1))
+    {
+        workers_ = std::make_unique<util::ThreadPool>(num_threads);
+    }
+
     return success;
 }
 
@@ -76,6 +91,8 @@ bool CompressionConverter::ProcessFunctionCall(const format::BlockHeader& block_
 {
     size_t           parameter_buffer_size = static_cast<size_t>(block_header.size) - sizeof(call_id);
     uint64_t         uncompressed_size     = 0;
+    bool             compressed            = format::IsBlockCompressed(block_header.type);
+    auto             block                 = AcquireBlock(BlockKind::kFunctionCall, "function call");
     format::ThreadId thread_id             = 0;
 
     bool success = ReadBytes(&thread_id, sizeof(thread_id));
@@ -84,7 +101,7 @@ bool CompressionConverter::ProcessFunctionCall(const format::BlockHeader& block_
     {
         parameter_buffer_size -= sizeof(thread_id);
 
-        if (format::IsBlockCompressed(block_header.type))
+        if (compressed)
         {
             success = ReadBytes(&uncompressed_size, sizeof(uncompressed_size));
 
@@ -93,21 +110,6 @@ bool CompressionConverter::ProcessFunctionCall(const format::BlockHeader& block_
                 parameter_buffer_size -= sizeof(uncompressed_size);
 
                 GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
-
-                size_t actual_size = 0;
-                success            = ReadCompressedParameterBuffer(
-                    parameter_buffer_size, static_cast<size_t>(uncompressed_size), &actual_size);
-
-                if (success)
-                {
-                    assert(actual_size == uncompressed_size);
-                    parameter_buffer_size = static_cast<size_t>(uncompressed_size);
-                }
-                else
-                {
-                    HandleBlockReadError(kErrorReadingCompressedBlockData,
-                                         "Failed to read compressed function call block data");
-                }
             }
             else
             {
@@ -115,19 +117,20 @@ bool CompressionConverter::ProcessFunctionCall(const format::BlockHeader& block_
                                      "Failed to read compressed function call block header");
             }
         }
-        else
+
+        if (success)
         {
-            success = ReadParameterBuffer(parameter_buffer_size);
+            block->call_id   = call_id;
+            block->thread_id = thread_id;
 
-            if (!success)
-            {
-                HandleBlockReadError(kErrorReadingBlockData, "Failed to read function call block data");
-            }
+            // Uncompressed blocks store parameter_buffer_size bytes of uncompressed data.
+            size_t data_size = compressed ? static_cast<size_t>(uncompressed_size) : parameter_buffer_size;
+            success          = ReadBlockData(block.get(), compressed, parameter_buffer_size, data_size);
         }
 
         if (success)
         {
-            success = WriteFunctionCall(call_id, thread_id, parameter_buffer_size);
+            success = SubmitBlock(std::move(block));
         }
     }
     else
@@ -144,6 +147,8 @@ bool CompressionConverter::ProcessMethodCall(const format::BlockHeader& block_he
 {
     size_t           parameter_buffer_size = static_cast<size_t>(block_header.size) - sizeof(call_id);
     uint64_t         uncompressed_size     = 0;
+    bool             compressed            = format::IsBlockCompressed(block_header.type);
+    auto             block                 = AcquireBlock(BlockKind::kMethodCall, "method call");
     format::HandleId object_id             = 0;
     format::ThreadId thread_id             = 0;
 
@@ -154,7 +159,7 @@ bool CompressionConverter::ProcessMethodCall(const format::BlockHeader& block_he
     {
         parameter_buffer_size -= (sizeof(object_id) + sizeof(thread_id));
 
-        if (format::IsBlockCompressed(block_header.type))
+        if (compressed)
         {
             success = ReadBytes(&uncompressed_size, sizeof(uncompressed_size));
 
@@ -163,21 +168,6 @@ bool CompressionConverter::ProcessMethodCall(const format::BlockHeader& block_he
                 parameter_buffer_size -= sizeof(uncompressed_size);
 
                 GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, uncompressed_size);
-
-                size_t actual_size = 0;
-                success            = ReadCompressedParameterBuffer(
-                    parameter_buffer_size, static_cast<size_t>(uncompressed_size), &actual_size);
-
-                if (success)
-                {
-                    assert(actual_size == uncompressed_size);
-                    parameter_buffer_size = static_cast<size_t>(uncompressed_size);
-                }
-                else
-                {
-                    HandleBlockReadError(kErrorReadingCompressedBlockData,
-                                         "Failed to read compressed method call block data");
-                }
             }
             else
             {
@@ -185,19 +175,21 @@ bool CompressionConverter::ProcessMethodCall(const format::BlockHeader& block_he
                                      "Failed to read compressed method call block header");
             }
         }
-        else
+
+        if (success)
         {
-            success = ReadParameterBuffer(parameter_buffer_size);
+            block->call_id   = call_id;
+            block->object_id = object_id;
+            block->thread_id = thread_id;
 
-            if (!success)
-            {
-                HandleBlockReadError(kErrorReadingBlockData, "Failed to read method call block data");
-            }
+            // Uncompressed blocks store parameter_buffer_size bytes of uncompressed data.
+            size_t data_size = compressed ? static_cast<size_t>(uncompressed_size) : parameter_buffer_size;
+            success          = ReadBlockData(block.get(), compressed, parameter_buffer_size, data_size);
         }
 
         if (success)
         {
-            success = WriteMethodCall(call_id, object_id, thread_id, parameter_buffer_size);
+            success = SubmitBlock(std::move(block));
         }
     }
     else
@@ -215,27 +207,33 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
     format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
     if (meta_data_type == format::MetaDataType::kFillMemoryCommand)
     {
-        return WriteFillMemoryMetaData(block_header, meta_data_id);
+        return ProcessFillMemoryMetaData(block_header, meta_data_id);
     }
     else if (meta_data_type == format::MetaDataType::kInitBufferCommand)
     {
-        return WriteInitBufferMetaData(block_header, meta_data_id);
+        return ProcessInitBufferMetaData(block_header, meta_data_id);
     }
     else if (meta_data_type == format::MetaDataType::kInitImageCommand)
     {
-        return WriteInitImageMetaData(block_header, meta_data_id);
+        return ProcessInitImageMetaData(block_header, meta_data_id);
     }
     else if (meta_data_type == format::MetaDataType::kInitSubresourceCommand)
     {
-        return WriteInitSubresourceMetaData(block_header, meta_data_id);
+        return ProcessInitSubresourceMetaData(block_header, meta_data_id);
     }
     else if (meta_data_type == format::MetaDataType::kInitDx12AccelerationStructureCommand)
     {
-        return WriteInitDx12AccelerationStructureMetaData(block_header, meta_data_id);
+        return ProcessInitDx12AccelerationStructureMetaData(block_header, meta_data_id);
     }
     else if (meta_data_type == format::MetaDataType::kFillMemoryResourceValueCommand)
     {
-        return WriteFillMemoryResourceValueMetaData(block_header, meta_data_id);
+        return ProcessFillMemoryResourceValueMetaData(block_header, meta_data_id);
+    }
+    else if (meta_data_type == format::MetaDataType::kSetCompressionDictionaryCommand)
+    {
+        // Blocks are recompressed without the dictionary, so it is only needed to read the input file.  The dictionary
+        // must not be replaced while worker threads are decompressing blocks that precede it.
+        return FlushPendingBlocks() && ProcessCompressionDictionary(block_header, meta_data_id, false);
     }
     else
     {
@@ -248,168 +246,21 @@ bool CompressionConverter::ProcessMetaData(const format::BlockHeader& block_head
             return false;
         }
 
-        return FileTransformer::ProcessMetaData(block_header, meta_data_id);
+        return FlushPendingBlocks() && FileTransformer::ProcessMetaData(block_header, meta_data_id);
     }
 }
 
-bool CompressionConverter::WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size)
+bool CompressionConverter::ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type)
 {
-    bool        write_uncompressed = decompressing_;
-    const auto& buffer             = GetParameterBuffer();
-
-    if (!write_uncompressed)
-    {
-        assert(target_compressor_ != nullptr);
-
-        // Compress the buffer with the new compression format and write to the new file.
-        auto&  compressed_buffer = GetCompressedParameterBuffer();
-        size_t packet_size       = 0;
-        size_t compressed_size   = target_compressor_->Compress(buffer_size, buffer.data(), &compressed_buffer, 0);
-
-        if (0 < compressed_size && compressed_size < buffer_size)
-        {
-            format::CompressedFunctionCallHeader compressed_func_call_header = {};
-            compressed_func_call_header.block_header.type = format::BlockType::kCompressedFunctionCallBlock;
-            compressed_func_call_header.api_call_id       = call_id;
-            compressed_func_call_header.thread_id         = thread_id;
-            compressed_func_call_header.uncompressed_size = buffer_size;
-
-            packet_size += sizeof(compressed_func_call_header.api_call_id) +
-                           sizeof(compressed_func_call_header.thread_id) +
-                           sizeof(compressed_func_call_header.uncompressed_size) + compressed_size;
-
-            compressed_func_call_header.block_header.size = packet_size;
-
-            if (!WriteBytes(&compressed_func_call_header, sizeof(compressed_func_call_header)))
-            {
-                HandleBlockWriteError(kErrorWritingCompressedBlockHeader,
-                                      "Failed to write compressed function call block header");
-                return false;
-            }
-
-            if (!WriteBytes(compressed_buffer.data(), compressed_size))
-            {
-                HandleBlockWriteError(kErrorWritingCompressedBlockData,
-                                      "Failed to write compressed function call block data");
-                return false;
-            }
-        }
-        else
-        {
-            // It's bigger compressed than uncompressed, so write the uncompressed data.
-            write_uncompressed = true;
-        }
-    }
-
-    if (write_uncompressed)
-    {
-        // Buffer is currently not compressed; it was decompressed prior to this call.
-        format::FunctionCallHeader func_call_header = {};
-        size_t                     packet_size      = 0;
-
-        func_call_header.block_header.type = format::BlockType::kFunctionCallBlock;
-        func_call_header.api_call_id       = call_id;
-        func_call_header.thread_id         = thread_id;
-
-        packet_size += sizeof(func_call_header.api_call_id) + sizeof(func_call_header.thread_id) + buffer_size;
-
-        func_call_header.block_header.size = packet_size;
-
-        if (!WriteBytes(&func_call_header, sizeof(func_call_header)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write function call block header");
-            return false;
-        }
-
-        if (!WriteBytes(buffer.data(), buffer_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write function call block data");
-            return false;
-        }
-    }
-
-    return true;
+    return FlushPendingBlocks() && FileTransformer::ProcessStateMarker(block_header, marker_type);
 }
 
-bool CompressionConverter::WriteMethodCall(format::ApiCallId call_id,
-                                           format::HandleId  object_id,
-                                           format::ThreadId  thread_id,
-                                           size_t            buffer_size)
+bool CompressionConverter::FlushPendingBlocks()
 {
-    bool        write_uncompressed = decompressing_;
-    const auto& buffer             = GetParameterBuffer();
-
-    if (!write_uncompressed)
-    {
-        GFXRECON_ASSERT(target_compressor_ != nullptr);
-
-        // Compress the buffer with the new compression format and write to the new file.
-        auto&  compressed_buffer = GetCompressedParameterBuffer();
-        size_t packet_size       = 0;
-        size_t compressed_size   = target_compressor_->Compress(buffer_size, buffer.data(), &compressed_buffer, 0);
-
-        if (0 < compressed_size && compressed_size < buffer_size)
-        {
-            format::CompressedMethodCallHeader compressed_method_call_header = {};
-            compressed_method_call_header.block_header.type = format::BlockType::kCompressedMethodCallBlock;
-            compressed_method_call_header.api_call_id       = call_id;
-            compressed_method_call_header.object_id         = object_id;
-            compressed_method_call_header.thread_id         = thread_id;
-            compressed_method_call_header.uncompressed_size = buffer_size;
-
-            packet_size += sizeof(compressed_method_call_header.api_call_id) +
-                           sizeof(compressed_method_call_header.object_id) +
-                           sizeof(compressed_method_call_header.thread_id) +
-                           sizeof(compressed_method_call_header.uncompressed_size) + compressed_size;
-
-            compressed_method_call_header.block_header.size = packet_size;
-
-            if (!WriteBytes(&compressed_method_call_header, sizeof(compressed_method_call_header)))
-            {
-                HandleBlockWriteError(kErrorWritingCompressedBlockHeader,
-                                      "Failed to write compressed method call block header");
-                return false;
-            }
-
-            if (!WriteBytes(compressed_buffer.data(), compressed_size))
-            {
-                HandleBlockWriteError(kErrorWritingCompressedBlockData,
-                                      "Failed to write compressed method call block data");
-                return false;
-            }
-        }
-        else
-        {
-            // It's bigger compressed than uncompressed, so write the uncompressed data.
-            write_uncompressed = true;
-        }
-    }
-
-    if (write_uncompressed)
+    while (!pending_blocks_.empty())
     {
-        // Buffer is currently not compressed; it was decompressed prior to this call.
-        format::MethodCallHeader method_call_header = {};
-        size_t                   packet_size        = 0;
-
-        method_call_header.block_header.type = format::BlockType::kMethodCallBlock;
-        method_call_header.api_call_id       = call_id;
-        method_call_header.object_id         = object_id;
-        method_call_header.thread_id         = thread_id;
-
-        packet_size += sizeof(method_call_header.api_call_id) + sizeof(method_call_header.object_id) +
-                       sizeof(method_call_header.thread_id) + buffer_size;
-
-        method_call_header.block_header.size = packet_size;
-
-        if (!WriteBytes(&method_call_header, sizeof(method_call_header)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write method call block header");
-            return false;
-        }
-
-        if (!WriteBytes(buffer.data(), buffer_size))
+        if (!WriteNextPendingBlock())
         {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write method call block data");
             return false;
         }
     }
@@ -417,12 +268,12 @@ bool CompressionConverter::WriteMethodCall(format::ApiCallId call_id,
     return true;
 }
 
-bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& block_header,
-                                                   format::MetaDataId         meta_data_id)
+bool CompressionConverter::ProcessFillMemoryMetaData(const format::BlockHeader& block_header,
+                                                     format::MetaDataId         meta_data_id)
 {
     assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kFillMemoryCommand);
 
-    format::FillMemoryCommandHeader fill_cmd;
+    format::FillMemoryCommandHeader fill_cmd = {};
 
     bool success = ReadBytes(&fill_cmd.thread_id, sizeof(fill_cmd.thread_id));
     success      = success && ReadBytes(&fill_cmd.memory_id, sizeof(fill_cmd.memory_id));
@@ -433,66 +284,29 @@ bool CompressionConverter::WriteFillMemoryMetaData(const format::BlockHeader& bl
     {
         GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, fill_cmd.memory_size);
 
-        size_t data_size = static_cast<size_t>(fill_cmd.memory_size);
+        size_t data_size       = static_cast<size_t>(fill_cmd.memory_size);
+        size_t compressed_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(fill_cmd));
+        auto   block           = AcquireBlock(BlockKind::kMetaData, "fill memory meta-data");
 
-        if (format::IsBlockCompressed(block_header.type))
-        {
-            size_t uncompressed_size = 0;
-            size_t compressed_size =
-                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(fill_cmd));
-
-            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
-            {
-                HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read fill memory meta-data block");
-                return false;
-            }
+        fill_cmd.meta_header.meta_data_id = meta_data_id;
+        StoreHeader(fill_cmd, &block->meta_data_header);
 
-            assert(uncompressed_size == data_size);
-        }
-        else
-        {
-            if (!ReadParameterBuffer(data_size))
-            {
-                HandleBlockReadError(kErrorReadingBlockData, "Failed to read fill memory meta-data block");
-                return false;
-            }
-        }
-
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
-
-        PrepMetadataBlock(fill_cmd.meta_header, meta_data_id, data_address, data_size);
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        fill_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(fill_cmd) + data_size;
-
-        if (!WriteBytes(&fill_cmd, sizeof(fill_cmd)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory meta-data block header");
-            return false;
-        }
-
-        if (!WriteBytes(data_address, data_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write fill memory meta-data block");
-            return false;
-        }
+        return ReadBlockData(block.get(), format::IsBlockCompressed(block_header.type), compressed_size, data_size) &&
+               SubmitBlock(std::move(block));
     }
     else
     {
         HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory meta-data block header");
         return false;
     }
-
-    return true;
 }
 
-bool CompressionConverter::WriteInitBufferMetaData(const format::BlockHeader& block_header,
-                                                   format::MetaDataId         meta_data_id)
+bool CompressionConverter::ProcessInitBufferMetaData(const format::BlockHeader& block_header,
+                                                     format::MetaDataId         meta_data_id)
 {
     assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kInitBufferCommand);
 
-    format::InitBufferCommandHeader init_cmd;
+    format::InitBufferCommandHeader init_cmd = {};
 
     bool success = ReadBytes(&init_cmd.thread_id, sizeof(init_cmd.thread_id));
     success      = success && ReadBytes(&init_cmd.device_id, sizeof(init_cmd.device_id));
@@ -503,66 +317,29 @@ bool CompressionConverter::WriteInitBufferMetaData(const format::BlockHeader& bl
     {
         GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, init_cmd.data_size);
 
-        size_t data_size = static_cast<size_t>(init_cmd.data_size);
-
-        if (format::IsBlockCompressed(block_header.type))
-        {
-            size_t uncompressed_size = 0;
-            size_t compressed_size =
-                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd));
-
-            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
-            {
-                HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read init buffer meta-data block");
-                return false;
-            }
-
-            assert(uncompressed_size == data_size);
-        }
-        else
-        {
-            if (!ReadParameterBuffer(data_size))
-            {
-                HandleBlockReadError(kErrorReadingBlockData, "Failed to read init buffer meta-data block");
-                return false;
-            }
-        }
-
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
-
-        PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        init_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(init_cmd) + data_size;
+        size_t data_size       = static_cast<size_t>(init_cmd.data_size);
+        size_t compressed_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd));
+        auto   block           = AcquireBlock(BlockKind::kMetaData, "init buffer meta-data");
 
-        if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init buffer meta-data block header");
-            return false;
-        }
+        init_cmd.meta_header.meta_data_id = meta_data_id;
+        StoreHeader(init_cmd, &block->meta_data_header);
 
-        if (!WriteBytes(data_address, data_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write init buffer meta-data block");
-            return false;
-        }
+        return ReadBlockData(block.get(), format::IsBlockCompressed(block_header.type), compressed_size, data_size) &&
+               SubmitBlock(std::move(block));
     }
     else
     {
         HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read init buffer meta-data block header");
         return false;
     }
-
-    return true;
 }
 
-bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& block_header,
-                                                  format::MetaDataId         meta_data_id)
+bool CompressionConverter::ProcessInitImageMetaData(const format::BlockHeader& block_header,
+                                                    format::MetaDataId         meta_data_id)
 {
     assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kInitImageCommand);
 
-    format::InitImageCommandHeader init_cmd;
+    format::InitImageCommandHeader init_cmd = {};
     std::vector<uint64_t>          level_sizes;
     size_t                         levels_size = 0;
 
@@ -583,10 +360,9 @@ bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& blo
 
     if (success)
     {
-        // Packet size without the resource data.
-        init_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(init_cmd);
-        init_cmd.meta_header.block_header.type = format::kMetaDataBlock;
-        init_cmd.meta_header.meta_data_id      = meta_data_id;
+        auto block = AcquireBlock(BlockKind::kMetaData, "init image meta-data");
+
+        init_cmd.meta_header.meta_data_id = meta_data_id;
 
         if (init_cmd.data_size > 0)
         {
@@ -594,56 +370,16 @@ bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& blo
             GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, init_cmd.data_size);
 
             size_t data_size = static_cast<size_t>(init_cmd.data_size);
+            size_t compressed_size =
+                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd)) - levels_size;
 
-            if (format::IsBlockCompressed(block_header.type))
-            {
-                size_t uncompressed_size = 0;
-                size_t compressed_size =
-                    static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd)) - levels_size;
-
-                if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
-                {
-                    HandleBlockReadError(kErrorReadingCompressedBlockData, "Failed to read init image meta-data block");
-                    return false;
-                }
-
-                assert(uncompressed_size == data_size);
-            }
-            else
-            {
-                if (!ReadParameterBuffer(data_size))
-                {
-                    HandleBlockReadError(kErrorReadingBlockData, "Failed to read init image meta-data block");
-                    return false;
-                }
-            }
-
-            const auto&    buffer       = GetParameterBuffer();
-            const uint8_t* data_address = buffer.data();
-
-            PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
-
-            // Calculate size of packet with compressed or uncompressed data size.
-            init_cmd.meta_header.block_header.size =
-                format::GetMetaDataBlockBaseSize(init_cmd) + levels_size + data_size;
-
-            if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-            {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block header");
-                return false;
-            }
-
-            if (!WriteBytes(level_sizes.data(), levels_size))
-            {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block");
-                return false;
-            }
+            // The level sizes follow the command header and precede the resource data.
+            const uint8_t* levels_data = reinterpret_cast<const uint8_t*>(level_sizes.data());
+            StoreHeader(init_cmd, &block->meta_data_header);
+            block->meta_data_header.insert(block->meta_data_header.end(), levels_data, levels_data + levels_size);
 
-            if (!WriteBytes(data_address, data_size))
-            {
-                HandleBlockWriteError(kErrorWritingBlockData, "Failed to write init image meta-data block");
-                return false;
-            }
+            success =
+                ReadBlockData(block.get(), format::IsBlockCompressed(block_header.type), compressed_size, data_size);
         }
         else
         {
@@ -652,28 +388,25 @@ bool CompressionConverter::WriteInitImageMetaData(const format::BlockHeader& blo
             init_cmd.data_size   = 0;
             init_cmd.level_count = 0;
 
-            if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-            {
-                HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init image meta-data block header");
-                return false;
-            }
+            StoreHeader(init_cmd, &block->meta_data_header);
+            success = ReadBlockData(block.get(), false, 0, 0);
         }
+
+        return success && SubmitBlock(std::move(block));
     }
     else
     {
         HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read init image meta-data block header");
         return false;
     }
-
-    return true;
 }
 
-bool CompressionConverter::WriteInitSubresourceMetaData(const format::BlockHeader& block_header,
-                                                        format::MetaDataId         meta_data_id)
+bool CompressionConverter::ProcessInitSubresourceMetaData(const format::BlockHeader& block_header,
+                                                          format::MetaDataId         meta_data_id)
 {
     assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kInitSubresourceCommand);
 
-    format::InitSubresourceCommandHeader init_cmd;
+    format::InitSubresourceCommandHeader init_cmd = {};
 
     bool success = ReadBytes(&init_cmd.thread_id, sizeof(init_cmd.thread_id));
     success      = success && ReadBytes(&init_cmd.device_id, sizeof(init_cmd.device_id));
@@ -688,67 +421,29 @@ bool CompressionConverter::WriteInitSubresourceMetaData(const format::BlockHeade
     {
         GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, init_cmd.data_size);
 
-        size_t data_size = static_cast<size_t>(init_cmd.data_size);
-
-        if (format::IsBlockCompressed(block_header.type))
-        {
-            size_t uncompressed_size = 0;
-            size_t compressed_size =
-                static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd));
-
-            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
-            {
-                HandleBlockReadError(kErrorReadingCompressedBlockData,
-                                     "Failed to read init subresource meta-data block");
-                return false;
-            }
-
-            assert(uncompressed_size == data_size);
-        }
-        else
-        {
-            if (!ReadParameterBuffer(data_size))
-            {
-                HandleBlockReadError(kErrorReadingBlockData, "Failed to read init subresource meta-data block");
-                return false;
-            }
-        }
+        size_t data_size       = static_cast<size_t>(init_cmd.data_size);
+        size_t compressed_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd));
+        auto   block           = AcquireBlock(BlockKind::kMetaData, "init subresource meta-data");
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
+        init_cmd.meta_header.meta_data_id = meta_data_id;
+        StoreHeader(init_cmd, &block->meta_data_header);
 
-        PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
-
-        // Calculate size of packet with compressed or uncompressed data size.
-        init_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(init_cmd) + data_size;
-
-        if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write init subresource meta-data block header");
-            return false;
-        }
-
-        if (!WriteBytes(data_address, data_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to write init subresource meta-data block");
-            return false;
-        }
+        return ReadBlockData(block.get(), format::IsBlockCompressed(block_header.type), compressed_size, data_size) &&
+               SubmitBlock(std::move(block));
     }
     else
     {
         HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read init subresource meta-data block header");
         return false;
     }
-
-    return true;
 }
 
-bool CompressionConverter::WriteInitDx12AccelerationStructureMetaData(const format::BlockHeader& block_header,
-                                                                      format::MetaDataId         meta_data_id)
+bool CompressionConverter::ProcessInitDx12AccelerationStructureMetaData(const format::BlockHeader& block_header,
+                                                                        format::MetaDataId         meta_data_id)
 {
     assert(format::GetMetaDataType(meta_data_id) == format::MetaDataType::kInitDx12AccelerationStructureCommand);
 
-    format::InitDx12AccelerationStructureCommandHeader init_cmd;
+    format::InitDx12AccelerationStructureCommandHeader init_cmd = {};
     bool success = ReadBytes(&init_cmd.thread_id, sizeof(init_cmd.thread_id));
     success      = success &&
               ReadBytes(&init_cmd.dest_acceleration_structure_data, sizeof(init_cmd.dest_acceleration_structure_data));
@@ -767,7 +462,7 @@ bool CompressionConverter::WriteInitDx12AccelerationStructureMetaData(const form
     {
         for (uint32_t i = 0; i < init_cmd.inputs_num_geometry_descs; ++i)
         {
-            format::InitDx12AccelerationStructureGeometryDesc geom_desc;
+            format::InitDx12AccelerationStructureGeometryDesc geom_desc = {};
             success = success && ReadBytes(&geom_desc.geometry_type, sizeof(geom_desc.geometry_type));
             success = success && ReadBytes(&geom_desc.geometry_flags, sizeof(geom_desc.geometry_flags));
             success = success && ReadBytes(&geom_desc.aabbs_count, sizeof(geom_desc.aabbs_count));
@@ -789,64 +484,20 @@ bool CompressionConverter::WriteInitDx12AccelerationStructureMetaData(const form
     {
         GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, init_cmd.inputs_data_size);
 
-        size_t data_size = static_cast<size_t>(init_cmd.inputs_data_size);
-
-        if (format::IsBlockCompressed(block_header.type))
-        {
-            size_t uncompressed_size = 0;
-            size_t compressed_size =
-                static_cast<size_t>(block_header.size) -
-                (sizeof(init_cmd) - sizeof(init_cmd.meta_header.block_header)) -
-                (sizeof(format::InitDx12AccelerationStructureGeometryDesc) * init_cmd.inputs_num_geometry_descs);
-
-            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
-            {
-                HandleBlockReadError(kErrorReadingCompressedBlockData,
-                                     "Failed to read init DX12 acceleration structure meta-data block");
-                return false;
-            }
-
-            assert(uncompressed_size == data_size);
-        }
-        else
-        {
-            if (!ReadParameterBuffer(data_size))
-            {
-                HandleBlockReadError(kErrorReadingBlockData,
-                                     "Failed to read init DX12 acceleration structure meta-data block");
-                return false;
-            }
-        }
-
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
+        size_t data_size  = static_cast<size_t>(init_cmd.inputs_data_size);
+        size_t descs_size = sizeof(format::InitDx12AccelerationStructureGeometryDesc) * geom_descs.size();
+        size_t compressed_size =
+            static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(init_cmd)) - descs_size;
+        auto block = AcquireBlock(BlockKind::kMetaData, "init DX12 acceleration structure meta-data");
 
-        PrepMetadataBlock(init_cmd.meta_header, meta_data_id, data_address, data_size);
+        // The geometry descriptions follow the command header and precede the input data.
+        const uint8_t* descs_data         = reinterpret_cast<const uint8_t*>(geom_descs.data());
+        init_cmd.meta_header.meta_data_id = meta_data_id;
+        StoreHeader(init_cmd, &block->meta_data_header);
+        block->meta_data_header.insert(block->meta_data_header.end(), descs_data, descs_data + descs_size);
 
-        // Calculate size of packet with compressed or uncompressed data size.
-        init_cmd.meta_header.block_header.size =
-            format::GetMetaDataBlockBaseSize(init_cmd) + data_size +
-            (sizeof(format::InitDx12AccelerationStructureGeometryDesc) * init_cmd.inputs_num_geometry_descs);
-
-        if (!WriteBytes(&init_cmd, sizeof(init_cmd)))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader,
-                                  "Failed to write init DX12 acceleration structure meta-data block header");
-            return false;
-        }
-        if (!WriteBytes(geom_descs.data(),
-                        sizeof(format::InitDx12AccelerationStructureGeometryDesc) * geom_descs.size()))
-        {
-            HandleBlockWriteError(kErrorWritingBlockHeader,
-                                  "Failed to write init DX12 acceleration structure geometry block");
-            return false;
-        }
-        if (!WriteBytes(data_address, data_size))
-        {
-            HandleBlockWriteError(kErrorWritingBlockData,
-                                  "Failed to write init DX12 acceleration structure meta-data block");
-            return false;
-        }
+        return ReadBlockData(block.get(), format::IsBlockCompressed(block_header.type), compressed_size, data_size) &&
+               SubmitBlock(std::move(block));
     }
     else
     {
@@ -857,10 +508,10 @@ bool CompressionConverter::WriteInitDx12AccelerationStructureMetaData(const form
     return true;
 }
 
-bool CompressionConverter::WriteFillMemoryResourceValueMetaData(const format::BlockHeader& block_header,
-                                                                format::MetaDataId         meta_data_id)
+bool CompressionConverter::ProcessFillMemoryResourceValueMetaData(const format::BlockHeader& block_header,
+                                                                  format::MetaDataId         meta_data_id)
 {
-    format::FillMemoryResourceValueCommandHeader rv_cmd;
+    format::FillMemoryResourceValueCommandHeader rv_cmd  = {};
     bool                                         success = ReadBytes(&rv_cmd.thread_id, sizeof(rv_cmd.thread_id));
 
     success = success && ReadBytes(&rv_cmd.resource_value_count, sizeof(rv_cmd.resource_value_count));
@@ -870,82 +521,312 @@ bool CompressionConverter::WriteFillMemoryResourceValueMetaData(const format::Bl
         GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, rv_cmd.resource_value_count);
         size_t data_size =
             static_cast<size_t>(rv_cmd.resource_value_count * (sizeof(format::ResourceValueType) + sizeof(uint64_t)));
+        size_t compressed_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(rv_cmd));
+        auto   block           = AcquireBlock(BlockKind::kMetaData, "fill memory resource value meta-data");
 
-        if (format::IsBlockCompressed(block_header.type))
+        rv_cmd.meta_header.meta_data_id = meta_data_id;
+        StoreHeader(rv_cmd, &block->meta_data_header);
+
+        return ReadBlockData(block.get(), format::IsBlockCompressed(block_header.type), compressed_size, data_size) &&
+               SubmitBlock(std::move(block));
+    }
+    else
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read fill memory resource value meta-data block");
+        return false;
+    }
+}
+
+std::unique_ptr<CompressionConverter::ConversionBlock> CompressionConverter::AcquireBlock(BlockKind   kind,
+                                                                                          const char* name)
+{
+    std::unique_ptr<ConversionBlock> block;
+
+    if (!free_blocks_.empty())
+    {
+        block = std::move(free_blocks_.back());
+        free_blocks_.pop_back();
+
+        assert(free_bytes_ >= GetBufferBytes(block.get()));
+        free_bytes_ -= GetBufferBytes(block.get());
+    }
+    else
+    {
+        block = std::make_unique<ConversionBlock>();
+    }
+
+    block->kind = kind;
+    block->name = name;
+
+    return block;
+}
+
+bool CompressionConverter::ReadBlockData(ConversionBlock* block,
+                                         bool             compressed,
+                                         size_t           stored_size,
+                                         size_t           uncompressed_size)
+{
+    assert(block != nullptr);
+
+    block->input_compressed  = compressed;
+    block->input_size        = compressed ? stored_size : uncompressed_size;
+    block->uncompressed_size = uncompressed_size;
+
+    if (block->input.size() < block->input_size)
+    {
+        block->input.resize(block->input_size);
+    }
+
+    if (!ReadBytes(block->input.data(), block->input_size))
+    {
+        std::string message = std::string("Failed to read ") + block->name + " block data";
+        HandleBlockReadError(compressed ? kErrorReadingCompressedBlockData : kErrorReadingBlockData, message.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool CompressionConverter::SubmitBlock(std::unique_ptr<ConversionBlock> block)
+{
+    if (workers_ == nullptr)
+    {
+        bool converted = ConvertBlock(block.get());
+        bool success   = WriteBlock(block.get(), converted);
+        Recycle(std::move(block));
+        return success;
+    }
+
+    // Count the buffers that the worker thread may still grow: the uncompressed buffer when the input is compressed,
+    // and the compressed buffer, which receives about as many bytes as the uncompressed data, when compressing.
+    size_t uncompressed_bytes = block->uncompressed_buffer.capacity();
+    size_t compressed_bytes   = block->compressed_buffer.capacity();
+
+    if (block->input_compressed)
+    {
+        uncompressed_bytes = std::max(uncompressed_bytes, block->uncompressed_size);
+    }
+
+    if (!decompressing_)
+    {
+        compressed_bytes = std::max(compressed_bytes, block->uncompressed_size);
+    }
+
+    block->pending_bytes = block->meta_data_header.capacity() + block->input.capacity() +
+                           block->output_header.capacity() + uncompressed_bytes + compressed_bytes;
+
+    ConversionBlock* target = block.get();
+    block->task.add();
+    workers_->post_detached([this, target]() {
+        target->converted = ConvertBlock(target);
+        target->task.done();
+    });
+
+    pending_bytes_ += block->pending_bytes;
+    pending_blocks_.emplace_back(std::move(block));
+
+    // Bound the amount of memory held by blocks that are waiting to be converted or written.
+    while ((pending_blocks_.size() > kMaxPendingBlocks) || (pending_bytes_ > kMaxPendingBytes))
+    {
+        if (!WriteNextPendingBlock())
         {
-            size_t uncompressed_size = 0;
-            size_t compressed_size = static_cast<size_t>(block_header.size - format::GetMetaDataBlockBaseSize(rv_cmd));
+            return false;
+        }
+    }
 
-            if (!ReadCompressedParameterBuffer(compressed_size, data_size, &uncompressed_size))
-            {
-                HandleBlockReadError(kErrorReadingCompressedBlockData,
-                                     "Failed to read fill memory resource value meta-data block");
-                return false;
-            }
+    return true;
+}
+
+bool CompressionConverter::ConvertBlock(ConversionBlock* block)
+{
+    assert(block != nullptr);
+
+    const uint8_t* data      = block->input.data();
+    size_t         data_size = block->input_size;
+
+    if (block->input_compressed)
+    {
+        util::Compressor* compressor = GetCompressor();
+
+        // This should only be null if initialization failed.
+        assert(compressor != nullptr);
 
-            assert(uncompressed_size == data_size);
+        if (block->uncompressed_buffer.size() < block->uncompressed_size)
+        {
+            block->uncompressed_buffer.resize(block->uncompressed_size);
         }
-        else
+
+        size_t uncompressed_size = compressor->Decompress(
+            block->input_size, block->input.data(), block->uncompressed_size, &block->uncompressed_buffer);
+
+        if ((uncompressed_size == 0) || (uncompressed_size != block->uncompressed_size))
         {
-            if (!ReadParameterBuffer(data_size))
-            {
-                HandleBlockReadError(kErrorReadingBlockData,
-                                     "Failed to read fill memory resource value meta-data block");
-                return false;
-            }
+            return false;
         }
 
-        const auto&    buffer       = GetParameterBuffer();
-        const uint8_t* data_address = buffer.data();
+        data      = block->uncompressed_buffer.data();
+        data_size = uncompressed_size;
+    }
+
+    bool   compressed        = false;
+    size_t uncompressed_size = data_size;
 
-        PrepMetadataBlock(rv_cmd.meta_header, meta_data_id, data_address, data_size);
+    if (!decompressing_ && (data_size > 0))
+    {
+        assert(target_compressor_ != nullptr);
 
-        // Calculate size of packet with compressed or uncompressed data size.
-        rv_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(rv_cmd) + data_size;
+        // Compress the buffer with the new compression format, keeping the uncompressed data when it's bigger
+        // compressed than uncompressed.
+        size_t compressed_size = target_compressor_->Compress(data_size, data, &block->compressed_buffer, 0);
 
-        if (!WriteBytes(&rv_cmd, sizeof(rv_cmd)))
+        if ((compressed_size > 0) && (compressed_size < data_size))
         {
-            HandleBlockWriteError(kErrorWritingBlockHeader, "Failed to write fill memory meta-data block header");
-            return false;
+            compressed = true;
+            data       = block->compressed_buffer.data();
+            data_size  = compressed_size;
         }
+    }
 
-        if (!WriteBytes(data_address, data_size))
+    block->output_data = data;
+    block->output_size = data_size;
+
+    if (block->kind == BlockKind::kFunctionCall)
+    {
+        if (compressed)
         {
-            HandleBlockWriteError(kErrorWritingBlockData, "Failed to read fill memory resource value meta-data block");
-            return false;
+            format::CompressedFunctionCallHeader header = {};
+            header.block_header.type                    = format::BlockType::kCompressedFunctionCallBlock;
+            header.block_header.size = sizeof(header.api_call_id) + sizeof(header.thread_id) +
+                                       sizeof(header.uncompressed_size) + data_size;
+            header.api_call_id       = block->call_id;
+            header.thread_id         = block->thread_id;
+            header.uncompressed_size = uncompressed_size;
+            StoreHeader(header, &block->output_header);
+        }
+        else
+        {
+            format::FunctionCallHeader header = {};
+            header.block_header.type          = format::BlockType::kFunctionCallBlock;
+            header.block_header.size          = sizeof(header.api_call_id) + sizeof(header.thread_id) + data_size;
+            header.api_call_id                = block->call_id;
+            header.thread_id                  = block->thread_id;
+            StoreHeader(header, &block->output_header);
+        }
+    }
+    else if (block->kind == BlockKind::kMethodCall)
+    {
+        if (compressed)
+        {
+            format::CompressedMethodCallHeader header = {};
+            header.block_header.type                  = format::BlockType::kCompressedMethodCallBlock;
+            header.block_header.size = sizeof(header.api_call_id) + sizeof(header.object_id) +
+                                       sizeof(header.thread_id) + sizeof(header.uncompressed_size) + data_size;
+            header.api_call_id       = block->call_id;
+            header.object_id         = block->object_id;
+            header.thread_id         = block->thread_id;
+            header.uncompressed_size = uncompressed_size;
+            StoreHeader(header, &block->output_header);
+        }
+        else
+        {
+            format::MethodCallHeader header = {};
+            header.block_header.type        = format::BlockType::kMethodCallBlock;
+            header.block_header.size =
+                sizeof(header.api_call_id) + sizeof(header.object_id) + sizeof(header.thread_id) + data_size;
+            header.api_call_id = block->call_id;
+            header.object_id   = block->object_id;
+            header.thread_id   = block->thread_id;
+            StoreHeader(header, &block->output_header);
         }
     }
     else
     {
-        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to write fill memory resource value meta-data block");
-        return false;
+        // The meta-data header is at the start of the command header.  The block size covers the command header and
+        // any fixed size command data, excluding the block header, followed by the compressed or uncompressed data.
+        format::MetaDataHeader meta_header;
+        memcpy(&meta_header, block->meta_data_header.data(), sizeof(meta_header));
+
+        meta_header.block_header.type =
+            compressed ? format::BlockType::kCompressedMetaDataBlock : format::BlockType::kMetaDataBlock;
+        meta_header.block_header.size =
+            (block->meta_data_header.size() - sizeof(meta_header.block_header)) + data_size;
+
+        block->output_header = block->meta_data_header;
+        memcpy(block->output_header.data(), &meta_header, sizeof(meta_header));
     }
 
     return true;
 }
 
-void CompressionConverter::PrepMetadataBlock(format::MetaDataHeader& meta_data_header,
-                                             format::MetaDataId      meta_data_id,
-                                             const uint8_t*&         data_address,
-                                             size_t&                 data_size)
+bool CompressionConverter::WriteBlock(ConversionBlock* block, bool converted)
 {
-    meta_data_header.block_header.type = format::kMetaDataBlock;
-    meta_data_header.meta_data_id      = meta_data_id;
+    assert(block != nullptr);
 
-    if (!decompressing_)
+    if (!converted)
     {
-        assert(target_compressor_ != nullptr);
+        // The block data was read in full, so this is not the truncated block at the end of the file that
+        // HandleBlockReadError only warns about, even when the input file is already at its end.
+        std::string message = std::string("Failed to decompress ") + block->name + " block data";
+        HandleBlockWriteError(kErrorReadingCompressedBlockData, message.c_str());
+        return false;
+    }
 
-        auto&  compressed_buffer = GetCompressedParameterBuffer();
-        size_t compressed_size   = target_compressor_->Compress(data_size, data_address, &compressed_buffer, 0);
+    if (!WriteBytes(block->output_header.data(), block->output_header.size()))
+    {
+        std::string message = std::string("Failed to write ") + block->name + " block header";
+        HandleBlockWriteError(kErrorWritingBlockHeader, message.c_str());
+        return false;
+    }
 
-        if ((compressed_size > 0) && (compressed_size < data_size))
-        {
-            meta_data_header.block_header.type = format::BlockType::kCompressedMetaDataBlock;
+    if (!WriteBytes(block->output_data, block->output_size))
+    {
+        std::string message = std::string("Failed to write ") + block->name + " block data";
+        HandleBlockWriteError(kErrorWritingBlockData, message.c_str());
+        return false;
+    }
 
-            data_address = compressed_buffer.data();
-            data_size    = compressed_size;
-        }
+    return true;
+}
+
+bool CompressionConverter::WriteNextPendingBlock()
+{
+    assert(!pending_blocks_.empty());
+
+    std::unique_ptr<ConversionBlock> block = std::move(pending_blocks_.front());
+    pending_blocks_.pop_front();
+
+    assert(pending_bytes_ >= block->pending_bytes);
+    pending_bytes_ -= block->pending_bytes;
+
+    block->task.wait();
+
+    bool success = WriteBlock(block.get(), block->converted);
+    Recycle(std::move(block));
+
+    return success;
+}
+
+size_t CompressionConverter::GetBufferBytes(const ConversionBlock* block)
+{
+    assert(block != nullptr);
+
+    return block->meta_data_header.capacity() + block->input.capacity() + block->uncompressed_buffer.capacity() +
+           block->compressed_buffer.capacity() + block->output_header.capacity();
+}
+
+void CompressionConverter::Recycle(std::unique_ptr<ConversionBlock> block)
+{
+    block->output_data   = nullptr;
+    block->output_size   = 0;
+    block->pending_bytes = 0;
+
+    // Blocks that would exceed the limits are released with their buffers.
+    size_t block_bytes = GetBufferBytes(block.get());
+
+    if ((block_bytes <= kMaxFreeBlockBytes) && ((free_bytes_ + block_bytes) <= kMaxFreeBytes))
+    {
+        free_bytes_ += block_bytes;
+        free_blocks_.emplace_back(std::move(block));
     }
 }
 
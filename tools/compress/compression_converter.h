@@ -29,8 +29,12 @@
 #include "format/format.h"
 #include "util/compressor.h"
 #include "util/defines.h"
+#include "util/threadpool.h"
 
+#include <deque>
 #include <memory>
+#include <string>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
@@ -41,9 +45,13 @@ class CompressionConverter : public decode::FileTransformer
 
     virtual ~CompressionConverter() override;
 
+    // When num_threads is greater than one, blocks are decompressed and recompressed on num_threads worker threads
+    // while the calling thread reads the input file and writes the converted blocks in their original order.  The
+    // output is identical to the output of the single threaded conversion.
     bool Initialize(const std::string&      input_filename,
                     const std::string&      output_filename,
-                    format::CompressionType target_compression_type);
+                    format::CompressionType target_compression_type,
+                    uint32_t                num_threads = 1);
 
   protected:
     virtual bool WriteFileHeader(const format::FileHeader&                  header,
@@ -56,36 +64,98 @@ class CompressionConverter : public decode::FileTransformer
 
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id) override;
 
+    virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type) override;
+
+    virtual bool FlushPendingBlocks() override;
+
   private:
-    bool WriteFunctionCall(format::ApiCallId call_id, format::ThreadId thread_id, size_t buffer_size);
+    enum class BlockKind
+    {
+        kFunctionCall,
+        kMethodCall,
+        kMetaData
+    };
+
+    // A block with a payload to convert.  The header fields and the payload are read from the input file by the
+    // calling thread, and the payload is decompressed and recompressed by ConvertBlock, which may run on a worker
+    // thread.
+    struct ConversionBlock
+    {
+        BlockKind                     kind{ BlockKind::kMetaData };
+        const char*                   name{ nullptr }; // Block description for error messages.
+        format::ApiCallId             call_id{ format::ApiCallId::ApiCall_Unknown };
+        format::HandleId              object_id{ 0 };
+        format::ThreadId              thread_id{ 0 };
+        std::vector<uint8_t>          meta_data_header; // Meta-data command header and any fixed size command data.
+        std::vector<uint8_t>          input;            // Payload as stored in the input file.
+        size_t                        input_size{ 0 };
+        bool                          input_compressed{ false };
+        size_t                        uncompressed_size{ 0 };
+        std::vector<uint8_t>          uncompressed_buffer;
+        std::vector<uint8_t>          compressed_buffer;
+        std::vector<uint8_t>          output_header;
+        const uint8_t*                output_data{ nullptr };
+        size_t                        output_size{ 0 };
+        bool                          converted{ false }; // Result of ConvertBlock, valid after task has completed.
+        size_t                        pending_bytes{ 0 }; // Buffer memory counted in pending_bytes_.
+        util::ThreadPool::TaskCounter task;
+    };
+
+  private:
+    bool ProcessFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
+    bool ProcessInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
+    bool ProcessInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
+    bool ProcessInitSubresourceMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+
+    bool ProcessInitDx12AccelerationStructureMetaData(const format::BlockHeader& block_header,
+                                                      format::MetaDataId         meta_data_id);
+
+    bool ProcessFillMemoryResourceValueMetaData(const format::BlockHeader& block_header,
+                                                format::MetaDataId         meta_data_id);
 
-    bool WriteMethodCall(format::ApiCallId call_id,
-                         format::HandleId  object_id,
-                         format::ThreadId  thread_id,
-                         size_t            buffer_size);
+    std::unique_ptr<ConversionBlock> AcquireBlock(BlockKind kind, const char* name);
 
-    bool WriteFillMemoryMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+    // Reads the block payload, which is stored_size bytes when the block is compressed and uncompressed_size bytes
+    // when it is not.
+    bool ReadBlockData(ConversionBlock* block, bool compressed, size_t stored_size, size_t uncompressed_size);
 
-    bool WriteInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+    // Converts the block on the calling thread, or queues it for conversion on a worker thread.
+    bool SubmitBlock(std::unique_ptr<ConversionBlock> block);
 
-    bool WriteInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+    bool ConvertBlock(ConversionBlock* block);
 
-    bool WriteInitSubresourceMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+    bool WriteBlock(ConversionBlock* block, bool converted);
 
-    bool WriteInitDx12AccelerationStructureMetaData(const format::BlockHeader& block_header,
-                                                    format::MetaDataId         meta_data_id);
+    bool WriteNextPendingBlock();
 
-    bool WriteFillMemoryResourceValueMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id);
+    // Returns the memory held by the buffers of the block.
+    static size_t GetBufferBytes(const ConversionBlock* block);
 
-    void PrepMetadataBlock(format::MetaDataHeader& meta_data_header,
-                           format::MetaDataId      meta_data_id,
-                           const uint8_t*&         data_address,
-                           size_t&                 data_size);
+    void Recycle(std::unique_ptr<ConversionBlock> block);
 
   private:
-    bool                              decompressing_;
-    format::CompressionType           target_compression_type_;
-    std::unique_ptr<util::Compressor> target_compressor_;
+    static const size_t kMaxPendingBlocks = 1024;
+    static const size_t kMaxPendingBytes  = 512 * 1024 * 1024;
+
+    // Bounds the buffer memory that is kept for reuse by later blocks.  Blocks with more than kMaxFreeBlockBytes of
+    // buffers are released instead of being kept, so that a few large blocks do not pin their allocations for the rest
+    // of the file.
+    static const size_t kMaxFreeBytes      = 64 * 1024 * 1024;
+    static const size_t kMaxFreeBlockBytes = 8 * 1024 * 1024;
+
+    bool                                          decompressing_;
+    format::CompressionType                       target_compression_type_;
+    std::unique_ptr<util::Compressor>             target_compressor_;
+    size_t                                        pending_bytes_;
+    size_t                                        free_bytes_;
+    std::deque<std::unique_ptr<ConversionBlock>>  pending_blocks_;
+    std::vector<std::unique_ptr<ConversionBlock>> free_blocks_;
+
+    // Declared last so that worker threads are joined before the blocks they convert are released.
+    std::unique_ptr<util::ThreadPool> workers_;
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
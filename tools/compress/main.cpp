@@ -32,15 +32,19 @@
 
 #include "vulkan/vulkan_core.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <thread>
 
 const char kHelpShortOption[] = "-h";
 const char kHelpLongOption[]  = "--help";
 const char kVersionOption[]   = "--version";
 const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kThreadsArgument[] = "--threads";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup";
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
+const char kArguments[] = "--threads";
 
 const char kArgNone[]    = "NONE";
 const char kArgLz4[]     = "LZ4";
@@ -58,7 +62,8 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - A tool to compress/decompress GFXReconstruct capture files.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <input_file> <output_file> <compression_format>\n",
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--threads <num>] <input_file> <output_file> "
+                           "<compression_format>\n",
                            app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <input_file>\t\tPath to the input file to process.");
@@ -78,6 +83,10 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --threads <num>\tNumber of worker threads used to decompress and recompress");
+    GFXRECON_WRITE_CONSOLE("          \t\tblocks while the input file is read and the output file is");
+    GFXRECON_WRITE_CONSOLE("          \t\twritten in order.  A value of 0 uses one thread per CPU core.");
+    GFXRECON_WRITE_CONSOLE("          \t\tThe output is the same for any thread count.  Default is 1.");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -143,7 +152,7 @@ int main(int argc, const char** argv)
 {
     gfxrecon::util::Log::Init();
 
-    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, "");
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
 
     if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
     {
@@ -196,9 +205,28 @@ int main(int argc, const char** argv)
         }
     }
 
+    uint32_t num_threads = 1;
+
+    if (arg_parser.IsArgumentSet(kThreadsArgument))
+    {
+        const std::string& threads_string = arg_parser.GetArgumentValue(kThreadsArgument);
+        char*              end            = nullptr;
+        unsigned long      value          = strtoul(threads_string.c_str(), &end, 10);
+
+        if (threads_string.empty() || (end == nullptr) || (*end != '\0'))
+        {
+            GFXRECON_LOG_ERROR("Invalid thread count \'%s\'", threads_string.c_str());
+            PrintUsage(argv[0]);
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+
+        num_threads = (value == 0) ? std::max(std::thread::hardware_concurrency(), 1u) : static_cast<uint32_t>(value);
+    }
+
     gfxrecon::CompressionConverter file_converter;
 
-    if (file_converter.Initialize(input_filename, output_filename, compression_type))
+    if (file_converter.Initialize(input_filename, output_filename, compression_type, num_threads))
     {
         if (file_converter.Process())
         {
@@ -24,29 +24,38 @@
 #include PROJECT_VERSION_HEADER_FILE
 #include "tool_settings.h"
 #include "decode/json_writer.h" /// @todo move to util?
+#include "decode/call_columns_decoder.h"
+#include "decode/column_table.h"
 #include "decode/decode_api_detection.h"
 #include "format/format.h"
 #include "util/file_output_stream.h"
 #include "util/file_path.h"
 #include "util/platform.h"
 
-#include "generated/generated_vulkan_json_consumer.h"
-#include "decode/marker_json_consumer.h"
-#include "decode/metadata_json_consumer.h"
-#if defined(D3D12_SUPPORT)
-#include "generated/generated_dx12_json_consumer.h"
-#endif
+#include "json_consumers.h"
+#include "parallel_converter.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <limits>
+#include <memory>
+#include <thread>
 
 using gfxrecon::util::JsonFormat;
-using VulkanJsonConsumer = gfxrecon::decode::MetadataJsonConsumer<
-    gfxrecon::decode::MarkerJsonConsumer<gfxrecon::decode::VulkanExportJsonConsumer>>;
-#if defined(D3D12_SUPPORT)
-using Dx12JsonConsumer =
-    gfxrecon::decode::MetadataJsonConsumer<gfxrecon::decode::MarkerJsonConsumer<gfxrecon::decode::Dx12JsonConsumer>>;
+
+const char kColumnsFormat[]    = "columns";
+const char kColumnsExtension[] = "cols";
+
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+const gfxrecon::format::CompressionType kColumnsCompression = gfxrecon::format::CompressionType::kZstd;
+#else
+const gfxrecon::format::CompressionType kColumnsCompression = gfxrecon::format::CompressionType::kLz4;
 #endif
+
 const char kOptions[] = "-h|--help,--version,--no-debug-popup,--file-per-frame,--include-binaries,--expand-flags";
 
-const char kArguments[] = "--output,--format";
+const char kArguments[] = "--output,--format,--threads";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -71,6 +80,8 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  --format <format>\tJSON format to write.");
     GFXRECON_WRITE_CONSOLE("           json\t\tStandard JSON format (indented)");
     GFXRECON_WRITE_CONSOLE("           jsonl\tJSON lines format (every object in a single line)");
+    GFXRECON_WRITE_CONSOLE("           columns\tCompressed column table with one row per API call, for analysis");
+    GFXRECON_WRITE_CONSOLE("                  \ttools.  The file layout is described in the tool's README.md.");
     GFXRECON_WRITE_CONSOLE("  --include-binaries\tDump binaries from Vulkan traces in a separate file with an unique "
                            "name. The main JSON file");
     GFXRECON_WRITE_CONSOLE("                    \twill include a reference with the file name. The binary files are "
@@ -81,6 +92,16 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE(
         "  --file-per-frame\tCreates a new file for every frame processed. Frame number is added as a suffix");
     GFXRECON_WRITE_CONSOLE("                  \tto the output file name.");
+    GFXRECON_WRITE_CONSOLE("  --threads <num>\tConvert frames in parallel on <num> threads.  The capture is split");
+    GFXRECON_WRITE_CONSOLE("                 \tinto groups of frames that are converted independently and written");
+    GFXRECON_WRITE_CONSOLE("                 \tin order.  A value of 0 uses one thread per CPU core.  Default is 1.");
+    GFXRECON_WRITE_CONSOLE("                 \tWith --include-binaries, the binary file names are prefixed with the");
+    GFXRECON_WRITE_CONSOLE("                 \tfirst block index of each group and numbered within the group, so");
+    GFXRECON_WRITE_CONSOLE("                 \tthey differ from the names of a single-threaded conversion.  With");
+    GFXRECON_WRITE_CONSOLE("                 \t--file-per-frame, a frame whose number repeats an earlier frame, as");
+    GFXRECON_WRITE_CONSOLE("                 \tafter a capture switches to frame end markers, gets a repeat count");
+    GFXRECON_WRITE_CONSOLE("                 \tsuffix instead of replacing the earlier file.  Does not apply to the");
+    GFXRECON_WRITE_CONSOLE("                 \tcolumns format.");
 
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
@@ -90,7 +111,7 @@ static void PrintUsage(const char* exe_name)
 
 static std::string GetOutputFileName(const gfxrecon::util::ArgumentParser& arg_parser,
                                      const std::string&                    input_filename,
-                                     JsonFormat                            output_format)
+                                     const std::string&                    output_extension)
 {
     std::string output_filename;
     if (arg_parser.IsArgumentSet(kOutput))
@@ -106,13 +127,24 @@ static std::string GetOutputFileName(const gfxrecon::util::ArgumentParser& arg_p
         {
             output_filename = output_filename.substr(0, ext_pos);
         }
-        output_filename += "." + gfxrecon::util::get_json_format(output_format);
+        output_filename += "." + output_extension;
     }
     return output_filename;
 }
 
+static bool IsColumnsFormat(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    return arg_parser.IsArgumentSet(kFormatArgument) &&
+           (arg_parser.GetArgumentValue(kFormatArgument) == kColumnsFormat);
+}
+
 static gfxrecon::util::JsonFormat GetOutputFormat(const gfxrecon::util::ArgumentParser& arg_parser)
 {
+    if (IsColumnsFormat(arg_parser))
+    {
+        return JsonFormat::JSON;
+    }
+
     std::string output_format;
     if (arg_parser.IsArgumentSet(kFormatArgument))
     {
@@ -122,6 +154,40 @@ static gfxrecon::util::JsonFormat GetOutputFormat(const gfxrecon::util::Argument
     return JsonFormat::JSON;
 }
 
+static std::string GetOutputExtension(const gfxrecon::util::ArgumentParser& arg_parser, JsonFormat output_format)
+{
+    if (IsColumnsFormat(arg_parser))
+    {
+        return kColumnsExtension;
+    }
+    return gfxrecon::util::get_json_format(output_format);
+}
+
+static bool GetNumThreads(const gfxrecon::util::ArgumentParser& arg_parser, uint32_t& num_threads)
+{
+    num_threads = 1;
+    if (arg_parser.IsArgumentSet(kNumConvertThreads))
+    {
+        const std::string& threads_string = arg_parser.GetArgumentValue(kNumConvertThreads);
+        char*              end            = nullptr;
+
+        errno                     = 0;
+        const unsigned long value = std::strtoul(threads_string.c_str(), &end, 10);
+
+        // strtoul() accepts leading whitespace and a minus sign, so require the value to start with a digit.
+        if (threads_string.empty() || !std::isdigit(static_cast<unsigned char>(threads_string[0])) ||
+            (end == nullptr) || (*end != '\0') || (errno == ERANGE) ||
+            (value > std::numeric_limits<uint32_t>::max()))
+        {
+            GFXRECON_LOG_ERROR("Invalid thread count \'%s\'", threads_string.c_str());
+            return false;
+        }
+
+        num_threads = (value == 0) ? std::max(std::thread::hardware_concurrency(), 1u) : static_cast<uint32_t>(value);
+    }
+    return true;
+}
+
 std::string FormatFrameNumber(uint32_t frame_number)
 {
     std::ostringstream stream;
@@ -129,6 +195,87 @@ std::string FormatFrameNumber(uint32_t frame_number)
     return stream.str();
 }
 
+static bool ConvertColumns(const std::string& input_filename, const std::string& output_filename)
+{
+    gfxrecon::decode::FileProcessor     file_processor;
+    gfxrecon::decode::ColumnTableWriter writer;
+
+    if (!file_processor.Initialize(input_filename) ||
+        !writer.Open(output_filename, gfxrecon::decode::CallColumnsDecoder::GetColumns(), kColumnsCompression))
+    {
+        return false;
+    }
+
+    gfxrecon::decode::CallColumnsDecoder decoder(&writer);
+    file_processor.AddDecoder(&decoder);
+
+    bool success = true;
+    while (success)
+    {
+        decoder.SetFrameNumber(file_processor.GetCurrentFrameNumber());
+        success = file_processor.ProcessNextFrame();
+    }
+
+    success = writer.Close();
+
+    return success && (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone);
+}
+
+static bool ConvertParallel(const std::string&                 input_filename,
+                            const std::string&                 output_filename,
+                            bool                               output_to_stdout,
+                            bool                               file_per_frame,
+                            const gfxrecon::util::JsonOptions& json_options,
+                            const std::string&                 vulkan_version,
+                            uint32_t                           num_threads)
+{
+    gfxrecon::ParallelConverter converter(input_filename, json_options, vulkan_version, num_threads);
+
+    if (file_per_frame)
+    {
+        return converter.ConvertFilePerFrame(
+            [&output_filename](uint64_t frame_number,
+                               uint32_t repeat_index) -> std::unique_ptr<gfxrecon::util::OutputStream> {
+                // Frame numbers repeat when the capture switches to frame end markers, and the frames must not be
+                // written to the same file by different threads.
+                std::string postfix = "_" + FormatFrameNumber(static_cast<uint32_t>(frame_number));
+                if (repeat_index > 0)
+                {
+                    postfix += "_" + std::to_string(repeat_index);
+                }
+
+                std::string json_filename = gfxrecon::util::filepath::InsertFilenamePostfix(output_filename, postfix);
+                FILE*       out_file_handle = nullptr;
+                gfxrecon::util::platform::FileOpen(&out_file_handle, json_filename.c_str(), "w");
+                if (out_file_handle == nullptr)
+                {
+                    GFXRECON_LOG_ERROR("Failed to create file: '%s'.", json_filename.c_str());
+                    return nullptr;
+                }
+                return std::make_unique<gfxrecon::util::FileNoLockOutputStream>(out_file_handle, true);
+            });
+    }
+
+    FILE* out_file_handle = nullptr;
+    if (output_to_stdout)
+    {
+        out_file_handle = stdout;
+    }
+    else
+    {
+        gfxrecon::util::platform::FileOpen(&out_file_handle, output_filename.c_str(), "w");
+    }
+
+    if (!out_file_handle)
+    {
+        GFXRECON_LOG_ERROR("Failed to open/create output file \"%s\"; is the path valid?", output_filename.c_str());
+        return false;
+    }
+
+    gfxrecon::util::FileNoLockOutputStream out_stream{ out_file_handle, !output_to_stdout };
+    return converter.Convert(&out_stream);
+}
+
 int main(int argc, const char** argv)
 {
     int ret_code = 0;
@@ -154,6 +301,14 @@ int main(int argc, const char** argv)
         gfxrecon::util::Log::Release();
         exit(1);
     }
+
+    uint32_t num_threads = 1;
+    if (!GetNumThreads(arg_parser, num_threads))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(1);
+    }
 #if defined(WIN32) && defined(_DEBUG)
     if (arg_parser.IsOptionSet(kNoDebugPopup))
     {
@@ -163,8 +318,10 @@ int main(int argc, const char** argv)
 
     const auto& positional_arguments = arg_parser.GetPositionalArguments();
     std::string input_filename       = positional_arguments[0];
+    bool        columns_format       = IsColumnsFormat(arg_parser);
     JsonFormat  output_format        = GetOutputFormat(arg_parser);
-    std::string output_filename      = GetOutputFileName(arg_parser, input_filename, output_format);
+    std::string output_extension     = GetOutputExtension(arg_parser, output_format);
+    std::string output_filename      = GetOutputFileName(arg_parser, input_filename, output_extension);
     std::string filename_stem        = gfxrecon::util::filepath::GetFilenameStem(output_filename);
     std::string output_dir           = gfxrecon::util::filepath::GetBasedir(output_filename);
     std::string data_dir             = gfxrecon::util::filepath::Join(output_dir, filename_stem);
@@ -174,6 +331,11 @@ int main(int argc, const char** argv)
     bool        output_to_stdout     = output_filename == "stdout";
 
     gfxrecon::decode::FileProcessor file_processor;
+    gfxrecon::util::JsonOptions     json_options;
+
+    const std::string vulkan_version{ std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE)) + "." +
+                                      std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE)) + "." +
+                                      std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE)) };
 
 #ifndef D3D12_SUPPORT
     bool detected_d3d12  = false;
@@ -187,6 +349,26 @@ int main(int argc, const char** argv)
         goto exit;
     }
 #endif
+    if (columns_format)
+    {
+        if (arg_parser.IsArgumentSet(kNumConvertThreads))
+        {
+            GFXRECON_LOG_WARNING("The --threads option does not apply to the columns format and is ignored.");
+        }
+
+        if (output_to_stdout)
+        {
+            GFXRECON_LOG_ERROR("The columns format cannot be written to stdout.");
+            ret_code = 1;
+        }
+        else if (!ConvertColumns(input_filename, output_filename))
+        {
+            GFXRECON_LOG_ERROR("Failed to process trace.");
+            ret_code = 1;
+        }
+        goto exit;
+    }
+
     if (file_per_frame && output_to_stdout)
     {
         GFXRECON_LOG_WARNING("Outputting a file per frame is not consistent with outputting to stdout.");
@@ -198,7 +380,27 @@ int main(int argc, const char** argv)
         gfxrecon::util::filepath::MakeDirectory(data_dir);
     }
 
-    if (file_processor.Initialize(input_filename))
+    json_options.root_dir      = output_dir;
+    json_options.data_sub_dir  = filename_stem;
+    json_options.format        = output_format;
+    json_options.dump_binaries = dump_binaries;
+    json_options.expand_flags  = expand_flags;
+
+    if (num_threads > 1)
+    {
+        if (!ConvertParallel(input_filename,
+                             output_filename,
+                             output_to_stdout,
+                             file_per_frame,
+                             json_options,
+                             vulkan_version,
+                             num_threads))
+        {
+            GFXRECON_LOG_ERROR("Failed to process trace.");
+            ret_code = 1;
+        }
+    }
+    else if (file_processor.Initialize(input_filename))
     {
         std::string json_filename;
         FILE*       out_file_handle = nullptr;
@@ -230,24 +432,14 @@ int main(int argc, const char** argv)
         {
             gfxrecon::util::FileNoLockOutputStream out_stream{ out_file_handle, false };
             VulkanJsonConsumer                     json_consumer;
-            gfxrecon::util::JsonOptions            json_options;
             gfxrecon::decode::VulkanDecoder        decoder;
             decoder.AddConsumer(&json_consumer);
             file_processor.AddDecoder(&decoder);
 
-            json_options.root_dir      = output_dir;
-            json_options.data_sub_dir  = filename_stem;
-            json_options.format        = output_format;
-            json_options.dump_binaries = dump_binaries;
-            json_options.expand_flags  = expand_flags;
-
             gfxrecon::decode::JsonWriter json_writer{ json_options, GFXRECON_PROJECT_VERSION_STRING, input_filename };
             file_processor.SetAnnotationProcessor(&json_writer);
 
-            bool              success = true;
-            const std::string vulkan_version{ std::to_string(VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE)) + "." +
-                                              std::to_string(VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE)) + "." +
-                                              std::to_string(VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE)) };
+            bool success = true;
             json_consumer.Initialize(&json_writer, vulkan_version);
             json_writer.StartStream(&out_stream);
 
@@ -0,0 +1,379 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#include PROJECT_VERSION_HEADER_FILE
+#include "parallel_converter.h"
+#include "json_consumers.h"
+
+#include "decode/json_writer.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_decoder.h"
+#if defined(D3D12_SUPPORT)
+#include "generated/generated_dx12_decoder.h"
+#endif
+#include "util/logging.h"
+#include "util/memory_mapped_file.h"
+#include "util/memory_output_stream.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <unordered_map>
+#include <utility>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Consecutive frames are grouped into units of at least this much capture data, so that captures with many small
+// frames are not dominated by the per-unit setup cost.
+const uint64_t kMinUnitSize = 4 * 1024 * 1024;
+
+// Converted units are buffered in memory until the units that precede them have been written, so the number of units
+// in flight is bounded to limit memory use when one unit is slow to convert.
+const uint32_t kUnitsInFlightPerThread = 2;
+
+static bool IsQueueSubmit(format::ApiCallId call_id)
+{
+    // The calls that increment the submit index of the Vulkan JSON consumer.
+    return (call_id == format::ApiCallId::ApiCall_vkQueueSubmit) ||
+           (call_id == format::ApiCallId::ApiCall_vkQueueSubmit2) ||
+           (call_id == format::ApiCallId::ApiCall_vkQueueSubmit2KHR);
+}
+
+// Counts the queue submission blocks between two block offsets.  Only block headers and API call IDs are read, which
+// are not compressed.
+static uint32_t CountQueueSubmitBlocks(const util::MemoryMappedFile& file, uint64_t begin_offset, uint64_t end_offset)
+{
+    const uint8_t* data   = file.GetData();
+    uint64_t       offset = begin_offset;
+    uint32_t       count  = 0;
+
+    while ((end_offset - offset) >= sizeof(format::BlockHeader))
+    {
+        format::BlockHeader block_header;
+        memcpy(&block_header, data + offset, sizeof(block_header));
+
+        uint64_t data_offset = offset + sizeof(block_header);
+
+        if (block_header.size > (end_offset - data_offset))
+        {
+            break;
+        }
+
+        format::ApiCallId call_id = format::ApiCallId::ApiCall_Unknown;
+
+        if ((format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kFunctionCallBlock) &&
+            (block_header.size >= sizeof(call_id)))
+        {
+            memcpy(&call_id, data + data_offset, sizeof(call_id));
+
+            if (IsQueueSubmit(call_id))
+            {
+                ++count;
+            }
+        }
+
+        offset = data_offset + block_header.size;
+    }
+
+    return count;
+}
+
+ParallelConverter::ParallelConverter(const std::string&       input_filename,
+                                     const util::JsonOptions& json_options,
+                                     const std::string&       vulkan_version,
+                                     uint32_t                 thread_count) :
+    input_filename_(input_filename), json_options_(json_options), vulkan_version_(vulkan_version),
+    thread_count_(std::max(thread_count, 1u))
+{}
+
+bool ParallelConverter::Convert(util::OutputStream* output_stream)
+{
+    if (!Initialize(false))
+    {
+        return false;
+    }
+
+    util::ThreadPool thread_pool(thread_count_);
+
+    if (!CountQueueSubmits(thread_pool))
+    {
+        return false;
+    }
+
+    // The header object and the opening and closing of the JSON array are written by the main writer, with the
+    // fragments converted by the units in between.
+    decode::JsonWriter writer{ json_options_, GFXRECON_PROJECT_VERSION_STRING, input_filename_ };
+    VulkanJsonConsumer json_consumer;
+    json_consumer.Initialize(&writer, vulkan_version_);
+#if defined(D3D12_SUPPORT)
+    Dx12JsonConsumer dx12_json_consumer;
+    dx12_json_consumer.Initialize(&writer);
+#endif
+    writer.StartStream(output_stream);
+
+    using PendingUnit = std::pair<std::unique_ptr<util::MemoryOutputStream>, std::future<bool>>;
+
+    std::deque<PendingUnit> pending;
+    size_t                  next_unit = 0;
+    bool                    success   = true;
+
+    while (success && ((next_unit < units_.size()) || !pending.empty()))
+    {
+        while ((next_unit < units_.size()) && (pending.size() < (thread_count_ * kUnitsInFlightPerThread)))
+        {
+            auto                buffer = std::make_unique<util::MemoryOutputStream>();
+            util::OutputStream* stream = buffer.get();
+            const WorkUnit*     unit   = &units_[next_unit++];
+
+            auto result = thread_pool.post([this, unit, stream]() { return ConvertUnit(*unit, stream, false); });
+            pending.emplace_back(std::move(buffer), std::move(result));
+        }
+
+        PendingUnit& unit = pending.front();
+        success           = unit.second.get();
+
+        if (success)
+        {
+            writer.WriteFragment(unit.first->GetData(), unit.first->GetDataSize());
+        }
+
+        pending.pop_front();
+    }
+
+    // Units that were posted before a failure still reference their buffers.
+    for (auto& unit : pending)
+    {
+        unit.second.wait();
+    }
+
+    writer.EndStream();
+
+    return success;
+}
+
+bool ParallelConverter::ConvertFilePerFrame(const FrameStreamFactory& create_frame_stream)
+{
+    if (!Initialize(true))
+    {
+        return false;
+    }
+
+    util::ThreadPool thread_pool(thread_count_);
+
+    if (!CountQueueSubmits(thread_pool))
+    {
+        return false;
+    }
+
+    // Every unit is a single frame that is converted to its own complete stream, so the units can be written as soon
+    // as they are converted, in any order.
+    const auto&                    frames = index_processor_.GetFileIndex()->GetFrames();
+    std::vector<std::future<bool>> results;
+
+    for (const WorkUnit& unit : units_)
+    {
+        const WorkUnit* unit_ptr = &unit;
+        uint64_t        frame    = frames[unit.first_frame].frame_number;
+
+        results.push_back(thread_pool.post([this, unit_ptr, frame, &create_frame_stream]() {
+            std::unique_ptr<util::OutputStream> stream = create_frame_stream(frame, unit_ptr->repeat_index);
+            return (stream != nullptr) && ConvertUnit(*unit_ptr, stream.get(), true);
+        }));
+    }
+
+    bool success = true;
+
+    for (auto& result : results)
+    {
+        success = result.get() && success;
+    }
+
+    return success;
+}
+
+bool ParallelConverter::Initialize(bool file_per_frame)
+{
+    if (!index_processor_.Initialize(input_filename_) || !index_processor_.LoadFileIndex(false))
+    {
+        GFXRECON_LOG_ERROR("Failed to load the frame index of %s for parallel conversion", input_filename_.c_str());
+        return false;
+    }
+
+    const decode::FileIndex* file_index = index_processor_.GetFileIndex();
+    const auto&              frames     = file_index->GetFrames();
+
+    units_.clear();
+
+    // Frames converted to their own files must not share a file name with an earlier frame of the same number.
+    std::unordered_map<uint64_t, uint32_t> frame_repeats;
+
+    for (size_t i = 0; i < frames.size(); ++i)
+    {
+        // The final entry starts the blocks that follow the last frame delimiter, which may be empty.
+        bool     is_final   = ((i + 1) == frames.size());
+        uint64_t end_offset = is_final ? file_index->GetCaptureFileSize() : frames[i + 1].offset;
+
+        if (file_per_frame || units_.empty() ||
+            ((units_.back().end_offset - units_.back().begin_offset) >= kMinUnitSize))
+        {
+            WorkUnit unit;
+            unit.first_frame  = i;
+            unit.frame_count  = 1;
+            unit.begin_offset = frames[i].offset;
+            unit.end_offset   = end_offset;
+            unit.is_final     = is_final;
+
+            if (file_per_frame)
+            {
+                unit.repeat_index = frame_repeats[frames[i].frame_number]++;
+            }
+
+            units_.push_back(unit);
+        }
+        else
+        {
+            WorkUnit& unit  = units_.back();
+            unit.end_offset = end_offset;
+            unit.is_final   = is_final;
+            ++unit.frame_count;
+        }
+    }
+
+    return true;
+}
+
+bool ParallelConverter::CountQueueSubmits(util::ThreadPool& thread_pool)
+{
+    util::MemoryMappedFile file;
+
+    if (!file.Open(input_filename_))
+    {
+        GFXRECON_LOG_ERROR("Failed to open %s to count queue submissions", input_filename_.c_str());
+        return false;
+    }
+
+    std::vector<std::future<uint32_t>> counts;
+
+    for (const WorkUnit& unit : units_)
+    {
+        uint64_t begin_offset = unit.begin_offset;
+        uint64_t end_offset   = unit.end_offset;
+
+        counts.push_back(thread_pool.post(
+            [&file, begin_offset, end_offset]() { return CountQueueSubmitBlocks(file, begin_offset, end_offset); }));
+    }
+
+    uint32_t submit_index = 0;
+
+    for (size_t i = 0; i < units_.size(); ++i)
+    {
+        units_[i].submit_index = submit_index;
+        submit_index += counts[i].get();
+    }
+
+    return true;
+}
+
+bool ParallelConverter::ConvertUnit(const WorkUnit& unit, util::OutputStream* stream, bool start_stream)
+{
+    const decode::FileIndex::Entry& first_frame = index_processor_.GetFileIndex()->GetFrames()[unit.first_frame];
+
+    decode::FileProcessor file_processor;
+
+    if (!file_processor.Initialize(input_filename_))
+    {
+        return false;
+    }
+
+    file_processor.ShareFileIndex(index_processor_);
+
+    decode::JsonWriter    writer{ json_options_, GFXRECON_PROJECT_VERSION_STRING, input_filename_ };
+    VulkanJsonConsumer    json_consumer;
+    decode::VulkanDecoder decoder;
+    decoder.AddConsumer(&json_consumer);
+    file_processor.AddDecoder(&decoder);
+    file_processor.SetAnnotationProcessor(&writer);
+
+    // The side-files for binary data are numbered by each writer, so they are also named for the unit.
+    writer.SetFilenamePrefix("block" + std::to_string(first_frame.block_index) + "_");
+
+    json_consumer.Initialize(&writer, vulkan_version_);
+    json_consumer.SetSubmitIndex(unit.submit_index);
+
+#if defined(D3D12_SUPPORT)
+    Dx12JsonConsumer    dx12_json_consumer;
+    decode::Dx12Decoder dx12_decoder;
+    dx12_decoder.AddConsumer(&dx12_json_consumer);
+    file_processor.AddDecoder(&dx12_decoder);
+    dx12_json_consumer.Initialize(&writer);
+#endif
+
+    if (start_stream)
+    {
+        writer.StartStream(stream);
+    }
+    else
+    {
+        writer.StartFragment(stream);
+    }
+
+    bool success = file_processor.SeekToIndexEntry(first_frame);
+
+    if (success)
+    {
+        if (unit.is_final)
+        {
+            bool more_frames = true;
+            while (more_frames)
+            {
+                more_frames = file_processor.ProcessNextFrame();
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0; success && (i < unit.frame_count); ++i)
+            {
+                success = file_processor.ProcessNextFrame();
+            }
+        }
+
+        success = success && (file_processor.GetErrorState() == decode::FileProcessor::kErrorNone);
+    }
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Failed to convert the frames that start at block %" PRIu64, first_frame.block_index);
+    }
+
+    json_consumer.Destroy();
+#if defined(D3D12_SUPPORT)
+    dx12_json_consumer.Destroy();
+#endif
+
+    return success;
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,101 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_CONVERT_PARALLEL_CONVERTER_H
+#define GFXRECON_CONVERT_PARALLEL_CONVERTER_H
+
+#include "decode/file_processor.h"
+#include "util/defines.h"
+#include "util/json_util.h"
+#include "util/output_stream.h"
+#include "util/threadpool.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Converts a capture file to JSON on multiple threads.  The capture is split at frame boundaries, found with the frame
+// index of the capture file, into work units of one or more frames.  Each unit is converted by its own FileProcessor,
+// decoders, and consumers into a memory buffer, and the converted units are written to the output in file order.
+//
+// Consumer state that spans frames is limited to the queue submission index, which is restored for each unit by
+// counting the submissions that precede it.  The command index of a command buffer whose recording spans a frame
+// boundary restarts from one at the boundary.
+class ParallelConverter
+{
+  public:
+    // Creates the output stream for a frame when writing a file per frame, or returns nullptr on failure.  Frame
+    // numbers restart when a capture switches from present calls to frame end markers, so repeat_index counts the
+    // earlier frames with the same number and must be used to make the stream name unique when it is not zero.
+    using FrameStreamFactory =
+        std::function<std::unique_ptr<util::OutputStream>(uint64_t frame_number, uint32_t repeat_index)>;
+
+  public:
+    ParallelConverter(const std::string&       input_filename,
+                      const util::JsonOptions& json_options,
+                      const std::string&       vulkan_version,
+                      uint32_t                 thread_count);
+
+    // Writes the whole capture as a single JSON or JSONL stream.
+    bool Convert(util::OutputStream* output_stream);
+
+    // Writes each frame as a separate JSON or JSONL stream, to the output stream created for it.  The factory is called
+    // from the conversion threads.
+    bool ConvertFilePerFrame(const FrameStreamFactory& create_frame_stream);
+
+  private:
+    struct WorkUnit
+    {
+        size_t   first_frame{ 0 };  // File index frame entry of the first frame of the unit.
+        uint32_t frame_count{ 0 };  // Frames to process.  The final unit continues to the end of the file.
+        uint64_t begin_offset{ 0 };
+        uint64_t end_offset{ 0 };
+        uint32_t submit_index{ 0 }; // Queue submissions that precede the unit.
+        uint32_t repeat_index{ 0 }; // Earlier units of a file per frame conversion with the same frame number.
+        bool     is_final{ false };
+    };
+
+    bool Initialize(bool file_per_frame);
+
+    bool CountQueueSubmits(util::ThreadPool& thread_pool);
+
+    // Converts the blocks of a unit to stream, which receives a fragment of the main stream when start_stream is false
+    // and a complete stream when it is true.
+    bool ConvertUnit(const WorkUnit& unit, util::OutputStream* stream, bool start_stream);
+
+  private:
+    std::string           input_filename_;
+    util::JsonOptions     json_options_;
+    std::string           vulkan_version_;
+    uint32_t              thread_count_;
+    decode::FileProcessor index_processor_;
+    std::vector<WorkUnit> units_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_CONVERT_PARALLEL_CONVERTER_H
@@ -50,7 +50,8 @@ valid_commands = [
     'extract',
     'info',
     'optimize',
-    'replay'
+    'replay',
+    'synthesize'
 ]
 
 deprecated_commands = [
@@ -50,11 +50,13 @@
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <limits>
 #include <set>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 #include <nlohmann/json.hpp>
@@ -66,8 +68,10 @@ const char kNoDebugPopup[]      = "--no-debug-popup";
 const char kExeInfoOnlyOption[] = "--exe-info-only";
 const char kEnvVarsOnlyOption[] = "--env-vars-only";
 const char kEnumGpuIndices[]    = "--enum-gpu-indices";
+const char kIndexOption[]       = "--index";
 
-const char kOptions[] = "-h|--help,--version,--no-debug-popup,--exe-info-only,--env-vars-only,--enum-gpu-indices";
+const char kOptions[] =
+    "-h|--help,--version,--no-debug-popup,--exe-info-only,--env-vars-only,--enum-gpu-indices,--index";
 
 const char kUnrecognizedFormatString[] = "<unrecognized-format>";
 
@@ -138,7 +142,8 @@ static void PrintUsage(const char* exe_name)
     }
     GFXRECON_WRITE_CONSOLE("\n%s - Print statistics for a GFXReconstruct capture file.\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
-    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--exe-info-only] <file>\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE(
+        "  %s [-h | --help] [--version] [--exe-info-only] [--env-vars-only] <file>\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tThe GFXReconstruct capture file to be processed.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
@@ -147,6 +152,9 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("  --exe-info-only\tQuickly exit after extracting captured application's executable name");
     GFXRECON_WRITE_CONSOLE(
         "  --env-vars-only\tQuickly exit after extracting captured application's environment variables");
+    GFXRECON_WRITE_CONSOLE("         \t\t(can be combined with --exe-info-only to print both)");
+    GFXRECON_WRITE_CONSOLE("  --index\t\tWrite the frame index file used to seek to frames of the capture file,");
+    GFXRECON_WRITE_CONSOLE("         \t\tif it does not exist or is out of date, and print a summary of the index");
 #if defined(WIN32) && defined(_DEBUG)
     GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
     GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
@@ -341,22 +349,6 @@ void PrintExeInfo(const gfxrecon::decode::InfoConsumer& info_consumer)
     GFXRECON_WRITE_CONSOLE("\tProduct name: %s", app_data.c_str());
 }
 
-// A short pass to get exe info. Only processes the first blocks of a capture file.
-void GatherAndPrintExeInfo(const std::string& input_filename)
-{
-    gfxrecon::decode::InfoConsumer  info_consumer(true);
-    gfxrecon::decode::FileProcessor file_processor;
-    if (file_processor.Initialize(input_filename))
-    {
-        gfxrecon::decode::InfoDecoder info_decoder;
-        info_decoder.AddConsumer(&info_consumer);
-        file_processor.AddDecoder(&info_decoder);
-        file_processor.ProcessAllFrames();
-
-        PrintExeInfo(info_consumer);
-    }
-}
-
 void PrintVulkanStats(const gfxrecon::decode::VulkanStatsConsumer& vulkan_stats_consumer,
                       const gfxrecon::decode::FileProcessor&       file_processor,
                       const ApiAgnosticStats&                      api_agnostic_stats,
@@ -366,7 +358,8 @@ void PrintVulkanStats(const gfxrecon::decode::VulkanStatsConsumer& vulkan_stats_
     {
         GFXRECON_WRITE_CONSOLE("");
         GFXRECON_WRITE_CONSOLE("File info:");
-        gfxrecon::format::CompressionType compression_type = gfxrecon::format::CompressionType::kNone;
+        gfxrecon::format::CompressionType   compression_type   = gfxrecon::format::CompressionType::kNone;
+        gfxrecon::format::ParameterEncoding parameter_encoding = gfxrecon::format::ParameterEncoding::kFixedSize;
 
         auto file_options = file_processor.GetFileOptions();
         for (const auto& option : file_options)
@@ -375,6 +368,10 @@ void PrintVulkanStats(const gfxrecon::decode::VulkanStatsConsumer& vulkan_stats_
             {
                 compression_type = static_cast<gfxrecon::format::CompressionType>(option.value);
             }
+            else if (option.key == gfxrecon::format::FileOption::kParameterEncoding)
+            {
+                parameter_encoding = static_cast<gfxrecon::format::ParameterEncoding>(option.value);
+            }
         }
 
         // Compression type.
@@ -388,6 +385,12 @@ void PrintVulkanStats(const gfxrecon::decode::VulkanStatsConsumer& vulkan_stats_
             GFXRECON_WRITE_CONSOLE("\tCompression format: %s", kUnrecognizedFormatString);
         }
 
+        // Parameter encoding.
+        if (parameter_encoding == gfxrecon::format::ParameterEncoding::kCompact)
+        {
+            GFXRECON_WRITE_CONSOLE("\tParameter encoding: Compact");
+        }
+
         // Frame counts.
         uint32_t trim_start_frame = vulkan_stats_consumer.GetTrimmedStartFrame();
         uint32_t frame_count      = file_processor.GetCurrentFrameNumber();
@@ -731,30 +734,87 @@ void PrintEnvironmentVariableInfo(gfxrecon::decode::InfoConsumer& info_consumer)
     }
 }
 
-void GatherAndPrintEnvVars(const std::string& input_filename)
+// A short pass to get exe info and environment variables, which stops once the requested reports have been found.
+// Both reports are produced by the same pass when both are requested.
+void GatherAndPrintStartupInfo(const std::string& input_filename, bool print_exe_info, bool print_env_vars)
 {
+    gfxrecon::decode::InfoConsumer  info_consumer(true, print_exe_info, print_env_vars);
     gfxrecon::decode::FileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
-        gfxrecon::decode::InfoConsumer info_consumer;
-        gfxrecon::decode::InfoDecoder  info_decoder;
+        gfxrecon::decode::InfoDecoder info_decoder;
         info_decoder.AddConsumer(&info_consumer);
         file_processor.AddDecoder(&info_decoder);
         file_processor.ProcessAllFrames();
-        if (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone)
+
+        if (print_exe_info)
+        {
+            PrintExeInfo(info_consumer);
+        }
+
+        if (print_env_vars)
         {
-            PrintEnvironmentVariableInfo(info_consumer);
+            if (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone)
+            {
+                PrintEnvironmentVariableInfo(info_consumer);
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR("Encountered error while reading capture. Unable to report environment variables.");
+            }
+        }
+    }
+}
+
+// Only reads the block headers of a capture file.
+void GatherAndPrintFileIndex(const std::string& input_filename)
+{
+    gfxrecon::decode::FileProcessor file_processor;
+    if (file_processor.Initialize(input_filename) && file_processor.LoadFileIndex(true))
+    {
+        const gfxrecon::decode::FileIndex* file_index = file_processor.GetFileIndex();
+        const auto&                        frames     = file_index->GetFrames();
+
+        // The last frame start entry is the end of the file when the capture ends with a frame delimiter.
+        size_t frame_count = frames.size();
+        if (!frames.empty() && (frames.back().offset == file_index->GetCaptureFileSize()))
+        {
+            --frame_count;
+        }
+
+        GFXRECON_WRITE_CONSOLE("Frame index:");
+        GFXRECON_WRITE_CONSOLE("\tIndex file: %s",
+                               gfxrecon::decode::FileIndex::GetIndexFilename(input_filename).c_str());
+        GFXRECON_WRITE_CONSOLE("\tIndexed frames: %zu", frame_count);
+
+        const gfxrecon::decode::FileIndex::Entry* state_end = file_index->FindStateEnd();
+        if (state_end != nullptr)
+        {
+            GFXRECON_WRITE_CONSOLE("\tState snapshot for captured frame %" PRIu64 " ends at block %" PRIu64
+                                   " (offset %" PRIu64 ")",
+                                   state_end->marker_frame_number,
+                                   state_end->block_index,
+                                   state_end->offset);
         }
         else
         {
-            GFXRECON_LOG_ERROR("Encountered error while reading capture. Unable to report environment variables.");
+            GFXRECON_WRITE_CONSOLE("\tNo state snapshot");
         }
     }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to index capture file %s", input_filename.c_str());
+    }
 }
 
 void GatherAndPrintAllInfo(const std::string& input_filename)
 {
     gfxrecon::decode::FileProcessor file_processor;
+
+    // Every report is gathered by the decoders of this single pass, so block decompression is moved to worker threads
+    // to keep the decoders busy.
+    file_processor.SetDecompressionThreadCount(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+
     if (file_processor.Initialize(input_filename))
     {
         gfxrecon::decode::StatDecoderBase stat_decoder;
@@ -880,13 +940,16 @@ int main(int argc, const char** argv)
     const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
     std::string                     input_filename       = positional_arguments[0];
 
-    if (arg_parser.IsOptionSet(kExeInfoOnlyOption))
+    bool exe_info_only = arg_parser.IsOptionSet(kExeInfoOnlyOption);
+    bool env_vars_only = arg_parser.IsOptionSet(kEnvVarsOnlyOption);
+
+    if (exe_info_only || env_vars_only)
     {
-        GatherAndPrintExeInfo(input_filename);
+        GatherAndPrintStartupInfo(input_filename, exe_info_only, env_vars_only);
     }
-    else if (arg_parser.IsOptionSet(kEnvVarsOnlyOption))
+    else if (arg_parser.IsOptionSet(kIndexOption))
     {
-        GatherAndPrintEnvVars(input_filename);
+        GatherAndPrintFileIndex(input_filename);
     }
     else
     {
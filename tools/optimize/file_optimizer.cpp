@@ -28,6 +28,7 @@
 #include "util/platform.h"
 
 #include <cassert>
+#include <cinttypes>
 #include <string>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -50,6 +51,43 @@ uint64_t FileOptimizer::GetUnreferencedBlocksSize()
     return unreferenced_blocks_.size();
 }
 
+bool FileOptimizer::RemoveInitBlocks(const std::vector<InitBlock>& init_blocks, uint64_t blocks_end)
+{
+    for (const auto& init_block : init_blocks)
+    {
+        uint64_t bytes_read = GetNumBytesRead();
+
+        if (init_block.offset < bytes_read)
+        {
+            HandleBlockReadError(kErrorSeekingFile, "Initialization block offsets are not sorted");
+            return false;
+        }
+
+        // Copy everything between the previous removed block and this one without processing it.
+        if (!CopyBytes(init_block.offset - bytes_read))
+        {
+            HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy block data");
+            return false;
+        }
+
+        if (!RemoveInitBlock(init_block))
+        {
+            return false;
+        }
+    }
+
+    if (!CopyRemainingBytes(blocks_end))
+    {
+        if (GetErrorState() == kErrorNone)
+        {
+            HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy block data");
+        }
+        return false;
+    }
+
+    return (GetErrorState() == kErrorNone);
+}
+
 bool FileOptimizer::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id)
 {
     format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
@@ -107,23 +145,8 @@ bool FileOptimizer::FilterInitBufferMetaData(const format::BlockHeader& block_he
             // In its place insert a dummy annotation meta command. This should keep the block index when
             // replaying an optimized trimmed capture in in alignment with the block index calculated
             // at capture time
-            const char*       label = format::kAnnotationLabelRemovedResource;
-            const std::string data  = "Removed buffer " + std::to_string(header.buffer_id);
-
-            const size_t label_length = util::platform::StringLength(label);
-            const size_t data_length  = data.length();
-
-            format::AnnotationHeader annotation;
-            annotation.block_header.size = format::GetAnnotationBlockBaseSize() + label_length + data_length;
-            annotation.block_header.type = format::BlockType::kAnnotation;
-            annotation.annotation_type   = format::kText;
-            annotation.label_length      = static_cast<uint32_t>(label_length);
-            annotation.data_length       = static_cast<uint64_t>(data.length());
-
-            if (!WriteBytes(&annotation, sizeof(annotation)) || !WriteBytes(label, label_length) ||
-                !WriteBytes(data.c_str(), data_length))
+            if (!WriteRemovedResourceAnnotation("Removed buffer " + std::to_string(header.buffer_id)))
             {
-                HandleBlockWriteError(kErrorReadingBlockHeader, "Failed to write annotation meta-data block");
                 return false;
             }
 
@@ -188,23 +211,8 @@ bool FileOptimizer::FilterInitImageMetaData(const format::BlockHeader& block_hea
             // In its place insert a dummy annotation meta command. This should keep the block index when
             // replaying an optimized trimmed capture in in alignment with the block index calculated
             // at capture time
-            const char*       label = format::kAnnotationLabelRemovedResource;
-            const std::string data  = "Removed subresource from image " + std::to_string(header.image_id);
-
-            const size_t label_length = util::platform::StringLength(label);
-            const size_t data_length  = data.length();
-
-            format::AnnotationHeader annotation;
-            annotation.block_header.size = format::GetAnnotationBlockBaseSize() + label_length + data_length;
-            annotation.block_header.type = format::BlockType::kAnnotation;
-            annotation.annotation_type   = format::kText;
-            annotation.label_length      = static_cast<uint32_t>(label_length);
-            annotation.data_length       = static_cast<uint64_t>(data.length());
-
-            if (!WriteBytes(&annotation, sizeof(annotation)) || !WriteBytes(label, label_length) ||
-                !WriteBytes(data.c_str(), data_length))
+            if (!WriteRemovedResourceAnnotation("Removed subresource from image " + std::to_string(header.image_id)))
             {
-                HandleBlockWriteError(kErrorReadingBlockHeader, "Failed to write annotation meta-data block");
                 return false;
             }
 
@@ -272,4 +280,88 @@ bool FileOptimizer::FilterMethodCall(const format::BlockHeader& block_header,
     return true;
 }
 
+bool FileOptimizer::RemoveInitBlock(const InitBlock& init_block)
+{
+    format::BlockHeader block_header;
+    format::MetaDataId  meta_data_id = 0;
+    format::ThreadId    thread_id    = 0;
+    format::HandleId    device_id    = format::kNullHandleId;
+    format::HandleId    resource_id  = format::kNullHandleId;
+
+    bool success = ReadBytes(&block_header, sizeof(block_header));
+    success      = success && ReadBytes(&meta_data_id, sizeof(meta_data_id));
+    success      = success && ReadBytes(&thread_id, sizeof(thread_id));
+    success      = success && ReadBytes(&device_id, sizeof(device_id));
+    success      = success && ReadBytes(&resource_id, sizeof(resource_id));
+
+    if (!success)
+    {
+        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read initialization meta-data block header");
+        return false;
+    }
+
+    // The buffer and image initialization blocks share the same leading fields.
+    const uint64_t header_size = sizeof(meta_data_id) + sizeof(thread_id) + sizeof(device_id) + sizeof(resource_id);
+
+    format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
+
+    if ((format::RemoveCompressedBlockBit(block_header.type) != format::BlockType::kMetaDataBlock) ||
+        ((meta_data_type != format::MetaDataType::kInitBufferCommand) &&
+         (meta_data_type != format::MetaDataType::kInitImageCommand)) ||
+        (resource_id != init_block.resource_id) || (block_header.size < header_size))
+    {
+        GFXRECON_LOG_ERROR("Block at offset %" PRIu64 " is not the initialization block for resource %" PRIu64,
+                           init_block.offset,
+                           init_block.resource_id);
+        HandleBlockReadError(kErrorReadingBlockHeader, "Unexpected initialization meta-data block");
+        return false;
+    }
+
+    std::string data;
+    if (meta_data_type == format::MetaDataType::kInitBufferCommand)
+    {
+        data = "Removed buffer " + std::to_string(resource_id);
+    }
+    else
+    {
+        data = "Removed subresource from image " + std::to_string(resource_id);
+    }
+
+    if (!WriteRemovedResourceAnnotation(data))
+    {
+        return false;
+    }
+
+    if (!SkipBytes(block_header.size - header_size))
+    {
+        HandleBlockReadError(kErrorSeekingFile, "Failed to skip initialization meta-data block data");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileOptimizer::WriteRemovedResourceAnnotation(const std::string& data)
+{
+    const char*  label        = format::kAnnotationLabelRemovedResource;
+    const size_t label_length = util::platform::StringLength(label);
+    const size_t data_length  = data.length();
+
+    format::AnnotationHeader annotation;
+    annotation.block_header.size = format::GetAnnotationBlockBaseSize() + label_length + data_length;
+    annotation.block_header.type = format::BlockType::kAnnotation;
+    annotation.annotation_type   = format::kText;
+    annotation.label_length      = static_cast<uint32_t>(label_length);
+    annotation.data_length       = static_cast<uint64_t>(data_length);
+
+    if (!WriteBytes(&annotation, sizeof(annotation)) || !WriteBytes(label, label_length) ||
+        !WriteBytes(data.c_str(), data_length))
+    {
+        HandleBlockWriteError(kErrorReadingBlockHeader, "Failed to write annotation meta-data block");
+        return false;
+    }
+
+    return true;
+}
+
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -26,12 +26,22 @@
 #include "decode/file_transformer.h"
 #include "util/defines.h"
 
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
 class FileOptimizer : public decode::FileTransformer
 {
+  public:
+    // Location of a Vulkan buffer or image initialization meta-data block in the input file.
+    struct InitBlock
+    {
+        uint64_t         offset{ 0 };      // File offset of the block header.
+        format::HandleId resource_id{ 0 }; // ID of the initialized buffer or image.
+    };
+
   public:
     FileOptimizer(){};
 
@@ -43,6 +53,13 @@ class FileOptimizer : public decode::FileTransformer
 
     uint64_t GetUnreferencedBlocksSize();
 
+    // Alternative to Process() that replaces the initialization blocks at the specified file offsets with annotations.
+    // The blocks must be sorted by offset.  All other data is copied to the output file in large runs, without being
+    // parsed or decompressed.  blocks_end is the end offset of the last complete block of the input file, as found by
+    // the pass that located the blocks; a truncated block after it fails processing.  Returns false if processing
+    // failed.  Use GetErrorState() to determine the error.
+    bool RemoveInitBlocks(const std::vector<InitBlock>& init_blocks, uint64_t blocks_end);
+
   protected:
     virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataId meta_data_id) override;
 
@@ -57,6 +74,10 @@ class FileOptimizer : public decode::FileTransformer
 
     bool FilterMethodCall(const format::BlockHeader& block_header, format::ApiCallId api_call_id, uint64_t block_index);
 
+    bool RemoveInitBlock(const InitBlock& init_block);
+
+    bool WriteRemovedResourceAnnotation(const std::string& data);
+
   private:
     std::unordered_set<format::HandleId> unreferenced_ids_;
     std::unordered_set<uint64_t>         unreferenced_blocks_;
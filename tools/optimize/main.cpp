@@ -23,6 +23,7 @@
 
 #include PROJECT_VERSION_HEADER_FILE
 #include "file_optimizer.h"
+#include "vulkan_init_block_locator.h"
 
 #include "../tool_settings.h"
 
@@ -35,7 +36,6 @@
 #include "decode/file_processor.h"
 #include "format/format.h"
 #include "format/format_util.h"
-#include "generated/generated_vulkan_decoder.h"
 #include "generated/generated_vulkan_referenced_resource_consumer.h"
 #include "util/argument_parser.h"
 #include "util/logging.h"
@@ -113,15 +113,19 @@ static void PrintUsage(const char* exe_name)
 #endif
 }
 
-void GetUnreferencedResources(const std::string&                              input_filename,
-                              std::unordered_set<gfxrecon::format::HandleId>* unreferenced_ids)
+void GetUnreferencedResources(const std::string&                               input_filename,
+                              std::unordered_set<gfxrecon::format::HandleId>*  unreferenced_ids,
+                              std::vector<gfxrecon::FileOptimizer::InitBlock>* unreferenced_blocks,
+                              uint64_t*                                        blocks_end)
 {
     GFXRECON_ASSERT(unreferenced_ids != nullptr);
+    GFXRECON_ASSERT(unreferenced_blocks != nullptr);
+    GFXRECON_ASSERT(blocks_end != nullptr);
 
     gfxrecon::decode::FileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
-        gfxrecon::decode::VulkanDecoder                    decoder;
+        gfxrecon::VulkanInitBlockLocator                   decoder(&file_processor);
         gfxrecon::decode::VulkanReferencedResourceConsumer resref_consumer;
 
         decoder.AddConsumer(&resref_consumer);
@@ -140,6 +144,12 @@ void GetUnreferencedResources(const std::string&                              in
         {
             // Get the list of resources that were included in a command buffer submission during replay.
             resref_consumer.GetReferencedResourceIds(nullptr, unreferenced_ids);
+
+            // Locate the initialization blocks to remove, so that the file can be rewritten without processing it.
+            (*unreferenced_blocks) = decoder.GetInitBlocks(*unreferenced_ids);
+
+            // Processing stopped at the end of the file, or at a truncated block after the last complete block.
+            (*blocks_end) = file_processor.GetCurrentBlockOffset();
         }
         else if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
         {
@@ -156,14 +166,15 @@ void GetUnreferencedResources(const std::string&                              in
     }
 }
 
-void FilterUnreferencedResources(const std::string&                               input_filename,
-                                 const std::string&                               output_filename,
-                                 std::unordered_set<gfxrecon::format::HandleId>&& unreferenced_ids)
+void FilterUnreferencedResources(const std::string&                                     input_filename,
+                                 const std::string&                                     output_filename,
+                                 const std::vector<gfxrecon::FileOptimizer::InitBlock>& unreferenced_blocks,
+                                 uint64_t                                               blocks_end)
 {
-    gfxrecon::FileOptimizer file_processor(std::move(unreferenced_ids));
+    gfxrecon::FileOptimizer file_processor;
     if (file_processor.Initialize(input_filename, output_filename))
     {
-        file_processor.Process();
+        file_processor.RemoveInitBlocks(unreferenced_blocks, blocks_end);
 
         if (file_processor.GetErrorState() != gfxrecon::FileOptimizer::kErrorNone)
         {
@@ -181,15 +192,17 @@ void FilterUnreferencedResources(const std::string&
 void VkRemoveRedundantResources(std::string input_filename, std::string output_filename)
 {
     GFXRECON_WRITE_CONSOLE("Scanning Vulkan file %s for unreferenced resources.", input_filename.c_str());
-    std::unordered_set<gfxrecon::format::HandleId> unreferenced_ids;
-    GetUnreferencedResources(input_filename, &unreferenced_ids);
+    std::unordered_set<gfxrecon::format::HandleId>  unreferenced_ids;
+    std::vector<gfxrecon::FileOptimizer::InitBlock> unreferenced_blocks;
+    uint64_t                                        blocks_end = 0;
+    GetUnreferencedResources(input_filename, &unreferenced_ids, &unreferenced_blocks, &blocks_end);
 
     if (!unreferenced_ids.empty())
     {
         // Filter unreferenced ids.
         GFXRECON_WRITE_CONSOLE("Writing optimized file, removing initialization data for %" PRIu64 " unused resources.",
                                unreferenced_ids.size());
-        FilterUnreferencedResources(input_filename, output_filename, std::move(unreferenced_ids));
+        FilterUnreferencedResources(input_filename, output_filename, unreferenced_blocks, blocks_end);
     }
     else
     {
@@ -0,0 +1,346 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "file_optimizer.h"
+
+#include "decode/call_columns_decoder.h"
+#include "decode/file_processor.h"
+#include "format/format.h"
+#include "format/format_util.h"
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(test)
+
+class CaptureFileBuilder
+{
+  public:
+    void WriteFileHeader()
+    {
+        format::FileHeader     file_header{ GFXRECON_FOURCC, 0, 1, 1 };
+        format::FileOptionPair option{ format::FileOption::kCompressionType,
+                                       static_cast<uint32_t>(format::CompressionType::kNone) };
+        Write(&file_header, sizeof(file_header));
+        Write(&option, sizeof(option));
+    }
+
+    void WriteCall(format::ApiCallId call_id, uint32_t parameter_size)
+    {
+        std::vector<uint8_t> parameters(parameter_size, static_cast<uint8_t>(call_id));
+
+        format::FunctionCallHeader header{};
+        header.block_header.type = format::BlockType::kFunctionCallBlock;
+        header.block_header.size = (sizeof(header) - sizeof(header.block_header)) + parameters.size();
+        header.api_call_id       = call_id;
+        Write(&header, sizeof(header));
+        Write(parameters.data(), parameters.size());
+    }
+
+    // Returns the offset of the block, for the list of blocks to remove.
+    uint64_t WriteInitBuffer(format::HandleId buffer_id, uint64_t data_size)
+    {
+        uint64_t             offset = data_.size();
+        std::vector<uint8_t> data(static_cast<size_t>(data_size), static_cast<uint8_t>(buffer_id));
+
+        format::InitBufferCommandHeader header{};
+        header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) + data.size();
+        header.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitBufferCommand);
+        header.device_id = 1;
+        header.buffer_id = buffer_id;
+        header.data_size = data.size();
+        Write(&header, sizeof(header));
+        Write(data.data(), data.size());
+        return offset;
+    }
+
+    // Returns the offset of the block, for the list of blocks to remove.
+    uint64_t WriteInitImage(format::HandleId image_id, const std::vector<uint64_t>& level_sizes)
+    {
+        uint64_t offset    = data_.size();
+        uint64_t data_size = 0;
+        for (uint64_t level_size : level_sizes)
+        {
+            data_size += level_size;
+        }
+
+        std::vector<uint8_t> data(static_cast<size_t>(data_size), static_cast<uint8_t>(image_id));
+
+        format::InitImageCommandHeader header{};
+        header.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+        header.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(header) +
+                                               (level_sizes.size() * sizeof(level_sizes[0])) + data.size();
+        header.meta_header.meta_data_id =
+            format::MakeMetaDataId(format::ApiFamilyId::ApiFamily_Vulkan, format::MetaDataType::kInitImageCommand);
+        header.device_id   = 1;
+        header.image_id    = image_id;
+        header.data_size   = data.size();
+        header.level_count = static_cast<uint32_t>(level_sizes.size());
+        Write(&header, sizeof(header));
+        Write(level_sizes.data(), level_sizes.size() * sizeof(level_sizes[0]));
+        Write(data.data(), data.size());
+        return offset;
+    }
+
+    void WriteFrameEnd(uint64_t frame_number)
+    {
+        format::Marker marker{};
+        marker.header.type  = format::BlockType::kFrameMarkerBlock;
+        marker.header.size  = sizeof(marker) - sizeof(marker.header);
+        marker.marker_type  = format::MarkerType::kEndMarker;
+        marker.frame_number = frame_number;
+        Write(&marker, sizeof(marker));
+    }
+
+    size_t GetSize() const { return data_.size(); }
+
+    // Drops the end of the file, to produce a capture file that ends in the middle of a block.
+    void Truncate(size_t size) { data_.resize(size); }
+
+    bool Save(const std::string& filename) const
+    {
+        FILE* file = fopen(filename.c_str(), "wb");
+        bool  success =
+            (file != nullptr) && (fwrite(data_.data(), 1, data_.size(), file) == data_.size()) && (fclose(file) == 0);
+        return success;
+    }
+
+  private:
+    void Write(const void* data, size_t size)
+    {
+        data_.insert(data_.end(), static_cast<const uint8_t*>(data), static_cast<const uint8_t*>(data) + size);
+    }
+
+    std::vector<uint8_t> data_;
+};
+
+static std::vector<uint8_t> LoadFile(const std::string& filename)
+{
+    std::vector<uint8_t> data;
+    FILE*                file = fopen(filename.c_str(), "rb");
+    if (file != nullptr)
+    {
+        uint8_t buffer[4096];
+        size_t  count = 0;
+        while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        {
+            data.insert(data.end(), buffer, buffer + count);
+        }
+        fclose(file);
+    }
+    return data;
+}
+
+// Records the initialization block offsets like VulkanInitBlockLocator, without decoding Vulkan calls.
+class InitBlockRecorder : public decode::CallColumnsDecoder
+{
+  public:
+    InitBlockRecorder(const decode::FileProcessor* file_processor) :
+        CallColumnsDecoder(nullptr), file_processor_(file_processor)
+    {}
+
+    virtual bool SupportsMetaDataId(format::MetaDataId meta_data_id) override
+    {
+        format::MetaDataType meta_data_type = format::GetMetaDataType(meta_data_id);
+        return (meta_data_type == format::MetaDataType::kInitBufferCommand) ||
+               (meta_data_type == format::MetaDataType::kInitImageCommand);
+    }
+
+    virtual void DecodeFunctionCall(format::ApiCallId          id,
+                                    const decode::ApiCallInfo& call_info,
+                                    const uint8_t*             buffer,
+                                    size_t                     buffer_size) override
+    {}
+
+    virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
+                                           format::HandleId device_id,
+                                           format::HandleId buffer_id,
+                                           uint64_t         data_size,
+                                           const uint8_t*   data) override
+    {
+        init_blocks.push_back({ file_processor_->GetCurrentBlockOffset(), buffer_id });
+    }
+
+    virtual void DispatchInitImageCommand(format::ThreadId             thread_id,
+                                          format::HandleId             device_id,
+                                          format::HandleId             image_id,
+                                          uint64_t                     data_size,
+                                          uint32_t                     aspect,
+                                          uint32_t                     layout,
+                                          const std::vector<uint64_t>& level_sizes,
+                                          const uint8_t*               data) override
+    {
+        init_blocks.push_back({ file_processor_->GetCurrentBlockOffset(), image_id });
+    }
+
+    std::vector<FileOptimizer::InitBlock> init_blocks;
+
+  private:
+    const decode::FileProcessor* file_processor_;
+};
+
+// Scans the file the same way the resource scanning pass of gfxrecon-optimize does, returning the initialization
+// blocks of the unreferenced resources and the end of the last complete block.
+static std::vector<FileOptimizer::InitBlock> ScanCapture(const std::string&                          filename,
+                                                         const std::unordered_set<format::HandleId>& unreferenced_ids,
+                                                         uint64_t*                                   blocks_end)
+{
+    decode::FileProcessor file_processor;
+    InitBlockRecorder     recorder(&file_processor);
+    REQUIRE(file_processor.Initialize(filename));
+    file_processor.AddDecoder(&recorder);
+    file_processor.ProcessAllFrames();
+    (*blocks_end) = file_processor.GetCurrentBlockOffset();
+
+    std::vector<FileOptimizer::InitBlock> init_blocks;
+    for (const auto& init_block : recorder.init_blocks)
+    {
+        if (unreferenced_ids.find(init_block.resource_id) != unreferenced_ids.end())
+        {
+            init_blocks.push_back(init_block);
+        }
+    }
+
+    return init_blocks;
+}
+
+// Builds a capture with initialization blocks for two buffers and two images, returning the blocks of the buffer and
+// image that are treated as unreferenced.
+static std::vector<FileOptimizer::InitBlock> BuildCapture(CaptureFileBuilder* builder)
+{
+    std::vector<FileOptimizer::InitBlock> init_blocks;
+
+    builder->WriteFileHeader();
+    builder->WriteCall(format::ApiCallId::ApiCall_vkCreateBuffer, 40);
+    init_blocks.push_back({ builder->WriteInitBuffer(1, 256), 1 });
+    builder->WriteInitBuffer(2, 128);
+    builder->WriteCall(format::ApiCallId::ApiCall_vkCreateImage, 72);
+    init_blocks.push_back({ builder->WriteInitImage(3, { 1024, 256, 64 }), 3 });
+    builder->WriteInitImage(4, { 512 });
+    builder->WriteFrameEnd(1);
+    builder->WriteCall(format::ApiCallId::ApiCall_vkCmdDraw, 20);
+    builder->WriteFrameEnd(2);
+
+    return init_blocks;
+}
+
+static bool MatchInitBlocks(const std::vector<FileOptimizer::InitBlock>& a,
+                            const std::vector<FileOptimizer::InitBlock>& b)
+{
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        if ((a[i].offset != b[i].offset) || (a[i].resource_id != b[i].resource_id))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEST_CASE("FileOptimizer RemoveInitBlocks matches the output of the filtering pass", "[file_optimizer]")
+{
+    const std::string input_filename    = "file_optimizer_input_test.gfxr";
+    const std::string filtered_filename = "file_optimizer_filtered_test.gfxr";
+    const std::string removed_filename  = "file_optimizer_removed_test.gfxr";
+
+    const std::unordered_set<format::HandleId> unreferenced_ids = { 1, 3 };
+
+    CaptureFileBuilder                    builder;
+    std::vector<FileOptimizer::InitBlock> expected_blocks = BuildCapture(&builder);
+    REQUIRE(builder.Save(input_filename));
+
+    uint64_t                              blocks_end  = 0;
+    std::vector<FileOptimizer::InitBlock> init_blocks = ScanCapture(input_filename, unreferenced_ids, &blocks_end);
+    REQUIRE(MatchInitBlocks(init_blocks, expected_blocks));
+    REQUIRE(blocks_end == builder.GetSize());
+
+    // Output of the original two pass optimization, which filters the blocks while processing the whole file.
+    {
+        FileOptimizer file_optimizer(unreferenced_ids);
+        REQUIRE(file_optimizer.Initialize(input_filename, filtered_filename));
+        REQUIRE(file_optimizer.Process());
+    }
+
+    {
+        FileOptimizer file_optimizer;
+        REQUIRE(file_optimizer.Initialize(input_filename, removed_filename));
+        REQUIRE(file_optimizer.RemoveInitBlocks(init_blocks, blocks_end));
+        REQUIRE(file_optimizer.GetErrorState() == FileOptimizer::kErrorNone);
+    }
+
+    std::vector<uint8_t> filtered = LoadFile(filtered_filename);
+    std::vector<uint8_t> removed  = LoadFile(removed_filename);
+
+    REQUIRE(!filtered.empty());
+    REQUIRE(filtered.size() < builder.GetSize());
+    REQUIRE(removed == filtered);
+
+    std::remove(removed_filename.c_str());
+    std::remove(filtered_filename.c_str());
+    std::remove(input_filename.c_str());
+}
+
+TEST_CASE("FileOptimizer RemoveInitBlocks reports a truncated block at the end of the file", "[file_optimizer]")
+{
+    const std::string input_filename  = "file_optimizer_truncated_input_test.gfxr";
+    const std::string output_filename = "file_optimizer_truncated_output_test.gfxr";
+
+    CaptureFileBuilder builder;
+    BuildCapture(&builder);
+
+    // Cut the final frame marker short.
+    size_t complete_size = builder.GetSize() - sizeof(format::Marker);
+    builder.Truncate(builder.GetSize() - 4);
+    REQUIRE(builder.Save(input_filename));
+
+    uint64_t                              blocks_end  = 0;
+    std::vector<FileOptimizer::InitBlock> init_blocks = ScanCapture(input_filename, { 1, 3 }, &blocks_end);
+    REQUIRE(init_blocks.size() == 2);
+    REQUIRE(blocks_end == complete_size);
+
+    {
+        FileOptimizer file_optimizer;
+        REQUIRE(file_optimizer.Initialize(input_filename, output_filename));
+        REQUIRE_FALSE(file_optimizer.RemoveInitBlocks(init_blocks, blocks_end));
+        REQUIRE(file_optimizer.GetErrorState() == FileOptimizer::kErrorReadingBlockData);
+    }
+
+    std::remove(output_filename.c_str());
+    std::remove(input_filename.c_str());
+}
+
+GFXRECON_END_NAMESPACE(test)
+GFXRECON_END_NAMESPACE(gfxrecon)
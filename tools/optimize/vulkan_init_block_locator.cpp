@@ -0,0 +1,70 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "vulkan_init_block_locator.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+void VulkanInitBlockLocator::DispatchInitBufferCommand(format::ThreadId thread_id,
+                                                       format::HandleId device_id,
+                                                       format::HandleId buffer_id,
+                                                       uint64_t         data_size,
+                                                       const uint8_t*   data)
+{
+    init_blocks_.push_back({ file_processor_->GetCurrentBlockOffset(), buffer_id });
+
+    VulkanDecoder::DispatchInitBufferCommand(thread_id, device_id, buffer_id, data_size, data);
+}
+
+void VulkanInitBlockLocator::DispatchInitImageCommand(format::ThreadId             thread_id,
+                                                      format::HandleId             device_id,
+                                                      format::HandleId             image_id,
+                                                      uint64_t                     data_size,
+                                                      uint32_t                     aspect,
+                                                      uint32_t                     layout,
+                                                      const std::vector<uint64_t>& level_sizes,
+                                                      const uint8_t*               data)
+{
+    init_blocks_.push_back({ file_processor_->GetCurrentBlockOffset(), image_id });
+
+    VulkanDecoder::DispatchInitImageCommand(
+        thread_id, device_id, image_id, data_size, aspect, layout, level_sizes, data);
+}
+
+std::vector<FileOptimizer::InitBlock>
+VulkanInitBlockLocator::GetInitBlocks(const std::unordered_set<format::HandleId>& resource_ids) const
+{
+    // Blocks are recorded in file order, so the filtered list is already sorted by offset.
+    std::vector<FileOptimizer::InitBlock> init_blocks;
+
+    for (const auto& init_block : init_blocks_)
+    {
+        if (resource_ids.find(init_block.resource_id) != resource_ids.end())
+        {
+            init_blocks.push_back(init_block);
+        }
+    }
+
+    return init_blocks;
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
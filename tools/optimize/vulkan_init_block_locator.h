@@ -0,0 +1,70 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_VULKAN_INIT_BLOCK_LOCATOR_H
+#define GFXRECON_VULKAN_INIT_BLOCK_LOCATOR_H
+
+#include "file_optimizer.h"
+
+#include "decode/file_processor.h"
+#include "generated/generated_vulkan_decoder.h"
+#include "util/defines.h"
+
+#include <unordered_set>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Vulkan decoder that records the file offsets of the buffer and image initialization blocks it decodes, so that
+// FileOptimizer::RemoveInitBlocks() can rewrite the file without processing it block by block.
+class VulkanInitBlockLocator : public decode::VulkanDecoder
+{
+  public:
+    VulkanInitBlockLocator(const decode::FileProcessor* file_processor) : file_processor_(file_processor) {}
+
+    virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
+                                           format::HandleId device_id,
+                                           format::HandleId buffer_id,
+                                           uint64_t         data_size,
+                                           const uint8_t*   data) override;
+
+    virtual void DispatchInitImageCommand(format::ThreadId             thread_id,
+                                          format::HandleId             device_id,
+                                          format::HandleId             image_id,
+                                          uint64_t                     data_size,
+                                          uint32_t                     aspect,
+                                          uint32_t                     layout,
+                                          const std::vector<uint64_t>& level_sizes,
+                                          const uint8_t*               data) override;
+
+    // Returns the initialization blocks for the specified resources, sorted by file offset.
+    std::vector<FileOptimizer::InitBlock>
+    GetInitBlocks(const std::unordered_set<format::HandleId>& resource_ids) const;
+
+  private:
+    const decode::FileProcessor*          file_processor_;
+    std::vector<FileOptimizer::InitBlock> init_blocks_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_VULKAN_INIT_BLOCK_LOCATOR_H
@@ -104,7 +104,8 @@ void android_main(struct android_app* app)
         {
             std::unique_ptr<gfxrecon::decode::FileProcessor> file_processor =
                 arg_parser.IsOptionSet(kPreloadMeasurementRangeOption)
-                    ? std::make_unique<gfxrecon::decode::PreloadFileProcessor>()
+                    ? std::make_unique<gfxrecon::decode::PreloadFileProcessor>(
+                          arg_parser.IsOptionSet(kPreloadDecompressedOption))
                     : std::make_unique<gfxrecon::decode::FileProcessor>();
 
             if (!file_processor->Initialize(filename))
@@ -154,6 +155,7 @@ void android_main(struct android_app* app)
 
                 decoder.AddConsumer(&replay_consumer);
                 file_processor->AddDecoder(&decoder);
+                file_processor->SetDecompressionThreadCount(GetDecompressionThreadCount(replay_options));
                 application->SetPauseFrame(GetPauseFrame(arg_parser));
 
                 // Warn if the capture layer is active.
@@ -154,7 +154,8 @@ int main(int argc, const char** argv)
 
         if (arg_parser.IsOptionSet(kPreloadMeasurementRangeOption))
         {
-            file_processor = std::make_unique<gfxrecon::decode::PreloadFileProcessor>();
+            file_processor = std::make_unique<gfxrecon::decode::PreloadFileProcessor>(
+                arg_parser.IsOptionSet(kPreloadDecompressedOption));
         }
         else
         {
@@ -232,6 +233,8 @@ int main(int argc, const char** argv)
                                                   vulkan_replay_options.block_index_from,
                                                   vulkan_replay_options.block_index_to);
 
+            file_processor->SetDecompressionThreadCount(GetDecompressionThreadCount(vulkan_replay_options));
+
 #if defined(D3D12_SUPPORT)
             gfxrecon::decode::DxReplayOptions    dx_replay_options = GetDxReplayOptions(arg_parser, filename);
             gfxrecon::decode::Dx12ReplayConsumer dx12_replay_consumer(application, dx_replay_options);
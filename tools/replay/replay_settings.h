@@ -35,7 +35,8 @@ const char kOptions[] =
     "offscreen-swapchain-frame-boundary,--wait-before-present,--dump-resources-before-draw,"
     "--dump-resources-dump-depth-attachment,--dump-"
     "resources-dump-vertex-index-buffers,--dump-resources-json-output-per-command,--dump-resources-dump-immutable-"
-    "resources,--dump-resources-dump-all-image-subresources,--pbi-all,--preload-measurement-range";
+    "resources,--dump-resources-dump-all-image-subresources,--pbi-all,--preload-measurement-range,--preload-"
+    "decompressed";
 const char kArguments[] =
     "--log-level,--log-file,--gpu,--gpu-group,--pause-frame,--wsi,--surface-index,-m|--memory-translation,"
     "--replace-shaders,--screenshots,--denied-messages,--allowed-messages,--screenshot-format,--"
@@ -43,7 +44,8 @@ const char kArguments[] =
     "force-windowed,--fwo|--force-windowed-origin,--batching-memory-usage,--measurement-file,--swapchain,--sgfs|--skip-"
     "get-fence-status,--sgfr|--"
     "skip-get-fence-ranges,--dump-resources,--dump-resources-scale,--dump-resources-image-format,--dump-resources-dir,"
-    "--dump-resources-dump-color-attachment-index,--pbis,--pcj|--pipeline-creation-jobs";
+    "--dump-resources-dump-color-attachment-index,--pbis,--pcj|--pipeline-creation-jobs,"
+    "--decompression-threads";
 
 static void PrintUsage(const char* exe_name)
 {
@@ -81,6 +83,7 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfs <status> | --skip-get-fence-status <status>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sgfr <frame-ranges> | --skip-get-fence-ranges <frame-ranges>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--pbi-all] [--pbis <index1,index2>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--preload-measurement-range] [--preload-decompressed]");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--dump-resources <submit-index,command-index,drawcall-index>]");
 #endif
@@ -330,6 +333,18 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tIf <num_jobs> is negative it will be added to the number of cpu-cores");
     GFXRECON_WRITE_CONSOLE("          \t\tDefault: 0 (do not use asynchronous operations).");
     GFXRECON_WRITE_CONSOLE("          \t\tSame as --pcj <num_jobs>");
+    GFXRECON_WRITE_CONSOLE("  --decompression-threads <num_threads>");
+    GFXRECON_WRITE_CONSOLE("          \t\tSpecify the number of threads used to decompress capture file blocks");
+    GFXRECON_WRITE_CONSOLE("          \t\tahead of replay. Only applies to compressed capture files.");
+    GFXRECON_WRITE_CONSOLE("          \t\tIf <num_threads> is negative it will be added to the number of cpu-cores");
+    GFXRECON_WRITE_CONSOLE("          \t\tDefault: 0 (decompress blocks on the replay thread).");
+    GFXRECON_WRITE_CONSOLE("  --preload-measurement-range");
+    GFXRECON_WRITE_CONSOLE("          \t\tLoad the blocks of the measurement frame range into memory before");
+    GFXRECON_WRITE_CONSOLE("          \t\treplaying them.");
+    GFXRECON_WRITE_CONSOLE("  --preload-decompressed");
+    GFXRECON_WRITE_CONSOLE("          \t\tDecompress blocks while preloading the measurement frame range, so");
+    GFXRECON_WRITE_CONSOLE("          \t\tthat they are replayed without decompression. Uses more memory than");
+    GFXRECON_WRITE_CONSOLE("          \t\tpreloading the compressed blocks, which is the default.");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("")
     GFXRECON_WRITE_CONSOLE("D3D12 only:")
@@ -0,0 +1,389 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include PROJECT_VERSION_HEADER_FILE
+#include "synthetic_capture_generator.h"
+
+#include "format/format.h"
+#include "util/argument_parser.h"
+#include "util/logging.h"
+#include "util/platform.h"
+#include "util/strings.h"
+
+#include "vulkan/vulkan_core.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <thread>
+
+const char kHelpShortOption[]         = "-h";
+const char kHelpLongOption[]          = "--help";
+const char kVersionOption[]           = "--version";
+const char kNoDebugPopup[]            = "--no-debug-popup";
+const char kCompactParametersOption[] = "--compact-parameters";
+const char kFramesArgument[]          = "--frames";
+const char kCallsPerFrameArgument[]   = "--calls-per-frame";
+const char kMixArgument[]             = "--mix";
+const char kFillMemorySizeArgument[]  = "--fill-memory-size";
+const char kFillMemoryCountArgument[] = "--fill-memory-count";
+const char kCompressionArgument[]     = "--compression";
+const char kThreadsArgument[]         = "--threads";
+const char kSeedArgument[]            = "--seed";
+
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup,--compact-parameters";
+const char kArguments[] = "--frames,--calls-per-frame,--mix,--fill-memory-size,--fill-memory-count,--compression,--"
+                          "threads,--seed";
+
+const char kArgNone[] = "NONE";
+const char kArgLz4[]  = "LZ4";
+const char kArgZlib[] = "ZLIB";
+const char kArgZstd[] = "ZSTD";
+
+const char kMixDraw[]     = "draw";
+const char kMixBind[]     = "bind";
+const char kMixBarrier[]  = "barrier";
+const char kMixResource[] = "resource";
+
+static void PrintUsage(const char* exe_name)
+{
+    std::string app_name     = exe_name;
+    size_t      dir_location = app_name.find_last_of("/\\");
+    if (dir_location >= 0)
+    {
+        app_name.replace(0, dir_location + 1, "");
+    }
+    GFXRECON_WRITE_CONSOLE("\n%s - A tool to generate synthetic GFXReconstruct capture files.\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Usage:");
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] [--frames <num>]", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--calls-per-frame <num>] [--mix <mix>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--fill-memory-size <bytes>] [--fill-memory-count <num>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--compression <format>] [--compact-parameters] [--threads <num>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--seed <num>] <output_file>\n");
+    GFXRECON_WRITE_CONSOLE("Required arguments:");
+    GFXRECON_WRITE_CONSOLE("  <output_file>\t\tPath to the capture file to generate.");
+    GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
+    GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
+    GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+    GFXRECON_WRITE_CONSOLE("  --frames <num>\tNumber of frames to generate.  Default is 100.");
+    GFXRECON_WRITE_CONSOLE("  --calls-per-frame <num>");
+    GFXRECON_WRITE_CONSOLE("          \t\tNumber of API calls to generate for each frame.  Default is 10000.");
+    GFXRECON_WRITE_CONSOLE("  --mix <mix>\t\tRelative frequency of each kind of API call, specified as a");
+    GFXRECON_WRITE_CONSOLE("          \t\tcomma separated list of <kind>=<weight> pairs.  Kinds that are");
+    GFXRECON_WRITE_CONSOLE("          \t\tnot listed are not generated.  The kinds are:");
+    GFXRECON_WRITE_CONSOLE("          \t\t  draw     - vkCmdDraw and vkCmdDrawIndexed.");
+    GFXRECON_WRITE_CONSOLE("          \t\t  bind     - vkCmdBindPipeline, vkCmdBindDescriptorSets, and");
+    GFXRECON_WRITE_CONSOLE("          \t\t             vkCmdBindVertexBuffers.");
+    GFXRECON_WRITE_CONSOLE("          \t\t  barrier  - vkCmdPipelineBarrier.");
+    GFXRECON_WRITE_CONSOLE("          \t\t  resource - vkCreateBuffer and vkDestroyBuffer.");
+    GFXRECON_WRITE_CONSOLE("          \t\tDefault is draw=60,bind=25,barrier=10,resource=5.");
+    GFXRECON_WRITE_CONSOLE("  --fill-memory-size <bytes>");
+    GFXRECON_WRITE_CONSOLE("          \t\tBytes of mapped memory data to write for each frame.  Default is 0.");
+    GFXRECON_WRITE_CONSOLE("  --fill-memory-count <num>");
+    GFXRECON_WRITE_CONSOLE("          \t\tNumber of fill memory commands to split the data for each frame");
+    GFXRECON_WRITE_CONSOLE("          \t\tbetween.  Default is 1.");
+    GFXRECON_WRITE_CONSOLE("  --compression <format>");
+    GFXRECON_WRITE_CONSOLE("          \t\tCompression format for the capture file blocks.  Options are:");
+#if defined(GFXRECON_ENABLE_LZ4_COMPRESSION)
+    GFXRECON_WRITE_CONSOLE("          \t\t  LZ4  - Use LZ4 compression (default).");
+#endif
+#if defined(GFXRECON_ENABLE_ZLIB_COMPRESSION)
+    GFXRECON_WRITE_CONSOLE("          \t\t  ZLIB - Use zlib compression.");
+#endif
+#if defined(GFXRECON_ENABLE_ZSTD_COMPRESSION)
+    GFXRECON_WRITE_CONSOLE("          \t\t  ZSTD - Use Zstandard compression.");
+#endif
+    GFXRECON_WRITE_CONSOLE("          \t\t  NONE - Do not compress.");
+    GFXRECON_WRITE_CONSOLE("  --compact-parameters");
+    GFXRECON_WRITE_CONSOLE("          \t\tWrite parameters with the compact variable length encoding.");
+    GFXRECON_WRITE_CONSOLE("  --threads <num>\tNumber of threads that write API calls concurrently, each with");
+    GFXRECON_WRITE_CONSOLE("          \t\tits own thread ID.  Large fill memory commands are also compressed");
+    GFXRECON_WRITE_CONSOLE("          \t\ton this many threads.  A value of 0 uses one thread per CPU core.");
+    GFXRECON_WRITE_CONSOLE("          \t\tDefault is 1.");
+    GFXRECON_WRITE_CONSOLE("  --seed <num>\t\tSeed for the generated call mix and data.  With one thread, the");
+    GFXRECON_WRITE_CONSOLE("          \t\tsame seed produces the same API call blocks.  Default is 0.");
+#if defined(WIN32) && defined(_DEBUG)
+    GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
+    GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
+#endif
+    GFXRECON_WRITE_CONSOLE("\nThe capture settings environment variables and settings file also apply, as for the");
+    GFXRECON_WRITE_CONSOLE("capture layer.  The generated API calls are not replayable.");
+}
+
+static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
+    {
+        PrintUsage(exe_name);
+        return true;
+    }
+
+    return false;
+}
+
+static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kVersionOption))
+    {
+        std::string app_name     = exe_name;
+        size_t      dir_location = app_name.find_last_of("/\\");
+
+        if (dir_location >= 0)
+        {
+            app_name.replace(0, dir_location + 1, "");
+        }
+
+        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
+        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
+        GFXRECON_WRITE_CONSOLE("  Vulkan Header Version %u.%u.%u",
+                               VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+
+        return true;
+    }
+
+    return false;
+}
+
+static bool ParseUnsignedValue(const std::string& value_string, uint64_t max_value, uint64_t* value)
+{
+    char*              end    = nullptr;
+    unsigned long long result = strtoull(value_string.c_str(), &end, 10);
+
+    if (value_string.empty() || (value_string[0] == '-') || (end == nullptr) || (*end != '\0') || (result > max_value))
+    {
+        return false;
+    }
+
+    *value = result;
+    return true;
+}
+
+static bool GetUInt32Argument(const gfxrecon::util::ArgumentParser& arg_parser, const char* argument, uint32_t* value)
+{
+    if (arg_parser.IsArgumentSet(argument))
+    {
+        const std::string& value_string = arg_parser.GetArgumentValue(argument);
+        uint64_t           result       = 0;
+
+        if (!ParseUnsignedValue(value_string, std::numeric_limits<uint32_t>::max(), &result))
+        {
+            GFXRECON_LOG_ERROR("Invalid value \'%s\' for %s", value_string.c_str(), argument);
+            return false;
+        }
+
+        *value = static_cast<uint32_t>(result);
+    }
+
+    return true;
+}
+
+static bool ParseMix(const std::string& mix_string, gfxrecon::SyntheticCaptureOptions* options)
+{
+    options->draw_weight     = 0;
+    options->bind_weight     = 0;
+    options->barrier_weight  = 0;
+    options->resource_weight = 0;
+
+    for (const auto& entry : gfxrecon::util::strings::SplitString(mix_string, ','))
+    {
+        auto     pair   = gfxrecon::util::strings::SplitString(entry, '=');
+        uint64_t weight = 0;
+
+        if ((pair.size() != 2) || !ParseUnsignedValue(pair[1], std::numeric_limits<uint16_t>::max(), &weight))
+        {
+            GFXRECON_LOG_ERROR("Invalid call mix entry \'%s\'", entry.c_str());
+            return false;
+        }
+
+        if (pair[0] == kMixDraw)
+        {
+            options->draw_weight = static_cast<uint32_t>(weight);
+        }
+        else if (pair[0] == kMixBind)
+        {
+            options->bind_weight = static_cast<uint32_t>(weight);
+        }
+        else if (pair[0] == kMixBarrier)
+        {
+            options->barrier_weight = static_cast<uint32_t>(weight);
+        }
+        else if (pair[0] == kMixResource)
+        {
+            options->resource_weight = static_cast<uint32_t>(weight);
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Unrecognized call kind \'%s\' in call mix", pair[0].c_str());
+            return false;
+        }
+    }
+
+    if ((options->draw_weight + options->bind_weight + options->barrier_weight + options->resource_weight) == 0)
+    {
+        GFXRECON_LOG_ERROR("The call mix \'%s\' does not select any API calls", mix_string.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+static bool ParseCompression(const std::string& compression_string, gfxrecon::format::CompressionType* compression_type)
+{
+    if (gfxrecon::util::platform::StringCompareNoCase(kArgNone, compression_string.c_str()) == 0)
+    {
+        *compression_type = gfxrecon::format::CompressionType::kNone;
+    }
+    else if (gfxrecon::util::platform::StringCompareNoCase(kArgLz4, compression_string.c_str()) == 0)
+    {
+        *compression_type = gfxrecon::format::CompressionType::kLz4;
+    }
+    else if (gfxrecon::util::platform::StringCompareNoCase(kArgZlib, compression_string.c_str()) == 0)
+    {
+        *compression_type = gfxrecon::format::CompressionType::kZlib;
+    }
+    else if (gfxrecon::util::platform::StringCompareNoCase(kArgZstd, compression_string.c_str()) == 0)
+    {
+        *compression_type = gfxrecon::format::CompressionType::kZstd;
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Unsupported compression format \'%s\'", compression_string.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+static bool GetOptions(const gfxrecon::util::ArgumentParser& arg_parser, gfxrecon::SyntheticCaptureOptions* options)
+{
+    options->capture_file = arg_parser.GetPositionalArguments()[0];
+
+    if (!GetUInt32Argument(arg_parser, kFramesArgument, &options->frame_count) ||
+        !GetUInt32Argument(arg_parser, kCallsPerFrameArgument, &options->calls_per_frame) ||
+        !GetUInt32Argument(arg_parser, kFillMemoryCountArgument, &options->fill_memory_count) ||
+        !GetUInt32Argument(arg_parser, kThreadsArgument, &options->thread_count) ||
+        !GetUInt32Argument(arg_parser, kSeedArgument, &options->seed))
+    {
+        return false;
+    }
+
+    if (arg_parser.IsArgumentSet(kFillMemorySizeArgument))
+    {
+        const std::string& size_string = arg_parser.GetArgumentValue(kFillMemorySizeArgument);
+
+        if (!ParseUnsignedValue(size_string, std::numeric_limits<size_t>::max(), &options->fill_memory_size))
+        {
+            GFXRECON_LOG_ERROR("Invalid value \'%s\' for %s", size_string.c_str(), kFillMemorySizeArgument);
+            return false;
+        }
+    }
+
+    if (arg_parser.IsArgumentSet(kMixArgument) && !ParseMix(arg_parser.GetArgumentValue(kMixArgument), options))
+    {
+        return false;
+    }
+
+    if (arg_parser.IsArgumentSet(kCompressionArgument) &&
+        !ParseCompression(arg_parser.GetArgumentValue(kCompressionArgument), &options->compression_type))
+    {
+        return false;
+    }
+
+    if (arg_parser.IsOptionSet(kCompactParametersOption))
+    {
+        options->parameter_encoding = gfxrecon::format::ParameterEncoding::kCompact;
+    }
+
+    if (options->thread_count == 0)
+    {
+        options->thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    return true;
+}
+
+int main(int argc, const char** argv)
+{
+    gfxrecon::util::Log::Init();
+
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
+
+    if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
+    {
+        gfxrecon::util::Log::Release();
+        exit(0);
+    }
+    else if (arg_parser.IsInvalid() || (arg_parser.GetPositionalArgumentsCount() != 1))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    else
+    {
+#if defined(WIN32) && defined(_DEBUG)
+        if (arg_parser.IsOptionSet(kNoDebugPopup))
+        {
+            _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+        }
+#endif
+    }
+
+    gfxrecon::SyntheticCaptureOptions options;
+
+    if (!GetOptions(arg_parser, &options))
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
+    int return_code = 0;
+
+    {
+        // The capture manager reinitializes logging with the capture log settings, and releases it when the generator
+        // is destroyed.
+        gfxrecon::SyntheticCaptureGenerator generator(options);
+
+        if (generator.Initialize() && generator.Generate())
+        {
+            GFXRECON_WRITE_CONSOLE("Generated %u frames with %" PRIu64 " API calls and %" PRIu64
+                                   " bytes of fill memory data in %s",
+                                   options.frame_count,
+                                   generator.GetCallCount(),
+                                   generator.GetFillMemoryBytes(),
+                                   options.capture_file.c_str());
+        }
+        else
+        {
+            return_code = -1;
+        }
+    }
+
+    gfxrecon::util::Log::Release();
+
+    return return_code;
+}
@@ -0,0 +1,447 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "synthetic_capture_generator.h"
+
+#include "encode/capture_manager.h"
+#include "encode/parameter_encoder.h"
+#include "encode/struct_pointer_encoder.h"
+#include "generated/generated_vulkan_struct_encoders.h"
+#include "util/logging.h"
+#include "util/threadpool.h"
+
+#include "vulkan/vulkan_core.h"
+
+#include <algorithm>
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+const size_t   kDescriptorSetCount = 16;
+const size_t   kVertexBufferCount  = 4;
+const size_t   kMaxLiveBufferCount = 64;
+const uint32_t kMaxBoundSetCount   = 4;
+
+const uint32_t kDynamicOffsets[kMaxBoundSetCount] = { 0, 256, 512, 768 };
+
+SyntheticCaptureManager::SyntheticCaptureManager(const encode::CaptureSettings::TraceSettings& trace_settings) :
+    encode::ApiCaptureManager(format::ApiFamilyId::ApiFamily_Vulkan), trace_settings_(trace_settings)
+{}
+
+SyntheticCaptureManager* SyntheticCaptureManager::Create(const encode::CaptureSettings::TraceSettings& trace_settings)
+{
+    auto manager = new SyntheticCaptureManager(trace_settings);
+
+    // The instance is registered even when initialization fails, so it is always released with Destroy().
+    if (!encode::CommonCaptureManager::CreateInstance(manager, [manager]() { delete manager; }))
+    {
+        manager->Destroy();
+        manager = nullptr;
+    }
+
+    return manager;
+}
+
+void SyntheticCaptureManager::Destroy()
+{
+    assert(common_manager_ != nullptr);
+    common_manager_->DestroyInstance(this);
+}
+
+SyntheticCaptureGenerator::SyntheticCaptureGenerator(const SyntheticCaptureOptions& options) :
+    options_(options), manager_(nullptr), device_id_(format::kNullHandleId), fill_rng_(options.seed), call_count_(0),
+    fill_memory_bytes_(0)
+{
+    options_.thread_count      = std::max(options_.thread_count, 1u);
+    options_.fill_memory_count = std::max(options_.fill_memory_count, 1u);
+}
+
+SyntheticCaptureGenerator::~SyntheticCaptureGenerator()
+{
+    if (manager_ != nullptr)
+    {
+        manager_->Destroy();
+    }
+}
+
+bool SyntheticCaptureGenerator::Initialize()
+{
+    encode::CaptureSettings::TraceSettings trace_settings;
+    trace_settings.capture_file                            = options_.capture_file;
+    trace_settings.time_stamp_file                         = false;
+    trace_settings.memory_tracking_mode                    = encode::CaptureSettings::MemoryTrackingMode::kUnassisted;
+    trace_settings.capture_file_options.compression_type   = options_.compression_type;
+    trace_settings.capture_file_options.parameter_encoding = options_.parameter_encoding;
+
+    // Large fill memory payloads are compressed on a thread pool of the same size as the one writing API calls.
+    if (options_.thread_count > 1)
+    {
+        trace_settings.compression_threads = options_.thread_count;
+    }
+
+    manager_ = SyntheticCaptureManager::Create(trace_settings);
+    if ((manager_ == nullptr) || !manager_->IsCaptureModeWrite())
+    {
+        GFXRECON_LOG_ERROR("Failed to create capture file %s", options_.capture_file.c_str());
+        return false;
+    }
+
+    device_id_ = SyntheticCaptureManager::GetUniqueId();
+
+    for (uint32_t i = 0; i < options_.thread_count; ++i)
+    {
+        auto state = std::make_unique<WorkerState>();
+        state->rng.seed(options_.seed + i + 1);
+        state->command_buffer_id  = SyntheticCaptureManager::GetUniqueId();
+        state->pipeline_id        = SyntheticCaptureManager::GetUniqueId();
+        state->pipeline_layout_id = SyntheticCaptureManager::GetUniqueId();
+
+        for (size_t j = 0; j < kDescriptorSetCount; ++j)
+        {
+            state->descriptor_set_ids.push_back(SyntheticCaptureManager::GetUniqueId());
+        }
+
+        for (size_t j = 0; j < kVertexBufferCount; ++j)
+        {
+            state->vertex_buffer_ids.push_back(SyntheticCaptureManager::GetUniqueId());
+        }
+
+        workers_.push_back(std::move(state));
+    }
+
+    if (options_.fill_memory_size > 0)
+    {
+        size_t fill_size = static_cast<size_t>(
+            (options_.fill_memory_size + options_.fill_memory_count - 1) / options_.fill_memory_count);
+
+        for (uint32_t i = 0; i < options_.fill_memory_count; ++i)
+        {
+            memory_ids_.push_back(SyntheticCaptureManager::GetUniqueId());
+        }
+
+        // Each fill memory command writes a window of this buffer at a random offset, so that consecutive frames
+        // differ.  The data alternates between runs of a repeated value and random bytes, which compresses like
+        // typical vertex and uniform data.
+        std::uniform_int_distribution<uint32_t> byte_dist(0, 255);
+        std::uniform_int_distribution<size_t>   run_dist(1, 64);
+
+        fill_data_.resize(fill_size * 2);
+
+        size_t offset = 0;
+        while (offset < fill_data_.size())
+        {
+            size_t  run_size = std::min(run_dist(fill_rng_), fill_data_.size() - offset);
+            uint8_t value    = static_cast<uint8_t>(byte_dist(fill_rng_));
+
+            for (size_t i = 0; i < run_size; ++i)
+            {
+                fill_data_[offset + i] = ((value & 1) == 0) ? value : static_cast<uint8_t>(byte_dist(fill_rng_));
+            }
+
+            offset += run_size;
+        }
+    }
+
+    return true;
+}
+
+bool SyntheticCaptureGenerator::Generate()
+{
+    assert(manager_ != nullptr);
+
+    std::unique_ptr<util::ThreadPool> thread_pool;
+    if (options_.thread_count > 1)
+    {
+        thread_pool = std::make_unique<util::ThreadPool>(options_.thread_count);
+    }
+
+    for (uint32_t frame = 0; frame < options_.frame_count; ++frame)
+    {
+        uint32_t calls_per_worker = options_.calls_per_frame / options_.thread_count;
+        uint32_t remainder        = options_.calls_per_frame % options_.thread_count;
+
+        if (thread_pool != nullptr)
+        {
+            // The frame's calls are divided between the pool threads, which write them concurrently with their own
+            // thread IDs.  The frame ends once all of them have been written.
+            util::ThreadPool::TaskCounter tasks;
+            tasks.add(options_.thread_count);
+            for (uint32_t i = 0; i < options_.thread_count; ++i)
+            {
+                WorkerState* state      = workers_[i].get();
+                uint32_t     call_count = calls_per_worker + ((i < remainder) ? 1 : 0);
+                thread_pool->post_detached([this, state, call_count, &tasks]() {
+                    WriteCalls(state, call_count);
+                    tasks.done();
+                });
+            }
+
+            tasks.wait();
+        }
+        else
+        {
+            WriteCalls(workers_[0].get(), options_.calls_per_frame);
+        }
+
+        WriteFillMemory();
+
+        manager_->EndFrame();
+    }
+
+    return true;
+}
+
+void SyntheticCaptureGenerator::WriteCalls(WorkerState* state, uint32_t call_count)
+{
+    assert(state != nullptr);
+
+    uint32_t bind_threshold     = options_.draw_weight;
+    uint32_t barrier_threshold  = bind_threshold + options_.bind_weight;
+    uint32_t resource_threshold = barrier_threshold + options_.barrier_weight;
+    uint32_t total_weight       = resource_threshold + options_.resource_weight;
+
+    assert(total_weight > 0);
+    std::uniform_int_distribution<uint32_t> mix_dist(0, total_weight - 1);
+
+    for (uint32_t i = 0; i < call_count; ++i)
+    {
+        uint32_t selection = mix_dist(state->rng);
+
+        if (selection < bind_threshold)
+        {
+            WriteDrawCall(state);
+        }
+        else if (selection < barrier_threshold)
+        {
+            WriteBindCall(state);
+        }
+        else if (selection < resource_threshold)
+        {
+            WriteBarrierCall(state);
+        }
+        else
+        {
+            WriteResourceCall(state);
+        }
+    }
+
+    call_count_ += call_count;
+}
+
+void SyntheticCaptureGenerator::WriteDrawCall(WorkerState* state)
+{
+    std::uniform_int_distribution<uint32_t> count_dist(1, 4096);
+    uint32_t                                count = count_dist(state->rng) * 3;
+
+    if ((count & 1) == 0)
+    {
+        auto encoder = manager_->BeginApiCallCapture(format::ApiCallId::ApiCall_vkCmdDraw);
+        if (encoder)
+        {
+            encoder->EncodeHandleIdValue(state->command_buffer_id);
+            encoder->EncodeUInt32Value(count);
+            encoder->EncodeUInt32Value(1);
+            encoder->EncodeUInt32Value(0);
+            encoder->EncodeUInt32Value(0);
+            manager_->EndApiCallCapture();
+        }
+    }
+    else
+    {
+        auto encoder = manager_->BeginApiCallCapture(format::ApiCallId::ApiCall_vkCmdDrawIndexed);
+        if (encoder)
+        {
+            encoder->EncodeHandleIdValue(state->command_buffer_id);
+            encoder->EncodeUInt32Value(count);
+            encoder->EncodeUInt32Value(1);
+            encoder->EncodeUInt32Value(count_dist(state->rng));
+            encoder->EncodeInt32Value(0);
+            encoder->EncodeUInt32Value(0);
+            manager_->EndApiCallCapture();
+        }
+    }
+}
+
+void SyntheticCaptureGenerator::WriteBindCall(WorkerState* state)
+{
+    std::uniform_int_distribution<uint32_t> bind_dist(0, 2);
+    uint32_t                                bind_type = bind_dist(state->rng);
+
+    if (bind_type == 0)
+    {
+        auto encoder = manager_->BeginApiCallCapture(format::ApiCallId::ApiCall_vkCmdBindPipeline);
+        if (encoder)
+        {
+            encoder->EncodeHandleIdValue(state->command_buffer_id);
+            encoder->EncodeEnumValue(VK_PIPELINE_BIND_POINT_GRAPHICS);
+            encoder->EncodeHandleIdValue(state->pipeline_id);
+            manager_->EndApiCallCapture();
+        }
+    }
+    else if (bind_type == 1)
+    {
+        std::uniform_int_distribution<uint32_t> set_count_dist(1, kMaxBoundSetCount);
+        std::uniform_int_distribution<size_t>   set_dist(0, kDescriptorSetCount - kMaxBoundSetCount);
+
+        uint32_t set_count = set_count_dist(state->rng);
+
+        auto encoder = manager_->BeginApiCallCapture(format::ApiCallId::ApiCall_vkCmdBindDescriptorSets);
+        if (encoder)
+        {
+            encoder->EncodeHandleIdValue(state->command_buffer_id);
+            encoder->EncodeEnumValue(VK_PIPELINE_BIND_POINT_GRAPHICS);
+            encoder->EncodeHandleIdValue(state->pipeline_layout_id);
+            encoder->EncodeUInt32Value(0);
+            encoder->EncodeUInt32Value(set_count);
+            encoder->EncodeHandleIdArray(&state->descriptor_set_ids[set_dist(state->rng)], set_count);
+            encoder->EncodeUInt32Value(set_count);
+            encoder->EncodeUInt32Array(kDynamicOffsets, set_count);
+            manager_->EndApiCallCapture();
+        }
+    }
+    else
+    {
+        VkDeviceSize offsets[kVertexBufferCount] = { 0, 0, 0, 0 };
+
+        auto encoder = manager_->BeginApiCallCapture(format::ApiCallId::ApiCall_vkCmdBindVertexBuffers);
+        if (encoder)
+        {
+            encoder->EncodeHandleIdValue(state->command_buffer_id);
+            encoder->EncodeUInt32Value(0);
+            encoder->EncodeUInt32Value(static_cast<uint32_t>(kVertexBufferCount));
+            encoder->EncodeHandleIdArray(state->vertex_buffer_ids.data(), kVertexBufferCount);
+            encoder->EncodeUInt64Array(offsets, kVertexBufferCount);
+            manager_->EndApiCallCapture();
+        }
+    }
+}
+
+void SyntheticCaptureGenerator::WriteBarrierCall(WorkerState* state)
+{
+    VkMemoryBarrier memory_barrier = { VK_STRUCTURE_TYPE_MEMORY_BARRIER };
+    memory_barrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+    memory_barrier.dstAccessMask   = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT;
+
+    // The barrier has no image handle, as the synthesized calls do not create images.
+    VkImageMemoryBarrier image_barrier        = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
+    image_barrier.srcAccessMask               = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+    image_barrier.dstAccessMask               = VK_ACCESS_SHADER_READ_BIT;
+    image_barrier.oldLayout                   = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    image_barrier.newLayout                   = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    image_barrier.srcQueueFamilyIndex         = VK_QUEUE_FAMILY_IGNORED;
+    image_barrier.dstQueueFamilyIndex         = VK_QUEUE_FAMILY_IGNORED;
+    image_barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    image_barrier.subresourceRange.levelCount = 1;
+    image_barrier.subresourceRange.layerCount = 1;
+
+    auto encoder = manager_->BeginApiCallCapture(format::ApiCallId::ApiCall_vkCmdPipelineBarrier);
+    if (encoder)
+    {
+        encoder->EncodeHandleIdValue(state->command_buffer_id);
+        encoder->EncodeFlagsValue(VK_PIPELINE_STAGE_TRANSFER_BIT | VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT);
+        encoder->EncodeFlagsValue(VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+        encoder->EncodeFlagsValue(0);
+        encoder->EncodeUInt32Value(1);
+        encode::EncodeStructArray(encoder, &memory_barrier, 1);
+        encoder->EncodeUInt32Value(0);
+        encode::EncodeStructArray<VkBufferMemoryBarrier>(encoder, nullptr, 0);
+        encoder->EncodeUInt32Value(1);
+        encode::EncodeStructArray(encoder, &image_barrier, 1);
+        manager_->EndApiCallCapture();
+    }
+}
+
+void SyntheticCaptureGenerator::WriteResourceCall(WorkerState* state)
+{
+    // Buffers are created until the limit is reached, then the oldest are destroyed at random, keeping a steady
+    // population of live buffers as with an application streaming resources.
+    std::uniform_int_distribution<uint32_t> action_dist(0, 1);
+
+    bool destroy = (state->buffer_ids.size() >= kMaxLiveBufferCount) ||
+                   (!state->buffer_ids.empty() && (action_dist(state->rng) == 0));
+
+    if (destroy)
+    {
+        format::HandleId buffer_id = state->buffer_ids.front();
+        state->buffer_ids.pop_front();
+
+        auto encoder = manager_->BeginApiCallCapture(format::ApiCallId::ApiCall_vkDestroyBuffer);
+        if (encoder)
+        {
+            encoder->EncodeHandleIdValue(device_id_);
+            encoder->EncodeHandleIdValue(buffer_id);
+            encode::EncodeStructPtr<VkAllocationCallbacks>(encoder, nullptr);
+            manager_->EndApiCallCapture();
+        }
+    }
+    else
+    {
+        std::uniform_int_distribution<uint32_t> size_dist(1, 1024);
+
+        format::HandleId   buffer_id   = SyntheticCaptureManager::GetUniqueId();
+        VkBufferCreateInfo create_info = { VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO };
+        create_info.size               = static_cast<VkDeviceSize>(size_dist(state->rng)) * 256;
+        create_info.usage              = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        create_info.sharingMode        = VK_SHARING_MODE_EXCLUSIVE;
+
+        state->buffer_ids.push_back(buffer_id);
+
+        auto encoder = manager_->BeginApiCallCapture(format::ApiCallId::ApiCall_vkCreateBuffer);
+        if (encoder)
+        {
+            encoder->EncodeHandleIdValue(device_id_);
+            encode::EncodeStructPtr(encoder, &create_info);
+            encode::EncodeStructPtr<VkAllocationCallbacks>(encoder, nullptr);
+            encoder->EncodeHandleIdPtr(&buffer_id);
+            encoder->EncodeEnumValue(VK_SUCCESS);
+            manager_->EndApiCallCapture();
+        }
+    }
+}
+
+void SyntheticCaptureGenerator::WriteFillMemory()
+{
+    if (memory_ids_.empty())
+    {
+        return;
+    }
+
+    size_t                                fill_size = fill_data_.size() / 2;
+    std::uniform_int_distribution<size_t> offset_dist(0, fill_size);
+    uint64_t                              remaining = options_.fill_memory_size;
+
+    for (format::HandleId memory_id : memory_ids_)
+    {
+        uint64_t size = std::min(static_cast<uint64_t>(fill_size), remaining);
+        if (size == 0)
+        {
+            break;
+        }
+
+        manager_->WriteFillMemoryCmd(memory_id, 0, size, fill_data_.data() + offset_dist(fill_rng_));
+
+        remaining -= size;
+        fill_memory_bytes_ += size;
+    }
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
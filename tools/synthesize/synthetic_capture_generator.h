@@ -0,0 +1,140 @@
+/*
+** Copyright (c) 2024 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_SYNTHETIC_CAPTURE_GENERATOR_H
+#define GFXRECON_SYNTHETIC_CAPTURE_GENERATOR_H
+
+#include "encode/api_capture_manager.h"
+#include "encode/capture_settings.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+struct SyntheticCaptureOptions
+{
+    std::string               capture_file;
+    uint32_t                  frame_count{ 100 };
+    uint32_t                  calls_per_frame{ 10000 };
+    uint32_t                  draw_weight{ 60 };      // Relative frequency of vkCmdDraw and vkCmdDrawIndexed.
+    uint32_t                  bind_weight{ 25 };      // Relative frequency of pipeline, descriptor, and vertex binds.
+    uint32_t                  barrier_weight{ 10 };   // Relative frequency of vkCmdPipelineBarrier.
+    uint32_t                  resource_weight{ 5 };   // Relative frequency of vkCreateBuffer and vkDestroyBuffer.
+    uint64_t                  fill_memory_size{ 0 };  // Bytes of mapped memory data written each frame.
+    uint32_t                  fill_memory_count{ 1 }; // Number of fill memory commands per frame.
+    format::CompressionType   compression_type{ format::CompressionType::kLz4 };
+    format::ParameterEncoding parameter_encoding{ format::ParameterEncoding::kFixedSize };
+    uint32_t                  thread_count{ 1 };
+    uint32_t                  seed{ 0 };
+};
+
+// Provides the capture settings to the CommonCaptureManager.  There is no API state to track, as the synthesized calls
+// are never executed.
+class SyntheticCaptureManager : public encode::ApiCaptureManager
+{
+  public:
+    static SyntheticCaptureManager* Create(const encode::CaptureSettings::TraceSettings& trace_settings);
+
+    void Destroy();
+
+    virtual void CreateStateTracker() override {}
+
+    virtual void DestroyStateTracker() override {}
+
+    virtual void WriteTrackedState(util::FileOutputStream*, format::ThreadId) override {}
+
+    virtual encode::CaptureSettings::TraceSettings GetDefaultTraceSettings() override { return trace_settings_; }
+
+  private:
+    SyntheticCaptureManager(const encode::CaptureSettings::TraceSettings& trace_settings);
+
+  private:
+    encode::CaptureSettings::TraceSettings trace_settings_;
+};
+
+// Writes a Vulkan capture file of synthesized API calls and fill memory commands through the CommonCaptureManager block
+// writers, so the file has the same header, metadata, block layout, and compression as an application capture.  The
+// calls reference objects that were never created, so the file is not replayable, but it is accepted by the tools that
+// process capture file blocks.
+class SyntheticCaptureGenerator
+{
+  public:
+    SyntheticCaptureGenerator(const SyntheticCaptureOptions& options);
+
+    ~SyntheticCaptureGenerator();
+
+    // Creates the capture file.
+    bool Initialize();
+
+    bool Generate();
+
+    uint64_t GetCallCount() const { return call_count_.load(); }
+
+    uint64_t GetFillMemoryBytes() const { return fill_memory_bytes_; }
+
+  private:
+    struct WorkerState
+    {
+        std::mt19937                  rng;
+        format::HandleId              command_buffer_id{ format::kNullHandleId };
+        format::HandleId              pipeline_id{ format::kNullHandleId };
+        format::HandleId              pipeline_layout_id{ format::kNullHandleId };
+        std::vector<format::HandleId> descriptor_set_ids;
+        std::vector<format::HandleId> vertex_buffer_ids;
+        std::deque<format::HandleId>  buffer_ids;
+    };
+
+    void WriteCalls(WorkerState* state, uint32_t call_count);
+
+    void WriteDrawCall(WorkerState* state);
+
+    void WriteBindCall(WorkerState* state);
+
+    void WriteBarrierCall(WorkerState* state);
+
+    void WriteResourceCall(WorkerState* state);
+
+    void WriteFillMemory();
+
+  private:
+    SyntheticCaptureOptions                   options_;
+    SyntheticCaptureManager*                  manager_;
+    std::vector<std::unique_ptr<WorkerState>> workers_;
+    format::HandleId                          device_id_;
+    std::vector<format::HandleId>             memory_ids_;
+    std::vector<uint8_t>                      fill_data_;
+    std::mt19937                              fill_rng_;
+    std::atomic<uint64_t>                     call_count_;
+    uint64_t                                  fill_memory_bytes_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_SYNTHETIC_CAPTURE_GENERATOR_H
@@ -45,10 +45,12 @@
 
 #include "vulkan/vulkan_core.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <limits>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #ifndef GFXRECON_PLATFORM_SETTINGS_H
@@ -123,7 +125,10 @@ const char kWaitBeforePresent[]                   = "--wait-before-present";
 const char kPrintBlockInfoAllOption[]             = "--pbi-all";
 const char kPrintBlockInfosArgument[]             = "--pbis";
 const char kNumPipelineCreationJobs[]             = "--pipeline-creation-jobs";
+const char kNumDecompressionThreads[]             = "--decompression-threads";
+const char kNumConvertThreads[]                   = "--threads";
 const char kPreloadMeasurementRangeOption[]       = "--preload-measurement-range";
+const char kPreloadDecompressedOption[]           = "--preload-decompressed";
 #if defined(WIN32)
 const char kDxTwoPassReplay[]             = "--dx12-two-pass-replay";
 const char kDxOverrideObjectNames[]       = "--dx12-override-object-names";
@@ -306,6 +311,19 @@ static uint32_t GetPauseFrame(const gfxrecon::util::ArgumentParser& arg_parser)
     return pause_frame;
 }
 
+// Resolves the --decompression-threads value, where a negative value is relative to the hardware thread count.
+static uint32_t GetDecompressionThreadCount(const gfxrecon::decode::ReplayOptions& options)
+{
+    int32_t num_threads = options.num_decompression_threads;
+
+    if (num_threads < 0)
+    {
+        num_threads += static_cast<int32_t>(std::thread::hardware_concurrency());
+    }
+
+    return static_cast<uint32_t>(std::max(num_threads, 0));
+}
+
 static WsiPlatform GetWsiPlatform(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     WsiPlatform wsi_platform = WsiPlatform::kAuto;
@@ -923,6 +941,11 @@ static void GetReplayOptions(gfxrecon::decode::ReplayOptions&      options,
         options.num_pipeline_creation_jobs = std::stoi(arg_parser.GetArgumentValue(kNumPipelineCreationJobs));
     }
 
+    if (arg_parser.IsArgumentSet(kNumDecompressionThreads))
+    {
+        options.num_decompression_threads = std::stoi(arg_parser.GetArgumentValue(kNumDecompressionThreads));
+    }
+
     const auto& override_gpu = arg_parser.GetArgumentValue(kOverrideGpuArgument);
     if (!override_gpu.empty())
     {